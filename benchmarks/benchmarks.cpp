@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   benchmarks.cpp
+  \brief  Benchmark runner entry point: picobench implementation, machine-readable results, and the regression check.
+
+  Besides the picobench command line, the runner accepts three options of its own:
+  - \c -json=<file> writes every result in the Bencher Metric Format, one \c latency measure in nanoseconds per
+    iteration for each suite, benchmark, and iteration count;
+  - \c -baseline=<file> compares the run against such a file and lists every benchmark slower than the threshold;
+  - \c -threshold=<percent> sets that threshold, 10 percent by default.
+
+  The runner exits with 1 when the comparison finds a regression, so a script or CI job can fail on it. picobench keeps
+  the fastest sample of each benchmark, which makes the figures stable enough to compare across runs on one machine.
+*/
+
+#define PICOBENCH_IMPLEMENT
+
+#include <picobench/picobench.hpp>
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+/// Nanoseconds per iteration, keyed by "suite/benchmark/iterations"
+using Results = std::map<std::string, double>;
+
+/// Options the runner handles itself; everything else goes to picobench.
+struct Options {
+  std::string json;
+  std::string baseline;
+  double      threshold = 10.0;
+};
+
+// Takes the runner options out of argv, so picobench does not reject them
+bool extractOptions(int & argc, char ** argv, Options & options) {
+  int kept = 1;
+
+  for (int index = 1; index < argc; ++index) {
+    const toy::string_view argument(argv[index]);
+
+    if (argument.starts_with("-json=")) {
+      options.json = argument.substr(6);
+    } else if (argument.starts_with("-baseline=")) {
+      options.baseline = argument.substr(10);
+    } else if (argument.starts_with("-threshold=")) {
+      const toy::string_view value = argument.substr(11);
+
+      if (toy::fromChars(value.data(), value.data() + value.size(), options.threshold).error != toy::ParseError::None
+          || options.threshold < 0.0) {
+        std::fprintf(stderr, "Invalid threshold: %s\n", argv[index]);
+        return false;
+      }
+    } else {
+      argv[kept++] = argv[index];
+    }
+  }
+
+  argc = kept;
+
+  return true;
+}
+
+Results collectResults(const picobench::report & report) {
+  Results results;
+
+  for (const auto & suite : report.suites) {
+    for (const auto & benchmark : suite.benchmarks) {
+      for (const auto & data : benchmark.data) {
+        const std::string name = std::string(suite.name != nullptr ? suite.name : "") + '/' + benchmark.name + '/'
+                               + std::to_string(data.dimension);
+
+        results[name] = static_cast<double>(data.total_time_ns) / static_cast<double>(data.dimension);
+      }
+    }
+  }
+
+  return results;
+}
+
+void appendJsonString(std::string & output, toy::string_view text) {
+  output += '"';
+
+  for (const char character : text) {
+    if (character == '"' || character == '\\')
+      output += '\\';
+
+    output += character;
+  }
+
+  output += '"';
+}
+
+// Bencher Metric Format: {"name": {"latency": {"value": ns}}, ...}, one benchmark per line
+bool writeJson(const std::string & path, const Results & results) {
+  std::string output = "{\n";
+
+  for (auto entry = results.begin(); entry != results.end(); ++entry) {
+    char         value[toy::maxFloatChars(toy::FloatFormat::Fixed, 3)];
+    const char * end = toy::toChars(value, entry->second, toy::FloatFormat::Fixed, 3);
+
+    output += "  ";
+    appendJsonString(output, entry->first);
+    output += ": {\"latency\": {\"value\": ";
+    output.append(value, static_cast<size_t>(end - value));
+    output += std::next(entry) != results.end() ? "}},\n" : "}}\n";
+  }
+
+  output += "}\n";
+
+  std::ofstream file(path, std::ios::binary);
+  file << output;
+
+  return static_cast<bool>(file);
+}
+
+// Reads what writeJson() writes, and any other BMF file with a latency value per benchmark
+bool readJson(const std::string & path, Results & results) {
+  std::ifstream file(path, std::ios::binary);
+
+  if (!file)
+    return false;
+
+  const std::string text((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  const char *      cursor = text.data();
+  const char *      last   = text.data() + text.size();
+  int               depth  = 0;
+  std::string       name;
+
+  while (cursor != last) {
+    const char character = *cursor++;
+
+    if (character == '{') {
+      ++depth;
+    } else if (character == '}') {
+      --depth;
+    } else if (character == '"') {
+      std::string key;
+
+      for (; cursor != last && *cursor != '"'; ++cursor) {
+        if (*cursor == '\\' && cursor + 1 != last)
+          ++cursor;
+
+        key += *cursor;
+      }
+
+      if (cursor != last)
+        ++cursor;
+
+      if (depth == 1) {
+        name = key;
+      } else if (key == "value" && !name.empty()) {
+        while (cursor != last && (*cursor == ':' || *cursor == ' '))
+          ++cursor;
+
+        double value = 0.0;
+
+        if (toy::fromChars(cursor, last, value).error == toy::ParseError::None)
+          results[name] = value;
+      }
+    }
+  }
+
+  return true;
+}
+
+// Prints every benchmark slower than the baseline by more than the threshold; returns whether there was one
+bool compareResults(const Results & results, const Results & baseline, double threshold) {
+  size_t regressed = 0;
+  size_t improved  = 0;
+  size_t added     = 0;
+
+  for (const auto & [name, value] : results) {
+    const auto reference = baseline.find(name);
+
+    if (reference == baseline.end() || reference->second <= 0.0) {
+      ++added;
+      continue;
+    }
+
+    const double change = (value - reference->second) / reference->second * 100.0;
+
+    if (change > threshold) {
+      std::printf("REGRESSION %s: %.3f -> %.3f ns (%+.1f%%)\n", name.c_str(), reference->second, value, change);
+      ++regressed;
+    } else if (change < -threshold) {
+      ++improved;
+    }
+  }
+
+  std::printf("%zu regressed, %zu improved beyond %.1f%%, %zu without baseline, out of %zu\n", regressed, improved,
+              threshold, added, results.size());
+
+  return regressed != 0;
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+  Options options;
+
+  if (!extractOptions(argc, argv, options))
+    return 1;
+
+  picobench::runner runner;
+
+  runner.parse_cmd_line(argc, argv);
+
+  if (const int error = runner.run(); error != 0 || !runner.should_run())
+    return error; // run picobench; -help and -list stop here
+
+  const Results results = collectResults(runner.generate_report());
+
+  if (!options.json.empty() && !writeJson(options.json, results)) {
+    std::fprintf(stderr, "Cannot write %s\n", options.json.c_str());
+    return 1;
+  }
+
+  if (!options.baseline.empty()) {
+    Results baseline;
+
+    if (!readJson(options.baseline, baseline)) {
+      std::fprintf(stderr, "Cannot read %s\n", options.baseline.c_str());
+      return 1;
+    }
+
+    if (compareResults(results, baseline, options.threshold))
+      return 1;
+  }
+
+  return 0;
+}
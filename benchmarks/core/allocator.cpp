@@ -0,0 +1,131 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   allocator.cpp
+  \brief  Benchmarks for per-frame temporary allocations: the heap against the linear and frame allocators.
+
+  The small suite makes a frame's worth of small allocations of mixed sizes and frees them all, the pattern of path
+  queries and draw lists. The strings suite formats a frame's labels, too long for the small-string buffer, into heap
+  strings and into frame-allocator text; both use toy::formatTo(), so the difference is the allocation.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_allocationsPerFrame = 64;
+constexpr size_t c_arenaSize           = 64 * 1024;
+
+// Sizes of 16 to 256 bytes, as the nodes and small arrays of a frame's temporary data
+constexpr size_t allocationSize(size_t index) noexcept {
+  return 16 + (index * 37) % 241;
+}
+
+alignas(toy::c_defaultAlignment) std::byte s_memory[c_arenaSize];
+
+void heapAllocations(picobench::state & state) {
+  toy::array<void *, c_allocationsPerFrame> blocks{};
+  toy::uintptr_t                            result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index) {
+      blocks[index] = std::malloc(allocationSize(index));
+      result += reinterpret_cast<toy::uintptr_t>(blocks[index]) & 0xFF;
+    }
+
+    // Frees in a different order than allocated, as gameplay code does
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index)
+      std::free(blocks[(index * 7) % c_allocationsPerFrame]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void linearAllocations(picobench::state & state) {
+  toy::LinearAllocator arena(s_memory, sizeof(s_memory));
+  toy::uintptr_t       result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index)
+      result += reinterpret_cast<toy::uintptr_t>(arena.allocate(allocationSize(index))) & 0xFF;
+
+    arena.reset();
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void heapStrings(picobench::state & state) {
+  std::vector<std::string> labels;
+  size_t                   result = 0;
+
+  labels.reserve(c_allocationsPerFrame);
+
+  for (auto iteration : state) {
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index) {
+      char         line[64];
+      const size_t size = toy::formatTo(line, sizeof(line), "Enemy {:>4} hit points {}/100", index, iteration % 100);
+
+      labels.emplace_back(line, size);
+      result += labels.back().size();
+    }
+
+    labels.clear();
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void frameStrings(picobench::state & state) {
+  toy::FrameAllocator                                 frames(s_memory, sizeof(s_memory));
+  toy::array<toy::string_view, c_allocationsPerFrame> labels{};
+  size_t                                              result = 0;
+
+  for (auto iteration : state) {
+    frames.beginFrame();
+
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index) {
+      labels[index] = toy::format(frames, "Enemy {:>4} hit points {}/100", index, iteration % 100);
+      result += labels[index].size();
+    }
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+const std::vector<int> c_iterations{1024, 8192};
+
+} // namespace
+
+PICOBENCH_SUITE("core/allocator/small");
+
+PICOBENCH(heapAllocations).iterations(c_iterations).baseline();
+PICOBENCH(linearAllocations).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/allocator/strings");
+
+PICOBENCH(heapStrings).iterations(c_iterations).baseline();
+PICOBENCH(frameStrings).iterations(c_iterations);
@@ -0,0 +1,64 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   chrono.cpp
+  \brief  Benchmarks for toy::chrono::now() against std::chrono::steady_clock.
+
+  Each iteration reads the clock once and adds the reading to the result, the pattern of a profiler zone or a gameplay
+  timer. The engine clock reads the time-stamp counter where it is calibrated; otherwise both runs use the same timer.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+void steadyClock(picobench::state & state) {
+  uint64_t result = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    result += static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void engineClock(picobench::state & state) {
+  uint64_t result = 0;
+
+  static_cast<void>(toy::chrono::calibrate());
+
+  for ([[maybe_unused]] auto iteration : state)
+    result += toy::chrono::now();
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+const std::vector<int> c_iterations{16 * 1024, 256 * 1024};
+
+} // namespace
+
+PICOBENCH_SUITE("core/chrono/now");
+
+PICOBENCH(steadyClock).iterations(c_iterations).baseline();
+PICOBENCH(engineClock).iterations(c_iterations);
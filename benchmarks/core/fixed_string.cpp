@@ -0,0 +1,129 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_string.cpp
+  \brief  Benchmarks for toy::FixedString against std::string in per-frame string work.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Asset-path-like text: long shared prefixes, so searches and comparisons have to look at most of each string
+constexpr toy::string_view c_directory = "assets/levels/world_03/sectors/";
+constexpr toy::string_view c_extension = ".sector";
+
+constexpr size_t c_pathCapacity = 128;
+
+template <typename String>
+String makePath(size_t index) {
+  String path;
+
+  path += c_directory;
+  path += "sector_";
+  path += static_cast<char>('a' + index % 26);
+  path += static_cast<char>('a' + index / 26 % 26);
+  path += c_extension;
+
+  return path;
+}
+
+template <typename String>
+void buildPaths(picobench::state & state) {
+  size_t result = 0;
+
+  for (auto iteration : state)
+    result += makePath<String>(static_cast<size_t>(iteration)).size();
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// Searches a 256-character log line for a token near its end
+template <typename String>
+void findToken(picobench::state & state) {
+  String line;
+
+  for (size_t index = 0; line.size() < 240; ++index)
+    line += makePath<String>(index).c_str() + c_directory.size();
+
+  line += "missing=texture";
+
+  size_t result = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    result += line.find("missing=");
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// Compares asset paths that differ only in their last characters, as a name lookup does
+template <typename String>
+void comparePaths(picobench::state & state) {
+  std::vector<String> paths;
+
+  for (size_t index = 0; index < 64; ++index)
+    paths.push_back(makePath<String>(index * 26));
+
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const String & left  = paths[static_cast<size_t>(iteration) % paths.size()];
+    const String & right = paths[static_cast<size_t>(iteration + 1) % paths.size()];
+
+    result += left == right ? 1U : 0U;
+    result += left < right ? 1U : 0U;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// PICOBENCH takes a single macro argument, so each instantiation gets a name
+constexpr auto stdStringBuild   = buildPaths<std::string>;
+constexpr auto fixedStringBuild = buildPaths<toy::FixedString<c_pathCapacity>>;
+
+constexpr auto stdStringFind   = findToken<std::string>;
+constexpr auto fixedStringFind = findToken<toy::FixedString<256>>;
+
+constexpr auto stdStringCompare   = comparePaths<std::string>;
+constexpr auto fixedStringCompare = comparePaths<toy::FixedString<c_pathCapacity>>;
+
+const std::vector<int> c_iterations{1024, 8192};
+
+} // namespace
+
+PICOBENCH_SUITE("core/fixed_string/build");
+
+PICOBENCH(stdStringBuild).iterations(c_iterations).baseline();
+PICOBENCH(fixedStringBuild).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/fixed_string/find");
+
+PICOBENCH(stdStringFind).iterations(c_iterations).baseline();
+PICOBENCH(fixedStringFind).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/fixed_string/compare");
+
+PICOBENCH(stdStringCompare).iterations(c_iterations).baseline();
+PICOBENCH(fixedStringCompare).iterations(c_iterations);
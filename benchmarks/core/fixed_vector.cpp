@@ -0,0 +1,184 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_vector.cpp
+  \brief  Benchmarks for toy::FixedVector against std::vector and std::array in per-frame list work.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <algorithm>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Sort key and entity index of one queued draw, the element of a typical per-frame list
+struct DrawItem {
+  toy::uint32_t key;
+  toy::uint32_t entity;
+};
+
+constexpr size_t c_listCapacity = 256;
+
+constexpr toy::uint32_t drawKey(size_t index) {
+  return static_cast<toy::uint32_t>(index * 2654435761U >> 8);
+}
+
+// std::array with a hand-kept count, the usual alternative to a fixed-capacity vector
+struct CountedArray {
+  toy::array<DrawItem, c_listCapacity> items;
+  size_t                               size = 0;
+
+  void push_back(const DrawItem & item) {
+    items[size++] = item;
+  }
+
+  void insert(DrawItem * position, const DrawItem & item) {
+    std::copy_backward(position, end(), end() + 1);
+    *position = item;
+    ++size;
+  }
+
+  DrawItem * erase(DrawItem * position) {
+    std::copy(position + 1, end(), position);
+    --size;
+
+    return position;
+  }
+
+  DrawItem * begin() {
+    return items.data();
+  }
+
+  DrawItem * end() {
+    return items.data() + size;
+  }
+};
+
+// std::vector reserved per frame, as scratch lists are when the container owns heap storage
+struct ReservedVector : std::vector<DrawItem> {
+  ReservedVector() {
+    reserve(c_listCapacity);
+  }
+};
+
+// Builds a full list each frame and walks it once
+template <typename List>
+void buildList(picobench::state & state) {
+  size_t result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    List list;
+
+    for (size_t index = 0; index < c_listCapacity; ++index)
+      list.push_back({drawKey(index), static_cast<toy::uint32_t>(index)});
+
+    for (const DrawItem & item : list)
+      result += item.key;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+constexpr bool byKey(const DrawItem & left, const DrawItem & right) {
+  return left.key < right.key;
+}
+
+// Keeps a list sorted by key while items arrive, so every insert shifts part of the tail
+template <typename List>
+void insertSorted(picobench::state & state) {
+  size_t result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    List list;
+
+    for (size_t index = 0; index < c_listCapacity; ++index) {
+      const DrawItem item{drawKey(index), static_cast<toy::uint32_t>(index)};
+      const auto     position = std::upper_bound(list.begin(), list.end(), item, byKey);
+
+      list.insert(position, item);
+    }
+
+    result += list.begin()->entity;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// Removes every other item one at a time from the front, as despawning entities out of an ordered list does
+template <typename List>
+void eraseOrdered(picobench::state & state) {
+  size_t result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    List list;
+
+    for (size_t index = 0; index < c_listCapacity; ++index)
+      list.push_back({drawKey(index), static_cast<toy::uint32_t>(index)});
+
+    for (auto position = list.begin(); position != list.end();) {
+      position = list.erase(position);
+
+      if (position != list.end())
+        ++position;
+    }
+
+    result += list.begin()->entity;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// PICOBENCH takes a single macro argument, so each instantiation gets a name
+constexpr auto stdVectorBuild   = buildList<ReservedVector>;
+constexpr auto stdArrayBuild    = buildList<CountedArray>;
+constexpr auto fixedVectorBuild = buildList<toy::FixedVector<DrawItem, c_listCapacity>>;
+
+constexpr auto stdVectorInsert   = insertSorted<ReservedVector>;
+constexpr auto stdArrayInsert    = insertSorted<CountedArray>;
+constexpr auto fixedVectorInsert = insertSorted<toy::FixedVector<DrawItem, c_listCapacity>>;
+
+constexpr auto stdVectorErase   = eraseOrdered<ReservedVector>;
+constexpr auto stdArrayErase    = eraseOrdered<CountedArray>;
+constexpr auto fixedVectorErase = eraseOrdered<toy::FixedVector<DrawItem, c_listCapacity>>;
+
+const std::vector<int> c_iterations{64, 512};
+
+} // namespace
+
+PICOBENCH_SUITE("core/fixed_vector/build");
+
+PICOBENCH(stdVectorBuild).iterations(c_iterations).baseline();
+PICOBENCH(stdArrayBuild).iterations(c_iterations);
+PICOBENCH(fixedVectorBuild).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/fixed_vector/insert");
+
+PICOBENCH(stdVectorInsert).iterations(c_iterations).baseline();
+PICOBENCH(stdArrayInsert).iterations(c_iterations);
+PICOBENCH(fixedVectorInsert).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/fixed_vector/erase");
+
+PICOBENCH(stdVectorErase).iterations(c_iterations).baseline();
+PICOBENCH(stdArrayErase).iterations(c_iterations);
+PICOBENCH(fixedVectorErase).iterations(c_iterations);
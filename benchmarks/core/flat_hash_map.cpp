@@ -0,0 +1,169 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   flat_hash_map.cpp
+  \brief  Benchmarks for toy::FlatHashMap against std::unordered_map on a tile lookup table at load factors 0.5–0.9.
+
+  Each map holds tile indices keyed by 32-bit tile coordinates in a table of 4096 slots. Lookups alternate between
+  present and absent keys. Churn erases the oldest key and inserts a new one per iteration, so the load factor stays
+  fixed while every slot is eventually reused.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_capacity = 4096;
+
+using StdMap       = std::unordered_map<uint32_t, uint32_t>;
+using GroupsMap    = toy::FlatHashMap<uint32_t, uint32_t, c_capacity, toy::Hasher<uint32_t>, std::equal_to<uint32_t>,
+                                      toy::HashProbing::Groups>;
+using RobinHoodMap = toy::FlatHashMap<uint32_t, uint32_t, c_capacity, toy::Hasher<uint32_t>, std::equal_to<uint32_t>,
+                                      toy::HashProbing::RobinHood>;
+
+// Distinct, scattered coordinates, as packed (x, y) tile keys of a large level would be
+constexpr uint32_t tileKey(size_t index) noexcept {
+  return static_cast<uint32_t>(index) * 0x9E3779B1U;
+}
+
+template <typename Map>
+uint32_t mappedValue(const Map & map, uint32_t key) {
+  const auto position = map.find(key);
+
+  if (position == map.end())
+    return 0;
+
+  if constexpr (std::is_same_v<Map, StdMap>)
+    return position->second;
+  else
+    return position->value;
+}
+
+// Builds the map in place; the flat maps are not movable
+template <typename Map>
+void fill(Map & map, size_t count) {
+  if constexpr (std::is_same_v<Map, StdMap>)
+    map.reserve(c_capacity);
+
+  for (size_t index = 0; index < count; ++index)
+    map.try_emplace(tileKey(index), static_cast<uint32_t>(index));
+}
+
+template <typename Map, size_t LoadPercent>
+void lookup(picobench::state & state) {
+  constexpr size_t count = c_capacity * LoadPercent / 100;
+
+  Map map;
+  fill(map, count);
+
+  uint32_t result = 0;
+
+  // Indices below count are present, the others absent
+  for (auto iteration : state)
+    result += mappedValue(map, tileKey(static_cast<size_t>(iteration) % (count * 2)));
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+template <typename Map, size_t LoadPercent>
+void churn(picobench::state & state) {
+  constexpr size_t count = c_capacity * LoadPercent / 100;
+
+  Map map;
+  fill(map, count);
+
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const auto oldest = static_cast<size_t>(iteration);
+
+    result += map.erase(tileKey(oldest));
+    result += map.try_emplace(tileKey(oldest + count), static_cast<uint32_t>(oldest)).second ? 1U : 0U;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// PICOBENCH takes a single macro argument, so each instantiation gets a name
+constexpr auto stdLookup50       = lookup<StdMap, 50>;
+constexpr auto groupsLookup50    = lookup<GroupsMap, 50>;
+constexpr auto robinHoodLookup50 = lookup<RobinHoodMap, 50>;
+constexpr auto stdLookup70       = lookup<StdMap, 70>;
+constexpr auto groupsLookup70    = lookup<GroupsMap, 70>;
+constexpr auto robinHoodLookup70 = lookup<RobinHoodMap, 70>;
+constexpr auto stdLookup90       = lookup<StdMap, 90>;
+constexpr auto groupsLookup90    = lookup<GroupsMap, 90>;
+constexpr auto robinHoodLookup90 = lookup<RobinHoodMap, 90>;
+
+constexpr auto stdChurn50       = churn<StdMap, 50>;
+constexpr auto groupsChurn50    = churn<GroupsMap, 50>;
+constexpr auto robinHoodChurn50 = churn<RobinHoodMap, 50>;
+constexpr auto stdChurn70       = churn<StdMap, 70>;
+constexpr auto groupsChurn70    = churn<GroupsMap, 70>;
+constexpr auto robinHoodChurn70 = churn<RobinHoodMap, 70>;
+constexpr auto stdChurn90       = churn<StdMap, 90>;
+constexpr auto groupsChurn90    = churn<GroupsMap, 90>;
+constexpr auto robinHoodChurn90 = churn<RobinHoodMap, 90>;
+
+const std::vector<int> c_iterations{8192, 65536};
+
+} // namespace
+
+PICOBENCH_SUITE("core/flat_hash_map/lookup_50");
+
+PICOBENCH(stdLookup50).iterations(c_iterations).baseline();
+PICOBENCH(groupsLookup50).iterations(c_iterations);
+PICOBENCH(robinHoodLookup50).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/flat_hash_map/lookup_70");
+
+PICOBENCH(stdLookup70).iterations(c_iterations).baseline();
+PICOBENCH(groupsLookup70).iterations(c_iterations);
+PICOBENCH(robinHoodLookup70).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/flat_hash_map/lookup_90");
+
+PICOBENCH(stdLookup90).iterations(c_iterations).baseline();
+PICOBENCH(groupsLookup90).iterations(c_iterations);
+PICOBENCH(robinHoodLookup90).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/flat_hash_map/churn_50");
+
+PICOBENCH(stdChurn50).iterations(c_iterations).baseline();
+PICOBENCH(groupsChurn50).iterations(c_iterations);
+PICOBENCH(robinHoodChurn50).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/flat_hash_map/churn_70");
+
+PICOBENCH(stdChurn70).iterations(c_iterations).baseline();
+PICOBENCH(groupsChurn70).iterations(c_iterations);
+PICOBENCH(robinHoodChurn70).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/flat_hash_map/churn_90");
+
+PICOBENCH(stdChurn90).iterations(c_iterations).baseline();
+PICOBENCH(groupsChurn90).iterations(c_iterations);
+PICOBENCH(robinHoodChurn90).iterations(c_iterations);
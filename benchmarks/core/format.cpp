@@ -0,0 +1,203 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   format.cpp
+  \brief  Benchmarks for toy::formatTo() against \c snprintf and \c std::format_to_n on HUD-style lines.
+
+  Each suite formats the same line into a 64-byte stack buffer: integers (score and counters), floats (frame time and
+  position), and strings (names with padding). The \c std::format_to_n runs are compiled only when the standard library
+  provides \c <format>.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_lineSize = 64;
+
+const char * const c_names[] = {"player", "grunt", "heavy_gunner", "medic", "turret", "boss"};
+
+void snprintfIntegers(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const int count = std::snprintf(line, sizeof(line), "Score %08d Lives %d Combo x%u", iteration * 37, iteration % 5,
+                                    static_cast<unsigned>(iteration) % 64U);
+
+    result += static_cast<size_t>(count) + static_cast<size_t>(line[6]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyIntegers(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const size_t count = toy::formatTo(line, sizeof(line), "Score {:08} Lives {} Combo x{}", iteration * 37,
+                                       iteration % 5, static_cast<unsigned>(iteration) % 64U);
+
+    result += count + static_cast<size_t>(line[6]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void snprintfFloats(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const double frame = 16.0 + iteration * 0.001;
+    const int    count = std::snprintf(line, sizeof(line), "%.2f ms (%.3f, %.3f)", frame, frame * 3.5, -frame);
+
+    result += static_cast<size_t>(count) + static_cast<size_t>(line[0]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyFloats(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const double frame = 16.0 + iteration * 0.001;
+    const size_t count = toy::formatTo(line, sizeof(line), "{:.2f} ms ({:.3f}, {:.3f})", frame, frame * 3.5, -frame);
+
+    result += count + static_cast<size_t>(line[0]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void snprintfStrings(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const char * name  = c_names[static_cast<size_t>(iteration) % std::size(c_names)];
+    const int    count = std::snprintf(line, sizeof(line), "[%-12s] -> [%12s]", name, name);
+
+    result += static_cast<size_t>(count) + static_cast<size_t>(line[1]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyStrings(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const char * name  = c_names[static_cast<size_t>(iteration) % std::size(c_names)];
+    const size_t count = toy::formatTo(line, sizeof(line), "[{:<12}] -> [{:>12}]", name, name);
+
+    result += count + static_cast<size_t>(line[1]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+#if defined(__cpp_lib_format)
+
+void stdIntegers(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const auto written = std::format_to_n(line, sizeof(line), "Score {:08} Lives {} Combo x{}", iteration * 37,
+                                          iteration % 5, static_cast<unsigned>(iteration) % 64U);
+
+    result += static_cast<size_t>(written.size) + static_cast<size_t>(line[6]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdFloats(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const double frame   = 16.0 + iteration * 0.001;
+    const auto   written = std::format_to_n(line, sizeof(line), "{:.2f} ms ({:.3f}, {:.3f})", frame, frame * 3.5,
+                                            -frame);
+
+    result += static_cast<size_t>(written.size) + static_cast<size_t>(line[0]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdStrings(picobench::state & state) {
+  char   line[c_lineSize];
+  size_t result = 0;
+
+  for (auto iteration : state) {
+    const char * name    = c_names[static_cast<size_t>(iteration) % std::size(c_names)];
+    const auto   written = std::format_to_n(line, sizeof(line), "[{:<12}] -> [{:>12}]", name, name);
+
+    result += static_cast<size_t>(written.size) + static_cast<size_t>(line[1]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+#endif // __cpp_lib_format
+
+const std::vector<int> c_iterations{1024, 8192};
+
+} // namespace
+
+PICOBENCH_SUITE("core/format/integers");
+
+PICOBENCH(snprintfIntegers).iterations(c_iterations).baseline();
+#if defined(__cpp_lib_format)
+PICOBENCH(stdIntegers).iterations(c_iterations);
+#endif
+PICOBENCH(toyIntegers).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/format/floats");
+
+PICOBENCH(snprintfFloats).iterations(c_iterations).baseline();
+#if defined(__cpp_lib_format)
+PICOBENCH(stdFloats).iterations(c_iterations);
+#endif
+PICOBENCH(toyFloats).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/format/strings");
+
+PICOBENCH(snprintfStrings).iterations(c_iterations).baseline();
+#if defined(__cpp_lib_format)
+PICOBENCH(stdStrings).iterations(c_iterations);
+#endif
+PICOBENCH(toyStrings).iterations(c_iterations);
@@ -0,0 +1,214 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   hash.cpp
+  \brief  Benchmarks for the core hashes, on names and on large buffers, and for toy::StringId name comparison.
+
+  The quality suite reports, as each run's result, how many of 64 Ki similar names share a bucket of a 16 Ki-bucket
+  table indexed by the low hash bits. A uniform hash leaves about 49 450 names in an occupied bucket. Higher counts mean
+  clustering.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_nameCount   = 1024;
+constexpr size_t c_bufferSize  = 256 * 1024;
+constexpr size_t c_bucketCount = 16 * 1024;
+
+// Asset-like names of 20 to 40 bytes, differing only in their last characters
+const std::vector<std::string> & names() {
+  static const std::vector<std::string> list = [] {
+    std::vector<std::string> result;
+
+    for (size_t index = 0; index < c_nameCount; ++index) {
+      std::string name = "actors/enemies/";
+
+      name += index % 2 == 0 ? "grunt_" : "heavy_gunner_";
+      name += std::to_string(index);
+      result.push_back(name);
+    }
+
+    return result;
+  }();
+
+  return list;
+}
+
+const std::string & buffer() {
+  static const std::string bytes = [] {
+    std::string result(c_bufferSize, '\0');
+    uint64_t    state = 1;
+
+    for (char & byte : result) {
+      state = state * 6364136223846793005U + 1442695040888963407U;
+      byte  = static_cast<char>(state >> 56);
+    }
+
+    return result;
+  }();
+
+  return bytes;
+}
+
+uint64_t stdHash(toy::string_view text) {
+  return std::hash<toy::string_view>{}(text);
+}
+
+uint64_t fnv1a(toy::string_view text) {
+  return toy::fnv1a64(text);
+}
+
+uint64_t scalarHash(toy::string_view text) {
+  return toy::scalar::hashBuffer64(text.data(), text.size());
+}
+
+uint64_t vectorHash(toy::string_view text) {
+  return toy::hashBuffer64(text.data(), text.size());
+}
+
+template <uint64_t (*hash)(toy::string_view)>
+void hashNames(picobench::state & state) {
+  const std::vector<std::string> & list   = names();
+  uint64_t                         result = 0;
+
+  for (auto iteration : state)
+    result += hash(list[static_cast<size_t>(iteration) % list.size()]);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+template <uint64_t (*hash)(toy::string_view)>
+void hashBuffer(picobench::state & state) {
+  const std::string & bytes  = buffer();
+  uint64_t            result = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    result += hash(bytes);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// Counts names that land in a bucket already taken; the benchmark result, not the time, is the figure of merit
+template <uint64_t (*hash)(toy::string_view)>
+void bucketCollisions(picobench::state & state) {
+  std::vector<uint32_t> buckets(c_bucketCount);
+  size_t                collided = 0;
+
+  for (auto iteration : state) {
+    const std::string name = "entity_" + std::to_string(iteration);
+    uint32_t &        count = buckets[hash(name) % c_bucketCount];
+
+    collided += count > 0 ? 1U : 0U;
+    ++count;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(collided));
+}
+
+// Looks names up among the event names a gameplay system reacts to, by string and by identifier
+void compareNames(picobench::state & state) {
+  const std::vector<std::string> & list     = names();
+  const std::string                wanted[] = {"actors/enemies/grunt_1000", "actors/enemies/heavy_gunner_1001"};
+  size_t                           result   = 0;
+
+  for (auto iteration : state) {
+    const std::string & name = list[static_cast<size_t>(iteration) % list.size()];
+
+    for (const std::string & candidate : wanted)
+      result += name == candidate ? 1U : 0U;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void compareStringIds(picobench::state & state) {
+  using namespace toy::literals;
+
+  std::vector<toy::StringId> ids;
+
+  for (const std::string & name : names())
+    ids.push_back(toy::internString(name));
+
+  constexpr toy::StringId wanted[] = {"actors/enemies/grunt_1000"_sid, "actors/enemies/heavy_gunner_1001"_sid};
+  size_t                  result   = 0;
+
+  for (auto iteration : state) {
+    const toy::StringId id = ids[static_cast<size_t>(iteration) % ids.size()];
+
+    for (const toy::StringId candidate : wanted)
+      result += id == candidate ? 1U : 0U;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// PICOBENCH takes a single macro argument, so each instantiation gets a name
+constexpr auto stdHashNames    = hashNames<stdHash>;
+constexpr auto fnv1aNames      = hashNames<fnv1a>;
+constexpr auto scalarHashNames = hashNames<scalarHash>;
+constexpr auto vectorHashNames = hashNames<vectorHash>;
+
+constexpr auto stdHashBuffer    = hashBuffer<stdHash>;
+constexpr auto fnv1aBuffer      = hashBuffer<fnv1a>;
+constexpr auto scalarHashBuffer = hashBuffer<scalarHash>;
+constexpr auto vectorHashBuffer = hashBuffer<vectorHash>;
+
+constexpr auto stdHashQuality    = bucketCollisions<stdHash>;
+constexpr auto fnv1aQuality      = bucketCollisions<fnv1a>;
+constexpr auto vectorHashQuality = bucketCollisions<vectorHash>;
+
+const std::vector<int> c_iterations{1024, 8192};
+const std::vector<int> c_bufferIterations{4, 16};
+const std::vector<int> c_qualityIterations{64 * 1024};
+
+} // namespace
+
+PICOBENCH_SUITE("core/hash/names");
+
+PICOBENCH(stdHashNames).iterations(c_iterations).baseline();
+PICOBENCH(fnv1aNames).iterations(c_iterations);
+PICOBENCH(scalarHashNames).iterations(c_iterations);
+PICOBENCH(vectorHashNames).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/hash/buffer");
+
+PICOBENCH(stdHashBuffer).iterations(c_bufferIterations).baseline();
+PICOBENCH(fnv1aBuffer).iterations(c_bufferIterations);
+PICOBENCH(scalarHashBuffer).iterations(c_bufferIterations);
+PICOBENCH(vectorHashBuffer).iterations(c_bufferIterations);
+
+PICOBENCH_SUITE("core/hash/quality");
+
+PICOBENCH(stdHashQuality).iterations(c_qualityIterations).baseline();
+PICOBENCH(fnv1aQuality).iterations(c_qualityIterations);
+PICOBENCH(vectorHashQuality).iterations(c_qualityIterations);
+
+PICOBENCH_SUITE("core/hash/compare");
+
+PICOBENCH(compareNames).iterations(c_iterations).baseline();
+PICOBENCH(compareStringIds).iterations(c_iterations);
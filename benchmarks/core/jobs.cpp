@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   jobs.cpp
+  \brief  Benchmarks for toy::jobs::parallelFor() scaling with the number of worker threads.
+
+  Every iteration skins a batch of vertices, the kind of work animation runs each frame. The serial variant is the
+  baseline; the parallel variants run the same batch with one to seven workers next to the calling thread, so on a
+  machine with enough cores the time falls close to linearly with the thread count.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cmath>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_vertexCount = 65'536;
+constexpr size_t c_grain       = 1024;
+
+struct Vertex {
+  float x;
+  float y;
+  float z;
+};
+
+std::vector<Vertex> g_source(c_vertexCount, Vertex{1.0F, 2.0F, 3.0F});
+std::vector<Vertex> g_target(c_vertexCount);
+
+void skin(size_t first, size_t last, float angle) noexcept {
+  const float sine   = std::sin(angle);
+  const float cosine = std::cos(angle);
+
+  for (size_t index = first; index < last; ++index) {
+    const Vertex & vertex = g_source[index];
+
+    g_target[index] = {vertex.x * cosine - vertex.z * sine, vertex.y, vertex.x * sine + vertex.z * cosine};
+  }
+}
+
+void serial(picobench::state & state) {
+  for (auto iteration : state)
+    skin(0, c_vertexCount, static_cast<float>(iteration) * 0.01F);
+
+  state.set_result(static_cast<picobench::result_t>(g_target.back().x));
+}
+
+template <size_t Threads>
+void parallel(picobench::state & state) {
+  // The calling thread helps while it waits, so Threads - 1 workers give Threads running threads
+  toy::jobs::deInitialize();
+  toy::jobs::initialize(Threads - 1);
+
+  for (auto iteration : state) {
+    const float angle = static_cast<float>(iteration) * 0.01F;
+
+    toy::jobs::parallelFor(c_vertexCount, c_grain, [angle](size_t first, size_t last) { skin(first, last, angle); });
+  }
+
+  toy::jobs::deInitialize();
+
+  state.set_result(static_cast<picobench::result_t>(g_target.back().x));
+}
+
+constexpr auto parallel1 = parallel<1>;
+constexpr auto parallel2 = parallel<2>;
+constexpr auto parallel4 = parallel<4>;
+constexpr auto parallel8 = parallel<8>;
+
+const std::vector<int> c_iterations{16, 64};
+
+} // namespace
+
+PICOBENCH_SUITE("core/jobs/parallel_for");
+
+PICOBENCH(serial).iterations(c_iterations).baseline();
+PICOBENCH(parallel1).iterations(c_iterations);
+PICOBENCH(parallel2).iterations(c_iterations);
+PICOBENCH(parallel4).iterations(c_iterations);
+PICOBENCH(parallel8).iterations(c_iterations);
@@ -0,0 +1,117 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   log.cpp
+  \brief  Benchmarks for the cost of a deferred log call on the calling thread and of consuming the queue.
+
+  The call suite compares a log call against formatting the same line on the spot, with formatTo() and with
+  \c snprintf, which is the least a synchronous logger pays before any I/O. The log loop flushes every half queue with
+  no sink registered, so no message is dropped and the flush only frees slots. The consume suite adds a sink that
+  formats every text line, which is the work the consumer thread takes off the callers.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cstdio>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_flushInterval = toy::log::c_queueSlots / 2;
+
+constexpr toy::string_view c_name = "player";
+
+void formatNow(picobench::state & state) {
+  char   line[256];
+  size_t result = 0;
+
+  for (auto iteration : state)
+    result += toy::formatTo(line, sizeof(line), "{} moved to {:.2f}, {:.2f} in frame {}", c_name, 1.5f, -2.25f,
+                            iteration);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void snprintfNow(picobench::state & state) {
+  char   line[256];
+  size_t result = 0;
+
+  for (auto iteration : state)
+    result += static_cast<size_t>(std::snprintf(line, sizeof(line), "%.*s moved to %.2f, %.2f in frame %d",
+                                                static_cast<int>(c_name.size()), c_name.data(), 1.5, -2.25,
+                                                iteration));
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void logDeferred(picobench::state & state) {
+  toy::log::flush();
+
+  for (auto iteration : state) {
+    TOY_LOG_INFO("{} moved to {:.2f}, {:.2f} in frame {}", c_name, 1.5f, -2.25f, iteration);
+
+    if (static_cast<size_t>(iteration) % c_flushInterval == 0)
+      toy::log::flush();
+  }
+
+  toy::log::flush();
+  state.set_result(static_cast<picobench::result_t>(toy::log::droppedMessages()));
+}
+
+// Formats every message into a line, as the text sinks do, without the I/O
+void formatLines(const toy::log::Message & message, void * context) noexcept {
+  char line[256];
+
+  *static_cast<size_t *>(context) += toy::log::formatLine(line, sizeof(line), message);
+}
+
+void logAndConsume(picobench::state & state) {
+  size_t result = 0;
+
+  toy::log::flush();
+  toy::log::addSink({formatLines, nullptr, &result});
+
+  for (auto iteration : state) {
+    TOY_LOG_INFO("{} moved to {:.2f}, {:.2f} in frame {}", c_name, 1.5f, -2.25f, iteration);
+
+    if (static_cast<size_t>(iteration) % c_flushInterval == 0)
+      toy::log::flush();
+  }
+
+  toy::log::flush();
+  toy::log::removeSink(&result);
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+const std::vector<int> c_iterations{8 * 1024, 64 * 1024};
+
+} // namespace
+
+PICOBENCH_SUITE("core/log/call");
+
+PICOBENCH(formatNow).iterations(c_iterations).baseline();
+PICOBENCH(snprintfNow).iterations(c_iterations);
+PICOBENCH(logDeferred).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/log/consume");
+
+PICOBENCH(logAndConsume).iterations(c_iterations);
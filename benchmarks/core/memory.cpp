@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   memory.cpp
+  \brief  Benchmarks for memory tracking: heap allocations through a tracked allocator against the bare heap.
+
+  Both make a frame's worth of small allocations of mixed sizes and free them in another order. The difference is the
+  cost of charging each allocation to its tag, which has to stay within a few percent of the allocation itself.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_allocationsPerFrame = 64;
+
+// Sizes of 16 to 256 bytes, as the nodes and small arrays of gameplay code
+constexpr size_t allocationSize(size_t index) noexcept {
+  return 16 + (index * 37) % 241;
+}
+
+template <typename A>
+void allocations(picobench::state & state, A & allocator) {
+  toy::array<void *, c_allocationsPerFrame> blocks{};
+  toy::uintptr_t                            result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index) {
+      blocks[index] = allocator.allocate(allocationSize(index));
+      result += reinterpret_cast<toy::uintptr_t>(blocks[index]) & 0xFF;
+    }
+
+    for (size_t index = 0; index < c_allocationsPerFrame; ++index) {
+      const size_t block = (index * 7) % c_allocationsPerFrame;
+
+      allocator.deallocate(blocks[block], allocationSize(block));
+    }
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void heapAllocations(picobench::state & state) {
+  toy::HeapAllocator heap;
+
+  allocations(state, heap);
+}
+
+void trackedAllocations(picobench::state & state) {
+  toy::HeapAllocator                        heap;
+  toy::TrackedAllocator<toy::HeapAllocator> tracked(heap, toy::MemoryTag::Game);
+
+  allocations(state, tracked);
+}
+
+const std::vector<int> c_iterations{1024, 8192};
+
+} // namespace
+
+PICOBENCH_SUITE("core/memory/tracked");
+
+PICOBENCH(heapAllocations).iterations(c_iterations).baseline();
+PICOBENCH(trackedAllocations).iterations(c_iterations);
@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   profiler.cpp
+  \brief  Benchmarks for the cost of a profiler zone and of draining records into statistics.
+
+  The zone suite times a small loop body alone and wrapped in a zone; the difference is the per-zone overhead. Both
+  drain the thread buffer every few thousand iterations, so no zone is dropped. Without \c TOYGINE_PROFILER the zones
+  compile to nothing and both runs should match.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_drainInterval = toy::profiler::c_threadBufferSize / 2;
+
+// Scratch for drains, sized so one call empties the benchmark thread
+std::vector<toy::profiler::ZoneRecord> & scratch() {
+  static std::vector<toy::profiler::ZoneRecord> records(toy::profiler::c_threadBufferSize);
+
+  return records;
+}
+
+// A few dependent multiplies, too cheap to hide the zone cost
+[[gnu::noinline]] uint64_t work(uint64_t value) noexcept {
+  for (int round = 0; round < 4; ++round)
+    value = value * 0x9E3779B97F4A7C15ULL + 1;
+
+  return value;
+}
+
+void plainLoop(picobench::state & state) {
+  uint64_t result = 0;
+
+  for (auto iteration : state) {
+    result += work(static_cast<uint64_t>(iteration));
+
+    if (static_cast<size_t>(iteration) % c_drainInterval == 0)
+      toy::profiler::drainZones(scratch().data(), scratch().size());
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void zonedLoop(picobench::state & state) {
+  uint64_t result = 0;
+
+  for (auto iteration : state) {
+    {
+      TOY_PROFILE_SCOPE("benchmark/zone");
+      result += work(static_cast<uint64_t>(iteration));
+    }
+
+    if (static_cast<size_t>(iteration) % c_drainInterval == 0)
+      toy::profiler::drainZones(scratch().data(), scratch().size());
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void nestedZonedLoop(picobench::state & state) {
+  uint64_t result = 0;
+
+  for (auto iteration : state) {
+    {
+      TOY_PROFILE_SCOPE("benchmark/outer");
+      TOY_PROFILE_SCOPE("benchmark/inner");
+      result += work(static_cast<uint64_t>(iteration));
+    }
+
+    if (static_cast<size_t>(iteration) % c_drainInterval == 0)
+      toy::profiler::drainZones(scratch().data(), scratch().size());
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// Records two nested zones per iteration and folds them into statistics at every drain
+void drainStatistics(picobench::state & state) {
+  static toy::profiler::ZoneStatistics statistics;
+  size_t                               drained = 0;
+
+  toy::profiler::drainZones(scratch().data(), scratch().size());
+
+  for (auto iteration : state) {
+    {
+      TOY_PROFILE_SCOPE("benchmark/frame");
+      TOY_PROFILE_SCOPE("benchmark/step");
+      static_cast<void>(iteration);
+    }
+
+    if (static_cast<size_t>(iteration) % c_drainInterval == 0) {
+      const size_t count = toy::profiler::drainZones(scratch().data(), scratch().size());
+
+      statistics.add(scratch().data(), count);
+      drained += count;
+    }
+  }
+
+  state.set_result(static_cast<picobench::result_t>(drained));
+}
+
+const std::vector<int> c_iterations{16 * 1024, 256 * 1024};
+
+} // namespace
+
+PICOBENCH_SUITE("core/profiler/zone");
+
+PICOBENCH(plainLoop).iterations(c_iterations).baseline();
+PICOBENCH(zonedLoop).iterations(c_iterations);
+PICOBENCH(nestedZonedLoop).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/profiler/drain");
+
+PICOBENCH(drainStatistics).iterations(c_iterations);
@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   slot_map.cpp
+  \brief  Benchmarks for toy::SlotMap against node-based pools of game objects.
+
+  The iterate suite updates every live particle of a pool that has been churned by erasures and insertions, so the
+  nodes of \c std::list are scattered through the heap. The churn suite erases and respawns particles by handle, as
+  a particle system does every frame.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr size_t c_poolSize = 4096;
+
+struct Particle {
+  float x;
+  float y;
+  float velocityX;
+  float velocityY;
+  float life;
+};
+
+Particle makeParticle(size_t index) noexcept {
+  const auto value = static_cast<float>(index);
+
+  return {value, -value, 0.5F, 1.5F, 1.0F + value * 0.001F};
+}
+
+void step(Particle & particle) noexcept {
+  particle.x += particle.velocityX;
+  particle.y += particle.velocityY;
+  particle.life -= 0.016F;
+}
+
+using Pool = toy::SlotMap<Particle, c_poolSize>;
+
+// Fills the pool and replaces every third particle, leaving the state a running game reaches
+template <typename Insert, typename Erase>
+void churn(Insert && insert, Erase && erase) {
+  for (size_t index = 0; index < c_poolSize; ++index)
+    insert(index);
+
+  for (size_t index = 0; index < c_poolSize; index += 3) {
+    erase(index);
+    insert(index);
+  }
+}
+
+void iterateList(picobench::state & state) {
+  std::list<Particle>                        particles;
+  std::vector<std::list<Particle>::iterator> handles(c_poolSize);
+
+  churn([&](size_t index) { handles[index] = particles.insert(particles.end(), makeParticle(index)); },
+        [&](size_t index) { particles.erase(handles[index]); });
+
+  float result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (Particle & particle : particles)
+      step(particle);
+
+    result += particles.front().x;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void iterateSharedPointers(picobench::state & state) {
+  std::vector<std::shared_ptr<Particle>> particles(c_poolSize);
+
+  churn([&](size_t index) { particles[index] = std::make_shared<Particle>(makeParticle(index)); },
+        [&](size_t index) { particles[index].reset(); });
+
+  float result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (const auto & particle : particles)
+      step(*particle);
+
+    result += particles.front()->x;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void iterateSlotMap(picobench::state & state) {
+  // Static: the inline storage of the pool is too large for the stack
+  static Pool                                   particles;
+  static std::vector<toy::SlotHandle<Particle>> handles(c_poolSize);
+
+  particles.clear();
+  churn([&](size_t index) { handles[index] = particles.insert(makeParticle(index)); },
+        [&](size_t index) { particles.erase(handles[index]); });
+
+  float result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (Particle & particle : particles)
+      step(particle);
+
+    result += particles.begin()->x;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void respawnList(picobench::state & state) {
+  std::list<Particle>                        particles;
+  std::vector<std::list<Particle>::iterator> handles(c_poolSize);
+
+  for (size_t index = 0; index < c_poolSize; ++index)
+    handles[index] = particles.insert(particles.end(), makeParticle(index));
+
+  for (auto iteration : state) {
+    const auto index = static_cast<size_t>(iteration) * 7919 % c_poolSize;
+
+    particles.erase(handles[index]);
+    handles[index] = particles.insert(particles.end(), makeParticle(index));
+  }
+
+  state.set_result(static_cast<picobench::result_t>(particles.size()));
+}
+
+void respawnSlotMap(picobench::state & state) {
+  static Pool                                   particles;
+  static std::vector<toy::SlotHandle<Particle>> handles(c_poolSize);
+
+  particles.clear();
+
+  for (size_t index = 0; index < c_poolSize; ++index)
+    handles[index] = particles.insert(makeParticle(index));
+
+  for (auto iteration : state) {
+    const auto index = static_cast<size_t>(iteration) * 7919 % c_poolSize;
+
+    particles.erase(handles[index]);
+    handles[index] = particles.insert(makeParticle(index));
+  }
+
+  state.set_result(static_cast<picobench::result_t>(particles.size()));
+}
+
+const std::vector<int> c_iterateIterations{64, 256};
+const std::vector<int> c_respawnIterations{8192, 65536};
+
+} // namespace
+
+PICOBENCH_SUITE("core/slot_map/iterate");
+
+PICOBENCH(iterateList).iterations(c_iterateIterations).baseline();
+PICOBENCH(iterateSharedPointers).iterations(c_iterateIterations);
+PICOBENCH(iterateSlotMap).iterations(c_iterateIterations);
+
+PICOBENCH_SUITE("core/slot_map/respawn");
+
+PICOBENCH(respawnList).iterations(c_respawnIterations).baseline();
+PICOBENCH(respawnSlotMap).iterations(c_respawnIterations);
@@ -0,0 +1,530 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   utils.cpp
+  \brief  Benchmarks for the core UTF-8 utilities and number conversions.
+
+  UTF-8 routines run their vectorized paths against the \ref toy::scalar reference. Number conversions run
+  toy::toChars() and toy::fromChars() against \c snprintf, \c strtod, and the \c std::to_chars family, one value per
+  iteration from a fixed set of game-like magnitudes.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <charconv>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Validation and counting walk a 256 KiB corpus per iteration; transcoding walks 4 MiB and converts it back and forth
+constexpr size_t c_corpusSize          = 256 * 1024;
+constexpr size_t c_transcodeCorpusSize = 4 * 1024 * 1024;
+
+// Configuration-file-like text: printable ASCII with line breaks
+std::string makeAsciiText(size_t size) {
+  std::string text;
+  text.reserve(size);
+
+  for (size_t index = 0; text.size() < size; ++index)
+    text += index % 9 == 8 ? '\n' : static_cast<char>('a' + index % 26);
+
+  return text;
+}
+
+// Localized-string-like text: mostly ASCII with Cyrillic, CJK and emoji mixed in
+std::string makeMixedText(size_t size) {
+  static constexpr const char * c_words[] = {
+    "player ", "score: ", "\xD0\x9E\xD1\x87\xD0\xBA\xD0\xB8 ",
+    "level ", "\xE5\x85\xB3\xE5\x8D\xA1 ", "\xF0\x9F\x8E\xAE ",
+  };
+
+  std::string text;
+  text.reserve(size + 16);
+
+  for (size_t index = 0; text.size() < size; ++index)
+    text += c_words[(index * 7) % std::size(c_words)];
+
+  return text;
+}
+
+// Re-encodes a UTF-8 corpus with the reference transcoder so both directions run over the same text
+template <typename Unit, toy::TranscodeResult (*convert)(const char *, size_t, Unit *)>
+std::basic_string<Unit> reencode(const std::string & text) {
+  std::basic_string<Unit> result(text.size(), Unit{});
+  result.resize(convert(text.data(), text.size(), result.data()).written);
+
+  return result;
+}
+
+const std::string & asciiCorpus() {
+  static const std::string corpus = makeAsciiText(c_corpusSize);
+  return corpus;
+}
+
+const std::string & mixedCorpus() {
+  static const std::string corpus = makeMixedText(c_corpusSize);
+  return corpus;
+}
+
+const std::string & largeAsciiCorpus() {
+  static const std::string corpus = makeAsciiText(c_transcodeCorpusSize);
+  return corpus;
+}
+
+const std::string & largeMixedCorpus() {
+  static const std::string corpus = makeMixedText(c_transcodeCorpusSize);
+  return corpus;
+}
+
+const std::u16string & largeAsciiUtf16Corpus() {
+  static const std::u16string corpus = reencode<char16_t, toy::scalar::utf8ToUtf16>(largeAsciiCorpus());
+  return corpus;
+}
+
+const std::u16string & largeMixedUtf16Corpus() {
+  static const std::u16string corpus = reencode<char16_t, toy::scalar::utf8ToUtf16>(largeMixedCorpus());
+  return corpus;
+}
+
+const std::u32string & largeAsciiUtf32Corpus() {
+  static const std::u32string corpus = reencode<char32_t, toy::scalar::utf8ToUtf32>(largeAsciiCorpus());
+  return corpus;
+}
+
+const std::u32string & largeMixedUtf32Corpus() {
+  static const std::u32string corpus = reencode<char32_t, toy::scalar::utf8ToUtf32>(largeMixedCorpus());
+  return corpus;
+}
+
+template <size_t (*validate)(const char *, size_t), const std::string & (*corpus)()>
+void validateCorpus(picobench::state & state) {
+  const std::string & text   = corpus();
+  size_t              result = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    result += validate(text.data(), text.size());
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+template <size_t (*count)(const char *, size_t), const std::string & (*corpus)()>
+void countCorpus(picobench::state & state) {
+  const std::string & text   = corpus();
+  size_t              result = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    result += count(text.data(), text.size());
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// One iteration is the full two-pass conversion: size the output exactly, then transcode into it
+template <typename Source, typename Target, size_t (*measure)(const Source *, size_t),
+          toy::TranscodeResult (*convert)(const Source *, size_t, Target *),
+          const std::basic_string<Source> & (*corpus)()>
+void transcodeCorpus(picobench::state & state) {
+  const std::basic_string<Source> & text = corpus();
+  std::vector<Target>               output(measure(text.data(), text.size()));
+  size_t                            result = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    const size_t length = measure(text.data(), text.size());
+    result += length + convert(text.data(), text.size(), output.data()).written;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+// PICOBENCH takes a single macro argument, so each instantiation gets a name
+constexpr auto scalarValidateAscii = validateCorpus<toy::scalar::utf8ValidLength, asciiCorpus>;
+constexpr auto vectorValidateAscii = validateCorpus<toy::utf8ValidLength, asciiCorpus>;
+constexpr auto scalarValidateMixed = validateCorpus<toy::scalar::utf8ValidLength, mixedCorpus>;
+constexpr auto vectorValidateMixed = validateCorpus<toy::utf8ValidLength, mixedCorpus>;
+
+constexpr auto scalarCountAscii = countCorpus<toy::scalar::utf8CodePointCount, asciiCorpus>;
+constexpr auto vectorCountAscii = countCorpus<toy::utf8CodePointCount, asciiCorpus>;
+constexpr auto scalarCountMixed = countCorpus<toy::scalar::utf8CodePointCount, mixedCorpus>;
+constexpr auto vectorCountMixed = countCorpus<toy::utf8CodePointCount, mixedCorpus>;
+
+constexpr auto scalarToUtf32Ascii = transcodeCorpus<char, char32_t, toy::scalar::utf8CodePointCount,
+                                                   toy::scalar::utf8ToUtf32, largeAsciiCorpus>;
+constexpr auto vectorToUtf32Ascii = transcodeCorpus<char, char32_t, toy::utf8CodePointCount, toy::utf8ToUtf32,
+                                                   largeAsciiCorpus>;
+constexpr auto scalarToUtf32Mixed = transcodeCorpus<char, char32_t, toy::scalar::utf8CodePointCount,
+                                                   toy::scalar::utf8ToUtf32, largeMixedCorpus>;
+constexpr auto vectorToUtf32Mixed = transcodeCorpus<char, char32_t, toy::utf8CodePointCount, toy::utf8ToUtf32,
+                                                   largeMixedCorpus>;
+
+constexpr auto scalarToUtf16Ascii = transcodeCorpus<char, char16_t, toy::scalar::utf16LengthFromUtf8,
+                                                   toy::scalar::utf8ToUtf16, largeAsciiCorpus>;
+constexpr auto vectorToUtf16Ascii = transcodeCorpus<char, char16_t, toy::utf16LengthFromUtf8, toy::utf8ToUtf16,
+                                                   largeAsciiCorpus>;
+constexpr auto scalarToUtf16Mixed = transcodeCorpus<char, char16_t, toy::scalar::utf16LengthFromUtf8,
+                                                   toy::scalar::utf8ToUtf16, largeMixedCorpus>;
+constexpr auto vectorToUtf16Mixed = transcodeCorpus<char, char16_t, toy::utf16LengthFromUtf8, toy::utf8ToUtf16,
+                                                   largeMixedCorpus>;
+
+constexpr auto scalarFromUtf16Ascii = transcodeCorpus<char16_t, char, toy::scalar::utf8LengthFromUtf16,
+                                                     toy::scalar::utf16ToUtf8, largeAsciiUtf16Corpus>;
+constexpr auto vectorFromUtf16Ascii = transcodeCorpus<char16_t, char, toy::utf8LengthFromUtf16, toy::utf16ToUtf8,
+                                                     largeAsciiUtf16Corpus>;
+constexpr auto scalarFromUtf16Mixed = transcodeCorpus<char16_t, char, toy::scalar::utf8LengthFromUtf16,
+                                                     toy::scalar::utf16ToUtf8, largeMixedUtf16Corpus>;
+constexpr auto vectorFromUtf16Mixed = transcodeCorpus<char16_t, char, toy::utf8LengthFromUtf16, toy::utf16ToUtf8,
+                                                     largeMixedUtf16Corpus>;
+
+constexpr auto scalarFromUtf32Ascii = transcodeCorpus<char32_t, char, toy::scalar::utf8LengthFromUtf32,
+                                                     toy::scalar::utf32ToUtf8, largeAsciiUtf32Corpus>;
+constexpr auto vectorFromUtf32Ascii = transcodeCorpus<char32_t, char, toy::utf8LengthFromUtf32, toy::utf32ToUtf8,
+                                                     largeAsciiUtf32Corpus>;
+constexpr auto scalarFromUtf32Mixed = transcodeCorpus<char32_t, char, toy::scalar::utf8LengthFromUtf32,
+                                                     toy::scalar::utf32ToUtf8, largeMixedUtf32Corpus>;
+constexpr auto vectorFromUtf32Mixed = transcodeCorpus<char32_t, char, toy::utf8LengthFromUtf32, toy::utf32ToUtf8,
+                                                     largeMixedUtf32Corpus>;
+
+// Number conversions cycle through 1024 values: coordinates, timings, and scores of mixed magnitudes
+constexpr size_t c_valueCount = 1024;
+
+const std::vector<double> & doubleValues() {
+  static const std::vector<double> values = [] {
+    std::vector<double> result;
+    uint32_t            state = 12345;
+
+    for (size_t index = 0; index < c_valueCount; ++index) {
+      state = state * 1103515245U + 12345U;
+
+      const double magnitude = static_cast<double>(state >> 8) / 65536.0;
+
+      result.push_back(index % 3 == 0 ? -magnitude : index % 3 == 1 ? magnitude / 1000.0 : magnitude * 1e6);
+    }
+
+    return result;
+  }();
+
+  return values;
+}
+
+const std::vector<uint64_t> & integerValues() {
+  static const std::vector<uint64_t> values = [] {
+    std::vector<uint64_t> result;
+    uint64_t              state = 12345;
+
+    for (size_t index = 0; index < c_valueCount; ++index) {
+      state = state * 6364136223846793005U + 1442695040888963407U;
+      result.push_back(state >> (index % 64));
+    }
+
+    return result;
+  }();
+
+  return values;
+}
+
+// Shortest round-trip text of each value, the input of the parsing runs
+template <typename T, const std::vector<T> & (*values)()>
+const std::vector<std::string> & texts() {
+  static const std::vector<std::string> result = [] {
+    std::vector<std::string> strings;
+
+    for (const T value : values()) {
+      char       buffer[64];
+      const auto converted = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+      strings.emplace_back(buffer, converted.ptr);
+    }
+
+    return strings;
+  }();
+
+  return result;
+}
+
+void snprintfDoubles(picobench::state & state) {
+  const std::vector<double> & values = doubleValues();
+  char                        buffer[64];
+  size_t                      result = 0;
+
+  for (auto iteration : state)
+    result += static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%.17g", values[iteration % c_valueCount]));
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdToCharsDoubles(picobench::state & state) {
+  const std::vector<double> & values = doubleValues();
+  char                        buffer[64];
+  size_t                      result = 0;
+
+  for (auto iteration : state) {
+    const auto converted = std::to_chars(buffer, buffer + sizeof(buffer), values[iteration % c_valueCount]);
+    result += static_cast<size_t>(converted.ptr - buffer);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyToCharsDoubles(picobench::state & state) {
+  const std::vector<double> & values = doubleValues();
+  char                        buffer[toy::c_maxShortestFloatChars];
+  size_t                      result = 0;
+
+  for (auto iteration : state)
+    result += static_cast<size_t>(toy::toChars(buffer, values[iteration % c_valueCount]) - buffer);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void snprintfFixed(picobench::state & state) {
+  const std::vector<double> & values = doubleValues();
+  char                        buffer[64];
+  size_t                      result = 0;
+
+  for (auto iteration : state)
+    result += static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%.3f", values[iteration % c_valueCount]));
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdToCharsFixed(picobench::state & state) {
+  const std::vector<double> & values = doubleValues();
+  char                        buffer[64];
+  size_t                      result = 0;
+
+  for (auto iteration : state) {
+    const auto converted = std::to_chars(buffer, buffer + sizeof(buffer), values[iteration % c_valueCount],
+                                         std::chars_format::fixed, 3);
+    result += static_cast<size_t>(converted.ptr - buffer);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyToCharsFixed(picobench::state & state) {
+  const std::vector<double> & values = doubleValues();
+  char                        buffer[64];
+  size_t                      result = 0;
+
+  for (auto iteration : state) {
+    const char * end = toy::toChars(buffer, values[iteration % c_valueCount], toy::FloatFormat::Fixed, 3);
+    result += static_cast<size_t>(end - buffer);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void strtodDoubles(picobench::state & state) {
+  const std::vector<std::string> & strings = texts<double, doubleValues>();
+  double                           result  = 0.0;
+
+  for (auto iteration : state)
+    result += std::strtod(strings[iteration % c_valueCount].c_str(), nullptr);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdFromCharsDoubles(picobench::state & state) {
+  const std::vector<std::string> & strings = texts<double, doubleValues>();
+  double                           result  = 0.0;
+
+  for (auto iteration : state) {
+    const std::string & text  = strings[iteration % c_valueCount];
+    double              value = 0.0;
+
+    std::from_chars(text.data(), text.data() + text.size(), value);
+    result += value;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyFromCharsDoubles(picobench::state & state) {
+  const std::vector<std::string> & strings = texts<double, doubleValues>();
+  double                           result  = 0.0;
+
+  for (auto iteration : state) {
+    const std::string & text  = strings[iteration % c_valueCount];
+    double              value = 0.0;
+
+    toy::fromChars(text.data(), text.data() + text.size(), value);
+    result += value;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void snprintfIntegers(picobench::state & state) {
+  const std::vector<uint64_t> & values = integerValues();
+  char                          buffer[32];
+  size_t                        result = 0;
+
+  for (auto iteration : state) {
+    const auto value = static_cast<unsigned long long>(values[iteration % c_valueCount]);
+    result += static_cast<size_t>(std::snprintf(buffer, sizeof(buffer), "%llu", value));
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdToCharsIntegers(picobench::state & state) {
+  const std::vector<uint64_t> & values = integerValues();
+  char                          buffer[32];
+  size_t                        result = 0;
+
+  for (auto iteration : state) {
+    const auto converted = std::to_chars(buffer, buffer + sizeof(buffer), values[iteration % c_valueCount]);
+    result += static_cast<size_t>(converted.ptr - buffer);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyToCharsIntegers(picobench::state & state) {
+  const std::vector<uint64_t> & values = integerValues();
+  char                          buffer[toy::c_maxIntegerChars];
+  size_t                        result = 0;
+
+  for (auto iteration : state)
+    result += static_cast<size_t>(toy::toChars(buffer, values[iteration % c_valueCount]) - buffer);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void strtoullIntegers(picobench::state & state) {
+  const std::vector<std::string> & strings = texts<uint64_t, integerValues>();
+  uint64_t                         result  = 0;
+
+  for (auto iteration : state)
+    result += std::strtoull(strings[iteration % c_valueCount].c_str(), nullptr, 10);
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void stdFromCharsIntegers(picobench::state & state) {
+  const std::vector<std::string> & strings = texts<uint64_t, integerValues>();
+  uint64_t                         result  = 0;
+
+  for (auto iteration : state) {
+    const std::string & text  = strings[iteration % c_valueCount];
+    uint64_t            value = 0;
+
+    std::from_chars(text.data(), text.data() + text.size(), value);
+    result += value;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+void toyFromCharsIntegers(picobench::state & state) {
+  const std::vector<std::string> & strings = texts<uint64_t, integerValues>();
+  uint64_t                         result  = 0;
+
+  for (auto iteration : state) {
+    const std::string & text  = strings[iteration % c_valueCount];
+    uint64_t            value = 0;
+
+    toy::fromChars(text.data(), text.data() + text.size(), value);
+    result += value;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(result));
+}
+
+const std::vector<int> c_iterations{16, 128};
+const std::vector<int> c_transcodeIterations{4, 16};
+const std::vector<int> c_conversionIterations{1024, 8192};
+
+} // namespace
+
+PICOBENCH_SUITE("core/utils/utf8ValidLength");
+
+PICOBENCH(scalarValidateAscii).iterations(c_iterations).baseline();
+PICOBENCH(vectorValidateAscii).iterations(c_iterations);
+PICOBENCH(scalarValidateMixed).iterations(c_iterations);
+PICOBENCH(vectorValidateMixed).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/utils/utf8CodePointCount");
+
+PICOBENCH(scalarCountAscii).iterations(c_iterations).baseline();
+PICOBENCH(vectorCountAscii).iterations(c_iterations);
+PICOBENCH(scalarCountMixed).iterations(c_iterations);
+PICOBENCH(vectorCountMixed).iterations(c_iterations);
+
+PICOBENCH_SUITE("core/utils/utf8ToUtf32");
+
+PICOBENCH(scalarToUtf32Ascii).iterations(c_transcodeIterations).baseline();
+PICOBENCH(vectorToUtf32Ascii).iterations(c_transcodeIterations);
+PICOBENCH(scalarToUtf32Mixed).iterations(c_transcodeIterations);
+PICOBENCH(vectorToUtf32Mixed).iterations(c_transcodeIterations);
+
+PICOBENCH_SUITE("core/utils/utf8ToUtf16");
+
+PICOBENCH(scalarToUtf16Ascii).iterations(c_transcodeIterations).baseline();
+PICOBENCH(vectorToUtf16Ascii).iterations(c_transcodeIterations);
+PICOBENCH(scalarToUtf16Mixed).iterations(c_transcodeIterations);
+PICOBENCH(vectorToUtf16Mixed).iterations(c_transcodeIterations);
+
+PICOBENCH_SUITE("core/utils/utf16ToUtf8");
+
+PICOBENCH(scalarFromUtf16Ascii).iterations(c_transcodeIterations).baseline();
+PICOBENCH(vectorFromUtf16Ascii).iterations(c_transcodeIterations);
+PICOBENCH(scalarFromUtf16Mixed).iterations(c_transcodeIterations);
+PICOBENCH(vectorFromUtf16Mixed).iterations(c_transcodeIterations);
+
+PICOBENCH_SUITE("core/utils/utf32ToUtf8");
+
+PICOBENCH(scalarFromUtf32Ascii).iterations(c_transcodeIterations).baseline();
+PICOBENCH(vectorFromUtf32Ascii).iterations(c_transcodeIterations);
+PICOBENCH(scalarFromUtf32Mixed).iterations(c_transcodeIterations);
+PICOBENCH(vectorFromUtf32Mixed).iterations(c_transcodeIterations);
+
+PICOBENCH_SUITE("core/utils/toChars double");
+
+PICOBENCH(snprintfDoubles).iterations(c_conversionIterations).baseline();
+PICOBENCH(stdToCharsDoubles).iterations(c_conversionIterations);
+PICOBENCH(toyToCharsDoubles).iterations(c_conversionIterations);
+
+PICOBENCH_SUITE("core/utils/toChars fixed");
+
+PICOBENCH(snprintfFixed).iterations(c_conversionIterations).baseline();
+PICOBENCH(stdToCharsFixed).iterations(c_conversionIterations);
+PICOBENCH(toyToCharsFixed).iterations(c_conversionIterations);
+
+PICOBENCH_SUITE("core/utils/fromChars double");
+
+PICOBENCH(strtodDoubles).iterations(c_conversionIterations).baseline();
+PICOBENCH(stdFromCharsDoubles).iterations(c_conversionIterations);
+PICOBENCH(toyFromCharsDoubles).iterations(c_conversionIterations);
+
+PICOBENCH_SUITE("core/utils/toChars integer");
+
+PICOBENCH(snprintfIntegers).iterations(c_conversionIterations).baseline();
+PICOBENCH(stdToCharsIntegers).iterations(c_conversionIterations);
+PICOBENCH(toyToCharsIntegers).iterations(c_conversionIterations);
+
+PICOBENCH_SUITE("core/utils/fromChars integer");
+
+PICOBENCH(strtoullIntegers).iterations(c_conversionIterations).baseline();
+PICOBENCH(stdFromCharsIntegers).iterations(c_conversionIterations);
+PICOBENCH(toyFromCharsIntegers).iterations(c_conversionIterations);
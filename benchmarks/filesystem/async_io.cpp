@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   async_io.cpp
+  \brief  Benchmarks for asynchronous reads: batches of 64 KB chunks, blocking against workers and io_uring.
+
+  Each iteration reads a batch of 64 chunks scattered over a 4 MB file that sits in the page cache, so the runs compare
+  the cost of issuing and completing reads rather than the disk.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+namespace async = toy::filesystem::async;
+
+constexpr size_t c_fileSize   = 4 << 20;
+constexpr size_t c_chunkSize  = 64 << 10;
+constexpr size_t c_batchSize  = 64;
+constexpr size_t c_chunkCount = c_fileSize / c_chunkSize;
+
+// Offset of read \a index of batch \a batch, scattered over the file
+uint64_t chunkOffset(size_t batch, size_t index) noexcept {
+  return ((batch * 17 + index * 29) % c_chunkCount) * c_chunkSize;
+}
+
+// File shared by every run
+struct Data {
+  Data()
+    : path(std::filesystem::temp_directory_path() / "toygine_bench_async.bin") {
+    std::ofstream(path, std::ios::binary) << std::string(c_fileSize, 'x');
+  }
+
+  ~Data() {
+    std::filesystem::remove(path);
+  }
+
+  std::filesystem::path path;
+};
+
+const std::string & dataPath() {
+  static const Data        s_data;
+  static const std::string s_path = s_data.path.string();
+
+  return s_path;
+}
+
+void blockingReads(picobench::state & state) {
+  std::vector<std::byte> buffer(c_batchSize * c_chunkSize);
+  std::FILE *            file = std::fopen(dataPath().c_str(), "rb");
+  size_t                 sum  = 0;
+
+  for (auto iteration : state) {
+    for (size_t index = 0; index < c_batchSize; ++index) {
+      std::fseek(file, static_cast<long>(chunkOffset(static_cast<size_t>(iteration), index)), SEEK_SET);
+      sum += std::fread(buffer.data() + index * c_chunkSize, 1, c_chunkSize, file);
+    }
+  }
+
+  std::fclose(file);
+  state.set_result(static_cast<picobench::result_t>(sum));
+}
+
+void asyncReads(picobench::state & state, async::Backend preferred) {
+  async::initialize(preferred);
+
+  const async::File           file(dataPath().c_str());
+  std::vector<std::byte>      buffer(c_batchSize * c_chunkSize);
+  std::vector<async::Request> requests(c_batchSize);
+  size_t                      sum = 0;
+
+  async::registerBuffer(buffer);
+
+  for (auto iteration : state) {
+    for (size_t index = 0; index < c_batchSize; ++index) {
+      requests[index] = {&file, chunkOffset(static_cast<size_t>(iteration), index),
+                         std::span(buffer).subspan(index * c_chunkSize, c_chunkSize)};
+    }
+
+    async::submit(requests);
+    async::waitAll();
+
+    for (const async::Request & request : requests)
+      sum += request.bytesRead;
+  }
+
+  async::deInitialize();
+  state.set_result(static_cast<picobench::result_t>(sum));
+}
+
+void workerReads(picobench::state & state) {
+  asyncReads(state, async::Backend::Workers);
+}
+
+void ioUringReads(picobench::state & state) {
+  asyncReads(state, async::Backend::IoUring);
+}
+
+const std::vector<int> c_iterations{8, 32};
+
+} // namespace
+
+PICOBENCH_SUITE("filesystem/async_io/batch");
+
+PICOBENCH(blockingReads).iterations(c_iterations).baseline();
+PICOBENCH(workerReads).iterations(c_iterations);
+PICOBENCH(ioUringReads).iterations(c_iterations);
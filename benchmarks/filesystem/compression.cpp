@@ -0,0 +1,154 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   compression.cpp
+  \brief  Benchmarks for LZ streams: decoding speed per target class against a plain copy of the raw bytes.
+
+  Every iteration decodes, or copies, 1 MB of text-like asset data, so 10^6 divided by the nanoseconds per iteration
+  is the speed in MB/s. The wide decoder is what desktop builds run; the byte decoder and the 4 KB ring are what the
+  handhelds run, here measured on the desktop CPU. Decoding pays off while it outruns the storage the compressed
+  bytes are read from.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cstring>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+namespace lz = toy::filesystem::lz;
+
+constexpr size_t c_dataSize = 1 << 20;
+
+// Raw data and its streams, shared by every run
+struct Samples {
+  Samples() {
+    constexpr toy::string_view c_words[] = {"tile ", "sprite ", "palette ", "level ", "enemy ", "jump\n"};
+
+    uint32_t seed = 1;
+
+    while (raw.size() < c_dataSize) {
+      seed = seed * 1664525U + 1013904223U;
+
+      for (const char character : c_words[(seed >> 16) % std::size(c_words)])
+        raw.push_back(static_cast<std::byte>(character));
+    }
+
+    raw.resize(c_dataSize);
+    stream            = compress(lz::c_defaultWindowBits);
+    smallWindowStream = compress(12);
+  }
+
+  std::vector<std::byte> compress(uint8_t windowBits) const {
+    std::vector<std::byte> result(lz::compressBound(raw.size(), windowBits));
+
+    result.resize(lz::compress(raw, result, windowBits));
+
+    return result;
+  }
+
+  std::vector<std::byte> raw;
+  std::vector<std::byte> stream;
+  std::vector<std::byte> smallWindowStream;
+};
+
+const Samples & samples() {
+  static const Samples s_samples;
+
+  return s_samples;
+}
+
+void copyRaw(picobench::state & state) {
+  const Samples &        data = samples();
+  std::vector<std::byte> output(c_dataSize);
+
+  for ([[maybe_unused]] auto iteration : state)
+    std::memcpy(output.data(), data.raw.data(), data.raw.size());
+
+  state.set_result(static_cast<picobench::result_t>(output[c_dataSize / 2]));
+}
+
+void decodeWide(picobench::state & state) {
+  const Samples &        data = samples();
+  std::vector<std::byte> output(c_dataSize);
+  size_t                 decoded = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    decoded += lz::decompress(data.stream, output) ? 1 : 0;
+
+  state.set_result(static_cast<picobench::result_t>(decoded));
+}
+
+void decodeBytes(picobench::state & state) {
+  const Samples &        data = samples();
+  std::vector<std::byte> output(c_dataSize);
+  size_t                 decoded = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    decoded += lz::scalar::decompress(data.stream, output) ? 1 : 0;
+
+  state.set_result(static_cast<picobench::result_t>(decoded));
+}
+
+void decodeRing(picobench::state & state) {
+  const Samples &        data = samples();
+  std::vector<std::byte> ring(lz::ringSize(4096));
+  size_t                 decoded = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    lz::Decompressor decoder(data.smallWindowStream, ring);
+
+    while (!decoder.next().empty()) {
+    }
+
+    decoded += static_cast<size_t>(decoder.position());
+  }
+
+  state.set_result(static_cast<picobench::result_t>(decoded));
+}
+
+void compressDefault(picobench::state & state) {
+  const Samples &        data = samples();
+  std::vector<std::byte> output(lz::compressBound(c_dataSize));
+  size_t                 size = 0;
+
+  for ([[maybe_unused]] auto iteration : state)
+    size += lz::compress(data.raw, output);
+
+  state.set_result(static_cast<picobench::result_t>(size));
+}
+
+const std::vector<int> c_iterations{4, 16};
+
+} // namespace
+
+PICOBENCH_SUITE("filesystem/compression/decode");
+
+PICOBENCH(copyRaw).iterations(c_iterations).baseline();
+PICOBENCH(decodeWide).iterations(c_iterations);
+PICOBENCH(decodeBytes).iterations(c_iterations);
+PICOBENCH(decodeRing).iterations(c_iterations);
+
+PICOBENCH_SUITE("filesystem/compression/encode");
+
+PICOBENCH(compressDefault).iterations(c_iterations).baseline();
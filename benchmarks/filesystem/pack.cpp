@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   pack.cpp
+  \brief  Benchmarks for opening small assets: pack lookups against loose files read with the C library.
+
+  Both variants open the same 256 files of 1 KB and sum a byte of each. The loose files sit in the page cache after
+  the first pass, so the difference is the system calls and copies a pack avoids.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+constexpr size_t c_fileCount = 256;
+constexpr size_t c_fileSize  = 1024;
+
+// Files on disk and in a pack, shared by every run
+struct Assets {
+  Assets() {
+    root = std::filesystem::temp_directory_path() / "toygine_bench_assets";
+    std::filesystem::create_directories(root);
+
+    const std::string contents(c_fileSize, 'x');
+
+    for (size_t index = 0; index < c_fileCount; ++index) {
+      paths.push_back("file_" + std::to_string(index) + ".bin");
+      std::ofstream(root / paths.back(), std::ios::binary) << contents;
+    }
+
+    std::vector<toy::filesystem::PackSource> sources;
+
+    for (const std::string & path : paths)
+      sources.push_back({path, std::as_bytes(std::span(contents.data(), contents.size()))});
+
+    image.resize(toy::filesystem::packImageSize(sources));
+    toy::filesystem::writePack(sources, image);
+    pack = toy::filesystem::Pack(image.data(), image.size());
+
+    for (const std::string & path : paths)
+      ids.push_back(toy::StringId(toy::hash64(path)));
+  }
+
+  ~Assets() {
+    std::filesystem::remove_all(root);
+  }
+
+  std::filesystem::path      root;
+  std::vector<std::string>   paths;
+  std::vector<toy::StringId> ids;
+  std::vector<std::byte>     image;
+  toy::filesystem::Pack      pack;
+};
+
+Assets & assets() {
+  static Assets s_assets;
+
+  return s_assets;
+}
+
+void looseFiles(picobench::state & state) {
+  const Assets &    files = assets();
+  std::vector<char> buffer(c_fileSize);
+  size_t            sum = 0;
+
+  for (auto iteration : state) {
+    const std::string path = (files.root / files.paths[static_cast<size_t>(iteration) % c_fileCount]).string();
+
+    if (std::FILE * file = std::fopen(path.c_str(), "rb"); file != nullptr) {
+      sum += std::fread(buffer.data(), 1, buffer.size(), file) + static_cast<size_t>(buffer[0]);
+      std::fclose(file);
+    }
+  }
+
+  state.set_result(static_cast<picobench::result_t>(sum));
+}
+
+void packFiles(picobench::state & state) {
+  const Assets & files = assets();
+  size_t         sum   = 0;
+
+  for (auto iteration : state) {
+    const auto file = files.pack.find(files.ids[static_cast<size_t>(iteration) % c_fileCount]);
+
+    sum += file.data.size() + static_cast<size_t>(file.data[0]);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(sum));
+}
+
+const std::vector<int> c_iterations{256, 4096};
+
+} // namespace
+
+PICOBENCH_SUITE("filesystem/pack/open");
+
+PICOBENCH(looseFiles).iterations(c_iterations).baseline();
+PICOBENCH(packFiles).iterations(c_iterations);
@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed.cpp
+  \brief  Benchmarks for toy::math::Fixed against float: particle integration and sine and cosine.
+
+  On desktop both run on hardware, so these runs show how close the integer code comes to the FPU. Built for the
+  consoles, the float variants call the software floating-point library instead, which is where fixed point pays off.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <vector>
+
+#include "math.hpp"
+
+namespace {
+
+constexpr size_t c_particleCount = 1024;
+
+template <typename T>
+struct Particle {
+  toy::math::Vector2<T> position;
+  toy::math::Vector2<T> velocity;
+};
+
+template <typename T>
+void integrate(picobench::state & state) {
+  std::vector<Particle<T>> particles(c_particleCount);
+
+  for (size_t index = 0; index < particles.size(); ++index)
+    particles[index] = {{T(static_cast<int>(index % 64)), T(0)}, {T(1), T(static_cast<int>(index % 7))}};
+
+  const T step    = T(1.0 / 64);
+  const T drag    = T(0.99);
+  const T gravity = T(-9.75);
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (Particle<T> & particle : particles) {
+      particle.velocity.y += gravity * step;
+      particle.velocity *= drag;
+      particle.position += particle.velocity * step;
+    }
+  }
+
+  state.set_result(static_cast<picobench::result_t>(static_cast<float>(particles.front().position.y)));
+}
+
+template <typename T>
+void rotate(picobench::state & state) {
+  const T turn  = T(0.01);
+  T       angle = T(0);
+  T       sum   = T(0);
+
+  for ([[maybe_unused]] auto iteration : state) {
+    const auto result = toy::math::sinCos(angle);
+
+    sum += result.sine + result.cosine;
+    angle += turn;
+  }
+
+  state.set_result(static_cast<picobench::result_t>(static_cast<float>(sum)));
+}
+
+constexpr auto integrateFloat = integrate<float>;
+constexpr auto integrateFixed = integrate<toy::math::Fixed<16, 16>>;
+constexpr auto rotateFloat    = rotate<float>;
+constexpr auto rotateFixed    = rotate<toy::math::Fixed<16, 16>>;
+
+const std::vector<int> c_integrateIterations{64, 256};
+const std::vector<int> c_rotateIterations{8192, 65536};
+
+} // namespace
+
+PICOBENCH_SUITE("math/fixed/integrate");
+
+PICOBENCH(integrateFloat).iterations(c_integrateIterations).baseline();
+PICOBENCH(integrateFixed).iterations(c_integrateIterations);
+
+PICOBENCH_SUITE("math/fixed/sin_cos");
+
+PICOBENCH(rotateFloat).iterations(c_rotateIterations).baseline();
+PICOBENCH(rotateFixed).iterations(c_rotateIterations);
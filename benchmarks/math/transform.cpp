@@ -0,0 +1,142 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   transform.cpp
+  \brief  Benchmarks for the batch point transforms against transforming an array of vectors one at a time.
+
+  Each suite compares three layouts of the same work: an array of vectors through Matrix3::transformPoint() or
+  Matrix4::transformPoint(), the same coordinates as structure of arrays through the scalar reference, and the vector
+  kernel. The gap between the last two is the vector registers. The first loop is inlined here, so the compiler may
+  vectorize it on its own; the scalar reference is compiled apart from its callers and stays one point per step.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <vector>
+
+#include "math.hpp"
+
+namespace {
+
+constexpr size_t c_pointCount = 4096;
+
+const toy::math::Matrix3<float> c_transform2d = toy::math::Matrix3<float>::translation({3.0f, -2.0f})
+                                              * toy::math::Matrix3<float>::rotation(0.001f);
+
+const toy::math::Matrix4<float> c_transform3d
+  = toy::math::Matrix4<float>::translation(toy::math::Vector3<float>(0.5f, -0.25f, 1.0f))
+  * toy::math::Matrix4<float>::rotation(toy::math::Quaternion<float>::fromAxisAngle({0.0f, 0.6f, 0.8f}, 0.001f));
+
+float coordinate(size_t index, size_t axis) {
+  return static_cast<float>((index * 7 + axis * 13) % 101) - 50.0f;
+}
+
+void points2dArray(picobench::state & state) {
+  std::vector<toy::math::Vector2<float>> points(c_pointCount);
+
+  for (size_t index = 0; index < points.size(); ++index)
+    points[index] = {coordinate(index, 0), coordinate(index, 1)};
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (auto & point : points)
+      point = c_transform2d.transformPoint(point);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(points.back().x));
+}
+
+template <bool Vectorized>
+void points2dBatch(picobench::state & state) {
+  std::vector<float> x(c_pointCount);
+  std::vector<float> y(c_pointCount);
+
+  for (size_t index = 0; index < c_pointCount; ++index) {
+    x[index] = coordinate(index, 0);
+    y[index] = coordinate(index, 1);
+  }
+
+  for ([[maybe_unused]] auto iteration : state) {
+    if constexpr (Vectorized)
+      toy::math::transformPoints(c_transform2d, x.data(), y.data(), x.data(), y.data(), c_pointCount);
+    else
+      toy::math::scalar::transformPoints(c_transform2d, x.data(), y.data(), x.data(), y.data(), c_pointCount);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(x.back()));
+}
+
+void points3dArray(picobench::state & state) {
+  std::vector<toy::math::Vector3<float>> points(c_pointCount);
+
+  for (size_t index = 0; index < points.size(); ++index)
+    points[index] = {coordinate(index, 0), coordinate(index, 1), coordinate(index, 2)};
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (auto & point : points)
+      point = c_transform3d.transformPoint(point);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(points.back().x));
+}
+
+template <bool Vectorized>
+void points3dBatch(picobench::state & state) {
+  std::vector<float> x(c_pointCount);
+  std::vector<float> y(c_pointCount);
+  std::vector<float> z(c_pointCount);
+
+  for (size_t index = 0; index < c_pointCount; ++index) {
+    x[index] = coordinate(index, 0);
+    y[index] = coordinate(index, 1);
+    z[index] = coordinate(index, 2);
+  }
+
+  for ([[maybe_unused]] auto iteration : state) {
+    if constexpr (Vectorized)
+      toy::math::transformPoints(c_transform3d, x.data(), y.data(), z.data(), x.data(), y.data(), z.data(),
+                                 c_pointCount);
+    else
+      toy::math::scalar::transformPoints(c_transform3d, x.data(), y.data(), z.data(), x.data(), y.data(), z.data(),
+                                         c_pointCount);
+  }
+
+  state.set_result(static_cast<picobench::result_t>(x.back()));
+}
+
+constexpr auto points2dScalar     = points2dBatch<false>;
+constexpr auto points2dVectorized = points2dBatch<true>;
+constexpr auto points3dScalar     = points3dBatch<false>;
+constexpr auto points3dVectorized = points3dBatch<true>;
+
+const std::vector<int> c_iterations{16, 64};
+
+} // namespace
+
+PICOBENCH_SUITE("math/transform/points_2d");
+
+PICOBENCH(points2dArray).iterations(c_iterations).baseline();
+PICOBENCH(points2dScalar).iterations(c_iterations);
+PICOBENCH(points2dVectorized).iterations(c_iterations);
+
+PICOBENCH_SUITE("math/transform/points_3d");
+
+PICOBENCH(points3dArray).iterations(c_iterations).baseline();
+PICOBENCH(points3dScalar).iterations(c_iterations);
+PICOBENCH(points3dVectorized).iterations(c_iterations);
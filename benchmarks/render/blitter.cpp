@@ -0,0 +1,195 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   blitter.cpp
+  \brief  Benchmarks for the software renderer: the row kernels against their scalar references, and a whole frame.
+
+  The kernel suites run one 320 by 240 frame's worth of rows per iteration, through the toy::render::scalar reference
+  and the dispatched kernel. The frame suite draws a scene of two scrolled tile layers and 128 sprites, and presents it
+  at 4 times to a 1280 by 960 window: its time per iteration is the share of a 16.7 ms frame at 60 Hz the renderer
+  takes.
+*/
+
+#include <picobench/picobench.hpp>
+
+#include <vector>
+
+#include "render.hpp"
+
+using toy::render::PixelFormat;
+
+namespace {
+
+constexpr uint32_t c_width       = 320;
+constexpr uint32_t c_height      = 240;
+constexpr uint32_t c_scale       = 4;
+constexpr size_t   c_spriteCount = 128;
+
+toy::render::Palette benchPalette() {
+  toy::render::Palette palette;
+
+  for (size_t index = 0; index < palette.colors.size(); ++index)
+    palette.colors[index] = static_cast<uint16_t>(index * 0x0123);
+
+  return palette;
+}
+
+// Indices in runs, with a transparent run now and then, as sprites and tiles tend to be
+std::vector<uint8_t> indices(size_t count) {
+  std::vector<uint8_t> values(count);
+
+  for (size_t index = 0; index < count; ++index)
+    values[index] = (index / 12) % 4 == 0 ? 0 : static_cast<uint8_t>(index / 3 + 1);
+
+  return values;
+}
+
+template <bool Vectorized>
+void composeRows(picobench::state & state) {
+  const toy::render::Palette palette = benchPalette();
+  const std::vector<uint8_t> line    = indices(c_width);
+  std::vector<uint16_t>      frame(size_t{c_width} * c_height);
+
+  for ([[maybe_unused]] auto iteration : state) {
+    for (uint32_t y = 0; y < c_height; ++y) {
+      uint16_t * row = frame.data() + size_t{y} * c_width;
+
+      if constexpr (Vectorized)
+        toy::render::composeRgb565(line.data(), c_width, palette.colors.data(), row);
+      else
+        toy::render::scalar::composeRgb565(line.data(), c_width, palette.colors.data(), row);
+    }
+  }
+
+  state.set_result(frame.back());
+}
+
+template <bool Vectorized>
+void presentRows(picobench::state & state) {
+  std::vector<uint16_t> frame(size_t{c_width} * c_height);
+  std::vector<uint32_t> line(c_width);
+  std::vector<uint32_t> output(size_t{c_width} * c_scale * c_height);
+
+  for (size_t index = 0; index < frame.size(); ++index)
+    frame[index] = static_cast<uint16_t>(index * 37);
+
+  // One scaled row per frame row; present() copies it down the other rows of the block
+  for ([[maybe_unused]] auto iteration : state) {
+    for (uint32_t y = 0; y < c_height; ++y) {
+      uint32_t * row = output.data() + size_t{y} * c_width * c_scale;
+
+      if constexpr (Vectorized) {
+        toy::render::expandRgb565(frame.data() + size_t{y} * c_width, c_width, line.data());
+        toy::render::scaleRow(line.data(), c_width, c_scale, row);
+      } else {
+        toy::render::scalar::expandRgb565(frame.data() + size_t{y} * c_width, c_width, line.data());
+        toy::render::scalar::scaleRow(line.data(), c_width, c_scale, row);
+      }
+    }
+  }
+
+  state.set_result(output.back());
+}
+
+template <PixelFormat Format>
+void drawFrame(picobench::state & state) {
+  const toy::render::Palette palette = benchPalette();
+  std::vector<uint8_t>       pixels(toy::render::rowSize(Format, c_width) * c_height);
+  std::vector<uint32_t>      output(size_t{c_width} * c_scale * c_height * c_scale);
+  toy::render::Framebuffer   frame(pixels.data(), c_width, c_height, Format);
+
+  // 64 tiles of 4-bit pixels, a 64 by 32 map, and a wave of line offsets for the front layer
+  const std::vector<uint8_t> tiles = indices(64 * 32);
+  std::vector<uint16_t>      map(64 * 32);
+  std::vector<int16_t>       wave(c_height);
+
+  for (size_t index = 0; index < map.size(); ++index)
+    map[index] = toy::render::tileEntry(static_cast<uint16_t>(index % 64), index % 3 == 0, index % 5 == 0,
+                                        static_cast<uint8_t>(index % 16));
+
+  for (size_t y = 0; y < wave.size(); ++y)
+    wave[y] = static_cast<int16_t>(y % 16 < 8 ? y % 8 : 8 - y % 8);
+
+  toy::render::TileLayer back;
+
+  back.tiles   = toy::span<const std::byte>(reinterpret_cast<const std::byte *>(tiles.data()), tiles.size());
+  back.format  = PixelFormat::Indexed4;
+  back.map     = map;
+  back.columns = 64;
+  back.rows    = 32;
+
+  toy::render::TileLayer front = back;
+
+  front.lineScroll = wave;
+
+  // 32 by 32 sprites of 8-bit pixels
+  const std::vector<uint8_t> image = indices(32 * 32);
+  toy::render::Sprite        sprite{toy::render::Bitmap(image.data(), 32, 32, PixelFormat::Indexed8)};
+  int32_t                    scroll = 0;
+
+  for ([[maybe_unused]] auto iteration : state) {
+    back.scrollX  = scroll;
+    front.scrollX = scroll * 2;
+    front.scrollY = scroll / 2;
+
+    toy::render::drawTileLayer(frame, back, palette);
+    toy::render::drawTileLayer(frame, front, palette);
+
+    for (size_t index = 0; index < c_spriteCount; ++index) {
+      sprite.x     = static_cast<int32_t>((index * 53 + static_cast<size_t>(scroll)) % (c_width + 32)) - 32;
+      sprite.y     = static_cast<int32_t>((index * 29) % (c_height + 32)) - 32;
+      sprite.flipX = index % 2 == 0;
+
+      toy::render::drawSprite(frame, sprite, palette);
+    }
+
+    toy::render::present(frame, palette, output, size_t{c_width} * c_scale, c_scale);
+    ++scroll;
+  }
+
+  state.set_result(output.back());
+}
+
+constexpr auto composeScalar     = composeRows<false>;
+constexpr auto composeVectorized = composeRows<true>;
+constexpr auto presentScalar     = presentRows<false>;
+constexpr auto presentVectorized = presentRows<true>;
+constexpr auto frameIndexed8     = drawFrame<PixelFormat::Indexed8>;
+constexpr auto frameRgb565       = drawFrame<PixelFormat::Rgb565>;
+
+const std::vector<int> c_rowIterations{8, 32};
+const std::vector<int> c_frameIterations{4, 16};
+
+} // namespace
+
+PICOBENCH_SUITE("render/blitter/compose");
+
+PICOBENCH(composeScalar).iterations(c_rowIterations).baseline();
+PICOBENCH(composeVectorized).iterations(c_rowIterations);
+
+PICOBENCH_SUITE("render/blitter/present");
+
+PICOBENCH(presentScalar).iterations(c_rowIterations).baseline();
+PICOBENCH(presentVectorized).iterations(c_rowIterations);
+
+PICOBENCH_SUITE("render/blitter/frame");
+
+PICOBENCH(frameIndexed8).iterations(c_frameIterations).baseline();
+PICOBENCH(frameRgb565).iterations(c_frameIterations);
@@ -24,7 +24,11 @@
   Single public entry point for the core module. It aggregates the module's public headers into namespace \ref toy;
   additional core headers (assertions, chrono, fixed strings and vectors, formatting, hashing, logging, platform, and
   string utilities) are re-exported here as they are added. It currently re-exports toy::size_t, the fixed-width
-  integer aliases (toy::int8_t through toy::uint64_t) from `<cstdint>`, and `std::array`.
+  integer aliases (toy::int8_t through toy::uint64_t, and toy::uintptr_t) from `<cstdint>`, `std::array`, `std::span`,
+  `std::string_view`, the allocators, the assertion handlers and stack traces, the engine clock and frame timing, fixed
+  strings and vectors, hashing and string IDs, the flat hash map, formatting, the job system, deferred logging, memory
+  tracking, the CPU queries and kernel dispatch, the profiler, the slot map, the string and UTF-8 utilities, and the
+  number conversions.
 
   \note Include this header only; do not include internal headers directly.
 */
@@ -33,8 +37,28 @@
 #define INCLUDE_CORE_HPP_
 
 #include <array>
+#include <atomic>
+#include <bit>
+#include <compare>
+#include <concepts>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#include <arm_neon.h>
+#endif
 
 //----------------------------------------------------------------------------------------------------------------------
 
@@ -72,6 +96,9 @@ using std::uint32_t;
 /// Unsigned integer type with width of exactly 64 bits and no padding bits
 using std::uint64_t;
 
+/// Unsigned integer type capable of holding a pointer to \c void
+using std::uintptr_t;
+
 //--------------------------------------------------------------------------------------------------------------------
 
 // (lvl 1)               Containers library https://en.cppreference.com/w/cpp/container.html
@@ -83,10 +110,56 @@ using std::uint64_t;
 */
 using std::array;
 
+/*!
+  \brief Non-owning view of a contiguous sequence of objects; alias for std::span.
+
+  \sa https://en.cppreference.com/w/cpp/container/span.html
+*/
+using std::span;
+
+// (lvl 1)               Strings library https://en.cppreference.com/w/cpp/string.html
+
+/*!
+  \brief Read-only view of a contiguous character sequence; alias for std::string_view.
+
+  \sa https://en.cppreference.com/w/cpp/string/basic_string_view.html
+*/
+using std::string_view;
+
 } // namespace toy
 
 //--------------------------------------------------------------------------------------------------------------------
 
+#include "core/allocator.hpp"
 #include "core/assertion.hpp"
+#include "core/chrono.hpp"
+#include "core/fixed_string.hpp"
+#include "core/fixed_vector.hpp"
+#include "core/hash.hpp"
+#include "core/flat_hash_map.hpp"
+#include "core/format.hpp"
+#include "core/jobs.hpp"
+#include "core/log.hpp"
+#include "core/memory.hpp"
+#include "core/platform.hpp"
+#include "core/profiler.hpp"
+#include "core/slot_map.hpp"
+#include "core/utils.hpp"
+
+#include "core/allocator.inl"
+#include "core/assertion.inl"
+#include "core/chrono.inl"
+#include "core/fixed_string.inl"
+#include "core/fixed_vector.inl"
+#include "core/hash.inl"
+#include "core/flat_hash_map.inl"
+#include "core/format.inl"
+#include "core/jobs.inl"
+#include "core/log.inl"
+#include "core/memory.inl"
+#include "core/platform.inl"
+#include "core/profiler.inl"
+#include "core/slot_map.inl"
+#include "core/utils.inl"
 
 #endif // INCLUDE_CORE_HPP_
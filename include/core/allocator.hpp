@@ -0,0 +1,242 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   allocator.hpp
+  \brief  Allocator concept, heap allocator, linear arena with rewind markers, and double-buffered frame allocator.
+
+  Declares \ref toy::Allocator, the requirement core containers and utilities place on a memory source, the heap
+  allocator behind long-lived data, and the two engine allocators for temporary data: \ref toy::LinearAllocator and
+  \ref toy::FrameAllocator. Both carve memory out of a caller-supplied buffer and never call \c malloc, so a long
+  session on a handheld with a few hundred kilobytes of RAM cannot fragment the heap with per-frame data.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_ALLOCATOR_HPP_
+#define INCLUDE_CORE_ALLOCATOR_HPP_
+
+namespace toy {
+
+/// Default alignment of allocations: that of \c std::max_align_t
+inline constexpr size_t c_defaultAlignment = alignof(std::max_align_t);
+
+/*!
+  \brief Memory source accepted by allocator-aware containers and utilities.
+
+  \c allocate(size, alignment) returns \a size bytes aligned to \a alignment, a power of two, or \c nullptr when the
+  source is exhausted; it must not throw. \c deallocate(pointer, size, alignment) gives back an allocation. Memory
+  taken by the engine containers is not always given back one allocation at a time; see the container.
+
+  \tparam A Allocator type.
+*/
+template <typename A>
+concept Allocator = requires(A & allocator, void * pointer, size_t size, size_t alignment) {
+  { allocator.allocate(size, alignment) } noexcept -> std::same_as<void *>;
+  { allocator.deallocate(pointer, size, alignment) } noexcept;
+};
+
+/*!
+  \brief Allocator over the C++ heap, for data that outlives a frame.
+
+  Stateless: each call goes to the aligned, non-throwing \c operator \c new and its matching \c operator \c delete.
+  Wrap it in a \ref toy::TrackedAllocator to charge the memory to a subsystem.
+*/
+class HeapAllocator {
+public:
+  /// Allocates \a size bytes aligned to \a alignment, a power of two; \c nullptr when the heap is exhausted.
+  [[nodiscard]] void * allocate(size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Frees \a pointer, allocated with the same \a size and \a alignment; \c nullptr is ignored.
+  void deallocate(void * pointer, size_t size, size_t alignment = c_defaultAlignment) noexcept;
+};
+
+/*!
+  \brief Bump allocator over a fixed buffer, rewound to markers or reset in O(1).
+
+  An allocation moves an offset past the aligned request: one add, one compare, no headers. Memory comes back in three
+  ways: deallocate() of the newest allocation pops it, so the allocator works as a stack; rewind() returns everything
+  allocated after a marker() at once; reset() empties the buffer. Destructors never run, so only place objects whose
+  destructors can be skipped.
+
+  \code
+  alignas(toy::c_defaultAlignment) std::byte memory[64 * 1024];
+  toy::LinearAllocator arena(memory, sizeof(memory));
+
+  {
+    const toy::ScopedMarker scope(arena);
+    auto * nodes = arena.allocateArray<PathNode>(nodeCount); // freed at the end of the scope
+    // ...
+  }
+  \endcode
+
+  In debug builds, memory given back is filled with 0xCD so stale pointers into it show up quickly.
+*/
+class LinearAllocator {
+public:
+  /// Position in the buffer to rewind to; an offset from its start.
+  using Marker = size_t;
+
+  /// Constructs an allocator without memory; every allocation fails.
+  constexpr LinearAllocator() noexcept = default;
+
+  /*!
+    \brief Constructs an allocator over \a capacity bytes at \a buffer.
+
+    \param buffer   Memory to allocate from; it must outlive the allocator and everything allocated from it.
+    \param capacity Size of \a buffer, in bytes.
+  */
+  LinearAllocator(void * buffer, size_t capacity) noexcept;
+
+  /*!
+    \brief Allocates \a size bytes aligned to \a alignment.
+
+    \param size      Bytes to allocate; 0 returns a valid, unique position.
+    \param alignment Power of two.
+
+    \return Start of the allocation, or \c nullptr when the buffer has no room for it.
+  */
+  [[nodiscard]] void * allocate(size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Gives back the allocation at \a pointer if it is the newest one; other allocations wait for rewind() or reset().
+  void deallocate(void * pointer, size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Allocates uninitialized storage for \a count objects of type \a T; \c nullptr when it does not fit.
+  template <typename T>
+  [[nodiscard]] T * allocateArray(size_t count) noexcept;
+
+  /// Allocates and constructs a \a T from \a arguments; \c nullptr when it does not fit.
+  template <typename T, typename... Args>
+  [[nodiscard]] T * create(Args &&... arguments) noexcept;
+
+  /// Returns the current position, for rewind().
+  [[nodiscard]] Marker marker() const noexcept;
+
+  /// Frees everything allocated after \a marker was taken.
+  void rewind(Marker marker) noexcept;
+
+  /// Frees everything.
+  void reset() noexcept;
+
+  /// Returns whether \a pointer lies in the buffer.
+  [[nodiscard]] bool owns(const void * pointer) const noexcept;
+
+  /// Returns the bytes in use, alignment padding included.
+  [[nodiscard]] size_t used() const noexcept;
+
+  /// Returns the bytes left, before alignment.
+  [[nodiscard]] size_t remaining() const noexcept;
+
+  /// Returns the size of the buffer.
+  [[nodiscard]] size_t capacity() const noexcept;
+
+  /// Returns the highest used() seen since construction, for sizing the buffer.
+  [[nodiscard]] size_t peak() const noexcept;
+
+private:
+  /// Fills the bytes from the current offset up to \a end with the debug pattern.
+  void poison(size_t end) noexcept;
+
+  /// Start of the buffer
+  std::byte * _buffer{nullptr};
+
+  /// Size of the buffer
+  size_t _capacity{0};
+
+  /// Offset of the first free byte
+  size_t _offset{0};
+
+  /// Highest offset reached
+  size_t _peak{0};
+};
+
+/// Rewinds a \ref toy::LinearAllocator, on destruction, to where it was at construction.
+class ScopedMarker {
+public:
+  /// Takes a marker of \a allocator.
+  explicit ScopedMarker(LinearAllocator & allocator) noexcept;
+
+  /// Rewinds the allocator to the marker.
+  ~ScopedMarker() noexcept;
+
+  ScopedMarker(const ScopedMarker &)             = delete;
+  ScopedMarker & operator=(const ScopedMarker &) = delete;
+
+private:
+  /// Allocator to rewind
+  LinearAllocator & _allocator;
+
+  /// Position to rewind to
+  LinearAllocator::Marker _marker;
+};
+
+/*!
+  \brief Two linear arenas that take turns: allocations live for the frame they were made in and the next one.
+
+  Each half of the buffer serves one frame. beginFrame() switches to the other half and empties it, which frees the
+  data of two frames ago in O(1). Data of the previous frame, such as the draw list the renderer is still reading,
+  stays valid for one more frame.
+
+  \code
+  toy::FrameAllocator frameMemory(memory, sizeof(memory));
+
+  while (running) {
+    frameMemory.beginFrame();
+
+    const auto label = toy::format(frameMemory, "FPS {}", fps); // one pointer bump, gone two frames later
+    // ...
+  }
+  \endcode
+*/
+class FrameAllocator {
+public:
+  /*!
+    \brief Splits \a capacity bytes at \a buffer into two frame arenas.
+
+    \param buffer   Memory to allocate from; it must outlive the allocator and everything allocated from it.
+    \param capacity Size of \a buffer, in bytes; each frame gets half.
+  */
+  FrameAllocator(void * buffer, size_t capacity) noexcept;
+
+  /// Allocates \a size bytes aligned to \a alignment from the current frame; \c nullptr when they do not fit.
+  [[nodiscard]] void * allocate(size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Gives back the allocation at \a pointer if it is the newest of the current frame.
+  void deallocate(void * pointer, size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Switches to the other arena and empties it; allocations of the frame before the last one become invalid.
+  void beginFrame() noexcept;
+
+  /// Returns the arena of the current frame.
+  [[nodiscard]] LinearAllocator & current() noexcept;
+
+  /// Returns the arena of the previous frame.
+  [[nodiscard]] const LinearAllocator & previous() const noexcept;
+
+private:
+  /// Arenas of the two frames in flight
+  array<LinearAllocator, 2> _frames;
+
+  /// Index of the arena of the current frame
+  size_t _current{0};
+};
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_ALLOCATOR_HPP_
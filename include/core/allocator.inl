@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   allocator.inl
+  \brief  Inline definitions for the heap, linear, and frame allocators.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_ALLOCATOR_INL_
+#define INCLUDE_CORE_ALLOCATOR_INL_
+
+namespace toy {
+
+inline void * HeapAllocator::allocate(size_t size, size_t alignment) noexcept {
+  return ::operator new(size, std::align_val_t{alignment}, std::nothrow);
+}
+
+inline void HeapAllocator::deallocate(void * pointer, size_t size, size_t alignment) noexcept {
+  if (pointer != nullptr)
+    ::operator delete(pointer, size, std::align_val_t{alignment});
+}
+
+inline void * LinearAllocator::allocate(size_t size, size_t alignment) noexcept {
+  // Align the address rather than the offset, so the buffer itself needs no particular alignment
+  const auto   base  = reinterpret_cast<uintptr_t>(_buffer);
+  const size_t start = ((base + _offset + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1)) - base;
+
+  if (start > _capacity || size > _capacity - start) [[unlikely]]
+    return nullptr;
+
+  _offset = start + size;
+  _peak   = _offset > _peak ? _offset : _peak;
+
+  return _buffer + start;
+}
+
+inline void LinearAllocator::deallocate(void * pointer, size_t size, [[maybe_unused]] size_t alignment) noexcept {
+  auto * bytes = static_cast<std::byte *>(pointer);
+
+  if (bytes != nullptr && bytes + size == _buffer + _offset)
+    rewind(static_cast<Marker>(bytes - _buffer));
+}
+
+template <typename T>
+T * LinearAllocator::allocateArray(size_t count) noexcept {
+  if (count > _capacity / (sizeof(T) != 0 ? sizeof(T) : 1))
+    return nullptr;
+
+  return static_cast<T *>(allocate(count * sizeof(T), alignof(T)));
+}
+
+template <typename T, typename... Args>
+T * LinearAllocator::create(Args &&... arguments) noexcept {
+  static_assert(std::is_trivially_destructible_v<T>, "LinearAllocator never runs destructors");
+
+  void * storage = allocate(sizeof(T), alignof(T));
+
+  return storage != nullptr ? ::new (storage) T(std::forward<Args>(arguments)...) : nullptr;
+}
+
+inline LinearAllocator::Marker LinearAllocator::marker() const noexcept {
+  return _offset;
+}
+
+inline bool LinearAllocator::owns(const void * pointer) const noexcept {
+  const auto address = reinterpret_cast<uintptr_t>(pointer);
+  const auto base    = reinterpret_cast<uintptr_t>(_buffer);
+
+  return address >= base && address - base < _capacity;
+}
+
+inline size_t LinearAllocator::used() const noexcept {
+  return _offset;
+}
+
+inline size_t LinearAllocator::remaining() const noexcept {
+  return _capacity - _offset;
+}
+
+inline size_t LinearAllocator::capacity() const noexcept {
+  return _capacity;
+}
+
+inline size_t LinearAllocator::peak() const noexcept {
+  return _peak;
+}
+
+inline ScopedMarker::ScopedMarker(LinearAllocator & allocator) noexcept
+  : _allocator(allocator)
+  , _marker(allocator.marker()) {}
+
+inline ScopedMarker::~ScopedMarker() noexcept {
+  _allocator.rewind(_marker);
+}
+
+inline void * FrameAllocator::allocate(size_t size, size_t alignment) noexcept {
+  return _frames[_current].allocate(size, alignment);
+}
+
+inline void FrameAllocator::deallocate(void * pointer, size_t size, size_t alignment) noexcept {
+  _frames[_current].deallocate(pointer, size, alignment);
+}
+
+inline LinearAllocator & FrameAllocator::current() noexcept {
+  return _frames[_current];
+}
+
+inline const LinearAllocator & FrameAllocator::previous() const noexcept {
+  return _frames[_current ^ 1];
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_ALLOCATOR_INL_
@@ -21,9 +21,11 @@
   \file   assertion.hpp
   \brief  Assertion failure reporting and the handlers an application registers for it.
 
-  Defines \ref toy::assertion. It holds the two handler types, the initialize() and deInitialize() calls that bound
-  their registration, and assertion(), which the \c assert_message macro calls with the context of the failing check.
-  Reporting is compiled in only when \c _DEBUG is defined; every other build gets an empty inline assertion().
+  Defines \ref toy::assertion and the \c assert_message and \c assert_message_once macros. The namespace holds the two
+  handler types, the initialize() and deInitialize() calls that bound their registration, assertion(), which the
+  macros call with the context of the failing check, and the stack capture behind the frame handler and crash traces.
+  Reporting is compiled in only when \c _DEBUG is defined; every other build gets an empty inline assertion() and macros
+  that evaluate nothing.
 
   \note Included by core.hpp only; do not include this file directly.
 */
@@ -61,6 +63,7 @@
   toy::assertion::setCallbacks(reportAssertion, nullptr);
 
   // ... run the application; failed checks reach reportAssertion in debug builds ...
+  assert_message(texture != nullptr, "sprite drawn before its texture was loaded");
 
   toy::assertion::deInitialize();
   \endcode
@@ -120,7 +123,8 @@ void deInitialize() noexcept;
   Replaces both registrations at once; \c nullptr clears the corresponding handler.
 
   \param assertionCallback Invoked on a failed check, or \c nullptr to report nothing.
-  \param stackWalkCallback Invoked per stack frame while a trace is walked, or \c nullptr to skip the trace.
+  \param stackWalkCallback Invoked per stack frame of the failing call site after \a assertionCallback returns, or
+                           \c nullptr to skip the trace.
 
   \pre initialize() must have been called.
   \post Subsequent assertion() calls route through \a assertionCallback.
@@ -129,18 +133,121 @@ void deInitialize() noexcept;
 */
 void setCallbacks(AssertionCallback assertionCallback, StackWalkCallback stackWalkCallback) noexcept;
 
+/// Most frames captureStack() records in one call and the crash handler writes
+inline constexpr size_t c_maxStackFrames = 64;
+
+/*!
+  \brief Records the return addresses of the calling thread, innermost first.
+
+  Only raw addresses are taken: nothing is allocated, locked, or resolved, so the call is fast and usable from a signal
+  handler. walkStack() turns the addresses into text later.
+
+  \param frames   Destination for the addresses.
+  \param capacity Addresses \a frames can hold.
+  \param skip     Innermost frames to leave out, not counting captureStack() itself.
+
+  \return Number of addresses written.
+
+  \note Captures on Linux Desktop only; every other target returns 0.
+*/
+size_t captureStack(uintptr_t * frames, size_t capacity, size_t skip = 0) noexcept;
+
+/*!
+  \brief Resolves captured return addresses and passes one formatted line per frame to \a callback.
+
+  A line reads <tt>#index address function+offset (module+offset)</tt>. Each address is resolved once and kept in a
+  fixed-size cache, so a trace that repeats costs a table lookup per frame. Function names come from the dynamic
+  symbol table: an executable linked without exported symbols shows only the module offset, which \c addr2line
+  resolves.
+
+  \param frames   Addresses from captureStack().
+  \param count    Number of addresses.
+  \param callback Receiver of the lines; nothing happens when it is \c nullptr.
+
+  \note Not async-signal-safe: resolving a name may take the dynamic loader lock. The crash handler writes raw
+  addresses instead.
+*/
+void walkStack(const uintptr_t * frames, size_t count, StackWalkCallback callback) noexcept;
+
+/*!
+  \brief Installs handlers that write a stack trace when the process dies from \c SIGSEGV, \c SIGBUS, \c SIGFPE,
+  \c SIGILL, or \c SIGABRT.
+
+  The handler writes the signal and one line per frame, <tt>#index address (module+offset)</tt>, to
+  \a fileDescriptor with \c write(), then restores the previous handler and raises the signal again, so core dumps and
+  exit codes are unchanged. It runs on an alternate stack, so stack overflows are reported too. Modules are listed once
+  here, so the handler itself only reads tables; modules loaded later print raw addresses.
+
+  \param fileDescriptor Open descriptor that receives the trace, such as 2 for standard error or a log file.
+
+  \return \c true when the handlers are installed; \c false on targets without signals or when installation fails.
+
+  \note The alternate stack is set for the calling thread only; call from the main thread.
+
+  \sa removeCrashHandlers()
+*/
+bool installCrashHandlers(int fileDescriptor) noexcept;
+
+/// Restores the signal handlers that installCrashHandlers() replaced.
+void removeCrashHandlers() noexcept;
+
+/// Which failures of one call site reach the handler.
+enum class Repeat : uint8_t {
+  /// Only the first failure
+  Once,
+
+  /// Failures 1, 2, 4, 8, and so on: a check that keeps failing is reported about once per doubling of its count
+  Backoff,
+};
+
+/*!
+  \brief Failure counter of one check, kept in a function-local static by the assertion macros.
+
+  Decides which failures are reported under its \ref toy::assertion::Repeat policy. Counting is atomic, so threads that
+  fail the same check concurrently do not lose failures.
+*/
+class CallSite {
+public:
+  /// Creates a counter with no failures that reports under \a repeat.
+  constexpr explicit CallSite(Repeat repeat) noexcept;
+
+  /*!
+    \brief Counts one failure.
+
+    \return Number of failures so far, including this one, when this failure is to be reported; 0 when it is not.
+  */
+  [[nodiscard]] uint32_t fail() noexcept;
+
+  /// Returns the number of failures counted so far.
+  [[nodiscard]] uint32_t failures() const noexcept;
+
+private:
+  /// Failures counted so far
+  std::atomic<uint32_t> _failures{0};
+
+  /// Which failures are reported
+  Repeat _repeat;
+};
+
 #ifdef _DEBUG
 
 /*!
   \brief Reports a failed check through the registered \ref toy::assertion::AssertionCallback.
 
-  Called by the \c assert_message macro with the context it captures at the failing call site, never directly.
+  Called by the assertion macros with the context they capture at the failing call site, never directly. The
+  description is formatted into a static buffer and truncated when it does not fit. A failure raised while another
+  one is being reported, from the handler itself or from a second thread, is dropped. When a
+  \ref toy::assertion::StackWalkCallback is registered, the stack of the failing call site follows the description.
 
   \param code         Failed expression as written at the call site (e.g. \c "pointer != nullptr").
-  \param message      Reason the condition must hold, in human-readable form.
+  \param message      Reason the condition must hold, in human-readable form, or \c nullptr.
   \param fileName     Source file of the failed check.
   \param functionName Enclosing function of the failed check.
   \param lineNumber   Source line of the failed check.
+  \param failures     Failures of this call site so far; the description mentions the count when it is above 1.
+
+  \return \c false when the handler leaves the decision to the caller, which stops in the debugger; \c true when
+  execution continues, including when no handler is registered or the failure is dropped.
 
   \pre initialize() must have been called.
   \pre \a code, \a fileName, and \a functionName are non-null and outlive the call.
@@ -150,8 +257,8 @@ void setCallbacks(AssertionCallback assertionCallback, StackWalkCallback stackWa
 
   \sa setCallbacks()
 */
-void assertion(const char * code, const char * message, const char * fileName, const char * functionName,
-               size_t lineNumber) noexcept;
+[[nodiscard]] bool assertion(const char * code, const char * message, const char * fileName,
+                             const char * functionName, size_t lineNumber, uint32_t failures = 1) noexcept;
 
 #else  // _DEBUG
 
@@ -165,15 +272,28 @@ void assertion(const char * code, const char * message, const char * fileName, c
   \param fileName     Unused.
   \param functionName Unused.
   \param lineNumber   Unused.
+  \param failures     Unused.
+
+  \return Always \c true.
 */
-inline void assertion([[maybe_unused]] const char * code, [[maybe_unused]] const char * message,
-                      [[maybe_unused]] const char * fileName, [[maybe_unused]] const char * functionName,
-                      [[maybe_unused]] size_t lineNumber) noexcept {
+[[nodiscard]] inline bool assertion([[maybe_unused]] const char * code, [[maybe_unused]] const char * message,
+                                    [[maybe_unused]] const char * fileName, [[maybe_unused]] const char * functionName,
+                                    [[maybe_unused]] size_t lineNumber,
+                                    [[maybe_unused]] uint32_t failures = 1) noexcept {
   // Intentionally empty - no-op in release builds
+  return true;
 }
 
 #endif // _DEBUG
 
+/*!
+  \brief Stops execution where a debugger can inspect it; terminates the process when none is attached.
+
+  The assertion macros call it when the handler returns \c false. Execution resumes after the call when the debugger
+  continues.
+*/
+void debugBreak() noexcept;
+
 /*!
   \brief Fails the build when reached during constant evaluation; does nothing at runtime.
 
@@ -191,4 +311,44 @@ inline void assertCompileTimeError() noexcept {
 
 } // namespace toy::assertion
 
+#ifdef _DEBUG
+
+/*!
+  \brief Checks a condition in debug builds and reports a failure through toy::assertion::assertion().
+
+  A check that keeps failing is reported with toy::assertion::Repeat::Backoff. When the handler returns \c false,
+  execution stops in toy::assertion::debugBreak().
+
+  \param expression Condition that must hold; evaluated once, and only when \c _DEBUG is defined.
+  \param message    Reason the condition must hold, as a string literal.
+*/
+#define assert_message(expression, message) \
+  TOYGINE_ASSERT_IMPLEMENTATION(expression, message, toy::assertion::Repeat::Backoff)
+
+/// Same as \c assert_message, but only the first failure of the call site is reported.
+#define assert_message_once(expression, message) \
+  TOYGINE_ASSERT_IMPLEMENTATION(expression, message, toy::assertion::Repeat::Once)
+
+/// Shared body of the assertion macros; the call site counter exists only once the check has failed.
+#define TOYGINE_ASSERT_IMPLEMENTATION(expression, message, repeat)                                                    \
+  do {                                                                                                                \
+    if (!(expression)) [[unlikely]] {                                                                                 \
+      static constinit toy::assertion::CallSite toygineCallSite(repeat);                                              \
+      if (const toy::uint32_t toygineFailures = toygineCallSite.fail();                                              \
+          toygineFailures != 0                                                                                        \
+          && !toy::assertion::assertion(#expression, message, __FILE__, __func__, __LINE__, toygineFailures))         \
+        toy::assertion::debugBreak();                                                                                 \
+    }                                                                                                                 \
+  } while (false)
+
+#else // _DEBUG
+
+/// Compiles \a expression without evaluating it, so variables used only by checks stay used.
+#define assert_message(expression, message) static_cast<void>(sizeof(!(expression)))
+
+/// Compiles \a expression without evaluating it, so variables used only by checks stay used.
+#define assert_message_once(expression, message) static_cast<void>(sizeof(!(expression)))
+
+#endif // _DEBUG
+
 #endif // INCLUDE_CORE_ASSERTION_HPP_
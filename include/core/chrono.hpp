@@ -0,0 +1,282 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   chrono.hpp
+  \brief  Monotonic engine clock, fixed-timestep accumulator, and frame pacer.
+
+  Declares namespace \ref toy::chrono. Every time in it is a \c uint64_t count of nanoseconds.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_CHRONO_HPP_
+#define INCLUDE_CORE_CHRONO_HPP_
+
+// Targets where now() reads the time-stamp counter inline; elsewhere it always calls the platform timer
+#if defined(__linux__) && defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define TOYGINE_CHRONO_TSC
+#endif
+
+/*!
+  \namespace toy::chrono
+
+  \brief Engine clock and frame timing.
+
+  now() is the one clock of the engine. On x86-64 Linux with an invariant time-stamp counter it reads the counter
+  inline and scales the ticks to nanoseconds with one multiply. The counter is calibrated once against
+  \c CLOCK_MONOTONIC. That is several times cheaper than a \c clock_gettime() call through the vDSO, and it does not
+  become a system call when the kernel distrusts its clock source. Other targets, including the consoles, read the
+  platform monotonic timer.
+
+  The calibration blocks for about \ref toy::chrono::c_calibrationTime. It runs on the first call to now() unless
+  calibrate() is called earlier, which is best done at startup. Readings share the epoch of \c CLOCK_MONOTONIC at the
+  calibration and do not follow later NTP slewing, so over hours they can drift from it by a few parts per million.
+
+  \code
+  toy::chrono::FixedTimestep simulation(toy::chrono::c_nanosecondsPerSecond / 60);
+  toy::chrono::FramePacer    pacer(toy::chrono::c_nanosecondsPerSecond / 60);
+
+  uint64_t frameTime = 0;
+
+  while (running) {
+    for (uint32_t step = simulation.advance(frameTime); step != 0; --step)
+      world.update(simulation.step());
+
+    world.render(simulation.alpha());
+    frameTime = pacer.endFrame();
+  }
+
+  const auto timing = pacer.statistics(); // median, 90th and 99th percentile, worst frame
+  \endcode
+*/
+namespace toy::chrono {
+
+/// Nanoseconds in one second
+inline constexpr uint64_t c_nanosecondsPerSecond = 1'000'000'000;
+
+/// Nanoseconds in one millisecond
+inline constexpr uint64_t c_nanosecondsPerMillisecond = 1'000'000;
+
+/// Nanoseconds in one microsecond
+inline constexpr uint64_t c_nanosecondsPerMicrosecond = 1'000;
+
+/// Time calibrate() measures the time-stamp counter over
+inline constexpr uint64_t c_calibrationTime = 10 * c_nanosecondsPerMillisecond;
+
+/// Frame times \ref toy::chrono::FramePacer keeps for its statistics
+inline constexpr size_t c_frameHistorySize = 256;
+
+/// Timer behind now().
+enum class ClockSource : uint8_t {
+  Uncalibrated, ///< calibrate() has not run yet
+  Tsc,          ///< Invariant time-stamp counter, scaled to nanoseconds
+  Platform,     ///< Monotonic timer of the platform
+};
+
+/*!
+  \brief Conversion from time-stamp counter ticks to engine time, written once by calibrate().
+
+  \note Read by the inline now(); use clockSource() and tickFrequency() instead.
+*/
+struct TimeBase {
+  /// Timer in use; published last, with release order
+  std::atomic<ClockSource> source{ClockSource::Uncalibrated};
+
+  /// Counter value at the end of the calibration
+  uint64_t originTicks{0};
+
+  /// Time of \ref originTicks, in nanoseconds of \c CLOCK_MONOTONIC
+  uint64_t originTime{0};
+
+  /// Nanoseconds per tick, in 32.32 fixed point
+  uint64_t scale{0};
+
+  /// Counter ticks per second, or 0 when the counter is not used
+  uint64_t frequency{0};
+};
+
+/// Calibration shared by every thread
+inline constinit TimeBase g_timeBase;
+
+/// Returns the engine time, in nanoseconds; never decreases on one thread.
+[[nodiscard]] uint64_t now() noexcept;
+
+/// Returns the time from the platform monotonic timer, calibrating first if needed; now() falls back to it.
+[[nodiscard]] uint64_t platformNow() noexcept;
+
+/*!
+  \brief Chooses the timer behind now() and calibrates the time-stamp counter if it is used.
+
+  Only the first call does any work; concurrent callers wait for it. Blocks for about \ref c_calibrationTime on
+  targets with an invariant time-stamp counter.
+
+  \return Timer now() uses from then on; never \ref ClockSource::Uncalibrated.
+*/
+ClockSource calibrate() noexcept;
+
+/// Returns the timer behind now(), or \ref ClockSource::Uncalibrated before the calibration.
+[[nodiscard]] ClockSource clockSource() noexcept;
+
+/// Returns the measured time-stamp counter frequency in ticks per second, or 0 when the counter is not used.
+[[nodiscard]] uint64_t tickFrequency() noexcept;
+
+/// Converts \a nanoseconds to seconds.
+[[nodiscard]] constexpr double toSeconds(uint64_t nanoseconds) noexcept;
+
+/*!
+  \brief Splits frame time into updates of a fixed length.
+
+  advance() adds the time of the last frame to an accumulator and returns how many whole steps it holds. The
+  remainder carries over to the next frame, and alpha() gives it as a fraction of a step for interpolating between
+  the last two simulation states. A frame never runs more than the configured maximum of steps. Time beyond that is
+  dropped and counted by skippedTime(), so a stall does not snowball into ever longer frames.
+*/
+class FixedTimestep {
+public:
+  /*!
+    \brief Creates an empty accumulator.
+
+    \param step     Length of one update, in nanoseconds; must not be 0.
+    \param maxSteps Most updates one advance() returns.
+  */
+  constexpr explicit FixedTimestep(uint64_t step, uint32_t maxSteps = 8) noexcept;
+
+  /// Adds \a elapsed nanoseconds and returns the number of updates to run now.
+  [[nodiscard]] constexpr uint32_t advance(uint64_t elapsed) noexcept;
+
+  /// Returns the carried-over time as a fraction of a step, from 0 to 1.
+  [[nodiscard]] constexpr float alpha() const noexcept;
+
+  /// Returns the length of one update, in nanoseconds.
+  [[nodiscard]] constexpr uint64_t step() const noexcept;
+
+  /// Returns the time carried over to the next advance(), in nanoseconds.
+  [[nodiscard]] constexpr uint64_t accumulated() const noexcept;
+
+  /// Returns the number of updates returned so far.
+  [[nodiscard]] constexpr uint64_t steps() const noexcept;
+
+  /// Returns the time dropped so far by the step limit, in nanoseconds.
+  [[nodiscard]] constexpr uint64_t skippedTime() const noexcept;
+
+  /// Empties the accumulator and the counters.
+  constexpr void reset() noexcept;
+
+private:
+  /// Length of one update
+  uint64_t _step;
+
+  /// Time not yet turned into updates
+  uint64_t _accumulated{0};
+
+  /// Updates returned so far
+  uint64_t _steps{0};
+
+  /// Time dropped by the step limit
+  uint64_t _skipped{0};
+
+  /// Most updates per advance()
+  uint32_t _maxSteps;
+};
+
+/// Frame-time distribution of the recent frames, in nanoseconds.
+struct FrameStatistics {
+  /// Frames the other fields cover, up to \ref c_frameHistorySize
+  size_t frames;
+
+  /// Mean frame time
+  uint64_t average;
+
+  /// Shortest frame
+  uint64_t minimum;
+
+  /// 50th percentile
+  uint64_t median;
+
+  /// 90th percentile
+  uint64_t percentile90;
+
+  /// 99th percentile
+  uint64_t percentile99;
+
+  /// Longest frame
+  uint64_t maximum;
+};
+
+/*!
+  \brief Ends frames on a steady cadence and reports frame-time percentiles.
+
+  endFrame() marks the end of a frame. With a target frame time it first waits for the frame's deadline, sleeping
+  while more than a couple of milliseconds remain and spinning for the rest. After a short overshoot the next deadline
+  stays on the original cadence. After a frame longer than the target the cadence restarts, so the next frames are
+  not rushed to catch up. The last \ref c_frameHistorySize frame times are kept for statistics() and percentile().
+*/
+class FramePacer {
+public:
+  /// Starts the first frame now; a \a targetFrameTime of 0 never waits.
+  explicit FramePacer(uint64_t targetFrameTime = 0) noexcept;
+
+  /// Waits for the deadline of the current frame, records it, starts the next one, and returns its time.
+  uint64_t endFrame() noexcept;
+
+  /// Adds a frame time to the history without reading the clock or waiting.
+  void record(uint64_t frameTime) noexcept;
+
+  /// Returns the nearest-rank \a percent percentile of the kept frame times, or 0 when none is kept.
+  [[nodiscard]] uint64_t percentile(uint32_t percent) const noexcept;
+
+  /// Returns the distribution of the kept frame times; all zeros when none is kept.
+  [[nodiscard]] FrameStatistics statistics() const noexcept;
+
+  /// Returns the target frame time, 0 when the pacer does not wait.
+  [[nodiscard]] uint64_t targetFrameTime() const noexcept;
+
+  /// Changes the target frame time from the next frame on.
+  void setTargetFrameTime(uint64_t targetFrameTime) noexcept;
+
+  /// Forgets the kept frame times and starts a new frame now.
+  void reset() noexcept;
+
+private:
+  /// Copies the kept frame times into \a sorted in ascending order; returns their number.
+  size_t sortedHistory(array<uint64_t, c_frameHistorySize> & sorted) const noexcept;
+
+  /// Recent frame times, in a ring
+  array<uint64_t, c_frameHistorySize> _history{};
+
+  /// Frame times kept in \ref _history
+  size_t _count{0};
+
+  /// Slot of \ref _history the next frame time goes to
+  size_t _next{0};
+
+  /// Target frame time
+  uint64_t _target;
+
+  /// Start of the current frame
+  uint64_t _frameStart;
+
+  /// Time the current frame should end at
+  uint64_t _deadline;
+};
+
+} // namespace toy::chrono
+
+#endif // INCLUDE_CORE_CHRONO_HPP_
@@ -0,0 +1,98 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   chrono.inl
+  \brief  Inline definitions for the engine clock and the fixed-timestep accumulator.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_CHRONO_INL_
+#define INCLUDE_CORE_CHRONO_INL_
+
+namespace toy::chrono {
+
+inline uint64_t now() noexcept {
+#ifdef TOYGINE_CHRONO_TSC
+  if (g_timeBase.source.load(std::memory_order_acquire) == ClockSource::Tsc) [[likely]] {
+    // Counters of different cores can differ by a few ticks; a reading just before the origin counts as the origin
+    const auto ticks   = static_cast<int64_t>(__builtin_ia32_rdtsc() - g_timeBase.originTicks);
+    const auto product = conversion::multiply(ticks > 0 ? static_cast<uint64_t>(ticks) : 0, g_timeBase.scale);
+
+    return g_timeBase.originTime + ((product.high << 32) | (product.low >> 32));
+  }
+#endif // TOYGINE_CHRONO_TSC
+
+  return platformNow();
+}
+
+constexpr double toSeconds(uint64_t nanoseconds) noexcept {
+  return static_cast<double>(nanoseconds) / static_cast<double>(c_nanosecondsPerSecond);
+}
+
+constexpr FixedTimestep::FixedTimestep(uint64_t step, uint32_t maxSteps) noexcept
+  : _step(step)
+  , _maxSteps(maxSteps) {}
+
+constexpr uint32_t FixedTimestep::advance(uint64_t elapsed) noexcept {
+  _accumulated += elapsed;
+
+  uint64_t count = _accumulated / _step;
+
+  if (count > _maxSteps) [[unlikely]] {
+    _skipped += (count - _maxSteps) * _step;
+    count = _maxSteps;
+  }
+
+  _accumulated %= _step;
+  _steps += count;
+
+  return static_cast<uint32_t>(count);
+}
+
+constexpr float FixedTimestep::alpha() const noexcept {
+  return static_cast<float>(static_cast<double>(_accumulated) / static_cast<double>(_step));
+}
+
+constexpr uint64_t FixedTimestep::step() const noexcept {
+  return _step;
+}
+
+constexpr uint64_t FixedTimestep::accumulated() const noexcept {
+  return _accumulated;
+}
+
+constexpr uint64_t FixedTimestep::steps() const noexcept {
+  return _steps;
+}
+
+constexpr uint64_t FixedTimestep::skippedTime() const noexcept {
+  return _skipped;
+}
+
+constexpr void FixedTimestep::reset() noexcept {
+  _accumulated = 0;
+  _steps       = 0;
+  _skipped     = 0;
+}
+
+} // namespace toy::chrono
+
+#endif // INCLUDE_CORE_CHRONO_INL_
@@ -0,0 +1,384 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_string.hpp
+  \brief  Fixed-capacity string with inline storage.
+
+  Declares \ref toy::FixedString, the engine's string type for names, paths, and log messages. It never allocates, so
+  it fits per-frame code on desktop and the small work RAM of retro targets alike. Definitions live in
+  fixed_string.inl.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FIXED_STRING_HPP_
+#define INCLUDE_CORE_FIXED_STRING_HPP_
+
+namespace toy {
+
+/*!
+  \brief Null-terminated string of at most \a N characters, stored inline.
+
+  The string keeps its length alongside the characters, so size() is O(1) and no operation rescans for the terminator.
+  Every member is \c constexpr. During constant evaluation searches and comparisons go through \c string_view; at
+  runtime find(), compare(), starts_with(), ends_with(), and the comparison operators call the vectorized kernels
+  compareChars(), findChar(), and findSubstring() instead.
+
+  Operations that would grow the string past \a N keep the characters that fit and drop the rest. In a constant
+  expression the same overflow fails the build through assertion::assertCompileTimeError().
+
+  \code
+  constexpr toy::FixedString name("player");
+
+  toy::FixedString<64> path("data/");
+  path += name;
+  path += ".sav";
+
+  if (path.ends_with(".sav")) {
+    // ...
+  }
+  \endcode
+
+  \tparam N Capacity in characters, excluding the terminating null character.
+*/
+template <size_t N>
+class FixedString {
+public:
+  /// Character type
+  using value_type = char;
+
+  /// Type of sizes and positions
+  using size_type = size_t;
+
+  /// Mutable contiguous iterator
+  using iterator = char *;
+
+  /// Read-only contiguous iterator
+  using const_iterator = const char *;
+
+  /// Position returned by the search functions when nothing matches
+  static constexpr size_t npos = static_cast<size_t>(-1);
+
+  /// Constructs an empty string.
+  constexpr FixedString() noexcept = default;
+
+  /*!
+    \brief Constructs a string from a null-terminated character sequence.
+
+    \param string Characters to copy; must not be \c nullptr.
+  */
+  constexpr FixedString(const char * string) noexcept;
+
+  /*!
+    \brief Constructs a string from a character range.
+
+    \param string Characters to copy; may be \c nullptr when \a count is 0.
+    \param count  Number of characters to copy.
+  */
+  constexpr FixedString(const char * string, size_t count) noexcept;
+
+  /*!
+    \brief Constructs a string from a string view.
+
+    \param string Characters to copy.
+  */
+  constexpr explicit FixedString(string_view string) noexcept;
+
+  /*!
+    \brief Constructs a string of \a count copies of one character.
+
+    \param count     Number of characters.
+    \param character Character to repeat.
+  */
+  constexpr FixedString(size_t count, char character) noexcept;
+
+  /*!
+    \brief Constructs a string from a string of another capacity.
+
+    \param other String to copy.
+  */
+  template <size_t M>
+  constexpr FixedString(const FixedString<M> & other) noexcept;
+
+  /// Replaces the contents with a null-terminated character sequence.
+  constexpr FixedString & operator=(const char * string) noexcept;
+
+  /// Replaces the contents with a string view.
+  constexpr FixedString & operator=(string_view string) noexcept;
+
+  /// Replaces the contents with a string of another capacity.
+  template <size_t M>
+  constexpr FixedString & operator=(const FixedString<M> & other) noexcept;
+
+  /*!
+    \brief Replaces the contents with a character range.
+
+    \param string Characters to copy; may be \c nullptr when \a count is 0.
+    \param count  Number of characters to copy.
+
+    \return This string.
+  */
+  constexpr FixedString & assign(const char * string, size_t count) noexcept;
+
+  /// Returns the character at \a position; \a position must be less than size().
+  [[nodiscard]] constexpr char & operator[](size_t position) noexcept;
+
+  /// Returns the character at \a position; \a position must be less than size().
+  [[nodiscard]] constexpr const char & operator[](size_t position) const noexcept;
+
+  /// Returns the first character; the string must not be empty.
+  [[nodiscard]] constexpr char & front() noexcept;
+
+  /// Returns the first character; the string must not be empty.
+  [[nodiscard]] constexpr const char & front() const noexcept;
+
+  /// Returns the last character; the string must not be empty.
+  [[nodiscard]] constexpr char & back() noexcept;
+
+  /// Returns the last character; the string must not be empty.
+  [[nodiscard]] constexpr const char & back() const noexcept;
+
+  /// Returns the characters, followed by a null character.
+  [[nodiscard]] constexpr char * data() noexcept;
+
+  /// Returns the characters, followed by a null character.
+  [[nodiscard]] constexpr const char * data() const noexcept;
+
+  /// Returns the characters as a null-terminated sequence.
+  [[nodiscard]] constexpr const char * c_str() const noexcept;
+
+  /// Returns a view of the characters, valid until the string changes.
+  [[nodiscard]] constexpr string_view view() const noexcept;
+
+  /// Converts to a view of the characters, valid until the string changes.
+  constexpr operator string_view() const noexcept;
+
+  /// Returns an iterator to the first character.
+  [[nodiscard]] constexpr iterator begin() noexcept;
+
+  /// Returns an iterator to the first character.
+  [[nodiscard]] constexpr const_iterator begin() const noexcept;
+
+  /// Returns an iterator past the last character.
+  [[nodiscard]] constexpr iterator end() noexcept;
+
+  /// Returns an iterator past the last character.
+  [[nodiscard]] constexpr const_iterator end() const noexcept;
+
+  /// Returns an iterator to the first character.
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept;
+
+  /// Returns an iterator past the last character.
+  [[nodiscard]] constexpr const_iterator cend() const noexcept;
+
+  /// Checks whether the string has no characters.
+  [[nodiscard]] constexpr bool empty() const noexcept;
+
+  /// Returns the number of characters, excluding the terminator.
+  [[nodiscard]] constexpr size_t size() const noexcept;
+
+  /// Returns the number of characters, excluding the terminator.
+  [[nodiscard]] constexpr size_t length() const noexcept;
+
+  /// Returns the capacity \a N.
+  [[nodiscard]] static constexpr size_t capacity() noexcept;
+
+  /// Returns the capacity \a N.
+  [[nodiscard]] static constexpr size_t max_size() noexcept;
+
+  /// Removes all characters.
+  constexpr void clear() noexcept;
+
+  /// Appends one character; dropped when the string is full.
+  constexpr void push_back(char character) noexcept;
+
+  /// Removes the last character; the string must not be empty.
+  constexpr void pop_back() noexcept;
+
+  /*!
+    \brief Appends a character range; characters past the capacity are dropped.
+
+    \param string Characters to append; may be \c nullptr when \a count is 0.
+    \param count  Number of characters to append.
+
+    \return This string.
+  */
+  constexpr FixedString & append(const char * string, size_t count) noexcept;
+
+  /// Appends a string view; characters past the capacity are dropped.
+  constexpr FixedString & append(string_view string) noexcept;
+
+  /// Appends \a count copies of a character; characters past the capacity are dropped.
+  constexpr FixedString & append(size_t count, char character) noexcept;
+
+  /// Appends one character; dropped when the string is full.
+  constexpr FixedString & operator+=(char character) noexcept;
+
+  /// Appends a null-terminated character sequence; characters past the capacity are dropped.
+  constexpr FixedString & operator+=(const char * string) noexcept;
+
+  /// Appends a string view; characters past the capacity are dropped.
+  constexpr FixedString & operator+=(string_view string) noexcept;
+
+  /// Appends a string of any capacity; characters past the capacity are dropped.
+  template <size_t M>
+  constexpr FixedString & operator+=(const FixedString<M> & other) noexcept;
+
+  /*!
+    \brief Inserts characters before \a position.
+
+    Characters pushed past the capacity, from the tail of the string or from \a string, are dropped.
+
+    \param position Insertion point; at most size().
+    \param string   Characters to insert; must not refer into this string.
+
+    \return This string.
+  */
+  constexpr FixedString & insert(size_t position, string_view string) noexcept;
+
+  /*!
+    \brief Removes up to \a count characters starting at \a position.
+
+    \param position First character to remove; at most size().
+    \param count    Number of characters to remove; clamped to the end of the string.
+
+    \return This string.
+  */
+  constexpr FixedString & erase(size_t position, size_t count = npos) noexcept;
+
+  /*!
+    \brief Changes the number of characters.
+
+    \param count     New size; clamped to the capacity.
+    \param character Fill for characters added when the string grows.
+  */
+  constexpr void resize(size_t count, char character = '\0') noexcept;
+
+  /*!
+    \brief Lets \a operation write the characters in place, then sets the size it returns.
+
+    \a operation is called as <tt>operation(data(), count)</tt> and returns the new size, at most \a count. Characters
+    past the old size are unspecified until written. Avoids filling characters a writer overwrites anyway.
+
+    \param count     Characters \a operation may write; clamped to the capacity.
+    \param operation Callable taking <tt>(char *, size_t)</tt> and returning \c size_t.
+  */
+  template <typename Operation>
+  constexpr void resize_and_overwrite(size_t count, Operation operation) noexcept;
+
+  /*!
+    \brief Finds the first occurrence of a substring at or after \a position.
+
+    \return Position of the match, or \ref npos.
+  */
+  [[nodiscard]] constexpr size_t find(string_view string, size_t position = 0) const noexcept;
+
+  /*!
+    \brief Finds the first occurrence of a character at or after \a position.
+
+    \return Position of the match, or \ref npos.
+  */
+  [[nodiscard]] constexpr size_t find(char character, size_t position = 0) const noexcept;
+
+  /*!
+    \brief Finds the last occurrence of a substring that starts at or before \a position.
+
+    \return Position of the match, or \ref npos.
+  */
+  [[nodiscard]] constexpr size_t rfind(string_view string, size_t position = npos) const noexcept;
+
+  /*!
+    \brief Finds the last occurrence of a character at or before \a position.
+
+    \return Position of the match, or \ref npos.
+  */
+  [[nodiscard]] constexpr size_t rfind(char character, size_t position = npos) const noexcept;
+
+  /// Checks whether the string contains a substring.
+  [[nodiscard]] constexpr bool contains(string_view string) const noexcept;
+
+  /// Checks whether the string contains a character.
+  [[nodiscard]] constexpr bool contains(char character) const noexcept;
+
+  /// Checks whether the string begins with a prefix.
+  [[nodiscard]] constexpr bool starts_with(string_view string) const noexcept;
+
+  /// Checks whether the string begins with a character.
+  [[nodiscard]] constexpr bool starts_with(char character) const noexcept;
+
+  /// Checks whether the string ends with a suffix.
+  [[nodiscard]] constexpr bool ends_with(string_view string) const noexcept;
+
+  /// Checks whether the string ends with a character.
+  [[nodiscard]] constexpr bool ends_with(char character) const noexcept;
+
+  /*!
+    \brief Lexicographically compares with a string view, byte by byte as \c unsigned \c char.
+
+    \return Negative, zero, or positive when this string orders before, equal to, or after \a string.
+  */
+  [[nodiscard]] constexpr int compare(string_view string) const noexcept;
+
+private:
+  /// Number of characters from \a requested that fit after \a used characters.
+  static constexpr size_t fitting(size_t used, size_t requested) noexcept;
+
+  /// Copies characters that may overlap only when \a destination precedes \a source, as from a part of this string.
+  static constexpr void copyChars(char * destination, const char * source, size_t count) noexcept;
+
+  /// Characters followed by the terminator; slots past the terminator are unspecified.
+  char _data[N + 1]{};
+
+  /// Number of characters before the terminator
+  size_t _size{0};
+};
+
+/// Deduces the capacity from a string literal: \c FixedString("abc") is a \c FixedString<3>.
+template <size_t M>
+FixedString(const char (&)[M]) -> FixedString<M - 1>;
+
+/// Checks whether two strings of any capacities hold the same characters.
+template <size_t N, size_t M>
+[[nodiscard]] constexpr bool operator==(const FixedString<N> & left, const FixedString<M> & right) noexcept;
+
+/// Checks whether a string holds the same characters as a null-terminated character sequence.
+template <size_t N>
+[[nodiscard]] constexpr bool operator==(const FixedString<N> & left, const char * right) noexcept;
+
+/// Checks whether a string holds the same characters as a string view.
+template <size_t N>
+[[nodiscard]] constexpr bool operator==(const FixedString<N> & left, string_view right) noexcept;
+
+/// Lexicographically orders two strings of any capacities.
+template <size_t N, size_t M>
+[[nodiscard]] constexpr std::strong_ordering operator<=>(const FixedString<N> & left,
+                                                         const FixedString<M> & right) noexcept;
+
+/// Lexicographically orders a string against a null-terminated character sequence.
+template <size_t N>
+[[nodiscard]] constexpr std::strong_ordering operator<=>(const FixedString<N> & left, const char * right) noexcept;
+
+/// Lexicographically orders a string against a string view.
+template <size_t N>
+[[nodiscard]] constexpr std::strong_ordering operator<=>(const FixedString<N> & left, string_view right) noexcept;
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FIXED_STRING_HPP_
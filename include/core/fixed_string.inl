@@ -0,0 +1,458 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_string.inl
+  \brief  Inline definitions for \ref toy::FixedString.
+
+  Constant evaluation goes through \c string_view and \c std::char_traits; runtime searches and comparisons go
+  through the byte-string kernels declared in utils.hpp.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FIXED_STRING_INL_
+#define INCLUDE_CORE_FIXED_STRING_INL_
+
+namespace toy {
+
+template <size_t N>
+constexpr FixedString<N>::FixedString(const char * string) noexcept
+  : FixedString(string, std::char_traits<char>::length(string)) {}
+
+template <size_t N>
+constexpr FixedString<N>::FixedString(const char * string, size_t count) noexcept {
+  assign(string, count);
+}
+
+template <size_t N>
+constexpr FixedString<N>::FixedString(string_view string) noexcept
+  : FixedString(string.data(), string.size()) {}
+
+template <size_t N>
+constexpr FixedString<N>::FixedString(size_t count, char character) noexcept {
+  append(count, character);
+}
+
+template <size_t N>
+template <size_t M>
+constexpr FixedString<N>::FixedString(const FixedString<M> & other) noexcept
+  : FixedString(other.data(), other.size()) {}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::operator=(const char * string) noexcept {
+  return assign(string, std::char_traits<char>::length(string));
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::operator=(string_view string) noexcept {
+  return assign(string.data(), string.size());
+}
+
+template <size_t N>
+template <size_t M>
+constexpr FixedString<N> & FixedString<N>::operator=(const FixedString<M> & other) noexcept {
+  return assign(other.data(), other.size());
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::assign(const char * string, size_t count) noexcept {
+  _size = fitting(0, count);
+
+  copyChars(_data, string, _size);
+  _data[_size] = '\0';
+
+  return *this;
+}
+
+template <size_t N>
+constexpr char & FixedString<N>::operator[](size_t position) noexcept {
+  return _data[position];
+}
+
+template <size_t N>
+constexpr const char & FixedString<N>::operator[](size_t position) const noexcept {
+  return _data[position];
+}
+
+template <size_t N>
+constexpr char & FixedString<N>::front() noexcept {
+  return _data[0];
+}
+
+template <size_t N>
+constexpr const char & FixedString<N>::front() const noexcept {
+  return _data[0];
+}
+
+template <size_t N>
+constexpr char & FixedString<N>::back() noexcept {
+  return _data[_size - 1];
+}
+
+template <size_t N>
+constexpr const char & FixedString<N>::back() const noexcept {
+  return _data[_size - 1];
+}
+
+template <size_t N>
+constexpr char * FixedString<N>::data() noexcept {
+  return _data;
+}
+
+template <size_t N>
+constexpr const char * FixedString<N>::data() const noexcept {
+  return _data;
+}
+
+template <size_t N>
+constexpr const char * FixedString<N>::c_str() const noexcept {
+  return _data;
+}
+
+template <size_t N>
+constexpr string_view FixedString<N>::view() const noexcept {
+  return {_data, _size};
+}
+
+template <size_t N>
+constexpr FixedString<N>::operator string_view() const noexcept {
+  return view();
+}
+
+template <size_t N>
+constexpr FixedString<N>::iterator FixedString<N>::begin() noexcept {
+  return _data;
+}
+
+template <size_t N>
+constexpr FixedString<N>::const_iterator FixedString<N>::begin() const noexcept {
+  return _data;
+}
+
+template <size_t N>
+constexpr FixedString<N>::iterator FixedString<N>::end() noexcept {
+  return _data + _size;
+}
+
+template <size_t N>
+constexpr FixedString<N>::const_iterator FixedString<N>::end() const noexcept {
+  return _data + _size;
+}
+
+template <size_t N>
+constexpr FixedString<N>::const_iterator FixedString<N>::cbegin() const noexcept {
+  return _data;
+}
+
+template <size_t N>
+constexpr FixedString<N>::const_iterator FixedString<N>::cend() const noexcept {
+  return _data + _size;
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::size() const noexcept {
+  return _size;
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::length() const noexcept {
+  return _size;
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::capacity() noexcept {
+  return N;
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::max_size() noexcept {
+  return N;
+}
+
+template <size_t N>
+constexpr void FixedString<N>::clear() noexcept {
+  _size    = 0;
+  _data[0] = '\0';
+}
+
+template <size_t N>
+constexpr void FixedString<N>::push_back(char character) noexcept {
+  if (fitting(_size, 1) == 0)
+    return;
+
+  _data[_size++] = character;
+  _data[_size]   = '\0';
+}
+
+template <size_t N>
+constexpr void FixedString<N>::pop_back() noexcept {
+  _data[--_size] = '\0';
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::append(const char * string, size_t count) noexcept {
+  const size_t added = fitting(_size, count);
+
+  copyChars(_data + _size, string, added);
+  _size += added;
+  _data[_size] = '\0';
+
+  return *this;
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::append(string_view string) noexcept {
+  return append(string.data(), string.size());
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::append(size_t count, char character) noexcept {
+  const size_t added = fitting(_size, count);
+
+  std::char_traits<char>::assign(_data + _size, added, character);
+  _size += added;
+  _data[_size] = '\0';
+
+  return *this;
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::operator+=(char character) noexcept {
+  push_back(character);
+
+  return *this;
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::operator+=(const char * string) noexcept {
+  return append(string, std::char_traits<char>::length(string));
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::operator+=(string_view string) noexcept {
+  return append(string.data(), string.size());
+}
+
+template <size_t N>
+template <size_t M>
+constexpr FixedString<N> & FixedString<N>::operator+=(const FixedString<M> & other) noexcept {
+  return append(other.data(), other.size());
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::insert(size_t position, string_view string) noexcept {
+  const size_t inserted = fitting(position, string.size());
+  const size_t kept     = fitting(position + inserted, _size - position);
+
+  std::char_traits<char>::move(_data + position + inserted, _data + position, kept);
+  std::char_traits<char>::copy(_data + position, string.data(), inserted);
+  _size        = position + inserted + kept;
+  _data[_size] = '\0';
+
+  return *this;
+}
+
+template <size_t N>
+constexpr FixedString<N> & FixedString<N>::erase(size_t position, size_t count) noexcept {
+  const size_t removed = count < _size - position ? count : _size - position;
+
+  std::char_traits<char>::move(_data + position, _data + position + removed, _size - position - removed);
+  _size -= removed;
+  _data[_size] = '\0';
+
+  return *this;
+}
+
+template <size_t N>
+constexpr void FixedString<N>::resize(size_t count, char character) noexcept {
+  count = fitting(0, count);
+
+  if (count > _size)
+    std::char_traits<char>::assign(_data + _size, count - _size, character);
+
+  _size        = count;
+  _data[_size] = '\0';
+}
+
+template <size_t N>
+template <typename Operation>
+constexpr void FixedString<N>::resize_and_overwrite(size_t count, Operation operation) noexcept {
+  count = fitting(0, count);
+
+  _size        = static_cast<size_t>(operation(_data, count));
+  _data[_size] = '\0';
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::find(string_view string, size_t position) const noexcept {
+  if consteval {
+    return view().find(string, position);
+  } else {
+    if (position > _size)
+      return npos;
+
+    const char * match = findSubstring(_data + position, _size - position, string.data(), string.size());
+
+    return match != nullptr ? static_cast<size_t>(match - _data) : npos;
+  }
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::find(char character, size_t position) const noexcept {
+  if consteval {
+    return view().find(character, position);
+  } else {
+    if (position >= _size)
+      return npos;
+
+    const char * match = findChar(_data + position, _size - position, character);
+
+    return match != nullptr ? static_cast<size_t>(match - _data) : npos;
+  }
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::rfind(string_view string, size_t position) const noexcept {
+  return view().rfind(string, position);
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::rfind(char character, size_t position) const noexcept {
+  return view().rfind(character, position);
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::contains(string_view string) const noexcept {
+  return find(string) != npos;
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::contains(char character) const noexcept {
+  return find(character) != npos;
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::starts_with(string_view string) const noexcept {
+  if (string.size() > _size)
+    return false;
+
+  if consteval {
+    return view().starts_with(string);
+  } else {
+    return compareChars(_data, string.data(), string.size()) == 0;
+  }
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::starts_with(char character) const noexcept {
+  return _size != 0 && _data[0] == character;
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::ends_with(string_view string) const noexcept {
+  if (string.size() > _size)
+    return false;
+
+  if consteval {
+    return view().ends_with(string);
+  } else {
+    return compareChars(_data + _size - string.size(), string.data(), string.size()) == 0;
+  }
+}
+
+template <size_t N>
+constexpr bool FixedString<N>::ends_with(char character) const noexcept {
+  return _size != 0 && _data[_size - 1] == character;
+}
+
+template <size_t N>
+constexpr int FixedString<N>::compare(string_view string) const noexcept {
+  if consteval {
+    return view().compare(string);
+  } else {
+    const int result = compareChars(_data, string.data(), _size < string.size() ? _size : string.size());
+    if (result != 0 || _size == string.size())
+      return result;
+
+    return _size < string.size() ? -1 : 1;
+  }
+}
+
+template <size_t N>
+constexpr size_t FixedString<N>::fitting(size_t used, size_t requested) noexcept {
+  const size_t available = N - used;
+  if (requested <= available)
+    return requested;
+
+  if consteval {
+    assertion::assertCompileTimeError();
+  }
+
+  return available;
+}
+
+template <size_t N>
+constexpr void FixedString<N>::copyChars(char * destination, const char * source, size_t count) noexcept {
+  if consteval {
+    // move() compares the two pointers to pick a direction, which is not a constant expression for a string literal
+    std::char_traits<char>::copy(destination, source, count);
+  } else {
+    std::char_traits<char>::move(destination, source, count);
+  }
+}
+
+template <size_t N, size_t M>
+constexpr bool operator==(const FixedString<N> & left, const FixedString<M> & right) noexcept {
+  return left == right.view();
+}
+
+template <size_t N>
+constexpr bool operator==(const FixedString<N> & left, const char * right) noexcept {
+  return left == string_view(right);
+}
+
+template <size_t N>
+constexpr bool operator==(const FixedString<N> & left, string_view right) noexcept {
+  return left.size() == right.size() && left.starts_with(right);
+}
+
+template <size_t N, size_t M>
+constexpr std::strong_ordering operator<=>(const FixedString<N> & left, const FixedString<M> & right) noexcept {
+  return left.compare(right.view()) <=> 0;
+}
+
+template <size_t N>
+constexpr std::strong_ordering operator<=>(const FixedString<N> & left, const char * right) noexcept {
+  return left.compare(right) <=> 0;
+}
+
+template <size_t N>
+constexpr std::strong_ordering operator<=>(const FixedString<N> & left, string_view right) noexcept {
+  return left.compare(right) <=> 0;
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FIXED_STRING_INL_
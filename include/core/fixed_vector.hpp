@@ -0,0 +1,328 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_vector.hpp
+  \brief  Fixed-capacity vector with inline storage.
+
+  Declares \ref toy::FixedVector, the engine's container for per-frame scratch lists (entities, draw items, collision
+  pairs), and the \ref toy::IsTriviallyRelocatable trait that selects its \c memmove fast paths. Definitions live in
+  fixed_vector.inl.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FIXED_VECTOR_HPP_
+#define INCLUDE_CORE_FIXED_VECTOR_HPP_
+
+namespace toy {
+
+/*!
+  \brief Trait telling whether moving a \a T to a new address and destroying the source equals copying its bytes.
+
+  True by default for trivially copyable types. Specialize it to \c std::true_type for types that own a resource
+  through a plain pointer or handle and have no self-references, so containers relocate them with \c memmove instead
+  of a move-construct and destroy per element:
+
+  \code
+  template <>
+  struct toy::IsTriviallyRelocatable<TextureHandle> : std::true_type {};
+  \endcode
+
+  \tparam T Element type.
+
+  \sa \ref toy::isTriviallyRelocatable
+*/
+template <typename T>
+struct IsTriviallyRelocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+/// Value of \ref toy::IsTriviallyRelocatable for \a T.
+template <typename T>
+inline constexpr bool isTriviallyRelocatable = IsTriviallyRelocatable<T>::value;
+
+/*!
+  \brief Vector of at most \a N elements, stored inline.
+
+  Follows the \c std::vector interface, without allocation and with a capacity fixed at compile time. Elements live
+  in uninitialized inline storage and are constructed on insertion, so \a T needs no default constructor.
+
+  Insertion and erasure in the middle shift the tail with one \c memmove when \a T is trivially relocatable (see
+  \ref toy::IsTriviallyRelocatable), and copies use \c memcpy when \a T is trivially copyable. Other types are
+  relocated one element at a time.
+
+  The container is usable in constant expressions: a \c constexpr or \c consteval function can build, modify, and
+  read it. A \c constexpr variable of it must be full (size() equal to \a N), since every element of a constant must be
+  initialized.
+
+  \pre Growing past \a N is a precondition violation; in a constant expression it fails the build through
+  assertion::assertCompileTimeError(). At runtime the call asserts in debug builds and leaves the vector unchanged in
+  every build. Use try_push_back() or try_emplace_back() where the list may overflow.
+
+  \tparam T Element type.
+  \tparam N Capacity in elements; greater than 0.
+*/
+template <typename T, size_t N>
+class FixedVector {
+  static_assert(N > 0, "FixedVector capacity must be greater than 0");
+
+public:
+  /// Element type
+  using value_type = T;
+
+  /// Type of sizes and indices
+  using size_type = size_t;
+
+  /// Type of iterator differences
+  using difference_type = std::ptrdiff_t;
+
+  /// Mutable element reference
+  using reference = T &;
+
+  /// Read-only element reference
+  using const_reference = const T &;
+
+  /// Mutable contiguous iterator
+  using iterator = T *;
+
+  /// Read-only contiguous iterator
+  using const_iterator = const T *;
+
+  /// Constructs an empty vector.
+  constexpr FixedVector() noexcept;
+
+  /// Constructs a vector of \a count value-initialized elements.
+  constexpr explicit FixedVector(size_t count) noexcept;
+
+  /// Constructs a vector of \a count copies of \a value.
+  constexpr FixedVector(size_t count, const T & value) noexcept;
+
+  /// Constructs a vector from a list of elements.
+  constexpr FixedVector(std::initializer_list<T> values) noexcept;
+
+  /// Constructs a vector from an iterator range.
+  template <std::input_iterator Iterator>
+  constexpr FixedVector(Iterator first, Iterator last) noexcept;
+
+  /// Copies the elements of \a other.
+  constexpr FixedVector(const FixedVector & other) noexcept;
+
+  /// Moves the elements of \a other; \a other keeps its size with moved-from elements.
+  constexpr FixedVector(FixedVector && other) noexcept;
+
+  /// Destroys the elements; trivial when \a T is trivially destructible.
+  constexpr ~FixedVector() noexcept
+    requires std::is_trivially_destructible_v<T>
+  = default;
+
+  /// Destroys the elements.
+  constexpr ~FixedVector() noexcept;
+
+  /// Replaces the elements with copies of those of \a other.
+  constexpr FixedVector & operator=(const FixedVector & other) noexcept;
+
+  /// Replaces the elements with those moved from \a other.
+  constexpr FixedVector & operator=(FixedVector && other) noexcept;
+
+  /// Returns the element at \a index; \a index must be less than size().
+  [[nodiscard]] constexpr T & operator[](size_t index) noexcept;
+
+  /// Returns the element at \a index; \a index must be less than size().
+  [[nodiscard]] constexpr const T & operator[](size_t index) const noexcept;
+
+  /// Returns the first element; the vector must not be empty.
+  [[nodiscard]] constexpr T & front() noexcept;
+
+  /// Returns the first element; the vector must not be empty.
+  [[nodiscard]] constexpr const T & front() const noexcept;
+
+  /// Returns the last element; the vector must not be empty.
+  [[nodiscard]] constexpr T & back() noexcept;
+
+  /// Returns the last element; the vector must not be empty.
+  [[nodiscard]] constexpr const T & back() const noexcept;
+
+  /// Returns the contiguous element storage.
+  [[nodiscard]] constexpr T * data() noexcept;
+
+  /// Returns the contiguous element storage.
+  [[nodiscard]] constexpr const T * data() const noexcept;
+
+  /// Returns an iterator to the first element.
+  [[nodiscard]] constexpr iterator begin() noexcept;
+
+  /// Returns an iterator to the first element.
+  [[nodiscard]] constexpr const_iterator begin() const noexcept;
+
+  /// Returns an iterator past the last element.
+  [[nodiscard]] constexpr iterator end() noexcept;
+
+  /// Returns an iterator past the last element.
+  [[nodiscard]] constexpr const_iterator end() const noexcept;
+
+  /// Returns an iterator to the first element.
+  [[nodiscard]] constexpr const_iterator cbegin() const noexcept;
+
+  /// Returns an iterator past the last element.
+  [[nodiscard]] constexpr const_iterator cend() const noexcept;
+
+  /// Checks whether the vector has no elements.
+  [[nodiscard]] constexpr bool empty() const noexcept;
+
+  /// Checks whether the vector holds \a N elements.
+  [[nodiscard]] constexpr bool full() const noexcept;
+
+  /// Returns the number of elements.
+  [[nodiscard]] constexpr size_t size() const noexcept;
+
+  /// Returns the capacity \a N.
+  [[nodiscard]] static constexpr size_t capacity() noexcept;
+
+  /// Returns the capacity \a N.
+  [[nodiscard]] static constexpr size_t max_size() noexcept;
+
+  /// Destroys all elements.
+  constexpr void clear() noexcept;
+
+  /// Appends a copy of \a value; the vector must not be full.
+  constexpr void push_back(const T & value) noexcept;
+
+  /// Appends \a value by moving it; the vector must not be full.
+  constexpr void push_back(T && value) noexcept;
+
+  /// Constructs an element in place at the end; the vector must not be full, or nothing is constructed and the last
+  /// element is returned.
+  template <typename... Args>
+  constexpr T & emplace_back(Args &&... args) noexcept;
+
+  /// Appends a copy of \a value when there is room.
+  constexpr T * try_push_back(const T & value) noexcept;
+
+  /// Appends \a value by moving it when there is room.
+  constexpr T * try_push_back(T && value) noexcept;
+
+  /*!
+    \brief Constructs an element in place at the end when there is room.
+
+    \return The new element, or \c nullptr when the vector is full and nothing was constructed.
+  */
+  template <typename... Args>
+  constexpr T * try_emplace_back(Args &&... args) noexcept;
+
+  /// Destroys the last element; the vector must not be empty.
+  constexpr void pop_back() noexcept;
+
+  /*!
+    \brief Constructs an element in place before \a position.
+
+    \param position Insertion point, from begin() to end().
+    \param args     Constructor arguments; may refer to elements of this vector.
+
+    \return Iterator to the new element, or end() when the vector is full and nothing was inserted.
+
+    \pre The vector is not full.
+  */
+  template <typename... Args>
+  constexpr iterator emplace(const_iterator position, Args &&... args) noexcept;
+
+  /// Inserts a copy of \a value before \a position; see emplace().
+  constexpr iterator insert(const_iterator position, const T & value) noexcept;
+
+  /// Inserts \a value by moving it before \a position; see emplace().
+  constexpr iterator insert(const_iterator position, T && value) noexcept;
+
+  /*!
+    \brief Inserts \a count copies of \a value before \a position.
+
+    \return Iterator to the first inserted element, \a position when \a count is 0, or end() when the elements do not
+    fit and nothing was inserted.
+
+    \pre size() + \a count does not exceed \a N.
+  */
+  constexpr iterator insert(const_iterator position, size_t count, const T & value) noexcept;
+
+  /*!
+    \brief Inserts the elements of a range before \a position.
+
+    \param position Insertion point, from begin() to end().
+    \param first    Start of the range; the range must not refer into this vector.
+    \param last     End of the range.
+
+    \return Iterator to the first inserted element, \a position when the range is empty, or end() when the range does
+    not fit and nothing was inserted.
+
+    \pre size() plus the length of the range does not exceed \a N.
+  */
+  template <std::forward_iterator Iterator>
+  constexpr iterator insert(const_iterator position, Iterator first, Iterator last) noexcept;
+
+  /// Inserts a list of elements before \a position; see the range overload.
+  constexpr iterator insert(const_iterator position, std::initializer_list<T> values) noexcept;
+
+  /*!
+    \brief Removes the element at \a position.
+
+    \return Iterator to the element that followed the removed one.
+  */
+  constexpr iterator erase(const_iterator position) noexcept;
+
+  /*!
+    \brief Removes the elements in [\a first, \a last).
+
+    \return Iterator to the element that followed the last removed one.
+  */
+  constexpr iterator erase(const_iterator first, const_iterator last) noexcept;
+
+  /// Changes the number of elements, value-initializing new ones; \a count must not exceed \a N, or nothing changes.
+  constexpr void resize(size_t count) noexcept;
+
+  /// Changes the number of elements, copying \a value into new ones; \a count must not exceed \a N, or nothing changes.
+  constexpr void resize(size_t count, const T & value) noexcept;
+
+private:
+  /// Checks whether \a count more elements fit; when they do not, fails constant evaluation or asserts at runtime.
+  [[nodiscard]] constexpr bool checkRoom(size_t count) const noexcept;
+
+  /// Index of \a position in the storage.
+  constexpr size_t indexOf(const_iterator position) const noexcept;
+
+  /// Copy-constructs \a count elements into uninitialized \a destination; the ranges must not overlap.
+  static constexpr void copyConstruct(T * destination, const T * source, size_t count) noexcept;
+
+  /// Moves \a count elements to uninitialized \a destination and ends their lifetime at \a source; ranges may overlap.
+  static constexpr void relocate(T * destination, T * source, size_t count) noexcept;
+
+  /// Destroys \a count elements starting at \a first.
+  static constexpr void destroy(T * first, size_t count) noexcept;
+
+  union {
+    /// Element storage; only the first \ref _size slots hold live objects
+    T _data[N];
+  };
+
+  /// Number of live elements
+  size_t _size{0};
+};
+
+/// Checks whether two vectors hold equal elements in the same order.
+template <typename T, size_t N, size_t M>
+[[nodiscard]] constexpr bool operator==(const FixedVector<T, N> & left, const FixedVector<T, M> & right) noexcept;
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FIXED_VECTOR_HPP_
@@ -0,0 +1,469 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_vector.inl
+  \brief  Inline definitions for \ref toy::FixedVector.
+
+  Every element move goes through three helpers, copyConstruct(), relocate(), and destroy(). Each one picks
+  \c memcpy, \c memmove, or nothing at runtime when the element type allows it, and falls back to per-element
+  construction during constant evaluation.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FIXED_VECTOR_INL_
+#define INCLUDE_CORE_FIXED_VECTOR_INL_
+
+namespace toy {
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::FixedVector() noexcept {}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::FixedVector(size_t count) noexcept {
+  resize(count);
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::FixedVector(size_t count, const T & value) noexcept {
+  resize(count, value);
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::FixedVector(std::initializer_list<T> values) noexcept {
+  if (!checkRoom(values.size()))
+    return;
+
+  copyConstruct(_data, values.begin(), values.size());
+  _size = values.size();
+}
+
+template <typename T, size_t N>
+template <std::input_iterator Iterator>
+constexpr FixedVector<T, N>::FixedVector(Iterator first, Iterator last) noexcept {
+  for (; first != last; ++first)
+    emplace_back(*first);
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::FixedVector(const FixedVector & other) noexcept {
+  copyConstruct(_data, other._data, other._size);
+  _size = other._size;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::FixedVector(FixedVector && other) noexcept {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    copyConstruct(_data, other._data, other._size);
+  } else {
+    for (size_t index = 0; index < other._size; ++index)
+      std::construct_at(_data + index, std::move(other._data[index]));
+  }
+
+  _size = other._size;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::~FixedVector() noexcept {
+  destroy(_data, _size);
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N> & FixedVector<T, N>::operator=(const FixedVector & other) noexcept {
+  if (this != &other) {
+    clear();
+    copyConstruct(_data, other._data, other._size);
+    _size = other._size;
+  }
+
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N> & FixedVector<T, N>::operator=(FixedVector && other) noexcept {
+  if (this != &other) {
+    clear();
+
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      copyConstruct(_data, other._data, other._size);
+    } else {
+      for (size_t index = 0; index < other._size; ++index)
+        std::construct_at(_data + index, std::move(other._data[index]));
+    }
+
+    _size = other._size;
+  }
+
+  return *this;
+}
+
+template <typename T, size_t N>
+constexpr T & FixedVector<T, N>::operator[](size_t index) noexcept {
+  return _data[index];
+}
+
+template <typename T, size_t N>
+constexpr const T & FixedVector<T, N>::operator[](size_t index) const noexcept {
+  return _data[index];
+}
+
+template <typename T, size_t N>
+constexpr T & FixedVector<T, N>::front() noexcept {
+  return _data[0];
+}
+
+template <typename T, size_t N>
+constexpr const T & FixedVector<T, N>::front() const noexcept {
+  return _data[0];
+}
+
+template <typename T, size_t N>
+constexpr T & FixedVector<T, N>::back() noexcept {
+  return _data[_size - 1];
+}
+
+template <typename T, size_t N>
+constexpr const T & FixedVector<T, N>::back() const noexcept {
+  return _data[_size - 1];
+}
+
+template <typename T, size_t N>
+constexpr T * FixedVector<T, N>::data() noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+constexpr const T * FixedVector<T, N>::data() const noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::begin() noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::const_iterator FixedVector<T, N>::begin() const noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::end() noexcept {
+  return _data + _size;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::const_iterator FixedVector<T, N>::end() const noexcept {
+  return _data + _size;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::const_iterator FixedVector<T, N>::cbegin() const noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::const_iterator FixedVector<T, N>::cend() const noexcept {
+  return _data + _size;
+}
+
+template <typename T, size_t N>
+constexpr bool FixedVector<T, N>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <typename T, size_t N>
+constexpr bool FixedVector<T, N>::full() const noexcept {
+  return _size == N;
+}
+
+template <typename T, size_t N>
+constexpr size_t FixedVector<T, N>::size() const noexcept {
+  return _size;
+}
+
+template <typename T, size_t N>
+constexpr size_t FixedVector<T, N>::capacity() noexcept {
+  return N;
+}
+
+template <typename T, size_t N>
+constexpr size_t FixedVector<T, N>::max_size() noexcept {
+  return N;
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::clear() noexcept {
+  destroy(_data, _size);
+  _size = 0;
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::push_back(const T & value) noexcept {
+  emplace_back(value);
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::push_back(T && value) noexcept {
+  emplace_back(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr T & FixedVector<T, N>::emplace_back(Args &&... args) noexcept {
+  if (!checkRoom(1))
+    return _data[N - 1];
+
+  return *std::construct_at(_data + _size++, std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N>
+constexpr T * FixedVector<T, N>::try_push_back(const T & value) noexcept {
+  return try_emplace_back(value);
+}
+
+template <typename T, size_t N>
+constexpr T * FixedVector<T, N>::try_push_back(T && value) noexcept {
+  return try_emplace_back(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr T * FixedVector<T, N>::try_emplace_back(Args &&... args) noexcept {
+  if (_size == N)
+    return nullptr;
+
+  return std::construct_at(_data + _size++, std::forward<Args>(args)...);
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::pop_back() noexcept {
+  std::destroy_at(_data + --_size);
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::emplace(const_iterator position, Args &&... args) noexcept {
+  if (!checkRoom(1))
+    return end();
+
+  const size_t index = indexOf(position);
+
+  // Construct first: the arguments may refer to elements the shift below relocates
+  T value(std::forward<Args>(args)...);
+
+  relocate(_data + index + 1, _data + index, _size - index);
+  std::construct_at(_data + index, std::move(value));
+  ++_size;
+
+  return _data + index;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::insert(const_iterator position, const T & value) noexcept {
+  return emplace(position, value);
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::insert(const_iterator position, T && value) noexcept {
+  return emplace(position, std::move(value));
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::insert(const_iterator position, size_t count,
+                                                                const T & value) noexcept {
+  if (!checkRoom(count))
+    return end();
+
+  const size_t index = indexOf(position);
+  const T      copy(value);
+
+  relocate(_data + index + count, _data + index, _size - index);
+
+  for (size_t offset = 0; offset < count; ++offset)
+    std::construct_at(_data + index + offset, copy);
+
+  _size += count;
+
+  return _data + index;
+}
+
+template <typename T, size_t N>
+template <std::forward_iterator Iterator>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::insert(const_iterator position, Iterator first,
+                                                                Iterator last) noexcept {
+  const size_t index = indexOf(position);
+  const auto   count = static_cast<size_t>(std::distance(first, last));
+
+  if (!checkRoom(count))
+    return end();
+
+  relocate(_data + index + count, _data + index, _size - index);
+
+  if constexpr (std::is_pointer_v<Iterator>) {
+    copyConstruct(_data + index, first, count);
+  } else {
+    for (size_t offset = 0; first != last; ++first, ++offset)
+      std::construct_at(_data + index + offset, *first);
+  }
+
+  _size += count;
+
+  return _data + index;
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::insert(const_iterator position,
+                                                                std::initializer_list<T> values) noexcept {
+  return insert(position, values.begin(), values.end());
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::erase(const_iterator position) noexcept {
+  return erase(position, position + 1);
+}
+
+template <typename T, size_t N>
+constexpr FixedVector<T, N>::iterator FixedVector<T, N>::erase(const_iterator first, const_iterator last) noexcept {
+  const size_t index = indexOf(first);
+  const size_t count = indexOf(last) - index;
+
+  destroy(_data + index, count);
+  relocate(_data + index, _data + index + count, _size - index - count);
+  _size -= count;
+
+  return _data + index;
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::resize(size_t count) noexcept {
+  if (count <= _size) {
+    destroy(_data + count, _size - count);
+  } else {
+    if (!checkRoom(count - _size))
+      return;
+
+    for (size_t index = _size; index < count; ++index)
+      std::construct_at(_data + index);
+  }
+
+  _size = count;
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::resize(size_t count, const T & value) noexcept {
+  if (count <= _size) {
+    destroy(_data + count, _size - count);
+  } else {
+    if (!checkRoom(count - _size))
+      return;
+
+    for (size_t index = _size; index < count; ++index)
+      std::construct_at(_data + index, value);
+  }
+
+  _size = count;
+}
+
+template <typename T, size_t N>
+constexpr bool FixedVector<T, N>::checkRoom(size_t count) const noexcept {
+  if (count <= N - _size)
+    return true;
+
+  if consteval {
+    assertion::assertCompileTimeError();
+  } else {
+    assert_message(count <= N - _size, "fixed vector has no room for the new elements");
+  }
+
+  return false;
+}
+
+template <typename T, size_t N>
+constexpr size_t FixedVector<T, N>::indexOf(const_iterator position) const noexcept {
+  return static_cast<size_t>(position - _data);
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::copyConstruct(T * destination, const T * source, size_t count) noexcept {
+  if constexpr (std::is_trivially_copyable_v<T>) {
+    if !consteval {
+      if (count != 0)
+        std::memcpy(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(T));
+
+      return;
+    }
+  }
+
+  for (size_t index = 0; index < count; ++index)
+    std::construct_at(destination + index, source[index]);
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::relocate(T * destination, T * source, size_t count) noexcept {
+  if (count == 0 || destination == source)
+    return;
+
+  if constexpr (isTriviallyRelocatable<T>) {
+    if !consteval {
+      std::memmove(static_cast<void *>(destination), static_cast<const void *>(source), count * sizeof(T));
+
+      return;
+    }
+  }
+
+  // Walk away from the overlap so no source element is overwritten before it moves
+  if (destination < source) {
+    for (size_t index = 0; index < count; ++index) {
+      std::construct_at(destination + index, std::move(source[index]));
+      std::destroy_at(source + index);
+    }
+  } else {
+    for (size_t index = count; index-- > 0;) {
+      std::construct_at(destination + index, std::move(source[index]));
+      std::destroy_at(source + index);
+    }
+  }
+}
+
+template <typename T, size_t N>
+constexpr void FixedVector<T, N>::destroy(T * first, size_t count) noexcept {
+  if constexpr (!std::is_trivially_destructible_v<T>) {
+    for (size_t index = 0; index < count; ++index)
+      std::destroy_at(first + index);
+  }
+}
+
+template <typename T, size_t N, size_t M>
+constexpr bool operator==(const FixedVector<T, N> & left, const FixedVector<T, M> & right) noexcept {
+  if (left.size() != right.size())
+    return false;
+
+  for (size_t index = 0; index < left.size(); ++index) {
+    if (!(left[index] == right[index]))
+      return false;
+  }
+
+  return true;
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FIXED_VECTOR_INL_
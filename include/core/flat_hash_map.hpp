@@ -0,0 +1,412 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   flat_hash_map.hpp
+  \brief  Fixed-capacity open-addressing hash map.
+
+  Declares \ref toy::FlatHashMap, the engine's associative container for lookup tables on hot paths (sprites by
+  identifier, tiles by grid cell), and \ref toy::HashProbing, which selects its collision strategy. Definitions live in
+  flat_hash_map.inl.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FLAT_HASH_MAP_HPP_
+#define INCLUDE_CORE_FLAT_HASH_MAP_HPP_
+
+namespace toy {
+
+/// Collision strategy of \ref toy::FlatHashMap.
+enum class HashProbing : uint8_t {
+  /// SwissTable layout: one control byte per slot holding a 7-bit hash tag, matched a group of slots at a time
+  Groups,
+
+  /// Robin Hood linear probing: one byte per slot holding its probe distance, with backward-shift erase
+  RobinHood,
+};
+
+/// Probing of the target: control-byte groups where SSE2 or NEON can match them, Robin Hood elsewhere.
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__aarch64__)          \
+  || defined(_M_ARM64)
+inline constexpr HashProbing c_defaultHashProbing = HashProbing::Groups;
+#else
+inline constexpr HashProbing c_defaultHashProbing = HashProbing::RobinHood;
+#endif
+
+/*!
+  \brief Open-addressing hash map with a fixed number of slots and no heap allocation.
+
+  Entries live in one flat array of slots next to an array of one control byte per slot, so a lookup touches the
+  control bytes and then, usually, a single entry. The capacity never changes: insertion fails, returning end(), when
+  the map holds max_size() entries.
+
+  \a Probing selects how collisions are resolved:
+  - HashProbing::Groups compares a 7-bit tag against a whole group of control bytes with one SSE2 or NEON instruction
+    (16 or 8 slots; 8 with a portable word-at-a-time fallback), and erases with tombstones. Tombstones are purged in
+    place when they use up the free slots.
+  - HashProbing::RobinHood keeps entries ordered by probe distance, so a miss stops early, and erases by shifting the
+    following entries back. It needs no vector unit.
+
+  Storage is either inline, when \a N is a power of two, or supplied by the caller, when \a N is 0, as a buffer or as
+  an allocator:
+
+  \code
+  toy::FlatHashMap<toy::StringId, SpriteHandle, 1024> sprites; // inline, 1024 slots
+
+  alignas(TileMap::c_storageAlignment) std::byte storage[TileMap::storageSize(4096)];
+  TileMap tiles(storage, 4096); // with using TileMap = toy::FlatHashMap<uint32_t, TileIndex>;
+
+  TileMap visited(frameMemory, 256); // storage from an allocator, such as a toy::FrameAllocator
+  \endcode
+
+  Any insertion or erasure may move entries to other slots and invalidates iterators and references to entries.
+
+  \tparam Key     Key type; hashed by \a Hash and compared with \a Equal.
+  \tparam Value   Mapped type.
+  \tparam N       Number of inline slots, a power of two and at least 16, or 0 for caller-supplied storage.
+  \tparam Hash    Hash function object returning \c uint64_t; see \ref toy::Hasher.
+  \tparam Equal   Key equality function object.
+  \tparam Probing Collision strategy.
+*/
+template <typename Key, typename Value, size_t N = 0, typename Hash = Hasher<Key>, typename Equal = std::equal_to<Key>,
+          HashProbing Probing = c_defaultHashProbing>
+class FlatHashMap {
+  static_assert(N == 0 || (std::has_single_bit(N) && N >= 16), "FlatHashMap capacity must be a power of two >= 16");
+
+public:
+  /// Key and mapped value stored in one slot; the key must not be modified through an iterator.
+  struct Entry {
+    /// Constructs the key from \a entryKey and the value from \a arguments.
+    template <typename EntryKey, typename... Args>
+      requires(!std::is_same_v<std::remove_cvref_t<EntryKey>, Entry>)
+    Entry(EntryKey && entryKey, Args &&... arguments) noexcept;
+
+    /// Key of the entry
+    Key key;
+
+    /// Mapped value of the entry
+    Value value;
+  };
+
+  /// Key type
+  using key_type = Key;
+
+  /// Mapped type
+  using mapped_type = Value;
+
+  /// Stored element type
+  using value_type = Entry;
+
+  /// Type of sizes
+  using size_type = size_t;
+
+  /// Forward iterator over the entries, in slot order.
+  template <bool IsConst>
+  class Iterator {
+  public:
+    /// Iterated element type
+    using value_type = Entry;
+
+    /// Type of iterator differences
+    using difference_type = std::ptrdiff_t;
+
+    /// Entry pointer type
+    using pointer = std::conditional_t<IsConst, const Entry *, Entry *>;
+
+    /// Entry reference type
+    using reference = std::conditional_t<IsConst, const Entry &, Entry &>;
+
+    /// Iterator category
+    using iterator_category = std::forward_iterator_tag;
+
+    /// Constructs a singular iterator.
+    Iterator() noexcept = default;
+
+    /// Copies an iterator; declared because the converting constructor below is a copy constructor when mutable.
+    Iterator(const Iterator & other) noexcept = default;
+
+    /// Copies an iterator position.
+    Iterator & operator=(const Iterator & other) noexcept = default;
+
+    /// Converts a mutable iterator to a read-only one.
+    Iterator(const Iterator<false> & other) noexcept
+      requires(IsConst);
+
+    /// Returns the current entry.
+    [[nodiscard]] reference operator*() const noexcept;
+
+    /// Returns the current entry.
+    [[nodiscard]] pointer operator->() const noexcept;
+
+    /// Advances to the next entry.
+    Iterator & operator++() noexcept;
+
+    /// Advances to the next entry and returns the previous position.
+    Iterator operator++(int) noexcept;
+
+    /// Compares iterator positions.
+    [[nodiscard]] bool operator==(const Iterator & other) const noexcept = default;
+
+  private:
+    friend class FlatHashMap;
+
+    template <bool>
+    friend class Iterator;
+
+    /// Points at the first occupied slot at or after \a index.
+    Iterator(const FlatHashMap * map, size_t index) noexcept;
+
+    /// Iterated map
+    const FlatHashMap * _map{nullptr};
+
+    /// Current slot
+    size_t _index{0};
+  };
+
+  /// Mutable entry iterator
+  using iterator = Iterator<false>;
+
+  /// Read-only entry iterator
+  using const_iterator = Iterator<true>;
+
+  /// Required alignment of caller-supplied storage
+  static constexpr size_t c_storageAlignment = alignof(Entry);
+
+  /// Returns the bytes of caller-supplied storage a map of \a capacity slots needs.
+  [[nodiscard]] static constexpr size_t storageSize(size_t capacity) noexcept;
+
+  /// Constructs an empty map over its inline slots.
+  FlatHashMap() noexcept
+    requires(N != 0);
+
+  /*!
+    \brief Constructs an empty map over caller-supplied storage.
+
+    \param storage  At least storageSize(\a capacity) bytes aligned to \ref c_storageAlignment. It must outlive the map.
+    \param capacity Number of slots; a power of two and at least 16.
+  */
+  FlatHashMap(void * storage, size_t capacity) noexcept
+    requires(N == 0);
+
+  /*!
+    \brief Constructs an empty map over storage taken from \a allocator.
+
+    The map never gives the storage back, so this suits allocators that free in bulk, such as
+    \ref toy::LinearAllocator and \ref toy::FrameAllocator: a per-frame lookup table then costs one pointer bump.
+
+    \pre \a allocator has storageSize(\a capacity) bytes left; it must outlive the map.
+
+    \param allocator Source of the storage.
+    \param capacity  Number of slots; a power of two and at least 16.
+  */
+  template <Allocator Arena>
+  FlatHashMap(Arena & allocator, size_t capacity) noexcept
+    requires(N == 0);
+
+  FlatHashMap(const FlatHashMap &) = delete;
+
+  FlatHashMap & operator=(const FlatHashMap &) = delete;
+
+  /// Destroys the entries.
+  ~FlatHashMap() noexcept;
+
+  /// Returns an iterator to the first entry.
+  [[nodiscard]] iterator begin() noexcept;
+
+  /// Returns an iterator to the first entry.
+  [[nodiscard]] const_iterator begin() const noexcept;
+
+  /// Returns an iterator past the last entry.
+  [[nodiscard]] iterator end() noexcept;
+
+  /// Returns an iterator past the last entry.
+  [[nodiscard]] const_iterator end() const noexcept;
+
+  /// Checks whether the map has no entries.
+  [[nodiscard]] bool empty() const noexcept;
+
+  /// Returns the number of entries.
+  [[nodiscard]] size_t size() const noexcept;
+
+  /// Returns the number of slots.
+  [[nodiscard]] size_t capacity() const noexcept;
+
+  /// Returns the most entries the map can hold: fifteen sixteenths of the slots.
+  [[nodiscard]] size_t max_size() const noexcept;
+
+  /// Returns the entry with key \a key, or end().
+  [[nodiscard]] iterator find(const Key & key) noexcept;
+
+  /// Returns the entry with key \a key, or end().
+  [[nodiscard]] const_iterator find(const Key & key) const noexcept;
+
+  /// Checks whether an entry with key \a key exists.
+  [[nodiscard]] bool contains(const Key & key) const noexcept;
+
+  /*!
+    \brief Inserts an entry with key \a key and a value constructed from \a arguments, unless the key exists.
+
+    \return The entry with key \a key and whether it was inserted. When the key is absent and the map is full, or no
+    slot lies close enough to the key's home slot, the iterator is end() and nothing is constructed.
+  */
+  template <typename KeyArgument, typename... Args>
+  std::pair<iterator, bool> try_emplace(KeyArgument && key, Args &&... arguments) noexcept;
+
+  /// Inserts a copy of \a entry unless its key exists; see try_emplace().
+  std::pair<iterator, bool> insert(const Entry & entry) noexcept;
+
+  /// Inserts or overwrites the value of key \a key; see try_emplace().
+  template <typename KeyArgument, typename MappedArgument>
+  std::pair<iterator, bool> insert_or_assign(KeyArgument && key, MappedArgument && value) noexcept;
+
+  /// Removes the entry at \a position; the iterator must refer to an entry.
+  void erase(const_iterator position) noexcept;
+
+  /// Removes the entry with key \a key, returning the number of entries removed.
+  size_t erase(const Key & key) noexcept;
+
+  /// Removes every entry.
+  void clear() noexcept;
+
+private:
+  /// Slots compared at once by group probing: 16 with SSE2, 8 with NEON and the portable word-at-a-time code
+  static constexpr size_t c_groupWidth =
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    16;
+#else
+    8;
+#endif
+
+  /// Group probing control byte of a never-used slot
+  static constexpr uint8_t c_empty = 0x80;
+
+  /// Group probing control byte of an erased slot (tombstone)
+  static constexpr uint8_t c_deleted = 0xFE;
+
+  /// Largest Robin Hood control byte: the longest probe distance plus one
+  static constexpr size_t c_maxDistance = 255;
+
+  /*!
+    \brief The control bytes of one group of slots, for group probing.
+
+    The masks returned by match(), matchEmpty(), and matchFree() have one set bit per matching slot, in slot order;
+    slotOf() converts the lowest set bit to a slot offset in the group.
+  */
+  class Group {
+  public:
+    /// Loads the group of control bytes starting at \a control.
+    explicit Group(const uint8_t * control) noexcept;
+
+    /// Slots whose tag is \a tag; the portable form may report false positives after a true match.
+    [[nodiscard]] uint64_t match(uint8_t tag) const noexcept;
+
+    /// Never-used slots.
+    [[nodiscard]] uint64_t matchEmpty() const noexcept;
+
+    /// Never-used or erased slots.
+    [[nodiscard]] uint64_t matchFree() const noexcept;
+
+    /// Returns the slot offset of the lowest set bit of \a mask.
+    [[nodiscard]] static size_t slotOf(uint64_t mask) noexcept;
+
+    /// Returns the number of slots above the highest set bit of \a mask.
+    [[nodiscard]] static size_t leadingSlots(uint64_t mask) noexcept;
+
+  private:
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    __m128i _bytes;
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    uint8x8_t _bytes;
+#else
+    uint64_t _bytes;
+#endif
+  };
+
+  /// Bytes of caller-supplied storage for \a capacity slots, entries first.
+  [[nodiscard]] static constexpr size_t entriesSize(size_t capacity) noexcept;
+
+  /// Inline storage, or nothing when the caller supplies it.
+  struct InlineStorage {
+    alignas(Entry) std::byte entries[N * sizeof(Entry)];
+    uint8_t control[N + c_groupWidth];
+  };
+
+  struct NoStorage {};
+
+  /// Points the map at \a entries and \a control and marks every slot unused.
+  void attach(void * entries, uint8_t * control, size_t capacity) noexcept;
+
+  /// Returns the hash of \a key.
+  [[nodiscard]] uint64_t hashOf(const Key & key) const noexcept;
+
+  /// Returns the slot holding \a key, whose hash is \a hash, or the capacity when none does.
+  [[nodiscard]] size_t findIndex(const Key & key, uint64_t hash) const noexcept;
+
+  /// Returns the first never-used or erased slot on the group probe sequence of \a hash.
+  [[nodiscard]] size_t findFreeSlot(uint64_t hash) const noexcept;
+
+  /// Sets a group probing control byte and its mirror past the end.
+  void setControl(size_t index, uint8_t control) noexcept;
+
+  /// Reuses erased slots: rehashes every entry in place, without extra storage.
+  void purgeTombstones() noexcept;
+
+  /// Finds or makes the slot for a new entry with hash \a hash; returns the capacity when none is available.
+  [[nodiscard]] size_t prepareInsert(uint64_t hash) noexcept;
+
+  /// Removes the entry in slot \a index.
+  void eraseIndex(size_t index) noexcept;
+
+  /// Moves the entry in slot \a from to the unused slot \a to.
+  void relocateEntry(size_t to, size_t from) noexcept;
+
+  /// Returns the first occupied slot at or after \a index, or the capacity.
+  [[nodiscard]] size_t nextOccupied(size_t index) const noexcept;
+
+  /// Checks whether slot \a index holds an entry.
+  [[nodiscard]] bool isOccupied(size_t index) const noexcept;
+
+  [[no_unique_address]] std::conditional_t<N != 0, InlineStorage, NoStorage> _storage;
+
+  /// Hash function object
+  [[no_unique_address]] Hash _hash;
+
+  /// Key equality function object
+  [[no_unique_address]] Equal _equal;
+
+  /// Slot array
+  Entry * _entries{nullptr};
+
+  /// Control bytes: group tags or Robin Hood distances, followed by mirrors of the first group
+  uint8_t * _control{nullptr};
+
+  /// Slot count minus one
+  size_t _mask{0};
+
+  /// Number of entries
+  size_t _size{0};
+
+  /// Group probing insertions left before erased slots must be purged
+  size_t _growthLeft{0};
+};
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FLAT_HASH_MAP_HPP_
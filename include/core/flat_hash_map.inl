@@ -0,0 +1,568 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   flat_hash_map.inl
+  \brief  Inline definitions for \ref toy::FlatHashMap.
+
+  Both probing strategies share the slot and control arrays; each member picks its strategy with \c if \c constexpr.
+  Group probing takes its 7-bit tag from the low bits of the hash and the home slot from the rest. Robin Hood probing
+  uses the same home slot.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FLAT_HASH_MAP_INL_
+#define INCLUDE_CORE_FLAT_HASH_MAP_INL_
+
+namespace toy {
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <typename EntryKey, typename... Args>
+  requires(!std::is_same_v<std::remove_cvref_t<EntryKey>, typename FlatHashMap<Key, Value, N, Hash, Equal,
+                                                                               Probing>::Entry>)
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Entry::Entry(EntryKey && entryKey, Args &&... arguments) noexcept
+  : key(std::forward<EntryKey>(entryKey))
+  , value(std::forward<Args>(arguments)...) {}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <bool IsConst>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Iterator<IsConst>::Iterator(const Iterator<false> & other) noexcept
+  requires(IsConst)
+  : _map(other._map)
+  , _index(other._index) {}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <bool IsConst>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Iterator<IsConst>::operator*() const noexcept -> reference {
+  return _map->_entries[_index];
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <bool IsConst>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Iterator<IsConst>::operator->() const noexcept -> pointer {
+  return _map->_entries + _index;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <bool IsConst>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Iterator<IsConst>::operator++() noexcept -> Iterator & {
+  _index = _map->nextOccupied(_index + 1);
+
+  return *this;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <bool IsConst>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Iterator<IsConst>::operator++(int) noexcept -> Iterator {
+  Iterator previous = *this;
+  ++*this;
+
+  return previous;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <bool IsConst>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Iterator<IsConst>::Iterator(const FlatHashMap * map,
+                                                                              size_t index) noexcept
+  : _map(map)
+  , _index(map->nextOccupied(index)) {}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+constexpr size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::storageSize(size_t capacity) noexcept {
+  return entriesSize(capacity) + capacity + c_groupWidth;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::FlatHashMap() noexcept
+  requires(N != 0)
+{
+  attach(_storage.entries, _storage.control, N);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::FlatHashMap(void * storage, size_t capacity) noexcept
+  requires(N == 0)
+{
+  attach(storage, static_cast<uint8_t *>(storage) + entriesSize(capacity), capacity);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <Allocator Arena>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::FlatHashMap(Arena & allocator, size_t capacity) noexcept
+  requires(N == 0)
+  : FlatHashMap(allocator.allocate(storageSize(capacity), c_storageAlignment), capacity) {}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::~FlatHashMap() noexcept {
+  clear();
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::begin() noexcept -> iterator {
+  return iterator(this, 0);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::begin() const noexcept -> const_iterator {
+  return const_iterator(this, 0);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::end() noexcept -> iterator {
+  return iterator(this, capacity());
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::end() const noexcept -> const_iterator {
+  return const_iterator(this, capacity());
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+bool FlatHashMap<Key, Value, N, Hash, Equal, Probing>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::size() const noexcept {
+  return _size;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::capacity() const noexcept {
+  return _mask + 1;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::max_size() const noexcept {
+  // Keeps at least one never-used slot, which ends every group probe sequence
+  return capacity() - capacity() / 16;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::find(const Key & key) noexcept -> iterator {
+  return iterator(this, findIndex(key, hashOf(key)));
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::find(const Key & key) const noexcept -> const_iterator {
+  return const_iterator(this, findIndex(key, hashOf(key)));
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+bool FlatHashMap<Key, Value, N, Hash, Equal, Probing>::contains(const Key & key) const noexcept {
+  return findIndex(key, hashOf(key)) != capacity();
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <typename KeyArgument, typename... Args>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::try_emplace(KeyArgument && key, Args &&... arguments) noexcept
+  -> std::pair<iterator, bool> {
+  const Key &    lookupKey = key;
+  const uint64_t hash      = hashOf(lookupKey);
+  size_t         index     = findIndex(lookupKey, hash);
+
+  if (index != capacity())
+    return {iterator(this, index), false};
+
+  index = prepareInsert(hash);
+
+  if (index == capacity())
+    return {end(), false};
+
+  std::construct_at(_entries + index, std::forward<KeyArgument>(key), std::forward<Args>(arguments)...);
+  ++_size;
+
+  return {iterator(this, index), true};
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::insert(const Entry & entry) noexcept
+  -> std::pair<iterator, bool> {
+  return try_emplace(entry.key, entry.value);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+template <typename KeyArgument, typename MappedArgument>
+auto FlatHashMap<Key, Value, N, Hash, Equal, Probing>::insert_or_assign(KeyArgument && key,
+                                                                        MappedArgument && value) noexcept
+  -> std::pair<iterator, bool> {
+  auto result = try_emplace(std::forward<KeyArgument>(key), std::forward<MappedArgument>(value));
+
+  // Not inserted because the key exists: the value was not consumed and overwrites the old one
+  if (!result.second && result.first != end())
+    result.first->value = std::forward<MappedArgument>(value);
+
+  return result;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::erase(const_iterator position) noexcept {
+  eraseIndex(position._index);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::erase(const Key & key) noexcept {
+  const size_t index = findIndex(key, hashOf(key));
+
+  if (index == capacity())
+    return 0;
+
+  eraseIndex(index);
+
+  return 1;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::clear() noexcept {
+  if constexpr (!std::is_trivially_destructible_v<Entry>) {
+    for (size_t index = nextOccupied(0); index < capacity(); index = nextOccupied(index + 1))
+      std::destroy_at(_entries + index);
+  }
+
+  std::memset(_control, Probing == HashProbing::Groups ? c_empty : 0, capacity() + c_groupWidth);
+  _size       = 0;
+  _growthLeft = max_size();
+}
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::Group(const uint8_t * control) noexcept
+  : _bytes(_mm_loadu_si128(reinterpret_cast<const __m128i *>(control))) {}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::match(uint8_t tag) const noexcept {
+  const __m128i matches = _mm_cmpeq_epi8(_mm_set1_epi8(static_cast<char>(tag)), _bytes);
+
+  return static_cast<uint16_t>(_mm_movemask_epi8(matches));
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::matchEmpty() const noexcept {
+  return match(c_empty);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::matchFree() const noexcept {
+  // Free control bytes are the only ones below -1 as signed bytes
+  return static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), _bytes)));
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::slotOf(uint64_t mask) noexcept {
+  return static_cast<size_t>(std::countr_zero(mask));
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::leadingSlots(uint64_t mask) noexcept {
+  return static_cast<size_t>(std::countl_zero(mask)) - (64 - c_groupWidth);
+}
+
+#else
+
+// One control byte per byte of a 64-bit word; a match sets the high bit of its byte
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::Group(const uint8_t * control) noexcept
+#if defined(__aarch64__) || defined(_M_ARM64)
+  : _bytes(vld1_u8(control)) {
+}
+#else
+  : _bytes(hashing::read64(reinterpret_cast<const char *>(control))) {
+}
+#endif
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::match(uint8_t tag) const noexcept {
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return vget_lane_u64(vreinterpret_u64_u8(vceq_u8(_bytes, vdup_n_u8(tag))), 0) & 0x8080808080808080U;
+#else
+  const uint64_t difference = _bytes ^ (0x0101010101010101U * tag);
+
+  return (difference - 0x0101010101010101U) & ~difference & 0x8080808080808080U;
+#endif
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::matchEmpty() const noexcept {
+#if defined(__aarch64__) || defined(_M_ARM64)
+  return match(c_empty);
+#else
+  // Only the empty byte has bit 7 set and bit 1 clear
+  return _bytes & ~(_bytes << 6) & 0x8080808080808080U;
+#endif
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::matchFree() const noexcept {
+#if defined(__aarch64__) || defined(_M_ARM64)
+  const uint8x8_t free = vclt_s8(vreinterpret_s8_u8(_bytes), vdup_n_s8(-1));
+
+  return vget_lane_u64(vreinterpret_u64_u8(free), 0) & 0x8080808080808080U;
+#else
+  // Only the empty and deleted bytes have bit 7 set and bit 0 clear
+  return _bytes & ~(_bytes << 7) & 0x8080808080808080U;
+#endif
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::slotOf(uint64_t mask) noexcept {
+  return static_cast<size_t>(std::countr_zero(mask)) >> 3;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::Group::leadingSlots(uint64_t mask) noexcept {
+  return static_cast<size_t>(std::countl_zero(mask)) >> 3;
+}
+
+#endif
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+constexpr size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::entriesSize(size_t capacity) noexcept {
+  return capacity * sizeof(Entry);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::attach(void * entries, uint8_t * control,
+                                                              size_t capacity) noexcept {
+  _entries = static_cast<Entry *>(entries);
+  _control = control;
+  _mask    = capacity - 1;
+
+  std::memset(_control, Probing == HashProbing::Groups ? c_empty : 0, capacity + c_groupWidth);
+  _size       = 0;
+  _growthLeft = max_size();
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+uint64_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::hashOf(const Key & key) const noexcept {
+  return static_cast<uint64_t>(_hash(key));
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::findIndex(const Key & key, uint64_t hash) const noexcept {
+  if constexpr (Probing == HashProbing::Groups) {
+    const auto tag    = static_cast<uint8_t>(hash & 0x7F);
+    size_t     offset = static_cast<size_t>(hash >> 7) & _mask;
+
+    // Triangular steps over group-sized windows visit every slot of a power-of-two table
+    for (size_t step = c_groupWidth;; step += c_groupWidth) {
+      const Group group(_control + offset);
+
+      for (uint64_t matches = group.match(tag); matches != 0; matches &= matches - 1) {
+        const size_t index = (offset + Group::slotOf(matches)) & _mask;
+
+        if (_equal(_entries[index].key, key))
+          return index;
+      }
+
+      if (group.matchEmpty() != 0)
+        return capacity();
+
+      offset = (offset + step) & _mask;
+    }
+  } else {
+    size_t index = static_cast<size_t>(hash >> 7) & _mask;
+
+    // Entries sit in order of probe distance, so the first slot closer to its home than we are ends the search
+    for (size_t distance = 1;; ++distance) {
+      const size_t control = _control[index];
+
+      if (control < distance)
+        return capacity();
+
+      if (control == distance && _equal(_entries[index].key, key))
+        return index;
+
+      index = (index + 1) & _mask;
+    }
+  }
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::findFreeSlot(uint64_t hash) const noexcept {
+  size_t offset = static_cast<size_t>(hash >> 7) & _mask;
+
+  for (size_t step = c_groupWidth;; step += c_groupWidth) {
+    const uint64_t free = Group(_control + offset).matchFree();
+
+    if (free != 0)
+      return (offset + Group::slotOf(free)) & _mask;
+
+    offset = (offset + step) & _mask;
+  }
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::setControl(size_t index, uint8_t control) noexcept {
+  _control[index] = control;
+
+  // Group loads near the end read past the last slot, into mirrors of the first group
+  if (index < c_groupWidth)
+    _control[capacity() + index] = control;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::purgeTombstones() noexcept {
+  const size_t slots = capacity();
+
+  // Tombstones become free, entries become "deleted" until they are placed again
+  for (size_t index = 0; index < slots; ++index) {
+    const uint8_t control = _control[index];
+
+    _control[index] = control == c_deleted ? c_empty : (control & 0x80) == 0 ? c_deleted : control;
+  }
+
+  std::memcpy(_control + slots, _control, c_groupWidth);
+
+  for (size_t index = 0; index < slots; ++index) {
+    if (_control[index] != c_deleted)
+      continue;
+
+    const uint64_t hash   = hashOf(_entries[index].key);
+    const auto     tag    = static_cast<uint8_t>(hash & 0x7F);
+    const size_t   home   = static_cast<size_t>(hash >> 7) & _mask;
+    const size_t   target = findFreeSlot(hash);
+
+    // Already in the first window its probe sequence reaches with room: the entry stays
+    if (((index - home) & _mask) / c_groupWidth == ((target - home) & _mask) / c_groupWidth) {
+      setControl(index, tag);
+    } else if (_control[target] == c_empty) {
+      relocateEntry(target, index);
+      setControl(target, tag);
+      setControl(index, c_empty);
+    } else {
+      // The target holds another entry waiting to be placed: swap and place that one from this slot next
+      std::swap(_entries[index], _entries[target]);
+      setControl(target, tag);
+      --index;
+    }
+  }
+
+  _growthLeft = max_size() - _size;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::prepareInsert(uint64_t hash) noexcept {
+  if (_size >= max_size())
+    return capacity();
+
+  if constexpr (Probing == HashProbing::Groups) {
+    size_t index = findFreeSlot(hash);
+
+    if (_growthLeft == 0 && _control[index] == c_empty) {
+      purgeTombstones();
+      index = findFreeSlot(hash);
+    }
+
+    if (_control[index] == c_empty)
+      --_growthLeft;
+
+    setControl(index, static_cast<uint8_t>(hash & 0x7F));
+
+    return index;
+  } else {
+    size_t index    = static_cast<size_t>(hash >> 7) & _mask;
+    size_t distance = 1;
+
+    // The new entry takes the first slot whose entry is closer to its home, and pushes the run after it along
+    while (_control[index] >= distance) {
+      index = (index + 1) & _mask;
+      ++distance;
+    }
+
+    if (distance > c_maxDistance)
+      return capacity();
+
+    size_t last = index;
+
+    for (; _control[last] != 0; last = (last + 1) & _mask) {
+      if (_control[last] == c_maxDistance)
+        return capacity();
+    }
+
+    while (last != index) {
+      const size_t previous = (last - 1) & _mask;
+
+      relocateEntry(last, previous);
+      _control[last] = static_cast<uint8_t>(_control[previous] + 1);
+      last           = previous;
+    }
+
+    _control[index] = static_cast<uint8_t>(distance);
+
+    return index;
+  }
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::eraseIndex(size_t index) noexcept {
+  std::destroy_at(_entries + index);
+  --_size;
+
+  if constexpr (Probing == HashProbing::Groups) {
+    // No probe ever passed a slot with a free slot within one group width on both sides, so it can become free
+    const uint64_t emptyAfter  = Group(_control + index).matchEmpty();
+    const uint64_t emptyBefore = Group(_control + ((index - c_groupWidth) & _mask)).matchEmpty();
+
+    if (emptyBefore != 0 && emptyAfter != 0
+        && Group::slotOf(emptyAfter) + Group::leadingSlots(emptyBefore) < c_groupWidth) {
+      setControl(index, c_empty);
+      ++_growthLeft;
+    } else {
+      setControl(index, c_deleted);
+    }
+  } else {
+    // Backward shift: pull every following displaced entry one slot closer to its home
+    for (size_t next = (index + 1) & _mask; _control[next] > 1; next = (next + 1) & _mask) {
+      relocateEntry(index, next);
+      _control[index] = static_cast<uint8_t>(_control[next] - 1);
+      index           = next;
+    }
+
+    _control[index] = 0;
+  }
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+void FlatHashMap<Key, Value, N, Hash, Equal, Probing>::relocateEntry(size_t to, size_t from) noexcept {
+  std::construct_at(_entries + to, std::move(_entries[from]));
+  std::destroy_at(_entries + from);
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+size_t FlatHashMap<Key, Value, N, Hash, Equal, Probing>::nextOccupied(size_t index) const noexcept {
+  while (index < capacity() && !isOccupied(index))
+    ++index;
+
+  return index;
+}
+
+template <typename Key, typename Value, size_t N, typename Hash, typename Equal, HashProbing Probing>
+bool FlatHashMap<Key, Value, N, Hash, Equal, Probing>::isOccupied(size_t index) const noexcept {
+  if constexpr (Probing == HashProbing::Groups)
+    return (_control[index] & 0x80) == 0;
+  else
+    return _control[index] != 0;
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FLAT_HASH_MAP_INL_
@@ -0,0 +1,323 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   format.hpp
+  \brief  Allocation-free text formatting with format strings checked at compile time.
+
+  Declares formatTo(), format(), and formattedSize(), which accept the \c std::format syntax for the argument types
+  the engine prints: \c bool, characters, integers, \c float and \c double, strings, and untyped pointers. The format
+  string is parsed when the call is compiled, so a malformed field, an argument index out of range, or a presentation
+  type that does not fit the argument fails the build. Output goes straight into a caller buffer or a
+  \ref toy::FixedString; nothing allocates and no locale is consulted.
+
+  Every call lowers its arguments to an array of type-erased values and runs one non-template engine, so adding format
+  calls adds little code: a concern on the cartridge targets, where \c std::format does not fit.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FORMAT_HPP_
+#define INCLUDE_CORE_FORMAT_HPP_
+
+/*!
+  \namespace toy::formatting
+
+  \brief Format string parsing and the type-erased arguments shared by the compile-time check and the runtime engine.
+
+  The compile-time check and format.cpp parse replacement fields with the same \c constexpr code declared here, so
+  the two cannot disagree on what a format string means. Engine code calls formatTo() or format() instead.
+*/
+namespace toy::formatting {
+
+/// Category of a format argument; selects the presentation types a replacement field may use.
+enum class ArgumentKind : uint8_t {
+  /// Not formattable
+  None,
+
+  /// \c bool
+  Bool,
+
+  /// \c char
+  Char,
+
+  /// Signed integer, widened to \c int64_t
+  Signed,
+
+  /// Unsigned integer, widened to \c uint64_t
+  Unsigned,
+
+  /// \c float
+  Float,
+
+  /// \c double
+  Double,
+
+  /// Character sequence: anything convertible to \c string_view, including string literals and \ref toy::FixedString
+  String,
+
+  /// \c void pointer or \c nullptr
+  Pointer,
+};
+
+/// Alignment of a replacement field within its width.
+enum class Alignment : uint8_t {
+  /// Type default: numbers right, text left
+  Default,
+
+  /// \c <
+  Left,
+
+  /// \c ^
+  Center,
+
+  /// \c >
+  Right,
+};
+
+/// Parsed format specification of one replacement field: <tt>[[fill]align][sign][#][0][width][.precision][type]</tt>.
+struct Specification {
+  /// Padding character; a single byte
+  char fill{' '};
+
+  /// Alignment within the width
+  Alignment align{Alignment::Default};
+
+  /// Sign policy of numbers: \c '-', \c '+', or \c ' '
+  char sign{'-'};
+
+  /// \c # given: base prefix for integers
+  bool alternate{false};
+
+  /// \c 0 given: pad numbers with zeros after the sign and prefix
+  bool zeroPad{false};
+
+  /// Presentation type character, or \c '\0' for the default
+  char type{'\0'};
+
+  /// Minimum field width, in code points
+  uint16_t width{0};
+
+  /// Precision, or -1 when not given
+  int32_t precision{-1};
+};
+
+/// Largest width or string precision a specification accepts
+inline constexpr uint32_t c_maxWidth = 0xFFFF;
+
+/// Largest precision accepted for floating-point arguments, bounding the digits a field can produce
+inline constexpr int32_t c_maxFloatPrecision = 64;
+
+/// Returns the argument category of \a T, or ArgumentKind::None when \a T cannot be formatted.
+template <typename T>
+[[nodiscard]] consteval ArgumentKind kindOf() noexcept;
+
+/*!
+  \brief Parses the format specification starting at \a cursor, stopping at the closing brace.
+
+  \param cursor        First character after the colon; on success, left at the closing \c '}'.
+  \param end           End of the format string.
+  \param specification Receives the parsed fields.
+
+  \return \c false when the specification is malformed or uses something outside the supported subset.
+*/
+[[nodiscard]] constexpr bool parseSpecification(const char *& cursor, const char * end,
+                                                Specification & specification) noexcept;
+
+/// Checks whether \a specification suits an argument of category \a kind, as \c std::format would.
+[[nodiscard]] constexpr bool isValidSpecification(const Specification & specification, ArgumentKind kind) noexcept;
+
+/*!
+  \brief Checks a whole format string against the categories of its arguments.
+
+  \param format Format string.
+  \param kinds  Category of each argument; may be \c nullptr when \a count is 0.
+  \param count  Number of arguments.
+
+  \return \c true when every replacement field is well-formed, refers to an existing argument, and suits it, and the
+  fields number their arguments either all automatically or all manually.
+*/
+[[nodiscard]] constexpr bool isValidFormat(string_view format, const ArgumentKind * kinds, size_t count) noexcept;
+
+/// Characters of a string argument, stored without the \c string_view constructor so the union below stays trivial.
+struct StringArgument {
+  /// First character
+  const char * data;
+
+  /// Number of characters
+  size_t size;
+};
+
+/// One format argument, type-erased into a category and a value.
+struct Argument {
+  /// Category; selects the active member below
+  ArgumentKind kind{ArgumentKind::None};
+
+  union {
+    /// Value of Bool, Char, and Unsigned arguments
+    uint64_t unsignedValue{0};
+
+    /// Value of Signed arguments
+    int64_t signedValue;
+
+    /// Value of Float arguments
+    float floatValue;
+
+    /// Value of Double arguments
+    double doubleValue;
+
+    /// Value of Pointer arguments
+    const void * pointerValue;
+
+    /// Value of String arguments
+    StringArgument stringValue;
+  };
+};
+
+/// Type-erases \a value; \a T must be formattable.
+template <typename T>
+[[nodiscard]] constexpr Argument makeArgument(const T & value) noexcept;
+
+/*!
+  \brief Formats arguments with a format string already checked by isValidFormat().
+
+  \param buffer    Destination; may be \c nullptr when \a capacity is 0.
+  \param capacity  Characters \a buffer can hold. Output past it is counted but not written.
+  \param format    Format string.
+  \param arguments Arguments the format string refers to.
+
+  \return Number of characters of the complete output, which may exceed \a capacity.
+*/
+[[nodiscard]] size_t formatArguments(char * buffer, size_t capacity, string_view format,
+                                     const Argument * arguments) noexcept;
+
+} // namespace toy::formatting
+
+namespace toy {
+
+/// Argument types formatTo() and format() accept.
+template <typename T>
+concept Formattable = formatting::kindOf<T>() != formatting::ArgumentKind::None;
+
+/*!
+  \brief Format string checked at compile time against the argument types \a Args.
+
+  Constructed implicitly from a string literal or any constant string in a call to formatTo(), format(), or
+  formattedSize(). The constructor is \c consteval: a format string that does not fit \a Args fails the build through
+  assertion::assertCompileTimeError().
+
+  Supported syntax, a subset of \c std::format:
+  - \c {{ and \c }} for literal braces;
+  - replacement fields <tt>{[index][:spec]}</tt>, numbered automatically or by explicit indices, but not both;
+  - <tt>[[fill]align][sign][#][0][width][.precision][type]</tt> with a single-byte fill;
+  - types \c s for \c bool and strings, \c c for characters, \c b \c B \c d \c o \c x \c X for integers, \c a \c A
+    \c e \c E \c f \c F \c g \c G for floating point, and \c p for pointers.
+
+  Not supported: widths and precisions taken from arguments (<tt>{:{}}</tt>), the locale flag \c L, \c # on floating
+  point, the debug type \c ?, and floating-point precisions above formatting::c_maxFloatPrecision.
+
+  \tparam Args Argument types, without references and cv-qualifiers.
+*/
+template <typename... Args>
+class FormatString {
+public:
+  /// Checks \a format against \a Args during compilation.
+  template <typename String>
+    requires std::is_convertible_v<const String &, string_view>
+  consteval FormatString(const String & format) noexcept;
+
+  /// Returns the format string.
+  [[nodiscard]] constexpr string_view view() const noexcept;
+
+private:
+  /// Format string
+  string_view _format;
+};
+
+/// Format string for arguments deduced from the call, as \c std::format_string is.
+template <typename... Args>
+using FormatStringOf = FormatString<std::type_identity_t<Args>...>;
+
+/*!
+  \brief Formats arguments into a character buffer, as \c std::format_to_n does.
+
+  \code
+  char line[64];
+  const size_t size = toy::formatTo(line, sizeof(line), "{:>8} {:6.2f} ms", name, milliseconds);
+  \endcode
+
+  \param buffer     Destination; may be \c nullptr when \a capacity is 0.
+  \param capacity   Characters \a buffer can hold. Output past it is dropped; no terminator is written.
+  \param format     Format string, checked at compile time.
+  \param arguments  Values the format string refers to.
+
+  \return Number of characters of the complete output. A value above \a capacity means the output was truncated.
+*/
+template <Formattable... Args>
+size_t formatTo(char * buffer, size_t capacity, FormatStringOf<Args...> format, const Args &... arguments) noexcept;
+
+/*!
+  \brief Appends formatted arguments to a fixed string; characters past its capacity are dropped.
+
+  \param string    String to append to.
+  \param format    Format string, checked at compile time.
+  \param arguments Values the format string refers to.
+
+  \return \a string.
+*/
+template <size_t N, Formattable... Args>
+FixedString<N> & formatTo(FixedString<N> & string, FormatStringOf<Args...> format, const Args &... arguments) noexcept;
+
+/*!
+  \brief Returns formatted arguments as a fixed string of capacity \a N; characters past it are dropped.
+
+  \code
+  hud.setText(toy::format<32>("Score {:06}", score));
+  \endcode
+*/
+template <size_t N, Formattable... Args>
+[[nodiscard]] FixedString<N> format(FormatStringOf<Args...> format, const Args &... arguments) noexcept;
+
+/*!
+  \brief Formats arguments into memory from \a allocator and returns the text, followed by a null character.
+
+  Output up to 256 characters is formatted once into a stack buffer and copied into a single allocation of its exact
+  size; longer output is formatted a second time, in place. With a \ref toy::FrameAllocator, a per-frame label costs
+  one pointer bump and is freed with the frame.
+
+  \code
+  const toy::string_view label = toy::format(frameMemory, "{} x{}", item.name, item.count);
+  \endcode
+
+  \param allocator Source of the memory; it owns the text, which is never given back by this function.
+  \param format    Format string, checked at compile time.
+  \param arguments Values the format string refers to.
+
+  \return Formatted text; empty when the allocator has no room for it.
+*/
+template <Allocator Arena, Formattable... Args>
+[[nodiscard]] string_view format(Arena & allocator, FormatStringOf<Args...> format, const Args &... arguments) noexcept;
+
+/// Returns the number of characters formatTo() would produce, without writing them.
+template <Formattable... Args>
+[[nodiscard]] size_t formattedSize(FormatStringOf<Args...> format, const Args &... arguments) noexcept;
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FORMAT_HPP_
@@ -0,0 +1,369 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   format.inl
+  \brief  Inline definitions for the format string check and the formatting entry points.
+
+  The format string grammar is written once here as \c constexpr code: FormatString runs it during compilation, and
+  the runtime engine in format.cpp reuses parseSpecification() on strings that already passed the check.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_FORMAT_INL_
+#define INCLUDE_CORE_FORMAT_INL_
+
+namespace toy::formatting {
+
+template <typename T>
+consteval ArgumentKind kindOf() noexcept {
+  using Type = std::remove_cvref_t<T>;
+
+  if constexpr (std::is_same_v<Type, bool>) {
+    return ArgumentKind::Bool;
+  } else if constexpr (std::is_same_v<Type, char>) {
+    return ArgumentKind::Char;
+  } else if constexpr (std::is_same_v<Type, wchar_t> || std::is_same_v<Type, char8_t>
+                       || std::is_same_v<Type, char16_t> || std::is_same_v<Type, char32_t>) {
+    return ArgumentKind::None;
+  } else if constexpr (std::is_integral_v<Type> && sizeof(Type) <= sizeof(uint64_t)) {
+    return std::is_signed_v<Type> ? ArgumentKind::Signed : ArgumentKind::Unsigned;
+  } else if constexpr (std::is_same_v<Type, float>) {
+    return ArgumentKind::Float;
+  } else if constexpr (std::is_same_v<Type, double>) {
+    return ArgumentKind::Double;
+  } else if constexpr (std::is_null_pointer_v<Type>
+                       || (std::is_pointer_v<Type> && std::is_void_v<std::remove_pointer_t<Type>>)) {
+    return ArgumentKind::Pointer;
+  } else if constexpr (std::is_convertible_v<const Type &, string_view>) {
+    return ArgumentKind::String;
+  } else {
+    return ArgumentKind::None;
+  }
+}
+
+constexpr bool parseSpecification(const char *& cursor, const char * end, Specification & specification) noexcept {
+  constexpr auto alignmentOf = [](char character) noexcept {
+    switch (character) {
+      case '<':
+        return Alignment::Left;
+      case '^':
+        return Alignment::Center;
+      case '>':
+        return Alignment::Right;
+      default:
+        return Alignment::Default;
+    }
+  };
+
+  // Reads a decimal number no larger than c_maxWidth
+  constexpr auto parseNumber = [](const char *& position, const char * last, uint32_t & value) noexcept {
+    value = 0;
+
+    for (; position != last && *position >= '0' && *position <= '9'; ++position) {
+      value = value * 10 + static_cast<uint32_t>(*position - '0');
+
+      if (value > c_maxWidth)
+        return false;
+    }
+
+    return true;
+  };
+
+  if (cursor == end)
+    return false;
+
+  if (end - cursor >= 2 && alignmentOf(cursor[1]) != Alignment::Default) {
+    // Fill and align; the fill is a single byte other than a brace
+    if (cursor[0] == '{' || cursor[0] == '}' || static_cast<uint8_t>(cursor[0]) >= 0x80)
+      return false;
+
+    specification.fill  = cursor[0];
+    specification.align = alignmentOf(cursor[1]);
+    cursor += 2;
+  } else if (alignmentOf(cursor[0]) != Alignment::Default) {
+    specification.align = alignmentOf(cursor[0]);
+    ++cursor;
+  }
+
+  if (cursor != end && (*cursor == '+' || *cursor == '-' || *cursor == ' '))
+    specification.sign = *cursor++;
+
+  if (cursor != end && *cursor == '#') {
+    specification.alternate = true;
+    ++cursor;
+  }
+
+  if (cursor != end && *cursor == '0') {
+    specification.zeroPad = true;
+    ++cursor;
+  }
+
+  uint32_t number = 0;
+
+  if (!parseNumber(cursor, end, number))
+    return false;
+
+  specification.width = static_cast<uint16_t>(number);
+
+  if (cursor != end && *cursor == '.') {
+    ++cursor;
+
+    if (cursor == end || *cursor < '0' || *cursor > '9' || !parseNumber(cursor, end, number))
+      return false;
+
+    specification.precision = static_cast<int32_t>(number);
+  }
+
+  if (cursor != end && *cursor != '}') {
+    if (string_view("sbBcdoxXaAeEfFgGp").find(*cursor) == string_view::npos)
+      return false;
+
+    specification.type = *cursor++;
+  }
+
+  return cursor != end && *cursor == '}';
+}
+
+constexpr bool isValidSpecification(const Specification & specification, ArgumentKind kind) noexcept {
+  const char type         = specification.type;
+  const bool numericFlags = specification.sign != '-' || specification.alternate || specification.zeroPad;
+
+  const auto isIntegerType = [type] {
+    return type != '\0' && string_view("bBcdoxX").find(type) != string_view::npos;
+  };
+
+  // Integer presentations: no precision, and the character presentation takes no sign, prefix, or zero padding
+  const auto isValidInteger = [&] {
+    return specification.precision < 0 && !(type == 'c' && numericFlags);
+  };
+
+  // Text presentations: no sign, prefix, or zero padding
+  const auto isValidText = [&] {
+    return !numericFlags;
+  };
+
+  switch (kind) {
+    case ArgumentKind::Bool:
+      if (type == '\0' || type == 's')
+        return isValidText() && specification.precision < 0;
+
+      return isIntegerType() && isValidInteger();
+    case ArgumentKind::Char:
+      if (type == '\0' || type == 'c')
+        return isValidText() && specification.precision < 0;
+
+      return isIntegerType() && isValidInteger();
+    case ArgumentKind::Signed:
+    case ArgumentKind::Unsigned:
+      return (type == '\0' || isIntegerType()) && isValidInteger();
+    case ArgumentKind::Float:
+    case ArgumentKind::Double:
+      return (type == '\0' || string_view("aAeEfFgG").find(type) != string_view::npos) && !specification.alternate
+          && specification.precision <= c_maxFloatPrecision;
+    case ArgumentKind::String:
+      return (type == '\0' || type == 's') && isValidText();
+    case ArgumentKind::Pointer:
+      return (type == '\0' || type == 'p') && specification.sign == '-' && !specification.alternate
+          && specification.precision < 0;
+    case ArgumentKind::None:
+      break;
+  }
+
+  return false;
+}
+
+constexpr bool isValidFormat(string_view format, const ArgumentKind * kinds, size_t count) noexcept {
+  const char * cursor    = format.data();
+  const char * end       = cursor + format.size();
+  size_t       next      = 0;
+  bool         automatic = false;
+  bool         manual    = false;
+
+  while (cursor != end) {
+    if (*cursor == '}') {
+      if (end - cursor < 2 || cursor[1] != '}')
+        return false;
+
+      cursor += 2;
+      continue;
+    }
+
+    if (*cursor != '{') {
+      ++cursor;
+      continue;
+    }
+
+    if (end - cursor >= 2 && cursor[1] == '{') {
+      cursor += 2;
+      continue;
+    }
+
+    ++cursor;
+
+    size_t index = 0;
+
+    if (cursor != end && *cursor >= '0' && *cursor <= '9') {
+      // Argument indices have no leading zeros, as in std::format
+      if (*cursor == '0' && end - cursor >= 2 && cursor[1] >= '0' && cursor[1] <= '9')
+        return false;
+
+      for (; cursor != end && *cursor >= '0' && *cursor <= '9'; ++cursor) {
+        index = index * 10 + static_cast<size_t>(*cursor - '0');
+
+        if (index >= count)
+          return false;
+      }
+
+      manual = true;
+    } else {
+      index     = next++;
+      automatic = true;
+    }
+
+    if ((automatic && manual) || index >= count)
+      return false;
+
+    Specification specification;
+
+    if (cursor != end && *cursor == ':') {
+      ++cursor;
+
+      if (!parseSpecification(cursor, end, specification))
+        return false;
+    }
+
+    if (cursor == end || *cursor != '}' || !isValidSpecification(specification, kinds[index]))
+      return false;
+
+    ++cursor;
+  }
+
+  return true;
+}
+
+template <typename T>
+constexpr Argument makeArgument(const T & value) noexcept {
+  constexpr ArgumentKind kind = kindOf<T>();
+
+  Argument argument;
+  argument.kind = kind;
+
+  if constexpr (kind == ArgumentKind::Bool) {
+    argument.unsignedValue = value ? 1U : 0U;
+  } else if constexpr (kind == ArgumentKind::Char) {
+    argument.unsignedValue = static_cast<uint8_t>(value);
+  } else if constexpr (kind == ArgumentKind::Signed) {
+    argument.signedValue = static_cast<int64_t>(value);
+  } else if constexpr (kind == ArgumentKind::Unsigned) {
+    argument.unsignedValue = static_cast<uint64_t>(value);
+  } else if constexpr (kind == ArgumentKind::Float) {
+    argument.floatValue = value;
+  } else if constexpr (kind == ArgumentKind::Double) {
+    argument.doubleValue = value;
+  } else if constexpr (kind == ArgumentKind::Pointer) {
+    argument.pointerValue = value;
+  } else {
+    const string_view text(value);
+
+    argument.stringValue = {text.data(), text.size()};
+  }
+
+  return argument;
+}
+
+} // namespace toy::formatting
+
+namespace toy {
+
+template <typename... Args>
+template <typename String>
+  requires std::is_convertible_v<const String &, string_view>
+consteval FormatString<Args...>::FormatString(const String & format) noexcept
+  : _format(format) {
+  constexpr array<formatting::ArgumentKind, sizeof...(Args)> kinds{formatting::kindOf<Args>()...};
+
+  if (!formatting::isValidFormat(_format, kinds.data(), kinds.size()))
+    assertion::assertCompileTimeError();
+}
+
+template <typename... Args>
+constexpr string_view FormatString<Args...>::view() const noexcept {
+  return _format;
+}
+
+template <Formattable... Args>
+size_t formatTo(char * buffer, size_t capacity, FormatStringOf<Args...> format, const Args &... arguments) noexcept {
+  const array<formatting::Argument, sizeof...(Args)> erased{formatting::makeArgument(arguments)...};
+
+  return formatting::formatArguments(buffer, capacity, format.view(), erased.data());
+}
+
+template <size_t N, Formattable... Args>
+FixedString<N> & formatTo(FixedString<N> & string, FormatStringOf<Args...> format, const Args &... arguments) noexcept {
+  const array<formatting::Argument, sizeof...(Args)> erased{formatting::makeArgument(arguments)...};
+  const size_t                                       used = string.size();
+
+  string.resize_and_overwrite(N, [&](char * data, size_t count) noexcept {
+    const size_t room = count - used;
+    const size_t size = formatting::formatArguments(data + used, room, format.view(), erased.data());
+
+    return used + (size < room ? size : room);
+  });
+
+  return string;
+}
+
+template <size_t N, Formattable... Args>
+FixedString<N> format(FormatStringOf<Args...> format, const Args &... arguments) noexcept {
+  FixedString<N> result;
+  formatTo(result, format, arguments...);
+
+  return result;
+}
+
+template <Allocator Arena, Formattable... Args>
+string_view format(Arena & allocator, FormatStringOf<Args...> format, const Args &... arguments) noexcept {
+  const array<formatting::Argument, sizeof...(Args)> erased{formatting::makeArgument(arguments)...};
+  char                                               scratch[256];
+  const size_t size = formatting::formatArguments(scratch, sizeof(scratch), format.view(), erased.data());
+  auto *       text = static_cast<char *>(allocator.allocate(size + 1, alignof(char)));
+
+  if (text == nullptr)
+    return {};
+
+  if (size <= sizeof(scratch))
+    std::memcpy(text, scratch, size);
+  else
+    static_cast<void>(formatting::formatArguments(text, size, format.view(), erased.data()));
+
+  text[size] = '\0';
+
+  return {text, size};
+}
+
+template <Formattable... Args>
+size_t formattedSize(FormatStringOf<Args...> format, const Args &... arguments) noexcept {
+  return formatTo(nullptr, 0, format, arguments...);
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_FORMAT_INL_
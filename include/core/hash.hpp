@@ -0,0 +1,316 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   hash.hpp
+  \brief  Non-cryptographic hashing and compile-time string identifiers.
+
+  Declares the two hash families of namespace \ref toy and \ref toy::StringId, which is built on them:
+
+  - fnv1a32() and fnv1a64(), the classic byte-at-a-time FNV-1a hashes. They are small enough for any target and stable
+    across versions, so they suit identifiers stored in data files.
+  - hash64() and hashBuffer64(), a 64-bit hash in the wyhash and XXH3 family. Inputs up to 256 bytes go through a
+    multiply-and-fold chain that handles 16 bytes per step. Longer buffers accumulate 64-byte stripes in eight 64-bit
+    lanes, which desktop builds run with SSE2, AVX2, or NEON. The scalar form of that loop is
+    \ref toy::scalar::hashBuffer64().
+
+  Every hash reads its input as little-endian, so a value computed at build time on a desktop matches the one computed
+  at runtime on a big-endian console. The \c string_view overloads are \c constexpr and give the same result at compile
+  time as at runtime.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_HASH_HPP_
+#define INCLUDE_CORE_HASH_HPP_
+
+namespace toy {
+
+/*!
+  \brief Returns the 32-bit FNV-1a hash of a string.
+
+  \param text String to hash; its bytes are taken as unsigned.
+
+  \return Hash of \a text; 0x811C9DC5 for an empty string.
+*/
+[[nodiscard]] constexpr uint32_t fnv1a32(string_view text) noexcept;
+
+/*!
+  \brief Returns the 64-bit FNV-1a hash of a string.
+
+  \param text String to hash; its bytes are taken as unsigned.
+
+  \return Hash of \a text; 0xCBF29CE484222325 for an empty string.
+*/
+[[nodiscard]] constexpr uint64_t fnv1a64(string_view text) noexcept;
+
+/*!
+  \brief Returns the 64-bit hash of a string.
+
+  During constant evaluation it computes the hash inline. At runtime it calls the buffer overload, which takes the
+  vector path for long input. Both give the same value.
+
+  \param text String to hash.
+  \param seed Value that selects an independent hash function; 0 for \ref toy::StringId.
+
+  \return Hash of \a text.
+*/
+[[nodiscard]] constexpr uint64_t hash64(string_view text, uint64_t seed = 0) noexcept;
+
+/*!
+  \brief Returns the 64-bit hash of a memory buffer.
+
+  \param data Buffer to hash; may be \c nullptr when \a size is 0.
+  \param size Buffer size in bytes.
+  \param seed Value that selects an independent hash function.
+
+  \return Hash of the buffer; equal to hash64(string_view, uint64_t) of the same bytes.
+*/
+[[nodiscard]] uint64_t hashBuffer64(const void * data, size_t size, uint64_t seed = 0) noexcept;
+
+namespace scalar {
+
+/// Stripe-loop hash64() without vector instructions; same contract and result
+[[nodiscard]] uint64_t hashBuffer64(const void * data, size_t size, uint64_t seed = 0) noexcept;
+
+} // namespace scalar
+
+/*!
+  \namespace toy::hashing
+
+  \brief Building blocks shared by the compile-time and runtime forms of hash64().
+
+  The vector path in hash.cpp reuses the short-input chain, the constants, and the final merge declared here, so the
+  two forms cannot drift apart. Engine code calls hash64() instead.
+*/
+namespace hashing {
+
+/// Mixing constants; every byte has four bits set
+inline constexpr array<uint64_t, 8> c_secret{0xC69571D8CCCC552DU, 0x4E27356365AAC633U, 0x1B2B72A347F04E71U,
+                                             0xAA5A7827661D564BU, 0x53C6B2B23395D227U, 0x724B53A66533D187U,
+                                             0x658D65653395D11BU, 0xA31EAA5353697869U};
+
+/// Starting values of the eight stripe accumulators
+inline constexpr array<uint64_t, 8> c_initialAccumulators{0x00000000C2B2AE3DU, 0x9E3779B185EBCA87U, 0xC2B2AE3D27D4EB4FU,
+                                                          0x165667B19E3779F9U, 0x85EBCA77C2B2AE63U, 0x0000000085EBCA77U,
+                                                          0x27D4EB2F165667C5U, 0x000000009E3779B1U};
+
+/// 32-bit multiplier of the accumulator scramble, small enough for a vector 32 x 32 -> 64 bit multiply
+inline constexpr uint64_t c_scramblePrime = 0x9E3779B1U;
+
+/// Bytes consumed by one stripe of the long-input loop
+inline constexpr size_t c_stripeSize = 64;
+
+/// Stripes between two accumulator scrambles
+inline constexpr size_t c_stripesPerBlock = 16;
+
+/// Longest input hashed by the short chain; longer input goes through the stripe loop
+inline constexpr size_t c_longThreshold = 256;
+
+/// Reads 8 bytes as a little-endian value.
+[[nodiscard]] constexpr uint64_t read64(const char * data) noexcept;
+
+/// Reads 4 bytes as a little-endian value.
+[[nodiscard]] constexpr uint64_t read32(const char * data) noexcept;
+
+/// Replaces \a left and \a right with the low and high halves of their 128-bit product.
+constexpr void multiply(uint64_t & left, uint64_t & right) noexcept;
+
+/// Folds the 128-bit product of two values into 64 bits.
+[[nodiscard]] constexpr uint64_t mix(uint64_t left, uint64_t right) noexcept;
+
+/// Returns the initial chain state for \a seed.
+[[nodiscard]] constexpr uint64_t seedState(uint64_t seed) noexcept;
+
+/// Hashes input of at most \ref c_longThreshold bytes from chain state \a state.
+[[nodiscard]] constexpr uint64_t hashShort(const char * data, size_t size, uint64_t state) noexcept;
+
+/// Adds one stripe to the accumulators; \a keys are the secret lanes offset by the chain state.
+constexpr void accumulate(array<uint64_t, 8> & accumulators, const char * stripe,
+                          const array<uint64_t, 8> & keys) noexcept;
+
+/// Scrambles the accumulators at the end of a block.
+constexpr void scramble(array<uint64_t, 8> & accumulators, const array<uint64_t, 8> & keys) noexcept;
+
+/// Folds the accumulators and the last 16 bytes of the input into the final hash.
+[[nodiscard]] constexpr uint64_t merge(const array<uint64_t, 8> & accumulators, const char * data, size_t size,
+                                       uint64_t state) noexcept;
+
+/// Hashes input longer than \ref c_longThreshold bytes with the scalar stripe loop.
+[[nodiscard]] constexpr uint64_t hashLong(const char * data, size_t size, uint64_t state) noexcept;
+
+/// Hashes any input with the scalar code; the reference for every other form of hash64().
+[[nodiscard]] constexpr uint64_t hashBytes(const char * data, size_t size, uint64_t seed) noexcept;
+
+} // namespace hashing
+
+/*!
+  \brief Integer identifier of a name, for comparisons in hot code.
+
+  Holds hash64() of the name. Names written in source become identifiers at compile time, so comparing them costs one
+  integer comparison:
+
+  \code
+  using namespace toy::literals;
+
+  if (event.id == "player_died"_sid)
+    respawn();
+  \endcode
+
+  Names known only at runtime go through internString(). In debug builds it also records the name, and
+  internedName() maps the identifier back to it for logs and tools. An identifier built at compile time becomes
+  readable as soon as the same name is interned once at runtime, for example when an asset manifest is loaded.
+
+  A default-constructed identifier has the value 0 and stands for no name.
+*/
+class StringId {
+public:
+  /// Constructs the empty identifier.
+  constexpr StringId() noexcept = default;
+
+  /// Hashes \a name at compile time.
+  consteval StringId(string_view name) noexcept;
+
+  /// Wraps an identifier value, such as one read from a data file.
+  constexpr explicit StringId(uint64_t value) noexcept;
+
+  /// Returns the identifier value.
+  [[nodiscard]] constexpr uint64_t value() const noexcept;
+
+  /// Checks whether the identifier refers to a name.
+  constexpr explicit operator bool() const noexcept;
+
+  /// Compares identifier values.
+  [[nodiscard]] constexpr bool operator==(const StringId & other) const noexcept = default;
+
+  /// Orders identifier values; the order is stable but unrelated to the names.
+  [[nodiscard]] constexpr auto operator<=>(const StringId & other) const noexcept = default;
+
+private:
+  /// Hash of the name, or 0
+  uint64_t _value{0};
+};
+
+#ifdef _DEBUG
+
+/*!
+  \brief Returns the identifier of a runtime name and records the name for internedName().
+
+  The first name recorded for an identifier wins; a later name with the same hash is not stored.
+
+  \param name Name to identify.
+
+  \return Identifier equal to the one \a name gives at compile time.
+
+  \note Thread-safe. Declared only when \c _DEBUG is defined; other builds compile the inline definition below, which
+  only hashes.
+*/
+[[nodiscard]] StringId internString(string_view name) noexcept;
+
+/*!
+  \brief Returns the name recorded for an identifier.
+
+  \param id Identifier to look up.
+
+  \return The name passed to internString() for \a id, or an empty view when none was recorded. The view stays valid
+  until the program exits.
+
+  \note Thread-safe. Declared only when \c _DEBUG is defined; other builds always return an empty view.
+*/
+[[nodiscard]] string_view internedName(StringId id) noexcept;
+
+#else // _DEBUG
+
+/// Returns the identifier of a runtime name; builds without \c _DEBUG keep no record of the name.
+[[nodiscard]] inline StringId internString(string_view name) noexcept {
+  return StringId(hash64(name));
+}
+
+/// Returns an empty view; names are recorded only when \c _DEBUG is defined.
+[[nodiscard]] inline string_view internedName([[maybe_unused]] StringId id) noexcept {
+  return {};
+}
+
+#endif // _DEBUG
+
+/*!
+  \namespace toy::literals
+
+  \brief User-defined literals of the core module.
+*/
+namespace literals {
+
+/// Returns the identifier of a name literal at compile time.
+[[nodiscard]] consteval StringId operator""_sid(const char * name, size_t size) noexcept;
+
+} // namespace literals
+
+/*!
+  \brief Hash function object of the engine's hash containers.
+
+  Defined for integers, enumerations, pointers, \c string_view, \ref toy::FixedString, and \ref toy::StringId; other
+  key types add a specialization. Integers and pointers go through a 128-bit multiply so every result bit depends on
+  every key bit: \ref toy::FlatHashMap takes a 7-bit tag from the low bits and the bucket from the rest, and raw
+  integers such as aligned addresses or grid coordinates would crowd both.
+
+  \tparam T Key type.
+*/
+template <typename T>
+struct Hasher;
+
+/// Hasher for integers, enumerations, and pointers.
+template <typename T>
+  requires std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>
+struct Hasher<T> {
+  /// Returns the mixed bits of \a value.
+  [[nodiscard]] uint64_t operator()(T value) const noexcept;
+};
+
+/// Hasher for strings; equal to hash64().
+template <>
+struct Hasher<string_view> {
+  /// Returns hash64() of \a text.
+  [[nodiscard]] uint64_t operator()(string_view text) const noexcept;
+};
+
+/// Hasher for fixed strings; equal to the \c string_view hasher of the same characters.
+template <size_t N>
+struct Hasher<FixedString<N>> {
+  /// Returns hash64() of \a text.
+  [[nodiscard]] uint64_t operator()(const FixedString<N> & text) const noexcept;
+};
+
+/// Hasher for string identifiers, which are already hashes.
+template <>
+struct Hasher<StringId> {
+  /// Returns the value of \a id unchanged.
+  [[nodiscard]] uint64_t operator()(StringId id) const noexcept;
+};
+
+} // namespace toy
+
+/// Hashes \ref toy::StringId by its value, which is already a hash.
+template <>
+struct std::hash<toy::StringId> {
+  [[nodiscard]] size_t operator()(const toy::StringId & id) const noexcept {
+    return static_cast<size_t>(id.value());
+  }
+};
+
+#endif // INCLUDE_CORE_HASH_HPP_
@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   hash.inl
+  \brief  Inline definitions for the hashes and \ref toy::StringId.
+
+  The scalar form of hash64() is written once here as \c constexpr code, so constant evaluation, retro targets, and the
+  short-input path of the vector build all run the same arithmetic.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_HASH_INL_
+#define INCLUDE_CORE_HASH_INL_
+
+namespace toy {
+
+constexpr uint32_t fnv1a32(string_view text) noexcept {
+  uint32_t hash = 0x811C9DC5U;
+
+  for (const char character : text) {
+    hash ^= static_cast<uint8_t>(character);
+    hash *= 0x01000193U;
+  }
+
+  return hash;
+}
+
+constexpr uint64_t fnv1a64(string_view text) noexcept {
+  uint64_t hash = 0xCBF29CE484222325U;
+
+  for (const char character : text) {
+    hash ^= static_cast<uint8_t>(character);
+    hash *= 0x00000100000001B3U;
+  }
+
+  return hash;
+}
+
+constexpr uint64_t hash64(string_view text, uint64_t seed) noexcept {
+  if consteval {
+    return hashing::hashBytes(text.data(), text.size(), seed);
+  } else {
+    return hashBuffer64(text.data(), text.size(), seed);
+  }
+}
+
+namespace hashing {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 Product;
+#endif
+
+constexpr uint64_t read64(const char * data) noexcept {
+  if !consteval {
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+
+    if constexpr (std::endian::native == std::endian::big)
+      value = std::byteswap(value);
+
+    return value;
+  }
+
+  uint64_t value = 0;
+
+  for (size_t index = 0; index < 8; ++index)
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[index])) << (index * 8);
+
+  return value;
+}
+
+constexpr uint64_t read32(const char * data) noexcept {
+  if !consteval {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+
+    if constexpr (std::endian::native == std::endian::big)
+      value = std::byteswap(value);
+
+    return value;
+  }
+
+  uint64_t value = 0;
+
+  for (size_t index = 0; index < 4; ++index)
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[index])) << (index * 8);
+
+  return value;
+}
+
+constexpr void multiply(uint64_t & left, uint64_t & right) noexcept {
+#if defined(__SIZEOF_INT128__)
+  const Product product = static_cast<Product>(left) * right;
+
+  left  = static_cast<uint64_t>(product);
+  right = static_cast<uint64_t>(product >> 64);
+#else
+  // Schoolbook product of 32-bit halves for targets without a 128-bit integer type
+  const uint64_t lowLow   = (left & 0xFFFFFFFFU) * (right & 0xFFFFFFFFU);
+  const uint64_t highLow  = (left >> 32) * (right & 0xFFFFFFFFU);
+  const uint64_t lowHigh  = (left & 0xFFFFFFFFU) * (right >> 32);
+  const uint64_t highHigh = (left >> 32) * (right >> 32);
+  const uint64_t cross    = (lowLow >> 32) + (highLow & 0xFFFFFFFFU) + lowHigh;
+
+  left  = (cross << 32) | (lowLow & 0xFFFFFFFFU);
+  right = (highLow >> 32) + (cross >> 32) + highHigh;
+#endif
+}
+
+constexpr uint64_t mix(uint64_t left, uint64_t right) noexcept {
+  multiply(left, right);
+
+  return left ^ right;
+}
+
+constexpr uint64_t seedState(uint64_t seed) noexcept {
+  return seed ^ mix(seed ^ c_secret[0], c_secret[1]);
+}
+
+constexpr uint64_t hashShort(const char * data, size_t size, uint64_t state) noexcept {
+  uint64_t left  = 0;
+  uint64_t right = 0;
+
+  if (size <= 16) {
+    if (size >= 4) {
+      // Two overlapping pairs of 4-byte reads cover every length from 4 to 16
+      const size_t offset = (size >> 3) << 2;
+
+      left  = (read32(data) << 32) | read32(data + offset);
+      right = (read32(data + size - 4) << 32) | read32(data + size - 4 - offset);
+    } else if (size > 0) {
+      left = (static_cast<uint64_t>(static_cast<uint8_t>(data[0])) << 16)
+           | (static_cast<uint64_t>(static_cast<uint8_t>(data[size >> 1])) << 8)
+           | static_cast<uint8_t>(data[size - 1]);
+    }
+  } else {
+    size_t remaining = size;
+
+    if (remaining > 48) {
+      // Three independent chains keep the multipliers busy
+      uint64_t second = state;
+      uint64_t third  = state;
+
+      do {
+        state  = mix(read64(data) ^ c_secret[1], read64(data + 8) ^ state);
+        second = mix(read64(data + 16) ^ c_secret[2], read64(data + 24) ^ second);
+        third  = mix(read64(data + 32) ^ c_secret[3], read64(data + 40) ^ third);
+
+        data      += 48;
+        remaining -= 48;
+      } while (remaining > 48);
+
+      state ^= second ^ third;
+    }
+
+    while (remaining > 16) {
+      state = mix(read64(data) ^ c_secret[1], read64(data + 8) ^ state);
+
+      data      += 16;
+      remaining -= 16;
+    }
+
+    // The last 16 bytes of the input, overlapping the chain when the length is not a multiple of 16
+    left  = read64(data + remaining - 16);
+    right = read64(data + remaining - 8);
+  }
+
+  left  ^= c_secret[1];
+  right ^= state;
+  multiply(left, right);
+
+  return mix(left ^ c_secret[0] ^ size, right ^ c_secret[1]);
+}
+
+constexpr void accumulate(array<uint64_t, 8> & accumulators, const char * stripe,
+                          const array<uint64_t, 8> & keys) noexcept {
+  for (size_t lane = 0; lane < 8; ++lane) {
+    const uint64_t value = read64(stripe + lane * 8);
+    const uint64_t keyed = value ^ keys[lane];
+
+    accumulators[lane ^ 1] += value;
+    accumulators[lane]     += (keyed & 0xFFFFFFFFU) * (keyed >> 32);
+  }
+}
+
+constexpr void scramble(array<uint64_t, 8> & accumulators, const array<uint64_t, 8> & keys) noexcept {
+  for (size_t lane = 0; lane < 8; ++lane) {
+    uint64_t accumulator = accumulators[lane];
+
+    accumulator ^= accumulator >> 47;
+    accumulator ^= keys[lane];
+
+    accumulators[lane] = accumulator * c_scramblePrime;
+  }
+}
+
+constexpr uint64_t merge(const array<uint64_t, 8> & accumulators, const char * data, size_t size,
+                         uint64_t state) noexcept {
+  for (size_t lane = 0; lane < 8; lane += 2)
+    state = mix(accumulators[lane] ^ c_secret[lane], accumulators[lane + 1] ^ state);
+
+  uint64_t left  = read64(data + size - 16) ^ c_secret[1];
+  uint64_t right = read64(data + size - 8) ^ state;
+  multiply(left, right);
+
+  return mix(left ^ c_secret[0] ^ size, right ^ c_secret[1]);
+}
+
+constexpr uint64_t hashLong(const char * data, size_t size, uint64_t state) noexcept {
+  array<uint64_t, 8> accumulators = c_initialAccumulators;
+  array<uint64_t, 8> keys{};
+
+  for (size_t lane = 0; lane < 8; ++lane)
+    keys[lane] = c_secret[lane] + state;
+
+  // Every stripe but the last; the last one is read flush with the end of the input and may overlap
+  const size_t stripes = (size - 1) / c_stripeSize;
+
+  for (size_t stripe = 0; stripe < stripes; ++stripe) {
+    accumulate(accumulators, data + stripe * c_stripeSize, keys);
+
+    if ((stripe + 1) % c_stripesPerBlock == 0)
+      scramble(accumulators, keys);
+  }
+
+  accumulate(accumulators, data + size - c_stripeSize, keys);
+
+  return merge(accumulators, data, size, state);
+}
+
+constexpr uint64_t hashBytes(const char * data, size_t size, uint64_t seed) noexcept {
+  const uint64_t state = seedState(seed);
+
+  return size <= c_longThreshold ? hashShort(data, size, state) : hashLong(data, size, state);
+}
+
+} // namespace hashing
+
+consteval StringId::StringId(string_view name) noexcept
+  : _value(hash64(name)) {}
+
+constexpr StringId::StringId(uint64_t value) noexcept
+  : _value(value) {}
+
+constexpr uint64_t StringId::value() const noexcept {
+  return _value;
+}
+
+constexpr StringId::operator bool() const noexcept {
+  return _value != 0;
+}
+
+namespace literals {
+
+consteval StringId operator""_sid(const char * name, size_t size) noexcept {
+  return StringId(string_view(name, size));
+}
+
+} // namespace literals
+
+template <typename T>
+  requires std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>
+inline uint64_t Hasher<T>::operator()(T value) const noexcept {
+  uint64_t bits;
+
+  if constexpr (std::is_pointer_v<T>)
+    bits = reinterpret_cast<uintptr_t>(value);
+  else if constexpr (std::is_enum_v<T>)
+    bits = static_cast<uint64_t>(std::to_underlying(value));
+  else
+    bits = static_cast<uint64_t>(value);
+
+  return hashing::mix(bits ^ hashing::c_secret[0], hashing::c_secret[1]);
+}
+
+inline uint64_t Hasher<string_view>::operator()(string_view text) const noexcept {
+  return hash64(text);
+}
+
+template <size_t N>
+inline uint64_t Hasher<FixedString<N>>::operator()(const FixedString<N> & text) const noexcept {
+  return hash64(text.view());
+}
+
+inline uint64_t Hasher<StringId>::operator()(StringId id) const noexcept {
+  return id.value();
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_HASH_INL_
@@ -0,0 +1,164 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   jobs.hpp
+  \brief  Work-stealing job system with counters for fork-join.
+
+  Declares namespace \ref toy::jobs. Definitions of the templates live in jobs.inl, the scheduler in jobs.cpp.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_JOBS_HPP_
+#define INCLUDE_CORE_JOBS_HPP_
+
+/*!
+  \namespace toy::jobs
+
+  \brief Parallel execution of short jobs on worker threads.
+
+  Every thread that runs jobs owns a Chase-Lev deque: it pushes and pops its own jobs at the bottom, without locks.
+  Idle threads steal from the top of the others' deques. Workers that find nothing to steal sleep until new jobs
+  arrive. A group of jobs shares a \ref toy::jobs::Counter, and wait() runs queued jobs on the waiting thread until
+  the counter reaches zero, so the main thread works instead of blocking. Jobs may start jobs of their own and wait
+  for them, which gives fork-join.
+
+  Desktop builds start the workers in initialize(). On single-core targets (GBA, Mega Drive, DS, and the other
+  consoles) the library is built without threads: run() executes jobs immediately on the calling thread, and wait()
+  returns at once.
+
+  \code
+  toy::jobs::initialize();
+
+  toy::jobs::parallelFor(sprites.size(), 64, [&](size_t first, size_t last) {
+    for (size_t index = first; index < last; ++index)
+      sprites[index].animate(step);
+  });
+  \endcode
+
+  Jobs are run from the thread that called initialize() and from the workers. Jobs submitted from any other thread
+  run immediately on it.
+*/
+namespace toy::jobs {
+
+/// Most worker threads; the thread that called initialize() runs jobs as well
+inline constexpr size_t c_maxWorkers = 31;
+
+/// Jobs one thread can have queued; further jobs run immediately on it. A power of two
+inline constexpr size_t c_queueSize = 1024;
+
+/// Most jobs parallelFor() splits a range into
+inline constexpr size_t c_maxRangeJobs = 256;
+
+/// Function of a job: processes the items from \a first up to \a last of the work \a data describes.
+using JobFunction = void (*)(void * data, size_t first, size_t last) noexcept;
+
+struct Job;
+
+/// Number of unfinished jobs of a group; wait() returns when it reaches zero.
+class Counter {
+public:
+  /// Constructs a counter of no jobs.
+  constexpr Counter() noexcept = default;
+
+  Counter(const Counter &)             = delete;
+  Counter & operator=(const Counter &) = delete;
+
+  /// Returns the number of unfinished jobs.
+  [[nodiscard]] size_t pending() const noexcept;
+
+  /// Returns whether every job has finished.
+  [[nodiscard]] bool done() const noexcept;
+
+private:
+  friend void run(Job * jobs, size_t count, Counter & counter) noexcept;
+  friend void execute(Job & job) noexcept;
+
+  /// Unfinished jobs
+  std::atomic<size_t> _pending{0};
+};
+
+/// Unit of work: a function applied to a range of items.
+struct Job {
+  /// Function to call
+  JobFunction function;
+
+  /// Work description passed to \ref function
+  void * data;
+
+  /// First item
+  size_t first;
+
+  /// Item past the last
+  size_t last;
+
+  /// Counter of the group; set by run()
+  Counter * counter;
+};
+
+/*!
+  \brief Starts the worker threads.
+
+  \param workerCount Workers to start, besides the calling thread; 0 picks one fewer than the hardware threads. At
+                     most \ref c_maxWorkers. Ignored on targets built without threads.
+*/
+void initialize(size_t workerCount = 0) noexcept;
+
+/*!
+  \brief Stops the worker threads, then runs the jobs they left queued on the calling thread.
+
+  Every counter of a queued job completes, so a wait() on it after shutdown returns.
+*/
+void deInitialize() noexcept;
+
+/// Returns the number of running worker threads; 0 before initialize() and on targets built without threads.
+[[nodiscard]] size_t workerCount() noexcept;
+
+/*!
+  \brief Queues \a count jobs on the calling thread and adds them to \a counter.
+
+  \param jobs    Jobs to run; they must stay valid until \a counter reaches zero.
+  \param count   Number of jobs.
+  \param counter Counter the jobs report to; must outlive them.
+*/
+void run(Job * jobs, size_t count, Counter & counter) noexcept;
+
+/// Runs queued jobs on the calling thread until \a counter reaches zero.
+void wait(const Counter & counter) noexcept;
+
+/// Runs \a job on the calling thread and reports it to its counter.
+void execute(Job & job) noexcept;
+
+/*!
+  \brief Calls \a body on consecutive slices of the items from 0 up to \a count, in parallel, and waits for them.
+
+  The range is cut into slices of at least \a grain items, and at most \ref c_maxRangeJobs of them. A range of one
+  slice, or a build without worker threads, calls \a body once on the calling thread.
+
+  \param count Number of items.
+  \param grain Fewest items worth a job of their own; 0 counts as 1.
+  \param body  Callable as <tt>body(size_t first, size_t last)</tt>; called concurrently from several threads.
+*/
+template <typename Body>
+void parallelFor(size_t count, size_t grain, Body && body) noexcept;
+
+} // namespace toy::jobs
+
+#endif // INCLUDE_CORE_JOBS_HPP_
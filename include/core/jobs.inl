@@ -0,0 +1,81 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   jobs.inl
+  \brief  Inline definitions for the job counters and parallelFor().
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_JOBS_INL_
+#define INCLUDE_CORE_JOBS_INL_
+
+namespace toy::jobs {
+
+inline size_t Counter::pending() const noexcept {
+  return _pending.load(std::memory_order_acquire);
+}
+
+inline bool Counter::done() const noexcept {
+  return pending() == 0;
+}
+
+template <typename Body>
+void parallelFor(size_t count, size_t grain, Body && body) noexcept {
+  grain = grain != 0 ? grain : 1;
+
+  size_t slices = (count + grain - 1) / grain;
+  slices        = slices < c_maxRangeJobs ? slices : c_maxRangeJobs;
+
+  if (slices <= 1 || workerCount() == 0) {
+    if (count != 0)
+      body(size_t{0}, count);
+
+    return;
+  }
+
+  using Callable = std::remove_reference_t<Body>;
+
+  constexpr JobFunction function = [](void * data, size_t first, size_t last) noexcept {
+    (*static_cast<Callable *>(data))(first, last);
+  };
+
+  // Slices differ by at most one item
+  array<Job, c_maxRangeJobs> jobs;
+  void *                     data  = const_cast<void *>(static_cast<const void *>(std::addressof(body)));
+  const size_t               base  = count / slices;
+  const size_t               extra = count % slices;
+  size_t                     first = 0;
+
+  for (size_t slice = 0; slice < slices; ++slice) {
+    const size_t last = first + base + (slice < extra ? 1 : 0);
+
+    jobs[slice] = {function, data, first, last, nullptr};
+    first       = last;
+  }
+
+  Counter counter;
+  run(jobs.data(), slices, counter);
+  wait(counter);
+}
+
+} // namespace toy::jobs
+
+#endif // INCLUDE_CORE_JOBS_INL_
@@ -0,0 +1,407 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   log.hpp
+  \brief  Deferred logging: call sites queue raw arguments, and a consumer formats them and writes the sinks.
+
+  Declares \ref toy::log and the \c TOY_LOG macros. A log call copies a pointer to its constant call site, a
+  timestamp, and the bytes of its arguments into a lock-free ring shared by every thread; nothing is formatted and no
+  file is touched on the calling thread. A consumer, a background thread on desktop or an explicit flush() on the
+  single-threaded targets, formats the queued messages and hands them to the registered sinks.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_LOG_HPP_
+#define INCLUDE_CORE_LOG_HPP_
+
+/*!
+  \namespace toy::log
+
+  \brief Message queue, consumer, sinks, and the reader of binary logs.
+
+  \code
+  toy::log::StderrSink console;
+  toy::log::BinaryFileSink capture("session.tglog");
+
+  toy::log::addSink(console.sink());
+  toy::log::addSink(capture.sink());
+  toy::log::initialize(); // starts the consumer thread on desktop
+
+  TOY_LOG_INFO("Loaded {} sprites in {:.2f} ms", spriteCount, milliseconds);
+
+  toy::log::deInitialize(); // writes what is still queued
+  \endcode
+
+  The format string is checked against the arguments at compile time, as formatTo() checks it. Strings are copied, so
+  temporaries may be logged; other arguments are stored as their raw bytes. A message whose arguments do not fit
+  \ref toy::log::c_maxRecordSize is truncated in its last strings; a message that finds the queue full is dropped and
+  counted by droppedMessages().
+
+  Levels below \ref toy::log::c_compiledLevel compile to nothing; setLevel() filters the rest at run time.
+*/
+namespace toy::log {
+
+/// Severity of a message.
+enum class Level : uint8_t {
+  Trace,   ///< Step-by-step detail, compiled into debug builds only
+  Debug,   ///< Developer diagnostics, compiled into debug builds only
+  Info,    ///< Normal events worth keeping
+  Warning, ///< Recoverable problems
+  Error,   ///< Failures the engine works around
+  Fatal,   ///< Failures that end the session; the queue is flushed before the call returns
+};
+
+/// Lowest level compiled into this build
+#ifdef _DEBUG
+inline constexpr Level c_compiledLevel = Level::Trace;
+#else
+inline constexpr Level c_compiledLevel = Level::Info;
+#endif // _DEBUG
+
+/// Slots of the queue, 56 message bytes each; a power of two
+#ifdef TOYGINE_JOB_THREADS
+inline constexpr size_t c_queueSlots = 4096;
+#else
+inline constexpr size_t c_queueSlots = 64;
+#endif // TOYGINE_JOB_THREADS
+
+/// Largest queued message, in bytes: the call site, time, thread, and the arguments with their kinds
+inline constexpr size_t c_maxRecordSize = 448;
+
+/// Most arguments of one message
+inline constexpr size_t c_maxArguments = 16;
+
+/// Longest formatted message text; longer text is cut
+inline constexpr size_t c_maxMessageSize = 1024;
+
+/// Most sinks registered at once
+inline constexpr size_t c_maxSinks = 8;
+
+/*!
+  \brief Constant description of one log call site, created by the \c TOY_LOG macros.
+
+  The identifier hashes the file, the line, and the format string, so it stays the same between runs of one build and
+  keys the call sites in binary logs.
+*/
+struct Site {
+  /// Describes the call at \a siteLine of \a siteFile.
+  constexpr Site(Level siteLevel, string_view siteFormat, string_view siteFile, uint32_t siteLine) noexcept;
+
+  /// Identifier of the call site
+  StringId id;
+
+  /// Severity
+  Level level;
+
+  /// Line of the call
+  uint32_t line;
+
+  /// Source file of the call, as \c __FILE__ spells it
+  string_view file;
+
+  /// Format string, checked against the arguments at compile time
+  string_view format;
+};
+
+/// Lowest level written, set by setLevel()
+inline constinit std::atomic<Level> g_level{c_compiledLevel};
+
+/*!
+  \brief Copies the call site, the time, the thread, and \a count arguments into the queue.
+
+  \note Called by the inline write(); engine code logs with the \c TOY_LOG macros instead.
+*/
+void enqueue(const Site & site, const formatting::Argument * arguments, size_t count) noexcept;
+
+/// Returns whether messages of \a level are written.
+[[nodiscard]] bool isEnabled(Level level) noexcept;
+
+/// Sets the lowest level written; levels below \ref c_compiledLevel stay compiled out.
+void setLevel(Level level) noexcept;
+
+/*!
+  \brief Queues one message; called by the \c TOY_LOG macros.
+
+  \param site      Constant description of the call site.
+  \param format    Same format string as \a site holds; only checks \a arguments at compile time.
+  \param arguments Values the format string refers to.
+*/
+template <Formattable... Args>
+void write(const Site & site, FormatStringOf<Args...> format, const Args &... arguments) noexcept;
+
+/// Formatted message handed to the sinks.
+struct Message {
+  /// Call site
+  const Site * site;
+
+  /// toy::chrono::now() at the call, in nanoseconds
+  uint64_t time;
+
+  /// Log thread index of the calling thread
+  uint32_t thread;
+
+  /// Formatted text, without a line break
+  string_view text;
+
+  /// Encoded arguments: count, kinds, and bytes, as binary logs store them
+  const std::byte * arguments;
+
+  /// Bytes of \ref arguments
+  size_t argumentsSize;
+};
+
+/// Receiver of messages; \a context is the pointer registered with it.
+using WriteCallback = void (*)(const Message & message, void * context) noexcept;
+
+/// Called after each batch of messages, so file sinks can flush; \a context is the pointer registered with it.
+using FlushCallback = void (*)(void * context) noexcept;
+
+/// Destination of formatted messages.
+struct Sink {
+  /// Receives each message
+  WriteCallback write;
+
+  /// Called after each batch, or \c nullptr
+  FlushCallback flush;
+
+  /// Passed back to both callbacks; identifies the sink for removeSink()
+  void * context;
+};
+
+/// Registers \a sink; returns \c false when \ref c_maxSinks sinks are registered.
+bool addSink(const Sink & sink) noexcept;
+
+/// Unregisters the sinks registered with \a context; waits for a batch in progress to end.
+void removeSink(const void * context) noexcept;
+
+/// Starts the consumer thread on targets built with threads; elsewhere call flush() once per frame.
+void initialize() noexcept;
+
+/// Stops the consumer thread and writes every queued message.
+void deInitialize() noexcept;
+
+/// Formats and writes every published message on the calling thread; safe to call from any thread.
+void flush() noexcept;
+
+/// Returns the number of messages dropped because the queue was full.
+[[nodiscard]] uint64_t droppedMessages() noexcept;
+
+/// Returns the name of \a level.
+[[nodiscard]] constexpr string_view levelName(Level level) noexcept;
+
+/*!
+  \brief Writes \a message as one text line: time in seconds, level, thread, file and line, and text.
+
+  \return Number of characters of the complete line, line break included; output past \a capacity is dropped.
+*/
+size_t formatLine(char * buffer, size_t capacity, const Message & message) noexcept;
+
+/// Sink writing text lines to the standard error stream.
+class StderrSink {
+public:
+  /// Returns the sink to register with addSink().
+  [[nodiscard]] Sink sink() noexcept;
+};
+
+/*!
+  \brief Sink writing text lines to a file that is rotated when it grows too large.
+
+  When the file reaches \a maxSize bytes, <tt>path.N</tt> is removed, each older <tt>path.i</tt> becomes
+  <tt>path.i+1</tt>, the file becomes <tt>path.1</tt>, and a new file is started.
+*/
+class RotatingFileSink {
+public:
+  /*!
+    \brief Opens \a path for appending.
+
+    \param path      File to write.
+    \param maxSize   Size, in bytes, at which the file is rotated.
+    \param keptFiles Rotated files kept beside the current one.
+  */
+  RotatingFileSink(const char * path, size_t maxSize, uint32_t keptFiles) noexcept;
+
+  /// Closes the file.
+  ~RotatingFileSink() noexcept;
+
+  RotatingFileSink(const RotatingFileSink &)             = delete;
+  RotatingFileSink & operator=(const RotatingFileSink &) = delete;
+
+  /// Returns whether the file is open.
+  [[nodiscard]] bool isOpen() const noexcept;
+
+  /// Returns the sink to register with addSink().
+  [[nodiscard]] Sink sink() noexcept;
+
+private:
+  /// Writes the line of \a message, rotating first when needed.
+  void write(const Message & message) noexcept;
+
+  /// Shifts the rotated files and starts a new one.
+  void rotate() noexcept;
+
+  /// Path of the current file
+  FixedString<256> _path;
+
+  /// Size at which the file is rotated
+  size_t _maxSize;
+
+  /// Rotated files kept
+  uint32_t _keptFiles;
+
+  /// Open file, a \c std::FILE
+  void * _file{nullptr};
+
+  /// Bytes in the current file
+  size_t _size{0};
+};
+
+/// Version of the binary log format written by BinaryFileSink
+inline constexpr uint16_t c_binaryLogVersion = 1;
+
+/*!
+  \brief Sink writing messages undecoded, for BinaryLogReader or the log decoder tool.
+
+  The file keeps the argument bytes instead of the text, and each call site once: its level, file, line, and format
+  string, before the first message that refers to it. A message costs a few bytes more than its arguments.
+*/
+class BinaryFileSink {
+public:
+  /// Creates \a path and writes the file header.
+  explicit BinaryFileSink(const char * path) noexcept;
+
+  /// Closes the file.
+  ~BinaryFileSink() noexcept;
+
+  BinaryFileSink(const BinaryFileSink &)             = delete;
+  BinaryFileSink & operator=(const BinaryFileSink &) = delete;
+
+  /// Returns whether the file is open.
+  [[nodiscard]] bool isOpen() const noexcept;
+
+  /// Returns the sink to register with addSink().
+  [[nodiscard]] Sink sink() noexcept;
+
+private:
+  /// Writes \a message, preceded by its call site the first time it appears.
+  void write(const Message & message) noexcept;
+
+  /// Open file, a \c std::FILE
+  void * _file{nullptr};
+
+  /// Identifiers of the call sites already written
+  FlatHashMap<StringId, bool, 1024> _sites;
+};
+
+/*!
+  \brief Reads the messages of a binary log held in memory.
+
+  \code
+  toy::log::BinaryLogReader reader(data, size);
+  toy::log::Message         message;
+
+  while (reader.next(message))
+    print(message);
+  \endcode
+*/
+class BinaryLogReader {
+public:
+  /// Reads the \a size bytes at \a data, which must stay valid while messages are read.
+  BinaryLogReader(const void * data, size_t size) noexcept;
+
+  /// Returns whether the data starts with a supported binary log header.
+  [[nodiscard]] bool isValid() const noexcept;
+
+  /// Returns whether reading stopped at damaged or truncated data rather than at the end.
+  [[nodiscard]] bool isDamaged() const noexcept;
+
+  /*!
+    \brief Decodes the next message.
+
+    \param message Receives the message; it stays valid until the next call.
+
+    \return \c false at the end of the data, or when the rest cannot be read; see isDamaged().
+  */
+  bool next(Message & message) noexcept;
+
+private:
+  /// Call sites read so far, by identifier
+  FlatHashMap<StringId, Site, 1024> _sites;
+
+  /// Data
+  const std::byte * _data;
+
+  /// End of the data
+  const std::byte * _end;
+
+  /// Next byte to read
+  const std::byte * _cursor;
+
+  /// Text of the last message
+  char _text[c_maxMessageSize];
+
+  /// Header read successfully
+  bool _valid{false};
+
+  /// Reading stopped at bad data
+  bool _damaged{false};
+};
+
+} // namespace toy::log
+
+/// Joins the line number onto a name, giving one call-site name per \c TOY_LOG line.
+#define TOYGINE_LOG_CONCATENATE_IMPLEMENTATION(name, line) name##line
+#define TOYGINE_LOG_CONCATENATE(name, line) TOYGINE_LOG_CONCATENATE_IMPLEMENTATION(name, line)
+
+/*!
+  \brief Queues a message of \a level; levels below toy::log::c_compiledLevel compile to nothing.
+
+  \param level  toy::log::Level of the message.
+  \param format String literal; checked against the arguments at compile time.
+*/
+#define TOY_LOG(level, format, ...)                                                                                   \
+  do {                                                                                                                \
+    if constexpr ((level) >= toy::log::c_compiledLevel) {                                                             \
+      static constexpr toy::log::Site TOYGINE_LOG_CONCATENATE(toygineLogSite, __LINE__)((level), (format), __FILE__,  \
+                                                                                        __LINE__);                    \
+      if (toy::log::isEnabled(level))                                                                                 \
+        toy::log::write(TOYGINE_LOG_CONCATENATE(toygineLogSite, __LINE__), (format)__VA_OPT__(, ) __VA_ARGS__);       \
+    }                                                                                                                 \
+  } while (false)
+
+/// Queues a toy::log::Level::Trace message.
+#define TOY_LOG_TRACE(format, ...) TOY_LOG(toy::log::Level::Trace, format __VA_OPT__(, ) __VA_ARGS__)
+
+/// Queues a toy::log::Level::Debug message.
+#define TOY_LOG_DEBUG(format, ...) TOY_LOG(toy::log::Level::Debug, format __VA_OPT__(, ) __VA_ARGS__)
+
+/// Queues a toy::log::Level::Info message.
+#define TOY_LOG_INFO(format, ...) TOY_LOG(toy::log::Level::Info, format __VA_OPT__(, ) __VA_ARGS__)
+
+/// Queues a toy::log::Level::Warning message.
+#define TOY_LOG_WARNING(format, ...) TOY_LOG(toy::log::Level::Warning, format __VA_OPT__(, ) __VA_ARGS__)
+
+/// Queues a toy::log::Level::Error message.
+#define TOY_LOG_ERROR(format, ...) TOY_LOG(toy::log::Level::Error, format __VA_OPT__(, ) __VA_ARGS__)
+
+/// Queues a toy::log::Level::Fatal message and writes the queue before returning.
+#define TOY_LOG_FATAL(format, ...) TOY_LOG(toy::log::Level::Fatal, format __VA_OPT__(, ) __VA_ARGS__)
+
+#endif // INCLUDE_CORE_LOG_HPP_
@@ -0,0 +1,79 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   log.inl
+  \brief  Inline definitions for the call sites, the level check, and the queuing of messages.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_LOG_INL_
+#define INCLUDE_CORE_LOG_INL_
+
+namespace toy::log {
+
+constexpr Site::Site(Level siteLevel, string_view siteFormat, string_view siteFile, uint32_t siteLine) noexcept
+  : id(hash64(siteFormat, hash64(siteFile, siteLine)))
+  , level(siteLevel)
+  , line(siteLine)
+  , file(siteFile)
+  , format(siteFormat) {}
+
+inline bool isEnabled(Level level) noexcept {
+  return level >= g_level.load(std::memory_order_relaxed);
+}
+
+template <Formattable... Args>
+inline void write(const Site & site, [[maybe_unused]] FormatStringOf<Args...> format,
+                  const Args &... arguments) noexcept {
+  static_assert(sizeof...(Args) <= c_maxArguments, "too many arguments for one log message");
+
+  const array<formatting::Argument, sizeof...(Args)> erased{formatting::makeArgument(arguments)...};
+
+  enqueue(site, erased.data(), erased.size());
+}
+
+constexpr string_view levelName(Level level) noexcept {
+  switch (level) {
+    case Level::Trace:
+      return "trace";
+
+    case Level::Debug:
+      return "debug";
+
+    case Level::Info:
+      return "info";
+
+    case Level::Warning:
+      return "warning";
+
+    case Level::Error:
+      return "error";
+
+    case Level::Fatal:
+      return "fatal";
+  }
+
+  return {};
+}
+
+} // namespace toy::log
+
+#endif // INCLUDE_CORE_LOG_INL_
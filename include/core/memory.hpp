@@ -0,0 +1,264 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   memory.hpp
+  \brief  Memory tracking by subsystem: tagged allocators, live and peak bytes, per-frame counts, and budgets.
+
+  Declares \ref toy::MemoryTag, \ref toy::TrackedAllocator, and \ref toy::memory. Every allocation made through a
+  tracked allocator is charged to one subsystem, so a port that runs out of memory late in testing shows which
+  subsystem grew and in which frame.
+
+  Tracking is compiled in only when \c TOYGINE_MEMORY_TRACKING is defined. The build defines it unless the CMake option
+  \c TOYGINE_ENABLE_MEMORY_TRACKING is off, as in the shipping presets; a \ref toy::TrackedAllocator then calls the
+  allocator it wraps and nothing else, and every statistic reads zero.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_MEMORY_HPP_
+#define INCLUDE_CORE_MEMORY_HPP_
+
+namespace toy {
+
+/// Subsystem an allocation is charged to.
+enum class MemoryTag : uint8_t {
+  General, ///< Engine core and anything without a subsystem of its own
+  Render,  ///< Draw lists, GPU staging, and render targets
+  Audio,   ///< Sound buffers and mixer state
+  Assets,  ///< Loaded and decompressed resources
+  Game,    ///< Gameplay objects and scripts
+};
+
+/// Number of \ref toy::MemoryTag values
+inline constexpr size_t c_memoryTagCount = 5;
+
+/*!
+  \brief Allocator that charges everything it allocates to one \ref toy::MemoryTag.
+
+  Forwards to the allocator it wraps and reports each allocation and deallocation to \ref toy::memory. Wrap allocators
+  that give memory back one allocation at a time, such as \ref toy::HeapAllocator. Arenas that free in bulk, such as
+  \ref toy::LinearAllocator, are charged once for their whole buffer with memory::recordAllocation() instead.
+
+  \code
+  toy::HeapAllocator                        heap;
+  toy::TrackedAllocator<toy::HeapAllocator> audioMemory(heap, toy::MemoryTag::Audio);
+
+  auto * samples = static_cast<int16_t *>(audioMemory.allocate(sampleCount * sizeof(int16_t), alignof(int16_t)));
+  // ...
+  audioMemory.deallocate(samples, sampleCount * sizeof(int16_t), alignof(int16_t));
+  \endcode
+
+  \tparam A Wrapped allocator type.
+*/
+template <Allocator A>
+class TrackedAllocator {
+public:
+  /// Wraps \a allocator, which must outlive this object, and charges its allocations to \a tag.
+  TrackedAllocator(A & allocator, MemoryTag tag) noexcept;
+
+  /// Allocates \a size bytes aligned to \a alignment from the wrapped allocator; \c nullptr when it has no room.
+  [[nodiscard]] void * allocate(size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Gives \a pointer back to the wrapped allocator; \a size must be the size it was allocated with.
+  void deallocate(void * pointer, size_t size, size_t alignment = c_defaultAlignment) noexcept;
+
+  /// Returns the wrapped allocator.
+  [[nodiscard]] A & allocator() const noexcept;
+
+  /// Returns the subsystem allocations are charged to.
+  [[nodiscard]] MemoryTag tag() const noexcept;
+
+private:
+  /// Allocator the memory comes from
+  A * _allocator;
+
+  /// Subsystem charged
+  MemoryTag _tag;
+};
+
+} // namespace toy
+
+/*!
+  \namespace toy::memory
+
+  \brief Live and peak bytes, allocation counts, and budgets of each \ref toy::MemoryTag.
+
+  Each thread records into counters of its own, with no atomic operation, lock, or lookup, and publishes them to the
+  shared counters every \ref toy::memory::c_publishInterval allocations and deallocations, or once they change by
+  \ref toy::memory::c_publishBytes bytes. Peaks and budgets are checked on publication, so the statistics of a tag
+  can trail its true state by that much per thread; statistics() and beginFrame() publish the calling thread first.
+  beginFrame(), once per frame on the main thread, closes the per-frame allocation counts and advances the frame index
+  that peaks are stamped with.
+
+  \code
+  toy::memory::setBudget(toy::MemoryTag::Render, 6 * 1024 * 1024);
+
+  while (running) {
+    toy::memory::beginFrame();
+    // ...
+  }
+
+  const toy::memory::TagStatistics render = toy::memory::statistics(toy::MemoryTag::Render);
+  // render.peakBytes was reached in frame render.peakFrame
+  \endcode
+
+  A tag that goes over its budget fails an assertion through \ref toy::assertion in debug builds; release builds with
+  tracking still count the overrun in \ref toy::memory::TagStatistics::budgetOverruns.
+*/
+namespace toy::memory {
+
+/// Snapshot of the counters of one tag.
+struct TagStatistics {
+  /// Bytes allocated and not yet given back
+  size_t liveBytes{0};
+
+  /// Highest \ref liveBytes seen
+  size_t peakBytes{0};
+
+  /// Frame index in which \ref peakBytes was reached
+  uint64_t peakFrame{0};
+
+  /// Budget in bytes, or 0 when the tag has none
+  size_t budget{0};
+
+  /// Allocations not yet given back
+  uint64_t liveAllocations{0};
+
+  /// Allocations made in the last completed frame
+  uint64_t frameAllocations{0};
+
+  /// Highest \ref frameAllocations seen
+  uint64_t peakFrameAllocations{0};
+
+  /// Times an allocation took the tag over its budget
+  uint32_t budgetOverruns{0};
+};
+
+#ifdef TOYGINE_MEMORY_TRACKING
+
+/// Allocations and deallocations a thread records for one tag before it publishes them
+inline constexpr uint32_t c_publishInterval = 32;
+
+/// Bytes a thread records for one tag, in either direction, before it publishes them
+inline constexpr int64_t c_publishBytes = 4096;
+
+/*!
+  \brief Counters of one tag, on a cache line of its own so subsystems on different threads do not share one.
+
+  \note Updated by publish(); use statistics() instead.
+*/
+struct alignas(64) TagCounters {
+  /// Bytes allocated and not yet given back; briefly negative when a thread publishes a deallocation first
+  std::atomic<int64_t> liveBytes{0};
+
+  /// Highest liveBytes seen
+  std::atomic<int64_t> peakBytes{0};
+
+  /// Budget in bytes; the largest int64_t when there is none
+  std::atomic<int64_t> budget{INT64_MAX};
+
+  /// Allocations since the last reset
+  std::atomic<uint64_t> allocations{0};
+
+  /// Deallocations since the last reset
+  std::atomic<uint64_t> deallocations{0};
+
+  /// Frame index in which peakBytes was reached
+  std::atomic<uint64_t> peakFrame{0};
+
+  /// Value of allocations when the current frame began
+  std::atomic<uint64_t> frameStart{0};
+
+  /// Allocations made in the last completed frame
+  std::atomic<uint64_t> frameAllocations{0};
+
+  /// Highest frameAllocations seen
+  std::atomic<uint64_t> peakFrameAllocations{0};
+
+  /// Times an allocation took the tag over its budget
+  std::atomic<uint32_t> budgetOverruns{0};
+};
+
+/*!
+  \brief Changes to one tag that the calling thread has recorded but not yet published.
+
+  \note Written only by the owning thread, so recording takes no atomic operation.
+*/
+struct PendingCounters {
+  /// Change of the live bytes
+  int64_t bytes{0};
+
+  /// Allocations recorded
+  uint32_t allocations{0};
+
+  /// Deallocations recorded
+  uint32_t deallocations{0};
+
+  /// Records left before the next publication; the first record of a thread publishes at once
+  uint32_t countdown{1};
+};
+
+/// Counters of every tag, by tag value
+inline constinit array<TagCounters, c_memoryTagCount> g_tagCounters;
+
+/// Index of the current frame, advanced by beginFrame()
+inline constinit std::atomic<uint64_t> g_frame{0};
+
+/// Unpublished changes of the calling thread, by tag value
+inline constinit thread_local array<PendingCounters, c_memoryTagCount> t_pendingCounters{};
+
+/// Adds the pending changes of the calling thread to the counters of \a tag, then updates its peak and budget checks.
+void publish(MemoryTag tag) noexcept;
+
+#endif // TOYGINE_MEMORY_TRACKING
+
+/// Charges \a size bytes to \a tag; call when memory is taken outside a \ref toy::TrackedAllocator.
+void recordAllocation(MemoryTag tag, size_t size) noexcept;
+
+/// Gives \a size bytes back to \a tag; the counterpart of recordAllocation().
+void recordDeallocation(MemoryTag tag, size_t size) noexcept;
+
+/*!
+  \brief Sets the budget of \a tag.
+
+  \param tag   Subsystem.
+  \param bytes Most live bytes the tag may hold, or 0 to remove the budget.
+*/
+void setBudget(MemoryTag tag, size_t bytes) noexcept;
+
+/// Publishes the calling thread's changes and returns the counters of \a tag; consistent per field.
+[[nodiscard]] TagStatistics statistics(MemoryTag tag) noexcept;
+
+/// Closes the per-frame allocation counts of every tag and advances the frame index; call once per frame.
+void beginFrame() noexcept;
+
+/// Returns the index of the current frame: the number of beginFrame() calls since the last reset.
+[[nodiscard]] uint64_t frame() noexcept;
+
+/// Zeroes every counter, the calling thread's unpublished changes, and the frame index; budgets are kept. Only call
+/// while no other thread allocates.
+void resetStatistics() noexcept;
+
+/// Returns the name of \a tag, for reports.
+[[nodiscard]] constexpr string_view tagName(MemoryTag tag) noexcept;
+
+} // namespace toy::memory
+
+#endif // INCLUDE_CORE_MEMORY_HPP_
@@ -0,0 +1,123 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   memory.inl
+  \brief  Inline definitions for the tracked allocator and the recording of allocations.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_MEMORY_INL_
+#define INCLUDE_CORE_MEMORY_INL_
+
+namespace toy {
+
+template <Allocator A>
+inline TrackedAllocator<A>::TrackedAllocator(A & allocator, MemoryTag tag) noexcept
+  : _allocator(&allocator)
+  , _tag(tag) {}
+
+template <Allocator A>
+inline void * TrackedAllocator<A>::allocate(size_t size, size_t alignment) noexcept {
+  void * pointer = _allocator->allocate(size, alignment);
+
+  if (pointer != nullptr) [[likely]]
+    memory::recordAllocation(_tag, size);
+
+  return pointer;
+}
+
+template <Allocator A>
+inline void TrackedAllocator<A>::deallocate(void * pointer, size_t size, size_t alignment) noexcept {
+  if (pointer == nullptr)
+    return;
+
+  memory::recordDeallocation(_tag, size);
+  _allocator->deallocate(pointer, size, alignment);
+}
+
+template <Allocator A>
+inline A & TrackedAllocator<A>::allocator() const noexcept {
+  return *_allocator;
+}
+
+template <Allocator A>
+inline MemoryTag TrackedAllocator<A>::tag() const noexcept {
+  return _tag;
+}
+
+} // namespace toy
+
+namespace toy::memory {
+
+#ifdef TOYGINE_MEMORY_TRACKING
+
+inline void recordAllocation(MemoryTag tag, size_t size) noexcept {
+  PendingCounters & pending = t_pendingCounters[static_cast<size_t>(tag)];
+
+  pending.bytes += static_cast<int64_t>(size);
+  ++pending.allocations;
+
+  if (--pending.countdown == 0 || pending.bytes >= c_publishBytes) [[unlikely]]
+    publish(tag);
+}
+
+inline void recordDeallocation(MemoryTag tag, size_t size) noexcept {
+  PendingCounters & pending = t_pendingCounters[static_cast<size_t>(tag)];
+
+  pending.bytes -= static_cast<int64_t>(size);
+  ++pending.deallocations;
+
+  if (--pending.countdown == 0 || pending.bytes <= -c_publishBytes) [[unlikely]]
+    publish(tag);
+}
+
+#else // TOYGINE_MEMORY_TRACKING
+
+inline void recordAllocation([[maybe_unused]] MemoryTag tag, [[maybe_unused]] size_t size) noexcept {}
+
+inline void recordDeallocation([[maybe_unused]] MemoryTag tag, [[maybe_unused]] size_t size) noexcept {}
+
+#endif // TOYGINE_MEMORY_TRACKING
+
+constexpr string_view tagName(MemoryTag tag) noexcept {
+  switch (tag) {
+    case MemoryTag::General:
+      return "general";
+
+    case MemoryTag::Render:
+      return "render";
+
+    case MemoryTag::Audio:
+      return "audio";
+
+    case MemoryTag::Assets:
+      return "assets";
+
+    case MemoryTag::Game:
+      return "game";
+  }
+
+  return {};
+}
+
+} // namespace toy::memory
+
+#endif // INCLUDE_CORE_MEMORY_INL_
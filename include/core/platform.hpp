@@ -0,0 +1,183 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   platform.hpp
+  \brief  CPU feature detection and the dispatch of vector kernels to the best instruction set.
+
+  Declares namespace \ref toy::platform.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_PLATFORM_HPP_
+#define INCLUDE_CORE_PLATFORM_HPP_
+
+// 128-bit kernels, which every target with SSE2 or NEON runs
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || defined(__aarch64__)          \
+  || defined(_M_ARM64)
+#define TOYGINE_SIMD_VECTOR128
+#endif
+
+// AVX2 kernels, compiled on x86-64 whatever the build flags say; the pragmas below enable the instructions for them
+#if defined(__x86_64__) || defined(_M_X64)
+#define TOYGINE_SIMD_AVX2
+#endif
+
+// Kernels chosen at run time: the build has AVX2 kernels but may run on a CPU without AVX2
+#if defined(TOYGINE_SIMD_AVX2) && !(defined(__AVX2__) && defined(__FMA__) && defined(__BMI2__))
+#define TOYGINE_SIMD_DISPATCH
+#endif
+
+/*!
+  \def TOYGINE_SIMD_AVX2_BEGIN
+  \brief Starts code compiled for AVX2, FMA, BMI1, and BMI2; call it only where simdLevel() is SimdLevel::Avx2.
+
+  \def TOYGINE_SIMD_AVX2_END
+  \brief Ends the code started by TOYGINE_SIMD_AVX2_BEGIN.
+*/
+#if defined(__clang__)
+#define TOYGINE_SIMD_AVX2_BEGIN                                                                                       \
+  _Pragma("clang attribute push(__attribute__((target(\"avx2,bmi,bmi2,fma\"))), apply_to = function)")
+#define TOYGINE_SIMD_AVX2_END _Pragma("clang attribute pop")
+#elif defined(__GNUC__)
+#define TOYGINE_SIMD_AVX2_BEGIN _Pragma("GCC push_options") _Pragma("GCC target(\"avx2,bmi,bmi2,fma\")")
+#define TOYGINE_SIMD_AVX2_END   _Pragma("GCC pop_options")
+#else
+// MSVC compiles every intrinsic without target options
+#define TOYGINE_SIMD_AVX2_BEGIN
+#define TOYGINE_SIMD_AVX2_END
+#endif
+
+/*!
+  \def TOYGINE_SIMD_KERNELS
+  \brief Lists the implementations of kernel \a name the build compiles, for selectKernel().
+
+  Expands to \c scalar::name, then \c vector128::name and \c avx2::name where those levels are compiled.
+*/
+#if defined(TOYGINE_SIMD_AVX2)
+#define TOYGINE_SIMD_KERNELS(name) scalar::name, vector128::name, avx2::name
+#elif defined(TOYGINE_SIMD_VECTOR128)
+#define TOYGINE_SIMD_KERNELS(name) scalar::name, vector128::name
+#else
+#define TOYGINE_SIMD_KERNELS(name) scalar::name
+#endif
+
+/*!
+  \namespace toy::platform
+
+  \brief Properties of the machine the engine runs on.
+
+  cpuInfo() queries the CPU once, on first use: instruction sets, cache line size, and core and thread counts.
+
+  Vector kernels are compiled for each \ref toy::platform::SimdLevel the target may have, and selectKernel() binds each
+  one to the best level once. A single x86-64 binary thus runs AVX2 code on the machines that have it and SSE2 code on
+  the rest. Where the build flags already fix the level (ARM64, the consoles, or x86-64 built for AVX2), the choice is
+  a constant and the call is direct:
+
+  \code
+  size_t utf8ValidLength(const char * string, size_t size) noexcept {
+    return platform::selectKernel<decltype(utf8ValidLength), TOYGINE_SIMD_KERNELS(utf8ValidLength)>()(string, size);
+  }
+  \endcode
+
+  Setting the environment variable \c TOYGINE_SIMD_LEVEL to \c scalar, \c vector128, or \c avx2 caps the level a
+  dispatching build picks, for testing the lower levels on a newer machine.
+*/
+namespace toy::platform {
+
+/// Instruction sets vector kernels are compiled for, lowest first.
+enum class SimdLevel : uint8_t {
+  Scalar,    ///< Portable code
+  Vector128, ///< SSE2 on x86, NEON on ARM64
+  Avx2,      ///< AVX2 with FMA, BMI1, and BMI2 on x86-64 (the x86-64-v3 level, Haswell and Zen onward)
+};
+
+/// Level the build flags guarantee; the kernels of this level run on every machine the binary runs on
+#if defined(__AVX2__) && defined(__FMA__) && defined(__BMI2__)
+inline constexpr SimdLevel c_baselineSimdLevel = SimdLevel::Avx2;
+#elif defined(TOYGINE_SIMD_VECTOR128)
+inline constexpr SimdLevel c_baselineSimdLevel = SimdLevel::Vector128;
+#else
+inline constexpr SimdLevel c_baselineSimdLevel = SimdLevel::Scalar;
+#endif
+
+/// Highest level the build compiles kernels for
+#if defined(TOYGINE_SIMD_AVX2)
+inline constexpr SimdLevel c_highestSimdLevel = SimdLevel::Avx2;
+#else
+inline constexpr SimdLevel c_highestSimdLevel = c_baselineSimdLevel;
+#endif
+
+/// CPU features cpuInfo() reports, as bits of CpuInfo::features.
+enum class CpuFeature : uint32_t {
+  Sse2   = 1U << 0, ///< SSE2
+  Sse42  = 1U << 1, ///< SSE4.2
+  Avx2   = 1U << 2, ///< AVX2, with operating-system support for the YMM registers
+  Fma    = 1U << 3, ///< FMA3
+  Bmi2   = 1U << 4, ///< BMI1 and BMI2
+  Avx512 = 1U << 5, ///< AVX-512 F, BW, and VL, with operating-system support for the ZMM registers
+  Neon   = 1U << 6, ///< Advanced SIMD on ARM64
+};
+
+/// What cpuInfo() found out about the CPU.
+struct CpuInfo {
+  /// Supported \ref CpuFeature values, or-ed together
+  uint32_t features{0};
+
+  /// Level selectKernel() binds kernels to
+  SimdLevel simdLevel{c_baselineSimdLevel};
+
+  /// Size of a data cache line, in bytes
+  uint32_t cacheLineSize{64};
+
+  /// Physical cores
+  uint32_t coreCount{1};
+
+  /// Hardware threads, over all cores
+  uint32_t threadCount{1};
+
+  /// Returns whether the CPU supports \a feature.
+  [[nodiscard]] constexpr bool has(CpuFeature feature) const noexcept;
+};
+
+/// Returns the properties of the CPU, queried on the first call; safe to call from any thread.
+[[nodiscard]] const CpuInfo & cpuInfo() noexcept;
+
+/// Returns the level selectKernel() binds kernels to: a constant unless the build dispatches at run time.
+[[nodiscard]] SimdLevel simdLevel() noexcept;
+
+/// Returns the name of \a level, as \c TOYGINE_SIMD_LEVEL spells it.
+[[nodiscard]] constexpr string_view simdLevelName(SimdLevel level) noexcept;
+
+/*!
+  \brief Returns the implementation of a kernel for simdLevel().
+
+  The choice is made on the first call for each kernel and kept; it is a constant where the build does not dispatch.
+
+  \tparam Function Type of the kernel, which resolves overloaded names.
+  \tparam Kernels  Implementations for SimdLevel::Scalar upward, usually TOYGINE_SIMD_KERNELS(); levels above the last
+                   one listed use the last one.
+*/
+template <typename Function, Function *... Kernels>
+[[nodiscard]] Function * selectKernel() noexcept;
+
+} // namespace toy::platform
+
+#endif // INCLUDE_CORE_PLATFORM_HPP_
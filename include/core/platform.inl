@@ -0,0 +1,83 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   platform.inl
+  \brief  Inline definitions for the CPU queries and kernel dispatch.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_PLATFORM_INL_
+#define INCLUDE_CORE_PLATFORM_INL_
+
+namespace toy::platform {
+
+constexpr bool CpuInfo::has(CpuFeature feature) const noexcept {
+  return (features & static_cast<uint32_t>(feature)) != 0;
+}
+
+inline SimdLevel simdLevel() noexcept {
+#ifdef TOYGINE_SIMD_DISPATCH
+  return cpuInfo().simdLevel;
+#else
+  return c_baselineSimdLevel;
+#endif
+}
+
+constexpr string_view simdLevelName(SimdLevel level) noexcept {
+  switch (level) {
+    case SimdLevel::Scalar:
+      return "scalar";
+
+    case SimdLevel::Vector128:
+      return "vector128";
+
+    case SimdLevel::Avx2:
+      return "avx2";
+  }
+
+  return {};
+}
+
+template <typename Function, Function *... Kernels>
+inline Function * selectKernel() noexcept {
+  static_assert(sizeof...(Kernels) != 0, "selectKernel needs the scalar implementation at least");
+
+  static constexpr array<Function *, sizeof...(Kernels)> c_kernels{Kernels...};
+  static constexpr size_t                                c_last = c_kernels.size() - 1;
+
+#ifdef TOYGINE_SIMD_DISPATCH
+  static Function * const s_kernel = [] {
+    const auto level = static_cast<size_t>(simdLevel());
+
+    return c_kernels[level < c_last ? level : c_last];
+  }();
+
+  return s_kernel;
+#else
+  constexpr auto c_level = static_cast<size_t>(c_baselineSimdLevel);
+
+  return c_kernels[c_level < c_last ? c_level : c_last];
+#endif
+}
+
+} // namespace toy::platform
+
+#endif // INCLUDE_CORE_PLATFORM_INL_
@@ -0,0 +1,309 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   profiler.hpp
+  \brief  Scoped-zone instrumentation profiler with Chrome trace export.
+
+  Declares \ref toy::profiler and the \c TOY_PROFILE_SCOPE macro. A zone measures the scope it is declared in and
+  leaves one record in a ring buffer owned by the calling thread. A drain step, usually once per frame, collects the
+  records of every thread for the Chrome trace writer and the per-zone statistics.
+
+  Zones are recorded only when \c TOYGINE_PROFILER is defined. The build defines it unless the CMake option
+  \c TOYGINE_ENABLE_PROFILER is off, as in the shipping presets; otherwise \c TOY_PROFILE_SCOPE compiles to nothing.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_PROFILER_HPP_
+#define INCLUDE_CORE_PROFILER_HPP_
+
+/*!
+  \namespace toy::profiler
+
+  \brief Zone recording, draining, Chrome trace export, and per-zone statistics.
+
+  A zone name is a string literal. Its \ref toy::StringId is computed at compile time and stored with the name in a
+  constant \ref toy::profiler::ZoneSite, so recording a zone costs two clock reads and a few stores into the thread's
+  ring buffer: no lookup, lock, or allocation. The first zone of a thread allocates its buffer once.
+
+  \code
+  void World::update(float step) {
+    TOY_PROFILE_SCOPE("World::update");
+    // ...
+  }
+
+  // Once per frame, on any thread:
+  toy::profiler::ZoneRecord records[4096];
+  const size_t count = toy::profiler::drainZones(records, 4096);
+
+  traceWriter.write(records, count); // Chrome trace, opened in chrome://tracing or Perfetto
+  statistics.add(records, count);    // calls, total, self, and maximum time per zone
+  \endcode
+
+  Each thread keeps up to \ref toy::profiler::c_threadBufferSize records between two drains; later zones are dropped
+  and counted by droppedZones(). Only one thread at a time should drain.
+*/
+namespace toy::profiler {
+
+/// Most threads that can record zones at once; zones of further threads are not recorded until one of them exits
+inline constexpr size_t c_maxThreads = 64;
+
+/// Records a thread buffer holds between two drains; a power of two
+inline constexpr size_t c_threadBufferSize = 8192;
+
+/// Deepest nesting the self-time accounting of \ref toy::profiler::ZoneStatistics follows
+inline constexpr uint32_t c_maxDepth = 64;
+
+/// Zone name and its identifier, a constant created by \c TOY_PROFILE_SCOPE for each zone in the source.
+struct ZoneSite {
+  /// Hashes \a zoneName at compile time.
+  consteval explicit ZoneSite(const char * zoneName) noexcept;
+
+  /// Identifier of the name; zones with the same name share statistics
+  StringId id;
+
+  /// Name as written in the source
+  const char * name;
+};
+
+/// One completed zone.
+struct ZoneRecord {
+  /// Zone that was entered
+  const ZoneSite * site;
+
+  /// toy::chrono::now() at entry
+  uint64_t start;
+
+  /// toy::chrono::now() at exit
+  uint64_t end;
+
+  /// Index of the recording thread, below \ref c_maxThreads
+  uint32_t thread;
+
+  /// Number of zones the thread was already inside at entry
+  uint32_t depth;
+};
+
+/*!
+  \brief Single-producer, single-consumer ring of one thread's records.
+
+  The owning thread appends; drainZones() removes. Neither side waits: a full ring drops the new record.
+
+  \note Used by \ref toy::profiler::Zone; engine code declares zones with \c TOY_PROFILE_SCOPE instead.
+*/
+struct ThreadBuffer {
+  /// Records, indexed by position modulo \ref c_threadBufferSize
+  array<ZoneRecord, c_threadBufferSize> records;
+
+  /// Position of the next record the owner writes
+  std::atomic<uint64_t> head{0};
+
+  /// Position of the next record drainZones() reads
+  std::atomic<uint64_t> tail{0};
+
+  /// Records dropped because the ring was full or discarded when the buffer changed owner
+  std::atomic<uint64_t> dropped{0};
+
+  /// Zones the owner is inside; touched by the owner only
+  uint32_t depth{0};
+
+  /// Index of the owning thread
+  uint32_t thread{0};
+
+  /// Name shown in the Chrome trace, or \c nullptr
+  std::atomic<const char *> name{nullptr};
+
+  /// Set when the owning thread exits; attachThread() may then hand the buffer to another thread
+  std::atomic<bool> detached{false};
+};
+
+/// Buffer of the calling thread; \c nullptr until its first zone
+inline thread_local ThreadBuffer * t_threadBuffer = nullptr;
+
+/// Registers a buffer for the calling thread, taking over the buffer of an exited thread when there is one; returns
+/// \c nullptr when \ref c_maxThreads running threads already have one or the allocation fails. Records an exited
+/// thread left undrained are discarded only when no drained buffer and no new thread index is left.
+ThreadBuffer * attachThread() noexcept;
+
+/*!
+  \brief Measures the enclosing scope; created by \c TOY_PROFILE_SCOPE.
+
+  The constructor reads the clock and the destructor appends a \ref toy::profiler::ZoneRecord to the buffer of the
+  calling thread. A zone must end on the thread that started it.
+*/
+class Zone {
+public:
+  /// Enters the zone \a site.
+  explicit Zone(const ZoneSite & site) noexcept;
+
+  /// Leaves the zone and records it.
+  ~Zone() noexcept;
+
+  Zone(const Zone &)             = delete;
+  Zone & operator=(const Zone &) = delete;
+
+private:
+  /// Buffer of the calling thread, or \c nullptr when the thread cannot record
+  ThreadBuffer * _buffer;
+
+  /// Zone being measured
+  const ZoneSite * _site;
+
+  /// Clock value at entry
+  uint64_t _start;
+};
+
+/*!
+  \brief Names the calling thread in the Chrome trace.
+
+  \param name Name to show; must outlive the profiler, as a string literal does.
+*/
+void setThreadName(const char * name) noexcept;
+
+/*!
+  \brief Moves the records of every thread into \a records.
+
+  Records of one thread come out together and in the order the zones ended, which puts nested zones before the zone
+  that contains them. Records that do not fit stay in their buffers for the next call.
+
+  \param records  Destination.
+  \param capacity Records \a records can hold.
+
+  \return Number of records written.
+*/
+size_t drainZones(ZoneRecord * records, size_t capacity) noexcept;
+
+/// Returns the number of records dropped so far because a thread buffer was full or an exited thread left them
+/// undrained.
+[[nodiscard]] uint64_t droppedZones() noexcept;
+
+/// Receiver of Chrome trace text; \a context is the pointer given to \ref toy::profiler::ChromeTraceWriter.
+using TraceWriteCallback = void (*)(const char * text, size_t size, void * context) noexcept;
+
+/*!
+  \brief Streams records as Chrome Trace Event JSON.
+
+  Writes one complete event (\c "ph":"X") per record, with times in microseconds, as records arrive, so a capture can
+  span many drains. finish() adds the thread names and closes the document. Text goes out through a callback in chunks
+  of at most a few hundred bytes; nothing is allocated.
+*/
+class ChromeTraceWriter {
+public:
+  /// Starts a trace document that goes to \a callback.
+  ChromeTraceWriter(TraceWriteCallback callback, void * context) noexcept;
+
+  /// Writes \a count records.
+  void write(const ZoneRecord * records, size_t count) noexcept;
+
+  /// Writes the thread names and closes the document; later calls do nothing.
+  void finish() noexcept;
+
+private:
+  /// Sends \a size characters of \a text to the callback.
+  void emit(const char * text, size_t size) noexcept;
+
+  /// Receiver of the text
+  TraceWriteCallback _callback;
+
+  /// Pointer passed back to the callback
+  void * _context;
+
+  /// Events written so far
+  size_t _events{0};
+
+  /// Set by finish()
+  bool _finished{false};
+};
+
+/// Totals of one zone name.
+struct ZoneTotals {
+  /// Name of the zone
+  const char * name;
+
+  /// Times the zone was entered
+  uint64_t calls;
+
+  /// Time inside the zone, in nanoseconds
+  uint64_t totalTime;
+
+  /// Time inside the zone but outside the zones nested in it, in nanoseconds
+  uint64_t selfTime;
+
+  /// Longest single stay in the zone, in nanoseconds
+  uint64_t maxTime;
+};
+
+/*!
+  \brief Flat per-zone aggregate of drained records: calls, total, self, and maximum time.
+
+  Self time subtracts the zones nested directly inside each zone. It relies on the order drainZones() gives, so feed
+  the records of every drain, in order, without filtering them.
+*/
+class ZoneStatistics {
+public:
+  /// Map from zone identifier to its totals; records of names past its max_size() are ignored
+  using Map = FlatHashMap<StringId, ZoneTotals, 512>;
+
+  /// Adds \a count records.
+  void add(const ZoneRecord * records, size_t count) noexcept;
+
+  /// Returns the totals of zone \a id, or \c nullptr when it has no record.
+  [[nodiscard]] const ZoneTotals * find(StringId id) const noexcept;
+
+  /// Returns the totals of every zone seen, in no particular order.
+  [[nodiscard]] const Map & zones() const noexcept;
+
+  /// Forgets every record.
+  void clear() noexcept;
+
+private:
+  /// Totals by zone identifier
+  Map _zones;
+
+  /// Time of the zones that ended at each depth since the last zone one level up ended, per thread
+  array<array<uint64_t, c_maxDepth + 1>, c_maxThreads> _childTime{};
+};
+
+} // namespace toy::profiler
+
+/// Pastes the line number onto a name, giving one name per \c TOY_PROFILE_SCOPE line.
+#define TOYGINE_PROFILE_CONCATENATE_IMPLEMENTATION(name, line) name##line
+#define TOYGINE_PROFILE_CONCATENATE(name, line) TOYGINE_PROFILE_CONCATENATE_IMPLEMENTATION(name, line)
+
+#ifdef TOYGINE_PROFILER
+
+/*!
+  \brief Records the enclosing scope as a profiler zone named \a name.
+
+  \param name String literal; zones with the same name are added up together.
+*/
+#define TOY_PROFILE_SCOPE(name)                                                                                       \
+  static constexpr toy::profiler::ZoneSite TOYGINE_PROFILE_CONCATENATE(toygineZoneSite, __LINE__)(name);              \
+  const toy::profiler::Zone TOYGINE_PROFILE_CONCATENATE(toygineZone, __LINE__)(                                       \
+    TOYGINE_PROFILE_CONCATENATE(toygineZoneSite, __LINE__))
+
+#else // TOYGINE_PROFILER
+
+/// Compiles to nothing: the profiler is disabled in this build.
+#define TOY_PROFILE_SCOPE(name) static_cast<void>(0)
+
+#endif // TOYGINE_PROFILER
+
+#endif // INCLUDE_CORE_PROFILER_HPP_
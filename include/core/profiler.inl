@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   profiler.inl
+  \brief  Inline definitions for the profiler zones.
+
+  Entering and leaving a zone is inlined at the call site: two clock reads and the stores of one record, with the
+  thread buffer reached through a thread-local pointer.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_PROFILER_INL_
+#define INCLUDE_CORE_PROFILER_INL_
+
+namespace toy::profiler {
+
+consteval ZoneSite::ZoneSite(const char * zoneName) noexcept
+  : id(string_view(zoneName))
+  , name(zoneName) {}
+
+inline Zone::Zone(const ZoneSite & site) noexcept
+  : _buffer(t_threadBuffer)
+  , _site(&site) {
+  if (_buffer == nullptr) [[unlikely]]
+    _buffer = attachThread();
+
+  if (_buffer != nullptr)
+    ++_buffer->depth;
+
+  _start = chrono::now();
+}
+
+inline Zone::~Zone() noexcept {
+  const uint64_t end = chrono::now();
+
+  if (_buffer == nullptr) [[unlikely]]
+    return;
+
+  ThreadBuffer & buffer = *_buffer;
+  const uint64_t head   = buffer.head.load(std::memory_order_relaxed);
+  --buffer.depth;
+
+  if (head - buffer.tail.load(std::memory_order_acquire) >= c_threadBufferSize) [[unlikely]] {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+    return;
+  }
+
+  buffer.records[head & (c_threadBufferSize - 1)] = ZoneRecord{_site, _start, end, buffer.thread, buffer.depth};
+  buffer.head.store(head + 1, std::memory_order_release);
+}
+
+} // namespace toy::profiler
+
+#endif // INCLUDE_CORE_PROFILER_INL_
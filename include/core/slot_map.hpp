@@ -0,0 +1,240 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   slot_map.hpp
+  \brief  Fixed-capacity generational slot map with dense storage.
+
+  Declares \ref toy::SlotMap, the engine's pool for objects referred to by handle (entities, sprites, sounds, timers),
+  and \ref toy::SlotHandle, the 32-bit handle it gives out. Definitions live in slot_map.inl.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_SLOT_MAP_HPP_
+#define INCLUDE_CORE_SLOT_MAP_HPP_
+
+namespace toy {
+
+/// Bits of a \ref toy::SlotHandle that hold the slot index; the rest hold the generation
+inline constexpr uint32_t c_slotIndexBits = 20;
+
+/*!
+  \brief Generational reference to an object in a \ref toy::SlotMap of \a T.
+
+  Packs a slot index in the low \ref c_slotIndexBits bits and the slot's generation in the rest. Erasing an object
+  advances the generation of its slot, so handles to it stop matching even after the slot is reused. The generation
+  wraps after 4095 reuses of one slot; a handle kept that long could match again. Generation 0 is never given out,
+  so a default-constructed handle is null and matches nothing.
+
+  \tparam T Type of the referenced objects; handles of different pools do not mix.
+*/
+template <typename T>
+class SlotHandle {
+public:
+  /// Constructs a null handle.
+  constexpr SlotHandle() noexcept = default;
+
+  /// Constructs a handle to slot \a index of generation \a generation.
+  constexpr SlotHandle(uint32_t index, uint32_t generation) noexcept;
+
+  /// Returns the slot index.
+  [[nodiscard]] constexpr uint32_t index() const noexcept;
+
+  /// Returns the generation.
+  [[nodiscard]] constexpr uint32_t generation() const noexcept;
+
+  /// Returns the packed value, for storage and serialization.
+  [[nodiscard]] constexpr uint32_t value() const noexcept;
+
+  /// Returns whether the handle is not null; it may still be stale.
+  [[nodiscard]] constexpr explicit operator bool() const noexcept;
+
+  /// Compares the packed values.
+  [[nodiscard]] constexpr bool operator==(const SlotHandle & other) const noexcept = default;
+
+private:
+  /// Generation in the high bits, index in the low bits
+  uint32_t _value{0};
+};
+
+/*!
+  \brief Pool of at most \a N objects addressed by generational handles, stored densely.
+
+  Objects live in one packed array, so iteration walks contiguous memory with no holes. Handles find them through
+  an indirection table of slots:
+
+  - insert() and emplace() take a free slot, construct the object at the end of the packed array, and return a handle.
+  - erase() moves the last object into the hole and advances the slot generation. Both are O(1); erasure changes the
+    order of the objects.
+  - find() returns \c nullptr for a stale or null handle. operator[] expects a live handle and reports a stale one
+    through \ref toy::assertion in debug builds.
+
+  Storage is inline, as in \ref toy::FixedVector, so a pool needs no heap and can live in static memory or in an
+  arena. Erasure relocates the last object with \c memcpy when \a T is trivially relocatable (see
+  \ref toy::IsTriviallyRelocatable).
+
+  \code
+  toy::SlotMap<Sprite, 512> sprites;
+
+  const auto player = sprites.emplace(playerTexture, position);
+  // ...
+  for (Sprite & sprite : sprites)
+    sprite.update(step);
+
+  if (Sprite * sprite = sprites.find(player))
+    sprite->flash();
+  \endcode
+
+  \tparam T Object type.
+  \tparam N Capacity; greater than 0 and at most 2^\ref c_slotIndexBits.
+*/
+template <typename T, size_t N>
+class SlotMap {
+  static_assert(N > 0 && N <= (size_t{1} << c_slotIndexBits), "SlotMap capacity must be in 1..2^c_slotIndexBits");
+
+public:
+  /// Object type
+  using value_type = T;
+
+  /// Handle type
+  using handle_type = SlotHandle<T>;
+
+  /// Mutable iterator over the packed objects
+  using iterator = T *;
+
+  /// Read-only iterator over the packed objects
+  using const_iterator = const T *;
+
+  /// Constructs an empty pool.
+  SlotMap() noexcept;
+
+  SlotMap(const SlotMap &)             = delete;
+  SlotMap & operator=(const SlotMap &) = delete;
+
+  /// Destroys the objects.
+  ~SlotMap() noexcept;
+
+  /// Inserts a copy of \a value; returns a null handle when the pool is full.
+  handle_type insert(const T & value) noexcept;
+
+  /// Inserts \a value by move; returns a null handle when the pool is full.
+  handle_type insert(T && value) noexcept;
+
+  /// Constructs an object from \a arguments; returns a null handle when the pool is full.
+  template <typename... Args>
+  handle_type emplace(Args &&... arguments) noexcept;
+
+  /// Destroys the object of \a handle; returns false, doing nothing, when the handle is stale or null.
+  bool erase(handle_type handle) noexcept;
+
+  /// Returns whether \a handle refers to a live object.
+  [[nodiscard]] bool contains(handle_type handle) const noexcept;
+
+  /// Returns the object of \a handle, or \c nullptr when the handle is stale or null.
+  [[nodiscard]] T * find(handle_type handle) noexcept;
+
+  /// Returns the object of \a handle, or \c nullptr when the handle is stale or null.
+  [[nodiscard]] const T * find(handle_type handle) const noexcept;
+
+  /// Returns the object of \a handle, which must be live; a stale handle fails an assertion in debug builds.
+  [[nodiscard]] T & operator[](handle_type handle) noexcept;
+
+  /// Returns the object of \a handle, which must be live; a stale handle fails an assertion in debug builds.
+  [[nodiscard]] const T & operator[](handle_type handle) const noexcept;
+
+  /// Returns the handle of the object at \a position of the packed array, for use while iterating.
+  [[nodiscard]] handle_type handleOf(const_iterator position) const noexcept;
+
+  /// Returns the first packed object.
+  [[nodiscard]] T * data() noexcept;
+
+  /// Returns the first packed object.
+  [[nodiscard]] const T * data() const noexcept;
+
+  /// Returns an iterator to the first packed object.
+  [[nodiscard]] iterator begin() noexcept;
+
+  /// Returns an iterator to the first packed object.
+  [[nodiscard]] const_iterator begin() const noexcept;
+
+  /// Returns an iterator past the last packed object.
+  [[nodiscard]] iterator end() noexcept;
+
+  /// Returns an iterator past the last packed object.
+  [[nodiscard]] const_iterator end() const noexcept;
+
+  /// Returns whether the pool holds no objects.
+  [[nodiscard]] bool empty() const noexcept;
+
+  /// Returns whether the pool holds \a N objects.
+  [[nodiscard]] bool full() const noexcept;
+
+  /// Returns the number of objects.
+  [[nodiscard]] size_t size() const noexcept;
+
+  /// Returns \a N.
+  [[nodiscard]] static constexpr size_t capacity() noexcept;
+
+  /// Destroys every object; all handles given out so far become stale.
+  void clear() noexcept;
+
+private:
+  /// Marks a slot as the end of the free list
+  static constexpr uint32_t c_noSlot = ~uint32_t{0};
+
+  /// Entry of the indirection table.
+  struct Slot {
+    /// Position of the object in the packed array while live; next free slot while free
+    uint32_t link;
+
+    /// Generation of the current or next object of the slot
+    uint32_t generation;
+  };
+
+  /// Takes a free slot for a new object at the end of the packed array; \ref c_noSlot when the pool is full.
+  uint32_t acquireSlot() noexcept;
+
+  /// Returns the packed position of the object of \a handle, or \ref c_noSlot when the handle is stale or null.
+  uint32_t positionOf(handle_type handle) const noexcept;
+
+  union {
+    /// Packed objects; only the first \ref _size hold live objects
+    T _data[N];
+  };
+
+  /// Indirection table, indexed by handle index
+  array<Slot, N> _slots;
+
+  /// Slot of each packed object
+  array<uint32_t, N> _owners;
+
+  /// Number of live objects
+  uint32_t _size{0};
+
+  /// Slots ever used; those at and above it are free and not linked
+  uint32_t _used{0};
+
+  /// First free slot below \ref _used, or \ref c_noSlot
+  uint32_t _freeHead{c_noSlot};
+};
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_SLOT_MAP_HPP_
@@ -0,0 +1,275 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   slot_map.inl
+  \brief  Inline definitions for \ref toy::SlotHandle and \ref toy::SlotMap.
+
+  The slot table is filled lazily: slots at and above the used mark have never held an object, so a new pool costs
+  nothing to construct whatever its capacity.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_SLOT_MAP_INL_
+#define INCLUDE_CORE_SLOT_MAP_INL_
+
+namespace toy {
+
+namespace slots {
+
+/// Mask of the slot index in a packed handle
+inline constexpr uint32_t c_indexMask = (uint32_t{1} << c_slotIndexBits) - 1;
+
+/// Mask of the generation once shifted down
+inline constexpr uint32_t c_generationMask = ~uint32_t{0} >> c_slotIndexBits;
+
+/// Returns the generation after \a generation, skipping 0, which null handles use.
+[[nodiscard]] constexpr uint32_t nextGeneration(uint32_t generation) noexcept {
+  const uint32_t next = (generation + 1) & c_generationMask;
+
+  return next != 0 ? next : 1;
+}
+
+} // namespace slots
+
+template <typename T>
+constexpr SlotHandle<T>::SlotHandle(uint32_t index, uint32_t generation) noexcept
+  : _value((generation << c_slotIndexBits) | (index & slots::c_indexMask)) {}
+
+template <typename T>
+constexpr uint32_t SlotHandle<T>::index() const noexcept {
+  return _value & slots::c_indexMask;
+}
+
+template <typename T>
+constexpr uint32_t SlotHandle<T>::generation() const noexcept {
+  return _value >> c_slotIndexBits;
+}
+
+template <typename T>
+constexpr uint32_t SlotHandle<T>::value() const noexcept {
+  return _value;
+}
+
+template <typename T>
+constexpr SlotHandle<T>::operator bool() const noexcept {
+  return _value != 0;
+}
+
+template <typename T, size_t N>
+SlotMap<T, N>::SlotMap() noexcept {}
+
+template <typename T, size_t N>
+SlotMap<T, N>::~SlotMap() noexcept {
+  std::destroy_n(_data, _size);
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::insert(const T & value) noexcept -> handle_type {
+  return emplace(value);
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::insert(T && value) noexcept -> handle_type {
+  return emplace(std::move(value));
+}
+
+template <typename T, size_t N>
+template <typename... Args>
+auto SlotMap<T, N>::emplace(Args &&... arguments) noexcept -> handle_type {
+  const uint32_t slot = acquireSlot();
+
+  if (slot == c_noSlot) [[unlikely]]
+    return {};
+
+  std::construct_at(_data + _size, std::forward<Args>(arguments)...);
+  _slots[slot].link = _size;
+  _owners[_size]    = slot;
+  ++_size;
+
+  return {slot, _slots[slot].generation};
+}
+
+template <typename T, size_t N>
+bool SlotMap<T, N>::erase(handle_type handle) noexcept {
+  const uint32_t position = positionOf(handle);
+
+  if (position == c_noSlot)
+    return false;
+
+  // Fill the hole with the last object, so the packed array stays without gaps
+  const uint32_t last = _size - 1;
+  std::destroy_at(_data + position);
+
+  if (position != last) {
+    if constexpr (isTriviallyRelocatable<T>) {
+      std::memcpy(static_cast<void *>(_data + position), static_cast<const void *>(_data + last), sizeof(T));
+    } else {
+      std::construct_at(_data + position, std::move(_data[last]));
+      std::destroy_at(_data + last);
+    }
+
+    _owners[position]              = _owners[last];
+    _slots[_owners[position]].link = position;
+  }
+
+  Slot & slot     = _slots[handle.index()];
+  slot.generation = slots::nextGeneration(slot.generation);
+  slot.link       = _freeHead;
+  _freeHead       = handle.index();
+  _size           = last;
+
+  return true;
+}
+
+template <typename T, size_t N>
+bool SlotMap<T, N>::contains(handle_type handle) const noexcept {
+  return positionOf(handle) != c_noSlot;
+}
+
+template <typename T, size_t N>
+T * SlotMap<T, N>::find(handle_type handle) noexcept {
+  const uint32_t position = positionOf(handle);
+
+  return position != c_noSlot ? _data + position : nullptr;
+}
+
+template <typename T, size_t N>
+const T * SlotMap<T, N>::find(handle_type handle) const noexcept {
+  const uint32_t position = positionOf(handle);
+
+  return position != c_noSlot ? _data + position : nullptr;
+}
+
+template <typename T, size_t N>
+T & SlotMap<T, N>::operator[](handle_type handle) noexcept {
+  assert_message(contains(handle), "stale or null slot map handle");
+
+  return _data[_slots[handle.index()].link];
+}
+
+template <typename T, size_t N>
+const T & SlotMap<T, N>::operator[](handle_type handle) const noexcept {
+  assert_message(contains(handle), "stale or null slot map handle");
+
+  return _data[_slots[handle.index()].link];
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::handleOf(const_iterator position) const noexcept -> handle_type {
+  const uint32_t slot = _owners[static_cast<size_t>(position - _data)];
+
+  return {slot, _slots[slot].generation};
+}
+
+template <typename T, size_t N>
+T * SlotMap<T, N>::data() noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+const T * SlotMap<T, N>::data() const noexcept {
+  return _data;
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::begin() noexcept -> iterator {
+  return _data;
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::begin() const noexcept -> const_iterator {
+  return _data;
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::end() noexcept -> iterator {
+  return _data + _size;
+}
+
+template <typename T, size_t N>
+auto SlotMap<T, N>::end() const noexcept -> const_iterator {
+  return _data + _size;
+}
+
+template <typename T, size_t N>
+bool SlotMap<T, N>::empty() const noexcept {
+  return _size == 0;
+}
+
+template <typename T, size_t N>
+bool SlotMap<T, N>::full() const noexcept {
+  return _size == N;
+}
+
+template <typename T, size_t N>
+size_t SlotMap<T, N>::size() const noexcept {
+  return _size;
+}
+
+template <typename T, size_t N>
+constexpr size_t SlotMap<T, N>::capacity() noexcept {
+  return N;
+}
+
+template <typename T, size_t N>
+void SlotMap<T, N>::clear() noexcept {
+  for (uint32_t position = 0; position < _size; ++position) {
+    Slot & slot     = _slots[_owners[position]];
+    slot.generation = slots::nextGeneration(slot.generation);
+    slot.link       = _freeHead;
+    _freeHead       = _owners[position];
+  }
+
+  std::destroy_n(_data, _size);
+  _size = 0;
+}
+
+template <typename T, size_t N>
+uint32_t SlotMap<T, N>::acquireSlot() noexcept {
+  if (_freeHead != c_noSlot) {
+    const uint32_t slot = _freeHead;
+    _freeHead           = _slots[slot].link;
+
+    return slot;
+  }
+
+  if (_used == N) [[unlikely]]
+    return c_noSlot;
+
+  _slots[_used].generation = 1;
+
+  return _used++;
+}
+
+template <typename T, size_t N>
+uint32_t SlotMap<T, N>::positionOf(handle_type handle) const noexcept {
+  const uint32_t index = handle.index();
+
+  // A free slot has already moved on to the generation of its next object, so the generation check covers it
+  if (index >= _used || _slots[index].generation != handle.generation())
+    return c_noSlot;
+
+  return _slots[index].link;
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_SLOT_MAP_INL_
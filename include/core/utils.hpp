@@ -0,0 +1,777 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   utils.hpp
+  \brief  Core string and UTF-8 utilities.
+
+  Declares the bulk UTF-8 routines of namespace \ref toy: validation, code point counting, and transcoding between UTF-8
+  and UTF-16 or UTF-32. Each routine works on a whole buffer at once. Desktop builds step over runs of ASCII 16 or 32
+  code units at a time with SSE2, AVX2, or NEON, and fall back to the table-driven decoder for multi-byte sequences.
+  Targets without a vector unit (GBA, Sega MD, NDS) always use the table-driven decoder, which is also exposed as
+  \ref toy::scalar for reference and benchmarking.
+
+  The same header declares the byte-string kernels behind \ref toy::FixedString: compareChars(), findChar(), and
+  findSubstring(). They use the same vector blocks on desktop and compare one machine word at a time elsewhere.
+
+  Number conversions round out the set: toChars() and fromChars() replace \c std::to_chars and \c std::from_chars for
+  integers, \c float, and \c double. They are \c constexpr, never allocate or read the locale, and use integer
+  arithmetic only, so 32-bit targets without an FPU run them without soft-float calls. Shortest float output always
+  reads back as the same value, and parsing rounds correctly.
+
+  Transcoding never allocates. The caller sizes the destination with the matching length routine, which computes the
+  exact output size in one pass over valid input, and then converts into that buffer:
+
+  \code
+  const size_t length = toy::utf16LengthFromUtf8(text, size);
+  // ... obtain a char16_t buffer of 'length' units ...
+  const toy::TranscodeResult result = toy::utf8ToUtf16(text, size, buffer);
+  \endcode
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_UTILS_HPP_
+#define INCLUDE_CORE_UTILS_HPP_
+
+namespace toy {
+
+/*!
+  \brief Outcome of a bulk decoding or transcoding call.
+
+  A call succeeds when \ref read equals the source size. Otherwise \ref read is the offset of the first code unit that
+  does not begin a valid sequence (invalid, overlong, surrogate, out of range, or truncated by the end of the buffer),
+  and \ref written counts the code units produced from the valid prefix before it.
+*/
+struct TranscodeResult {
+  /// Source code units consumed; on failure, the offset of the first invalid sequence
+  size_t read;
+
+  /// Destination code units written
+  size_t written;
+};
+
+/*!
+  \brief Returns the length of the longest valid UTF-8 prefix of a buffer.
+
+  Rejects everything RFC 3629 forbids: stray continuation bytes, overlong forms, UTF-16 surrogates (U+D800-U+DFFF),
+  code points above U+10FFFF, and sequences cut short by the end of the buffer.
+
+  \param string Buffer to validate; may be \c nullptr when \a size is 0.
+  \param size   Buffer size in bytes.
+
+  \return \a size when the whole buffer is valid, otherwise the offset of the first invalid sequence.
+
+  \sa isValidUtf8()
+*/
+[[nodiscard]] size_t utf8ValidLength(const char * string, size_t size) noexcept;
+
+/*!
+  \brief Checks whether a buffer holds only well-formed UTF-8.
+
+  \param string Buffer to validate; may be \c nullptr when \a size is 0.
+  \param size   Buffer size in bytes.
+
+  \return \c true when every byte belongs to a valid sequence.
+
+  \sa utf8ValidLength()
+*/
+[[nodiscard]] inline bool isValidUtf8(const char * string, size_t size) noexcept {
+  return utf8ValidLength(string, size) == size;
+}
+
+/*!
+  \brief Counts the code points in a UTF-8 buffer.
+
+  \param string Buffer to measure; may be \c nullptr when \a size is 0.
+  \param size   Buffer size in bytes.
+
+  \return Number of code points, which is also the number of \c char32_t units utf8ToUtf32() writes.
+
+  \pre \a string holds valid UTF-8 (see utf8ValidLength()); on invalid input the result is unspecified.
+*/
+[[nodiscard]] size_t utf8CodePointCount(const char * string, size_t size) noexcept;
+
+/*!
+  \brief Decodes a UTF-8 buffer to UTF-32, validating it on the way.
+
+  Stops at the first invalid sequence; everything before it is decoded.
+
+  \param source      UTF-8 buffer; may be \c nullptr when \a size is 0.
+  \param size        Source size in bytes.
+  \param destination Output buffer with room for utf8CodePointCount() of the valid prefix.
+
+  \return Bytes read and code points written; see \ref toy::TranscodeResult.
+*/
+TranscodeResult utf8ToUtf32(const char * source, size_t size, char32_t * destination) noexcept;
+
+/*!
+  \brief Returns the number of UTF-16 code units needed to hold a UTF-8 buffer.
+
+  \param string UTF-8 buffer; may be \c nullptr when \a size is 0.
+  \param size   Buffer size in bytes.
+
+  \return Exact size utf8ToUtf16() writes; code points above U+FFFF count as a surrogate pair.
+
+  \pre \a string holds valid UTF-8 (see utf8ValidLength()); on invalid input the result is unspecified.
+*/
+[[nodiscard]] size_t utf16LengthFromUtf8(const char * string, size_t size) noexcept;
+
+/*!
+  \brief Returns the number of UTF-8 bytes needed to hold a UTF-16 buffer.
+
+  \param string UTF-16 buffer; may be \c nullptr when \a size is 0.
+  \param size   Buffer size in code units.
+
+  \return Exact size utf16ToUtf8() writes.
+
+  \pre \a string holds valid UTF-16: every surrogate is part of a high-low pair. On invalid input the result is
+  unspecified.
+*/
+[[nodiscard]] size_t utf8LengthFromUtf16(const char16_t * string, size_t size) noexcept;
+
+/*!
+  \brief Returns the number of UTF-8 bytes needed to hold a UTF-32 buffer.
+
+  \param string UTF-32 buffer; may be \c nullptr when \a size is 0.
+  \param size   Buffer size in code points.
+
+  \return Exact size utf32ToUtf8() writes.
+
+  \pre Every element of \a string is a Unicode scalar value (at most U+10FFFF and not a surrogate). On invalid input
+  the result is unspecified.
+*/
+[[nodiscard]] size_t utf8LengthFromUtf32(const char32_t * string, size_t size) noexcept;
+
+/*!
+  \brief Transcodes a UTF-8 buffer to UTF-16, validating it on the way.
+
+  Stops at the first invalid UTF-8 sequence; everything before it is converted.
+
+  \param source      UTF-8 buffer; may be \c nullptr when \a size is 0.
+  \param size        Source size in bytes.
+  \param destination Output buffer with room for utf16LengthFromUtf8() of the valid prefix.
+
+  \return Bytes read and UTF-16 code units written; see \ref toy::TranscodeResult.
+*/
+TranscodeResult utf8ToUtf16(const char * source, size_t size, char16_t * destination) noexcept;
+
+/*!
+  \brief Transcodes a UTF-16 buffer to UTF-8, validating it on the way.
+
+  Stops at the first unpaired surrogate; everything before it is converted.
+
+  \param source      UTF-16 buffer; may be \c nullptr when \a size is 0.
+  \param size        Source size in code units.
+  \param destination Output buffer with room for utf8LengthFromUtf16() of the valid prefix.
+
+  \return Code units read and bytes written; see \ref toy::TranscodeResult.
+*/
+TranscodeResult utf16ToUtf8(const char16_t * source, size_t size, char * destination) noexcept;
+
+/*!
+  \brief Transcodes a UTF-32 buffer to UTF-8, validating it on the way.
+
+  Stops at the first element that is a surrogate or lies above U+10FFFF; everything before it is converted.
+
+  \param source      UTF-32 buffer; may be \c nullptr when \a size is 0.
+  \param size        Source size in code points.
+  \param destination Output buffer with room for utf8LengthFromUtf32() of the valid prefix.
+
+  \return Code points read and bytes written; see \ref toy::TranscodeResult.
+*/
+TranscodeResult utf32ToUtf8(const char32_t * source, size_t size, char * destination) noexcept;
+
+/*!
+  \brief Lexicographically compares two byte ranges of equal size.
+
+  Bytes compare as \c unsigned \c char, as in \c std::memcmp.
+
+  \param left  First range; may be \c nullptr when \a size is 0.
+  \param right Second range; may be \c nullptr when \a size is 0.
+  \param size  Bytes to compare.
+
+  \return Negative, zero, or positive when \a left orders before, equal to, or after \a right.
+*/
+[[nodiscard]] int compareChars(const char * left, const char * right, size_t size) noexcept;
+
+/*!
+  \brief Finds the first occurrence of a character in a buffer.
+
+  \param string    Buffer to search; may be \c nullptr when \a size is 0.
+  \param size      Buffer size in bytes.
+  \param character Character to find.
+
+  \return Pointer to the first match, or \c nullptr when \a character does not occur.
+*/
+[[nodiscard]] const char * findChar(const char * string, size_t size, char character) noexcept;
+
+/*!
+  \brief Finds the first occurrence of a byte pattern in a buffer.
+
+  Desktop builds test a whole vector block of candidate positions per step against the first and last pattern bytes,
+  then compare the full pattern only where both match.
+
+  \param string      Buffer to search; may be \c nullptr when \a size is 0.
+  \param size        Buffer size in bytes.
+  \param pattern     Pattern to find; may be \c nullptr when \a patternSize is 0.
+  \param patternSize Pattern size in bytes.
+
+  \return Pointer to the first match, \a string for an empty pattern, or \c nullptr when the pattern does not occur.
+*/
+[[nodiscard]] const char * findSubstring(const char * string, size_t size, const char * pattern,
+                                         size_t patternSize) noexcept;
+
+/// Failure of fromChars(), as the \c std::errc of \c std::from_chars.
+enum class ParseError : uint8_t {
+  /// The number was read and stored
+  None,
+
+  /// The text does not start with a number; nothing was read
+  InvalidArgument,
+
+  /// The number does not fit the destination, which keeps its value
+  OutOfRange,
+};
+
+/// Outcome of fromChars(), as \c std::from_chars_result.
+struct ParseResult {
+  /// First character past the number; the start of the text on ParseError::InvalidArgument
+  const char * end;
+
+  /// What went wrong, if anything
+  ParseError error;
+};
+
+/// Notation of a floating-point value printed with a precision, as \c std::chars_format.
+enum class FloatFormat : uint8_t {
+  /// <tt>d.ddde+dd</tt> with \a precision digits after the point, as \c %e
+  Scientific,
+
+  /// <tt>ddd.ddd</tt> with \a precision digits after the point, as \c %f
+  Fixed,
+
+  /// Scientific or fixed, whichever \c %g picks for \a precision significant digits, without trailing zeros
+  General,
+
+  /// <tt>h.hhhp+d</tt> with \a precision hexadecimal digits after the point, or as many as the value needs when
+  /// \a precision is negative, as \c %a without the \c 0x prefix
+  Hex,
+};
+
+/// Most characters toChars() writes for an integer: a sign and 64 binary digits
+inline constexpr size_t c_maxIntegerChars = 65;
+
+/// Most characters toChars() writes for the shortest form of a \c float or \c double, as in "-2.2250738585072014e-308"
+inline constexpr size_t c_maxShortestFloatChars = 24;
+
+/// Returns the most characters toChars() writes for a floating-point value in \a format with \a precision.
+[[nodiscard]] constexpr size_t maxFloatChars(FloatFormat format, int32_t precision) noexcept;
+
+/*!
+  \brief Writes an integer in the given base, as \c std::to_chars does.
+
+  Decimal output comes two digits at a time from a pair table; values above 32 bits drop eight digits at a time first,
+  so the remaining divisions run on 32-bit registers. Digits above 9 are lowercase letters.
+
+  \param buffer Destination with room for \ref c_maxIntegerChars characters; no terminator is written.
+  \param value  Value to write; \c bool is not accepted.
+  \param base   Base from 2 to 36.
+
+  \return Pointer past the last character written.
+*/
+template <typename T>
+  requires std::is_integral_v<T> && (!std::is_same_v<std::remove_cv_t<T>, bool>)
+constexpr char * toChars(char * buffer, T value, int32_t base = 10) noexcept;
+
+/*!
+  \brief Writes the shortest text that reads back as the same value, as \c std::to_chars does without a format.
+
+  The digits come from the Schubfach algorithm, which picks the shortest decimal inside the rounding interval of the
+  value with a handful of 64-bit and 128-bit multiplications. Fixed or scientific notation is chosen as in
+  \c std::to_chars: whichever is shorter, fixed on a tie. Infinities print as \c inf and NaNs as \c nan.
+
+  \param buffer Destination with room for \ref c_maxShortestFloatChars characters; no terminator is written.
+  \param value  Value to write.
+
+  \return Pointer past the last character written.
+*/
+constexpr char * toChars(char * buffer, double value) noexcept;
+
+/// Shortest text of a \c float; same contract as toChars(char *, double), with digits chosen for \c float precision.
+constexpr char * toChars(char * buffer, float value) noexcept;
+
+/*!
+  \brief Writes a floating-point value with a precision, as \c std::to_chars does with a format and a precision.
+
+  Decimal output is exact and rounds half to even on the exact binary value, like \c printf in the C library. It works
+  on the bit pattern with integer arithmetic only, so targets without an FPU never call soft-float routines; common
+  magnitudes run on 64-bit words, and only values with long expansions fall back to a fixed-size big integer.
+
+  \param buffer    Destination with room for maxFloatChars() characters; no terminator is written.
+  \param value     Value to write.
+  \param format    Notation.
+  \param precision Digits after the point, or significant digits for FloatFormat::General, where 0 counts as 1. A
+                   negative value selects 6, except for FloatFormat::Hex where it selects as many digits as needed.
+
+  \return Pointer past the last character written.
+*/
+constexpr char * toChars(char * buffer, double value, FloatFormat format, int32_t precision) noexcept;
+
+/// \c float overload of toChars(char *, double, FloatFormat, int32_t); decimal output is that of the same value as a
+/// \c double, and FloatFormat::Hex uses the \c float layout of the digits.
+constexpr char * toChars(char * buffer, float value, FloatFormat format, int32_t precision) noexcept;
+
+/*!
+  \brief Reads a decimal integer, as \c std::from_chars does with base 10.
+
+  Accepts an optional \c '-' for signed types followed by one or more digits, and no leading whitespace or \c '+'.
+  Eight digits at a time are checked and combined inside one 64-bit word (SWAR) before the per-digit tail.
+
+  \param first First character of the text.
+  \param last  End of the text.
+  \param value Receives the number; left unchanged unless the result is ParseError::None.
+
+  \return End of the number and the error, if any; see \ref toy::ParseResult.
+*/
+template <typename T>
+  requires std::is_integral_v<T> && (!std::is_same_v<std::remove_cv_t<T>, bool>)
+constexpr ParseResult fromChars(const char * first, const char * last, T & value) noexcept;
+
+/*!
+  \brief Reads a decimal floating-point number, as \c std::from_chars does in the general format.
+
+  Accepts an optional \c '-', digits with an optional point, and an optional exponent, or \c inf, \c infinity, and
+  \c nan in any case. The result is correctly rounded: up to 19 significant digits go through the Eisel-Lemire
+  algorithm, which needs one or two 64 x 64-bit multiplications and no FPU. Longer input that those digits cannot
+  settle is compared exactly against the halfway point with a big integer. Values too large for \a T, and nonzero
+  values that round to zero, give ParseError::OutOfRange; subnormal results are not an error.
+
+  \param first First character of the text.
+  \param last  End of the text.
+  \param value Receives the number; left unchanged unless the result is ParseError::None.
+
+  \return End of the number and the error, if any; see \ref toy::ParseResult.
+*/
+constexpr ParseResult fromChars(const char * first, const char * last, double & value) noexcept;
+
+/// \c float overload of fromChars(const char *, const char *, double &); rounds once, directly to \c float.
+constexpr ParseResult fromChars(const char * first, const char * last, float & value) noexcept;
+
+/*!
+  \namespace toy::scalar
+
+  \brief Portable reference implementations of the vectorized core routines.
+
+  Each function here has the same contract and results as its counterpart in \ref toy, but processes one code unit or
+  one sequence per step through lookup tables, or one machine word per step for the byte-string kernels. These are the
+  implementations retro targets run; desktop builds keep them for tests and benchmarks that compare the two paths.
+*/
+namespace scalar {
+
+/// Table-driven utf8ValidLength(); same contract and result
+[[nodiscard]] size_t utf8ValidLength(const char * string, size_t size) noexcept;
+
+/// Table-driven utf8CodePointCount(); same contract and result
+[[nodiscard]] size_t utf8CodePointCount(const char * string, size_t size) noexcept;
+
+/// Table-driven utf8ToUtf32(); same contract and result
+TranscodeResult utf8ToUtf32(const char * source, size_t size, char32_t * destination) noexcept;
+
+/// Table-driven utf16LengthFromUtf8(); same contract and result
+[[nodiscard]] size_t utf16LengthFromUtf8(const char * string, size_t size) noexcept;
+
+/// Per-unit utf8LengthFromUtf16(); same contract and result
+[[nodiscard]] size_t utf8LengthFromUtf16(const char16_t * string, size_t size) noexcept;
+
+/// Per-unit utf8LengthFromUtf32(); same contract and result
+[[nodiscard]] size_t utf8LengthFromUtf32(const char32_t * string, size_t size) noexcept;
+
+/// Table-driven utf8ToUtf16(); same contract and result
+TranscodeResult utf8ToUtf16(const char * source, size_t size, char16_t * destination) noexcept;
+
+/// Per-unit utf16ToUtf8(); same contract and result
+TranscodeResult utf16ToUtf8(const char16_t * source, size_t size, char * destination) noexcept;
+
+/// Per-unit utf32ToUtf8(); same contract and result
+TranscodeResult utf32ToUtf8(const char32_t * source, size_t size, char * destination) noexcept;
+
+/// Word-at-a-time compareChars(); same contract and result
+[[nodiscard]] int compareChars(const char * left, const char * right, size_t size) noexcept;
+
+/// Word-at-a-time findChar(); same contract and result
+[[nodiscard]] const char * findChar(const char * string, size_t size, char character) noexcept;
+
+/// Word-at-a-time findSubstring(); same contract and result
+[[nodiscard]] const char * findSubstring(const char * string, size_t size, const char * pattern,
+                                         size_t patternSize) noexcept;
+
+} // namespace scalar
+
+/*!
+  \namespace toy::conversion
+
+  \brief Building blocks of toChars() and fromChars().
+
+  Everything here is \c constexpr, so constant evaluation and runtime calls run the same arithmetic, and none of it
+  uses floating-point instructions: values are taken apart through their bit patterns. Engine code calls toChars() and
+  fromChars() instead.
+*/
+namespace conversion {
+
+/// Unsigned 128-bit value split into 64-bit halves.
+struct Uint128 {
+  /// Upper 64 bits
+  uint64_t high;
+
+  /// Lower 64 bits
+  uint64_t low;
+};
+
+/// Decimal floating-point value: \ref significand x 10^\ref exponent.
+struct DecimalFloat {
+  /// Decimal digits of the value
+  uint64_t significand;
+
+  /// Power of ten applied to the digits
+  int32_t exponent;
+};
+
+/// Binary layout and conversion limits of an IEEE 754 type; specialized for \c float and \c double.
+template <typename T>
+struct FloatTraits;
+
+template <>
+struct FloatTraits<float> {
+  /// Unsigned integer holding the bit pattern
+  using Bits = uint32_t;
+
+  /// Stored significand bits, without the hidden bit
+  static constexpr int32_t c_mantissaBits = 23;
+
+  /// Bias of the exponent field
+  static constexpr int32_t c_exponentBias = 127;
+
+  /// Exponent field of infinities and NaNs
+  static constexpr int32_t c_exponentMask = 0xFF;
+
+  /// Decimal exponents below this parse as zero, whatever the 19 leading digits
+  static constexpr int32_t c_minPowerOfTen = -64;
+
+  /// Decimal exponents above this parse as infinity, whatever the 19 leading digits
+  static constexpr int32_t c_maxPowerOfTen = 38;
+
+  /// Decimal exponents whose products can land exactly halfway between two values
+  static constexpr int32_t c_minRoundToEven = -17;
+
+  /// Upper end of the round-to-even range
+  static constexpr int32_t c_maxRoundToEven = 10;
+
+  /// Significant digits that can decide the rounding of a parsed number
+  static constexpr uint32_t c_maxDigits = 114;
+};
+
+template <>
+struct FloatTraits<double> {
+  /// Unsigned integer holding the bit pattern
+  using Bits = uint64_t;
+
+  /// Stored significand bits, without the hidden bit
+  static constexpr int32_t c_mantissaBits = 52;
+
+  /// Bias of the exponent field
+  static constexpr int32_t c_exponentBias = 1023;
+
+  /// Exponent field of infinities and NaNs
+  static constexpr int32_t c_exponentMask = 0x7FF;
+
+  /// Decimal exponents below this parse as zero, whatever the 19 leading digits
+  static constexpr int32_t c_minPowerOfTen = -342;
+
+  /// Decimal exponents above this parse as infinity, whatever the 19 leading digits
+  static constexpr int32_t c_maxPowerOfTen = 308;
+
+  /// Decimal exponents whose products can land exactly halfway between two values
+  static constexpr int32_t c_minRoundToEven = -4;
+
+  /// Upper end of the round-to-even range
+  static constexpr int32_t c_maxRoundToEven = 23;
+
+  /// Significant digits that can decide the rounding of a parsed number
+  static constexpr uint32_t c_maxDigits = 769;
+};
+
+/// Smallest exponent of the normalized power-of-ten table: the parsing limit of \c double
+inline constexpr int32_t c_minTablePower = -342;
+
+/// Largest exponent of the normalized power-of-ten table: the shortest-digit search of the smallest subnormal
+inline constexpr int32_t c_maxTablePower = 324;
+
+/// Integer powers of ten from 10^0 to 10^19
+inline constexpr array<uint64_t, 20> c_powersOfTen{1U, 10U, 100U, 1000U, 10000U, 100000U, 1000000U, 10000000U,
+                                                   100000000U, 1000000000U, 10000000000U, 100000000000U, 1000000000000U,
+                                                   10000000000000U, 100000000000000U, 1000000000000000U,
+                                                   10000000000000000U, 100000000000000000U, 1000000000000000000U,
+                                                   10000000000000000000U};
+
+/// Returns the 128-bit product of two values.
+[[nodiscard]] constexpr Uint128 multiply(uint64_t left, uint64_t right) noexcept;
+
+/// Returns floor(log2(10^\a exponent)) for exponents within the power-of-ten table.
+[[nodiscard]] constexpr int32_t floorLog2Pow10(int32_t exponent) noexcept;
+
+/// Returns 10^\a exponent scaled into [2^127, 2^128) and rounded up, for exponents within the table.
+[[nodiscard]] constexpr Uint128 normalizedPowerOfTen(int32_t exponent) noexcept;
+
+/// Returns the number of decimal digits of \a value; 1 for zero.
+[[nodiscard]] constexpr int32_t decimalDigitCount(uint64_t value) noexcept;
+
+/// Copies \a count characters from \a source to \a destination; the ranges may overlap.
+constexpr void moveChars(char * destination, const char * source, size_t count) noexcept;
+
+/// Writes \a count copies of \a character and returns the pointer past them.
+constexpr char * fillChars(char * buffer, size_t count, char character) noexcept;
+
+/// Writes exactly \a count decimal digits of \a value, padded with leading zeros, two digits per table lookup.
+constexpr char * writeDigits(char * buffer, uint32_t value, uint32_t count) noexcept;
+
+/// Writes \a value in decimal without leading zeros.
+constexpr char * writeDecimal(char * buffer, uint64_t value) noexcept;
+
+/// Writes \a value in \a base, from 2 to 36, without leading zeros.
+constexpr char * writeInteger(char * buffer, uint64_t value, int32_t base) noexcept;
+
+/// Writes \c e, the sign, and at least two digits of a decimal exponent.
+constexpr char * writeExponent(char * buffer, int32_t exponent) noexcept;
+
+/*!
+  \brief Unsigned integer of up to \ref c_capacity 32-bit limbs, for the exact conversion paths.
+
+  Supports only what those paths need: small multiplications, shifts, division by a small divisor, and comparisons.
+  Limbs are 32 bits wide so every step runs on the native multiplier of 32-bit targets. Operations do not check for
+  overflow; callers stay within the capacity.
+*/
+class BigInteger {
+public:
+  /// Limbs available: the halfway comparison of a parsed \c double needs about 2600 bits
+  static constexpr uint32_t c_capacity = 96;
+
+  /// Creates a big integer holding \a value.
+  constexpr explicit BigInteger(uint64_t value = 0) noexcept;
+
+  /// Checks whether the value is zero.
+  [[nodiscard]] constexpr bool isZero() const noexcept;
+
+  /// Returns the number of bits up to the highest set bit; 0 for zero.
+  [[nodiscard]] constexpr uint32_t bitWidth() const noexcept;
+
+  /// Replaces the value with value x \a factor + \a addend.
+  constexpr void multiplyAdd(uint32_t factor, uint32_t addend = 0) noexcept;
+
+  /// Multiplies the value by 5^\a exponent.
+  constexpr void multiplyPowerOfFive(uint32_t exponent) noexcept;
+
+  /// Multiplies the value by 2^\a bits.
+  constexpr void shiftLeft(uint32_t bits) noexcept;
+
+  /// Divides the value by \a divisor and returns the remainder.
+  constexpr uint32_t divide(uint32_t divisor) noexcept;
+
+  /// Removes and returns the bits from \a bits upwards, which must fit 32 bits; the value keeps the bits below.
+  [[nodiscard]] constexpr uint32_t extractAbove(uint32_t bits) noexcept;
+
+  /// Returns the sign of value - 2^\a exponent.
+  [[nodiscard]] constexpr int32_t compareWithPowerOfTwo(uint32_t exponent) const noexcept;
+
+  /// Returns the sign of value - \a other.
+  [[nodiscard]] constexpr int32_t compare(const BigInteger & other) const noexcept;
+
+private:
+  /// Drops high zero limbs
+  constexpr void trim() noexcept;
+
+  /// Limbs, least significant first
+  array<uint32_t, c_capacity> _limbs{};
+
+  /// Limbs in use; the highest one is nonzero
+  uint32_t _size{0};
+};
+
+/// Writes a big integer of at most 360 digits in decimal without leading zeros.
+constexpr char * writeBigDecimal(char * buffer, BigInteger value) noexcept;
+
+/*!
+  \brief Binary fraction numerator / 2^bits held in one 64-bit word and expanded into decimal digits.
+
+  Each digit costs one multiplication by ten, which cannot overflow while \a bits stays at most \ref c_maxBits. Covers
+  the fractions of every value from about 1/256 upwards.
+*/
+class WordFraction {
+public:
+  /// Largest denominator exponent the word holds
+  static constexpr uint32_t c_maxBits = 60;
+
+  /// Creates the fraction \a numerator / 2^\a bits; \a numerator is below 2^\a bits.
+  constexpr WordFraction(uint64_t numerator, uint32_t bits) noexcept;
+
+  /// Checks whether the remaining fraction is zero.
+  [[nodiscard]] constexpr bool isZero() const noexcept;
+
+  /// Drops the leading zero digits and returns how many there were; the fraction is nonzero.
+  constexpr uint32_t skipZeros() noexcept;
+
+  /// Writes the next \a count digits.
+  constexpr char * write(char * buffer, uint32_t count) noexcept;
+
+  /// Returns the sign of the remaining fraction - 1/2.
+  [[nodiscard]] constexpr int32_t compareHalf() const noexcept;
+
+private:
+  /// Numerator
+  uint64_t _numerator;
+
+  /// Exponent of the denominator
+  uint32_t _bits;
+};
+
+/// Binary fraction with any denominator a \c double needs, expanded nine digits per big-integer step; same interface
+/// as WordFraction.
+class BigFraction {
+public:
+  /// Creates the fraction \a numerator / 2^\a bits; \a numerator is below 2^\a bits.
+  constexpr BigFraction(uint64_t numerator, uint32_t bits) noexcept;
+
+  /// Checks whether the remaining fraction is zero.
+  [[nodiscard]] constexpr bool isZero() const noexcept;
+
+  /// Drops the leading zero digits and returns how many there were; the fraction is nonzero.
+  constexpr uint32_t skipZeros() noexcept;
+
+  /// Writes the next \a count digits.
+  constexpr char * write(char * buffer, uint32_t count) noexcept;
+
+  /// Returns the sign of the remaining fraction - 1/2.
+  [[nodiscard]] constexpr int32_t compareHalf() const noexcept;
+
+private:
+  /// Numerator
+  BigInteger _numerator;
+
+  /// Exponent of the denominator
+  uint32_t _bits;
+};
+
+/// Returns floor(\a power x \a value / 2^128), with the lowest bit set when the product has a fraction (Schubfach).
+[[nodiscard]] constexpr uint64_t roundToOdd(const Uint128 & power, uint64_t value) noexcept;
+
+/// 64-bit form of roundToOdd() for \c float: floor(\a power x \a value / 2^64), with the fraction folded in.
+[[nodiscard]] constexpr uint32_t roundToOdd(uint64_t power, uint32_t value) noexcept;
+
+/// Returns the shortest decimal in the rounding interval of a finite, nonzero value given by its bit fields; the
+/// digits may end in zeros.
+template <typename T>
+[[nodiscard]] constexpr DecimalFloat shortestDecimal(uint64_t significandBits, int32_t exponentBits) noexcept;
+
+/// Checks whether \a significand x 10^\a exponent, without trailing zeros in \a significand, is no longer in fixed
+/// notation than in scientific notation; fixed wins ties, as in \c std::to_chars.
+[[nodiscard]] constexpr bool isFixedShorter(uint64_t significand, int32_t exponent) noexcept;
+
+/// Writes \a significand x 10^\a exponent, without trailing zeros in \a significand, in the shorter of fixed and
+/// scientific notation.
+constexpr char * writeShortestDecimal(char * buffer, uint64_t significand, int32_t exponent) noexcept;
+
+/// Adds one unit in the last place to the decimal digits in [\a first, \a last), skipping a point; returns \c true
+/// when the carry leaves the first digit, which leaves every digit zero.
+constexpr bool incrementDigits(char * first, char * last) noexcept;
+
+/// Writes the integer part and \a precision fraction digits of integer + \a fraction, rounded half to even.
+template <typename Fraction>
+constexpr char * writeFixedDigits(char * buffer, uint64_t integer, Fraction fraction, int32_t precision) noexcept;
+
+/// Writes \a significand x 2^\a exponent in fixed notation with \a precision fraction digits.
+constexpr char * writeFixed(char * buffer, uint64_t significand, int32_t exponent, int32_t precision) noexcept;
+
+/// Writes the first \a count significant digits of the integer text [\a digits, \a end) followed by \a fraction,
+/// truncated; returns the sign of the dropped tail - 1/2 unit and sets \a decimalExponent to the power of ten of the
+/// first digit.
+template <typename Fraction>
+constexpr int32_t writeLeadingDigits(char * buffer, const char * digits, const char * end, Fraction & fraction,
+                                     uint32_t count, int32_t & decimalExponent) noexcept;
+
+/// Writes the first \a count significant digits of a nonzero \a significand x 2^\a exponent, rounded half to even,
+/// and returns the power of ten of the first digit.
+constexpr int32_t writeSignificantDigits(char * buffer, uint64_t significand, int32_t exponent,
+                                         uint32_t count) noexcept;
+
+/// Writes \a significand x 2^\a exponent in scientific notation with \a precision digits after the point.
+constexpr char * writeScientific(char * buffer, uint64_t significand, int32_t exponent, int32_t precision) noexcept;
+
+/// Writes \a significand x 2^\a exponent as \c %g does with \a precision significant digits.
+constexpr char * writeGeneral(char * buffer, uint64_t significand, int32_t exponent, int32_t precision) noexcept;
+
+/// Writes the hexadecimal form of a finite value given by its bit fields, as \c %a does without the prefix.
+template <typename T>
+constexpr char * writeHex(char * buffer, uint64_t significandBits, int32_t exponentBits, int32_t precision) noexcept;
+
+/// Writes the shortest form of any \c float or \c double.
+template <typename T>
+constexpr char * writeShortest(char * buffer, T value) noexcept;
+
+/// Writes any \c float or \c double in \a format with \a precision.
+template <typename T>
+constexpr char * writeFloat(char * buffer, T value, FloatFormat format, int32_t precision) noexcept;
+
+/// Reads 8 bytes as a little-endian value.
+[[nodiscard]] constexpr uint64_t read64(const char * data) noexcept;
+
+/// Checks whether all 8 bytes of a little-endian word are ASCII digits.
+[[nodiscard]] constexpr bool isEightDigits(uint64_t chunk) noexcept;
+
+/// Returns the value of 8 ASCII digits read as a little-endian word, combined inside the word (SWAR).
+[[nodiscard]] constexpr uint32_t parseEightDigits(uint64_t chunk) noexcept;
+
+/// Appends the decimal digits at \a first to \a value, wrapping on overflow, and returns the first non-digit.
+constexpr const char * readDigits(const char * first, const char * last, uint64_t & value) noexcept;
+
+/// Returns the bit pattern, without the sign, nearest to \a significand x 10^\a exponent (Eisel-Lemire); infinity
+/// when it overflows.
+template <typename T>
+[[nodiscard]] constexpr typename FloatTraits<T>::Bits eiselLemire(uint64_t significand, int64_t exponent) noexcept;
+
+/// Picks \a lower or the next value up for the decimal digits in [\a first, \a last), which may hold a point, times
+/// 10^\a exponent, by an exact comparison with the halfway point between the two.
+template <typename T>
+[[nodiscard]] constexpr typename FloatTraits<T>::Bits resolveHalfway(typename FloatTraits<T>::Bits lower,
+                                                                     const char * first, const char * last,
+                                                                     int64_t exponent) noexcept;
+
+/// Reads \c inf, \c infinity, or \c nan with an optional character sequence in parentheses, starting at \a cursor.
+template <typename T>
+constexpr ParseResult parseSpecial(const char * first, const char * cursor, const char * last,
+                                   typename FloatTraits<T>::Bits sign, T & value) noexcept;
+
+/// Reads a \c float or \c double.
+template <typename T>
+constexpr ParseResult parseFloat(const char * first, const char * last, T & value) noexcept;
+
+} // namespace conversion
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_UTILS_HPP_
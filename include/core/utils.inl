@@ -0,0 +1,2071 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   utils.inl
+  \brief  Inline definitions for the number conversions of the string utilities.
+
+  The conversions are written once here as \c constexpr code, so constant evaluation and runtime calls share them.
+  Shortest float output follows Schubfach (R. Giulietti, "The Schubfach way to render doubles", 2021) and float
+  parsing follows Eisel-Lemire (D. Lemire, "Number Parsing at a Gigabyte per Second", 2021). Both read the same table
+  of normalized powers of ten.
+
+  \note Included by core.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_CORE_UTILS_INL_
+#define INCLUDE_CORE_UTILS_INL_
+
+namespace toy {
+
+namespace conversion {
+
+#if defined(__SIZEOF_INT128__)
+__extension__ typedef unsigned __int128 Product;
+#endif
+
+/// Two-digit strings of 00 to 99, indexed by twice the value
+inline constexpr char c_digitPairs[] = "00010203040506070809"
+                                       "10111213141516171819"
+                                       "20212223242526272829"
+                                       "30313233343536373839"
+                                       "40414243444546474849"
+                                       "50515253545556575859"
+                                       "60616263646566676869"
+                                       "70717273747576777879"
+                                       "80818283848586878889"
+                                       "90919293949596979899";
+
+/// Digit characters of bases up to 36
+inline constexpr char c_digitChars[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+/// 10^e scaled into [2^127, 2^128) and rounded up, for e from c_minTablePower to c_maxTablePower. Schubfach reads the
+/// entries as they are; Eisel-Lemire wants them truncated and subtracts one outside the exact and near-exact range.
+inline constexpr array<Uint128, c_maxTablePower - c_minTablePower + 1> c_normalizedPowersOfTen{{
+  {0xEEF453D6923BD65AU, 0x113FAA2906A13B40U}, // 1e-342
+  {0x9558B4661B6565F8U, 0x4AC7CA59A424C508U}, // 1e-341
+  {0xBAAEE17FA23EBF76U, 0x5D79BCF00D2DF64AU}, // 1e-340
+  {0xE95A99DF8ACE6F53U, 0xF4D82C2C107973DDU}, // 1e-339
+  {0x91D8A02BB6C10594U, 0x79071B9B8A4BE86AU}, // 1e-338
+  {0xB64EC836A47146F9U, 0x9748E2826CDEE285U}, // 1e-337
+  {0xE3E27A444D8D98B7U, 0xFD1B1B2308169B26U}, // 1e-336
+  {0x8E6D8C6AB0787F72U, 0xFE30F0F5E50E20F8U}, // 1e-335
+  {0xB208EF855C969F4FU, 0xBDBD2D335E51A936U}, // 1e-334
+  {0xDE8B2B66B3BC4723U, 0xAD2C788035E61383U}, // 1e-333
+  {0x8B16FB203055AC76U, 0x4C3BCB5021AFCC32U}, // 1e-332
+  {0xADDCB9E83C6B1793U, 0xDF4ABE242A1BBF3EU}, // 1e-331
+  {0xD953E8624B85DD78U, 0xD71D6DAD34A2AF0EU}, // 1e-330
+  {0x87D4713D6F33AA6BU, 0x8672648C40E5AD69U}, // 1e-329
+  {0xA9C98D8CCB009506U, 0x680EFDAF511F18C3U}, // 1e-328
+  {0xD43BF0EFFDC0BA48U, 0x0212BD1B2566DEF3U}, // 1e-327
+  {0x84A57695FE98746DU, 0x014BB630F7604B58U}, // 1e-326
+  {0xA5CED43B7E3E9188U, 0x419EA3BD35385E2EU}, // 1e-325
+  {0xCF42894A5DCE35EAU, 0x52064CAC828675BAU}, // 1e-324
+  {0x818995CE7AA0E1B2U, 0x7343EFEBD1940994U}, // 1e-323
+  {0xA1EBFB4219491A1FU, 0x1014EBE6C5F90BF9U}, // 1e-322
+  {0xCA66FA129F9B60A6U, 0xD41A26E077774EF7U}, // 1e-321
+  {0xFD00B897478238D0U, 0x8920B098955522B5U}, // 1e-320
+  {0x9E20735E8CB16382U, 0x55B46E5F5D5535B1U}, // 1e-319
+  {0xC5A890362FDDBC62U, 0xEB2189F734AA831EU}, // 1e-318
+  {0xF712B443BBD52B7BU, 0xA5E9EC7501D523E5U}, // 1e-317
+  {0x9A6BB0AA55653B2DU, 0x47B233C92125366FU}, // 1e-316
+  {0xC1069CD4EABE89F8U, 0x999EC0BB696E840BU}, // 1e-315
+  {0xF148440A256E2C76U, 0xC00670EA43CA250EU}, // 1e-314
+  {0x96CD2A865764DBCAU, 0x380406926A5E5729U}, // 1e-313
+  {0xBC807527ED3E12BCU, 0xC605083704F5ECF3U}, // 1e-312
+  {0xEBA09271E88D976BU, 0xF7864A44C633682FU}, // 1e-311
+  {0x93445B8731587EA3U, 0x7AB3EE6AFBE0211EU}, // 1e-310
+  {0xB8157268FDAE9E4CU, 0x5960EA05BAD82965U}, // 1e-309
+  {0xE61ACF033D1A45DFU, 0x6FB92487298E33BEU}, // 1e-308
+  {0x8FD0C16206306BABU, 0xA5D3B6D479F8E057U}, // 1e-307
+  {0xB3C4F1BA87BC8696U, 0x8F48A4899877186DU}, // 1e-306
+  {0xE0B62E2929ABA83CU, 0x331ACDABFE94DE88U}, // 1e-305
+  {0x8C71DCD9BA0B4925U, 0x9FF0C08B7F1D0B15U}, // 1e-304
+  {0xAF8E5410288E1B6FU, 0x07ECF0AE5EE44DDAU}, // 1e-303
+  {0xDB71E91432B1A24AU, 0xC9E82CD9F69D6151U}, // 1e-302
+  {0x892731AC9FAF056EU, 0xBE311C083A225CD3U}, // 1e-301
+  {0xAB70FE17C79AC6CAU, 0x6DBD630A48AAF407U}, // 1e-300
+  {0xD64D3D9DB981787DU, 0x092CBBCCDAD5B109U}, // 1e-299
+  {0x85F0468293F0EB4EU, 0x25BBF56008C58EA6U}, // 1e-298
+  {0xA76C582338ED2621U, 0xAF2AF2B80AF6F24FU}, // 1e-297
+  {0xD1476E2C07286FAAU, 0x1AF5AF660DB4AEE2U}, // 1e-296
+  {0x82CCA4DB847945CAU, 0x50D98D9FC890ED4EU}, // 1e-295
+  {0xA37FCE126597973CU, 0xE50FF107BAB528A1U}, // 1e-294
+  {0xCC5FC196FEFD7D0CU, 0x1E53ED49A96272C9U}, // 1e-293
+  {0xFF77B1FCBEBCDC4FU, 0x25E8E89C13BB0F7BU}, // 1e-292
+  {0x9FAACF3DF73609B1U, 0x77B191618C54E9ADU}, // 1e-291
+  {0xC795830D75038C1DU, 0xD59DF5B9EF6A2418U}, // 1e-290
+  {0xF97AE3D0D2446F25U, 0x4B0573286B44AD1EU}, // 1e-289
+  {0x9BECCE62836AC577U, 0x4EE367F9430AEC33U}, // 1e-288
+  {0xC2E801FB244576D5U, 0x229C41F793CDA740U}, // 1e-287
+  {0xF3A20279ED56D48AU, 0x6B43527578C11110U}, // 1e-286
+  {0x9845418C345644D6U, 0x830A13896B78AAAAU}, // 1e-285
+  {0xBE5691EF416BD60CU, 0x23CC986BC656D554U}, // 1e-284
+  {0xEDEC366B11C6CB8FU, 0x2CBFBE86B7EC8AA9U}, // 1e-283
+  {0x94B3A202EB1C3F39U, 0x7BF7D71432F3D6AAU}, // 1e-282
+  {0xB9E08A83A5E34F07U, 0xDAF5CCD93FB0CC54U}, // 1e-281
+  {0xE858AD248F5C22C9U, 0xD1B3400F8F9CFF69U}, // 1e-280
+  {0x91376C36D99995BEU, 0x23100809B9C21FA2U}, // 1e-279
+  {0xB58547448FFFFB2DU, 0xABD40A0C2832A78BU}, // 1e-278
+  {0xE2E69915B3FFF9F9U, 0x16C90C8F323F516DU}, // 1e-277
+  {0x8DD01FAD907FFC3BU, 0xAE3DA7D97F6792E4U}, // 1e-276
+  {0xB1442798F49FFB4AU, 0x99CD11CFDF41779DU}, // 1e-275
+  {0xDD95317F31C7FA1DU, 0x40405643D711D584U}, // 1e-274
+  {0x8A7D3EEF7F1CFC52U, 0x482835EA666B2573U}, // 1e-273
+  {0xAD1C8EAB5EE43B66U, 0xDA3243650005EED0U}, // 1e-272
+  {0xD863B256369D4A40U, 0x90BED43E40076A83U}, // 1e-271
+  {0x873E4F75E2224E68U, 0x5A7744A6E804A292U}, // 1e-270
+  {0xA90DE3535AAAE202U, 0x711515D0A205CB37U}, // 1e-269
+  {0xD3515C2831559A83U, 0x0D5A5B44CA873E04U}, // 1e-268
+  {0x8412D9991ED58091U, 0xE858790AFE9486C3U}, // 1e-267
+  {0xA5178FFF668AE0B6U, 0x626E974DBE39A873U}, // 1e-266
+  {0xCE5D73FF402D98E3U, 0xFB0A3D212DC81290U}, // 1e-265
+  {0x80FA687F881C7F8EU, 0x7CE66634BC9D0B9AU}, // 1e-264
+  {0xA139029F6A239F72U, 0x1C1FFFC1EBC44E81U}, // 1e-263
+  {0xC987434744AC874EU, 0xA327FFB266B56221U}, // 1e-262
+  {0xFBE9141915D7A922U, 0x4BF1FF9F0062BAA9U}, // 1e-261
+  {0x9D71AC8FADA6C9B5U, 0x6F773FC3603DB4AAU}, // 1e-260
+  {0xC4CE17B399107C22U, 0xCB550FB4384D21D4U}, // 1e-259
+  {0xF6019DA07F549B2BU, 0x7E2A53A146606A49U}, // 1e-258
+  {0x99C102844F94E0FBU, 0x2EDA7444CBFC426EU}, // 1e-257
+  {0xC0314325637A1939U, 0xFA911155FEFB5309U}, // 1e-256
+  {0xF03D93EEBC589F88U, 0x793555AB7EBA27CBU}, // 1e-255
+  {0x96267C7535B763B5U, 0x4BC1558B2F3458DFU}, // 1e-254
+  {0xBBB01B9283253CA2U, 0x9EB1AAEDFB016F17U}, // 1e-253
+  {0xEA9C227723EE8BCBU, 0x465E15A979C1CADDU}, // 1e-252
+  {0x92A1958A7675175FU, 0x0BFACD89EC191ECAU}, // 1e-251
+  {0xB749FAED14125D36U, 0xCEF980EC671F667CU}, // 1e-250
+  {0xE51C79A85916F484U, 0x82B7E12780E7401BU}, // 1e-249
+  {0x8F31CC0937AE58D2U, 0xD1B2ECB8B0908811U}, // 1e-248
+  {0xB2FE3F0B8599EF07U, 0x861FA7E6DCB4AA16U}, // 1e-247
+  {0xDFBDCECE67006AC9U, 0x67A791E093E1D49BU}, // 1e-246
+  {0x8BD6A141006042BDU, 0xE0C8BB2C5C6D24E1U}, // 1e-245
+  {0xAECC49914078536DU, 0x58FAE9F773886E19U}, // 1e-244
+  {0xDA7F5BF590966848U, 0xAF39A475506A899FU}, // 1e-243
+  {0x888F99797A5E012DU, 0x6D8406C952429604U}, // 1e-242
+  {0xAAB37FD7D8F58178U, 0xC8E5087BA6D33B84U}, // 1e-241
+  {0xD5605FCDCF32E1D6U, 0xFB1E4A9A90880A65U}, // 1e-240
+  {0x855C3BE0A17FCD26U, 0x5CF2EEA09A550680U}, // 1e-239
+  {0xA6B34AD8C9DFC06FU, 0xF42FAA48C0EA481FU}, // 1e-238
+  {0xD0601D8EFC57B08BU, 0xF13B94DAF124DA27U}, // 1e-237
+  {0x823C12795DB6CE57U, 0x76C53D08D6B70859U}, // 1e-236
+  {0xA2CB1717B52481EDU, 0x54768C4B0C64CA6FU}, // 1e-235
+  {0xCB7DDCDDA26DA268U, 0xA9942F5DCF7DFD0AU}, // 1e-234
+  {0xFE5D54150B090B02U, 0xD3F93B35435D7C4DU}, // 1e-233
+  {0x9EFA548D26E5A6E1U, 0xC47BC5014A1A6DB0U}, // 1e-232
+  {0xC6B8E9B0709F109AU, 0x359AB6419CA1091CU}, // 1e-231
+  {0xF867241C8CC6D4C0U, 0xC30163D203C94B63U}, // 1e-230
+  {0x9B407691D7FC44F8U, 0x79E0DE63425DCF1EU}, // 1e-229
+  {0xC21094364DFB5636U, 0x985915FC12F542E5U}, // 1e-228
+  {0xF294B943E17A2BC4U, 0x3E6F5B7B17B2939EU}, // 1e-227
+  {0x979CF3CA6CEC5B5AU, 0xA705992CEECF9C43U}, // 1e-226
+  {0xBD8430BD08277231U, 0x50C6FF782A838354U}, // 1e-225
+  {0xECE53CEC4A314EBDU, 0xA4F8BF5635246429U}, // 1e-224
+  {0x940F4613AE5ED136U, 0x871B7795E136BE9AU}, // 1e-223
+  {0xB913179899F68584U, 0x28E2557B59846E40U}, // 1e-222
+  {0xE757DD7EC07426E5U, 0x331AEADA2FE589D0U}, // 1e-221
+  {0x9096EA6F3848984FU, 0x3FF0D2C85DEF7622U}, // 1e-220
+  {0xB4BCA50B065ABE63U, 0x0FED077A756B53AAU}, // 1e-219
+  {0xE1EBCE4DC7F16DFBU, 0xD3E8495912C62895U}, // 1e-218
+  {0x8D3360F09CF6E4BDU, 0x64712DD7ABBBD95DU}, // 1e-217
+  {0xB080392CC4349DECU, 0xBD8D794D96AACFB4U}, // 1e-216
+  {0xDCA04777F541C567U, 0xECF0D7A0FC5583A1U}, // 1e-215
+  {0x89E42CAAF9491B60U, 0xF41686C49DB57245U}, // 1e-214
+  {0xAC5D37D5B79B6239U, 0x311C2875C522CED6U}, // 1e-213
+  {0xD77485CB25823AC7U, 0x7D633293366B828CU}, // 1e-212
+  {0x86A8D39EF77164BCU, 0xAE5DFF9C02033198U}, // 1e-211
+  {0xA8530886B54DBDEBU, 0xD9F57F830283FDFDU}, // 1e-210
+  {0xD267CAA862A12D66U, 0xD072DF63C324FD7CU}, // 1e-209
+  {0x8380DEA93DA4BC60U, 0x4247CB9E59F71E6EU}, // 1e-208
+  {0xA46116538D0DEB78U, 0x52D9BE85F074E609U}, // 1e-207
+  {0xCD795BE870516656U, 0x67902E276C921F8CU}, // 1e-206
+  {0x806BD9714632DFF6U, 0x00BA1CD8A3DB53B7U}, // 1e-205
+  {0xA086CFCD97BF97F3U, 0x80E8A40ECCD228A5U}, // 1e-204
+  {0xC8A883C0FDAF7DF0U, 0x6122CD128006B2CEU}, // 1e-203
+  {0xFAD2A4B13D1B5D6CU, 0x796B805720085F82U}, // 1e-202
+  {0x9CC3A6EEC6311A63U, 0xCBE3303674053BB1U}, // 1e-201
+  {0xC3F490AA77BD60FCU, 0xBEDBFC4411068A9DU}, // 1e-200
+  {0xF4F1B4D515ACB93BU, 0xEE92FB5515482D45U}, // 1e-199
+  {0x991711052D8BF3C5U, 0x751BDD152D4D1C4BU}, // 1e-198
+  {0xBF5CD54678EEF0B6U, 0xD262D45A78A0635EU}, // 1e-197
+  {0xEF340A98172AACE4U, 0x86FB897116C87C35U}, // 1e-196
+  {0x9580869F0E7AAC0EU, 0xD45D35E6AE3D4DA1U}, // 1e-195
+  {0xBAE0A846D2195712U, 0x8974836059CCA10AU}, // 1e-194
+  {0xE998D258869FACD7U, 0x2BD1A438703FC94CU}, // 1e-193
+  {0x91FF83775423CC06U, 0x7B6306A34627DDD0U}, // 1e-192
+  {0xB67F6455292CBF08U, 0x1A3BC84C17B1D543U}, // 1e-191
+  {0xE41F3D6A7377EECAU, 0x20CABA5F1D9E4A94U}, // 1e-190
+  {0x8E938662882AF53EU, 0x547EB47B7282EE9DU}, // 1e-189
+  {0xB23867FB2A35B28DU, 0xE99E619A4F23AA44U}, // 1e-188
+  {0xDEC681F9F4C31F31U, 0x6405FA00E2EC94D5U}, // 1e-187
+  {0x8B3C113C38F9F37EU, 0xDE83BC408DD3DD05U}, // 1e-186
+  {0xAE0B158B4738705EU, 0x9624AB50B148D446U}, // 1e-185
+  {0xD98DDAEE19068C76U, 0x3BADD624DD9B0958U}, // 1e-184
+  {0x87F8A8D4CFA417C9U, 0xE54CA5D70A80E5D7U}, // 1e-183
+  {0xA9F6D30A038D1DBCU, 0x5E9FCF4CCD211F4DU}, // 1e-182
+  {0xD47487CC8470652BU, 0x7647C32000696720U}, // 1e-181
+  {0x84C8D4DFD2C63F3BU, 0x29ECD9F40041E074U}, // 1e-180
+  {0xA5FB0A17C777CF09U, 0xF468107100525891U}, // 1e-179
+  {0xCF79CC9DB955C2CCU, 0x7182148D4066EEB5U}, // 1e-178
+  {0x81AC1FE293D599BFU, 0xC6F14CD848405531U}, // 1e-177
+  {0xA21727DB38CB002FU, 0xB8ADA00E5A506A7DU}, // 1e-176
+  {0xCA9CF1D206FDC03BU, 0xA6D90811F0E4851DU}, // 1e-175
+  {0xFD442E4688BD304AU, 0x908F4A166D1DA664U}, // 1e-174
+  {0x9E4A9CEC15763E2EU, 0x9A598E4E043287FFU}, // 1e-173
+  {0xC5DD44271AD3CDBAU, 0x40EFF1E1853F29FEU}, // 1e-172
+  {0xF7549530E188C128U, 0xD12BEE59E68EF47DU}, // 1e-171
+  {0x9A94DD3E8CF578B9U, 0x82BB74F8301958CFU}, // 1e-170
+  {0xC13A148E3032D6E7U, 0xE36A52363C1FAF02U}, // 1e-169
+  {0xF18899B1BC3F8CA1U, 0xDC44E6C3CB279AC2U}, // 1e-168
+  {0x96F5600F15A7B7E5U, 0x29AB103A5EF8C0BAU}, // 1e-167
+  {0xBCB2B812DB11A5DEU, 0x7415D448F6B6F0E8U}, // 1e-166
+  {0xEBDF661791D60F56U, 0x111B495B3464AD22U}, // 1e-165
+  {0x936B9FCEBB25C995U, 0xCAB10DD900BEEC35U}, // 1e-164
+  {0xB84687C269EF3BFBU, 0x3D5D514F40EEA743U}, // 1e-163
+  {0xE65829B3046B0AFAU, 0x0CB4A5A3112A5113U}, // 1e-162
+  {0x8FF71A0FE2C2E6DCU, 0x47F0E785EABA72ACU}, // 1e-161
+  {0xB3F4E093DB73A093U, 0x59ED216765690F57U}, // 1e-160
+  {0xE0F218B8D25088B8U, 0x306869C13EC3532DU}, // 1e-159
+  {0x8C974F7383725573U, 0x1E414218C73A13FCU}, // 1e-158
+  {0xAFBD2350644EEACFU, 0xE5D1929EF90898FBU}, // 1e-157
+  {0xDBAC6C247D62A583U, 0xDF45F746B74ABF3AU}, // 1e-156
+  {0x894BC396CE5DA772U, 0x6B8BBA8C328EB784U}, // 1e-155
+  {0xAB9EB47C81F5114FU, 0x066EA92F3F326565U}, // 1e-154
+  {0xD686619BA27255A2U, 0xC80A537B0EFEFEBEU}, // 1e-153
+  {0x8613FD0145877585U, 0xBD06742CE95F5F37U}, // 1e-152
+  {0xA798FC4196E952E7U, 0x2C48113823B73705U}, // 1e-151
+  {0xD17F3B51FCA3A7A0U, 0xF75A15862CA504C6U}, // 1e-150
+  {0x82EF85133DE648C4U, 0x9A984D73DBE722FCU}, // 1e-149
+  {0xA3AB66580D5FDAF5U, 0xC13E60D0D2E0EBBBU}, // 1e-148
+  {0xCC963FEE10B7D1B3U, 0x318DF905079926A9U}, // 1e-147
+  {0xFFBBCFE994E5C61FU, 0xFDF17746497F7053U}, // 1e-146
+  {0x9FD561F1FD0F9BD3U, 0xFEB6EA8BEDEFA634U}, // 1e-145
+  {0xC7CABA6E7C5382C8U, 0xFE64A52EE96B8FC1U}, // 1e-144
+  {0xF9BD690A1B68637BU, 0x3DFDCE7AA3C673B1U}, // 1e-143
+  {0x9C1661A651213E2DU, 0x06BEA10CA65C084FU}, // 1e-142
+  {0xC31BFA0FE5698DB8U, 0x486E494FCFF30A63U}, // 1e-141
+  {0xF3E2F893DEC3F126U, 0x5A89DBA3C3EFCCFBU}, // 1e-140
+  {0x986DDB5C6B3A76B7U, 0xF89629465A75E01DU}, // 1e-139
+  {0xBE89523386091465U, 0xF6BBB397F1135824U}, // 1e-138
+  {0xEE2BA6C0678B597FU, 0x746AA07DED582E2DU}, // 1e-137
+  {0x94DB483840B717EFU, 0xA8C2A44EB4571CDDU}, // 1e-136
+  {0xBA121A4650E4DDEBU, 0x92F34D62616CE414U}, // 1e-135
+  {0xE896A0D7E51E1566U, 0x77B020BAF9C81D18U}, // 1e-134
+  {0x915E2486EF32CD60U, 0x0ACE1474DC1D122FU}, // 1e-133
+  {0xB5B5ADA8AAFF80B8U, 0x0D819992132456BBU}, // 1e-132
+  {0xE3231912D5BF60E6U, 0x10E1FFF697ED6C6AU}, // 1e-131
+  {0x8DF5EFABC5979C8FU, 0xCA8D3FFA1EF463C2U}, // 1e-130
+  {0xB1736B96B6FD83B3U, 0xBD308FF8A6B17CB3U}, // 1e-129
+  {0xDDD0467C64BCE4A0U, 0xAC7CB3F6D05DDBDFU}, // 1e-128
+  {0x8AA22C0DBEF60EE4U, 0x6BCDF07A423AA96CU}, // 1e-127
+  {0xAD4AB7112EB3929DU, 0x86C16C98D2C953C7U}, // 1e-126
+  {0xD89D64D57A607744U, 0xE871C7BF077BA8B8U}, // 1e-125
+  {0x87625F056C7C4A8BU, 0x11471CD764AD4973U}, // 1e-124
+  {0xA93AF6C6C79B5D2DU, 0xD598E40D3DD89BD0U}, // 1e-123
+  {0xD389B47879823479U, 0x4AFF1D108D4EC2C4U}, // 1e-122
+  {0x843610CB4BF160CBU, 0xCEDF722A585139BBU}, // 1e-121
+  {0xA54394FE1EEDB8FEU, 0xC2974EB4EE658829U}, // 1e-120
+  {0xCE947A3DA6A9273EU, 0x733D226229FEEA33U}, // 1e-119
+  {0x811CCC668829B887U, 0x0806357D5A3F5260U}, // 1e-118
+  {0xA163FF802A3426A8U, 0xCA07C2DCB0CF26F8U}, // 1e-117
+  {0xC9BCFF6034C13052U, 0xFC89B393DD02F0B6U}, // 1e-116
+  {0xFC2C3F3841F17C67U, 0xBBAC2078D443ACE3U}, // 1e-115
+  {0x9D9BA7832936EDC0U, 0xD54B944B84AA4C0EU}, // 1e-114
+  {0xC5029163F384A931U, 0x0A9E795E65D4DF12U}, // 1e-113
+  {0xF64335BCF065D37DU, 0x4D4617B5FF4A16D6U}, // 1e-112
+  {0x99EA0196163FA42EU, 0x504BCED1BF8E4E46U}, // 1e-111
+  {0xC06481FB9BCF8D39U, 0xE45EC2862F71E1D7U}, // 1e-110
+  {0xF07DA27A82C37088U, 0x5D767327BB4E5A4DU}, // 1e-109
+  {0x964E858C91BA2655U, 0x3A6A07F8D510F870U}, // 1e-108
+  {0xBBE226EFB628AFEAU, 0x890489F70A55368CU}, // 1e-107
+  {0xEADAB0ABA3B2DBE5U, 0x2B45AC74CCEA842FU}, // 1e-106
+  {0x92C8AE6B464FC96FU, 0x3B0B8BC90012929EU}, // 1e-105
+  {0xB77ADA0617E3BBCBU, 0x09CE6EBB40173745U}, // 1e-104
+  {0xE55990879DDCAABDU, 0xCC420A6A101D0516U}, // 1e-103
+  {0x8F57FA54C2A9EAB6U, 0x9FA946824A12232EU}, // 1e-102
+  {0xB32DF8E9F3546564U, 0x47939822DC96ABFAU}, // 1e-101
+  {0xDFF9772470297EBDU, 0x59787E2B93BC56F8U}, // 1e-100
+  {0x8BFBEA76C619EF36U, 0x57EB4EDB3C55B65BU}, // 1e-99
+  {0xAEFAE51477A06B03U, 0xEDE622920B6B23F2U}, // 1e-98
+  {0xDAB99E59958885C4U, 0xE95FAB368E45ECEEU}, // 1e-97
+  {0x88B402F7FD75539BU, 0x11DBCB0218EBB415U}, // 1e-96
+  {0xAAE103B5FCD2A881U, 0xD652BDC29F26A11AU}, // 1e-95
+  {0xD59944A37C0752A2U, 0x4BE76D3346F04960U}, // 1e-94
+  {0x857FCAE62D8493A5U, 0x6F70A4400C562DDCU}, // 1e-93
+  {0xA6DFBD9FB8E5B88EU, 0xCB4CCD500F6BB953U}, // 1e-92
+  {0xD097AD07A71F26B2U, 0x7E2000A41346A7A8U}, // 1e-91
+  {0x825ECC24C873782FU, 0x8ED400668C0C28C9U}, // 1e-90
+  {0xA2F67F2DFA90563BU, 0x728900802F0F32FBU}, // 1e-89
+  {0xCBB41EF979346BCAU, 0x4F2B40A03AD2FFBAU}, // 1e-88
+  {0xFEA126B7D78186BCU, 0xE2F610C84987BFA9U}, // 1e-87
+  {0x9F24B832E6B0F436U, 0x0DD9CA7D2DF4D7CAU}, // 1e-86
+  {0xC6EDE63FA05D3143U, 0x91503D1C79720DBCU}, // 1e-85
+  {0xF8A95FCF88747D94U, 0x75A44C6397CE912BU}, // 1e-84
+  {0x9B69DBE1B548CE7CU, 0xC986AFBE3EE11ABBU}, // 1e-83
+  {0xC24452DA229B021BU, 0xFBE85BADCE996169U}, // 1e-82
+  {0xF2D56790AB41C2A2U, 0xFAE27299423FB9C4U}, // 1e-81
+  {0x97C560BA6B0919A5U, 0xDCCD879FC967D41BU}, // 1e-80
+  {0xBDB6B8E905CB600FU, 0x5400E987BBC1C921U}, // 1e-79
+  {0xED246723473E3813U, 0x290123E9AAB23B69U}, // 1e-78
+  {0x9436C0760C86E30BU, 0xF9A0B6720AAF6522U}, // 1e-77
+  {0xB94470938FA89BCEU, 0xF808E40E8D5B3E6AU}, // 1e-76
+  {0xE7958CB87392C2C2U, 0xB60B1D1230B20E05U}, // 1e-75
+  {0x90BD77F3483BB9B9U, 0xB1C6F22B5E6F48C3U}, // 1e-74
+  {0xB4ECD5F01A4AA828U, 0x1E38AEB6360B1AF4U}, // 1e-73
+  {0xE2280B6C20DD5232U, 0x25C6DA63C38DE1B1U}, // 1e-72
+  {0x8D590723948A535FU, 0x579C487E5A38AD0FU}, // 1e-71
+  {0xB0AF48EC79ACE837U, 0x2D835A9DF0C6D852U}, // 1e-70
+  {0xDCDB1B2798182244U, 0xF8E431456CF88E66U}, // 1e-69
+  {0x8A08F0F8BF0F156BU, 0x1B8E9ECB641B5900U}, // 1e-68
+  {0xAC8B2D36EED2DAC5U, 0xE272467E3D222F40U}, // 1e-67
+  {0xD7ADF884AA879177U, 0x5B0ED81DCC6ABB10U}, // 1e-66
+  {0x86CCBB52EA94BAEAU, 0x98E947129FC2B4EAU}, // 1e-65
+  {0xA87FEA27A539E9A5U, 0x3F2398D747B36225U}, // 1e-64
+  {0xD29FE4B18E88640EU, 0x8EEC7F0D19A03AAEU}, // 1e-63
+  {0x83A3EEEEF9153E89U, 0x1953CF68300424ADU}, // 1e-62
+  {0xA48CEAAAB75A8E2BU, 0x5FA8C3423C052DD8U}, // 1e-61
+  {0xCDB02555653131B6U, 0x3792F412CB06794EU}, // 1e-60
+  {0x808E17555F3EBF11U, 0xE2BBD88BBEE40BD1U}, // 1e-59
+  {0xA0B19D2AB70E6ED6U, 0x5B6ACEAEAE9D0EC5U}, // 1e-58
+  {0xC8DE047564D20A8BU, 0xF245825A5A445276U}, // 1e-57
+  {0xFB158592BE068D2EU, 0xEED6E2F0F0D56713U}, // 1e-56
+  {0x9CED737BB6C4183DU, 0x55464DD69685606CU}, // 1e-55
+  {0xC428D05AA4751E4CU, 0xAA97E14C3C26B887U}, // 1e-54
+  {0xF53304714D9265DFU, 0xD53DD99F4B3066A9U}, // 1e-53
+  {0x993FE2C6D07B7FABU, 0xE546A8038EFE402AU}, // 1e-52
+  {0xBF8FDB78849A5F96U, 0xDE98520472BDD034U}, // 1e-51
+  {0xEF73D256A5C0F77CU, 0x963E66858F6D4441U}, // 1e-50
+  {0x95A8637627989AADU, 0xDDE7001379A44AA9U}, // 1e-49
+  {0xBB127C53B17EC159U, 0x5560C018580D5D53U}, // 1e-48
+  {0xE9D71B689DDE71AFU, 0xAAB8F01E6E10B4A7U}, // 1e-47
+  {0x9226712162AB070DU, 0xCAB3961304CA70E9U}, // 1e-46
+  {0xB6B00D69BB55C8D1U, 0x3D607B97C5FD0D23U}, // 1e-45
+  {0xE45C10C42A2B3B05U, 0x8CB89A7DB77C506BU}, // 1e-44
+  {0x8EB98A7A9A5B04E3U, 0x77F3608E92ADB243U}, // 1e-43
+  {0xB267ED1940F1C61CU, 0x55F038B237591ED4U}, // 1e-42
+  {0xDF01E85F912E37A3U, 0x6B6C46DEC52F6689U}, // 1e-41
+  {0x8B61313BBABCE2C6U, 0x2323AC4B3B3DA016U}, // 1e-40
+  {0xAE397D8AA96C1B77U, 0xABEC975E0A0D081BU}, // 1e-39
+  {0xD9C7DCED53C72255U, 0x96E7BD358C904A22U}, // 1e-38
+  {0x881CEA14545C7575U, 0x7E50D64177DA2E55U}, // 1e-37
+  {0xAA242499697392D2U, 0xDDE50BD1D5D0B9EAU}, // 1e-36
+  {0xD4AD2DBFC3D07787U, 0x955E4EC64B44E865U}, // 1e-35
+  {0x84EC3C97DA624AB4U, 0xBD5AF13BEF0B113FU}, // 1e-34
+  {0xA6274BBDD0FADD61U, 0xECB1AD8AEACDD58FU}, // 1e-33
+  {0xCFB11EAD453994BAU, 0x67DE18EDA5814AF3U}, // 1e-32
+  {0x81CEB32C4B43FCF4U, 0x80EACF948770CED8U}, // 1e-31
+  {0xA2425FF75E14FC31U, 0xA1258379A94D028EU}, // 1e-30
+  {0xCAD2F7F5359A3B3EU, 0x096EE45813A04331U}, // 1e-29
+  {0xFD87B5F28300CA0DU, 0x8BCA9D6E188853FDU}, // 1e-28
+  {0x9E74D1B791E07E48U, 0x775EA264CF55347EU}, // 1e-27
+  {0xC612062576589DDAU, 0x95364AFE032A819EU}, // 1e-26
+  {0xF79687AED3EEC551U, 0x3A83DDBD83F52205U}, // 1e-25
+  {0x9ABE14CD44753B52U, 0xC4926A9672793543U}, // 1e-24
+  {0xC16D9A0095928A27U, 0x75B7053C0F178294U}, // 1e-23
+  {0xF1C90080BAF72CB1U, 0x5324C68B12DD6339U}, // 1e-22
+  {0x971DA05074DA7BEEU, 0xD3F6FC16EBCA5E04U}, // 1e-21
+  {0xBCE5086492111AEAU, 0x88F4BB1CA6BCF585U}, // 1e-20
+  {0xEC1E4A7DB69561A5U, 0x2B31E9E3D06C32E6U}, // 1e-19
+  {0x9392EE8E921D5D07U, 0x3AFF322E62439FD0U}, // 1e-18
+  {0xB877AA3236A4B449U, 0x09BEFEB9FAD487C3U}, // 1e-17
+  {0xE69594BEC44DE15BU, 0x4C2EBE687989A9B4U}, // 1e-16
+  {0x901D7CF73AB0ACD9U, 0x0F9D37014BF60A11U}, // 1e-15
+  {0xB424DC35095CD80FU, 0x538484C19EF38C95U}, // 1e-14
+  {0xE12E13424BB40E13U, 0x2865A5F206B06FBAU}, // 1e-13
+  {0x8CBCCC096F5088CBU, 0xF93F87B7442E45D4U}, // 1e-12
+  {0xAFEBFF0BCB24AAFEU, 0xF78F69A51539D749U}, // 1e-11
+  {0xDBE6FECEBDEDD5BEU, 0xB573440E5A884D1CU}, // 1e-10
+  {0x89705F4136B4A597U, 0x31680A88F8953031U}, // 1e-9
+  {0xABCC77118461CEFCU, 0xFDC20D2B36BA7C3EU}, // 1e-8
+  {0xD6BF94D5E57A42BCU, 0x3D32907604691B4DU}, // 1e-7
+  {0x8637BD05AF6C69B5U, 0xA63F9A49C2C1B110U}, // 1e-6
+  {0xA7C5AC471B478423U, 0x0FCF80DC33721D54U}, // 1e-5
+  {0xD1B71758E219652BU, 0xD3C36113404EA4A9U}, // 1e-4
+  {0x83126E978D4FDF3BU, 0x645A1CAC083126EAU}, // 1e-3
+  {0xA3D70A3D70A3D70AU, 0x3D70A3D70A3D70A4U}, // 1e-2
+  {0xCCCCCCCCCCCCCCCCU, 0xCCCCCCCCCCCCCCCDU}, // 1e-1
+  {0x8000000000000000U, 0x0000000000000000U}, // 1e0
+  {0xA000000000000000U, 0x0000000000000000U}, // 1e1
+  {0xC800000000000000U, 0x0000000000000000U}, // 1e2
+  {0xFA00000000000000U, 0x0000000000000000U}, // 1e3
+  {0x9C40000000000000U, 0x0000000000000000U}, // 1e4
+  {0xC350000000000000U, 0x0000000000000000U}, // 1e5
+  {0xF424000000000000U, 0x0000000000000000U}, // 1e6
+  {0x9896800000000000U, 0x0000000000000000U}, // 1e7
+  {0xBEBC200000000000U, 0x0000000000000000U}, // 1e8
+  {0xEE6B280000000000U, 0x0000000000000000U}, // 1e9
+  {0x9502F90000000000U, 0x0000000000000000U}, // 1e10
+  {0xBA43B74000000000U, 0x0000000000000000U}, // 1e11
+  {0xE8D4A51000000000U, 0x0000000000000000U}, // 1e12
+  {0x9184E72A00000000U, 0x0000000000000000U}, // 1e13
+  {0xB5E620F480000000U, 0x0000000000000000U}, // 1e14
+  {0xE35FA931A0000000U, 0x0000000000000000U}, // 1e15
+  {0x8E1BC9BF04000000U, 0x0000000000000000U}, // 1e16
+  {0xB1A2BC2EC5000000U, 0x0000000000000000U}, // 1e17
+  {0xDE0B6B3A76400000U, 0x0000000000000000U}, // 1e18
+  {0x8AC7230489E80000U, 0x0000000000000000U}, // 1e19
+  {0xAD78EBC5AC620000U, 0x0000000000000000U}, // 1e20
+  {0xD8D726B7177A8000U, 0x0000000000000000U}, // 1e21
+  {0x878678326EAC9000U, 0x0000000000000000U}, // 1e22
+  {0xA968163F0A57B400U, 0x0000000000000000U}, // 1e23
+  {0xD3C21BCECCEDA100U, 0x0000000000000000U}, // 1e24
+  {0x84595161401484A0U, 0x0000000000000000U}, // 1e25
+  {0xA56FA5B99019A5C8U, 0x0000000000000000U}, // 1e26
+  {0xCECB8F27F4200F3AU, 0x0000000000000000U}, // 1e27
+  {0x813F3978F8940984U, 0x4000000000000000U}, // 1e28
+  {0xA18F07D736B90BE5U, 0x5000000000000000U}, // 1e29
+  {0xC9F2C9CD04674EDEU, 0xA400000000000000U}, // 1e30
+  {0xFC6F7C4045812296U, 0x4D00000000000000U}, // 1e31
+  {0x9DC5ADA82B70B59DU, 0xF020000000000000U}, // 1e32
+  {0xC5371912364CE305U, 0x6C28000000000000U}, // 1e33
+  {0xF684DF56C3E01BC6U, 0xC732000000000000U}, // 1e34
+  {0x9A130B963A6C115CU, 0x3C7F400000000000U}, // 1e35
+  {0xC097CE7BC90715B3U, 0x4B9F100000000000U}, // 1e36
+  {0xF0BDC21ABB48DB20U, 0x1E86D40000000000U}, // 1e37
+  {0x96769950B50D88F4U, 0x1314448000000000U}, // 1e38
+  {0xBC143FA4E250EB31U, 0x17D955A000000000U}, // 1e39
+  {0xEB194F8E1AE525FDU, 0x5DCFAB0800000000U}, // 1e40
+  {0x92EFD1B8D0CF37BEU, 0x5AA1CAE500000000U}, // 1e41
+  {0xB7ABC627050305ADU, 0xF14A3D9E40000000U}, // 1e42
+  {0xE596B7B0C643C719U, 0x6D9CCD05D0000000U}, // 1e43
+  {0x8F7E32CE7BEA5C6FU, 0xE4820023A2000000U}, // 1e44
+  {0xB35DBF821AE4F38BU, 0xDDA2802C8A800000U}, // 1e45
+  {0xE0352F62A19E306EU, 0xD50B2037AD200000U}, // 1e46
+  {0x8C213D9DA502DE45U, 0x4526F422CC340000U}, // 1e47
+  {0xAF298D050E4395D6U, 0x9670B12B7F410000U}, // 1e48
+  {0xDAF3F04651D47B4CU, 0x3C0CDD765F114000U}, // 1e49
+  {0x88D8762BF324CD0FU, 0xA5880A69FB6AC800U}, // 1e50
+  {0xAB0E93B6EFEE0053U, 0x8EEA0D047A457A00U}, // 1e51
+  {0xD5D238A4ABE98068U, 0x72A4904598D6D880U}, // 1e52
+  {0x85A36366EB71F041U, 0x47A6DA2B7F864750U}, // 1e53
+  {0xA70C3C40A64E6C51U, 0x999090B65F67D924U}, // 1e54
+  {0xD0CF4B50CFE20765U, 0xFFF4B4E3F741CF6DU}, // 1e55
+  {0x82818F1281ED449FU, 0xBFF8F10E7A8921A5U}, // 1e56
+  {0xA321F2D7226895C7U, 0xAFF72D52192B6A0EU}, // 1e57
+  {0xCBEA6F8CEB02BB39U, 0x9BF4F8A69F764491U}, // 1e58
+  {0xFEE50B7025C36A08U, 0x02F236D04753D5B5U}, // 1e59
+  {0x9F4F2726179A2245U, 0x01D762422C946591U}, // 1e60
+  {0xC722F0EF9D80AAD6U, 0x424D3AD2B7B97EF6U}, // 1e61
+  {0xF8EBAD2B84E0D58BU, 0xD2E0898765A7DEB3U}, // 1e62
+  {0x9B934C3B330C8577U, 0x63CC55F49F88EB30U}, // 1e63
+  {0xC2781F49FFCFA6D5U, 0x3CBF6B71C76B25FCU}, // 1e64
+  {0xF316271C7FC3908AU, 0x8BEF464E3945EF7BU}, // 1e65
+  {0x97EDD871CFDA3A56U, 0x97758BF0E3CBB5ADU}, // 1e66
+  {0xBDE94E8E43D0C8ECU, 0x3D52EEED1CBEA318U}, // 1e67
+  {0xED63A231D4C4FB27U, 0x4CA7AAA863EE4BDEU}, // 1e68
+  {0x945E455F24FB1CF8U, 0x8FE8CAA93E74EF6BU}, // 1e69
+  {0xB975D6B6EE39E436U, 0xB3E2FD538E122B45U}, // 1e70
+  {0xE7D34C64A9C85D44U, 0x60DBBCA87196B617U}, // 1e71
+  {0x90E40FBEEA1D3A4AU, 0xBC8955E946FE31CEU}, // 1e72
+  {0xB51D13AEA4A488DDU, 0x6BABAB6398BDBE42U}, // 1e73
+  {0xE264589A4DCDAB14U, 0xC696963C7EED2DD2U}, // 1e74
+  {0x8D7EB76070A08AECU, 0xFC1E1DE5CF543CA3U}, // 1e75
+  {0xB0DE65388CC8ADA8U, 0x3B25A55F43294BCCU}, // 1e76
+  {0xDD15FE86AFFAD912U, 0x49EF0EB713F39EBFU}, // 1e77
+  {0x8A2DBF142DFCC7ABU, 0x6E3569326C784338U}, // 1e78
+  {0xACB92ED9397BF996U, 0x49C2C37F07965405U}, // 1e79
+  {0xD7E77A8F87DAF7FBU, 0xDC33745EC97BE907U}, // 1e80
+  {0x86F0AC99B4E8DAFDU, 0x69A028BB3DED71A4U}, // 1e81
+  {0xA8ACD7C0222311BCU, 0xC40832EA0D68CE0DU}, // 1e82
+  {0xD2D80DB02AABD62BU, 0xF50A3FA490C30191U}, // 1e83
+  {0x83C7088E1AAB65DBU, 0x792667C6DA79E0FBU}, // 1e84
+  {0xA4B8CAB1A1563F52U, 0x577001B891185939U}, // 1e85
+  {0xCDE6FD5E09ABCF26U, 0xED4C0226B55E6F87U}, // 1e86
+  {0x80B05E5AC60B6178U, 0x544F8158315B05B5U}, // 1e87
+  {0xA0DC75F1778E39D6U, 0x696361AE3DB1C722U}, // 1e88
+  {0xC913936DD571C84CU, 0x03BC3A19CD1E38EAU}, // 1e89
+  {0xFB5878494ACE3A5FU, 0x04AB48A04065C724U}, // 1e90
+  {0x9D174B2DCEC0E47BU, 0x62EB0D64283F9C77U}, // 1e91
+  {0xC45D1DF942711D9AU, 0x3BA5D0BD324F8395U}, // 1e92
+  {0xF5746577930D6500U, 0xCA8F44EC7EE3647AU}, // 1e93
+  {0x9968BF6ABBE85F20U, 0x7E998B13CF4E1ECCU}, // 1e94
+  {0xBFC2EF456AE276E8U, 0x9E3FEDD8C321A67FU}, // 1e95
+  {0xEFB3AB16C59B14A2U, 0xC5CFE94EF3EA101FU}, // 1e96
+  {0x95D04AEE3B80ECE5U, 0xBBA1F1D158724A13U}, // 1e97
+  {0xBB445DA9CA61281FU, 0x2A8A6E45AE8EDC98U}, // 1e98
+  {0xEA1575143CF97226U, 0xF52D09D71A3293BEU}, // 1e99
+  {0x924D692CA61BE758U, 0x593C2626705F9C57U}, // 1e100
+  {0xB6E0C377CFA2E12EU, 0x6F8B2FB00C77836DU}, // 1e101
+  {0xE498F455C38B997AU, 0x0B6DFB9C0F956448U}, // 1e102
+  {0x8EDF98B59A373FECU, 0x4724BD4189BD5EADU}, // 1e103
+  {0xB2977EE300C50FE7U, 0x58EDEC91EC2CB658U}, // 1e104
+  {0xDF3D5E9BC0F653E1U, 0x2F2967B66737E3EEU}, // 1e105
+  {0x8B865B215899F46CU, 0xBD79E0D20082EE75U}, // 1e106
+  {0xAE67F1E9AEC07187U, 0xECD8590680A3AA12U}, // 1e107
+  {0xDA01EE641A708DE9U, 0xE80E6F4820CC9496U}, // 1e108
+  {0x884134FE908658B2U, 0x3109058D147FDCDEU}, // 1e109
+  {0xAA51823E34A7EEDEU, 0xBD4B46F0599FD416U}, // 1e110
+  {0xD4E5E2CDC1D1EA96U, 0x6C9E18AC7007C91BU}, // 1e111
+  {0x850FADC09923329EU, 0x03E2CF6BC604DDB1U}, // 1e112
+  {0xA6539930BF6BFF45U, 0x84DB8346B786151DU}, // 1e113
+  {0xCFE87F7CEF46FF16U, 0xE612641865679A64U}, // 1e114
+  {0x81F14FAE158C5F6EU, 0x4FCB7E8F3F60C07FU}, // 1e115
+  {0xA26DA3999AEF7749U, 0xE3BE5E330F38F09EU}, // 1e116
+  {0xCB090C8001AB551CU, 0x5CADF5BFD3072CC6U}, // 1e117
+  {0xFDCB4FA002162A63U, 0x73D9732FC7C8F7F7U}, // 1e118
+  {0x9E9F11C4014DDA7EU, 0x2867E7FDDCDD9AFBU}, // 1e119
+  {0xC646D63501A1511DU, 0xB281E1FD541501B9U}, // 1e120
+  {0xF7D88BC24209A565U, 0x1F225A7CA91A4227U}, // 1e121
+  {0x9AE757596946075FU, 0x3375788DE9B06959U}, // 1e122
+  {0xC1A12D2FC3978937U, 0x0052D6B1641C83AFU}, // 1e123
+  {0xF209787BB47D6B84U, 0xC0678C5DBD23A49BU}, // 1e124
+  {0x9745EB4D50CE6332U, 0xF840B7BA963646E1U}, // 1e125
+  {0xBD176620A501FBFFU, 0xB650E5A93BC3D899U}, // 1e126
+  {0xEC5D3FA8CE427AFFU, 0xA3E51F138AB4CEBFU}, // 1e127
+  {0x93BA47C980E98CDFU, 0xC66F336C36B10138U}, // 1e128
+  {0xB8A8D9BBE123F017U, 0xB80B0047445D4185U}, // 1e129
+  {0xE6D3102AD96CEC1DU, 0xA60DC059157491E6U}, // 1e130
+  {0x9043EA1AC7E41392U, 0x87C89837AD68DB30U}, // 1e131
+  {0xB454E4A179DD1877U, 0x29BABE4598C311FCU}, // 1e132
+  {0xE16A1DC9D8545E94U, 0xF4296DD6FEF3D67BU}, // 1e133
+  {0x8CE2529E2734BB1DU, 0x1899E4A65F58660DU}, // 1e134
+  {0xB01AE745B101E9E4U, 0x5EC05DCFF72E7F90U}, // 1e135
+  {0xDC21A1171D42645DU, 0x76707543F4FA1F74U}, // 1e136
+  {0x899504AE72497EBAU, 0x6A06494A791C53A9U}, // 1e137
+  {0xABFA45DA0EDBDE69U, 0x0487DB9D17636893U}, // 1e138
+  {0xD6F8D7509292D603U, 0x45A9D2845D3C42B7U}, // 1e139
+  {0x865B86925B9BC5C2U, 0x0B8A2392BA45A9B3U}, // 1e140
+  {0xA7F26836F282B732U, 0x8E6CAC7768D7141FU}, // 1e141
+  {0xD1EF0244AF2364FFU, 0x3207D795430CD927U}, // 1e142
+  {0x8335616AED761F1FU, 0x7F44E6BD49E807B9U}, // 1e143
+  {0xA402B9C5A8D3A6E7U, 0x5F16206C9C6209A7U}, // 1e144
+  {0xCD036837130890A1U, 0x36DBA887C37A8C10U}, // 1e145
+  {0x802221226BE55A64U, 0xC2494954DA2C978AU}, // 1e146
+  {0xA02AA96B06DEB0FDU, 0xF2DB9BAA10B7BD6DU}, // 1e147
+  {0xC83553C5C8965D3DU, 0x6F92829494E5ACC8U}, // 1e148
+  {0xFA42A8B73ABBF48CU, 0xCB772339BA1F17FAU}, // 1e149
+  {0x9C69A97284B578D7U, 0xFF2A760414536EFCU}, // 1e150
+  {0xC38413CF25E2D70DU, 0xFEF5138519684ABBU}, // 1e151
+  {0xF46518C2EF5B8CD1U, 0x7EB258665FC25D6AU}, // 1e152
+  {0x98BF2F79D5993802U, 0xEF2F773FFBD97A62U}, // 1e153
+  {0xBEEEFB584AFF8603U, 0xAAFB550FFACFD8FBU}, // 1e154
+  {0xEEAABA2E5DBF6784U, 0x95BA2A53F983CF39U}, // 1e155
+  {0x952AB45CFA97A0B2U, 0xDD945A747BF26184U}, // 1e156
+  {0xBA756174393D88DFU, 0x94F971119AEEF9E5U}, // 1e157
+  {0xE912B9D1478CEB17U, 0x7A37CD5601AAB85EU}, // 1e158
+  {0x91ABB422CCB812EEU, 0xAC62E055C10AB33BU}, // 1e159
+  {0xB616A12B7FE617AAU, 0x577B986B314D600AU}, // 1e160
+  {0xE39C49765FDF9D94U, 0xED5A7E85FDA0B80CU}, // 1e161
+  {0x8E41ADE9FBEBC27DU, 0x14588F13BE847308U}, // 1e162
+  {0xB1D219647AE6B31CU, 0x596EB2D8AE258FC9U}, // 1e163
+  {0xDE469FBD99A05FE3U, 0x6FCA5F8ED9AEF3BCU}, // 1e164
+  {0x8AEC23D680043BEEU, 0x25DE7BB9480D5855U}, // 1e165
+  {0xADA72CCC20054AE9U, 0xAF561AA79A10AE6BU}, // 1e166
+  {0xD910F7FF28069DA4U, 0x1B2BA1518094DA05U}, // 1e167
+  {0x87AA9AFF79042286U, 0x90FB44D2F05D0843U}, // 1e168
+  {0xA99541BF57452B28U, 0x353A1607AC744A54U}, // 1e169
+  {0xD3FA922F2D1675F2U, 0x42889B8997915CE9U}, // 1e170
+  {0x847C9B5D7C2E09B7U, 0x69956135FEBADA12U}, // 1e171
+  {0xA59BC234DB398C25U, 0x43FAB9837E699096U}, // 1e172
+  {0xCF02B2C21207EF2EU, 0x94F967E45E03F4BCU}, // 1e173
+  {0x8161AFB94B44F57DU, 0x1D1BE0EEBAC278F6U}, // 1e174
+  {0xA1BA1BA79E1632DCU, 0x6462D92A69731733U}, // 1e175
+  {0xCA28A291859BBF93U, 0x7D7B8F7503CFDCFFU}, // 1e176
+  {0xFCB2CB35E702AF78U, 0x5CDA735244C3D43FU}, // 1e177
+  {0x9DEFBF01B061ADABU, 0x3A0888136AFA64A8U}, // 1e178
+  {0xC56BAEC21C7A1916U, 0x088AAA1845B8FDD1U}, // 1e179
+  {0xF6C69A72A3989F5BU, 0x8AAD549E57273D46U}, // 1e180
+  {0x9A3C2087A63F6399U, 0x36AC54E2F678864CU}, // 1e181
+  {0xC0CB28A98FCF3C7FU, 0x84576A1BB416A7DEU}, // 1e182
+  {0xF0FDF2D3F3C30B9FU, 0x656D44A2A11C51D6U}, // 1e183
+  {0x969EB7C47859E743U, 0x9F644AE5A4B1B326U}, // 1e184
+  {0xBC4665B596706114U, 0x873D5D9F0DDE1FEFU}, // 1e185
+  {0xEB57FF22FC0C7959U, 0xA90CB506D155A7EBU}, // 1e186
+  {0x9316FF75DD87CBD8U, 0x09A7F12442D588F3U}, // 1e187
+  {0xB7DCBF5354E9BECEU, 0x0C11ED6D538AEB30U}, // 1e188
+  {0xE5D3EF282A242E81U, 0x8F1668C8A86DA5FBU}, // 1e189
+  {0x8FA475791A569D10U, 0xF96E017D694487BDU}, // 1e190
+  {0xB38D92D760EC4455U, 0x37C981DCC395A9ADU}, // 1e191
+  {0xE070F78D3927556AU, 0x85BBE253F47B1418U}, // 1e192
+  {0x8C469AB843B89562U, 0x93956D7478CCEC8FU}, // 1e193
+  {0xAF58416654A6BABBU, 0x387AC8D1970027B3U}, // 1e194
+  {0xDB2E51BFE9D0696AU, 0x06997B05FCC0319FU}, // 1e195
+  {0x88FCF317F22241E2U, 0x441FECE3BDF81F04U}, // 1e196
+  {0xAB3C2FDDEEAAD25AU, 0xD527E81CAD7626C4U}, // 1e197
+  {0xD60B3BD56A5586F1U, 0x8A71E223D8D3B075U}, // 1e198
+  {0x85C7056562757456U, 0xF6872D5667844E4AU}, // 1e199
+  {0xA738C6BEBB12D16CU, 0xB428F8AC016561DCU}, // 1e200
+  {0xD106F86E69D785C7U, 0xE13336D701BEBA53U}, // 1e201
+  {0x82A45B450226B39CU, 0xECC0024661173474U}, // 1e202
+  {0xA34D721642B06084U, 0x27F002D7F95D0191U}, // 1e203
+  {0xCC20CE9BD35C78A5U, 0x31EC038DF7B441F5U}, // 1e204
+  {0xFF290242C83396CEU, 0x7E67047175A15272U}, // 1e205
+  {0x9F79A169BD203E41U, 0x0F0062C6E984D387U}, // 1e206
+  {0xC75809C42C684DD1U, 0x52C07B78A3E60869U}, // 1e207
+  {0xF92E0C3537826145U, 0xA7709A56CCDF8A83U}, // 1e208
+  {0x9BBCC7A142B17CCBU, 0x88A66076400BB692U}, // 1e209
+  {0xC2ABF989935DDBFEU, 0x6ACFF893D00EA436U}, // 1e210
+  {0xF356F7EBF83552FEU, 0x0583F6B8C4124D44U}, // 1e211
+  {0x98165AF37B2153DEU, 0xC3727A337A8B704BU}, // 1e212
+  {0xBE1BF1B059E9A8D6U, 0x744F18C0592E4C5DU}, // 1e213
+  {0xEDA2EE1C7064130CU, 0x1162DEF06F79DF74U}, // 1e214
+  {0x9485D4D1C63E8BE7U, 0x8ADDCB5645AC2BA9U}, // 1e215
+  {0xB9A74A0637CE2EE1U, 0x6D953E2BD7173693U}, // 1e216
+  {0xE8111C87C5C1BA99U, 0xC8FA8DB6CCDD0438U}, // 1e217
+  {0x910AB1D4DB9914A0U, 0x1D9C9892400A22A3U}, // 1e218
+  {0xB54D5E4A127F59C8U, 0x2503BEB6D00CAB4CU}, // 1e219
+  {0xE2A0B5DC971F303AU, 0x2E44AE64840FD61EU}, // 1e220
+  {0x8DA471A9DE737E24U, 0x5CEAECFED289E5D3U}, // 1e221
+  {0xB10D8E1456105DADU, 0x7425A83E872C5F48U}, // 1e222
+  {0xDD50F1996B947518U, 0xD12F124E28F7771AU}, // 1e223
+  {0x8A5296FFE33CC92FU, 0x82BD6B70D99AAA70U}, // 1e224
+  {0xACE73CBFDC0BFB7BU, 0x636CC64D1001550CU}, // 1e225
+  {0xD8210BEFD30EFA5AU, 0x3C47F7E05401AA4FU}, // 1e226
+  {0x8714A775E3E95C78U, 0x65ACFAEC34810A72U}, // 1e227
+  {0xA8D9D1535CE3B396U, 0x7F1839A741A14D0EU}, // 1e228
+  {0xD31045A8341CA07CU, 0x1EDE48111209A051U}, // 1e229
+  {0x83EA2B892091E44DU, 0x934AED0AAB460433U}, // 1e230
+  {0xA4E4B66B68B65D60U, 0xF81DA84D56178540U}, // 1e231
+  {0xCE1DE40642E3F4B9U, 0x36251260AB9D668FU}, // 1e232
+  {0x80D2AE83E9CE78F3U, 0xC1D72B7C6B42601AU}, // 1e233
+  {0xA1075A24E4421730U, 0xB24CF65B8612F820U}, // 1e234
+  {0xC94930AE1D529CFCU, 0xDEE033F26797B628U}, // 1e235
+  {0xFB9B7CD9A4A7443CU, 0x169840EF017DA3B2U}, // 1e236
+  {0x9D412E0806E88AA5U, 0x8E1F289560EE864FU}, // 1e237
+  {0xC491798A08A2AD4EU, 0xF1A6F2BAB92A27E3U}, // 1e238
+  {0xF5B5D7EC8ACB58A2U, 0xAE10AF696774B1DCU}, // 1e239
+  {0x9991A6F3D6BF1765U, 0xACCA6DA1E0A8EF2AU}, // 1e240
+  {0xBFF610B0CC6EDD3FU, 0x17FD090A58D32AF4U}, // 1e241
+  {0xEFF394DCFF8A948EU, 0xDDFC4B4CEF07F5B1U}, // 1e242
+  {0x95F83D0A1FB69CD9U, 0x4ABDAF101564F98FU}, // 1e243
+  {0xBB764C4CA7A4440FU, 0x9D6D1AD41ABE37F2U}, // 1e244
+  {0xEA53DF5FD18D5513U, 0x84C86189216DC5EEU}, // 1e245
+  {0x92746B9BE2F8552CU, 0x32FD3CF5B4E49BB5U}, // 1e246
+  {0xB7118682DBB66A77U, 0x3FBC8C33221DC2A2U}, // 1e247
+  {0xE4D5E82392A40515U, 0x0FABAF3FEAA5334BU}, // 1e248
+  {0x8F05B1163BA6832DU, 0x29CB4D87F2A7400FU}, // 1e249
+  {0xB2C71D5BCA9023F8U, 0x743E20E9EF511013U}, // 1e250
+  {0xDF78E4B2BD342CF6U, 0x914DA9246B255417U}, // 1e251
+  {0x8BAB8EEFB6409C1AU, 0x1AD089B6C2F7548FU}, // 1e252
+  {0xAE9672ABA3D0C320U, 0xA184AC2473B529B2U}, // 1e253
+  {0xDA3C0F568CC4F3E8U, 0xC9E5D72D90A2741FU}, // 1e254
+  {0x8865899617FB1871U, 0x7E2FA67C7A658893U}, // 1e255
+  {0xAA7EEBFB9DF9DE8DU, 0xDDBB901B98FEEAB8U}, // 1e256
+  {0xD51EA6FA85785631U, 0x552A74227F3EA566U}, // 1e257
+  {0x8533285C936B35DEU, 0xD53A88958F872760U}, // 1e258
+  {0xA67FF273B8460356U, 0x8A892ABAF368F138U}, // 1e259
+  {0xD01FEF10A657842CU, 0x2D2B7569B0432D86U}, // 1e260
+  {0x8213F56A67F6B29BU, 0x9C3B29620E29FC74U}, // 1e261
+  {0xA298F2C501F45F42U, 0x8349F3BA91B47B90U}, // 1e262
+  {0xCB3F2F7642717713U, 0x241C70A936219A74U}, // 1e263
+  {0xFE0EFB53D30DD4D7U, 0xED238CD383AA0111U}, // 1e264
+  {0x9EC95D1463E8A506U, 0xF4363804324A40ABU}, // 1e265
+  {0xC67BB4597CE2CE48U, 0xB143C6053EDCD0D6U}, // 1e266
+  {0xF81AA16FDC1B81DAU, 0xDD94B7868E94050BU}, // 1e267
+  {0x9B10A4E5E9913128U, 0xCA7CF2B4191C8327U}, // 1e268
+  {0xC1D4CE1F63F57D72U, 0xFD1C2F611F63A3F1U}, // 1e269
+  {0xF24A01A73CF2DCCFU, 0xBC633B39673C8CEDU}, // 1e270
+  {0x976E41088617CA01U, 0xD5BE0503E085D814U}, // 1e271
+  {0xBD49D14AA79DBC82U, 0x4B2D8644D8A74E19U}, // 1e272
+  {0xEC9C459D51852BA2U, 0xDDF8E7D60ED1219FU}, // 1e273
+  {0x93E1AB8252F33B45U, 0xCABB90E5C942B504U}, // 1e274
+  {0xB8DA1662E7B00A17U, 0x3D6A751F3B936244U}, // 1e275
+  {0xE7109BFBA19C0C9DU, 0x0CC512670A783AD5U}, // 1e276
+  {0x906A617D450187E2U, 0x27FB2B80668B24C6U}, // 1e277
+  {0xB484F9DC9641E9DAU, 0xB1F9F660802DEDF7U}, // 1e278
+  {0xE1A63853BBD26451U, 0x5E7873F8A0396974U}, // 1e279
+  {0x8D07E33455637EB2U, 0xDB0B487B6423E1E9U}, // 1e280
+  {0xB049DC016ABC5E5FU, 0x91CE1A9A3D2CDA63U}, // 1e281
+  {0xDC5C5301C56B75F7U, 0x7641A140CC7810FCU}, // 1e282
+  {0x89B9B3E11B6329BAU, 0xA9E904C87FCB0A9EU}, // 1e283
+  {0xAC2820D9623BF429U, 0x546345FA9FBDCD45U}, // 1e284
+  {0xD732290FBACAF133U, 0xA97C177947AD4096U}, // 1e285
+  {0x867F59A9D4BED6C0U, 0x49ED8EABCCCC485EU}, // 1e286
+  {0xA81F301449EE8C70U, 0x5C68F256BFFF5A75U}, // 1e287
+  {0xD226FC195C6A2F8CU, 0x73832EEC6FFF3112U}, // 1e288
+  {0x83585D8FD9C25DB7U, 0xC831FD53C5FF7EACU}, // 1e289
+  {0xA42E74F3D032F525U, 0xBA3E7CA8B77F5E56U}, // 1e290
+  {0xCD3A1230C43FB26FU, 0x28CE1BD2E55F35ECU}, // 1e291
+  {0x80444B5E7AA7CF85U, 0x7980D163CF5B81B4U}, // 1e292
+  {0xA0555E361951C366U, 0xD7E105BCC3326220U}, // 1e293
+  {0xC86AB5C39FA63440U, 0x8DD9472BF3FEFAA8U}, // 1e294
+  {0xFA856334878FC150U, 0xB14F98F6F0FEB952U}, // 1e295
+  {0x9C935E00D4B9D8D2U, 0x6ED1BF9A569F33D4U}, // 1e296
+  {0xC3B8358109E84F07U, 0x0A862F80EC4700C9U}, // 1e297
+  {0xF4A642E14C6262C8U, 0xCD27BB612758C0FBU}, // 1e298
+  {0x98E7E9CCCFBD7DBDU, 0x8038D51CB897789DU}, // 1e299
+  {0xBF21E44003ACDD2CU, 0xE0470A63E6BD56C4U}, // 1e300
+  {0xEEEA5D5004981478U, 0x1858CCFCE06CAC75U}, // 1e301
+  {0x95527A5202DF0CCBU, 0x0F37801E0C43EBC9U}, // 1e302
+  {0xBAA718E68396CFFDU, 0xD30560258F54E6BBU}, // 1e303
+  {0xE950DF20247C83FDU, 0x47C6B82EF32A206AU}, // 1e304
+  {0x91D28B7416CDD27EU, 0x4CDC331D57FA5442U}, // 1e305
+  {0xB6472E511C81471DU, 0xE0133FE4ADF8E953U}, // 1e306
+  {0xE3D8F9E563A198E5U, 0x58180FDDD97723A7U}, // 1e307
+  {0x8E679C2F5E44FF8FU, 0x570F09EAA7EA7649U}, // 1e308
+  {0xB201833B35D63F73U, 0x2CD2CC6551E513DBU}, // 1e309
+  {0xDE81E40A034BCF4FU, 0xF8077F7EA65E58D2U}, // 1e310
+  {0x8B112E86420F6191U, 0xFB04AFAF27FAF783U}, // 1e311
+  {0xADD57A27D29339F6U, 0x79C5DB9AF1F9B564U}, // 1e312
+  {0xD94AD8B1C7380874U, 0x18375281AE7822BDU}, // 1e313
+  {0x87CEC76F1C830548U, 0x8F2293910D0B15B6U}, // 1e314
+  {0xA9C2794AE3A3C69AU, 0xB2EB3875504DDB23U}, // 1e315
+  {0xD433179D9C8CB841U, 0x5FA60692A46151ECU}, // 1e316
+  {0x849FEEC281D7F328U, 0xDBC7C41BA6BCD334U}, // 1e317
+  {0xA5C7EA73224DEFF3U, 0x12B9B522906C0801U}, // 1e318
+  {0xCF39E50FEAE16BEFU, 0xD768226B34870A01U}, // 1e319
+  {0x81842F29F2CCE375U, 0xE6A1158300D46641U}, // 1e320
+  {0xA1E53AF46F801C53U, 0x60495AE3C1097FD1U}, // 1e321
+  {0xCA5E89B18B602368U, 0x385BB19CB14BDFC5U}, // 1e322
+  {0xFCF62C1DEE382C42U, 0x46729E03DD9ED7B6U}, // 1e323
+  {0x9E19DB92B4E31BA9U, 0x6C07A2C26A8346D2U}, // 1e324
+}};
+
+constexpr Uint128 multiply(uint64_t left, uint64_t right) noexcept {
+#if defined(__SIZEOF_INT128__)
+  const Product product = static_cast<Product>(left) * right;
+
+  return {static_cast<uint64_t>(product >> 64), static_cast<uint64_t>(product)};
+#else
+  // Schoolbook product of 32-bit halves for targets without a 128-bit integer type
+  const uint64_t lowLow   = (left & 0xFFFFFFFFU) * (right & 0xFFFFFFFFU);
+  const uint64_t highLow  = (left >> 32) * (right & 0xFFFFFFFFU);
+  const uint64_t lowHigh  = (left & 0xFFFFFFFFU) * (right >> 32);
+  const uint64_t highHigh = (left >> 32) * (right >> 32);
+  const uint64_t cross    = (lowLow >> 32) + (highLow & 0xFFFFFFFFU) + lowHigh;
+
+  return {(highLow >> 32) + (cross >> 32) + highHigh, (cross << 32) | (lowLow & 0xFFFFFFFFU)};
+#endif
+}
+
+constexpr int32_t floorLog2Pow10(int32_t exponent) noexcept {
+  return (exponent * 1741647) >> 19;
+}
+
+constexpr Uint128 normalizedPowerOfTen(int32_t exponent) noexcept {
+  return c_normalizedPowersOfTen[static_cast<size_t>(exponent - c_minTablePower)];
+}
+
+constexpr int32_t decimalDigitCount(uint64_t value) noexcept {
+  value |= 1;
+
+  // bit_width x 1233 / 4096 is floor(log10(2^bit_width)); one comparison corrects it
+  const int32_t estimate = (static_cast<int32_t>(std::bit_width(value)) * 1233) >> 12;
+
+  return estimate + (value >= c_powersOfTen[static_cast<size_t>(estimate)] ? 1 : 0);
+}
+
+constexpr void moveChars(char * destination, const char * source, size_t count) noexcept {
+  if (destination < source) {
+    for (size_t index = 0; index < count; ++index)
+      destination[index] = source[index];
+  } else {
+    for (size_t index = count; index > 0; --index)
+      destination[index - 1] = source[index - 1];
+  }
+}
+
+constexpr char * fillChars(char * buffer, size_t count, char character) noexcept {
+  for (size_t index = 0; index < count; ++index)
+    buffer[index] = character;
+
+  return buffer + count;
+}
+
+constexpr char * writeDigits(char * buffer, uint32_t value, uint32_t count) noexcept {
+  char * cursor = buffer + count;
+
+  while (cursor - buffer >= 2) {
+    const uint32_t pair = (value % 100) * 2;
+
+    value  /= 100;
+    cursor -= 2;
+
+    cursor[0] = c_digitPairs[pair];
+    cursor[1] = c_digitPairs[pair + 1];
+  }
+
+  if (cursor != buffer)
+    buffer[0] = static_cast<char>('0' + value % 10);
+
+  return buffer + count;
+}
+
+constexpr char * writeDecimal(char * buffer, uint64_t value) noexcept {
+  const int32_t count  = decimalDigitCount(value);
+  char *        cursor = buffer + count;
+
+  // Eight digits per 64-bit division, so the rest runs on 32-bit registers, which the ARM targets divide far faster
+  while (value > 0xFFFFFFFFU) {
+    const uint64_t quotient = value / 100000000U;
+
+    cursor -= 8;
+    writeDigits(cursor, static_cast<uint32_t>(value - quotient * 100000000U), 8);
+    value = quotient;
+  }
+
+  writeDigits(buffer, static_cast<uint32_t>(value), static_cast<uint32_t>(cursor - buffer));
+
+  return buffer + count;
+}
+
+constexpr char * writeInteger(char * buffer, uint64_t value, int32_t base) noexcept {
+  if (base == 10)
+    return writeDecimal(buffer, value);
+
+  const auto radix = static_cast<uint32_t>(base);
+  int32_t    count = 1;
+
+  if ((radix & (radix - 1)) == 0) {
+    const int32_t shift = std::countr_zero(radix);
+
+    count = (static_cast<int32_t>(std::bit_width(value | 1)) + shift - 1) / shift;
+
+    for (int32_t index = count; index-- > 0; value >>= shift)
+      buffer[index] = c_digitChars[value & (radix - 1)];
+  } else {
+    for (uint64_t rest = value / radix; rest != 0; rest /= radix)
+      ++count;
+
+    for (int32_t index = count; index-- > 0; value /= radix)
+      buffer[index] = c_digitChars[value % radix];
+  }
+
+  return buffer + count;
+}
+
+constexpr char * writeExponent(char * buffer, int32_t exponent) noexcept {
+  const auto magnitude = static_cast<uint32_t>(exponent < 0 ? -exponent : exponent);
+
+  buffer[0] = 'e';
+  buffer[1] = exponent < 0 ? '-' : '+';
+
+  return writeDigits(buffer + 2, magnitude, magnitude >= 100 ? 3 : 2);
+}
+
+constexpr BigInteger::BigInteger(uint64_t value) noexcept {
+  _limbs[0] = static_cast<uint32_t>(value);
+  _limbs[1] = static_cast<uint32_t>(value >> 32);
+  _size     = value > 0xFFFFFFFFU ? 2 : value != 0 ? 1 : 0;
+}
+
+constexpr bool BigInteger::isZero() const noexcept {
+  return _size == 0;
+}
+
+constexpr uint32_t BigInteger::bitWidth() const noexcept {
+  return _size == 0 ? 0 : 32 * (_size - 1) + static_cast<uint32_t>(std::bit_width(_limbs[_size - 1]));
+}
+
+constexpr void BigInteger::multiplyAdd(uint32_t factor, uint32_t addend) noexcept {
+  uint64_t carry = addend;
+
+  for (uint32_t index = 0; index < _size; ++index) {
+    const uint64_t product = static_cast<uint64_t>(_limbs[index]) * factor + carry;
+
+    _limbs[index] = static_cast<uint32_t>(product);
+    carry         = product >> 32;
+  }
+
+  if (carry != 0)
+    _limbs[_size++] = static_cast<uint32_t>(carry);
+}
+
+constexpr void BigInteger::multiplyPowerOfFive(uint32_t exponent) noexcept {
+  // 5^13 is the largest power of five below 2^32
+  for (; exponent >= 13; exponent -= 13)
+    multiplyAdd(1220703125U);
+
+  uint32_t factor = 1;
+
+  for (; exponent > 0; --exponent)
+    factor *= 5;
+
+  if (factor != 1)
+    multiplyAdd(factor);
+}
+
+constexpr void BigInteger::shiftLeft(uint32_t bits) noexcept {
+  if (_size == 0)
+    return;
+
+  const uint32_t limbs  = bits / 32;
+  const uint32_t offset = bits % 32;
+
+  if (offset != 0) {
+    uint32_t carry = 0;
+
+    for (uint32_t index = 0; index < _size; ++index) {
+      const uint32_t next = _limbs[index] >> (32 - offset);
+
+      _limbs[index] = (_limbs[index] << offset) | carry;
+      carry         = next;
+    }
+
+    if (carry != 0)
+      _limbs[_size++] = carry;
+  }
+
+  if (limbs != 0) {
+    for (uint32_t index = _size; index-- > 0;)
+      _limbs[index + limbs] = _limbs[index];
+
+    for (uint32_t index = 0; index < limbs; ++index)
+      _limbs[index] = 0;
+
+    _size += limbs;
+  }
+}
+
+constexpr uint32_t BigInteger::divide(uint32_t divisor) noexcept {
+  uint64_t remainder = 0;
+
+  for (uint32_t index = _size; index-- > 0;) {
+    const uint64_t current = (remainder << 32) | _limbs[index];
+
+    _limbs[index] = static_cast<uint32_t>(current / divisor);
+    remainder     = current % divisor;
+  }
+
+  trim();
+
+  return static_cast<uint32_t>(remainder);
+}
+
+constexpr uint32_t BigInteger::extractAbove(uint32_t bits) noexcept {
+  const uint32_t index  = bits / 32;
+  const uint32_t offset = bits % 32;
+
+  if (index >= _size)
+    return 0;
+
+  uint64_t window = _limbs[index];
+
+  if (index + 1 < _size)
+    window |= static_cast<uint64_t>(_limbs[index + 1]) << 32;
+
+  for (uint32_t limb = index + 1; limb < _size; ++limb)
+    _limbs[limb] = 0;
+
+  _limbs[index] &= (uint32_t{1} << offset) - 1;
+  _size          = index + 1;
+  trim();
+
+  return static_cast<uint32_t>(window >> offset);
+}
+
+constexpr int32_t BigInteger::compareWithPowerOfTwo(uint32_t exponent) const noexcept {
+  const uint32_t width = bitWidth();
+
+  if (width != exponent + 1)
+    return width < exponent + 1 ? -1 : 1;
+
+  // Same highest bit: equal only when every bit below it is clear
+  const uint32_t index = exponent / 32;
+
+  if (_limbs[index] != uint32_t{1} << (exponent % 32))
+    return 1;
+
+  for (uint32_t limb = 0; limb < index; ++limb) {
+    if (_limbs[limb] != 0)
+      return 1;
+  }
+
+  return 0;
+}
+
+constexpr int32_t BigInteger::compare(const BigInteger & other) const noexcept {
+  if (_size != other._size)
+    return _size < other._size ? -1 : 1;
+
+  for (uint32_t index = _size; index-- > 0;) {
+    if (_limbs[index] != other._limbs[index])
+      return _limbs[index] < other._limbs[index] ? -1 : 1;
+  }
+
+  return 0;
+}
+
+constexpr void BigInteger::trim() noexcept {
+  while (_size > 0 && _limbs[_size - 1] == 0)
+    --_size;
+}
+
+constexpr char * writeBigDecimal(char * buffer, BigInteger value) noexcept {
+  // Nine digits per division, least significant group first
+  array<uint32_t, 40> groups{};
+  size_t              count = 0;
+
+  while (!value.isZero())
+    groups[count++] = value.divide(1000000000U);
+
+  if (count == 0)
+    return writeDecimal(buffer, 0);
+
+  buffer = writeDecimal(buffer, groups[count - 1]);
+
+  while (--count > 0)
+    buffer = writeDigits(buffer, groups[count - 1], 9);
+
+  return buffer;
+}
+
+constexpr WordFraction::WordFraction(uint64_t numerator, uint32_t bits) noexcept
+  : _numerator(numerator)
+  , _bits(bits) {}
+
+constexpr bool WordFraction::isZero() const noexcept {
+  return _numerator == 0;
+}
+
+constexpr uint32_t WordFraction::skipZeros() noexcept {
+  uint32_t zeros = 0;
+
+  for (; (_numerator * 10) >> _bits == 0; ++zeros)
+    _numerator *= 10;
+
+  return zeros;
+}
+
+constexpr char * WordFraction::write(char * buffer, uint32_t count) noexcept {
+  const uint64_t mask = (uint64_t{1} << _bits) - 1;
+
+  for (; count != 0 && _numerator != 0; --count) {
+    _numerator *= 10;
+    *buffer++   = static_cast<char>('0' + (_numerator >> _bits));
+    _numerator &= mask;
+  }
+
+  return fillChars(buffer, count, '0');
+}
+
+constexpr int32_t WordFraction::compareHalf() const noexcept {
+  const uint64_t half = uint64_t{1} << (_bits - 1);
+
+  return _numerator > half ? 1 : _numerator < half ? -1 : 0;
+}
+
+constexpr BigFraction::BigFraction(uint64_t numerator, uint32_t bits) noexcept
+  : _numerator(numerator)
+  , _bits(bits) {}
+
+constexpr bool BigFraction::isZero() const noexcept {
+  return _numerator.isZero();
+}
+
+constexpr uint32_t BigFraction::skipZeros() noexcept {
+  uint32_t zeros = 0;
+
+  // Nine zeros at a time while a whole group stays below one, then single digits
+  for (uint32_t factor : {1000000000U, 10U}) {
+    for (;;) {
+      BigInteger probe = _numerator;
+      probe.multiplyAdd(factor);
+
+      if (probe.bitWidth() > _bits)
+        break;
+
+      _numerator  = probe;
+      zeros      += factor == 10U ? 1 : 9;
+    }
+  }
+
+  return zeros;
+}
+
+constexpr char * BigFraction::write(char * buffer, uint32_t count) noexcept {
+  while (count != 0 && !_numerator.isZero()) {
+    const uint32_t group = count < 9 ? count : 9;
+
+    _numerator.multiplyAdd(static_cast<uint32_t>(c_powersOfTen[group]));
+    buffer = writeDigits(buffer, _numerator.extractAbove(_bits), group);
+    count -= group;
+  }
+
+  return fillChars(buffer, count, '0');
+}
+
+constexpr int32_t BigFraction::compareHalf() const noexcept {
+  return _numerator.compareWithPowerOfTwo(_bits - 1);
+}
+
+constexpr uint64_t roundToOdd(const Uint128 & power, uint64_t value) noexcept {
+  const Uint128  low    = multiply(power.low, value);
+  const Uint128  high   = multiply(power.high, value);
+  const uint64_t middle = high.low + low.high;
+  const uint64_t top    = high.high + (middle < high.low ? 1 : 0);
+
+  return top | (middle > 1 ? 1 : 0);
+}
+
+constexpr uint32_t roundToOdd(uint64_t power, uint32_t value) noexcept {
+  const Uint128  product = multiply(power, value);
+  const auto     top     = static_cast<uint32_t>(product.high);
+  const uint32_t middle  = static_cast<uint32_t>(product.low >> 32);
+
+  return top | (middle > 1 ? 1 : 0);
+}
+
+template <typename T>
+constexpr DecimalFloat shortestDecimal(uint64_t significandBits, int32_t exponentBits) noexcept {
+  using Traits = FloatTraits<T>;
+
+  constexpr int32_t c_precision   = Traits::c_mantissaBits + 1;
+  constexpr int32_t c_minExponent = 1 - Traits::c_exponentBias - Traits::c_mantissaBits;
+
+  // The value is c x 2^q
+  uint64_t c = significandBits;
+  int32_t  q = c_minExponent;
+
+  if (exponentBits != 0) {
+    c |= uint64_t{1} << Traits::c_mantissaBits;
+    q  = exponentBits + c_minExponent - 1;
+
+    // Integers below 2^precision are their own shortest form
+    if (q <= 0 && -q < c_precision && (c & ((uint64_t{1} << -q) - 1)) == 0)
+      return {c >> -q, 0};
+  }
+
+  // Powers of two have a lower neighbour twice as close as the upper one
+  const bool    even   = (c & 1) == 0;
+  const bool    closer = significandBits == 0 && exponentBits > 1;
+  const int32_t k      = (q * 1262611 - (closer ? 524031 : 0)) >> 22;
+  const int32_t h      = q + floorLog2Pow10(-k) + 1;
+
+  // Interval bounds and the value, in quarters of a unit, scaled by 10^-k
+  const uint64_t cbl = (4 * c - 2 + (closer ? 1 : 0)) << h;
+  const uint64_t cb  = (4 * c) << h;
+  const uint64_t cbr = (4 * c + 2) << h;
+  const Uint128  g   = normalizedPowerOfTen(-k);
+
+  uint64_t vbl;
+  uint64_t vb;
+  uint64_t vbr;
+
+  if constexpr (Traits::c_mantissaBits > 32) {
+    vbl = roundToOdd(g, cbl);
+    vb  = roundToOdd(g, cb);
+    vbr = roundToOdd(g, cbr);
+  } else {
+    // The upper half of the table entry, rounded up, carries enough precision for float
+    const uint64_t power = g.high + (g.low != 0 ? 1 : 0);
+
+    vbl = roundToOdd(power, static_cast<uint32_t>(cbl));
+    vb  = roundToOdd(power, static_cast<uint32_t>(cb));
+    vbr = roundToOdd(power, static_cast<uint32_t>(cbr));
+  }
+
+  const uint64_t lower = vbl + (even ? 0 : 1);
+  const uint64_t upper = vbr - (even ? 0 : 1);
+  const uint64_t s     = vb / 4;
+
+  // One digit fewer when exactly one of the two candidates ending in zero lies inside the interval
+  if (s >= 10) {
+    const uint64_t sp       = s / 10;
+    const bool     upInside = lower <= 40 * sp;
+    const bool     wpInside = 40 * sp + 40 <= upper;
+
+    if (upInside != wpInside)
+      return {sp + (wpInside ? 1 : 0), k + 1};
+  }
+
+  const bool uInside = lower <= 4 * s;
+  const bool wInside = 4 * s + 4 <= upper;
+
+  if (uInside != wInside)
+    return {s + (wInside ? 1 : 0), k};
+
+  // Both candidates inside: the nearer one, the even one on a tie
+  const uint64_t middle  = 4 * s + 2;
+  const bool     roundUp = vb > middle || (vb == middle && (s & 1) != 0);
+
+  return {s + (roundUp ? 1 : 0), k};
+}
+
+constexpr bool isFixedShorter(uint64_t significand, int32_t exponent) noexcept {
+  const int32_t count      = decimalDigitCount(significand);
+  const int32_t scientific = exponent + count - 1;
+
+  // Lengths of both notations without the sign
+  const int32_t scientificLength = count + (count > 1 ? 1 : 0) + (scientific <= -100 || scientific >= 100 ? 5 : 4);
+  const int32_t fixedLength      = exponent >= 0 ? count + exponent : count > -exponent ? count + 1 : 2 - exponent;
+
+  return fixedLength <= scientificLength;
+}
+
+constexpr char * writeShortestDecimal(char * buffer, uint64_t significand, int32_t exponent) noexcept {
+  const int32_t count = decimalDigitCount(significand);
+
+  if (!isFixedShorter(significand, exponent)) {
+    writeDecimal(buffer + 1, significand);
+    buffer[0] = buffer[1];
+
+    if (count > 1) {
+      buffer[1]  = '.';
+      buffer    += count + 1;
+    } else {
+      ++buffer;
+    }
+
+    return writeExponent(buffer, exponent + count - 1);
+  }
+
+  if (exponent >= 0)
+    return fillChars(writeDecimal(buffer, significand), static_cast<size_t>(exponent), '0');
+
+  if (count > -exponent) {
+    // Point inside the digits: write them one place right, then move the integer digits back over the gap
+    const auto integerCount = static_cast<size_t>(count + exponent);
+
+    writeDecimal(buffer + 1, significand);
+    moveChars(buffer, buffer + 1, integerCount);
+    buffer[integerCount] = '.';
+
+    return buffer + count + 1;
+  }
+
+  buffer[0] = '0';
+  buffer[1] = '.';
+
+  return writeDecimal(fillChars(buffer + 2, static_cast<size_t>(-exponent - count), '0'), significand);
+}
+
+constexpr bool incrementDigits(char * first, char * last) noexcept {
+  while (last != first) {
+    --last;
+
+    if (*last == '.')
+      continue;
+
+    if (*last != '9') {
+      ++*last;
+      return false;
+    }
+
+    *last = '0';
+  }
+
+  return true;
+}
+
+template <typename Fraction>
+constexpr char * writeFixedDigits(char * buffer, uint64_t integer, Fraction fraction, int32_t precision) noexcept {
+  char * const first = buffer;
+
+  buffer = writeDecimal(buffer, integer);
+
+  if (precision > 0) {
+    *buffer++ = '.';
+    buffer    = fraction.write(buffer, static_cast<uint32_t>(precision));
+  }
+
+  // Half to even; the parity of a digit character is the parity of the digit
+  const int32_t half = fraction.compareHalf();
+
+  if ((half > 0 || (half == 0 && (buffer[-1] & 1) != 0)) && incrementDigits(first, buffer)) {
+    moveChars(first + 1, first, static_cast<size_t>(buffer - first));
+    *first = '1';
+    ++buffer;
+  }
+
+  return buffer;
+}
+
+constexpr char * writeFixed(char * buffer, uint64_t significand, int32_t exponent, int32_t precision) noexcept {
+  if (exponent >= 0) {
+    // An integer: no rounding, only zeros after the point
+    if (exponent < 64 - static_cast<int32_t>(std::bit_width(significand))) {
+      buffer = writeDecimal(buffer, significand << exponent);
+    } else {
+      BigInteger integer(significand);
+      integer.shiftLeft(static_cast<uint32_t>(exponent));
+      buffer = writeBigDecimal(buffer, integer);
+    }
+
+    if (precision > 0) {
+      *buffer++ = '.';
+      buffer    = fillChars(buffer, static_cast<size_t>(precision), '0');
+    }
+
+    return buffer;
+  }
+
+  const auto     bits     = static_cast<uint32_t>(-exponent);
+  const uint64_t integer  = bits < 64 ? significand >> bits : 0;
+  const uint64_t fraction = bits < 64 ? significand & ((uint64_t{1} << bits) - 1) : significand;
+
+  if (bits <= WordFraction::c_maxBits)
+    return writeFixedDigits(buffer, integer, WordFraction(fraction, bits), precision);
+
+  return writeFixedDigits(buffer, integer, BigFraction(fraction, bits), precision);
+}
+
+template <typename Fraction>
+constexpr int32_t writeLeadingDigits(char * buffer, const char * digits, const char * end, Fraction & fraction,
+                                     uint32_t count, int32_t & decimalExponent) noexcept {
+  const auto integerCount = static_cast<uint32_t>(end - digits);
+
+  if (integerCount == 0) {
+    decimalExponent = -1 - static_cast<int32_t>(fraction.skipZeros());
+    fraction.write(buffer, count);
+
+    return fraction.compareHalf();
+  }
+
+  decimalExponent = static_cast<int32_t>(integerCount) - 1;
+
+  if (integerCount < count) {
+    moveChars(buffer, digits, integerCount);
+    fraction.write(buffer + integerCount, count - integerCount);
+
+    return fraction.compareHalf();
+  }
+
+  moveChars(buffer, digits, count);
+
+  if (integerCount == count)
+    return fraction.compareHalf();
+
+  // The tail starts inside the integer digits
+  const char dropped = digits[count];
+
+  if (dropped != '5')
+    return dropped > '5' ? 1 : -1;
+
+  for (const char * digit = digits + count + 1; digit != end; ++digit) {
+    if (*digit != '0')
+      return 1;
+  }
+
+  return fraction.isZero() ? 0 : 1;
+}
+
+constexpr int32_t writeSignificantDigits(char * buffer, uint64_t significand, int32_t exponent,
+                                         uint32_t count) noexcept {
+  // Integer digits of the largest double
+  char    digits[309];
+  int32_t decimalExponent = 0;
+  int32_t half            = 0;
+
+  if (exponent >= 0) {
+    const char * end = nullptr;
+
+    if (exponent < 64 - static_cast<int32_t>(std::bit_width(significand))) {
+      end = writeDecimal(digits, significand << exponent);
+    } else {
+      BigInteger integer(significand);
+      integer.shiftLeft(static_cast<uint32_t>(exponent));
+      end = writeBigDecimal(digits, integer);
+    }
+
+    WordFraction none(0, 1);
+    half = writeLeadingDigits(buffer, digits, end, none, count, decimalExponent);
+  } else {
+    const auto     bits     = static_cast<uint32_t>(-exponent);
+    const uint64_t integer  = bits < 64 ? significand >> bits : 0;
+    const uint64_t numerator = bits < 64 ? significand & ((uint64_t{1} << bits) - 1) : significand;
+    const char *   end      = integer != 0 ? writeDecimal(digits, integer) : digits;
+
+    if (bits <= WordFraction::c_maxBits) {
+      WordFraction fraction(numerator, bits);
+      half = writeLeadingDigits(buffer, digits, end, fraction, count, decimalExponent);
+    } else {
+      BigFraction fraction(numerator, bits);
+      half = writeLeadingDigits(buffer, digits, end, fraction, count, decimalExponent);
+    }
+  }
+
+  // A carry out of the first digit turns 99..9 into 100..0, one decade up
+  if ((half > 0 || (half == 0 && (buffer[count - 1] & 1) != 0)) && incrementDigits(buffer, buffer + count)) {
+    buffer[0] = '1';
+    ++decimalExponent;
+  }
+
+  return decimalExponent;
+}
+
+constexpr char * writeScientific(char * buffer, uint64_t significand, int32_t exponent, int32_t precision) noexcept {
+  const uint32_t count           = static_cast<uint32_t>(precision) + 1;
+  int32_t        decimalExponent = 0;
+
+  // Digits go one place right, then the first moves back in front of the point
+  if (significand != 0)
+    decimalExponent = writeSignificantDigits(buffer + 1, significand, exponent, count);
+  else
+    fillChars(buffer + 1, count, '0');
+
+  buffer[0] = buffer[1];
+
+  if (count > 1) {
+    buffer[1]  = '.';
+    buffer    += count + 1;
+  } else {
+    ++buffer;
+  }
+
+  return writeExponent(buffer, decimalExponent);
+}
+
+constexpr char * writeGeneral(char * buffer, uint64_t significand, int32_t exponent, int32_t precision) noexcept {
+  const uint32_t count           = precision == 0 ? 1 : static_cast<uint32_t>(precision);
+  char * const   digits          = buffer + 1;
+  int32_t        decimalExponent = 0;
+
+  if (significand != 0)
+    decimalExponent = writeSignificantDigits(digits, significand, exponent, count);
+  else
+    digits[0] = '0';
+
+  uint32_t used = significand != 0 ? count : 1;
+
+  while (used > 1 && digits[used - 1] == '0')
+    --used;
+
+  if (decimalExponent < -4 || decimalExponent >= static_cast<int32_t>(count)) {
+    buffer[0] = digits[0];
+
+    if (used > 1) {
+      buffer[1]  = '.';
+      buffer    += used + 1;
+    } else {
+      ++buffer;
+    }
+
+    return writeExponent(buffer, decimalExponent);
+  }
+
+  if (decimalExponent >= 0) {
+    const auto integerCount = static_cast<uint32_t>(decimalExponent) + 1;
+
+    moveChars(buffer, digits, used);
+
+    if (used <= integerCount)
+      return fillChars(buffer + used, integerCount - used, '0');
+
+    moveChars(buffer + integerCount + 1, buffer + integerCount, used - integerCount);
+    buffer[integerCount] = '.';
+
+    return buffer + used + 1;
+  }
+
+  // 0.000ddd: the digits move right past the point and the zeros
+  const auto offset = static_cast<size_t>(1 - decimalExponent);
+
+  moveChars(buffer + offset, digits, used);
+  buffer[0] = '0';
+  buffer[1] = '.';
+  fillChars(buffer + 2, offset - 2, '0');
+
+  return buffer + offset + used;
+}
+
+template <typename T>
+constexpr char * writeHex(char * buffer, uint64_t significandBits, int32_t exponentBits, int32_t precision) noexcept {
+  using Traits = FloatTraits<T>;
+
+  // Fraction digits of the full significand: 13 for double, 6 for float with the bits shifted to a digit boundary
+  constexpr int32_t c_digits = (Traits::c_mantissaBits + 3) / 4;
+
+  uint64_t      fraction = significandBits << (4 * c_digits - Traits::c_mantissaBits);
+  uint32_t      leading  = exponentBits != 0 ? 1 : 0;
+  int32_t       count    = c_digits;
+  const int32_t exponent = exponentBits != 0      ? exponentBits - Traits::c_exponentBias
+                         : significandBits != 0 ? 1 - Traits::c_exponentBias
+                                                : 0;
+
+  if (precision < 0) {
+    for (; count > 0 && (fraction & 0xF) == 0; --count)
+      fraction >>= 4;
+  } else if (precision < c_digits) {
+    const int32_t  shift = 4 * (c_digits - precision);
+    const uint64_t rest  = fraction & ((uint64_t{1} << shift) - 1);
+    const uint64_t half  = uint64_t{1} << (shift - 1);
+
+    fraction >>= shift;
+
+    const bool odd = ((precision == 0 ? leading : fraction) & 1) != 0;
+
+    if (rest > half || (rest == half && odd)) {
+      const uint64_t mask = (uint64_t{1} << (4 * precision)) - 1;
+
+      // A carry out of the fraction moves into the leading digit
+      if ((++fraction & ~mask) != 0) {
+        fraction &= mask;
+        ++leading;
+      }
+    }
+
+    count = precision;
+  }
+
+  *buffer++ = static_cast<char>('0' + leading);
+
+  if (count > 0)
+    *buffer++ = '.';
+
+  for (int32_t index = count; index-- > 0;)
+    *buffer++ = c_digitChars[(fraction >> (4 * index)) & 0xF];
+
+  if (precision > count)
+    buffer = fillChars(buffer, static_cast<size_t>(precision - count), '0');
+
+  *buffer++ = 'p';
+  *buffer++ = exponent < 0 ? '-' : '+';
+
+  return writeDecimal(buffer, static_cast<uint64_t>(exponent < 0 ? -exponent : exponent));
+}
+
+template <typename T>
+constexpr char * writeShortest(char * buffer, T value) noexcept {
+  using Traits = FloatTraits<T>;
+  using Bits   = typename Traits::Bits;
+
+  const Bits     bits            = std::bit_cast<Bits>(value);
+  const uint64_t significandBits = bits & ((Bits{1} << Traits::c_mantissaBits) - 1);
+  const auto     exponentBits    = static_cast<int32_t>((bits >> Traits::c_mantissaBits) & Traits::c_exponentMask);
+
+  if ((bits >> (sizeof(Bits) * 8 - 1)) != 0)
+    *buffer++ = '-';
+
+  if (exponentBits == Traits::c_exponentMask) {
+    const char * name = significandBits == 0 ? "inf" : "nan";
+
+    moveChars(buffer, name, 3);
+    return buffer + 3;
+  }
+
+  if (exponentBits == 0 && significandBits == 0) {
+    *buffer = '0';
+    return buffer + 1;
+  }
+
+  DecimalFloat decimal = shortestDecimal<T>(significandBits, exponentBits);
+
+  while (decimal.significand % 10 == 0) {
+    decimal.significand /= 10;
+    ++decimal.exponent;
+  }
+
+  // Fixed notation past the shortest digits spells out the exact integer, as std::to_chars does
+  if (decimal.exponent > 0 && isFixedShorter(decimal.significand, decimal.exponent)) {
+    constexpr int32_t c_minExponent = 1 - Traits::c_exponentBias - Traits::c_mantissaBits;
+
+    return writeFixed(buffer, significandBits | (uint64_t{1} << Traits::c_mantissaBits),
+                      exponentBits + c_minExponent - 1, 0);
+  }
+
+  return writeShortestDecimal(buffer, decimal.significand, decimal.exponent);
+}
+
+template <typename T>
+constexpr char * writeFloat(char * buffer, T value, FloatFormat format, int32_t precision) noexcept {
+  using Traits = FloatTraits<T>;
+  using Bits   = typename Traits::Bits;
+
+  constexpr int32_t c_minExponent = 1 - Traits::c_exponentBias - Traits::c_mantissaBits;
+
+  const Bits     bits            = std::bit_cast<Bits>(value);
+  const uint64_t significandBits = bits & ((Bits{1} << Traits::c_mantissaBits) - 1);
+  const auto     exponentBits    = static_cast<int32_t>((bits >> Traits::c_mantissaBits) & Traits::c_exponentMask);
+
+  if ((bits >> (sizeof(Bits) * 8 - 1)) != 0)
+    *buffer++ = '-';
+
+  if (exponentBits == Traits::c_exponentMask) {
+    const char * name = significandBits == 0 ? "inf" : "nan";
+
+    moveChars(buffer, name, 3);
+    return buffer + 3;
+  }
+
+  if (format == FloatFormat::Hex)
+    return writeHex<T>(buffer, significandBits, exponentBits, precision);
+
+  if (precision < 0)
+    precision = 6;
+
+  // The exact value significand x 2^exponent; float and double share the decimal paths from here
+  uint64_t significand = significandBits;
+  int32_t  exponent    = significandBits != 0 ? c_minExponent : 0;
+
+  if (exponentBits != 0) {
+    significand |= uint64_t{1} << Traits::c_mantissaBits;
+    exponent     = exponentBits + c_minExponent - 1;
+  }
+
+  switch (format) {
+    case FloatFormat::Scientific:
+      return writeScientific(buffer, significand, exponent, precision);
+    case FloatFormat::Fixed:
+      return writeFixed(buffer, significand, exponent, precision);
+    default:
+      return writeGeneral(buffer, significand, exponent, precision);
+  }
+}
+
+constexpr uint64_t read64(const char * data) noexcept {
+  if !consteval {
+    uint64_t value;
+    std::memcpy(&value, data, sizeof(value));
+
+    if constexpr (std::endian::native == std::endian::big)
+      value = std::byteswap(value);
+
+    return value;
+  }
+
+  uint64_t value = 0;
+
+  for (size_t index = 0; index < 8; ++index)
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(data[index])) << (index * 8);
+
+  return value;
+}
+
+constexpr bool isEightDigits(uint64_t chunk) noexcept {
+  // A byte below '0' borrows into its top bit, and one above '9' carries into it
+  return (((chunk + 0x4646464646464646U) | (chunk - 0x3030303030303030U)) & 0x8080808080808080U) == 0;
+}
+
+constexpr uint32_t parseEightDigits(uint64_t chunk) noexcept {
+  // Pairs, then quads, then the whole: three multiplications instead of eight
+  chunk -= 0x3030303030303030U;
+  chunk  = chunk * 10 + (chunk >> 8);
+  chunk  = ((chunk & 0x000000FF000000FFU) * 0x000F424000000064U
+           + ((chunk >> 16) & 0x000000FF000000FFU) * 0x0000271000000001U)
+        >> 32;
+
+  return static_cast<uint32_t>(chunk);
+}
+
+constexpr const char * readDigits(const char * first, const char * last, uint64_t & value) noexcept {
+  while (last - first >= 8) {
+    const uint64_t chunk = read64(first);
+
+    if (!isEightDigits(chunk))
+      break;
+
+    value  = value * 100000000U + parseEightDigits(chunk);
+    first += 8;
+  }
+
+  for (; first != last && *first >= '0' && *first <= '9'; ++first)
+    value = value * 10 + static_cast<uint64_t>(*first - '0');
+
+  return first;
+}
+
+template <typename T>
+constexpr typename FloatTraits<T>::Bits eiselLemire(uint64_t significand, int64_t exponent) noexcept {
+  using Traits = FloatTraits<T>;
+  using Bits   = typename Traits::Bits;
+
+  constexpr int32_t  c_mantissaBits  = Traits::c_mantissaBits;
+  constexpr Bits     c_infinity      = static_cast<Bits>(Traits::c_exponentMask) << c_mantissaBits;
+  constexpr uint64_t c_precisionMask = ~uint64_t{0} >> (c_mantissaBits + 3);
+
+  if (significand == 0 || exponent < Traits::c_minPowerOfTen)
+    return 0;
+
+  if (exponent > Traits::c_maxPowerOfTen)
+    return c_infinity;
+
+  const auto    power = static_cast<int32_t>(exponent);
+  const int32_t zeros = std::countl_zero(significand);
+
+  significand <<= zeros;
+
+  // The table rounds up; the algorithm wants 5^power truncated, which differs where the power is inexact, except from
+  // 10^-27 to 10^-1, where rounding up is what the error analysis assumes
+  Uint128 factor = normalizedPowerOfTen(power);
+
+  if (power < -27 || power > 55) {
+    if (factor.low-- == 0)
+      --factor.high;
+  }
+
+  Uint128 product = multiply(significand, factor.high);
+
+  // The lower half of the table entry matters only when the bits below the result are all ones
+  if ((product.high & c_precisionMask) == c_precisionMask) {
+    const Uint128 second = multiply(significand, factor.low);
+
+    product.low += second.high;
+
+    if (second.high > product.low)
+      ++product.high;
+  }
+
+  const auto    upper    = static_cast<int32_t>(product.high >> 63);
+  const int32_t shift    = upper + 64 - c_mantissaBits - 3;
+  uint64_t      mantissa = product.high >> shift;
+  int32_t       binary   = floorLog2Pow10(power) + 63 + upper - zeros + Traits::c_exponentBias;
+
+  if (binary <= 0) {
+    // Subnormal, or zero; rounding may still carry into the smallest normal exponent
+    if (-binary + 1 >= 64)
+      return 0;
+
+    mantissa >>= -binary + 1;
+    mantissa  += mantissa & 1;
+    mantissa >>= 1;
+
+    return static_cast<Bits>(mantissa);
+  }
+
+  // Exactly halfway between two values: round to even instead of up
+  if (product.low <= 1 && power >= Traits::c_minRoundToEven && power <= Traits::c_maxRoundToEven
+      && (mantissa & 3) == 1 && (mantissa << shift) == product.high)
+    mantissa &= ~uint64_t{1};
+
+  mantissa  += mantissa & 1;
+  mantissa >>= 1;
+
+  if (mantissa >= uint64_t{2} << c_mantissaBits) {
+    mantissa = uint64_t{1} << c_mantissaBits;
+    ++binary;
+  }
+
+  if (binary >= Traits::c_exponentMask)
+    return c_infinity;
+
+  mantissa &= ~(uint64_t{1} << c_mantissaBits);
+
+  return static_cast<Bits>(mantissa | (static_cast<uint64_t>(binary) << c_mantissaBits));
+}
+
+template <typename T>
+constexpr typename FloatTraits<T>::Bits resolveHalfway(typename FloatTraits<T>::Bits lower, const char * first,
+                                                       const char * last, int64_t exponent) noexcept {
+  using Traits = FloatTraits<T>;
+
+  constexpr int32_t c_minExponent = 1 - Traits::c_exponentBias - Traits::c_mantissaBits;
+
+  // The leading significant digits; any nonzero digit past them only breaks a tie
+  BigInteger digits;
+  uint32_t   taken     = 0;
+  uint32_t   group     = 0;
+  uint32_t   groupSize = 0;
+  bool       sticky    = false;
+
+  for (; first != last; ++first) {
+    if (*first == '.' || (taken == 0 && *first == '0'))
+      continue;
+
+    if (taken == Traits::c_maxDigits) {
+      sticky = sticky || *first != '0';
+      ++exponent;
+      continue;
+    }
+
+    group = group * 10 + static_cast<uint32_t>(*first - '0');
+    ++taken;
+
+    if (++groupSize == 9) {
+      digits.multiplyAdd(1000000000U, group);
+      group     = 0;
+      groupSize = 0;
+    }
+  }
+
+  if (groupSize != 0)
+    digits.multiplyAdd(static_cast<uint32_t>(c_powersOfTen[groupSize]), group);
+
+  // Halfway point between lower and the next value: (2m + 1) x 2^(e - 1)
+  const uint64_t significandBits = lower & ((uint64_t{1} << Traits::c_mantissaBits) - 1);
+  const auto     exponentBits    = static_cast<int32_t>(lower >> Traits::c_mantissaBits);
+  const uint64_t significand     = exponentBits != 0 ? significandBits | (uint64_t{1} << Traits::c_mantissaBits)
+                                                     : significandBits;
+  const int32_t  binaryExponent  = exponentBits != 0 ? exponentBits + c_minExponent - 1 : c_minExponent;
+
+  BigInteger halfway(2 * significand + 1);
+  int64_t    digitsShift  = 0;
+  int64_t    halfwayShift = binaryExponent - 1;
+
+  // digits x 10^exponent against halfway x 2^halfwayShift, with every power of five and two moved to integers
+  if (exponent >= 0) {
+    digits.multiplyPowerOfFive(static_cast<uint32_t>(exponent));
+    digitsShift = exponent;
+  } else {
+    halfway.multiplyPowerOfFive(static_cast<uint32_t>(-exponent));
+    halfwayShift -= exponent;
+  }
+
+  if (digitsShift > halfwayShift)
+    digits.shiftLeft(static_cast<uint32_t>(digitsShift - halfwayShift));
+  else
+    halfway.shiftLeft(static_cast<uint32_t>(halfwayShift - digitsShift));
+
+  const int32_t order = digits.compare(halfway);
+
+  return order > 0 || (order == 0 && (sticky || (significand & 1) != 0)) ? lower + 1 : lower;
+}
+
+template <typename T>
+constexpr ParseResult parseSpecial(const char * first, const char * cursor, const char * last,
+                                   typename FloatTraits<T>::Bits sign, T & value) noexcept {
+  using Traits = FloatTraits<T>;
+  using Bits   = typename Traits::Bits;
+
+  const auto matches = [&](string_view word) noexcept {
+    if (static_cast<size_t>(last - cursor) < word.size())
+      return false;
+
+    for (size_t index = 0; index < word.size(); ++index) {
+      if ((cursor[index] | 0x20) != word[index])
+        return false;
+    }
+
+    return true;
+  };
+
+  constexpr Bits c_infinity = static_cast<Bits>(Traits::c_exponentMask) << Traits::c_mantissaBits;
+
+  if (matches("inf")) {
+    cursor += matches("infinity") ? 8 : 3;
+    value   = std::bit_cast<T>(static_cast<Bits>(sign | c_infinity));
+
+    return {cursor, ParseError::None};
+  }
+
+  if (matches("nan")) {
+    cursor += 3;
+
+    // Optional n-char-sequence in parentheses; without the closing one only "nan" counts
+    if (cursor != last && *cursor == '(') {
+      const char * end = cursor + 1;
+
+      while (end != last && ((*end >= '0' && *end <= '9') || ((*end | 0x20) >= 'a' && (*end | 0x20) <= 'z')
+                             || *end == '_'))
+        ++end;
+
+      if (end != last && *end == ')')
+        cursor = end + 1;
+    }
+
+    value = std::bit_cast<T>(static_cast<Bits>(sign | c_infinity | (Bits{1} << (Traits::c_mantissaBits - 1))));
+
+    return {cursor, ParseError::None};
+  }
+
+  return {first, ParseError::InvalidArgument};
+}
+
+template <typename T>
+constexpr ParseResult parseFloat(const char * first, const char * last, T & value) noexcept {
+  using Traits = FloatTraits<T>;
+  using Bits   = typename Traits::Bits;
+
+  // Significands of 19 digits and more; 19 digits always fit 64 bits
+  constexpr uint64_t c_minNineteenDigits = 1000000000000000000U;
+
+  const char * cursor   = first;
+  const bool   negative = cursor != last && *cursor == '-';
+
+  if (negative)
+    ++cursor;
+
+  const Bits sign = negative ? Bits{1} << (sizeof(Bits) * 8 - 1) : 0;
+
+  if (cursor != last && ((*cursor | 0x20) == 'i' || (*cursor | 0x20) == 'n'))
+    return parseSpecial<T>(first, cursor, last, sign, value);
+
+  uint64_t     significand = 0;
+  const char * integer     = cursor;
+
+  cursor = readDigits(cursor, last, significand);
+
+  const char * integerEnd  = cursor;
+  const char * fraction    = cursor;
+  const char * fractionEnd = cursor;
+
+  if (cursor != last && *cursor == '.') {
+    fraction    = ++cursor;
+    cursor      = readDigits(cursor, last, significand);
+    fractionEnd = cursor;
+  }
+
+  int64_t digitCount = (integerEnd - integer) + (fractionEnd - fraction);
+
+  if (digitCount == 0)
+    return {first, ParseError::InvalidArgument};
+
+  // An exponent counts only with at least one digit
+  int64_t explicitExponent = 0;
+
+  if (cursor != last && (*cursor | 0x20) == 'e') {
+    const char * digit           = cursor + 1;
+    const bool   negativeExponent = digit != last && *digit == '-';
+
+    if (digit != last && (*digit == '-' || *digit == '+'))
+      ++digit;
+
+    if (digit != last && *digit >= '0' && *digit <= '9') {
+      // Saturates far beyond any exponent that can matter
+      for (; digit != last && *digit >= '0' && *digit <= '9'; ++digit) {
+        if (explicitExponent < 0x10000000)
+          explicitExponent = explicitExponent * 10 + (*digit - '0');
+      }
+
+      explicitExponent = negativeExponent ? -explicitExponent : explicitExponent;
+      cursor           = digit;
+    }
+  }
+
+  int64_t exponent  = explicitExponent - (fractionEnd - fraction);
+  bool    truncated = false;
+
+  if (digitCount > 19) {
+    // Leading zeros do not count
+    for (const char * digit = integer; digit != fractionEnd && (*digit == '0' || *digit == '.'); ++digit)
+      digitCount -= *digit == '0' ? 1 : 0;
+
+    if (digitCount > 19) {
+      // Keep the first 19 significant digits; the value lies between them and them plus one
+      truncated   = true;
+      significand = 0;
+
+      const char * digit = integer;
+
+      for (; significand < c_minNineteenDigits && digit != integerEnd; ++digit)
+        significand = significand * 10 + static_cast<uint64_t>(*digit - '0');
+
+      if (significand >= c_minNineteenDigits) {
+        exponent = (integerEnd - digit) + explicitExponent;
+      } else {
+        for (digit = fraction; significand < c_minNineteenDigits && digit != fractionEnd; ++digit)
+          significand = significand * 10 + static_cast<uint64_t>(*digit - '0');
+
+        exponent = (fraction - digit) + explicitExponent;
+      }
+    }
+  }
+
+  Bits bits = eiselLemire<T>(significand, exponent);
+
+  if (truncated && bits != eiselLemire<T>(significand + 1, exponent))
+    bits = resolveHalfway<T>(bits, integer, fractionEnd, explicitExponent - (fractionEnd - fraction));
+
+  // Overflow to infinity, or a nonzero number that rounds to zero
+  if ((bits >> Traits::c_mantissaBits) == static_cast<Bits>(Traits::c_exponentMask) || (bits == 0 && significand != 0))
+    return {cursor, ParseError::OutOfRange};
+
+  value = std::bit_cast<T>(static_cast<Bits>(bits | sign));
+
+  return {cursor, ParseError::None};
+}
+
+} // namespace conversion
+
+constexpr size_t maxFloatChars(FloatFormat format, int32_t precision) noexcept {
+  const size_t digits = precision >= 0 ? static_cast<size_t>(precision) : format == FloatFormat::Hex ? 13 : 6;
+
+  switch (format) {
+    case FloatFormat::Fixed:
+      // Sign, the 309 integer digits of the largest double, and the point
+      return 311 + digits;
+    case FloatFormat::Hex:
+      // Sign, leading digit, point, all 13 fraction digits, and "p-1074"
+      return 9 + (digits > 13 ? digits : 13);
+    default:
+      // Sign, leading digit, point, and "e-308"; also covers the "0.0000" prefix of the general notation
+      return 8 + digits;
+  }
+}
+
+template <typename T>
+  requires std::is_integral_v<T> && (!std::is_same_v<std::remove_cv_t<T>, bool>)
+constexpr char * toChars(char * buffer, T value, int32_t base) noexcept {
+  using Unsigned = std::make_unsigned_t<T>;
+
+  auto magnitude = static_cast<Unsigned>(value);
+
+  if constexpr (std::is_signed_v<T>) {
+    // Negating in unsigned arithmetic keeps the most negative value exact
+    if (value < 0) {
+      *buffer++ = '-';
+      magnitude = static_cast<Unsigned>(Unsigned{0} - magnitude);
+    }
+  }
+
+  return conversion::writeInteger(buffer, static_cast<uint64_t>(magnitude), base);
+}
+
+constexpr char * toChars(char * buffer, double value) noexcept {
+  return conversion::writeShortest(buffer, value);
+}
+
+constexpr char * toChars(char * buffer, float value) noexcept {
+  return conversion::writeShortest(buffer, value);
+}
+
+constexpr char * toChars(char * buffer, double value, FloatFormat format, int32_t precision) noexcept {
+  return conversion::writeFloat(buffer, value, format, precision);
+}
+
+constexpr char * toChars(char * buffer, float value, FloatFormat format, int32_t precision) noexcept {
+  return conversion::writeFloat(buffer, value, format, precision);
+}
+
+template <typename T>
+  requires std::is_integral_v<T> && (!std::is_same_v<std::remove_cv_t<T>, bool>)
+constexpr ParseResult fromChars(const char * first, const char * last, T & value) noexcept {
+  using Unsigned = std::make_unsigned_t<T>;
+
+  const char * cursor   = first;
+  bool         negative = false;
+
+  if constexpr (std::is_signed_v<T>) {
+    if (cursor != last && *cursor == '-') {
+      negative = true;
+      ++cursor;
+    }
+  }
+
+  const char * digits = cursor;
+
+  // Leading zeros do not count toward the 20 digits a 64-bit value can have
+  while (cursor != last && *cursor == '0')
+    ++cursor;
+
+  const char * significant = cursor;
+  uint64_t     magnitude   = 0;
+
+  cursor = conversion::readDigits(cursor, last, magnitude);
+
+  if (cursor == digits)
+    return {first, ParseError::InvalidArgument};
+
+  // Twenty digits fit only below 2 x 10^19, and then without wrapping below 10^19
+  const ptrdiff_t count    = cursor - significant;
+  const bool      overflow = count > 20
+                      || (count == 20 && (*significant != '1' || magnitude < conversion::c_powersOfTen[19]));
+
+  const auto     maximum = static_cast<Unsigned>(~Unsigned{0});
+  const uint64_t limit   = std::is_signed_v<T> ? static_cast<uint64_t>(maximum >> 1) + (negative ? 1 : 0) : maximum;
+
+  if (overflow || magnitude > limit)
+    return {cursor, ParseError::OutOfRange};
+
+  value = static_cast<T>(negative ? static_cast<Unsigned>(0 - magnitude) : static_cast<Unsigned>(magnitude));
+
+  return {cursor, ParseError::None};
+}
+
+constexpr ParseResult fromChars(const char * first, const char * last, double & value) noexcept {
+  return conversion::parseFloat(first, last, value);
+}
+
+constexpr ParseResult fromChars(const char * first, const char * last, float & value) noexcept {
+  return conversion::parseFloat(first, last, value);
+}
+
+} // namespace toy
+
+#endif // INCLUDE_CORE_UTILS_INL_
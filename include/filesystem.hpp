@@ -0,0 +1,48 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   filesystem.hpp
+  \brief  Umbrella header for the engine filesystem module.
+
+  Single public entry point for the filesystem module, in namespace \ref toy::filesystem. It currently re-exports the
+  pack archives with their writer, the LZ compression of their entries, the read-only mapped files, the virtual file
+  system that mounts packs and loose directories, and the asynchronous batched reads.
+
+  \note Include this header only; do not include internal headers directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_HPP_
+#define INCLUDE_FILESYSTEM_HPP_
+
+#include "core.hpp"
+
+#include "filesystem/pack.hpp"
+#include "filesystem/compression.hpp"
+#include "filesystem/mapped_file.hpp"
+#include "filesystem/virtual_file_system.hpp"
+#include "filesystem/async_io.hpp"
+
+#include "filesystem/pack.inl"
+#include "filesystem/compression.inl"
+#include "filesystem/mapped_file.inl"
+#include "filesystem/virtual_file_system.inl"
+#include "filesystem/async_io.inl"
+
+#endif // INCLUDE_FILESYSTEM_HPP_
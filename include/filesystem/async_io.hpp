@@ -0,0 +1,210 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   async_io.hpp
+  \brief  Asynchronous reads in batches, on io_uring or on worker threads, straight into caller buffers.
+
+  Declares \ref toy::filesystem::async. Definitions live in async_io.cpp, the inline members in async_io.inl.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_ASYNC_IO_HPP_
+#define INCLUDE_FILESYSTEM_ASYNC_IO_HPP_
+
+/*!
+  \namespace toy::filesystem::async
+
+  \brief Reads that stream levels and music off disk without blocking the frame.
+
+  The caller owns every \ref toy::filesystem::async::Request and the buffer it reads into; the data lands in that
+  buffer with no copy in between. submit() queues a batch of requests with a single system call, and poll() finishes
+  the reads that are done: it sets their status and runs their callbacks on the calling thread, typically once per
+  frame. A request is its own handle, so code without callbacks checks its status instead.
+
+  \code
+  toy::filesystem::async::initialize();
+
+  toy::filesystem::async::File music("data/music.ogg");
+  toy::filesystem::async::Request chunk{&music, offset, streamBuffer, onMusicChunk, &player};
+
+  toy::filesystem::async::submit({&chunk, 1});
+
+  // Every frame
+  toy::filesystem::async::poll();
+  \endcode
+
+  Linux desktop builds read with io_uring, from fixed buffers when registerBuffer() has registered them. Other desktop
+  platforms, and Linux kernels without io_uring, read on \ref toy::filesystem::async::c_workerCount worker threads. The
+  consoles are built without threads and read when the requests are submitted; poll() still runs the callbacks, so
+  code behaves the same everywhere.
+
+  submit(), poll(), wait(), and waitAll() must be called from one thread, which owns the reads. Requests must stay
+  valid, and their buffers untouched, until they are finished.
+*/
+namespace toy::filesystem::async {
+
+/// Most reads in flight at once; a power of two
+inline constexpr size_t c_maxReads = 256;
+
+/// Worker threads of the \ref Backend::Workers backend on platforms with threads
+inline constexpr size_t c_workerCount = 4;
+
+/// Way reads are carried out.
+enum class Backend : uint8_t {
+  Workers, ///< Blocking reads on worker threads, or on the submitting thread on targets built without threads
+  IoUring, ///< Linux io_uring submission and completion rings
+};
+
+/// State of a \ref Request.
+enum class Status : uint8_t {
+  Idle,    ///< Never submitted, or refused by a full queue
+  Pending, ///< Submitted and not finished yet
+  Done,    ///< Read; \ref Request::bytesRead tells how much, short only at the end of the file
+  Failed,  ///< The file is closed or the read failed
+};
+
+/*!
+  \brief File opened for asynchronous reads.
+
+  Reads give their offsets, so any number of requests can read one file at once.
+*/
+class File {
+public:
+  /// Constructs a closed file.
+  constexpr File() noexcept = default;
+
+  /// Opens the file at \a path for reading; check isOpen().
+  explicit File(const char * path) noexcept;
+
+  /// Closes the file; no read of it may be pending.
+  ~File() noexcept;
+
+  /// Takes over the file of \a other, which is left closed.
+  File(File && other) noexcept;
+
+  /// Closes this file and takes over that of \a other, which is left closed.
+  File & operator=(File && other) noexcept;
+
+  File(const File &)             = delete;
+  File & operator=(const File &) = delete;
+
+  /// Returns whether the file is open.
+  [[nodiscard]] bool isOpen() const noexcept;
+
+  /// Returns the bytes of the file when it was opened.
+  [[nodiscard]] uint64_t size() const noexcept;
+
+  /// Returns the descriptor on Linux and macOS, the \c HANDLE on Windows, or the \c FILE pointer elsewhere.
+  [[nodiscard]] intptr_t nativeHandle() const noexcept;
+
+  /// Closes the file; does nothing when closed.
+  void close() noexcept;
+
+private:
+  /// Value of \ref _handle for a closed file
+  static constexpr intptr_t c_closed = -1;
+
+  /// Native handle, as nativeHandle() returns it
+  intptr_t _handle{c_closed};
+
+  /// Bytes of the file
+  uint64_t _size{0};
+};
+
+struct Request;
+
+/// Function called by poll() or wait() when \a request is finished, with the context stored in the request.
+using Callback = void (*)(Request & request, void * context) noexcept;
+
+/// One read of \ref buffer from \ref offset of \ref file.
+struct Request {
+  /// File to read
+  const File * file{nullptr};
+
+  /// Offset of the first byte to read
+  uint64_t offset{0};
+
+  /// Destination; its size is the number of bytes to read
+  span<std::byte> buffer;
+
+  /// Called when the read is finished; may be \c nullptr
+  Callback callback{nullptr};
+
+  /// Passed to \ref callback
+  void * context{nullptr};
+
+  /// State, set by submit() and when the read is finished
+  Status status{Status::Idle};
+
+  /// Bytes read, set when the read is done
+  size_t bytesRead{0};
+
+  /// Returns whether the read is finished, done or failed.
+  [[nodiscard]] bool isFinished() const noexcept;
+};
+
+/*!
+  \brief Starts reading with \a preferred, or with \ref Backend::Workers when it is not available.
+
+  Reads submitted before initialize() are carried out at once on the submitting thread.
+*/
+void initialize(Backend preferred = Backend::IoUring) noexcept;
+
+/// Finishes the pending reads, running their callbacks, and stops the backend.
+void deInitialize() noexcept;
+
+/// Returns the backend in use.
+[[nodiscard]] Backend backend() noexcept;
+
+/*!
+  \brief Registers \a buffer with the kernel, so reads into it skip mapping its pages each time.
+
+  Only io_uring registers; the other backends accept any buffer and ignore the call. Registering replaces the buffer
+  registered before, and an empty \a buffer only unregisters it. No read may be pending.
+
+  \return Whether \a buffer is registered; \c false on the other backends, with reads pending, or when the kernel
+  refuses, for instance over the locked memory limit. Reads work either way.
+*/
+bool registerBuffer(span<std::byte> buffer) noexcept;
+
+/*!
+  \brief Queues the reads of \a requests, in order, in one batch.
+
+  \return Number of requests queued, from the first; the rest stay \ref Status::Idle because \ref c_maxReads are in
+  flight.
+*/
+size_t submit(span<Request> requests) noexcept;
+
+/// Finishes the reads that are done and runs their callbacks; returns how many were finished.
+size_t poll() noexcept;
+
+/// Blocks until \a request is finished, finishing other reads as they complete.
+void wait(const Request & request) noexcept;
+
+/// Blocks until every pending read is finished.
+void waitAll() noexcept;
+
+/// Returns the number of reads submitted and not finished yet.
+[[nodiscard]] size_t pending() noexcept;
+
+} // namespace toy::filesystem::async
+
+#endif // INCLUDE_FILESYSTEM_ASYNC_IO_HPP_
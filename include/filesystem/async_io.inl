@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   async_io.inl
+  \brief  Inline definitions for asynchronous reads.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_ASYNC_IO_INL_
+#define INCLUDE_FILESYSTEM_ASYNC_IO_INL_
+
+namespace toy::filesystem::async {
+
+inline bool File::isOpen() const noexcept {
+  return _handle != c_closed;
+}
+
+inline uint64_t File::size() const noexcept {
+  return _size;
+}
+
+inline intptr_t File::nativeHandle() const noexcept {
+  return _handle;
+}
+
+inline bool Request::isFinished() const noexcept {
+  return status == Status::Done || status == Status::Failed;
+}
+
+} // namespace toy::filesystem::async
+
+#endif // INCLUDE_FILESYSTEM_ASYNC_IO_INL_
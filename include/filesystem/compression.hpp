@@ -0,0 +1,223 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   compression.hpp
+  \brief  LZ4-class compression of asset streams, with decoding in place or through a small ring buffer.
+
+  Declares \ref toy::filesystem::lz. Definitions live in compression.cpp, the inline helpers in compression.inl.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_COMPRESSION_HPP_
+#define INCLUDE_FILESYSTEM_COMPRESSION_HPP_
+
+/*!
+  \namespace toy::filesystem::lz
+
+  \brief Byte-oriented LZ77 streams that decode faster than storage delivers the bytes they save.
+
+  A stream is a \ref toy::filesystem::lz::StreamHeader followed by blocks of one window of raw bytes each. Every block
+  starts with a 32-bit little-endian word: its compressed size, with the top bit set when the block is stored raw
+  because it would not shrink. Compressed blocks are LZ4-style sequences: a token byte holding the literal count and
+  the match length, each extended by bytes of 255 when it reaches 15, the literals, then a 16-bit little-endian match
+  offset. The last sequence of a block has literals only. Matches reach back at most one window, into earlier blocks
+  as well, and are at least 4 bytes long.
+
+  The window size, from 1 KB to 64 KB, is chosen when compressing and bounds the memory of the decoder:
+  - decompress() writes a whole stream into one buffer. The stream may sit at the end of that buffer, and is then
+    decoded in place: inPlaceMargin() gives the extra bytes the buffer needs.
+  - \ref toy::filesystem::lz::Decompressor decodes one block at a time into a ring of ringSize() bytes, so a 4 KB
+    window streams any amount of data through 8 KB of RAM on the handhelds.
+
+  Desktop builds copy 16 bytes at a time, letting copies run past their ends where the buffers allow it. The
+  \ref toy::filesystem::lz::scalar decoder copies byte by byte, which is what the ARM handhelds run: their 32-bit
+  buses and small caches gain nothing from wide, unaligned copies.
+*/
+namespace toy::filesystem::lz {
+
+/// First bytes of a stream
+inline constexpr array<char, 4> c_magic{'T', 'G', 'L', 'Z'};
+
+/// Version of the stream layout this build reads and writes
+inline constexpr uint8_t c_version = 1;
+
+/// Bits of the smallest window, 1 KB
+inline constexpr uint8_t c_minWindowBits = 10;
+
+/// Bits of the largest window, 64 KB; match offsets are 16-bit
+inline constexpr uint8_t c_maxWindowBits = 16;
+
+/// Bits of the window compress() uses unless told otherwise
+inline constexpr uint8_t c_defaultWindowBits = 16;
+
+/// First bytes of a stream; every number is little-endian.
+struct StreamHeader {
+  /// \ref c_magic
+  array<char, 4> magic;
+
+  /// \ref c_version
+  uint8_t version;
+
+  /// Bits of the window, which is also the raw size of every block but the last
+  uint8_t windowBits;
+
+  /// Zero
+  uint16_t reserved;
+
+  /// Bytes of the decompressed data
+  uint64_t rawSize;
+};
+
+static_assert(sizeof(StreamHeader) == 16, "the stream header is 16 bytes");
+
+/// Sizes stored in a stream header.
+struct StreamInfo {
+  /// Bytes of the decompressed data
+  uint64_t rawSize;
+
+  /// Bytes of the window; 0 when the header is not valid
+  size_t windowSize;
+
+  /// Checks whether the header is valid.
+  constexpr explicit operator bool() const noexcept;
+};
+
+/// Returns the sizes in the header of \a stream; empty when it is not a stream of this version.
+[[nodiscard]] StreamInfo streamInfo(span<const std::byte> stream) noexcept;
+
+/// Returns the largest stream compress() writes for \a rawSize bytes with a window of \a windowBits bits.
+[[nodiscard]] constexpr size_t compressBound(size_t rawSize, uint8_t windowBits = c_defaultWindowBits) noexcept;
+
+/*!
+  \brief Returns the bytes a buffer needs past \a rawSize to decode in place.
+
+  Place the stream at the end of a buffer of <tt>rawSize + inPlaceMargin(rawSize)</tt> bytes or more, then
+  decompress() it into the whole buffer. The margin covers every stream compress() writes.
+*/
+[[nodiscard]] constexpr size_t inPlaceMargin(size_t rawSize) noexcept;
+
+/// Returns the smallest ring a \ref Decompressor accepts for a window of \a windowSize bytes: one window of history
+/// and one block.
+[[nodiscard]] constexpr size_t ringSize(size_t windowSize) noexcept;
+
+/*!
+  \brief Compresses \a source into \a destination with a window of \a windowBits bits.
+
+  Greedy parsing over a table of 4-byte hashes: fast enough for tools to compress every asset at build time, with
+  ratios close to LZ4's default level.
+
+  \return Bytes of the stream; 0 when \a windowBits is out of range, \a destination has fewer than compressBound()
+  bytes, or \a source has 4 GB or more.
+*/
+size_t compress(span<const std::byte> source, span<std::byte> destination,
+                uint8_t windowBits = c_defaultWindowBits) noexcept;
+
+/*!
+  \brief Decompresses \a stream into the start of \a destination.
+
+  \a stream may lie at the end of \a destination for decoding in place; see inPlaceMargin().
+
+  \return Whether the whole stream decoded; \c false when it is damaged, \a destination is smaller than the raw size,
+  or the in-place margin is too small. \a destination may be partly written either way.
+*/
+bool decompress(span<const std::byte> stream, span<std::byte> destination) noexcept;
+
+/*!
+  \brief Decoder of one stream, one block at a time, into a ring buffer.
+
+  \code
+  array<std::byte, toy::filesystem::lz::ringSize(4096)> ring;
+
+  toy::filesystem::lz::Decompressor decoder(romStream, ring);
+
+  while (const auto block = decoder.next(); !block.empty())
+    uploadTiles(block);
+  \endcode
+
+  The stream must stay readable in full while decoding, as it does in ROM or a mapped pack; only the output is
+  bounded. A ring larger than ringSize() moves the window back to its start less often.
+*/
+class Decompressor {
+public:
+  /// Starts decoding \a stream into \a ring; check isValid().
+  Decompressor(span<const std::byte> stream, span<std::byte> ring) noexcept;
+
+  /// Returns whether the header is valid and the ring holds ringSize() bytes for its window.
+  [[nodiscard]] bool isValid() const noexcept;
+
+  /// Returns whether decoding stopped at damaged data.
+  [[nodiscard]] bool isDamaged() const noexcept;
+
+  /// Returns the bytes of the decompressed data.
+  [[nodiscard]] uint64_t rawSize() const noexcept;
+
+  /// Returns the bytes decoded so far.
+  [[nodiscard]] uint64_t position() const noexcept;
+
+  /*!
+    \brief Decodes the next block.
+
+    \return The raw bytes of the block, inside the ring and valid until the next call; empty at the end of the
+    stream, when it is not valid, or at damaged data.
+  */
+  span<const std::byte> next() noexcept;
+
+private:
+  /// Stream, header included
+  span<const std::byte> _stream;
+
+  /// Ring
+  span<std::byte> _ring;
+
+  /// Offset of the next block header in \ref _stream
+  size_t _cursor{0};
+
+  /// Bytes of the ring holding decoded data
+  size_t _fill{0};
+
+  /// Bytes of the window
+  size_t _windowSize{0};
+
+  /// Bytes of the decompressed data
+  uint64_t _rawSize{0};
+
+  /// Bytes decoded so far
+  uint64_t _position{0};
+
+  /// Decoding stopped at damaged data
+  bool _damaged{false};
+};
+
+/*!
+  \namespace toy::filesystem::lz::scalar
+
+  \brief Byte-at-a-time decoder: what the handhelds run, kept on desktop for tests and benchmarks.
+*/
+namespace scalar {
+
+/// decompress() with byte copies; same contract
+bool decompress(span<const std::byte> stream, span<std::byte> destination) noexcept;
+
+} // namespace scalar
+
+} // namespace toy::filesystem::lz
+
+#endif // INCLUDE_FILESYSTEM_COMPRESSION_HPP_
@@ -0,0 +1,72 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   compression.inl
+  \brief  Inline definitions for compressed streams.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_COMPRESSION_INL_
+#define INCLUDE_FILESYSTEM_COMPRESSION_INL_
+
+namespace toy::filesystem::lz {
+
+constexpr StreamInfo::operator bool() const noexcept {
+  return windowSize != 0;
+}
+
+constexpr size_t compressBound(size_t rawSize, uint8_t windowBits) noexcept {
+  // Blocks that would grow are stored, so the worst case is the raw data and a header per block
+  const size_t windowSize = size_t{1} << windowBits;
+  const size_t blockCount = (rawSize + windowSize - 1) / windowSize;
+
+  return sizeof(StreamHeader) + rawSize + blockCount * sizeof(uint32_t);
+}
+
+constexpr size_t inPlaceMargin(size_t rawSize) noexcept {
+  // Any tail of a stream is at most 1/255 of its raw size longer, for literal counts, plus 6 bytes per block of at
+  // least 1 KB, for the block header and the last token
+  return (rawSize >> 6) + 32;
+}
+
+constexpr size_t ringSize(size_t windowSize) noexcept {
+  return windowSize * 2;
+}
+
+inline bool Decompressor::isValid() const noexcept {
+  return _windowSize != 0;
+}
+
+inline bool Decompressor::isDamaged() const noexcept {
+  return _damaged;
+}
+
+inline uint64_t Decompressor::rawSize() const noexcept {
+  return _rawSize;
+}
+
+inline uint64_t Decompressor::position() const noexcept {
+  return _position;
+}
+
+} // namespace toy::filesystem::lz
+
+#endif // INCLUDE_FILESYSTEM_COMPRESSION_INL_
@@ -0,0 +1,78 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   mapped_file.hpp
+  \brief  Read-only files mapped into memory, for pack images on desktop.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_MAPPED_FILE_HPP_
+#define INCLUDE_FILESYSTEM_MAPPED_FILE_HPP_
+
+namespace toy::filesystem {
+
+/*!
+  \brief Whole file mapped read-only into the address space.
+
+  Linux and macOS map with \c mmap, Windows with a file mapping view: opening costs a few system calls whatever the
+  size, and pages are read from disk, or shared with the page cache, only when first touched. Other targets have no
+  mapping; the file is read into memory from the heap instead, charged to \ref toy::MemoryTag::Assets.
+*/
+class MappedFile {
+public:
+  /// Constructs a closed file.
+  constexpr MappedFile() noexcept = default;
+
+  /// Maps the file at \a path; check isOpen().
+  explicit MappedFile(const char * path) noexcept;
+
+  /// Unmaps the file.
+  ~MappedFile() noexcept;
+
+  /// Takes over the mapping of \a other, which is left closed.
+  MappedFile(MappedFile && other) noexcept;
+
+  /// Unmaps this file and takes over the mapping of \a other, which is left closed.
+  MappedFile & operator=(MappedFile && other) noexcept;
+
+  MappedFile(const MappedFile &)             = delete;
+  MappedFile & operator=(const MappedFile &) = delete;
+
+  /// Returns whether a non-empty file is mapped.
+  [[nodiscard]] bool isOpen() const noexcept;
+
+  /// Returns the contents; empty when closed.
+  [[nodiscard]] span<const std::byte> data() const noexcept;
+
+  /// Unmaps the file; does nothing when closed.
+  void close() noexcept;
+
+private:
+  /// First byte of the contents
+  const std::byte * _data{nullptr};
+
+  /// Bytes of the contents
+  size_t _size{0};
+};
+
+} // namespace toy::filesystem
+
+#endif // INCLUDE_FILESYSTEM_MAPPED_FILE_HPP_
@@ -0,0 +1,263 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   pack.hpp
+  \brief  Pack archives: many asset files in one image, found by the hash of their paths and read without copying.
+
+  Declares \ref toy::filesystem::Pack, which reads a pack image anywhere in memory: a file mapped by
+  \ref toy::filesystem::MappedFile on desktop, or the cartridge address space of the ROM targets. writePack() builds
+  images for tools and tests.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_PACK_HPP_
+#define INCLUDE_FILESYSTEM_PACK_HPP_
+
+/*!
+  \namespace toy::filesystem
+
+  \brief Asset files: pack archives, mapped files, and the virtual file system over them.
+
+  Games read assets through a \ref toy::filesystem::VirtualFileSystem. Shipping data lives in packs: one file per
+  archive to open, a table of contents indexed by path hash, and file contents returned as spans straight into the
+  image, whether it is mapped from disk or sits in cartridge ROM.
+*/
+namespace toy::filesystem {
+
+/*!
+  \brief Layout of a pack image.
+
+  Every number is little-endian, so a pack built on desktop is read unchanged from a big-endian cartridge. The image
+  is, in order:
+  - a \ref PackHeader;
+  - the table of contents, one \ref PackEntry per file, sorted by path hash;
+  - the bucket index: <tt>2^bucketBits + 1</tt> 32-bit entry indices. The files whose path hashes start with the
+    bits \c b are the entries from <tt>buckets[b]</tt> up to <tt>buckets[b + 1]</tt>;
+  - the paths, for listings and tools;
+  - the file data, each file at a multiple of \ref c_packAlignment. Files flagged \ref c_packCompressed hold a
+    \ref toy::filesystem::lz stream instead of their contents.
+
+  Bucket counts are chosen so a bucket holds one file on average, so a lookup reads two indices and about one entry
+  whatever the number of files.
+*/
+inline constexpr array<char, 4> c_packMagic{'T', 'G', 'P', 'K'};
+
+/// Version of the pack layout this build writes; version 1, without entry flags, is read as well
+inline constexpr uint16_t c_packVersion = 2;
+
+/// Flag of \ref PackEntry::flags: the data is a \ref toy::filesystem::lz stream of the contents
+inline constexpr uint16_t c_packCompressed = 1;
+
+/// Alignment of the table of contents and of each file in a pack, in bytes; one cache line
+inline constexpr size_t c_packAlignment = 64;
+
+/// Most bits of path hash the bucket index uses
+inline constexpr uint16_t c_maxBucketBits = 20;
+
+/// First bytes of a pack image.
+struct PackHeader {
+  /// \ref c_packMagic
+  array<char, 4> magic;
+
+  /// \ref c_packVersion, or 1
+  uint16_t version;
+
+  /// Path hash bits selecting a bucket; from 1 to \ref c_maxBucketBits
+  uint16_t bucketBits;
+
+  /// Number of files
+  uint32_t entryCount;
+
+  /// Zero
+  uint32_t reserved;
+
+  /// Offset of the table of contents from the start of the image
+  uint64_t entriesOffset;
+
+  /// Offset of the bucket index
+  uint64_t bucketsOffset;
+
+  /// Offset of the paths
+  uint64_t namesOffset;
+
+  /// Bytes of the paths
+  uint64_t namesSize;
+
+  /// Bytes of the whole image
+  uint64_t imageSize;
+
+  /// Zero; pads the header to \ref c_packAlignment
+  array<uint8_t, 8> padding;
+};
+
+/// Table of contents entry of one file; two share each cache line.
+struct PackEntry {
+  /// hash64() of the path, the value of its \ref toy::StringId
+  uint64_t pathHash;
+
+  /// Offset of the data from the start of the image; a multiple of \ref c_packAlignment
+  uint64_t offset;
+
+  /// Bytes of the data
+  uint64_t size;
+
+  /// Offset of the path within the paths
+  uint32_t nameOffset;
+
+  /// Bytes of the path
+  uint16_t nameSize;
+
+  /// \ref c_packCompressed, or zero; always zero in version 1, where it held the high bits of a short \ref nameSize
+  uint16_t flags;
+};
+
+static_assert(sizeof(PackHeader) == c_packAlignment, "the pack header fills one cache line");
+static_assert(sizeof(PackEntry) * 2 == c_packAlignment, "two pack entries fill one cache line");
+
+/// One file found in a pack.
+struct PackFile {
+  /// Identifier of the path
+  StringId id;
+
+  /// Path, as given to writePack()
+  string_view path;
+
+  /// Contents, inside the pack image; a \ref toy::filesystem::lz stream of them when \ref compressed
+  span<const std::byte> data;
+
+  /// The data is compressed
+  bool compressed;
+
+  /// Checks whether a file was found.
+  constexpr explicit operator bool() const noexcept;
+};
+
+/*!
+  \brief Read-only view of a pack image.
+
+  \code
+  using namespace toy::literals;
+
+  toy::filesystem::Pack pack(romPackStart, romPackSize);
+
+  if (const auto file = pack.find("sprites/hero.spr"_sid))
+    loadSprite(file.data);
+  \endcode
+
+  The pack never copies: the data of a file is a span into the image, which must outlive the pack and every span
+  taken from it. Every member is \c const, so threads may share a pack.
+*/
+class Pack {
+public:
+  /// Constructs an empty pack, which finds nothing.
+  constexpr Pack() noexcept = default;
+
+  /*!
+    \brief Reads the pack image of \a size bytes at \a data.
+
+    The header and the bounds of the tables are checked here; a damaged image gives an empty pack. File bounds are
+    checked as each file is found.
+  */
+  Pack(const void * data, size_t size) noexcept;
+
+  /// Returns whether the image was accepted.
+  [[nodiscard]] bool isValid() const noexcept;
+
+  /// Returns the number of files.
+  [[nodiscard]] size_t size() const noexcept;
+
+  /// Returns the image.
+  [[nodiscard]] span<const std::byte> image() const noexcept;
+
+  /*!
+    \brief Finds the file whose path hashes to \a id.
+
+    \return The file; empty, with a null identifier, when the pack has no such file or its entry points outside the
+    image.
+  */
+  [[nodiscard]] PackFile find(StringId id) const noexcept;
+
+  /// Returns file \a index, in path hash order, for listings; empty when \a index is not below size().
+  [[nodiscard]] PackFile file(size_t index) const noexcept;
+
+private:
+  /// Decodes entry \a index.
+  [[nodiscard]] PackFile decode(size_t index) const noexcept;
+
+  /// Image
+  const std::byte * _image{nullptr};
+
+  /// Bytes of the image
+  size_t _imageSize{0};
+
+  /// Table of contents, little-endian \ref PackEntry records
+  const std::byte * _entries{nullptr};
+
+  /// Bucket index
+  const std::byte * _buckets{nullptr};
+
+  /// Paths
+  const char * _names{nullptr};
+
+  /// Bytes of the paths
+  size_t _namesSize{0};
+
+  /// Number of files
+  uint32_t _entryCount{0};
+
+  /// Right shift taking a path hash to its bucket
+  uint32_t _bucketShift{64};
+};
+
+/// File to store in a pack with writePack().
+struct PackSource {
+  /// Path the file is found by; stored as given, so use one spelling, such as relative with forward slashes
+  string_view path;
+
+  /// Contents, or a \ref toy::filesystem::lz stream of them when \ref compressed is set
+  span<const std::byte> data;
+
+  /// \ref data is compressed; the pack stores it as is and flags it
+  bool compressed{false};
+};
+
+/*!
+  \brief Returns the bytes of the pack holding \a sources; 0 when there are more than \c UINT32_MAX of them or a path
+  is longer than \c UINT16_MAX bytes.
+
+  The size depends only on the number of sources and the sizes of their paths and contents, so it can be computed
+  before any content is loaded.
+*/
+[[nodiscard]] size_t packImageSize(span<const PackSource> sources) noexcept;
+
+/*!
+  \brief Writes the pack holding \a sources to \a buffer.
+
+  \param sources Files to store; sorted by path hash in place.
+  \param buffer  Destination of packImageSize() bytes; its contents may be written to a file as is.
+
+  \return Bytes written; 0 when \a buffer is too small, two paths have the same hash, or packImageSize() is 0.
+*/
+size_t writePack(span<PackSource> sources, span<std::byte> buffer) noexcept;
+
+} // namespace toy::filesystem
+
+#endif // INCLUDE_FILESYSTEM_PACK_HPP_
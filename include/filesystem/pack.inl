@@ -0,0 +1,50 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   pack.inl
+  \brief  Inline definitions for pack archives.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_PACK_INL_
+#define INCLUDE_FILESYSTEM_PACK_INL_
+
+namespace toy::filesystem {
+
+constexpr PackFile::operator bool() const noexcept {
+  return static_cast<bool>(id);
+}
+
+inline bool Pack::isValid() const noexcept {
+  return _image != nullptr;
+}
+
+inline size_t Pack::size() const noexcept {
+  return _entryCount;
+}
+
+inline span<const std::byte> Pack::image() const noexcept {
+  return {_image, _imageSize};
+}
+
+} // namespace toy::filesystem
+
+#endif // INCLUDE_FILESYSTEM_PACK_INL_
@@ -0,0 +1,166 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   virtual_file_system.hpp
+  \brief  Virtual file system: packs and loose directories mounted under one namespace of asset paths.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_VIRTUAL_FILE_SYSTEM_HPP_
+#define INCLUDE_FILESYSTEM_VIRTUAL_FILE_SYSTEM_HPP_
+
+namespace toy::filesystem {
+
+/// Most packs and directories one \ref VirtualFileSystem mounts
+inline constexpr size_t c_maxMounts = 16;
+
+/// Longest directory path mountDirectory() accepts, and longest asset path under it
+inline constexpr size_t c_maxPathSize = 256;
+
+/*!
+  \brief Contents of one asset file.
+
+  A file found in a pack is a view into the pack image and costs nothing to open or close. A file read from a loose
+  directory, or compressed in its pack, owns a copy of its contents, from the heap and charged to
+  \ref toy::MemoryTag::Assets, freed with the file. Either way the data is aligned to \ref c_packAlignment.
+*/
+class File {
+public:
+  /// Constructs an empty file, as returned for missing paths.
+  constexpr File() noexcept = default;
+
+  /// Frees the contents read from a loose directory.
+  ~File() noexcept;
+
+  /// Takes over the contents of \a other, which is left empty.
+  File(File && other) noexcept;
+
+  /// Frees the contents of this file and takes over those of \a other, which is left empty.
+  File & operator=(File && other) noexcept;
+
+  File(const File &)             = delete;
+  File & operator=(const File &) = delete;
+
+  /// Returns the contents.
+  [[nodiscard]] span<const std::byte> data() const noexcept;
+
+  /// Returns whether the contents were read or decompressed into memory of their own rather than viewed in a pack.
+  [[nodiscard]] bool isLoaded() const noexcept;
+
+  /// Checks whether the file was found.
+  explicit operator bool() const noexcept;
+
+private:
+  friend class VirtualFileSystem;
+
+  /// Wraps \a data; \a loaded when the file owns it.
+  File(span<const std::byte> data, bool loaded) noexcept;
+
+  /// First byte of the contents; \c nullptr for a missing file
+  const std::byte * _data{nullptr};
+
+  /// Bytes of the contents
+  size_t _size{0};
+
+  /// The file owns the contents
+  bool _loaded{false};
+};
+
+/*!
+  \brief Packs and directories searched, newest mount first, for asset paths.
+
+  Shipping builds mount packs only, so every open is a hash lookup and a span into a mapping or into ROM, or a
+  decompression for files the pack compressed. During development a directory of loose files mounted over the packs
+  overrides the files it holds, without rebuilding them:
+
+  \code
+  toy::filesystem::VirtualFileSystem files;
+
+  files.mountPack("data/base.tgpk");   // mapped; the file system owns the mapping
+  files.mountDirectory("assets");      // loose files win over the packs mounted before
+
+  const toy::filesystem::File level = files.open("levels/forest.lvl");
+  \endcode
+
+  Paths are relative, with forward slashes, spelled as they were when the packs were built. open() with a
+  \ref toy::StringId made at compile time skips hashing, but searches the packs only, since a loose file cannot be
+  found by a hash.
+
+  Mounting is not thread-safe; once mounting is done, any number of threads may open files.
+*/
+class VirtualFileSystem {
+public:
+  /// Constructs a file system with nothing mounted.
+  VirtualFileSystem() noexcept = default;
+
+  VirtualFileSystem(const VirtualFileSystem &)             = delete;
+  VirtualFileSystem & operator=(const VirtualFileSystem &) = delete;
+
+  /// Mounts \a pack, whose image must outlive the mount; \c false when it is not valid or \ref c_maxMounts are used.
+  bool mountPack(const Pack & pack) noexcept;
+
+  /// Maps the pack at \a path and mounts it; \c false when it cannot be mapped, is not valid, or no mount is free.
+  bool mountPack(const char * path) noexcept;
+
+  /// Mounts the loose files under \a root; \c false when \a root is too long or \ref c_maxMounts are used.
+  bool mountDirectory(const char * root) noexcept;
+
+  /// Unmounts everything, unmapping the packs mounted by path; files opened from them must be gone.
+  void unmountAll() noexcept;
+
+  /// Returns the number of mounts.
+  [[nodiscard]] size_t mountCount() const noexcept;
+
+  /// Returns the file at \a path from the newest mount holding it; empty when none does.
+  [[nodiscard]] File open(string_view path) const noexcept;
+
+  /// Returns the file whose path hashes to \a id from the newest pack holding it; empty when none does.
+  [[nodiscard]] File open(StringId id) const noexcept;
+
+  /// Returns whether a mount holds \a path.
+  [[nodiscard]] bool exists(string_view path) const noexcept;
+
+private:
+  /// One pack or directory.
+  struct Mount {
+    /// Pack; empty for a directory
+    Pack pack;
+
+    /// Mapping behind \ref pack, for packs mounted by path
+    MappedFile mapping;
+
+    /// Root of a directory mount; empty for a pack
+    FixedString<c_maxPathSize> root;
+  };
+
+  /// Searches the mounts for \a id, and the directories for \a path unless it is empty.
+  [[nodiscard]] File find(StringId id, string_view path) const noexcept;
+
+  /// Mounts, oldest first
+  array<Mount, c_maxMounts> _mounts;
+
+  /// Number of mounts
+  size_t _mountCount{0};
+};
+
+} // namespace toy::filesystem
+
+#endif // INCLUDE_FILESYSTEM_VIRTUAL_FILE_SYSTEM_HPP_
@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   virtual_file_system.inl
+  \brief  Inline definitions for the virtual file system and its files.
+
+  \note Included by filesystem.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_FILESYSTEM_VIRTUAL_FILE_SYSTEM_INL_
+#define INCLUDE_FILESYSTEM_VIRTUAL_FILE_SYSTEM_INL_
+
+namespace toy::filesystem {
+
+inline File::File(span<const std::byte> data, bool loaded) noexcept
+  : _data(data.data())
+  , _size(data.size())
+  , _loaded(loaded) {}
+
+inline span<const std::byte> File::data() const noexcept {
+  return {_data, _size};
+}
+
+inline bool File::isLoaded() const noexcept {
+  return _loaded;
+}
+
+inline File::operator bool() const noexcept {
+  return _data != nullptr;
+}
+
+inline size_t VirtualFileSystem::mountCount() const noexcept {
+  return _mountCount;
+}
+
+} // namespace toy::filesystem
+
+#endif // INCLUDE_FILESYSTEM_VIRTUAL_FILE_SYSTEM_INL_
@@ -0,0 +1,55 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   math.hpp
+  \brief  Umbrella header for the engine math module.
+
+  Single public entry point for the math module, in namespace \ref toy::math. It currently re-exports the fixed-point
+  numbers with their trigonometry and square root, the engine scalar \ref toy::math::real with the \c float overloads
+  of the same functions, the two-, three-, and four-component vectors with 3x3 and 4x4 matrices and quaternions, the
+  \ref toy::math::Float4 register behind their \c float products, and the batch point transforms.
+
+  \note Include this header only; do not include internal headers directly.
+*/
+
+#ifndef INCLUDE_MATH_HPP_
+#define INCLUDE_MATH_HPP_
+
+#include <cmath>
+#include <limits>
+
+#include "core.hpp"
+
+#if defined(__AVX2__) || defined(__FMA__)
+#include <immintrin.h>
+#endif
+
+#include "math/fixed.hpp"
+#include "math/scalar.hpp"
+#include "math/simd.hpp"
+#include "math/vector.hpp"
+#include "math/transform.hpp"
+
+#include "math/fixed.inl"
+#include "math/scalar.inl"
+#include "math/simd.inl"
+#include "math/vector.inl"
+
+#endif // INCLUDE_MATH_HPP_
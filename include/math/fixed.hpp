@@ -0,0 +1,256 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed.hpp
+  \brief  Fixed-point numbers and their arithmetic, trigonometry, and square root.
+
+  Declares \ref toy::math::Fixed. GBA (ARM7TDMI), Sega MD (68000), and the NDS have no FPU, and every \c float
+  operation there is a library call 10 to 50 times slower than the integer one. A \ref toy::math::Fixed is a plain
+  integer with an implied binary point, so its arithmetic compiles to integer instructions only.
+
+  sin(), cos(), and atan2() run CORDIC on 32-bit integers; sqrt() and hypot() take the integer square root of the raw
+  value and of the 64-bit sum of the squares. All of them are \c constexpr. Their results are exact to within one unit
+  in the last place for every format up to 16 fraction bits.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_FIXED_HPP_
+#define INCLUDE_MATH_FIXED_HPP_
+
+/*!
+  \namespace toy::math
+
+  \brief Scalars, vectors, and matrices of engine math.
+*/
+namespace toy::math {
+
+/*!
+  \brief Integer types behind a \ref toy::math::Fixed of \a Bits bits; specialized for 8, 16, and 32.
+
+  \c Raw holds the value, \c Wide holds products and shifted dividends without overflow.
+*/
+template <size_t Bits>
+struct FixedStorage;
+
+template <>
+struct FixedStorage<8> {
+  using Raw  = int8_t;
+  using Wide = int16_t;
+};
+
+template <>
+struct FixedStorage<16> {
+  using Raw  = int16_t;
+  using Wide = int32_t;
+};
+
+template <>
+struct FixedStorage<32> {
+  using Raw  = int32_t;
+  using Wide = int64_t;
+};
+
+/*!
+  \brief Signed fixed-point number with \a IntBits integer bits, the sign included, and \a FracBits fraction bits.
+
+  The value is the raw integer divided by 2^\a FracBits. \c Fixed<16, 16> covers [-32768, 32768) in steps of 1/65536,
+  \c Fixed<8, 8> covers [-128, 128) in steps of 1/256.
+
+  Integers convert implicitly, and so do floating-point constants: their constructor is \c consteval, so
+  <tt>speed * 0.5</tt> converts 0.5 while compiling and a \c float computed at run time does not compile at all.
+  Gameplay code written against \ref toy::math::real therefore builds for both \c float and fixed point unchanged,
+  and never pulls in software floating point on the consoles.
+
+  The operators wrap on overflow, as the integers of the same size do; addSaturated(), subtractSaturated(),
+  multiplySaturated(), and divideSaturated() clamp to the range instead. Products round to nearest, quotients round
+  toward zero. Dividing by zero returns the end of the range on the side of the dividend's sign, or zero for zero.
+
+  \tparam IntBits  Integer bits, the sign bit included; at least 1.
+  \tparam FracBits Fraction bits; \a IntBits + \a FracBits is 8, 16, or 32.
+*/
+template <size_t IntBits, size_t FracBits>
+class Fixed {
+  static_assert(IntBits >= 1, "a fixed-point number needs a sign bit");
+  static_assert(IntBits + FracBits == 8 || IntBits + FracBits == 16 || IntBits + FracBits == 32,
+                "fixed-point numbers are 8, 16, or 32 bits wide");
+
+public:
+  /// Integer holding the value
+  using Raw = typename FixedStorage<IntBits + FracBits>::Raw;
+
+  /// Integer holding intermediate products and dividends
+  using Wide = typename FixedStorage<IntBits + FracBits>::Wide;
+
+  /// Integer bits, the sign bit included
+  static constexpr size_t c_integerBits = IntBits;
+
+  /// Fraction bits
+  static constexpr size_t c_fractionBits = FracBits;
+
+  /// Constructs zero.
+  constexpr Fixed() noexcept = default;
+
+  /// Constructs \a value; integers outside the range wrap.
+  template <std::integral Integer>
+  constexpr Fixed(Integer value) noexcept; // NOLINT(google-explicit-constructor)
+
+  /// Constructs the nearest value to the constant \a value; a constant outside the range does not compile.
+  template <std::floating_point Float>
+  consteval Fixed(Float value) noexcept; // NOLINT(google-explicit-constructor)
+
+  /// Converts \a other to this format; fraction bits that do not fit are truncated, integers that do not fit wrap.
+  template <size_t OtherIntBits, size_t OtherFracBits>
+  constexpr explicit Fixed(Fixed<OtherIntBits, OtherFracBits> other) noexcept;
+
+  /// Returns the number with raw value \a raw.
+  [[nodiscard]] static constexpr Fixed fromRaw(Raw raw) noexcept;
+
+  /// Returns the largest value.
+  [[nodiscard]] static constexpr Fixed highest() noexcept;
+
+  /// Returns the smallest, most negative value.
+  [[nodiscard]] static constexpr Fixed lowest() noexcept;
+
+  /// Returns the step between adjacent values.
+  [[nodiscard]] static constexpr Fixed epsilon() noexcept;
+
+  /// Returns the raw value.
+  [[nodiscard]] constexpr Raw raw() const noexcept;
+
+  /// Returns the value rounded toward negative infinity.
+  template <std::integral Integer>
+  [[nodiscard]] constexpr explicit operator Integer() const noexcept;
+
+  /// Returns the value as a floating-point number; exact for \c double.
+  template <std::floating_point Float>
+  [[nodiscard]] constexpr explicit operator Float() const noexcept;
+
+  /// Returns the value.
+  [[nodiscard]] constexpr Fixed operator+() const noexcept;
+
+  /// Returns the negated value; lowest() stays lowest().
+  [[nodiscard]] constexpr Fixed operator-() const noexcept;
+
+  /// Adds \a other, wrapping on overflow.
+  constexpr Fixed & operator+=(Fixed other) noexcept;
+
+  /// Subtracts \a other, wrapping on overflow.
+  constexpr Fixed & operator-=(Fixed other) noexcept;
+
+  /// Multiplies by \a other, rounding to nearest and wrapping on overflow.
+  constexpr Fixed & operator*=(Fixed other) noexcept;
+
+  /// Divides by \a other, rounding toward zero and wrapping on overflow.
+  constexpr Fixed & operator/=(Fixed other) noexcept;
+
+  /// Compares the values.
+  [[nodiscard]] constexpr auto operator<=>(const Fixed & other) const noexcept = default;
+
+  // Hidden friends, so integers and floating-point constants on either side convert
+
+  [[nodiscard]] friend constexpr Fixed operator+(Fixed left, Fixed right) noexcept {
+    return left += right;
+  }
+
+  [[nodiscard]] friend constexpr Fixed operator-(Fixed left, Fixed right) noexcept {
+    return left -= right;
+  }
+
+  [[nodiscard]] friend constexpr Fixed operator*(Fixed left, Fixed right) noexcept {
+    return left *= right;
+  }
+
+  [[nodiscard]] friend constexpr Fixed operator/(Fixed left, Fixed right) noexcept {
+    return left /= right;
+  }
+
+private:
+  /// Value scaled by 2^FracBits
+  Raw _raw{0};
+};
+
+/// Returns \a left + \a right, clamped to the range.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> addSaturated(Fixed<IntBits, FracBits> left,
+                                                              Fixed<IntBits, FracBits> right) noexcept;
+
+/// Returns \a left - \a right, clamped to the range.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> subtractSaturated(Fixed<IntBits, FracBits> left,
+                                                                   Fixed<IntBits, FracBits> right) noexcept;
+
+/// Returns \a left * \a right, rounded to nearest and clamped to the range.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> multiplySaturated(Fixed<IntBits, FracBits> left,
+                                                                   Fixed<IntBits, FracBits> right) noexcept;
+
+/// Returns \a left / \a right, rounded toward zero and clamped to the range.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> divideSaturated(Fixed<IntBits, FracBits> left,
+                                                                 Fixed<IntBits, FracBits> right) noexcept;
+
+/// Returns the absolute value of \a value; lowest() stays lowest().
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> abs(Fixed<IntBits, FracBits> value) noexcept;
+
+/// Returns \a value rounded toward negative infinity.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> floor(Fixed<IntBits, FracBits> value) noexcept;
+
+/// Returns the sine of \a angle, in radians.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> sin(Fixed<IntBits, FracBits> angle) noexcept;
+
+/// Returns the cosine of \a angle, in radians.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> cos(Fixed<IntBits, FracBits> angle) noexcept;
+
+/// Sine and cosine of one angle.
+template <typename T>
+struct SinCos {
+  /// Sine of the angle
+  T sine;
+
+  /// Cosine of the angle
+  T cosine;
+};
+
+/// Returns the sine and cosine of \a angle, in radians, for the price of one of them.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr SinCos<Fixed<IntBits, FracBits>> sinCos(Fixed<IntBits, FracBits> angle) noexcept;
+
+/// Returns the angle of the point (\a x, \a y) from the x axis, in radians in [-pi, pi]; 0 for the origin.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> atan2(Fixed<IntBits, FracBits> y,
+                                                       Fixed<IntBits, FracBits> x) noexcept;
+
+/// Returns sqrt(\a x * \a x + \a y * \a y) without overflowing in the squares, clamped to the range.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> hypot(Fixed<IntBits, FracBits> x,
+                                                       Fixed<IntBits, FracBits> y) noexcept;
+
+/// Returns the square root of \a value, rounded to nearest; 0 for negative values.
+template <size_t IntBits, size_t FracBits>
+[[nodiscard]] constexpr Fixed<IntBits, FracBits> sqrt(Fixed<IntBits, FracBits> value) noexcept;
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_FIXED_HPP_
@@ -0,0 +1,464 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed.inl
+  \brief  Inline definitions for \ref toy::math::Fixed and its functions.
+
+  The CORDIC kernels work on 32-bit integers whatever the format: coordinates in Q2.30 and angles in Q4.28, which
+  keeps 28 iterations within one unit of Q16 results. Angles are reduced modulo 2 pi in 64-bit arithmetic first, so
+  large angles lose no more precision than the format holds.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_FIXED_INL_
+#define INCLUDE_MATH_FIXED_INL_
+
+namespace toy::math {
+
+namespace fixed_point {
+
+/// Returns \a value divided by 2^\a bits, rounded to nearest.
+[[nodiscard]] constexpr int64_t roundShift(int64_t value, size_t bits) noexcept {
+  return bits == 0 ? value : (value + (int64_t{1} << (bits - 1))) >> bits;
+}
+
+/// Returns \a value clamped to the range of \a Raw.
+template <typename Raw>
+[[nodiscard]] constexpr Raw saturate(int64_t value) noexcept {
+  constexpr auto highest = static_cast<int64_t>(std::numeric_limits<Raw>::max());
+  constexpr auto lowest  = static_cast<int64_t>(std::numeric_limits<Raw>::min());
+
+  return static_cast<Raw>(value > highest ? highest : (value < lowest ? lowest : value));
+}
+
+/// Returns the \a Result nearest to \a value with \a bits fraction bits, clamped to its range.
+template <typename Result>
+[[nodiscard]] constexpr Result fromScaled(int64_t value, size_t bits) noexcept {
+  constexpr size_t fractionBits = Result::c_fractionBits;
+
+  value = bits > fractionBits ? roundShift(value, bits - fractionBits) : value << (fractionBits - bits);
+
+  return Result::fromRaw(saturate<typename Result::Raw>(value));
+}
+
+/// Returns the integer square root of \a value, rounded to nearest.
+[[nodiscard]] constexpr uint64_t squareRoot(uint64_t value) noexcept {
+  uint64_t root = 0;
+  uint64_t bit  = uint64_t{1} << 62;
+
+  while (bit > value)
+    bit >>= 2;
+
+  while (bit != 0) {
+    if (value >= root + bit) {
+      value -= root + bit;
+      root = (root >> 1) + bit;
+    } else {
+      root >>= 1;
+    }
+
+    bit >>= 2;
+  }
+
+  // The remainder is value - root^2; past root the square is nearer to (root + 1)^2
+  return value > root ? root + 1 : root;
+}
+
+} // namespace fixed_point
+
+namespace cordic {
+
+/// Rotations of one CORDIC run
+inline constexpr size_t c_iterations = 28;
+
+/// Fraction bits of CORDIC angles
+inline constexpr size_t c_angleBits = 28;
+
+/// Fraction bits of CORDIC coordinates
+inline constexpr size_t c_unitBits = 30;
+
+/// atan(2^-i) in Q4.28
+inline constexpr array<int32_t, c_iterations> c_angles{
+  210828714, 124459457, 65760959, 33381290, 16755422, 8385879, 4193963, 2097109, 1048571, 524287,
+  262144,    131072,    65536,    32768,    16384,    8192,    4096,    2048,    1024,    512,
+  256,       128,       64,       32,       16,       8,       4,       2,
+};
+
+/// Product of cos(atan(2^-i)) over every iteration, in Q2.30; pre-scales rotations and corrects magnitudes
+inline constexpr int64_t c_gain = 652032874;
+
+/// pi in Q4.28
+inline constexpr int64_t c_pi = 843314857;
+
+/// pi / 2 in Q4.28
+inline constexpr int64_t c_halfPi = 421657428;
+
+/// 2 pi in Q4.28
+inline constexpr int64_t c_twoPi = 1686629713;
+
+/// 2 pi in Q3.60, the reduction modulus before it is rounded to the format of the angle
+inline constexpr int64_t c_twoPiQ60 = 7244019458077122842;
+
+/// Magnitude and angle of a vector.
+struct Polar {
+  /// Length, in the units of the coordinates
+  int64_t magnitude;
+
+  /// Angle from the x axis in Q4.28, in [-pi, pi]
+  int64_t angle;
+};
+
+/// Returns \a angle, with \a FracBits fraction bits, reduced to [-pi, pi] in Q4.28.
+template <size_t FracBits>
+[[nodiscard]] constexpr int64_t reduceAngle(int64_t angle) noexcept {
+  // Raw values are below 2^31, so 31 more bits fit in 64; the modulus itself needs 3 integer bits
+  constexpr size_t  bits    = FracBits + 31 < 60 ? FracBits + 31 : 60;
+  constexpr int64_t modulus = fixed_point::roundShift(c_twoPiQ60, 60 - bits);
+
+  int64_t scaled = angle << (bits - FracBits);
+
+  // Most angles are within one turn already; the 64-bit division is a library call on the consoles
+  if (scaled >= modulus || scaled <= -modulus) [[unlikely]]
+    scaled %= modulus;
+
+  int64_t reduced = fixed_point::roundShift(scaled, bits - c_angleBits);
+
+  if (reduced > c_pi)
+    reduced -= c_twoPi;
+  else if (reduced < -c_pi)
+    reduced += c_twoPi;
+
+  return reduced;
+}
+
+/// Returns the sine and cosine of \a angle, in Q4.28 within [-pi, pi], in Q2.30.
+[[nodiscard]] constexpr SinCos<int64_t> rotate(int64_t angle) noexcept {
+  // Rotation converges within [-pi/2, pi/2]; outside it, sin(pi - a) = sin(a) and cos(pi - a) = -cos(a)
+  bool mirrored = false;
+
+  if (angle > c_halfPi) {
+    angle    = c_pi - angle;
+    mirrored = true;
+  } else if (angle < -c_halfPi) {
+    angle    = -c_pi - angle;
+    mirrored = true;
+  }
+
+  auto x = static_cast<int32_t>(c_gain);
+  auto y = int32_t{0};
+  auto z = static_cast<int32_t>(angle);
+
+  // Branchless: the sign of the remaining angle picks the direction, negating a step as (step ^ sign) - sign
+  for (size_t index = 0; index < c_iterations; ++index) {
+    const int32_t sign  = z >> 31;
+    const int32_t stepX = x >> index;
+    const int32_t stepY = y >> index;
+
+    x -= (stepY ^ sign) - sign;
+    y += (stepX ^ sign) - sign;
+    z -= (c_angles[index] ^ sign) - sign;
+  }
+
+  return {y, mirrored ? -x : x};
+}
+
+/// Returns the magnitude and angle of (\a x, \a y); coordinates must be below 2^32 in magnitude.
+[[nodiscard]] constexpr Polar toPolar(int64_t x, int64_t y) noexcept {
+  if (x == 0 && y == 0)
+    return {0, 0};
+
+  // Vectoring converges for x >= 0; a vector on the left is turned by pi first
+  int64_t angle = 0;
+
+  if (x < 0) {
+    angle = y >= 0 ? c_pi : -c_pi;
+    x     = -x;
+    y     = -y;
+  }
+
+  // Scale the larger coordinate to 29 bits: precise, and the 1.65 gain of vectoring cannot overflow 31 bits
+  const int64_t larger = x > (y < 0 ? -y : y) ? x : (y < 0 ? -y : y);
+  const int     shift  = static_cast<int>(std::bit_width(static_cast<uint64_t>(larger))) - 29;
+
+  if (shift > 0) {
+    x >>= shift;
+    y >>= shift;
+  } else {
+    x <<= -shift;
+    y <<= -shift;
+  }
+
+  auto vectorX = static_cast<int32_t>(x);
+  auto vectorY = static_cast<int32_t>(y);
+
+  for (size_t index = 0; index < c_iterations; ++index) {
+    // All ones while y is above the axis, turning the vector clockwise
+    const int32_t sign  = -vectorY >> 31;
+    const int32_t stepX = vectorX >> index;
+    const int32_t stepY = vectorY >> index;
+
+    vectorX -= (stepY ^ sign) - sign;
+    vectorY += (stepX ^ sign) - sign;
+    angle -= (c_angles[index] ^ sign) - sign;
+  }
+
+  const int64_t magnitude = static_cast<int64_t>(vectorX) * c_gain;
+
+  return {shift > 0 ? fixed_point::roundShift(magnitude, c_unitBits) << shift
+                    : fixed_point::roundShift(magnitude, c_unitBits - shift),
+          angle};
+}
+
+} // namespace cordic
+
+template <size_t IntBits, size_t FracBits>
+template <std::integral Integer>
+constexpr Fixed<IntBits, FracBits>::Fixed(Integer value) noexcept
+  : _raw(static_cast<Raw>(static_cast<std::make_unsigned_t<Raw>>(value) << FracBits)) {}
+
+template <size_t IntBits, size_t FracBits>
+template <std::floating_point Float>
+consteval Fixed<IntBits, FracBits>::Fixed(Float value) noexcept {
+  const double scaled  = static_cast<double>(value) * static_cast<double>(Wide{1} << FracBits);
+  const double rounded = scaled < 0 ? scaled - 0.5 : scaled + 0.5;
+
+  // The comparisons also reject NaN
+  if (!(rounded > static_cast<double>(std::numeric_limits<Raw>::min()) - 1.0
+        && rounded < static_cast<double>(std::numeric_limits<Raw>::max()) + 1.0))
+    assertion::assertCompileTimeError();
+
+  _raw = static_cast<Raw>(static_cast<int64_t>(rounded));
+}
+
+template <size_t IntBits, size_t FracBits>
+template <size_t OtherIntBits, size_t OtherFracBits>
+constexpr Fixed<IntBits, FracBits>::Fixed(Fixed<OtherIntBits, OtherFracBits> other) noexcept {
+  const auto raw = static_cast<int64_t>(other.raw());
+
+  if constexpr (OtherFracBits > FracBits)
+    _raw = static_cast<Raw>(raw >> (OtherFracBits - FracBits));
+  else
+    _raw = static_cast<Raw>(raw << (FracBits - OtherFracBits));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::fromRaw(Raw raw) noexcept {
+  Fixed result;
+
+  result._raw = raw;
+
+  return result;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::highest() noexcept {
+  return fromRaw(std::numeric_limits<Raw>::max());
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::lowest() noexcept {
+  return fromRaw(std::numeric_limits<Raw>::min());
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::epsilon() noexcept {
+  return fromRaw(1);
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr typename Fixed<IntBits, FracBits>::Raw Fixed<IntBits, FracBits>::raw() const noexcept {
+  return _raw;
+}
+
+template <size_t IntBits, size_t FracBits>
+template <std::integral Integer>
+constexpr Fixed<IntBits, FracBits>::operator Integer() const noexcept {
+  return static_cast<Integer>(_raw >> FracBits);
+}
+
+template <size_t IntBits, size_t FracBits>
+template <std::floating_point Float>
+constexpr Fixed<IntBits, FracBits>::operator Float() const noexcept {
+  return static_cast<Float>(_raw) / static_cast<Float>(Wide{1} << FracBits);
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator+() const noexcept {
+  return *this;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> Fixed<IntBits, FracBits>::operator-() const noexcept {
+  using Unsigned = std::make_unsigned_t<Raw>;
+
+  return fromRaw(static_cast<Raw>(Unsigned{0} - static_cast<Unsigned>(_raw)));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> & Fixed<IntBits, FracBits>::operator+=(Fixed other) noexcept {
+  using Unsigned = std::make_unsigned_t<Raw>;
+
+  _raw = static_cast<Raw>(static_cast<Unsigned>(_raw) + static_cast<Unsigned>(other._raw));
+
+  return *this;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> & Fixed<IntBits, FracBits>::operator-=(Fixed other) noexcept {
+  using Unsigned = std::make_unsigned_t<Raw>;
+
+  _raw = static_cast<Raw>(static_cast<Unsigned>(_raw) - static_cast<Unsigned>(other._raw));
+
+  return *this;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> & Fixed<IntBits, FracBits>::operator*=(Fixed other) noexcept {
+  auto product = static_cast<Wide>(static_cast<Wide>(_raw) * other._raw);
+
+  if constexpr (FracBits > 0)
+    product = static_cast<Wide>(product + (Wide{1} << (FracBits - 1)));
+
+  _raw = static_cast<Raw>(product >> FracBits);
+
+  return *this;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> & Fixed<IntBits, FracBits>::operator/=(Fixed other) noexcept {
+  if (other._raw == 0) [[unlikely]] {
+    _raw = _raw > 0 ? std::numeric_limits<Raw>::max() : (_raw < 0 ? std::numeric_limits<Raw>::min() : Raw{0});
+
+    return *this;
+  }
+
+  _raw = static_cast<Raw>(static_cast<Wide>(static_cast<Wide>(_raw) << FracBits) / other._raw);
+
+  return *this;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> addSaturated(Fixed<IntBits, FracBits> left,
+                                                Fixed<IntBits, FracBits> right) noexcept {
+  using Raw = typename Fixed<IntBits, FracBits>::Raw;
+
+  return Fixed<IntBits, FracBits>::fromRaw(
+    fixed_point::saturate<Raw>(static_cast<int64_t>(left.raw()) + static_cast<int64_t>(right.raw())));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> subtractSaturated(Fixed<IntBits, FracBits> left,
+                                                     Fixed<IntBits, FracBits> right) noexcept {
+  using Raw = typename Fixed<IntBits, FracBits>::Raw;
+
+  return Fixed<IntBits, FracBits>::fromRaw(
+    fixed_point::saturate<Raw>(static_cast<int64_t>(left.raw()) - static_cast<int64_t>(right.raw())));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> multiplySaturated(Fixed<IntBits, FracBits> left,
+                                                     Fixed<IntBits, FracBits> right) noexcept {
+  using Wide = typename Fixed<IntBits, FracBits>::Wide;
+
+  auto product = static_cast<Wide>(static_cast<Wide>(left.raw()) * right.raw());
+
+  if constexpr (FracBits > 0)
+    product = static_cast<Wide>(product + (Wide{1} << (FracBits - 1)));
+
+  return Fixed<IntBits, FracBits>::fromRaw(
+    fixed_point::saturate<typename Fixed<IntBits, FracBits>::Raw>(product >> FracBits));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> divideSaturated(Fixed<IntBits, FracBits> left,
+                                                   Fixed<IntBits, FracBits> right) noexcept {
+  using Wide = typename Fixed<IntBits, FracBits>::Wide;
+
+  if (right.raw() == 0) [[unlikely]]
+    return left / right;
+
+  return Fixed<IntBits, FracBits>::fromRaw(fixed_point::saturate<typename Fixed<IntBits, FracBits>::Raw>(
+    static_cast<Wide>(static_cast<Wide>(left.raw()) << FracBits) / right.raw()));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> abs(Fixed<IntBits, FracBits> value) noexcept {
+  return value.raw() < 0 ? -value : value;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> floor(Fixed<IntBits, FracBits> value) noexcept {
+  using Raw  = typename Fixed<IntBits, FracBits>::Raw;
+  using Wide = typename Fixed<IntBits, FracBits>::Wide;
+
+  return Fixed<IntBits, FracBits>::fromRaw(static_cast<Raw>(value.raw() & ~((Wide{1} << FracBits) - 1)));
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> sin(Fixed<IntBits, FracBits> angle) noexcept {
+  return sinCos(angle).sine;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> cos(Fixed<IntBits, FracBits> angle) noexcept {
+  return sinCos(angle).cosine;
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr SinCos<Fixed<IntBits, FracBits>> sinCos(Fixed<IntBits, FracBits> angle) noexcept {
+  using Result = Fixed<IntBits, FracBits>;
+
+  const auto rotation = cordic::rotate(cordic::reduceAngle<FracBits>(angle.raw()));
+
+  return {fixed_point::fromScaled<Result>(rotation.sine, cordic::c_unitBits),
+          fixed_point::fromScaled<Result>(rotation.cosine, cordic::c_unitBits)};
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> atan2(Fixed<IntBits, FracBits> y, Fixed<IntBits, FracBits> x) noexcept {
+  return fixed_point::fromScaled<Fixed<IntBits, FracBits>>(cordic::toPolar(x.raw(), y.raw()).angle,
+                                                           cordic::c_angleBits);
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> hypot(Fixed<IntBits, FracBits> x, Fixed<IntBits, FracBits> y) noexcept {
+  // Squares of 32-bit raws sum below 2^64, so the root of the exact sum needs no scaling
+  const auto     wideX   = static_cast<int64_t>(x.raw());
+  const auto     wideY   = static_cast<int64_t>(y.raw());
+  const uint64_t squares = static_cast<uint64_t>(wideX * wideX) + static_cast<uint64_t>(wideY * wideY);
+  const uint64_t root    = fixed_point::squareRoot(squares);
+
+  return fixed_point::fromScaled<Fixed<IntBits, FracBits>>(static_cast<int64_t>(root), FracBits);
+}
+
+template <size_t IntBits, size_t FracBits>
+constexpr Fixed<IntBits, FracBits> sqrt(Fixed<IntBits, FracBits> value) noexcept {
+  if (value.raw() <= 0)
+    return {};
+
+  const uint64_t root = fixed_point::squareRoot(static_cast<uint64_t>(value.raw()) << FracBits);
+
+  return fixed_point::fromScaled<Fixed<IntBits, FracBits>>(static_cast<int64_t>(root), FracBits);
+}
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_FIXED_INL_
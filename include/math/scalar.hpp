@@ -0,0 +1,84 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   scalar.hpp
+  \brief  The engine scalar type and the \c float overloads of the fixed-point functions.
+
+  Declares \ref toy::math::real, the scalar gameplay and engine code compute in. The FPU-less consoles (GBA, Sega MD,
+  NDS) build with \c TOYGINE_FIXED_POINT_MATH and get \c Fixed<16, 16>; every other target gets \c float. The
+  overloads here give \c float the same names as the \ref toy::math::Fixed functions, so calls that name
+  \c toy::math compile for either:
+
+  \code
+  using namespace toy::math;
+
+  real heading = atan2(target.y - position.y, target.x - position.x);
+  const auto direction = sinCos(heading);
+
+  position.x += direction.cosine * speed * 0.5;
+  \endcode
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_SCALAR_HPP_
+#define INCLUDE_MATH_SCALAR_HPP_
+
+namespace toy::math {
+
+#ifdef TOYGINE_FIXED_POINT_MATH
+/// Scalar of engine math: 16.16 fixed point on targets without an FPU
+using real = Fixed<16, 16>;
+#else
+/// Scalar of engine math: \c float on targets with an FPU
+using real = float;
+#endif
+
+/// pi as a \a T
+template <typename T>
+inline constexpr T c_pi = T(3.14159265358979323846);
+
+/// Returns the absolute value of \a value.
+[[nodiscard]] float abs(float value) noexcept;
+
+/// Returns \a value rounded toward negative infinity.
+[[nodiscard]] float floor(float value) noexcept;
+
+/// Returns the sine of \a angle, in radians.
+[[nodiscard]] float sin(float angle) noexcept;
+
+/// Returns the cosine of \a angle, in radians.
+[[nodiscard]] float cos(float angle) noexcept;
+
+/// Returns the sine and cosine of \a angle, in radians.
+[[nodiscard]] SinCos<float> sinCos(float angle) noexcept;
+
+/// Returns the angle of the point (\a x, \a y) from the x axis, in radians in [-pi, pi].
+[[nodiscard]] float atan2(float y, float x) noexcept;
+
+/// Returns sqrt(\a x * \a x + \a y * \a y) without overflowing in the squares.
+[[nodiscard]] float hypot(float x, float y) noexcept;
+
+/// Returns the square root of \a value.
+[[nodiscard]] float sqrt(float value) noexcept;
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_SCALAR_HPP_
@@ -0,0 +1,66 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   scalar.inl
+  \brief  Inline definitions for the \c float overloads of engine math.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_SCALAR_INL_
+#define INCLUDE_MATH_SCALAR_INL_
+
+namespace toy::math {
+
+inline float abs(float value) noexcept {
+  return std::fabs(value);
+}
+
+inline float floor(float value) noexcept {
+  return std::floor(value);
+}
+
+inline float sin(float angle) noexcept {
+  return std::sin(angle);
+}
+
+inline float cos(float angle) noexcept {
+  return std::cos(angle);
+}
+
+inline SinCos<float> sinCos(float angle) noexcept {
+  return {std::sin(angle), std::cos(angle)};
+}
+
+inline float atan2(float y, float x) noexcept {
+  return std::atan2(y, x);
+}
+
+inline float hypot(float x, float y) noexcept {
+  return std::hypot(x, y);
+}
+
+inline float sqrt(float value) noexcept {
+  return std::sqrt(value);
+}
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_SCALAR_INL_
@@ -0,0 +1,110 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   simd.hpp
+  \brief  Four-lane \c float register behind the \c float vectors, matrices, and quaternions.
+
+  Declares \ref toy::math::Float4: one SSE register on x86, one NEON register on ARM64, and four plain floats on every
+  other target. \ref toy::math::Vector4, \ref toy::math::Matrix4, and \ref toy::math::Quaternion of \c float run their
+  products through it at run time; constant evaluation keeps the portable code.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_SIMD_HPP_
+#define INCLUDE_MATH_SIMD_HPP_
+
+// Instruction sets behind Float4; every other target keeps four floats
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TOYGINE_MATH_SSE
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define TOYGINE_MATH_NEON
+#endif
+
+namespace toy::math {
+
+/*!
+  \brief Four \c float lanes in one vector register.
+
+  Loads and stores are unaligned. multiplyAdd() fuses when the target has FMA, so its results can differ from a
+  separate multiply and add in the last bit.
+*/
+class Float4 {
+public:
+#if defined(TOYGINE_MATH_SSE)
+  /// Register holding the lanes
+  using Register = __m128;
+#elif defined(TOYGINE_MATH_NEON)
+  /// Register holding the lanes
+  using Register = float32x4_t;
+#else
+  /// Lanes, where no vector register exists
+  using Register = array<float, 4>;
+#endif
+
+  /// Constructs four uninitialized lanes.
+  Float4() noexcept = default;
+
+  /// Constructs four lanes equal to \a value.
+  explicit Float4(float value) noexcept;
+
+  /// Constructs the lanes \a x, \a y, \a z, and \a w, in order.
+  Float4(float x, float y, float z, float w) noexcept;
+
+  /// Wraps \a value.
+  explicit Float4(Register value) noexcept;
+
+  /// Returns the four floats at \a values.
+  [[nodiscard]] static Float4 load(const float * values) noexcept;
+
+  /// Writes the four lanes to \a values.
+  void store(float * values) const noexcept;
+
+  /// Returns the register.
+  [[nodiscard]] Register value() const noexcept;
+
+  /// Returns lane \a Lane.
+  template <size_t Lane>
+  [[nodiscard]] float lane() const noexcept;
+
+  /// Returns lanes \a X, \a Y, \a Z, and \a W of this register, in order.
+  template <size_t X, size_t Y, size_t Z, size_t W>
+  [[nodiscard]] Float4 shuffle() const noexcept;
+
+private:
+  /// Lanes
+  Register _value;
+};
+
+/// Returns the lane-wise sum.
+[[nodiscard]] Float4 operator+(Float4 left, Float4 right) noexcept;
+
+/// Returns the lane-wise difference.
+[[nodiscard]] Float4 operator-(Float4 left, Float4 right) noexcept;
+
+/// Returns the lane-wise product.
+[[nodiscard]] Float4 operator*(Float4 left, Float4 right) noexcept;
+
+/// Returns \a left * \a right + \a addend, lane-wise.
+[[nodiscard]] Float4 multiplyAdd(Float4 left, Float4 right, Float4 addend) noexcept;
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_SIMD_HPP_
@@ -0,0 +1,204 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   simd.inl
+  \brief  Inline definitions for \ref toy::math::Float4.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_SIMD_INL_
+#define INCLUDE_MATH_SIMD_INL_
+
+namespace toy::math {
+
+#if defined(TOYGINE_MATH_SSE)
+
+inline Float4::Float4(float value) noexcept
+  : _value(_mm_set1_ps(value)) {}
+
+inline Float4::Float4(float x, float y, float z, float w) noexcept
+  : _value(_mm_setr_ps(x, y, z, w)) {}
+
+inline Float4 Float4::load(const float * values) noexcept {
+  return Float4(_mm_loadu_ps(values));
+}
+
+inline void Float4::store(float * values) const noexcept {
+  _mm_storeu_ps(values, _value);
+}
+
+template <size_t Lane>
+inline float Float4::lane() const noexcept {
+  static_assert(Lane < 4, "a Float4 has four lanes");
+
+  return _mm_cvtss_f32(_mm_shuffle_ps(_value, _value, static_cast<int>(Lane * 0x55)));
+}
+
+template <size_t X, size_t Y, size_t Z, size_t W>
+inline Float4 Float4::shuffle() const noexcept {
+  static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "a Float4 has four lanes");
+
+  return Float4(_mm_shuffle_ps(_value, _value, static_cast<int>(X | (Y << 2) | (Z << 4) | (W << 6))));
+}
+
+inline Float4 operator+(Float4 left, Float4 right) noexcept {
+  return Float4(_mm_add_ps(left.value(), right.value()));
+}
+
+inline Float4 operator-(Float4 left, Float4 right) noexcept {
+  return Float4(_mm_sub_ps(left.value(), right.value()));
+}
+
+inline Float4 operator*(Float4 left, Float4 right) noexcept {
+  return Float4(_mm_mul_ps(left.value(), right.value()));
+}
+
+inline Float4 multiplyAdd(Float4 left, Float4 right, Float4 addend) noexcept {
+#if defined(__FMA__) || defined(__AVX2__)
+  return Float4(_mm_fmadd_ps(left.value(), right.value(), addend.value()));
+#else
+  return Float4(_mm_add_ps(_mm_mul_ps(left.value(), right.value()), addend.value()));
+#endif
+}
+
+#elif defined(TOYGINE_MATH_NEON)
+
+inline Float4::Float4(float value) noexcept
+  : _value(vdupq_n_f32(value)) {}
+
+inline Float4::Float4(float x, float y, float z, float w) noexcept {
+  const float values[4] = {x, y, z, w};
+
+  _value = vld1q_f32(values);
+}
+
+inline Float4 Float4::load(const float * values) noexcept {
+  return Float4(vld1q_f32(values));
+}
+
+inline void Float4::store(float * values) const noexcept {
+  vst1q_f32(values, _value);
+}
+
+template <size_t Lane>
+inline float Float4::lane() const noexcept {
+  static_assert(Lane < 4, "a Float4 has four lanes");
+
+  return vgetq_lane_f32(_value, Lane);
+}
+
+template <size_t X, size_t Y, size_t Z, size_t W>
+inline Float4 Float4::shuffle() const noexcept {
+  static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "a Float4 has four lanes");
+
+  // One table lookup picks the four bytes of each source lane
+  static constexpr uint8_t c_bytes[16] = {
+    X * 4, X * 4 + 1, X * 4 + 2, X * 4 + 3, Y * 4, Y * 4 + 1, Y * 4 + 2, Y * 4 + 3,
+    Z * 4, Z * 4 + 1, Z * 4 + 2, Z * 4 + 3, W * 4, W * 4 + 1, W * 4 + 2, W * 4 + 3,
+  };
+
+  return Float4(vreinterpretq_f32_u8(vqtbl1q_u8(vreinterpretq_u8_f32(_value), vld1q_u8(c_bytes))));
+}
+
+inline Float4 operator+(Float4 left, Float4 right) noexcept {
+  return Float4(vaddq_f32(left.value(), right.value()));
+}
+
+inline Float4 operator-(Float4 left, Float4 right) noexcept {
+  return Float4(vsubq_f32(left.value(), right.value()));
+}
+
+inline Float4 operator*(Float4 left, Float4 right) noexcept {
+  return Float4(vmulq_f32(left.value(), right.value()));
+}
+
+inline Float4 multiplyAdd(Float4 left, Float4 right, Float4 addend) noexcept {
+  return Float4(vfmaq_f32(addend.value(), left.value(), right.value()));
+}
+
+#else
+
+inline Float4::Float4(float value) noexcept
+  : _value{value, value, value, value} {}
+
+inline Float4::Float4(float x, float y, float z, float w) noexcept
+  : _value{x, y, z, w} {}
+
+inline Float4 Float4::load(const float * values) noexcept {
+  return Float4(values[0], values[1], values[2], values[3]);
+}
+
+inline void Float4::store(float * values) const noexcept {
+  for (size_t index = 0; index < 4; ++index)
+    values[index] = _value[index];
+}
+
+template <size_t Lane>
+inline float Float4::lane() const noexcept {
+  static_assert(Lane < 4, "a Float4 has four lanes");
+
+  return _value[Lane];
+}
+
+template <size_t X, size_t Y, size_t Z, size_t W>
+inline Float4 Float4::shuffle() const noexcept {
+  static_assert(X < 4 && Y < 4 && Z < 4 && W < 4, "a Float4 has four lanes");
+
+  return Float4(_value[X], _value[Y], _value[Z], _value[W]);
+}
+
+inline Float4 operator+(Float4 left, Float4 right) noexcept {
+  const auto a = left.value();
+  const auto b = right.value();
+
+  return Float4(a[0] + b[0], a[1] + b[1], a[2] + b[2], a[3] + b[3]);
+}
+
+inline Float4 operator-(Float4 left, Float4 right) noexcept {
+  const auto a = left.value();
+  const auto b = right.value();
+
+  return Float4(a[0] - b[0], a[1] - b[1], a[2] - b[2], a[3] - b[3]);
+}
+
+inline Float4 operator*(Float4 left, Float4 right) noexcept {
+  const auto a = left.value();
+  const auto b = right.value();
+
+  return Float4(a[0] * b[0], a[1] * b[1], a[2] * b[2], a[3] * b[3]);
+}
+
+inline Float4 multiplyAdd(Float4 left, Float4 right, Float4 addend) noexcept {
+  return left * right + addend;
+}
+
+#endif
+
+inline Float4::Float4(Register value) noexcept
+  : _value(value) {}
+
+inline Float4::Register Float4::value() const noexcept {
+  return _value;
+}
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_SIMD_INL_
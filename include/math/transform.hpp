@@ -0,0 +1,100 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   transform.hpp
+  \brief  Batch transforms of points stored as structure of arrays.
+
+  Sprite and particle updates transform thousands of positions by one matrix. Stored as separate arrays of x, y, and
+  z, the coordinates load straight into vector registers, and each instruction transforms 8 points on CPUs with AVX2
+  or 4 with SSE or NEON. Every other target, and the tail of each array, runs the matching \ref toy::math::scalar
+  routine:
+
+  \code
+  // positionsX and positionsY hold one coordinate of every sprite
+  toy::math::transformPoints(camera, positionsX, positionsY, screenX, screenY, spriteCount);
+  \endcode
+
+  The result arrays may be the source arrays, for transforms in place; any other overlap is not allowed.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_TRANSFORM_HPP_
+#define INCLUDE_MATH_TRANSFORM_HPP_
+
+namespace toy::math {
+
+/*!
+  \brief Transforms \a count 2D points by the affine \a transform.
+
+  Every point of a call is rounded the same way, whatever its position in the batch. The vector loops compute
+  \c a*x+(b*y+c) and fuse the multiply-adds where the SIMD level has FMA, so results may differ in the last bits from
+  \ref toy::math::scalar::transformPoints and between machines that dispatch to different levels.
+
+  \param transform Transform; its bottom row is taken as (0, 0, 1).
+  \param x         First coordinates of the points.
+  \param y         Second coordinates of the points.
+  \param resultX   Receives the first coordinates of the transformed points.
+  \param resultY   Receives the second coordinates of the transformed points.
+  \param count     Number of points.
+*/
+void transformPoints(const Matrix3<float> & transform, const float * x, const float * y, float * resultX,
+                     float * resultY, size_t count) noexcept;
+
+/*!
+  \brief Transforms \a count 3D points by the affine \a transform.
+
+  Rounds like the 2D transformPoints(), with \c a*x+(b*y+(c*z+d)) in the vector loops.
+
+  \param transform Transform; its bottom row is taken as (0, 0, 0, 1).
+  \param x         First coordinates of the points.
+  \param y         Second coordinates of the points.
+  \param z         Third coordinates of the points.
+  \param resultX   Receives the first coordinates of the transformed points.
+  \param resultY   Receives the second coordinates of the transformed points.
+  \param resultZ   Receives the third coordinates of the transformed points.
+  \param count     Number of points.
+*/
+void transformPoints(const Matrix4<float> & transform, const float * x, const float * y, const float * z,
+                     float * resultX, float * resultY, float * resultZ, size_t count) noexcept;
+
+/*!
+  \namespace toy::math::scalar
+
+  \brief Portable reference implementations of the batch kernels.
+
+  Each function here has the same contract as its counterpart in \ref toy::math and transforms one point per step.
+  Retro targets run these; desktop builds keep them for tests and benchmarks.
+*/
+namespace scalar {
+
+/// Point-at-a-time transformPoints() for 2D points; same contract
+void transformPoints(const Matrix3<float> & transform, const float * x, const float * y, float * resultX,
+                     float * resultY, size_t count) noexcept;
+
+/// Point-at-a-time transformPoints() for 3D points; same contract
+void transformPoints(const Matrix4<float> & transform, const float * x, const float * y, const float * z,
+                     float * resultX, float * resultY, float * resultZ, size_t count) noexcept;
+
+} // namespace scalar
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_TRANSFORM_HPP_
@@ -0,0 +1,398 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   vector.hpp
+  \brief  Vectors, matrices, and quaternions over any scalar.
+
+  Declares \ref toy::math::Vector2, \ref toy::math::Vector3, \ref toy::math::Vector4, \ref toy::math::Matrix3,
+  \ref toy::math::Matrix4, and \ref toy::math::Quaternion, and their aliases over \ref toy::math::real. A
+  \ref toy::math::Mat3 is the affine transform of 2D games: rotation, scale, and translation of sprites and cameras in
+  one matrix; a \ref toy::math::Mat4 is the same for 3D.
+
+  Over \c float, the 4x4 products and the quaternion product run on \ref toy::math::Float4 registers. Transforming
+  many points one call at a time still spends most of its time moving single elements in and out of registers; the
+  kernels of transform.hpp transform whole arrays instead.
+
+  Lengths go through hypot(), not through the sum of squares: a 16.16 vector 200 units long squares to 40000, past
+  the 32767 its format holds.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_VECTOR_HPP_
+#define INCLUDE_MATH_VECTOR_HPP_
+
+namespace toy::math {
+
+template <typename T>
+struct Quaternion;
+
+/*!
+  \brief Vector with components \ref x and \ref y.
+
+  \tparam T Scalar type: \c float or a \ref toy::math::Fixed.
+*/
+template <typename T>
+struct Vector2 {
+  /// First component
+  T x{};
+
+  /// Second component
+  T y{};
+
+  /// Adds \a other component-wise.
+  constexpr Vector2 & operator+=(const Vector2 & other) noexcept;
+
+  /// Subtracts \a other component-wise.
+  constexpr Vector2 & operator-=(const Vector2 & other) noexcept;
+
+  /// Multiplies every component by \a scale.
+  constexpr Vector2 & operator*=(T scale) noexcept;
+
+  /// Divides every component by \a scale.
+  constexpr Vector2 & operator/=(T scale) noexcept;
+
+  /// Compares the components.
+  [[nodiscard]] constexpr bool operator==(const Vector2 & other) const noexcept = default;
+};
+
+/*!
+  \brief Vector with components \ref x, \ref y, and \ref z.
+
+  \tparam T Scalar type: \c float or a \ref toy::math::Fixed.
+*/
+template <typename T>
+struct Vector3 {
+  /// First component
+  T x{};
+
+  /// Second component
+  T y{};
+
+  /// Third component
+  T z{};
+
+  /// Adds \a other component-wise.
+  constexpr Vector3 & operator+=(const Vector3 & other) noexcept;
+
+  /// Subtracts \a other component-wise.
+  constexpr Vector3 & operator-=(const Vector3 & other) noexcept;
+
+  /// Multiplies every component by \a scale.
+  constexpr Vector3 & operator*=(T scale) noexcept;
+
+  /// Divides every component by \a scale.
+  constexpr Vector3 & operator/=(T scale) noexcept;
+
+  /// Compares the components.
+  [[nodiscard]] constexpr bool operator==(const Vector3 & other) const noexcept = default;
+};
+
+/*!
+  \brief 3x3 matrix stored as three columns; transforms column vectors.
+
+  Applied to 2D points, the first two columns are the rotated and scaled axes and the third is the translation.
+
+  \tparam T Scalar type: \c float or a \ref toy::math::Fixed.
+*/
+template <typename T>
+struct Matrix3 {
+  /// Columns, left to right
+  array<Vector3<T>, 3> columns{};
+
+  /// Returns the identity matrix.
+  [[nodiscard]] static constexpr Matrix3 identity() noexcept;
+
+  /// Returns the transform moving points by \a offset.
+  [[nodiscard]] static constexpr Matrix3 translation(const Vector2<T> & offset) noexcept;
+
+  /// Returns the transform rotating points by \a angle radians, counterclockwise.
+  [[nodiscard]] static constexpr Matrix3 rotation(T angle) noexcept;
+
+  /// Returns the transform scaling points by \a factors along each axis.
+  [[nodiscard]] static constexpr Matrix3 scale(const Vector2<T> & factors) noexcept;
+
+  /// Returns the element at \a row of \a column.
+  [[nodiscard]] constexpr T at(size_t row, size_t column) const noexcept;
+
+  /// Returns \a point transformed, translation included.
+  [[nodiscard]] constexpr Vector2<T> transformPoint(const Vector2<T> & point) const noexcept;
+
+  /// Returns \a direction transformed, translation excluded.
+  [[nodiscard]] constexpr Vector2<T> transformVector(const Vector2<T> & direction) const noexcept;
+
+  /// Returns the transposed matrix.
+  [[nodiscard]] constexpr Matrix3 transposed() const noexcept;
+
+  /// Returns the determinant.
+  [[nodiscard]] constexpr T determinant() const noexcept;
+
+  /// Compares the elements.
+  [[nodiscard]] constexpr bool operator==(const Matrix3 & other) const noexcept = default;
+};
+
+/*!
+  \brief Vector with components \ref x, \ref y, \ref z, and \ref w; a point when \ref w is 1, a direction when 0.
+
+  \tparam T Scalar type: \c float or a \ref toy::math::Fixed.
+*/
+template <typename T>
+struct Vector4 {
+  /// First component
+  T x{};
+
+  /// Second component
+  T y{};
+
+  /// Third component
+  T z{};
+
+  /// Fourth component
+  T w{};
+
+  /// Adds \a other component-wise.
+  constexpr Vector4 & operator+=(const Vector4 & other) noexcept;
+
+  /// Subtracts \a other component-wise.
+  constexpr Vector4 & operator-=(const Vector4 & other) noexcept;
+
+  /// Multiplies every component by \a scale.
+  constexpr Vector4 & operator*=(T scale) noexcept;
+
+  /// Compares the components.
+  [[nodiscard]] constexpr bool operator==(const Vector4 & other) const noexcept = default;
+};
+
+/*!
+  \brief 4x4 matrix stored as four columns; transforms column vectors.
+
+  Applied to 3D points, the first three columns are the rotated and scaled axes and the fourth is the translation.
+
+  \tparam T Scalar type: \c float or a \ref toy::math::Fixed.
+*/
+template <typename T>
+struct Matrix4 {
+  /// Columns, left to right
+  array<Vector4<T>, 4> columns{};
+
+  /// Returns the identity matrix.
+  [[nodiscard]] static constexpr Matrix4 identity() noexcept;
+
+  /// Returns the transform moving points by \a offset.
+  [[nodiscard]] static constexpr Matrix4 translation(const Vector3<T> & offset) noexcept;
+
+  /// Returns the transform rotating points by the unit quaternion \a rotation.
+  [[nodiscard]] static constexpr Matrix4 rotation(const Quaternion<T> & rotation) noexcept;
+
+  /// Returns the transform scaling points by \a factors along each axis.
+  [[nodiscard]] static constexpr Matrix4 scale(const Vector3<T> & factors) noexcept;
+
+  /// Returns the element at \a row of \a column.
+  [[nodiscard]] constexpr T at(size_t row, size_t column) const noexcept;
+
+  /// Returns \a point transformed, translation included.
+  [[nodiscard]] constexpr Vector3<T> transformPoint(const Vector3<T> & point) const noexcept;
+
+  /// Returns \a direction transformed, translation excluded.
+  [[nodiscard]] constexpr Vector3<T> transformVector(const Vector3<T> & direction) const noexcept;
+
+  /// Returns the transposed matrix.
+  [[nodiscard]] constexpr Matrix4 transposed() const noexcept;
+
+  /// Compares the elements.
+  [[nodiscard]] constexpr bool operator==(const Matrix4 & other) const noexcept = default;
+};
+
+/*!
+  \brief Rotation quaternion \ref w + \ref x i + \ref y j + \ref z k; default-constructs to no rotation.
+
+  Only unit quaternions are rotations. Products of unit quaternions drift from unit length in the last bits; normalize()
+  them now and then.
+
+  \tparam T Scalar type: \c float or a \ref toy::math::Fixed.
+*/
+template <typename T>
+struct Quaternion {
+  /// First imaginary component
+  T x{};
+
+  /// Second imaginary component
+  T y{};
+
+  /// Third imaginary component
+  T z{};
+
+  /// Real component
+  T w{1};
+
+  /// Returns the rotation by \a angle radians around the unit vector \a axis, counterclockwise looking down the axis.
+  [[nodiscard]] static constexpr Quaternion fromAxisAngle(const Vector3<T> & axis, T angle) noexcept;
+
+  /// Returns the conjugate, the inverse rotation of a unit quaternion.
+  [[nodiscard]] constexpr Quaternion conjugate() const noexcept;
+
+  /// Returns \a vector rotated.
+  [[nodiscard]] constexpr Vector3<T> rotate(const Vector3<T> & vector) const noexcept;
+
+  /// Compares the components.
+  [[nodiscard]] constexpr bool operator==(const Quaternion & other) const noexcept = default;
+};
+
+/// Returns the component-wise sum.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> operator+(Vector2<T> left, const Vector2<T> & right) noexcept;
+
+/// Returns the component-wise difference.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> operator-(Vector2<T> left, const Vector2<T> & right) noexcept;
+
+/// Returns the negated vector.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> operator-(const Vector2<T> & vector) noexcept;
+
+/// Returns \a vector scaled by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> operator*(Vector2<T> vector, std::type_identity_t<T> scale) noexcept;
+
+/// Returns \a vector scaled by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> operator*(std::type_identity_t<T> scale, Vector2<T> vector) noexcept;
+
+/// Returns \a vector divided by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> operator/(Vector2<T> vector, std::type_identity_t<T> scale) noexcept;
+
+/// Returns the component-wise sum.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator+(Vector3<T> left, const Vector3<T> & right) noexcept;
+
+/// Returns the component-wise difference.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator-(Vector3<T> left, const Vector3<T> & right) noexcept;
+
+/// Returns the negated vector.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator-(const Vector3<T> & vector) noexcept;
+
+/// Returns \a vector scaled by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator*(Vector3<T> vector, std::type_identity_t<T> scale) noexcept;
+
+/// Returns \a vector scaled by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator*(std::type_identity_t<T> scale, Vector3<T> vector) noexcept;
+
+/// Returns \a vector divided by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator/(Vector3<T> vector, std::type_identity_t<T> scale) noexcept;
+
+/// Returns the product \a left x \a right; the right transform applies first.
+template <typename T>
+[[nodiscard]] constexpr Matrix3<T> operator*(const Matrix3<T> & left, const Matrix3<T> & right) noexcept;
+
+/// Returns \a vector transformed by \a matrix.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> operator*(const Matrix3<T> & matrix, const Vector3<T> & vector) noexcept;
+
+/// Returns the dot product.
+template <typename T>
+[[nodiscard]] constexpr T dot(const Vector2<T> & left, const Vector2<T> & right) noexcept;
+
+/// Returns the dot product.
+template <typename T>
+[[nodiscard]] constexpr T dot(const Vector3<T> & left, const Vector3<T> & right) noexcept;
+
+/// Returns the z component of the cross product: positive when \a right turns counterclockwise from \a left.
+template <typename T>
+[[nodiscard]] constexpr T cross(const Vector2<T> & left, const Vector2<T> & right) noexcept;
+
+/// Returns the cross product.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> cross(const Vector3<T> & left, const Vector3<T> & right) noexcept;
+
+/// Returns the length of \a vector.
+template <typename T>
+[[nodiscard]] constexpr T length(const Vector2<T> & vector) noexcept;
+
+/// Returns the length of \a vector.
+template <typename T>
+[[nodiscard]] constexpr T length(const Vector3<T> & vector) noexcept;
+
+/// Returns \a vector scaled to length 1, or the zero vector unchanged.
+template <typename T>
+[[nodiscard]] constexpr Vector2<T> normalize(const Vector2<T> & vector) noexcept;
+
+/// Returns \a vector scaled to length 1, or the zero vector unchanged.
+template <typename T>
+[[nodiscard]] constexpr Vector3<T> normalize(const Vector3<T> & vector) noexcept;
+
+/// Returns the component-wise sum.
+template <typename T>
+[[nodiscard]] constexpr Vector4<T> operator+(Vector4<T> left, const Vector4<T> & right) noexcept;
+
+/// Returns the component-wise difference.
+template <typename T>
+[[nodiscard]] constexpr Vector4<T> operator-(Vector4<T> left, const Vector4<T> & right) noexcept;
+
+/// Returns \a vector scaled by \a scale.
+template <typename T>
+[[nodiscard]] constexpr Vector4<T> operator*(Vector4<T> vector, std::type_identity_t<T> scale) noexcept;
+
+/// Returns the dot product.
+template <typename T>
+[[nodiscard]] constexpr T dot(const Vector4<T> & left, const Vector4<T> & right) noexcept;
+
+/// Returns the product \a left x \a right; the right transform applies first.
+template <typename T>
+[[nodiscard]] constexpr Matrix4<T> operator*(const Matrix4<T> & left, const Matrix4<T> & right) noexcept;
+
+/// Returns \a vector transformed by \a matrix.
+template <typename T>
+[[nodiscard]] constexpr Vector4<T> operator*(const Matrix4<T> & matrix, const Vector4<T> & vector) noexcept;
+
+/// Returns the Hamilton product: the rotation \a right followed by the rotation \a left.
+template <typename T>
+[[nodiscard]] constexpr Quaternion<T> operator*(const Quaternion<T> & left, const Quaternion<T> & right) noexcept;
+
+/// Returns \a rotation scaled to unit length, or no rotation for the zero quaternion.
+template <typename T>
+[[nodiscard]] constexpr Quaternion<T> normalize(const Quaternion<T> & rotation) noexcept;
+
+/// Two-component vector of engine math
+using Vec2 = Vector2<real>;
+
+/// Three-component vector of engine math
+using Vec3 = Vector3<real>;
+
+/// Four-component vector of engine math
+using Vec4 = Vector4<real>;
+
+/// 2D affine transform of engine math
+using Mat3 = Matrix3<real>;
+
+/// 3D transform of engine math
+using Mat4 = Matrix4<real>;
+
+/// Rotation of engine math
+using Quat = Quaternion<real>;
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_VECTOR_HPP_
@@ -0,0 +1,498 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   vector.inl
+  \brief  Inline definitions for the vectors, matrices, and quaternions.
+
+  The \c float paths on \ref toy::math::Float4 are taken at run time only; constant evaluation uses the generic code,
+  which gives the same results up to the rounding of fused multiply-adds.
+
+  \note Included by math.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_MATH_VECTOR_INL_
+#define INCLUDE_MATH_VECTOR_INL_
+
+namespace toy::math {
+
+namespace simd {
+
+/// Returns the components of \a vector in lane order.
+[[nodiscard]] inline Float4 toFloat4(const Vector4<float> & vector) noexcept {
+  return {vector.x, vector.y, vector.z, vector.w};
+}
+
+/// Returns the components of \a quaternion in lane order: x, y, z, w.
+[[nodiscard]] inline Float4 toFloat4(const Quaternion<float> & quaternion) noexcept {
+  return {quaternion.x, quaternion.y, quaternion.z, quaternion.w};
+}
+
+/// Returns the vector in the lanes of \a value.
+[[nodiscard]] inline Vector4<float> toVector4(Float4 value) noexcept {
+  float lanes[4];
+
+  value.store(lanes);
+
+  return {lanes[0], lanes[1], lanes[2], lanes[3]};
+}
+
+} // namespace simd
+
+template <typename T>
+constexpr Vector2<T> & Vector2<T>::operator+=(const Vector2 & other) noexcept {
+  x += other.x;
+  y += other.y;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector2<T> & Vector2<T>::operator-=(const Vector2 & other) noexcept {
+  x -= other.x;
+  y -= other.y;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector2<T> & Vector2<T>::operator*=(T scale) noexcept {
+  x *= scale;
+  y *= scale;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector2<T> & Vector2<T>::operator/=(T scale) noexcept {
+  x /= scale;
+  y /= scale;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector3<T> & Vector3<T>::operator+=(const Vector3 & other) noexcept {
+  x += other.x;
+  y += other.y;
+  z += other.z;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector3<T> & Vector3<T>::operator-=(const Vector3 & other) noexcept {
+  x -= other.x;
+  y -= other.y;
+  z -= other.z;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector3<T> & Vector3<T>::operator*=(T scale) noexcept {
+  x *= scale;
+  y *= scale;
+  z *= scale;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector3<T> & Vector3<T>::operator/=(T scale) noexcept {
+  x /= scale;
+  y /= scale;
+  z /= scale;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Matrix3<T> Matrix3<T>::identity() noexcept {
+  return {{{{T(1), T(0), T(0)}, {T(0), T(1), T(0)}, {T(0), T(0), T(1)}}}};
+}
+
+template <typename T>
+constexpr Matrix3<T> Matrix3<T>::translation(const Vector2<T> & offset) noexcept {
+  return {{{{T(1), T(0), T(0)}, {T(0), T(1), T(0)}, {offset.x, offset.y, T(1)}}}};
+}
+
+template <typename T>
+constexpr Matrix3<T> Matrix3<T>::rotation(T angle) noexcept {
+  const SinCos<T> turn = sinCos(angle);
+
+  return {{{{turn.cosine, turn.sine, T(0)}, {-turn.sine, turn.cosine, T(0)}, {T(0), T(0), T(1)}}}};
+}
+
+template <typename T>
+constexpr Matrix3<T> Matrix3<T>::scale(const Vector2<T> & factors) noexcept {
+  return {{{{factors.x, T(0), T(0)}, {T(0), factors.y, T(0)}, {T(0), T(0), T(1)}}}};
+}
+
+template <typename T>
+constexpr T Matrix3<T>::at(size_t row, size_t column) const noexcept {
+  const Vector3<T> & values = columns[column];
+
+  return row == 0 ? values.x : (row == 1 ? values.y : values.z);
+}
+
+template <typename T>
+constexpr Vector2<T> Matrix3<T>::transformPoint(const Vector2<T> & point) const noexcept {
+  return {columns[0].x * point.x + columns[1].x * point.y + columns[2].x,
+          columns[0].y * point.x + columns[1].y * point.y + columns[2].y};
+}
+
+template <typename T>
+constexpr Vector2<T> Matrix3<T>::transformVector(const Vector2<T> & direction) const noexcept {
+  return {columns[0].x * direction.x + columns[1].x * direction.y,
+          columns[0].y * direction.x + columns[1].y * direction.y};
+}
+
+template <typename T>
+constexpr Matrix3<T> Matrix3<T>::transposed() const noexcept {
+  return {{{{columns[0].x, columns[1].x, columns[2].x},
+            {columns[0].y, columns[1].y, columns[2].y},
+            {columns[0].z, columns[1].z, columns[2].z}}}};
+}
+
+template <typename T>
+constexpr T Matrix3<T>::determinant() const noexcept {
+  return dot(columns[0], cross(columns[1], columns[2]));
+}
+
+template <typename T>
+constexpr Vector4<T> & Vector4<T>::operator+=(const Vector4 & other) noexcept {
+  x += other.x;
+  y += other.y;
+  z += other.z;
+  w += other.w;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector4<T> & Vector4<T>::operator-=(const Vector4 & other) noexcept {
+  x -= other.x;
+  y -= other.y;
+  z -= other.z;
+  w -= other.w;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Vector4<T> & Vector4<T>::operator*=(T scale) noexcept {
+  x *= scale;
+  y *= scale;
+  z *= scale;
+  w *= scale;
+
+  return *this;
+}
+
+template <typename T>
+constexpr Matrix4<T> Matrix4<T>::identity() noexcept {
+  return {{{{T(1), T(0), T(0), T(0)}, {T(0), T(1), T(0), T(0)}, {T(0), T(0), T(1), T(0)}, {T(0), T(0), T(0), T(1)}}}};
+}
+
+template <typename T>
+constexpr Matrix4<T> Matrix4<T>::translation(const Vector3<T> & offset) noexcept {
+  Matrix4 result = identity();
+
+  result.columns[3] = {offset.x, offset.y, offset.z, T(1)};
+
+  return result;
+}
+
+template <typename T>
+constexpr Matrix4<T> Matrix4<T>::rotation(const Quaternion<T> & rotation) noexcept {
+  const T x = rotation.x;
+  const T y = rotation.y;
+  const T z = rotation.z;
+  const T w = rotation.w;
+
+  return {{{{T(1) - T(2) * (y * y + z * z), T(2) * (x * y + w * z), T(2) * (x * z - w * y), T(0)},
+            {T(2) * (x * y - w * z), T(1) - T(2) * (x * x + z * z), T(2) * (y * z + w * x), T(0)},
+            {T(2) * (x * z + w * y), T(2) * (y * z - w * x), T(1) - T(2) * (x * x + y * y), T(0)},
+            {T(0), T(0), T(0), T(1)}}}};
+}
+
+template <typename T>
+constexpr Matrix4<T> Matrix4<T>::scale(const Vector3<T> & factors) noexcept {
+  Matrix4 result = identity();
+
+  result.columns[0].x = factors.x;
+  result.columns[1].y = factors.y;
+  result.columns[2].z = factors.z;
+
+  return result;
+}
+
+template <typename T>
+constexpr T Matrix4<T>::at(size_t row, size_t column) const noexcept {
+  const Vector4<T> & values = columns[column];
+
+  return row == 0 ? values.x : (row == 1 ? values.y : (row == 2 ? values.z : values.w));
+}
+
+template <typename T>
+constexpr Vector3<T> Matrix4<T>::transformPoint(const Vector3<T> & point) const noexcept {
+  const Vector4<T> result = *this * Vector4<T>{point.x, point.y, point.z, T(1)};
+
+  return {result.x, result.y, result.z};
+}
+
+template <typename T>
+constexpr Vector3<T> Matrix4<T>::transformVector(const Vector3<T> & direction) const noexcept {
+  const Vector4<T> result = *this * Vector4<T>{direction.x, direction.y, direction.z, T(0)};
+
+  return {result.x, result.y, result.z};
+}
+
+template <typename T>
+constexpr Matrix4<T> Matrix4<T>::transposed() const noexcept {
+  Matrix4 result;
+
+  for (size_t row = 0; row < 4; ++row)
+    result.columns[row] = {at(row, 0), at(row, 1), at(row, 2), at(row, 3)};
+
+  return result;
+}
+
+template <typename T>
+constexpr Quaternion<T> Quaternion<T>::fromAxisAngle(const Vector3<T> & axis, T angle) noexcept {
+  const SinCos<T> half = sinCos(angle * T(0.5));
+
+  return {axis.x * half.sine, axis.y * half.sine, axis.z * half.sine, half.cosine};
+}
+
+template <typename T>
+constexpr Quaternion<T> Quaternion<T>::conjugate() const noexcept {
+  return {-x, -y, -z, w};
+}
+
+template <typename T>
+constexpr Vector3<T> Quaternion<T>::rotate(const Vector3<T> & vector) const noexcept {
+  // v + 2w (q x v) + 2 q x (q x v), with q the imaginary part: two cross products instead of two Hamilton products
+  const Vector3<T> axis{x, y, z};
+  const Vector3<T> twice = cross(axis, vector) * T(2);
+
+  return vector + twice * w + cross(axis, twice);
+}
+
+template <typename T>
+constexpr Vector2<T> operator+(Vector2<T> left, const Vector2<T> & right) noexcept {
+  return left += right;
+}
+
+template <typename T>
+constexpr Vector2<T> operator-(Vector2<T> left, const Vector2<T> & right) noexcept {
+  return left -= right;
+}
+
+template <typename T>
+constexpr Vector2<T> operator-(const Vector2<T> & vector) noexcept {
+  return {-vector.x, -vector.y};
+}
+
+template <typename T>
+constexpr Vector2<T> operator*(Vector2<T> vector, std::type_identity_t<T> scale) noexcept {
+  return vector *= scale;
+}
+
+template <typename T>
+constexpr Vector2<T> operator*(std::type_identity_t<T> scale, Vector2<T> vector) noexcept {
+  return vector *= scale;
+}
+
+template <typename T>
+constexpr Vector2<T> operator/(Vector2<T> vector, std::type_identity_t<T> scale) noexcept {
+  return vector /= scale;
+}
+
+template <typename T>
+constexpr Vector3<T> operator+(Vector3<T> left, const Vector3<T> & right) noexcept {
+  return left += right;
+}
+
+template <typename T>
+constexpr Vector3<T> operator-(Vector3<T> left, const Vector3<T> & right) noexcept {
+  return left -= right;
+}
+
+template <typename T>
+constexpr Vector3<T> operator-(const Vector3<T> & vector) noexcept {
+  return {-vector.x, -vector.y, -vector.z};
+}
+
+template <typename T>
+constexpr Vector3<T> operator*(Vector3<T> vector, std::type_identity_t<T> scale) noexcept {
+  return vector *= scale;
+}
+
+template <typename T>
+constexpr Vector3<T> operator*(std::type_identity_t<T> scale, Vector3<T> vector) noexcept {
+  return vector *= scale;
+}
+
+template <typename T>
+constexpr Vector3<T> operator/(Vector3<T> vector, std::type_identity_t<T> scale) noexcept {
+  return vector /= scale;
+}
+
+template <typename T>
+constexpr Matrix3<T> operator*(const Matrix3<T> & left, const Matrix3<T> & right) noexcept {
+  return {{{left * right.columns[0], left * right.columns[1], left * right.columns[2]}}};
+}
+
+template <typename T>
+constexpr Vector3<T> operator*(const Matrix3<T> & matrix, const Vector3<T> & vector) noexcept {
+  return matrix.columns[0] * vector.x + matrix.columns[1] * vector.y + matrix.columns[2] * vector.z;
+}
+
+template <typename T>
+constexpr Vector4<T> operator+(Vector4<T> left, const Vector4<T> & right) noexcept {
+  return left += right;
+}
+
+template <typename T>
+constexpr Vector4<T> operator-(Vector4<T> left, const Vector4<T> & right) noexcept {
+  return left -= right;
+}
+
+template <typename T>
+constexpr Vector4<T> operator*(Vector4<T> vector, std::type_identity_t<T> scale) noexcept {
+  return vector *= scale;
+}
+
+template <typename T>
+constexpr Matrix4<T> operator*(const Matrix4<T> & left, const Matrix4<T> & right) noexcept {
+  return {{{left * right.columns[0], left * right.columns[1], left * right.columns[2], left * right.columns[3]}}};
+}
+
+template <typename T>
+constexpr Vector4<T> operator*(const Matrix4<T> & matrix, const Vector4<T> & vector) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    if !consteval {
+      // Sum of the columns weighted by the components, one register per column
+      const Float4 result = multiplyAdd(
+        simd::toFloat4(matrix.columns[0]), Float4(vector.x),
+        multiplyAdd(simd::toFloat4(matrix.columns[1]), Float4(vector.y),
+                    multiplyAdd(simd::toFloat4(matrix.columns[2]), Float4(vector.z),
+                                simd::toFloat4(matrix.columns[3]) * Float4(vector.w))));
+
+      return simd::toVector4(result);
+    }
+  }
+
+  return matrix.columns[0] * vector.x + matrix.columns[1] * vector.y + matrix.columns[2] * vector.z
+       + matrix.columns[3] * vector.w;
+}
+
+template <typename T>
+constexpr Quaternion<T> operator*(const Quaternion<T> & left, const Quaternion<T> & right) noexcept {
+  if constexpr (std::is_same_v<T, float>) {
+    if !consteval {
+      // left.w * right plus the other three components times sign-flipped permutations of right
+      const Float4 other  = simd::toFloat4(right);
+      const Float4 first  = other.shuffle<3, 2, 1, 0>() * Float4(1.0F, -1.0F, 1.0F, -1.0F);
+      const Float4 second = other.shuffle<2, 3, 0, 1>() * Float4(1.0F, 1.0F, -1.0F, -1.0F);
+      const Float4 third  = other.shuffle<1, 0, 3, 2>() * Float4(-1.0F, 1.0F, 1.0F, -1.0F);
+
+      const Float4 result = multiplyAdd(
+        Float4(left.w), other,
+        multiplyAdd(Float4(left.x), first, multiplyAdd(Float4(left.y), second, Float4(left.z) * third)));
+
+      float lanes[4];
+
+      result.store(lanes);
+
+      return {lanes[0], lanes[1], lanes[2], lanes[3]};
+    }
+  }
+
+  return {left.w * right.x + left.x * right.w + left.y * right.z - left.z * right.y,
+          left.w * right.y - left.x * right.z + left.y * right.w + left.z * right.x,
+          left.w * right.z + left.x * right.y - left.y * right.x + left.z * right.w,
+          left.w * right.w - left.x * right.x - left.y * right.y - left.z * right.z};
+}
+
+template <typename T>
+constexpr Quaternion<T> normalize(const Quaternion<T> & rotation) noexcept {
+  const T size = hypot(hypot(rotation.x, rotation.y), hypot(rotation.z, rotation.w));
+
+  if (size == T(0))
+    return {};
+
+  return {rotation.x / size, rotation.y / size, rotation.z / size, rotation.w / size};
+}
+
+template <typename T>
+constexpr T dot(const Vector2<T> & left, const Vector2<T> & right) noexcept {
+  return left.x * right.x + left.y * right.y;
+}
+
+template <typename T>
+constexpr T dot(const Vector3<T> & left, const Vector3<T> & right) noexcept {
+  return left.x * right.x + left.y * right.y + left.z * right.z;
+}
+
+template <typename T>
+constexpr T dot(const Vector4<T> & left, const Vector4<T> & right) noexcept {
+  return left.x * right.x + left.y * right.y + left.z * right.z + left.w * right.w;
+}
+
+template <typename T>
+constexpr T cross(const Vector2<T> & left, const Vector2<T> & right) noexcept {
+  return left.x * right.y - left.y * right.x;
+}
+
+template <typename T>
+constexpr Vector3<T> cross(const Vector3<T> & left, const Vector3<T> & right) noexcept {
+  return {left.y * right.z - left.z * right.y, left.z * right.x - left.x * right.z,
+          left.x * right.y - left.y * right.x};
+}
+
+template <typename T>
+constexpr T length(const Vector2<T> & vector) noexcept {
+  return hypot(vector.x, vector.y);
+}
+
+template <typename T>
+constexpr T length(const Vector3<T> & vector) noexcept {
+  return hypot(hypot(vector.x, vector.y), vector.z);
+}
+
+template <typename T>
+constexpr Vector2<T> normalize(const Vector2<T> & vector) noexcept {
+  const T size = length(vector);
+
+  return size == T(0) ? vector : vector / size;
+}
+
+template <typename T>
+constexpr Vector3<T> normalize(const Vector3<T> & vector) noexcept {
+  const T size = length(vector);
+
+  return size == T(0) ? vector : vector / size;
+}
+
+} // namespace toy::math
+
+#endif // INCLUDE_MATH_VECTOR_INL_
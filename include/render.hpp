@@ -0,0 +1,44 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   render.hpp
+  \brief  Umbrella header for the engine render module.
+
+  Single public entry point for the render module, in namespace \ref toy::render. It currently re-exports the software
+  renderer: pixel formats and palettes, bitmaps and framebuffers with their presentation to a desktop window, the row
+  kernels, and the sprite and tile layer drawing.
+
+  \note Include this header only; do not include internal headers directly.
+*/
+
+#ifndef INCLUDE_RENDER_HPP_
+#define INCLUDE_RENDER_HPP_
+
+#include "core.hpp"
+#include "math.hpp"
+
+#include "render/framebuffer.hpp"
+#include "render/scanline.hpp"
+#include "render/blitter.hpp"
+
+#include "render/framebuffer.inl"
+#include "render/blitter.inl"
+
+#endif // INCLUDE_RENDER_HPP_
@@ -0,0 +1,175 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   blitter.hpp
+  \brief  Sprite and tile layer drawing into a \ref toy::render::Framebuffer.
+
+  Draws follow the sprite and background hardware of the handhelds: index 0 is transparent, \ref PixelFormat::Indexed4
+  pixels pick a 16-color palette bank, sprites flip on either axis or map through an affine transform, and tile layers
+  scroll and wrap around their maps. Every draw clips to the framebuffer and works a line at a time: it stages the
+  palette indices of one line, then composes them with the row kernels of scanline.hpp. Layers are drawn back to front:
+
+  \code
+  toy::render::drawTileLayer(frame, sky, palette);
+  toy::render::drawTileLayer(frame, level, palette);
+
+  for (const toy::render::Sprite & sprite : sprites)
+    toy::render::drawSprite(frame, sprite, palette);
+  \endcode
+
+  Scanline effects come from per-line scroll offsets: a tile layer shifts each framebuffer line by its entry in
+  \ref toy::render::TileLayer::lineScroll, for water ripples, heat haze, or split-screen scrolling.
+
+  \note Included by render.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_RENDER_BLITTER_HPP_
+#define INCLUDE_RENDER_BLITTER_HPP_
+
+namespace toy::render {
+
+/// One image placed on the framebuffer.
+struct Sprite {
+  /// \ref PixelFormat::Indexed4 or \ref PixelFormat::Indexed8 pixels; index 0 is transparent
+  Bitmap image;
+
+  /// Column of the left edge on the framebuffer; may be off screen
+  int32_t x{0};
+
+  /// Row of the top edge on the framebuffer; may be off screen
+  int32_t y{0};
+
+  /// Palette bank of \ref PixelFormat::Indexed4 pixels; from 0 to 15
+  uint8_t paletteBank{0};
+
+  /// Mirror the image left to right
+  bool flipX{false};
+
+  /// Mirror the image top to bottom
+  bool flipY{false};
+};
+
+/// Fixed-point numbers of \ref AffineTransform
+using AffineScalar = math::Fixed<16, 16>;
+
+/*!
+  \brief Mapping of an affine sprite: from framebuffer pixels back to image texels, as the handhelds map them.
+
+  A pixel \c dx columns and \c dy rows from the center of the sprite shows the texel at
+  <tt>(a * dx + b * dy, c * dx + d * dy)</tt> from the center of the image. The identity draws the image as is, a
+  matrix of halves draws it twice as large. Texels outside the image are transparent.
+*/
+struct AffineTransform {
+  /// Texel columns per pixel to the right
+  AffineScalar a{1};
+
+  /// Texel columns per pixel down
+  AffineScalar b{0};
+
+  /// Texel rows per pixel to the right
+  AffineScalar c{0};
+
+  /// Texel rows per pixel down
+  AffineScalar d{1};
+
+  /// Draw into a box twice the size of the image, so a rotated or enlarged image is not cut off at its corners
+  bool doubleSize{false};
+
+  /*!
+    \brief Returns the transform that scales an image by \a scaleX and \a scaleY, then turns it by \a angle.
+
+    \param angle  Angle in radians; clockwise on the framebuffer, whose rows grow downward.
+    \param scaleX Horizontal scale; not zero.
+    \param scaleY Vertical scale; not zero.
+  */
+  [[nodiscard]] static constexpr AffineTransform rotationScale(AffineScalar angle, AffineScalar scaleX = 1,
+                                                               AffineScalar scaleY = 1) noexcept;
+};
+
+/// Pixels on each side of a tile
+inline constexpr uint32_t c_tileSize = 8;
+
+/// Bits of a tile map entry holding the tile number
+inline constexpr uint16_t c_tileNumberMask = 0x03FF;
+
+/// Bit of a tile map entry mirroring the tile left to right
+inline constexpr uint16_t c_tileFlipX = 0x0400;
+
+/// Bit of a tile map entry mirroring the tile top to bottom
+inline constexpr uint16_t c_tileFlipY = 0x0800;
+
+/// Shift of the palette bank of \ref PixelFormat::Indexed4 tiles in a tile map entry, which takes the top 4 bits
+inline constexpr uint16_t c_tileBankShift = 12;
+
+/// Returns the tile map entry showing tile \a number, mirrored as asked, in palette bank \a bank.
+[[nodiscard]] constexpr uint16_t tileEntry(uint16_t number, bool flipX = false, bool flipY = false,
+                                           uint8_t bank = 0) noexcept;
+
+/*!
+  \brief Background of tiles, laid out by a map, as the text backgrounds of the handhelds.
+
+  The map is \ref columns by \ref rows entries built by tileEntry(), and the layer repeats in both directions.
+  Entries naming a tile past the end of \ref tiles draw nothing.
+*/
+struct TileLayer {
+  /// Tile pixels, one \ref c_tileSize square tile after another, row by row within each tile
+  span<const std::byte> tiles;
+
+  /// \ref PixelFormat::Indexed4, 4 bytes per tile row, or \ref PixelFormat::Indexed8, 8 bytes per tile row
+  PixelFormat format{PixelFormat::Indexed8};
+
+  /// Map entries, row by row
+  span<const uint16_t> map;
+
+  /// Map entries in a row
+  uint32_t columns{0};
+
+  /// Map rows
+  uint32_t rows{0};
+
+  /// Layer column at the left edge of the framebuffer
+  int32_t scrollX{0};
+
+  /// Layer row at the top edge of the framebuffer
+  int32_t scrollY{0};
+
+  /// Offsets added to \ref scrollX on each framebuffer line, from the top; lines past the end are not shifted
+  span<const int16_t> lineScroll;
+};
+
+/// Draws \a sprite into \a target; indices of \ref PixelFormat::Rgb565 targets are colored through \a palette.
+void drawSprite(const Framebuffer & target, const Sprite & sprite, const Palette & palette) noexcept;
+
+/*!
+  \brief Draws \a sprite through \a transform into \a target.
+
+  The sprite fills a box the size of its image, or twice that with \ref AffineTransform::doubleSize, whose top-left
+  corner is at \ref Sprite::x and \ref Sprite::y. \ref Sprite::flipX and \ref Sprite::flipY are ignored; negative
+  scales mirror instead.
+*/
+void drawAffineSprite(const Framebuffer & target, const Sprite & sprite, const AffineTransform & transform,
+                      const Palette & palette) noexcept;
+
+/// Draws \a layer over the whole of \a target; indices of \ref PixelFormat::Rgb565 targets are colored by \a palette.
+void drawTileLayer(const Framebuffer & target, const TileLayer & layer, const Palette & palette) noexcept;
+
+} // namespace toy::render
+
+#endif // INCLUDE_RENDER_BLITTER_HPP_
@@ -0,0 +1,47 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   blitter.inl
+  \brief  Inline definitions for sprites, affine transforms, and tile layers.
+
+  \note Included by render.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_RENDER_BLITTER_INL_
+#define INCLUDE_RENDER_BLITTER_INL_
+
+namespace toy::render {
+
+constexpr AffineTransform AffineTransform::rotationScale(AffineScalar angle, AffineScalar scaleX,
+                                                         AffineScalar scaleY) noexcept {
+  // Inverse of the rotation after the scale: texels step by the turned-back pixel step, divided by each scale
+  const auto turn = math::sinCos(angle);
+
+  return {turn.cosine / scaleX, turn.sine / scaleX, -turn.sine / scaleY, turn.cosine / scaleY, false};
+}
+
+constexpr uint16_t tileEntry(uint16_t number, bool flipX, bool flipY, uint8_t bank) noexcept {
+  return static_cast<uint16_t>((number & c_tileNumberMask) | (flipX ? c_tileFlipX : 0) | (flipY ? c_tileFlipY : 0)
+                               | ((bank & 0x0F) << c_tileBankShift));
+}
+
+} // namespace toy::render
+
+#endif // INCLUDE_RENDER_BLITTER_INL_
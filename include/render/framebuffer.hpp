@@ -0,0 +1,225 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   framebuffer.hpp
+  \brief  Pixel formats, palettes, and the bitmaps and framebuffers the software renderer reads and draws into.
+
+  Declares \ref toy::render::Bitmap, a read-only view of sprite or tile pixels, and
+  \ref toy::render::Framebuffer, the view a frame is drawn into. Neither owns its pixels: they may sit in a vector on
+  desktop, or in video RAM and cartridge ROM on the handhelds. present() converts a finished frame to the 32-bit pixels
+  a desktop window shows, scaled up by a whole factor.
+
+  \note Included by render.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_RENDER_FRAMEBUFFER_HPP_
+#define INCLUDE_RENDER_FRAMEBUFFER_HPP_
+
+/*!
+  \namespace toy::render
+
+  \brief Software renderer: palette-indexed and 16-bit framebuffers, sprites, and tile layers.
+
+  Frames are drawn on the CPU in the pixel formats of the handhelds, a line at a time, with integer arithmetic only.
+  Every target therefore produces the same pixels; desktop builds run the line loops on vector registers and scale the
+  result up for the window.
+*/
+namespace toy::render {
+
+/// Layout of the pixels of a \ref Bitmap or a \ref Framebuffer.
+enum class PixelFormat : uint8_t {
+  Indexed4, ///< Two palette indices per byte, the left pixel in the low nibble; bitmaps only
+  Indexed8, ///< One palette index per byte
+  Rgb565,   ///< One 16-bit color per pixel: 5 bits of red at the top, then 6 of green and 5 of blue
+};
+
+/// Colors in a \ref Palette
+inline constexpr size_t c_paletteSize = 256;
+
+/// Colors in one bank of a palette, the colors an \ref PixelFormat::Indexed4 pixel picks from
+inline constexpr size_t c_paletteBankSize = 16;
+
+/// Widest framebuffer the renderer draws into; each line is staged in buffers of this many pixels
+inline constexpr uint32_t c_maxWidth = 1024;
+
+/// Returns the bytes of a row of \a width pixels in \a format, without padding.
+[[nodiscard]] constexpr size_t rowSize(PixelFormat format, uint32_t width) noexcept;
+
+/// Returns the RGB565 color of 8-bit \a red, \a green, and \a blue; the low bits of each channel are dropped.
+[[nodiscard]] constexpr uint16_t rgb565(uint8_t red, uint8_t green, uint8_t blue) noexcept;
+
+/*!
+  \brief Returns \a color as an opaque 0xAARRGGBB pixel.
+
+  Each channel is widened by repeating its top bits below it, so black stays 0 and white becomes 255.
+*/
+[[nodiscard]] constexpr uint32_t argb8888(uint16_t color) noexcept;
+
+/*!
+  \brief Colors of the palette indices, in RGB565.
+
+  Index 0 of a framebuffer is the backdrop. Sprites and tiles never draw index 0, or the first color of a bank for
+  \ref PixelFormat::Indexed4 pixels: those pixels are transparent.
+*/
+struct Palette {
+  /// Color of each index
+  array<uint16_t, c_paletteSize> colors{};
+};
+
+/// Read-only view of pixels: a sprite image, or any other picture drawn from.
+class Bitmap {
+public:
+  /// Constructs a view of no pixels.
+  constexpr Bitmap() noexcept = default;
+
+  /*!
+    \brief Views \a width by \a height pixels of \a format at \a pixels.
+
+    \param pixels Top-left pixel; rows start at a byte.
+    \param width  Pixels in a row.
+    \param height Rows.
+    \param format Layout of the pixels.
+    \param stride Bytes from one row to the next; 0 for rows without padding.
+  */
+  Bitmap(const void * pixels, uint32_t width, uint32_t height, PixelFormat format, size_t stride = 0) noexcept;
+
+  /// Returns whether the view has pixels, and rows at least as long as \ref rowSize().
+  [[nodiscard]] constexpr bool isValid() const noexcept;
+
+  /// Returns the pixels in a row.
+  [[nodiscard]] constexpr uint32_t width() const noexcept;
+
+  /// Returns the rows.
+  [[nodiscard]] constexpr uint32_t height() const noexcept;
+
+  /// Returns the layout of the pixels.
+  [[nodiscard]] constexpr PixelFormat format() const noexcept;
+
+  /// Returns the bytes from one row to the next.
+  [[nodiscard]] constexpr size_t stride() const noexcept;
+
+  /// Returns the first byte of row \a y.
+  [[nodiscard]] constexpr const std::byte * row(uint32_t y) const noexcept;
+
+private:
+  /// Top-left pixel
+  const std::byte * _pixels{nullptr};
+
+  /// Bytes from one row to the next
+  size_t _stride{0};
+
+  /// Pixels in a row
+  uint32_t _width{0};
+
+  /// Rows
+  uint32_t _height{0};
+
+  /// Layout of the pixels
+  PixelFormat _format{PixelFormat::Indexed8};
+};
+
+/*!
+  \brief Writable view of the pixels a frame is drawn into.
+
+  \ref PixelFormat::Indexed8 frames hold palette indices and are colored when presented, so palette effects cost
+  nothing; \ref PixelFormat::Rgb565 frames are colored as they are drawn. Frames are at most \ref c_maxWidth pixels
+  wide. As with a span, a \c const view still writes to its pixels, so draws take it by \c const reference.
+*/
+class Framebuffer {
+public:
+  /// Constructs a view of no pixels.
+  constexpr Framebuffer() noexcept = default;
+
+  /*!
+    \brief Views \a width by \a height pixels of \a format at \a pixels.
+
+    \param pixels Top-left pixel; rows of \ref PixelFormat::Rgb565 start at an even address.
+    \param width  Pixels in a row; at most \ref c_maxWidth.
+    \param height Rows.
+    \param format \ref PixelFormat::Indexed8 or \ref PixelFormat::Rgb565.
+    \param stride Bytes from one row to the next; 0 for rows without padding.
+  */
+  Framebuffer(void * pixels, uint32_t width, uint32_t height, PixelFormat format, size_t stride = 0) noexcept;
+
+  /// Returns whether the view has pixels in a format it can be drawn into, no wider than \ref c_maxWidth.
+  [[nodiscard]] constexpr bool isValid() const noexcept;
+
+  /// Returns the pixels in a row.
+  [[nodiscard]] constexpr uint32_t width() const noexcept;
+
+  /// Returns the rows.
+  [[nodiscard]] constexpr uint32_t height() const noexcept;
+
+  /// Returns the layout of the pixels.
+  [[nodiscard]] constexpr PixelFormat format() const noexcept;
+
+  /// Returns the bytes from one row to the next.
+  [[nodiscard]] constexpr size_t stride() const noexcept;
+
+  /// Returns the first byte of row \a y.
+  [[nodiscard]] constexpr std::byte * row(uint32_t y) const noexcept;
+
+  /// Returns a read-only view of the same pixels.
+  [[nodiscard]] Bitmap bitmap() const noexcept;
+
+  /// Sets every pixel to \a value: a palette index, or an RGB565 color.
+  void clear(uint16_t value) const noexcept;
+
+  /*!
+    \brief Returns a hash of the pixels, row by row, without the padding between rows.
+
+    Equal frames hash equally on every target, whatever their strides, so headless tests compare frames by hash.
+  */
+  [[nodiscard]] uint64_t hash() const noexcept;
+
+private:
+  /// Top-left pixel
+  std::byte * _pixels{nullptr};
+
+  /// Bytes from one row to the next
+  size_t _stride{0};
+
+  /// Pixels in a row
+  uint32_t _width{0};
+
+  /// Rows
+  uint32_t _height{0};
+
+  /// Layout of the pixels
+  PixelFormat _format{PixelFormat::Indexed8};
+};
+
+/*!
+  \brief Converts \a source to opaque 0xAARRGGBB pixels, each pixel scaled up to a square of \a scale pixels a side.
+
+  \param source  Frame to show; \ref PixelFormat::Indexed8 frames are colored through \a palette.
+  \param palette Colors of the indices; unused for \ref PixelFormat::Rgb565 frames.
+  \param output  Receives <tt>width * scale</tt> by <tt>height * scale</tt> pixels.
+  \param stride  Pixels from one row of \a output to the next; at least <tt>width * scale</tt>.
+  \param scale   Whole scale factor; 1 or more.
+
+  \return Whether \a source was presented; \c false when it is not valid, \a scale is 0, or \a output is too small.
+*/
+bool present(const Framebuffer & source, const Palette & palette, span<uint32_t> output, size_t stride,
+             uint32_t scale) noexcept;
+
+} // namespace toy::render
+
+#endif // INCLUDE_RENDER_FRAMEBUFFER_HPP_
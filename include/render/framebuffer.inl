@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   framebuffer.inl
+  \brief  Inline definitions for pixel formats, bitmaps, and framebuffers.
+
+  \note Included by render.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_RENDER_FRAMEBUFFER_INL_
+#define INCLUDE_RENDER_FRAMEBUFFER_INL_
+
+namespace toy::render {
+
+constexpr size_t rowSize(PixelFormat format, uint32_t width) noexcept {
+  switch (format) {
+    case PixelFormat::Indexed4:
+      return (size_t{width} + 1) / 2;
+
+    case PixelFormat::Indexed8:
+      return width;
+
+    default:
+      return size_t{width} * 2;
+  }
+}
+
+constexpr uint16_t rgb565(uint8_t red, uint8_t green, uint8_t blue) noexcept {
+  return static_cast<uint16_t>(((red >> 3) << 11) | ((green >> 2) << 5) | (blue >> 3));
+}
+
+constexpr uint32_t argb8888(uint16_t color) noexcept {
+  const uint32_t red   = (color >> 11) & 0x1F;
+  const uint32_t green = (color >> 5) & 0x3F;
+  const uint32_t blue  = color & 0x1F;
+
+  return 0xFF000000U | (((red << 3) | (red >> 2)) << 16) | (((green << 2) | (green >> 4)) << 8)
+       | ((blue << 3) | (blue >> 2));
+}
+
+inline Bitmap::Bitmap(const void * pixels, uint32_t width, uint32_t height, PixelFormat format, size_t stride) noexcept
+  : _pixels(static_cast<const std::byte *>(pixels))
+  , _stride(stride != 0 ? stride : rowSize(format, width))
+  , _width(width)
+  , _height(height)
+  , _format(format) {}
+
+constexpr bool Bitmap::isValid() const noexcept {
+  return _pixels != nullptr && _width != 0 && _height != 0 && _stride >= rowSize(_format, _width);
+}
+
+constexpr uint32_t Bitmap::width() const noexcept {
+  return _width;
+}
+
+constexpr uint32_t Bitmap::height() const noexcept {
+  return _height;
+}
+
+constexpr PixelFormat Bitmap::format() const noexcept {
+  return _format;
+}
+
+constexpr size_t Bitmap::stride() const noexcept {
+  return _stride;
+}
+
+constexpr const std::byte * Bitmap::row(uint32_t y) const noexcept {
+  return _pixels + y * _stride;
+}
+
+inline Framebuffer::Framebuffer(void * pixels, uint32_t width, uint32_t height, PixelFormat format,
+                                size_t stride) noexcept
+  : _pixels(static_cast<std::byte *>(pixels))
+  , _stride(stride != 0 ? stride : rowSize(format, width))
+  , _width(width)
+  , _height(height)
+  , _format(format) {}
+
+constexpr bool Framebuffer::isValid() const noexcept {
+  return _pixels != nullptr && _width != 0 && _width <= c_maxWidth && _height != 0
+      && _format != PixelFormat::Indexed4 && _stride >= rowSize(_format, _width);
+}
+
+constexpr uint32_t Framebuffer::width() const noexcept {
+  return _width;
+}
+
+constexpr uint32_t Framebuffer::height() const noexcept {
+  return _height;
+}
+
+constexpr PixelFormat Framebuffer::format() const noexcept {
+  return _format;
+}
+
+constexpr size_t Framebuffer::stride() const noexcept {
+  return _stride;
+}
+
+constexpr std::byte * Framebuffer::row(uint32_t y) const noexcept {
+  return _pixels + y * _stride;
+}
+
+inline Bitmap Framebuffer::bitmap() const noexcept {
+  return Bitmap(_pixels, _width, _height, _format, _stride);
+}
+
+} // namespace toy::render
+
+#endif // INCLUDE_RENDER_FRAMEBUFFER_INL_
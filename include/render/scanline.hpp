@@ -0,0 +1,107 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   scanline.hpp
+  \brief  Row kernels of the software renderer: composing, unpacking, and expanding one line of pixels.
+
+  Every draw and present() reduces to these loops over a line. Desktop builds run them on SSE2, AVX2, or NEON
+  registers; the handhelds run the \ref toy::render::scalar routines. Both give the same pixels, so frames drawn on
+  desktop match the handhelds bit for bit. Draws stage a line of palette indices in which 0 is transparent, then
+  compose it into the framebuffer:
+
+  \code
+  // line holds the sprite pixels of one row, 0 where the sprite is transparent
+  toy::render::composeIndexed8(line, width, frameRow);
+  \endcode
+
+  Source and destination may not overlap.
+
+  \note Included by render.hpp only; do not include this file directly.
+*/
+
+#ifndef INCLUDE_RENDER_SCANLINE_HPP_
+#define INCLUDE_RENDER_SCANLINE_HPP_
+
+namespace toy::render {
+
+/// Writes the nonzero indices of the \a count at \a source over the indices at \a destination.
+void composeIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept;
+
+/// Writes the \a colors of the nonzero indices of the \a count at \a source over the colors at \a destination.
+void composeRgb565(const uint8_t * source, size_t count, const uint16_t * colors, uint16_t * destination) noexcept;
+
+/*!
+  \brief Unpacks \a count \ref PixelFormat::Indexed4 pixels to one index per byte.
+
+  \param source      Packed pixels, starting with the low nibble of the first byte.
+  \param count       Pixels to unpack.
+  \param bank        Palette bank: a nonzero pixel \c p becomes <tt>bank * 16 + p</tt>; pixel 0 stays 0, transparent.
+  \param destination Receives \a count indices.
+*/
+void unpackIndexed4(const uint8_t * source, size_t count, uint8_t bank, uint8_t * destination) noexcept;
+
+/// Writes the \a count indices at \a source to \a destination in reverse order, for pixels flipped horizontally.
+void reverseIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept;
+
+/// Writes the 32-bit \a colors of the \a count indices at \a source to \a destination.
+void expandIndexed8(const uint8_t * source, size_t count, const uint32_t * colors, uint32_t * destination) noexcept;
+
+/// Writes the \a count RGB565 colors at \a source to \a destination as argb8888() pixels.
+void expandRgb565(const uint16_t * source, size_t count, uint32_t * destination) noexcept;
+
+/// Writes each of the \a count pixels at \a source \a scale times in a row to \a destination; \a scale is 1 or more.
+void scaleRow(const uint32_t * source, size_t count, uint32_t scale, uint32_t * destination) noexcept;
+
+/*!
+  \namespace toy::render::scalar
+
+  \brief Portable reference implementations of the row kernels.
+
+  Each function here has the same contract as its counterpart in \ref toy::render and handles one pixel per step. The
+  handhelds run these; desktop builds keep them for the tails of the vector loops, tests, and benchmarks.
+*/
+namespace scalar {
+
+/// Pixel-at-a-time composeIndexed8(); same contract
+void composeIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept;
+
+/// Pixel-at-a-time composeRgb565(); same contract
+void composeRgb565(const uint8_t * source, size_t count, const uint16_t * colors, uint16_t * destination) noexcept;
+
+/// Pixel-at-a-time unpackIndexed4(); same contract
+void unpackIndexed4(const uint8_t * source, size_t count, uint8_t bank, uint8_t * destination) noexcept;
+
+/// Pixel-at-a-time reverseIndexed8(); same contract
+void reverseIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept;
+
+/// Pixel-at-a-time expandIndexed8(); same contract
+void expandIndexed8(const uint8_t * source, size_t count, const uint32_t * colors, uint32_t * destination) noexcept;
+
+/// Pixel-at-a-time expandRgb565(); same contract
+void expandRgb565(const uint16_t * source, size_t count, uint32_t * destination) noexcept;
+
+/// Pixel-at-a-time scaleRow(); same contract
+void scaleRow(const uint32_t * source, size_t count, uint32_t scale, uint32_t * destination) noexcept;
+
+} // namespace scalar
+
+} // namespace toy::render
+
+#endif // INCLUDE_RENDER_SCANLINE_HPP_
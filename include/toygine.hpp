@@ -21,9 +21,9 @@
   \file   toygine.hpp
   \brief  Main umbrella header for the engine.
 
-  Root entry point that re-exports every engine module. It currently pulls in core.hpp; the remaining modules
-  (application, audio, filesystem, game, geometry, math, network, platform/ui, render) are re-exported here as they
-  land.
+  Root entry point that re-exports every engine module. It currently pulls in core.hpp, math.hpp, filesystem.hpp, and
+  render.hpp; the remaining modules (application, audio, game, geometry, network, platform/ui) are re-exported here as
+  they land.
 
   \note Prefer a specific module header when only one module is needed.
 */
@@ -32,5 +32,8 @@
 #define INCLUDE_TOYGINE_HPP_
 
 #include "core.hpp"
+#include "math.hpp"
+#include "filesystem.hpp"
+#include "render.hpp"
 
 #endif // INCLUDE_TOYGINE_HPP_
@@ -0,0 +1,71 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   allocator.cpp
+  \brief  Construction, rewinding, and frame switching of the linear and frame allocators.
+*/
+
+#include "core.hpp"
+
+namespace toy {
+
+namespace {
+
+#ifdef _DEBUG
+/// Byte written over memory a linear allocator gives back
+constexpr uint8_t c_poisonByte = 0xCD;
+#endif // _DEBUG
+
+} // namespace
+
+LinearAllocator::LinearAllocator(void * buffer, size_t capacity) noexcept
+  : _buffer(static_cast<std::byte *>(buffer))
+  , _capacity(buffer != nullptr ? capacity : 0) {}
+
+void LinearAllocator::rewind(Marker marker) noexcept {
+  if (marker >= _offset)
+    return;
+
+  const size_t released = _offset;
+  _offset               = marker;
+  poison(released);
+}
+
+void LinearAllocator::reset() noexcept {
+  rewind(0);
+}
+
+void LinearAllocator::poison([[maybe_unused]] size_t end) noexcept {
+#ifdef _DEBUG
+  std::memset(_buffer + _offset, c_poisonByte, end - _offset);
+#endif // _DEBUG
+}
+
+FrameAllocator::FrameAllocator(void * buffer, size_t capacity) noexcept
+  : _frames{LinearAllocator(buffer, capacity / 2),
+            LinearAllocator(buffer != nullptr ? static_cast<std::byte *>(buffer) + capacity / 2 : nullptr,
+                            capacity - capacity / 2)} {}
+
+void FrameAllocator::beginFrame() noexcept {
+  _current ^= 1;
+  _frames[_current].reset();
+}
+
+} // namespace toy
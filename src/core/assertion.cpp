@@ -0,0 +1,137 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   assertion.cpp
+  \brief  Assertion handler registration, failure formatting, and per-call-site repeat filtering.
+
+  The failure description is built with formatTo() in a static buffer: reporting never touches the heap, so it keeps
+  working after an allocation failure. One flag guards the buffer; a failure raised while it is taken, by the handler
+  or by another thread, is dropped rather than waited for. The stack of the failing call site is captured as raw
+  addresses and resolved by walkStack() in stack_trace.cpp.
+*/
+
+#include "core.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#elif defined(__unix__) || defined(__APPLE__)
+#include <csignal>
+#endif
+
+namespace toy::assertion {
+
+namespace {
+
+/// Longest failure description; longer ones are truncated
+constexpr size_t c_descriptionSize = 1024;
+
+/// Registered failure handler
+AssertionCallback s_assertionCallback = nullptr;
+
+/// Registered stack-frame handler
+StackWalkCallback s_stackWalkCallback = nullptr;
+
+#ifdef _DEBUG
+
+/// Description passed to the failure handler
+char s_description[c_descriptionSize];
+
+/// Set while s_description is in use
+std::atomic_flag s_reporting;
+
+#endif // _DEBUG
+
+} // namespace
+
+void initialize() noexcept {
+  s_assertionCallback = nullptr;
+  s_stackWalkCallback = nullptr;
+}
+
+void deInitialize() noexcept {
+  s_assertionCallback = nullptr;
+  s_stackWalkCallback = nullptr;
+}
+
+void setCallbacks(AssertionCallback assertionCallback, StackWalkCallback stackWalkCallback) noexcept {
+  s_assertionCallback = assertionCallback;
+  s_stackWalkCallback = stackWalkCallback;
+}
+
+uint32_t CallSite::fail() noexcept {
+  const uint32_t failures = _failures.fetch_add(1, std::memory_order_relaxed) + 1;
+
+  if (_repeat == Repeat::Once)
+    return failures == 1 ? failures : 0;
+
+  return std::has_single_bit(failures) ? failures : 0;
+}
+
+uint32_t CallSite::failures() const noexcept {
+  return _failures.load(std::memory_order_relaxed);
+}
+
+#ifdef _DEBUG
+
+bool assertion(const char * code, const char * message, const char * fileName, const char * functionName,
+               size_t lineNumber, uint32_t failures) noexcept {
+  const AssertionCallback callback = s_assertionCallback;
+
+  if (callback == nullptr || s_reporting.test_and_set(std::memory_order_acquire))
+    return true;
+
+  // One character stays free for the terminator
+  size_t size = formatTo(s_description, c_descriptionSize - 1, "{}({}): assertion '{}' failed in {}", fileName,
+                         lineNumber, code, functionName);
+
+  if (message != nullptr && *message != '\0' && size < c_descriptionSize - 1)
+    size += formatTo(s_description + size, c_descriptionSize - 1 - size, ": {}", message);
+
+  if (failures > 1 && size < c_descriptionSize - 1)
+    size += formatTo(s_description + size, c_descriptionSize - 1 - size, " (failed {} times)", failures);
+
+  s_description[size < c_descriptionSize - 1 ? size : c_descriptionSize - 1] = '\0';
+
+  // Frames are taken before the handler runs, so its own calls cannot disturb them
+  uintptr_t    frames[c_maxStackFrames];
+  const size_t frameCount = s_stackWalkCallback != nullptr ? captureStack(frames, c_maxStackFrames, 1) : 0;
+
+  const bool handled = callback(s_description);
+
+  walkStack(frames, frameCount, s_stackWalkCallback);
+
+  s_reporting.clear(std::memory_order_release);
+
+  return handled;
+}
+
+#endif // _DEBUG
+
+void debugBreak() noexcept {
+#if defined(_MSC_VER)
+  __debugbreak();
+#elif defined(__unix__) || defined(__APPLE__)
+  std::raise(SIGTRAP);
+#else
+  __builtin_trap();
+#endif
+}
+
+} // namespace toy::assertion
@@ -0,0 +1,260 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   chrono.cpp
+  \brief  Clock calibration, the platform timer, and the frame pacer.
+*/
+
+#include "core.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#ifdef TOYGINE_CHRONO_TSC
+#include <cpuid.h>
+#endif // TOYGINE_CHRONO_TSC
+
+#if defined(__linux__)
+#include <time.h>
+#endif // __linux__
+
+namespace toy::chrono {
+
+namespace {
+
+/// Serializes calibrate()
+std::mutex s_calibrationMutex;
+
+/// Remaining wait below which FramePacer spins instead of sleeping
+constexpr uint64_t c_spinTime = 2 * c_nanosecondsPerMillisecond;
+
+/// Reads the monotonic timer of the platform, in nanoseconds.
+uint64_t monotonicTime() noexcept {
+#if defined(__linux__)
+  timespec time{};
+  clock_gettime(CLOCK_MONOTONIC, &time);
+
+  return static_cast<uint64_t>(time.tv_sec) * c_nanosecondsPerSecond + static_cast<uint64_t>(time.tv_nsec);
+#else
+  const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+#endif // __linux__
+}
+
+#ifdef TOYGINE_CHRONO_TSC
+
+/// Pair of counter and timer readings taken at the same moment.
+struct ClockSample {
+  /// Counter value
+  uint64_t ticks;
+
+  /// Monotonic time, in nanoseconds
+  uint64_t time;
+};
+
+/// Returns whether the counter runs at a constant rate through frequency changes and deep sleep states.
+bool hasInvariantTsc() noexcept {
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+
+  if (__get_cpuid_max(0x80000000U, nullptr) < 0x80000007U)
+    return false;
+
+  __cpuid(0x80000007U, eax, ebx, ecx, edx);
+
+  return (edx & (1U << 8)) != 0;
+}
+
+/// Reads the timer between two counter readings and keeps the tightest of a few tries, pairing the timer with the
+/// midpoint of its counter readings.
+ClockSample sampleClocks() noexcept {
+  ClockSample best{};
+  uint64_t    bestSpread = ~uint64_t{0};
+
+  for (int attempt = 0; attempt < 5; ++attempt) {
+    const uint64_t before = __builtin_ia32_rdtsc();
+    const uint64_t time   = monotonicTime();
+    const uint64_t after  = __builtin_ia32_rdtsc();
+
+    if (after - before < bestSpread) {
+      bestSpread = after - before;
+      best       = {before + (after - before) / 2, time};
+    }
+  }
+
+  return best;
+}
+
+#endif // TOYGINE_CHRONO_TSC
+
+/// Blocks until now() reaches \a deadline.
+void waitUntil(uint64_t deadline) noexcept {
+  for (uint64_t current = now(); current < deadline; current = now()) {
+    if (deadline - current > c_spinTime)
+      std::this_thread::sleep_for(std::chrono::nanoseconds(deadline - current - c_spinTime));
+    else
+      std::this_thread::yield();
+  }
+}
+
+} // namespace
+
+uint64_t platformNow() noexcept {
+  if (g_timeBase.source.load(std::memory_order_acquire) == ClockSource::Uncalibrated) [[unlikely]] {
+    if (calibrate() == ClockSource::Tsc)
+      return now();
+  }
+
+  return monotonicTime();
+}
+
+ClockSource calibrate() noexcept {
+  const std::lock_guard lock(s_calibrationMutex);
+  ClockSource           source = g_timeBase.source.load(std::memory_order_relaxed);
+
+  if (source != ClockSource::Uncalibrated)
+    return source;
+
+  source = ClockSource::Platform;
+
+#ifdef TOYGINE_CHRONO_TSC
+  if (hasInvariantTsc()) {
+    const ClockSample start = sampleClocks();
+    ClockSample       end   = start;
+
+    while (end.time - start.time < c_calibrationTime)
+      end = sampleClocks();
+
+    const uint64_t ticks = end.ticks - start.ticks;
+    const uint64_t time  = end.time - start.time;
+
+    if (ticks != 0) {
+      g_timeBase.originTicks = end.ticks;
+      g_timeBase.originTime  = end.time;
+      g_timeBase.scale       = (time << 32) / ticks;
+      g_timeBase.frequency   = ticks * c_nanosecondsPerSecond / time;
+      source                 = ClockSource::Tsc;
+    }
+  }
+#endif // TOYGINE_CHRONO_TSC
+
+  g_timeBase.source.store(source, std::memory_order_release);
+
+  return source;
+}
+
+ClockSource clockSource() noexcept {
+  return g_timeBase.source.load(std::memory_order_acquire);
+}
+
+uint64_t tickFrequency() noexcept {
+  return clockSource() == ClockSource::Tsc ? g_timeBase.frequency : 0;
+}
+
+FramePacer::FramePacer(uint64_t targetFrameTime) noexcept
+  : _target(targetFrameTime)
+  , _frameStart(now())
+  , _deadline(_frameStart + targetFrameTime) {}
+
+uint64_t FramePacer::endFrame() noexcept {
+  uint64_t current = now();
+
+  if (_target != 0) {
+    if (current < _deadline) {
+      waitUntil(_deadline);
+      current = now();
+    }
+
+    // Keep the cadence after a small overshoot; restart it after a long frame instead of rushing the next ones
+    _deadline = current - _deadline < _target ? _deadline + _target : current + _target;
+  }
+
+  const uint64_t frameTime = current - _frameStart;
+  _frameStart              = current;
+  record(frameTime);
+
+  return frameTime;
+}
+
+void FramePacer::record(uint64_t frameTime) noexcept {
+  _history[_next] = frameTime;
+  _next           = (_next + 1) % c_frameHistorySize;
+  _count          = _count < c_frameHistorySize ? _count + 1 : c_frameHistorySize;
+}
+
+uint64_t FramePacer::percentile(uint32_t percent) const noexcept {
+  array<uint64_t, c_frameHistorySize> sorted;
+  const size_t                        count = sortedHistory(sorted);
+
+  if (count == 0)
+    return 0;
+
+  // Nearest rank: the smallest time at least percent% of the frames do not exceed
+  const size_t rank = (static_cast<size_t>(percent < 100 ? percent : 100) * count + 99) / 100;
+
+  return sorted[rank != 0 ? rank - 1 : 0];
+}
+
+FrameStatistics FramePacer::statistics() const noexcept {
+  array<uint64_t, c_frameHistorySize> sorted;
+  const size_t                        count = sortedHistory(sorted);
+
+  if (count == 0)
+    return {};
+
+  const auto rank = [count](size_t percent) { return (percent * count + 99) / 100 - 1; };
+
+  uint64_t total = 0;
+
+  for (size_t index = 0; index < count; ++index)
+    total += sorted[index];
+
+  return {count, total / count, sorted[0], sorted[rank(50)], sorted[rank(90)], sorted[rank(99)], sorted[count - 1]};
+}
+
+uint64_t FramePacer::targetFrameTime() const noexcept {
+  return _target;
+}
+
+void FramePacer::setTargetFrameTime(uint64_t targetFrameTime) noexcept {
+  _target   = targetFrameTime;
+  _deadline = _frameStart + targetFrameTime;
+}
+
+void FramePacer::reset() noexcept {
+  _count      = 0;
+  _next       = 0;
+  _frameStart = now();
+  _deadline   = _frameStart + _target;
+}
+
+size_t FramePacer::sortedHistory(array<uint64_t, c_frameHistorySize> & sorted) const noexcept {
+  std::copy_n(_history.begin(), _count, sorted.begin());
+  std::sort(sorted.begin(), sorted.begin() + static_cast<std::ptrdiff_t>(_count));
+
+  return _count;
+}
+
+} // namespace toy::chrono
@@ -0,0 +1,329 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   format.cpp
+  \brief  Runtime formatting engine behind formatTo() and format().
+
+  Walks a format string that FormatString already checked, so it skips every validity test, and writes each field
+  through a bounded output that counts what does not fit. Numbers go through toChars(), which neither allocates nor
+  reads the locale.
+*/
+
+#include "core.hpp"
+
+namespace toy::formatting {
+
+namespace {
+
+/// Characters a formatted double can take in the widest notation with the largest precision
+constexpr size_t c_floatBufferSize = maxFloatChars(FloatFormat::Fixed, c_maxFloatPrecision);
+
+/// Output buffer that drops characters past its capacity but keeps counting them.
+class Output {
+public:
+  Output(char * buffer, size_t capacity) noexcept
+    : _buffer(buffer)
+    , _capacity(capacity) {}
+
+  void append(const char * string, size_t count) noexcept {
+    if (count != 0 && _size < _capacity) {
+      const size_t room = _capacity - _size;
+
+      std::memcpy(_buffer + _size, string, count < room ? count : room);
+    }
+
+    _size += count;
+  }
+
+  void append(size_t count, char character) noexcept {
+    if (_size < _capacity) {
+      const size_t room = _capacity - _size;
+
+      std::memset(_buffer + _size, character, count < room ? count : room);
+    }
+
+    _size += count;
+  }
+
+  [[nodiscard]] size_t size() const noexcept {
+    return _size;
+  }
+
+private:
+  char * _buffer;
+  size_t _capacity;
+  size_t _size{0};
+};
+
+// Writes prefix and body padded to the field width; width counts display columns, given by the caller
+void writePadded(Output & output, const Specification & specification, string_view prefix, string_view body,
+                 size_t width, Alignment alignment) noexcept {
+  if (specification.align != Alignment::Default)
+    alignment = specification.align;
+
+  const size_t padding = specification.width > width ? specification.width - width : 0;
+  const size_t before  = alignment == Alignment::Left ? 0 : alignment == Alignment::Center ? padding / 2 : padding;
+
+  output.append(before, specification.fill);
+  output.append(prefix.data(), prefix.size());
+  output.append(body.data(), body.size());
+  output.append(padding - before, specification.fill);
+}
+
+// Writes a number; zero padding goes between the sign or base prefix and the digits, and only without an alignment
+void writeNumber(Output & output, const Specification & specification, string_view prefix, string_view digits,
+                 bool zeroPaddable) noexcept {
+  const size_t width = prefix.size() + digits.size();
+
+  if (specification.zeroPad && zeroPaddable && specification.align == Alignment::Default) {
+    output.append(prefix.data(), prefix.size());
+    output.append(specification.width > width ? specification.width - width : 0, '0');
+    output.append(digits.data(), digits.size());
+  } else {
+    writePadded(output, specification, prefix, digits, width, Alignment::Right);
+  }
+}
+
+void writeText(Output & output, const Specification & specification, string_view text) noexcept {
+  if (specification.precision >= 0) {
+    // Keep at most precision code points
+    size_t count = 0;
+    size_t end   = 0;
+
+    while (end < text.size() && count < static_cast<size_t>(specification.precision)) {
+      ++end;
+      ++count;
+
+      while (end < text.size() && (static_cast<uint8_t>(text[end]) & 0xC0) == 0x80)
+        ++end;
+    }
+
+    text = text.substr(0, end);
+  }
+
+  if (specification.width == 0) {
+    output.append(text.data(), text.size());
+    return;
+  }
+
+  writePadded(output, specification, {}, text, utf8CodePointCount(text.data(), text.size()), Alignment::Left);
+}
+
+char signOf(const Specification & specification, bool negative) noexcept {
+  return negative ? '-' : specification.sign == '-' ? '\0' : specification.sign;
+}
+
+void writeInteger(Output & output, const Specification & specification, uint64_t magnitude, bool negative) noexcept {
+  const char type = specification.type;
+
+  if (type == 'c') {
+    const char character = static_cast<char>(magnitude);
+
+    writePadded(output, specification, {}, string_view(&character, 1), 1, Alignment::Left);
+    return;
+  }
+
+  char   prefix[3];
+  size_t prefixSize = 0;
+
+  if (const char sign = signOf(specification, negative); sign != '\0')
+    prefix[prefixSize++] = sign;
+
+  int32_t base = 10;
+
+  if (type == 'b' || type == 'B')
+    base = 2;
+  else if (type == 'o')
+    base = 8;
+  else if (type == 'x' || type == 'X')
+    base = 16;
+
+  if (specification.alternate && base != 10 && (base != 8 || magnitude != 0)) {
+    prefix[prefixSize++] = '0';
+
+    if (base != 8)
+      prefix[prefixSize++] = type;
+  }
+
+  char         digits[c_maxIntegerChars];
+  char * const end = toChars(digits, magnitude, base);
+
+  if (type == 'X') {
+    for (char * digit = digits; digit != end; ++digit) {
+      if (*digit >= 'a')
+        *digit = static_cast<char>(*digit - 'a' + 'A');
+    }
+  }
+
+  writeNumber(output, specification, string_view(prefix, prefixSize),
+              string_view(digits, static_cast<size_t>(end - digits)), true);
+}
+
+template <typename T>
+void writeFloat(Output & output, const Specification & specification, T value) noexcept {
+  const char type      = specification.type;
+  const int  precision = specification.precision;
+
+  char   buffer[c_floatBufferSize];
+  char * end = nullptr;
+
+  switch (type) {
+    case 'a':
+    case 'A':
+      end = toChars(buffer, value, FloatFormat::Hex, precision);
+      break;
+    case 'e':
+    case 'E':
+      end = toChars(buffer, value, FloatFormat::Scientific, precision);
+      break;
+    case 'f':
+    case 'F':
+      end = toChars(buffer, value, FloatFormat::Fixed, precision);
+      break;
+    case 'g':
+    case 'G':
+      end = toChars(buffer, value, FloatFormat::General, precision);
+      break;
+    default:
+      // Shortest representation that reads back as the same value, unless a precision is given
+      end = precision < 0 ? toChars(buffer, value) : toChars(buffer, value, FloatFormat::General, precision);
+      break;
+  }
+
+  if (type == 'A' || type == 'E' || type == 'F' || type == 'G') {
+    for (char * character = buffer; character != end; ++character) {
+      if (*character >= 'a' && *character <= 'z')
+        *character = static_cast<char>(*character - 'a' + 'A');
+    }
+  }
+
+  const bool   negative = buffer[0] == '-';
+  const char * digits   = negative ? buffer + 1 : buffer;
+  const char   sign     = signOf(specification, negative);
+
+  // Infinity and NaN are padded with the fill character, never with zeros; both print a letter first
+  writeNumber(output, specification, sign != '\0' ? string_view(&sign, 1) : string_view(),
+              string_view(digits, static_cast<size_t>(end - digits)), *digits >= '0' && *digits <= '9');
+}
+
+void writePointer(Output & output, const Specification & specification, const void * pointer) noexcept {
+  char         digits[c_maxIntegerChars];
+  char * const end = toChars(digits, reinterpret_cast<uintptr_t>(pointer), 16);
+
+  writeNumber(output, specification, "0x", string_view(digits, static_cast<size_t>(end - digits)), true);
+}
+
+void writeArgument(Output & output, const Specification & specification, const Argument & argument) noexcept {
+  switch (argument.kind) {
+    case ArgumentKind::Bool:
+      if (specification.type == '\0' || specification.type == 's')
+        writeText(output, specification, argument.unsignedValue != 0 ? "true" : "false");
+      else
+        writeInteger(output, specification, argument.unsignedValue, false);
+      break;
+    case ArgumentKind::Char:
+      if (specification.type == '\0' || specification.type == 'c') {
+        const char character = static_cast<char>(argument.unsignedValue);
+
+        writePadded(output, specification, {}, string_view(&character, 1), 1, Alignment::Left);
+      } else {
+        writeInteger(output, specification, argument.unsignedValue, false);
+      }
+      break;
+    case ArgumentKind::Signed: {
+      const int64_t value = argument.signedValue;
+
+      // Negating in unsigned arithmetic keeps INT64_MIN exact
+      writeInteger(output, specification, value < 0 ? 0 - static_cast<uint64_t>(value) : static_cast<uint64_t>(value),
+                   value < 0);
+      break;
+  }
+  case ArgumentKind::Unsigned:
+    writeInteger(output, specification, argument.unsignedValue, false);
+    break;
+  case ArgumentKind::Float:
+    writeFloat(output, specification, argument.floatValue);
+    break;
+  case ArgumentKind::Double:
+    writeFloat(output, specification, argument.doubleValue);
+    break;
+  case ArgumentKind::String:
+    writeText(output, specification, string_view(argument.stringValue.data, argument.stringValue.size));
+    break;
+  case ArgumentKind::Pointer:
+    writePointer(output, specification, argument.pointerValue);
+    break;
+  case ArgumentKind::None:
+    break;
+  }
+}
+
+} // namespace
+
+size_t formatArguments(char * buffer, size_t capacity, string_view format, const Argument * arguments) noexcept {
+  Output       output(buffer, capacity);
+  const char * cursor = format.data();
+  const char * end    = cursor + format.size();
+  size_t       next   = 0;
+
+  while (cursor != end) {
+    const char * literal = cursor;
+
+    while (cursor != end && *cursor != '{' && *cursor != '}')
+      ++cursor;
+
+    output.append(literal, static_cast<size_t>(cursor - literal));
+
+    if (cursor == end)
+      break;
+
+    // Checked at compile time: a brace here is an escaped pair or opens a well-formed field
+    if (*cursor == '}' || cursor[1] == '{') {
+      output.append(cursor, 1);
+      cursor += 2;
+      continue;
+    }
+
+    ++cursor;
+
+    size_t index = next;
+
+    if (*cursor >= '0' && *cursor <= '9') {
+      for (index = 0; *cursor >= '0' && *cursor <= '9'; ++cursor)
+        index = index * 10 + static_cast<size_t>(*cursor - '0');
+    } else {
+      ++next;
+    }
+
+    Specification specification;
+
+    if (*cursor == ':') {
+      ++cursor;
+      [[maybe_unused]] const bool parsed = parseSpecification(cursor, end, specification);
+    }
+
+    ++cursor;
+    writeArgument(output, specification, arguments[index]);
+  }
+
+  return output.size();
+}
+
+} // namespace toy::formatting
@@ -0,0 +1,289 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   hash.cpp
+  \brief  Runtime hashing and the debug string-ID intern table.
+
+  Defines the buffer forms of hash64(): the scalar one, which runs the \c constexpr stripe loop from hash.inl, and the
+  vector ones used on desktop targets, which keep the eight stripe accumulators in SSE2, AVX2, or NEON registers and
+  are compiled once per \ref toy::platform::SimdLevel from hash_kernels.inl. Debug builds also get the table behind
+  internString() and internedName().
+*/
+
+#include "core.hpp"
+
+#ifdef _DEBUG
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#endif // _DEBUG
+
+#ifdef TOYGINE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace toy {
+
+namespace {
+
+#ifdef TOYGINE_SIMD_VECTOR128
+
+/// 128-bit hashing, with SSE2 or NEON.
+namespace vector128 {
+
+/*!
+  \brief The eight stripe accumulators of hash64(), held in vector registers.
+
+  Performs hashing::accumulate() and hashing::scramble() on all lanes at once: each lane adds the product of the low
+  and high halves of its keyed input word, a 32 x 32 -> 64 bit multiply every instruction set here has, plus the input
+  word of its neighbour lane. store() writes the lanes back for hashing::merge().
+
+  Each SIMD level defines accumulators of this shape in its own namespace, and hash_kernels.inl hashes with them.
+*/
+class StripeAccumulators {
+public:
+#if defined(__aarch64__) || defined(_M_ARM64)
+
+  explicit StripeAccumulators(const array<uint64_t, 8> & keys) noexcept {
+    for (size_t index = 0; index < 4; ++index) {
+      _lanes[index] = vld1q_u64(hashing::c_initialAccumulators.data() + index * 2);
+      _keys[index]  = vld1q_u64(keys.data() + index * 2);
+    }
+  }
+
+  void accumulate(const char * stripe) noexcept {
+    for (size_t index = 0; index < 4; ++index) {
+      const uint64x2_t value   = vreinterpretq_u64_u8(vld1q_u8(reinterpret_cast<const uint8_t *>(stripe) + index * 16));
+      const uint64x2_t keyed   = veorq_u64(value, _keys[index]);
+      const uint64x2_t product = vmull_u32(vmovn_u64(keyed), vshrn_n_u64(keyed, 32));
+      const uint64x2_t swapped = vextq_u64(value, value, 1);
+
+      _lanes[index] = vaddq_u64(_lanes[index], vaddq_u64(product, swapped));
+    }
+  }
+
+  void scramble() noexcept {
+    const auto prime = static_cast<uint32_t>(hashing::c_scramblePrime);
+
+    for (size_t index = 0; index < 4; ++index) {
+      uint64x2_t lanes = _lanes[index];
+
+      lanes = veorq_u64(lanes, vshrq_n_u64(lanes, 47));
+      lanes = veorq_u64(lanes, _keys[index]);
+
+      const uint64x2_t low  = vmull_n_u32(vmovn_u64(lanes), prime);
+      const uint64x2_t high = vmull_n_u32(vshrn_n_u64(lanes, 32), prime);
+
+      _lanes[index] = vaddq_u64(low, vshlq_n_u64(high, 32));
+    }
+  }
+
+  void store(array<uint64_t, 8> & accumulators) const noexcept {
+    for (size_t index = 0; index < 4; ++index)
+      vst1q_u64(accumulators.data() + index * 2, _lanes[index]);
+  }
+
+private:
+  uint64x2_t _lanes[4];
+  uint64x2_t _keys[4];
+
+#else
+
+  explicit StripeAccumulators(const array<uint64_t, 8> & keys) noexcept {
+    for (size_t index = 0; index < 4; ++index) {
+      _lanes[index] = load(hashing::c_initialAccumulators.data() + index * 2);
+      _keys[index]  = load(keys.data() + index * 2);
+    }
+  }
+
+  void accumulate(const char * stripe) noexcept {
+    for (size_t index = 0; index < 4; ++index) {
+      const __m128i value   = load(stripe + index * 16);
+      const __m128i keyed   = _mm_xor_si128(value, _keys[index]);
+      const __m128i product = _mm_mul_epu32(keyed, _mm_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+      const __m128i swapped = _mm_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+      _lanes[index] = _mm_add_epi64(_lanes[index], _mm_add_epi64(product, swapped));
+    }
+  }
+
+  void scramble() noexcept {
+    const __m128i prime = _mm_set1_epi32(static_cast<int>(hashing::c_scramblePrime));
+
+    for (size_t index = 0; index < 4; ++index) {
+      __m128i lanes = _lanes[index];
+
+      lanes = _mm_xor_si128(lanes, _mm_srli_epi64(lanes, 47));
+      lanes = _mm_xor_si128(lanes, _keys[index]);
+
+      const __m128i low  = _mm_mul_epu32(lanes, prime);
+      const __m128i high = _mm_mul_epu32(_mm_srli_epi64(lanes, 32), prime);
+
+      _lanes[index] = _mm_add_epi64(low, _mm_slli_epi64(high, 32));
+    }
+  }
+
+  void store(array<uint64_t, 8> & accumulators) const noexcept {
+    for (size_t index = 0; index < 4; ++index)
+      _mm_storeu_si128(reinterpret_cast<__m128i *>(accumulators.data() + index * 2), _lanes[index]);
+  }
+
+private:
+  static __m128i load(const void * data) noexcept {
+    return _mm_loadu_si128(static_cast<const __m128i *>(data));
+  }
+
+  __m128i _lanes[4];
+  __m128i _keys[4];
+
+#endif
+};
+
+#include "hash_kernels.inl"
+
+} // namespace vector128
+
+#endif // TOYGINE_SIMD_VECTOR128
+
+#ifdef TOYGINE_SIMD_AVX2
+
+TOYGINE_SIMD_AVX2_BEGIN
+
+/// 256-bit hashing, with AVX2.
+namespace avx2 {
+
+/// StripeAccumulators of AVX2 registers; see vector128::StripeAccumulators.
+class StripeAccumulators {
+public:
+  explicit StripeAccumulators(const array<uint64_t, 8> & keys) noexcept {
+    for (size_t index = 0; index < 2; ++index) {
+      _lanes[index] = load(hashing::c_initialAccumulators.data() + index * 4);
+      _keys[index]  = load(keys.data() + index * 4);
+    }
+  }
+
+  void accumulate(const char * stripe) noexcept {
+    for (size_t index = 0; index < 2; ++index) {
+      const __m256i value   = load(stripe + index * 32);
+      const __m256i keyed   = _mm256_xor_si256(value, _keys[index]);
+      const __m256i product = _mm256_mul_epu32(keyed, _mm256_shuffle_epi32(keyed, _MM_SHUFFLE(0, 3, 0, 1)));
+      const __m256i swapped = _mm256_shuffle_epi32(value, _MM_SHUFFLE(1, 0, 3, 2));
+
+      _lanes[index] = _mm256_add_epi64(_lanes[index], _mm256_add_epi64(product, swapped));
+    }
+  }
+
+  void scramble() noexcept {
+    const __m256i prime = _mm256_set1_epi32(static_cast<int>(hashing::c_scramblePrime));
+
+    for (size_t index = 0; index < 2; ++index) {
+      __m256i lanes = _lanes[index];
+
+      lanes = _mm256_xor_si256(lanes, _mm256_srli_epi64(lanes, 47));
+      lanes = _mm256_xor_si256(lanes, _keys[index]);
+
+      const __m256i low  = _mm256_mul_epu32(lanes, prime);
+      const __m256i high = _mm256_mul_epu32(_mm256_srli_epi64(lanes, 32), prime);
+
+      _lanes[index] = _mm256_add_epi64(low, _mm256_slli_epi64(high, 32));
+    }
+  }
+
+  void store(array<uint64_t, 8> & accumulators) const noexcept {
+    for (size_t index = 0; index < 2; ++index)
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(accumulators.data() + index * 4), _lanes[index]);
+  }
+
+private:
+  static __m256i load(const void * data) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i *>(data));
+  }
+
+  __m256i _lanes[2];
+  __m256i _keys[2];
+};
+
+#include "hash_kernels.inl"
+
+} // namespace avx2
+
+TOYGINE_SIMD_AVX2_END
+
+#endif // TOYGINE_SIMD_AVX2
+
+#ifdef _DEBUG
+
+/// Names recorded by internString(), keyed by identifier value.
+struct InternTable {
+  std::mutex                                mutex;
+  std::unordered_map<uint64_t, std::string> names;
+};
+
+/// Returns the process-wide intern table, created on first use.
+InternTable & internTable() noexcept {
+  static InternTable table;
+
+  return table;
+}
+
+#endif // _DEBUG
+
+} // namespace
+
+namespace scalar {
+
+uint64_t hashBuffer64(const void * data, size_t size, uint64_t seed) noexcept {
+  return hashing::hashBytes(static_cast<const char *>(data), size, seed);
+}
+
+} // namespace scalar
+
+uint64_t hashBuffer64(const void * data, size_t size, uint64_t seed) noexcept {
+  // Short inputs take the same path at every level, without the indirect call
+  if (size <= hashing::c_longThreshold)
+    return hashing::hashShort(static_cast<const char *>(data), size, hashing::seedState(seed));
+
+  return platform::selectKernel<decltype(hashBuffer64), TOYGINE_SIMD_KERNELS(hashBuffer64)>()(data, size, seed);
+}
+
+#ifdef _DEBUG
+
+StringId internString(string_view name) noexcept {
+  const StringId id(hash64(name));
+  InternTable &  table = internTable();
+
+  const std::lock_guard lock(table.mutex);
+  table.names.try_emplace(id.value(), name);
+
+  return id;
+}
+
+string_view internedName(StringId id) noexcept {
+  InternTable & table = internTable();
+
+  const std::lock_guard lock(table.mutex);
+  const auto            entry = table.names.find(id.value());
+
+  return entry != table.names.end() ? string_view(entry->second) : string_view();
+}
+
+#endif // _DEBUG
+
+} // namespace toy
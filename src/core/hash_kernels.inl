@@ -0,0 +1,58 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   hash_kernels.inl
+  \brief  Vector form of hashBuffer64(), written against one \c StripeAccumulators.
+
+  hash.cpp includes this file once per SIMD level, inside the namespace of the level and after its
+  \c StripeAccumulators; hence the missing include guard.
+*/
+
+/// Vector form of hashBuffer64(); same arithmetic and result as the scalar one.
+uint64_t hashBuffer64(const void * data, size_t size, uint64_t seed) noexcept {
+  const auto *   bytes = static_cast<const char *>(data);
+  const uint64_t state = hashing::seedState(seed);
+
+  if (size <= hashing::c_longThreshold)
+    return hashing::hashShort(bytes, size, state);
+
+  array<uint64_t, 8> keys{};
+
+  for (size_t lane = 0; lane < 8; ++lane)
+    keys[lane] = hashing::c_secret[lane] + state;
+
+  StripeAccumulators accumulators(keys);
+
+  const size_t stripes = (size - 1) / hashing::c_stripeSize;
+
+  for (size_t stripe = 0; stripe < stripes; ++stripe) {
+    accumulators.accumulate(bytes + stripe * hashing::c_stripeSize);
+
+    if ((stripe + 1) % hashing::c_stripesPerBlock == 0)
+      accumulators.scramble();
+  }
+
+  accumulators.accumulate(bytes + size - hashing::c_stripeSize);
+
+  array<uint64_t, 8> lanes{};
+  accumulators.store(lanes);
+
+  return hashing::merge(lanes, bytes, size, state);
+}
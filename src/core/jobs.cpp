@@ -0,0 +1,361 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   jobs.cpp
+  \brief  Work-stealing scheduler: Chase-Lev deques, worker threads, and waiting.
+
+  The deques follow "Correct and Efficient Work-Stealing for Weak Memory Models" (Le, Pop, Cohen, and Zappa Nardelli,
+  2013), with a fixed ring instead of a growing one: a thread whose deque is full runs the job at once.
+
+  Built without \c TOYGINE_JOB_THREADS, the scheduler has no threads: run() executes each job immediately.
+*/
+
+#include "core.hpp"
+
+#ifdef TOYGINE_JOB_THREADS
+#include <thread>
+#endif // TOYGINE_JOB_THREADS
+
+namespace toy::jobs {
+
+#ifdef TOYGINE_JOB_THREADS
+
+namespace {
+
+/// Thread index of threads that do not run jobs
+constexpr size_t c_noThread = ~size_t{0};
+
+/// Failed steal rounds before an idle worker goes to sleep
+constexpr uint32_t c_idleRounds = 64;
+
+/*!
+  \brief Chase-Lev deque of one thread's jobs.
+
+  The owner pushes and pops at the bottom; any thread steals from the top. Only the last remaining job needs a
+  compare-and-swap, to settle a race between its owner and a thief.
+*/
+class WorkQueue {
+public:
+  /// Appends \a job at the bottom; false when the queue is full. Owner only.
+  bool push(Job * job) noexcept {
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed);
+    const int64_t top    = _top.load(std::memory_order_acquire);
+
+    if (bottom - top >= static_cast<int64_t>(c_queueSize))
+      return false;
+
+    _jobs[static_cast<size_t>(bottom) & (c_queueSize - 1)].store(job, std::memory_order_relaxed);
+    _bottom.store(bottom + 1, std::memory_order_release);
+
+    return true;
+  }
+
+  /// Removes the newest job; \c nullptr when the queue is empty. Owner only.
+  Job * pop() noexcept {
+    const int64_t bottom = _bottom.load(std::memory_order_relaxed) - 1;
+    _bottom.store(bottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top = _top.load(std::memory_order_relaxed);
+
+    if (top > bottom) {
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+
+    Job * job = _jobs[static_cast<size_t>(bottom) & (c_queueSize - 1)].load(std::memory_order_relaxed);
+
+    if (top == bottom) {
+      // Last job: a thief may be taking it at the same time
+      if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        job = nullptr;
+
+      _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    return job;
+  }
+
+  /// Removes the oldest job; \c nullptr when the queue is empty or another thread got there first.
+  Job * steal() noexcept {
+    int64_t top = _top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const int64_t bottom = _bottom.load(std::memory_order_acquire);
+
+    if (top >= bottom)
+      return nullptr;
+
+    Job * job = _jobs[static_cast<size_t>(top) & (c_queueSize - 1)].load(std::memory_order_relaxed);
+
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+      return nullptr;
+
+    return job;
+  }
+
+private:
+  /// Next position to steal from; on its own cache line, as thieves write it
+  alignas(64) std::atomic<int64_t> _top{0};
+
+  /// Next position to push to
+  alignas(64) std::atomic<int64_t> _bottom{0};
+
+  /// Ring of queued jobs
+  array<std::atomic<Job *>, c_queueSize> _jobs{};
+};
+
+/// Deques of the thread that called initialize(), at index 0, and of the workers
+array<WorkQueue, c_maxWorkers + 1> s_queues;
+
+/// Worker threads
+array<std::thread, c_maxWorkers> s_workers;
+
+/// Number of started workers
+std::atomic<size_t> s_workerCount{0};
+
+/// Set by deInitialize() to stop the workers
+std::atomic<bool> s_stopping{false};
+
+/// Bumped whenever jobs are queued; sleeping workers wait for it to change
+std::atomic<uint32_t> s_wakeEpoch{0};
+
+/// Workers sleeping on \ref s_wakeEpoch
+std::atomic<uint32_t> s_sleepers{0};
+
+/// Index of the calling thread's deque, or \ref c_noThread
+thread_local size_t t_threadIndex = c_noThread;
+
+/// Victim selection state of the calling thread
+thread_local uint32_t t_random = 0;
+
+#ifdef TOYGINE_PROFILER
+/// Names of the workers in profiler traces
+array<array<char, 16>, c_maxWorkers> s_workerNames{};
+#endif // TOYGINE_PROFILER
+
+/// Returns the next value of the calling thread's xorshift generator.
+uint32_t nextRandom() noexcept {
+  uint32_t value = t_random != 0 ? t_random : static_cast<uint32_t>(t_threadIndex * 0x9E3779B9U + 1);
+  value ^= value << 13;
+  value ^= value >> 17;
+  value ^= value << 5;
+  t_random = value;
+
+  return value;
+}
+
+/// Takes a job for thread \a self: its own newest one, or the oldest one of another thread.
+Job * findJob(size_t self) noexcept {
+  if (Job * job = s_queues[self].pop())
+    return job;
+
+  const size_t threads = s_workerCount.load(std::memory_order_relaxed) + 1;
+  const size_t start   = nextRandom() % threads;
+
+  for (size_t offset = 0; offset < threads; ++offset) {
+    const size_t victim = (start + offset) % threads;
+
+    if (victim == self)
+      continue;
+
+    if (Job * job = s_queues[victim].steal())
+      return job;
+  }
+
+  return nullptr;
+}
+
+/// Wakes sleeping workers after jobs were queued.
+void wakeWorkers() noexcept {
+  s_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+
+  if (s_sleepers.load(std::memory_order_seq_cst) != 0)
+    s_wakeEpoch.notify_all();
+}
+
+/// Body of worker thread \a index.
+void workerLoop(size_t index) noexcept {
+  t_threadIndex = index;
+
+#ifdef TOYGINE_PROFILER
+  formatTo(s_workerNames[index - 1].data(), s_workerNames[index - 1].size() - 1, "Job worker {}", index);
+  profiler::setThreadName(s_workerNames[index - 1].data());
+#endif // TOYGINE_PROFILER
+
+  uint32_t idleRounds = 0;
+
+  while (!s_stopping.load(std::memory_order_acquire)) {
+    if (Job * job = findJob(index)) {
+      execute(*job);
+      idleRounds = 0;
+      continue;
+    }
+
+    if (++idleRounds < c_idleRounds) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    // Read the epoch before the last look at the queues, so jobs queued after that look change it
+    const uint32_t epoch = s_wakeEpoch.load(std::memory_order_seq_cst);
+
+    if (Job * job = findJob(index)) {
+      execute(*job);
+      idleRounds = 0;
+      continue;
+    }
+
+    s_sleepers.fetch_add(1, std::memory_order_seq_cst);
+
+    if (!s_stopping.load(std::memory_order_acquire))
+      s_wakeEpoch.wait(epoch, std::memory_order_seq_cst);
+
+    s_sleepers.fetch_sub(1, std::memory_order_seq_cst);
+    idleRounds = 0;
+  }
+}
+
+} // namespace
+
+void initialize(size_t workerCount) noexcept {
+  if (s_workerCount.load(std::memory_order_relaxed) != 0)
+    return;
+
+  if (workerCount == 0) {
+    const unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    workerCount                        = hardwareThreads > 1 ? hardwareThreads - 1 : 0;
+  }
+
+  workerCount   = workerCount < c_maxWorkers ? workerCount : c_maxWorkers;
+  t_threadIndex = 0;
+  s_stopping.store(false, std::memory_order_relaxed);
+
+  // Publish the count first: workers steal from every deque below it
+  s_workerCount.store(workerCount, std::memory_order_release);
+
+  for (size_t index = 0; index < workerCount; ++index)
+    s_workers[index] = std::thread(workerLoop, index + 1);
+}
+
+void deInitialize() noexcept {
+  const size_t count = s_workerCount.load(std::memory_order_relaxed);
+
+  s_stopping.store(true, std::memory_order_release);
+  s_wakeEpoch.fetch_add(1, std::memory_order_seq_cst);
+  s_wakeEpoch.notify_all();
+
+  for (size_t index = 0; index < count; ++index) {
+    if (s_workers[index].joinable())
+      s_workers[index].join();
+  }
+
+  // Workers stop between jobs, so their deques may still hold some. With the workers gone any deque can be stolen from;
+  // the jobs run here until a pass finds every deque empty, as they may queue more, and every counter completes
+  for (bool ran = true; ran;) {
+    ran = false;
+
+    for (size_t index = 0; index <= count; ++index) {
+      while (Job * job = s_queues[index].steal()) {
+        execute(*job);
+        ran = true;
+      }
+    }
+  }
+
+  s_workerCount.store(0, std::memory_order_release);
+  t_threadIndex = c_noThread;
+}
+
+size_t workerCount() noexcept {
+  return s_workerCount.load(std::memory_order_acquire);
+}
+
+void run(Job * jobs, size_t count, Counter & counter) noexcept {
+  counter._pending.fetch_add(count, std::memory_order_relaxed);
+
+  const size_t self = t_threadIndex;
+
+  if (self == c_noThread || s_workerCount.load(std::memory_order_relaxed) == 0) {
+    for (size_t index = 0; index < count; ++index) {
+      jobs[index].counter = &counter;
+      execute(jobs[index]);
+    }
+
+    return;
+  }
+
+  for (size_t index = 0; index < count; ++index) {
+    jobs[index].counter = &counter;
+
+    if (!s_queues[self].push(jobs + index))
+      execute(jobs[index]);
+  }
+
+  wakeWorkers();
+}
+
+void wait(const Counter & counter) noexcept {
+  const size_t self = t_threadIndex;
+
+  while (!counter.done()) {
+    if (self != c_noThread) {
+      if (Job * job = findJob(self)) {
+        execute(*job);
+        continue;
+      }
+    }
+
+    std::this_thread::yield();
+  }
+}
+
+#else // TOYGINE_JOB_THREADS
+
+void initialize([[maybe_unused]] size_t workerCount) noexcept {}
+
+void deInitialize() noexcept {}
+
+size_t workerCount() noexcept {
+  return 0;
+}
+
+void run(Job * jobs, size_t count, Counter & counter) noexcept {
+  counter._pending.fetch_add(count, std::memory_order_relaxed);
+
+  for (size_t index = 0; index < count; ++index) {
+    jobs[index].counter = &counter;
+    execute(jobs[index]);
+  }
+}
+
+void wait([[maybe_unused]] const Counter & counter) noexcept {}
+
+#endif // TOYGINE_JOB_THREADS
+
+void execute(Job & job) noexcept {
+  // The waiting thread may release the job as soon as the counter drops, so read everything first
+  Counter * counter = job.counter;
+
+  job.function(job.data, job.first, job.last);
+
+  if (counter != nullptr)
+    counter->_pending.fetch_sub(1, std::memory_order_release);
+}
+
+} // namespace toy::jobs
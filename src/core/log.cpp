@@ -0,0 +1,872 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   log.cpp
+  \brief  Message queue, consumer, sinks, and binary log reader of the deferred logger.
+
+  A producer encodes its message into a stack buffer, reserves consecutive slots of the ring with one compare-and-swap,
+  copies the message in, and publishes it with a release store to the first slot. flush() is the only consumer: under
+  one mutex, on the consumer thread or on whichever thread calls it, it reads the published messages in queue order,
+  frees their slots, formats them, and hands them to the sinks.
+*/
+
+#include "core.hpp"
+
+#include <cstdio>
+#include <mutex>
+
+#ifdef TOYGINE_JOB_THREADS
+#include <chrono>
+#include <thread>
+#endif // TOYGINE_JOB_THREADS
+
+namespace toy::log {
+
+namespace {
+
+using formatting::Argument;
+using formatting::ArgumentKind;
+
+/// Bytes of one slot; one cache line
+constexpr size_t c_slotSize = 64;
+
+/// Message bytes of one slot
+constexpr size_t c_slotPayload = c_slotSize - sizeof(uint64_t);
+
+/// Most slots one message takes
+constexpr size_t c_maxRecordSlots = c_maxRecordSize / c_slotPayload;
+
+/// Mask of a position to its slot index
+constexpr uint64_t c_slotMask = c_queueSlots - 1;
+
+static_assert(c_maxRecordSlots * c_slotPayload == c_maxRecordSize, "a message must fill whole slots");
+static_assert(std::has_single_bit(c_queueSlots) && c_queueSlots >= c_maxRecordSlots,
+              "the queue must be a power of two that holds the largest message");
+
+/// Most characters of a text line: the message text, and the time, level, thread, file, and line before it
+constexpr size_t c_maxLineSize = c_maxMessageSize + 320;
+
+/// Letters of the levels in text lines
+constexpr array<char, 6> c_levelLetters{'T', 'D', 'I', 'W', 'E', 'F'};
+
+/// First bytes of a binary log
+constexpr array<char, 4> c_binaryLogMagic{'T', 'G', 'L', 'G'};
+
+/// Written in the native byte order after the version; a reader of the other byte order sees 0x0201
+constexpr uint16_t c_byteOrderMark = 0x0102;
+
+/// Bytes of the binary log header: magic, version, and byte order mark
+constexpr size_t c_binaryLogHeaderSize = sizeof(c_binaryLogMagic) + 2 * sizeof(uint16_t);
+
+/// Kind of each record of a binary log after the header.
+enum class BinaryRecord : uint8_t {
+  /// Call site: identifier, level, line, file, and format string
+  Site = 'S',
+
+  /// Message: call site identifier, time, thread, and encoded arguments
+  Message = 'M',
+};
+
+/// Fixed part of a queued message, followed by the encoded arguments.
+struct RecordHeader {
+  /// Call site
+  const Site * site;
+
+  /// toy::chrono::now() at the call
+  uint64_t time;
+
+  /// Bytes of the message, this header included
+  uint16_t size;
+
+  /// Log thread index of the calling thread
+  uint16_t thread;
+};
+
+/// Bytes the encoded arguments of a message may take
+constexpr size_t c_maxArgumentsSize = c_maxRecordSize - sizeof(RecordHeader);
+
+/// One cache line of the queue.
+struct alignas(c_slotSize) Slot {
+  /// Sequence of the slot minus its index, so zero-filled slots start out free; see loadSequence()
+  std::atomic<uint64_t> state{0};
+
+  /// Message bytes
+  std::byte payload[c_slotPayload]{};
+};
+
+/*!
+  \brief Bounded multi-producer, single-consumer ring of messages.
+
+  Each slot holds a sequence number. A slot free for position \c p holds \c p; the first slot of a message published
+  at \c p holds <tt>p + 1</tt>, while the other slots of the message keep their free values; freeing a slot read at
+  \c p stores <tt>p + c_queueSlots</tt>. Slots are freed in position order, so a producer that finds the last slot
+  of its range free knows the whole range is free.
+*/
+struct Queue {
+  /// Slots, indexed by position modulo \ref c_queueSlots
+  array<Slot, c_queueSlots> slots;
+
+  /// Position of the next slot producers reserve
+  alignas(c_slotSize) std::atomic<uint64_t> tail{0};
+
+  /// Messages dropped because the ring was full
+  std::atomic<uint64_t> dropped{0};
+};
+
+/// Queue shared by every thread
+constinit Queue s_queue;
+
+/// Serializes the consumer, and guards the sinks and the read position
+std::mutex s_consumerMutex;
+
+/// Position of the next message to read; guarded by s_consumerMutex
+uint64_t s_head = 0;
+
+/// Registered sinks; guarded by s_consumerMutex
+array<Sink, c_maxSinks> s_sinks{};
+
+/// Number of registered sinks; guarded by s_consumerMutex
+size_t s_sinkCount = 0;
+
+/// Log thread indices handed out so far
+std::atomic<uint16_t> s_threadCount{0};
+
+/// Log thread index of the calling thread; 0 until its first message
+constinit thread_local uint16_t t_thread = 0;
+
+#ifdef TOYGINE_JOB_THREADS
+
+/// Pause of the consumer thread between two flushes
+constexpr auto c_consumerPeriod = std::chrono::milliseconds(2);
+
+/// Consumer thread, running between initialize() and deInitialize()
+std::thread s_consumer;
+
+/// Set while the consumer thread should keep running
+std::atomic<bool> s_running{false};
+
+/// Body of the consumer thread.
+void consumerLoop() noexcept {
+  while (s_running.load(std::memory_order_acquire)) {
+    flush();
+    std::this_thread::sleep_for(c_consumerPeriod);
+  }
+}
+
+#endif // TOYGINE_JOB_THREADS
+
+/// Returns the sequence of the slot at \a index.
+uint64_t loadSequence(size_t index, std::memory_order order) noexcept {
+  return s_queue.slots[index].state.load(order) + index;
+}
+
+/// Sets the sequence of the slot at \a index.
+void storeSequence(size_t index, uint64_t sequence, std::memory_order order) noexcept {
+  s_queue.slots[index].state.store(sequence - index, order);
+}
+
+/// Returns the bytes an argument of \a kind takes in a message, besides the characters of strings.
+constexpr size_t encodedSize(ArgumentKind kind) noexcept {
+  switch (kind) {
+    case ArgumentKind::None:
+      return 0;
+
+    case ArgumentKind::Bool:
+    case ArgumentKind::Char:
+      return sizeof(uint8_t);
+
+    case ArgumentKind::Float:
+      return sizeof(float);
+
+    case ArgumentKind::String:
+      return sizeof(uint16_t);
+
+    case ArgumentKind::Signed:
+    case ArgumentKind::Unsigned:
+    case ArgumentKind::Double:
+    case ArgumentKind::Pointer:
+      return sizeof(uint64_t);
+  }
+
+  return 0;
+}
+
+/// Copies \a size bytes of \a value to \a cursor and advances it.
+void put(std::byte *& cursor, const void * value, size_t size) noexcept {
+  std::memcpy(cursor, value, size);
+  cursor += size;
+}
+
+/// Reads a \a T at \a cursor and advances it; \c false when fewer than its bytes are left before \a end.
+template <typename T>
+bool take(const std::byte *& cursor, const std::byte * end, T & value) noexcept {
+  if (static_cast<size_t>(end - cursor) < sizeof(T))
+    return false;
+
+  std::memcpy(&value, cursor, sizeof(T));
+  cursor += sizeof(T);
+
+  return true;
+}
+
+/*!
+  \brief Encodes \a count arguments into \a buffer: their count, their kinds, and then their values.
+
+  Numbers keep all their bytes. Strings take a 16-bit length and their characters, shortened to what the buffer has
+  left, so the last strings of an oversized message are cut first.
+
+  \return Bytes written; at most \ref c_maxArgumentsSize.
+*/
+size_t encodeArguments(std::byte * buffer, const Argument * arguments, size_t count) noexcept {
+  size_t fixedSize = 1 + count;
+
+  for (size_t index = 0; index < count; ++index)
+    fixedSize += encodedSize(arguments[index].kind);
+
+  std::byte * cursor = buffer;
+  size_t      room   = c_maxArgumentsSize - fixedSize;
+
+  *cursor++ = static_cast<std::byte>(count);
+
+  for (size_t index = 0; index < count; ++index)
+    *cursor++ = static_cast<std::byte>(arguments[index].kind);
+
+  for (size_t index = 0; index < count; ++index) {
+    const Argument & argument = arguments[index];
+
+    switch (argument.kind) {
+      case ArgumentKind::None:
+        break;
+
+      case ArgumentKind::Bool:
+      case ArgumentKind::Char:
+        *cursor++ = static_cast<std::byte>(argument.unsignedValue);
+        break;
+
+      case ArgumentKind::Signed:
+      case ArgumentKind::Unsigned:
+        put(cursor, &argument.unsignedValue, sizeof(uint64_t));
+        break;
+
+      case ArgumentKind::Float:
+        put(cursor, &argument.floatValue, sizeof(float));
+        break;
+
+      case ArgumentKind::Double:
+        put(cursor, &argument.doubleValue, sizeof(double));
+        break;
+
+      case ArgumentKind::Pointer: {
+        const auto address = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(argument.pointerValue));
+
+        put(cursor, &address, sizeof(address));
+        break;
+      }
+
+      case ArgumentKind::String: {
+        size_t size = argument.stringValue.size < room ? argument.stringValue.size : room;
+        size        = size < UINT16_MAX ? size : UINT16_MAX;
+
+        const auto length = static_cast<uint16_t>(size);
+
+        put(cursor, &length, sizeof(length));
+        put(cursor, argument.stringValue.data, size);
+        room -= size;
+        break;
+      }
+    }
+  }
+
+  return static_cast<size_t>(cursor - buffer);
+}
+
+/*!
+  \brief Decodes arguments written by encodeArguments().
+
+  \param data      Encoded arguments; strings point into them.
+  \param size      Bytes of \a data.
+  \param arguments Receives up to \ref c_maxArguments arguments.
+  \param kinds     Receives the kind of each argument.
+  \param count     Receives the number of arguments.
+
+  \return \c false when \a data is not a valid encoding.
+*/
+bool decodeArguments(const std::byte * data, size_t size, Argument * arguments, ArgumentKind * kinds,
+                     size_t & count) noexcept {
+  const std::byte * cursor = data;
+  const std::byte * end    = data + size;
+  uint8_t           number = 0;
+
+  if (!take(cursor, end, number) || number > c_maxArguments || static_cast<size_t>(end - cursor) < number)
+    return false;
+
+  count = number;
+
+  for (size_t index = 0; index < count; ++index) {
+    const auto kind = static_cast<ArgumentKind>(cursor[index]);
+
+    if (kind == ArgumentKind::None || kind > ArgumentKind::Pointer)
+      return false;
+
+    kinds[index]          = kind;
+    arguments[index]      = {};
+    arguments[index].kind = kind;
+  }
+
+  cursor += count;
+
+  for (size_t index = 0; index < count; ++index) {
+    Argument & argument = arguments[index];
+    bool       read     = false;
+
+    switch (argument.kind) {
+      case ArgumentKind::None:
+        break;
+
+      case ArgumentKind::Bool:
+      case ArgumentKind::Char: {
+        uint8_t value = 0;
+
+        read                   = take(cursor, end, value);
+        argument.unsignedValue = value;
+        break;
+      }
+
+      case ArgumentKind::Signed:
+      case ArgumentKind::Unsigned:
+        read = take(cursor, end, argument.unsignedValue);
+        break;
+
+      case ArgumentKind::Float:
+        read = take(cursor, end, argument.floatValue);
+        break;
+
+      case ArgumentKind::Double:
+        read = take(cursor, end, argument.doubleValue);
+        break;
+
+      case ArgumentKind::Pointer: {
+        uint64_t address = 0;
+
+        read                  = take(cursor, end, address);
+        argument.pointerValue = reinterpret_cast<const void *>(static_cast<uintptr_t>(address));
+        break;
+      }
+
+      case ArgumentKind::String: {
+        uint16_t length = 0;
+
+        read = take(cursor, end, length) && static_cast<size_t>(end - cursor) >= length;
+
+        if (read) {
+          argument.stringValue = {reinterpret_cast<const char *>(cursor), length};
+          cursor += length;
+        }
+        break;
+      }
+    }
+
+    if (!read)
+      return false;
+  }
+
+  return cursor == end;
+}
+
+/// Formats the message of \a site with \a arguments into \a text, which holds \ref c_maxMessageSize characters.
+string_view formatText(const Site & site, const Argument * arguments, char * text) noexcept {
+  const size_t size = formatting::formatArguments(text, c_maxMessageSize, site.format, arguments);
+
+  return {text, size < c_maxMessageSize ? size : c_maxMessageSize};
+}
+
+/// Formats one message read from the queue and hands it to every sink; called with s_consumerMutex held.
+void dispatch(const RecordHeader & header, const std::byte * data, size_t size) noexcept {
+  if (s_sinkCount == 0)
+    return;
+
+  array<Argument, c_maxArguments>     arguments;
+  array<ArgumentKind, c_maxArguments> kinds;
+  size_t                              count = 0;
+
+  // The queue holds only what encodeArguments() wrote, so decoding cannot fail here
+  [[maybe_unused]] const bool decoded = decodeArguments(data, size, arguments.data(), kinds.data(), count);
+
+  char          text[c_maxMessageSize];
+  const Message message{header.site, header.time, header.thread, formatText(*header.site, arguments.data(), text),
+                        data,        size};
+
+  for (size_t index = 0; index < s_sinkCount; ++index)
+    s_sinks[index].write(message, s_sinks[index].context);
+}
+
+/// Reads every published message; called with s_consumerMutex held.
+void drain() noexcept {
+  bool read = false;
+
+  for (;;) {
+    const size_t first = static_cast<size_t>(s_head & c_slotMask);
+
+    if (loadSequence(first, std::memory_order_acquire) != s_head + 1)
+      break;
+
+    alignas(RecordHeader) std::byte record[c_maxRecordSize];
+    RecordHeader header;
+
+    std::memcpy(record, s_queue.slots[first].payload, c_slotPayload);
+    std::memcpy(&header, record, sizeof(header));
+
+    const size_t slotCount = (header.size + c_slotPayload - 1) / c_slotPayload;
+
+    for (size_t slot = 1; slot < slotCount; ++slot)
+      std::memcpy(record + slot * c_slotPayload, s_queue.slots[(s_head + slot) & c_slotMask].payload, c_slotPayload);
+
+    // The message is copied out, so its slots can take new messages before the sinks run
+    for (size_t slot = 0; slot < slotCount; ++slot)
+      storeSequence((s_head + slot) & c_slotMask, s_head + slot + c_queueSlots, std::memory_order_release);
+
+    s_head += slotCount;
+    read = true;
+
+    dispatch(header, record + sizeof(RecordHeader), header.size - sizeof(RecordHeader));
+  }
+
+  if (!read)
+    return;
+
+  for (size_t index = 0; index < s_sinkCount; ++index) {
+    if (s_sinks[index].flush != nullptr)
+      s_sinks[index].flush(s_sinks[index].context);
+  }
+}
+
+/// Writes \a size bytes at \a data to \a file.
+void writeBytes(void * file, const void * data, size_t size) noexcept {
+  std::fwrite(data, 1, size, static_cast<std::FILE *>(file));
+}
+
+/// Writes \a text to \a file, preceded by its 16-bit length; longer text is cut.
+void writeString(void * file, string_view text) noexcept {
+  const auto length = static_cast<uint16_t>(text.size() < UINT16_MAX ? text.size() : UINT16_MAX);
+
+  writeBytes(file, &length, sizeof(length));
+  writeBytes(file, text.data(), length);
+}
+
+/// Formats the text line of \a message into \a line, which holds \ref c_maxLineSize characters; returns its size.
+size_t formatLineOf(const Message & message, char * line) noexcept {
+  const size_t size = formatLine(line, c_maxLineSize, message);
+
+  if (size <= c_maxLineSize)
+    return size;
+
+  // Cut lines still end with a line break
+  line[c_maxLineSize - 1] = '\n';
+
+  return c_maxLineSize;
+}
+
+} // namespace
+
+void enqueue(const Site & site, const Argument * arguments, size_t count) noexcept {
+  alignas(RecordHeader) std::byte record[c_maxRecordSize];
+
+  const size_t size = sizeof(RecordHeader) + encodeArguments(record + sizeof(RecordHeader), arguments, count);
+
+  if (t_thread == 0) [[unlikely]]
+    t_thread = static_cast<uint16_t>(s_threadCount.fetch_add(1, std::memory_order_relaxed) + 1);
+
+  const RecordHeader header{&site, chrono::now(), static_cast<uint16_t>(size), t_thread};
+
+  std::memcpy(record, &header, sizeof(header));
+
+  const size_t slotCount = (size + c_slotPayload - 1) / c_slotPayload;
+  uint64_t     position  = s_queue.tail.load(std::memory_order_relaxed);
+  bool         reserved  = false;
+
+  for (;;) {
+    const uint64_t last       = position + slotCount - 1;
+    const auto     difference = static_cast<int64_t>(loadSequence(last & c_slotMask, std::memory_order_acquire) - last);
+
+    if (difference == 0) {
+      if (s_queue.tail.compare_exchange_weak(position, position + slotCount, std::memory_order_relaxed)) {
+        reserved = true;
+        break;
+      }
+    } else if (difference < 0) {
+      // The consumer has not yet freed the previous lap of this slot: the ring is full
+      break;
+    } else {
+      position = s_queue.tail.load(std::memory_order_relaxed);
+    }
+  }
+
+  if (reserved) {
+    for (size_t slot = 0; slot < slotCount; ++slot) {
+      const size_t offset = slot * c_slotPayload;
+      const size_t bytes  = size - offset < c_slotPayload ? size - offset : c_slotPayload;
+
+      std::memcpy(s_queue.slots[(position + slot) & c_slotMask].payload, record + offset, bytes);
+    }
+
+    storeSequence(position & c_slotMask, position + 1, std::memory_order_release);
+  } else {
+    s_queue.dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  if (site.level == Level::Fatal)
+    flush();
+}
+
+void setLevel(Level level) noexcept {
+  g_level.store(level, std::memory_order_relaxed);
+}
+
+bool addSink(const Sink & sink) noexcept {
+  const std::lock_guard lock(s_consumerMutex);
+
+  if (s_sinkCount == c_maxSinks)
+    return false;
+
+  s_sinks[s_sinkCount++] = sink;
+
+  return true;
+}
+
+void removeSink(const void * context) noexcept {
+  const std::lock_guard lock(s_consumerMutex);
+
+  size_t kept = 0;
+
+  for (size_t index = 0; index < s_sinkCount; ++index) {
+    if (s_sinks[index].context != context)
+      s_sinks[kept++] = s_sinks[index];
+  }
+
+  s_sinkCount = kept;
+}
+
+void initialize() noexcept {
+#ifdef TOYGINE_JOB_THREADS
+  if (s_running.exchange(true, std::memory_order_acq_rel))
+    return;
+
+  s_consumer = std::thread(consumerLoop);
+#endif // TOYGINE_JOB_THREADS
+}
+
+void deInitialize() noexcept {
+#ifdef TOYGINE_JOB_THREADS
+  if (s_running.exchange(false, std::memory_order_acq_rel))
+    s_consumer.join();
+#endif // TOYGINE_JOB_THREADS
+
+  flush();
+}
+
+void flush() noexcept {
+  const std::lock_guard lock(s_consumerMutex);
+
+  drain();
+}
+
+uint64_t droppedMessages() noexcept {
+  return s_queue.dropped.load(std::memory_order_relaxed);
+}
+
+size_t formatLine(char * buffer, size_t capacity, const Message & message) noexcept {
+  string_view  file      = message.site->file;
+  const size_t separator = file.find_last_of("/\\");
+
+  if (separator != string_view::npos)
+    file.remove_prefix(separator + 1);
+
+  const double seconds = static_cast<double>(message.time) / 1e9;
+  const char   letter  = c_levelLetters[static_cast<size_t>(message.site->level)];
+
+  return formatTo(buffer, capacity, "{:14.6f} {} [{}] {}:{} {}\n", seconds, letter, message.thread, file,
+                  message.site->line, message.text);
+}
+
+Sink StderrSink::sink() noexcept {
+  const WriteCallback writeMessage = [](const Message & message, [[maybe_unused]] void * context) noexcept {
+    char line[c_maxLineSize];
+
+    std::fwrite(line, 1, formatLineOf(message, line), stderr);
+  };
+
+  return {writeMessage, nullptr, this};
+}
+
+RotatingFileSink::RotatingFileSink(const char * path, size_t maxSize, uint32_t keptFiles) noexcept
+  : _path(path)
+  , _maxSize(maxSize)
+  , _keptFiles(keptFiles)
+  , _file(std::fopen(path, "ab")) {
+  if (_file == nullptr)
+    return;
+
+  auto * file = static_cast<std::FILE *>(_file);
+
+  std::fseek(file, 0, SEEK_END);
+
+  const long size = std::ftell(file);
+
+  _size = size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+RotatingFileSink::~RotatingFileSink() noexcept {
+  if (_file != nullptr)
+    std::fclose(static_cast<std::FILE *>(_file));
+}
+
+bool RotatingFileSink::isOpen() const noexcept {
+  return _file != nullptr;
+}
+
+Sink RotatingFileSink::sink() noexcept {
+  const WriteCallback writeMessage = [](const Message & message, void * context) noexcept {
+    static_cast<RotatingFileSink *>(context)->write(message);
+  };
+
+  const FlushCallback flushFile = [](void * context) noexcept {
+    auto * sink = static_cast<RotatingFileSink *>(context);
+
+    if (sink->_file != nullptr)
+      std::fflush(static_cast<std::FILE *>(sink->_file));
+  };
+
+  return {writeMessage, flushFile, this};
+}
+
+void RotatingFileSink::write(const Message & message) noexcept {
+  char         line[c_maxLineSize];
+  const size_t size = formatLineOf(message, line);
+
+  if (_size > 0 && _size + size > _maxSize)
+    rotate();
+
+  if (_file == nullptr)
+    return;
+
+  writeBytes(_file, line, size);
+  _size += size;
+}
+
+void RotatingFileSink::rotate() noexcept {
+  if (_file != nullptr)
+    std::fclose(static_cast<std::FILE *>(_file));
+
+  // Oldest first, so every rename goes to a name that was just freed
+  FixedString<decltype(_path)::capacity() + 16> from;
+  FixedString<decltype(_path)::capacity() + 16> to;
+
+  for (uint32_t index = _keptFiles; index > 0; --index) {
+    to.clear();
+    formatTo(to, "{}.{}", _path, index);
+
+    if (index == _keptFiles)
+      std::remove(to.c_str());
+
+    from.clear();
+
+    if (index == 1)
+      formatTo(from, "{}", _path);
+    else
+      formatTo(from, "{}.{}", _path, index - 1);
+
+    std::rename(from.c_str(), to.c_str());
+  }
+
+  _file = std::fopen(_path.c_str(), "wb");
+  _size = 0;
+}
+
+BinaryFileSink::BinaryFileSink(const char * path) noexcept
+  : _file(std::fopen(path, "wb")) {
+  if (_file == nullptr)
+    return;
+
+  writeBytes(_file, c_binaryLogMagic.data(), c_binaryLogMagic.size());
+  writeBytes(_file, &c_binaryLogVersion, sizeof(c_binaryLogVersion));
+  writeBytes(_file, &c_byteOrderMark, sizeof(c_byteOrderMark));
+}
+
+BinaryFileSink::~BinaryFileSink() noexcept {
+  if (_file != nullptr)
+    std::fclose(static_cast<std::FILE *>(_file));
+}
+
+bool BinaryFileSink::isOpen() const noexcept {
+  return _file != nullptr;
+}
+
+Sink BinaryFileSink::sink() noexcept {
+  const WriteCallback writeMessage = [](const Message & message, void * context) noexcept {
+    static_cast<BinaryFileSink *>(context)->write(message);
+  };
+
+  const FlushCallback flushFile = [](void * context) noexcept {
+    auto * sink = static_cast<BinaryFileSink *>(context);
+
+    if (sink->_file != nullptr)
+      std::fflush(static_cast<std::FILE *>(sink->_file));
+  };
+
+  return {writeMessage, flushFile, this};
+}
+
+void BinaryFileSink::write(const Message & message) noexcept {
+  if (_file == nullptr)
+    return;
+
+  const Site &   site = *message.site;
+  const uint64_t id   = site.id.value();
+
+  // A full table only costs the site being written again; the reader keeps the first copy
+  if (_sites.find(site.id) == _sites.end()) {
+    const auto     record = static_cast<uint8_t>(BinaryRecord::Site);
+    const auto     level  = static_cast<uint8_t>(site.level);
+    const uint32_t line   = site.line;
+
+    writeBytes(_file, &record, sizeof(record));
+    writeBytes(_file, &id, sizeof(id));
+    writeBytes(_file, &level, sizeof(level));
+    writeBytes(_file, &line, sizeof(line));
+    writeString(_file, site.file);
+    writeString(_file, site.format);
+
+    [[maybe_unused]] const auto inserted = _sites.try_emplace(site.id, true);
+  }
+
+  const auto     record = static_cast<uint8_t>(BinaryRecord::Message);
+  const uint32_t thread = message.thread;
+  const auto     size   = static_cast<uint16_t>(message.argumentsSize);
+
+  writeBytes(_file, &record, sizeof(record));
+  writeBytes(_file, &id, sizeof(id));
+  writeBytes(_file, &message.time, sizeof(message.time));
+  writeBytes(_file, &thread, sizeof(thread));
+  writeBytes(_file, &size, sizeof(size));
+  writeBytes(_file, message.arguments, message.argumentsSize);
+}
+
+BinaryLogReader::BinaryLogReader(const void * data, size_t size) noexcept
+  : _data(static_cast<const std::byte *>(data))
+  , _end(_data + size)
+  , _cursor(_data) {
+  array<char, 4> magic{};
+  uint16_t       version   = 0;
+  uint16_t       byteOrder = 0;
+
+  if (size < c_binaryLogHeaderSize)
+    return;
+
+  std::memcpy(magic.data(), _cursor, magic.size());
+  _cursor += magic.size();
+
+  _valid = take(_cursor, _end, version) && take(_cursor, _end, byteOrder) && magic == c_binaryLogMagic
+        && version == c_binaryLogVersion && byteOrder == c_byteOrderMark;
+}
+
+bool BinaryLogReader::isValid() const noexcept {
+  return _valid;
+}
+
+bool BinaryLogReader::isDamaged() const noexcept {
+  return _damaged;
+}
+
+bool BinaryLogReader::next(Message & message) noexcept {
+  if (!_valid || _damaged)
+    return false;
+
+  // Reading ends cleanly only between two records; every break below stops at damaged data
+  for (;;) {
+    if (_cursor == _end)
+      return false;
+
+    uint8_t  record = 0;
+    uint64_t id     = 0;
+
+    if (!take(_cursor, _end, record) || !take(_cursor, _end, id))
+      break;
+
+    if (record == static_cast<uint8_t>(BinaryRecord::Site)) {
+      uint8_t  level = 0;
+      uint32_t line  = 0;
+      uint16_t size  = 0;
+
+      if (!take(_cursor, _end, level) || level > static_cast<uint8_t>(Level::Fatal) || !take(_cursor, _end, line)
+          || !take(_cursor, _end, size) || static_cast<size_t>(_end - _cursor) < size)
+        break;
+
+      const string_view file(reinterpret_cast<const char *>(_cursor), size);
+      _cursor += size;
+
+      if (!take(_cursor, _end, size) || static_cast<size_t>(_end - _cursor) < size)
+        break;
+
+      const string_view format(reinterpret_cast<const char *>(_cursor), size);
+      _cursor += size;
+
+      const auto result = _sites.try_emplace(StringId(id), static_cast<Level>(level), format, file, line);
+
+      if (result.first == _sites.end())
+        break;
+
+      // The identifier is kept as written, even for text the writer had to cut
+      result.first->value.id = StringId(id);
+      continue;
+    }
+
+    uint64_t time   = 0;
+    uint32_t thread = 0;
+    uint16_t size   = 0;
+
+    if (record != static_cast<uint8_t>(BinaryRecord::Message) || !take(_cursor, _end, time)
+        || !take(_cursor, _end, thread) || !take(_cursor, _end, size) || static_cast<size_t>(_end - _cursor) < size)
+      break;
+
+    const std::byte * arguments = _cursor;
+    _cursor += size;
+
+    const auto site = _sites.find(StringId(id));
+
+    array<Argument, c_maxArguments>     decoded;
+    array<ArgumentKind, c_maxArguments> kinds;
+    size_t                              count = 0;
+
+    // The format string comes from the file, so it is checked before the engine trusts it
+    if (site == _sites.end() || !decodeArguments(arguments, size, decoded.data(), kinds.data(), count)
+        || !formatting::isValidFormat(site->value.format, kinds.data(), count))
+      break;
+
+    message = {&site->value, time, thread, formatText(site->value, decoded.data(), _text), arguments, size};
+
+    return true;
+  }
+
+  _damaged = true;
+
+  return false;
+}
+
+} // namespace toy::log
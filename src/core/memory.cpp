@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   memory.cpp
+  \brief  Peaks, budgets, frame accounting, and statistics of the memory tracker.
+
+  The inline recording path only adds to the calling thread's own counters. Publication, which moves them to the shared
+  counters and checks the peak and the budget, happens here, out of line, once every few dozen allocations.
+*/
+
+#include "core.hpp"
+
+namespace toy::memory {
+
+#ifdef TOYGINE_MEMORY_TRACKING
+
+namespace {
+
+/// Assertion messages of the tags that go over budget, by tag value
+constexpr array<const char *, c_memoryTagCount> c_budgetMessages{
+  "general memory is over its budget", "render memory is over its budget", "audio memory is over its budget",
+  "asset memory is over its budget",   "game memory is over its budget",
+};
+
+/// Budget value that stands for no budget
+constexpr int64_t c_noBudget = INT64_MAX;
+
+#ifdef _DEBUG
+/// Overrun counters of the tags, by tag value, so the reports of one tag do not back off those of another
+constinit array<assertion::CallSite, c_memoryTagCount> g_budgetCallSites{
+  assertion::CallSite(assertion::Repeat::Backoff), assertion::CallSite(assertion::Repeat::Backoff),
+  assertion::CallSite(assertion::Repeat::Backoff), assertion::CallSite(assertion::Repeat::Backoff),
+  assertion::CallSite(assertion::Repeat::Backoff),
+};
+#endif // _DEBUG
+
+/// Publishes the pending changes of every tag of the calling thread.
+void publishAll() noexcept {
+  for (size_t index = 0; index < c_memoryTagCount; ++index)
+    publish(static_cast<MemoryTag>(index));
+}
+
+/// Publishes what a thread has left unpublished when the thread exits.
+struct ThreadExit {
+  ~ThreadExit() noexcept {
+    publishAll();
+  }
+};
+
+/// Created by the first publication of each thread, so only threads that allocate pay for it
+thread_local ThreadExit t_threadExit;
+
+/// Raises the peak of \a counters to \a liveBytes, stamped with the current frame.
+void raisePeak(TagCounters & counters, int64_t liveBytes) noexcept {
+  int64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+
+  while (liveBytes > peak) {
+    if (counters.peakBytes.compare_exchange_weak(peak, liveBytes, std::memory_order_relaxed)) {
+      counters.peakFrame.store(g_frame.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      return;
+    }
+  }
+}
+
+} // namespace
+
+void publish(MemoryTag tag) noexcept {
+  const auto        index   = static_cast<size_t>(tag);
+  PendingCounters & pending = t_pendingCounters[index];
+
+  if (pending.allocations == 0 && pending.deallocations == 0)
+    return;
+
+  // Odr-use constructs the exit hook of this thread on its first publication
+  static_cast<void>(&t_threadExit);
+
+  TagCounters & counters = g_tagCounters[index];
+  const int64_t bytes    = pending.bytes;
+
+  const int64_t liveBytes = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+  counters.allocations.fetch_add(pending.allocations, std::memory_order_relaxed);
+  counters.deallocations.fetch_add(pending.deallocations, std::memory_order_relaxed);
+  pending = {0, 0, 0, c_publishInterval};
+
+  if (liveBytes > counters.peakBytes.load(std::memory_order_relaxed))
+    raisePeak(counters, liveBytes);
+
+  // Only the publication that crosses the budget is an overrun, not every one made while over it
+  const int64_t budget = counters.budget.load(std::memory_order_relaxed);
+
+  if (liveBytes > budget && liveBytes - (bytes > 0 ? bytes : 0) <= budget) [[unlikely]] {
+    counters.budgetOverruns.fetch_add(1, std::memory_order_relaxed);
+
+#ifdef _DEBUG
+    const uint32_t     failures = g_budgetCallSites[index].fail();
+    const char * const message  = c_budgetMessages[index];
+
+    if (failures != 0 && !assertion::assertion("liveBytes <= budget", message, __FILE__, __func__, __LINE__, failures))
+      assertion::debugBreak();
+#endif // _DEBUG
+  }
+}
+
+void setBudget(MemoryTag tag, size_t bytes) noexcept {
+  const bool    limited = bytes != 0 && bytes < static_cast<size_t>(c_noBudget);
+  const int64_t budget  = limited ? static_cast<int64_t>(bytes) : c_noBudget;
+
+  g_tagCounters[static_cast<size_t>(tag)].budget.store(budget, std::memory_order_relaxed);
+}
+
+TagStatistics statistics(MemoryTag tag) noexcept {
+  publishAll();
+
+  const TagCounters & counters = g_tagCounters[static_cast<size_t>(tag)];
+  const int64_t       budget   = counters.budget.load(std::memory_order_relaxed);
+  const int64_t       live     = counters.liveBytes.load(std::memory_order_relaxed);
+
+  // Deallocations are read first, so a concurrent pair cannot make the live count negative
+  const uint64_t deallocations = counters.deallocations.load(std::memory_order_relaxed);
+  const uint64_t allocations   = counters.allocations.load(std::memory_order_relaxed);
+
+  TagStatistics result;
+  result.liveBytes            = live > 0 ? static_cast<size_t>(live) : 0;
+  result.peakBytes            = static_cast<size_t>(counters.peakBytes.load(std::memory_order_relaxed));
+  result.peakFrame            = counters.peakFrame.load(std::memory_order_relaxed);
+  result.budget               = budget != c_noBudget ? static_cast<size_t>(budget) : 0;
+  result.liveAllocations      = allocations > deallocations ? allocations - deallocations : 0;
+  result.frameAllocations     = counters.frameAllocations.load(std::memory_order_relaxed);
+  result.peakFrameAllocations = counters.peakFrameAllocations.load(std::memory_order_relaxed);
+  result.budgetOverruns       = counters.budgetOverruns.load(std::memory_order_relaxed);
+
+  return result;
+}
+
+void beginFrame() noexcept {
+  publishAll();
+  g_frame.fetch_add(1, std::memory_order_relaxed);
+
+  for (TagCounters & counters : g_tagCounters) {
+    const uint64_t allocations = counters.allocations.load(std::memory_order_relaxed);
+    const uint64_t count       = allocations - counters.frameStart.exchange(allocations, std::memory_order_relaxed);
+
+    counters.frameAllocations.store(count, std::memory_order_relaxed);
+
+    // Only this function writes the frame counters, so no exchange loop is needed
+    if (count > counters.peakFrameAllocations.load(std::memory_order_relaxed))
+      counters.peakFrameAllocations.store(count, std::memory_order_relaxed);
+  }
+}
+
+uint64_t frame() noexcept {
+  return g_frame.load(std::memory_order_relaxed);
+}
+
+void resetStatistics() noexcept {
+  for (PendingCounters & pending : t_pendingCounters)
+    pending = {0, 0, 0, c_publishInterval};
+
+  for (TagCounters & counters : g_tagCounters) {
+    counters.liveBytes.store(0, std::memory_order_relaxed);
+    counters.peakBytes.store(0, std::memory_order_relaxed);
+    counters.allocations.store(0, std::memory_order_relaxed);
+    counters.deallocations.store(0, std::memory_order_relaxed);
+    counters.peakFrame.store(0, std::memory_order_relaxed);
+    counters.frameStart.store(0, std::memory_order_relaxed);
+    counters.frameAllocations.store(0, std::memory_order_relaxed);
+    counters.peakFrameAllocations.store(0, std::memory_order_relaxed);
+    counters.budgetOverruns.store(0, std::memory_order_relaxed);
+  }
+
+  g_frame.store(0, std::memory_order_relaxed);
+}
+
+#else // TOYGINE_MEMORY_TRACKING
+
+void setBudget([[maybe_unused]] MemoryTag tag, [[maybe_unused]] size_t bytes) noexcept {}
+
+TagStatistics statistics([[maybe_unused]] MemoryTag tag) noexcept {
+  return {};
+}
+
+void beginFrame() noexcept {}
+
+uint64_t frame() noexcept {
+  return 0;
+}
+
+void resetStatistics() noexcept {}
+
+#endif // TOYGINE_MEMORY_TRACKING
+
+} // namespace toy::memory
@@ -0,0 +1,294 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   platform.cpp
+  \brief  CPU feature, cache, and topology queries behind cpuInfo().
+*/
+
+#include "core.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <cpuid.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif
+
+#if defined(_WIN32) || defined(__linux__) || defined(__APPLE__)
+#include <thread>
+#endif
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <unistd.h>
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+namespace toy::platform {
+
+namespace {
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+
+/// Registers returned by one CPUID query.
+struct CpuidResult {
+  uint32_t eax;
+  uint32_t ebx;
+  uint32_t ecx;
+  uint32_t edx;
+};
+
+/// Runs CPUID for \a leaf and \a subleaf; all zero when the CPU does not have \a leaf.
+CpuidResult cpuid(uint32_t leaf, uint32_t subleaf = 0) noexcept {
+  CpuidResult result{};
+
+#if defined(_MSC_VER) && !defined(__clang__)
+  int registers[4]{};
+
+  __cpuid(registers, 0);
+  if (static_cast<uint32_t>(registers[0]) < leaf)
+    return result;
+
+  __cpuidex(registers, static_cast<int>(leaf), static_cast<int>(subleaf));
+  result = {static_cast<uint32_t>(registers[0]), static_cast<uint32_t>(registers[1]),
+            static_cast<uint32_t>(registers[2]), static_cast<uint32_t>(registers[3])};
+#else
+  unsigned int eax = 0;
+  unsigned int ebx = 0;
+  unsigned int ecx = 0;
+  unsigned int edx = 0;
+
+  if (__get_cpuid_count(leaf, subleaf, &eax, &ebx, &ecx, &edx) != 0)
+    result = {eax, ebx, ecx, edx};
+#endif
+
+  return result;
+}
+
+/// Returns the register state the operating system saves on context switches (XCR0).
+uint64_t savedRegisterState() noexcept {
+#if defined(_MSC_VER) && !defined(__clang__)
+  return _xgetbv(0);
+#else
+  uint32_t low  = 0;
+  uint32_t high = 0;
+
+  __asm__ volatile("xgetbv" : "=a"(low), "=d"(high) : "c"(0));
+
+  return (uint64_t{high} << 32) | low;
+#endif
+}
+
+/// Fills in the features and cache line size from CPUID.
+void detectFeatures(CpuInfo & info) noexcept {
+  const CpuidResult basic = cpuid(1);
+
+  if ((basic.edx & (1U << 26)) != 0)
+    info.features |= static_cast<uint32_t>(CpuFeature::Sse2);
+
+  if ((basic.ecx & (1U << 20)) != 0)
+    info.features |= static_cast<uint32_t>(CpuFeature::Sse42);
+
+  // CLFLUSH line size, in units of 8 bytes
+  if (const uint32_t lineSize = ((basic.ebx >> 8) & 0xFF) * 8; lineSize != 0)
+    info.cacheLineSize = lineSize;
+
+  // AVX code needs both the instructions and an operating system that saves the YMM and ZMM registers
+  const bool osSavesRegisters = (basic.ecx & (1U << 27)) != 0;
+  const bool hasAvx           = (basic.ecx & (1U << 28)) != 0;
+  if (!osSavesRegisters || !hasAvx)
+    return;
+
+  const uint64_t state = savedRegisterState();
+  if ((state & 0x6) != 0x6)
+    return;
+
+  const CpuidResult extended = cpuid(7);
+
+  if ((extended.ebx & (1U << 5)) != 0)
+    info.features |= static_cast<uint32_t>(CpuFeature::Avx2);
+
+  if ((basic.ecx & (1U << 12)) != 0)
+    info.features |= static_cast<uint32_t>(CpuFeature::Fma);
+
+  if ((extended.ebx & (1U << 3)) != 0 && (extended.ebx & (1U << 8)) != 0)
+    info.features |= static_cast<uint32_t>(CpuFeature::Bmi2);
+
+  constexpr uint32_t c_avx512Bits = (1U << 16) | (1U << 30) | (1U << 31); // F, BW, VL
+
+  if ((extended.ebx & c_avx512Bits) == c_avx512Bits && (state & 0xE0) == 0xE0)
+    info.features |= static_cast<uint32_t>(CpuFeature::Avx512);
+}
+
+#elif defined(__aarch64__) || defined(_M_ARM64)
+
+/// Fills in the features and cache line size; Advanced SIMD is part of every ARM64 CPU.
+void detectFeatures(CpuInfo & info) noexcept {
+  info.features |= static_cast<uint32_t>(CpuFeature::Neon);
+
+#if defined(__APPLE__)
+  uint64_t lineSize = 0;
+  size_t   size     = sizeof(lineSize);
+
+  if (sysctlbyname("hw.cachelinesize", &lineSize, &size, nullptr, 0) == 0 && lineSize != 0)
+    info.cacheLineSize = static_cast<uint32_t>(lineSize);
+#elif defined(__GNUC__)
+  // CTR_EL0 gives the smallest data cache line as a power of two in words; Linux lets user code read it
+  uint64_t cacheType = 0;
+
+  __asm__ volatile("mrs %0, ctr_el0" : "=r"(cacheType));
+  info.cacheLineSize = 4U << ((cacheType >> 16) & 0xF);
+#endif
+}
+
+#else
+
+/// Targets without run-time queries keep the defaults of CpuInfo.
+void detectFeatures(CpuInfo &) noexcept {}
+
+#endif
+
+/// Fills in the core and thread counts.
+void detectTopology(CpuInfo & info) noexcept {
+#if defined(_WIN32) || defined(__linux__) || defined(__APPLE__)
+  const unsigned int threads = std::thread::hardware_concurrency();
+
+  info.threadCount = threads != 0 ? threads : 1;
+  info.coreCount   = info.threadCount;
+#endif
+
+#if defined(_WIN32)
+  DWORD size = 0;
+
+  GetLogicalProcessorInformationEx(RelationProcessorCore, nullptr, &size);
+  if (GetLastError() != ERROR_INSUFFICIENT_BUFFER)
+    return;
+
+  auto * buffer = static_cast<char *>(std::malloc(size));
+  if (buffer == nullptr)
+    return;
+
+  if (GetLogicalProcessorInformationEx(RelationProcessorCore,
+                                       reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer), &size)) {
+    uint32_t cores = 0;
+
+    for (DWORD offset = 0; offset < size; ++cores)
+      offset += reinterpret_cast<PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX>(buffer + offset)->Size;
+
+    if (cores != 0)
+      info.coreCount = cores;
+  }
+
+  std::free(buffer);
+#elif defined(__linux__)
+  // A core is counted at its first hardware thread: the one that heads its own sibling list
+  const long configured = sysconf(_SC_NPROCESSORS_CONF);
+  uint32_t   cores      = 0;
+
+  for (long cpu = 0; cpu < configured; ++cpu) {
+    char path[96];
+    std::snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%ld/topology/thread_siblings_list", cpu);
+
+    std::FILE * file = std::fopen(path, "r");
+    if (file == nullptr)
+      continue;
+
+    long first = -1;
+
+    if (std::fscanf(file, "%ld", &first) == 1 && first == cpu)
+      ++cores;
+
+    std::fclose(file);
+  }
+
+  if (cores != 0 && cores <= info.threadCount)
+    info.coreCount = cores;
+#elif defined(__APPLE__)
+  int32_t cores = 0;
+  size_t  size  = sizeof(cores);
+
+  if (sysctlbyname("hw.physicalcpu", &cores, &size, nullptr, 0) == 0 && cores > 0)
+    info.coreCount = static_cast<uint32_t>(cores);
+#endif
+}
+
+#ifdef TOYGINE_SIMD_DISPATCH
+
+/// Returns the highest level the build has kernels for and the CPU runs.
+SimdLevel supportedSimdLevel(const CpuInfo & info) noexcept {
+  constexpr uint32_t c_avx2Features = static_cast<uint32_t>(CpuFeature::Avx2) | static_cast<uint32_t>(CpuFeature::Fma)
+                                    | static_cast<uint32_t>(CpuFeature::Bmi2);
+
+  if (c_highestSimdLevel >= SimdLevel::Avx2 && (info.features & c_avx2Features) == c_avx2Features)
+    return SimdLevel::Avx2;
+
+  if (c_highestSimdLevel >= SimdLevel::Vector128 && (info.has(CpuFeature::Sse2) || info.has(CpuFeature::Neon)))
+    return SimdLevel::Vector128;
+
+  return SimdLevel::Scalar;
+}
+
+/// Applies the cap from the \c TOYGINE_SIMD_LEVEL environment variable, if it names a level.
+SimdLevel cappedSimdLevel(SimdLevel level) noexcept {
+  const char * cap = std::getenv("TOYGINE_SIMD_LEVEL");
+  if (cap == nullptr)
+    return level;
+
+  for (const SimdLevel candidate : {SimdLevel::Scalar, SimdLevel::Vector128, SimdLevel::Avx2}) {
+    if (simdLevelName(candidate) == cap)
+      return candidate < level ? candidate : level;
+  }
+
+  return level;
+}
+
+#endif // TOYGINE_SIMD_DISPATCH
+
+/// Queries everything cpuInfo() reports.
+CpuInfo detectCpu() noexcept {
+  CpuInfo info;
+
+  detectFeatures(info);
+  detectTopology(info);
+
+  // Elsewhere the build flags fix the level, which CpuInfo starts at
+#ifdef TOYGINE_SIMD_DISPATCH
+  info.simdLevel = cappedSimdLevel(supportedSimdLevel(info));
+#endif
+
+  return info;
+}
+
+} // namespace
+
+const CpuInfo & cpuInfo() noexcept {
+  static const CpuInfo s_info = detectCpu();
+
+  return s_info;
+}
+
+} // namespace toy::platform
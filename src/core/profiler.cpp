@@ -0,0 +1,321 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   profiler.cpp
+  \brief  Thread registration, draining, Chrome trace export, and zone statistics of the profiler.
+
+  Thread buffers are allocated on the first zone of each thread and kept until the process exits, so a drain can still
+  read the last zones of a thread that has finished. An exiting thread gives its buffer back, and the next thread to
+  attach takes it over with the records it still holds, so threads that come and go never run out of buffers.
+  Draining is the only consumer of every ring and is serialized by a mutex; the recording threads never take it.
+*/
+
+#include "core.hpp"
+
+#include <mutex>
+#include <new>
+
+namespace toy::profiler {
+
+namespace {
+
+/// Buffers of the registered threads, by thread index
+array<std::atomic<ThreadBuffer *>, c_maxThreads> s_threadBuffers{};
+
+/// Number of thread indices handed out
+std::atomic<uint32_t> s_threadCount{0};
+
+/// Serializes drainZones()
+std::mutex s_drainMutex;
+
+/// Gives the buffer of a thread back when the thread exits.
+struct ThreadExit {
+  ~ThreadExit() noexcept {
+    if (t_threadBuffer != nullptr)
+      t_threadBuffer->detached.store(true, std::memory_order_release);
+
+    t_threadBuffer = nullptr;
+  }
+};
+
+/// Created by the first attachment of each thread, so only threads that record zones pay for it
+thread_local ThreadExit t_threadExit;
+
+/*!
+  \brief Takes over the buffer of a thread that has exited; returns \c nullptr when no such buffer is available.
+
+  Records the exited thread left undrained carry its thread index, which the new owner inherits. Unless \a undrained
+  allows it, buffers that still hold records are skipped; otherwise those records are discarded and counted as
+  dropped, so the trace and the statistics never credit them to the new thread.
+*/
+ThreadBuffer * reuseBuffer(bool undrained) noexcept {
+  const uint32_t count = s_threadCount.load(std::memory_order_acquire);
+
+  for (uint32_t thread = 0; thread < count && thread < c_maxThreads; ++thread) {
+    ThreadBuffer * buffer = s_threadBuffers[thread].load(std::memory_order_acquire);
+    bool           exited = true;
+
+    if (buffer == nullptr || !buffer->detached.load(std::memory_order_acquire))
+      continue;
+
+    if (!undrained && buffer->head.load(std::memory_order_relaxed) != buffer->tail.load(std::memory_order_acquire))
+      continue;
+
+    if (!buffer->detached.compare_exchange_strong(exited, false, std::memory_order_acquire))
+      continue;
+
+    {
+      const std::lock_guard lock(s_drainMutex);
+      const uint64_t        head = buffer->head.load(std::memory_order_relaxed);
+
+      buffer->dropped.fetch_add(head - buffer->tail.load(std::memory_order_relaxed), std::memory_order_relaxed);
+      buffer->tail.store(head, std::memory_order_release);
+    }
+
+    buffer->depth = 0;
+    buffer->name.store(nullptr, std::memory_order_relaxed);
+
+    return buffer;
+  }
+
+  return nullptr;
+}
+
+/// Registers a buffer under a new thread index; returns \c nullptr when every index is taken or the allocation fails.
+ThreadBuffer * newBuffer() noexcept {
+  if (s_threadCount.load(std::memory_order_relaxed) >= c_maxThreads)
+    return nullptr;
+
+  const uint32_t thread = s_threadCount.fetch_add(1, std::memory_order_relaxed);
+
+  if (thread >= c_maxThreads)
+    return nullptr;
+
+  auto * buffer = new (std::nothrow) ThreadBuffer;
+
+  if (buffer == nullptr)
+    return nullptr;
+
+  buffer->thread = thread;
+  s_threadBuffers[thread].store(buffer, std::memory_order_release);
+
+  return buffer;
+}
+
+/// Longest chunk ChromeTraceWriter hands to its callback
+constexpr size_t c_chunkSize = 384;
+
+/// Writes \a nanoseconds as microseconds with three decimals, the unit of the Chrome trace format.
+size_t formatMicroseconds(char * buffer, size_t capacity, uint64_t nanoseconds) noexcept {
+  return formatTo(buffer, capacity, "{}.{:03}", nanoseconds / 1000, nanoseconds % 1000);
+}
+
+/// Writes \a text as a JSON string body, escaping quotes, backslashes, and control characters.
+size_t escapeJson(char * buffer, size_t capacity, const char * text) noexcept {
+  size_t size = 0;
+
+  for (; *text != '\0' && size + 6 < capacity; ++text) {
+    const auto character = static_cast<unsigned char>(*text);
+
+    if (character == '"' || character == '\\') {
+      buffer[size++] = '\\';
+      buffer[size++] = static_cast<char>(character);
+    } else if (character < 0x20) {
+      size += formatTo(buffer + size, capacity - size, "\\u{:04x}", character);
+    } else {
+      buffer[size++] = static_cast<char>(character);
+    }
+  }
+
+  return size;
+}
+
+} // namespace
+
+ThreadBuffer * attachThread() noexcept {
+  // Odr-use constructs the exit hook of this thread, which gives the buffer back
+  static_cast<void>(&t_threadExit);
+
+  // Drained buffers first, then a new index; records of an exited thread are given up only when neither is left
+  ThreadBuffer * buffer = reuseBuffer(false);
+
+  if (buffer == nullptr)
+    buffer = newBuffer();
+
+  if (buffer == nullptr)
+    buffer = reuseBuffer(true);
+
+  t_threadBuffer = buffer;
+
+  return buffer;
+}
+
+void setThreadName(const char * name) noexcept {
+  ThreadBuffer * buffer = t_threadBuffer != nullptr ? t_threadBuffer : attachThread();
+
+  if (buffer != nullptr)
+    buffer->name.store(name, std::memory_order_relaxed);
+}
+
+size_t drainZones(ZoneRecord * records, size_t capacity) noexcept {
+  const std::lock_guard lock(s_drainMutex);
+  size_t                count = 0;
+
+  for (const std::atomic<ThreadBuffer *> & slot : s_threadBuffers) {
+    ThreadBuffer * buffer = slot.load(std::memory_order_acquire);
+
+    if (buffer == nullptr || count == capacity)
+      continue;
+
+    const uint64_t head = buffer->head.load(std::memory_order_acquire);
+    uint64_t       tail = buffer->tail.load(std::memory_order_relaxed);
+
+    for (; tail != head && count != capacity; ++tail)
+      records[count++] = buffer->records[tail & (c_threadBufferSize - 1)];
+
+    buffer->tail.store(tail, std::memory_order_release);
+  }
+
+  return count;
+}
+
+uint64_t droppedZones() noexcept {
+  uint64_t dropped = 0;
+
+  for (const std::atomic<ThreadBuffer *> & slot : s_threadBuffers) {
+    if (const ThreadBuffer * buffer = slot.load(std::memory_order_acquire); buffer != nullptr)
+      dropped += buffer->dropped.load(std::memory_order_relaxed);
+  }
+
+  return dropped;
+}
+
+ChromeTraceWriter::ChromeTraceWriter(TraceWriteCallback callback, void * context) noexcept
+  : _callback(callback)
+  , _context(context) {
+  constexpr string_view header = "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+  emit(header.data(), header.size());
+}
+
+void ChromeTraceWriter::write(const ZoneRecord * records, size_t count) noexcept {
+  if (_finished)
+    return;
+
+  char chunk[c_chunkSize];
+
+  for (size_t index = 0; index < count; ++index) {
+    const ZoneRecord & record = records[index];
+    size_t             size   = 0;
+
+    if (_events++ != 0)
+      chunk[size++] = ',';
+
+    size += formatTo(chunk + size, c_chunkSize - size, "\n{{\"name\":\"");
+    size += escapeJson(chunk + size, c_chunkSize - size - 96, record.site->name);
+    size += formatTo(chunk + size, c_chunkSize - size, "\",\"ph\":\"X\",\"pid\":1,\"tid\":{},\"ts\":", record.thread);
+    size += formatMicroseconds(chunk + size, c_chunkSize - size, record.start);
+    size += formatTo(chunk + size, c_chunkSize - size, ",\"dur\":");
+    size += formatMicroseconds(chunk + size, c_chunkSize - size, record.end - record.start);
+    chunk[size++] = '}';
+
+    emit(chunk, size);
+  }
+}
+
+void ChromeTraceWriter::finish() noexcept {
+  if (_finished)
+    return;
+
+  char chunk[c_chunkSize];
+
+  for (const std::atomic<ThreadBuffer *> & slot : s_threadBuffers) {
+    const ThreadBuffer * buffer = slot.load(std::memory_order_acquire);
+    const char *         name   = buffer != nullptr ? buffer->name.load(std::memory_order_relaxed) : nullptr;
+
+    if (name == nullptr)
+      continue;
+
+    size_t size = 0;
+
+    if (_events++ != 0)
+      chunk[size++] = ',';
+
+    size += formatTo(chunk + size, c_chunkSize - size,
+                     "\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":{},\"args\":{{\"name\":\"",
+                     buffer->thread);
+    size += escapeJson(chunk + size, c_chunkSize - size - 8, name);
+    size += formatTo(chunk + size, c_chunkSize - size, "\"}}}}");
+
+    emit(chunk, size);
+  }
+
+  constexpr string_view footer = "\n]}\n";
+
+  emit(footer.data(), footer.size());
+  _finished = true;
+}
+
+void ChromeTraceWriter::emit(const char * text, size_t size) noexcept {
+  if (_callback != nullptr)
+    _callback(text, size, _context);
+}
+
+void ZoneStatistics::add(const ZoneRecord * records, size_t count) noexcept {
+  for (size_t index = 0; index < count; ++index) {
+    const ZoneRecord & record   = records[index];
+    const uint64_t     duration = record.end - record.start;
+    const uint32_t     depth    = record.depth < c_maxDepth ? record.depth : c_maxDepth - 1;
+    auto &             children = _childTime[record.thread];
+
+    // Zones nested in this one ended just before it, one level deeper
+    const uint64_t nested = children[depth + 1] < duration ? children[depth + 1] : duration;
+    children[depth + 1]   = 0;
+    children[depth] += duration;
+
+    const auto [entry, inserted] = _zones.try_emplace(record.site->id, ZoneTotals{record.site->name, 0, 0, 0, 0});
+
+    if (entry == _zones.end())
+      continue;
+
+    ZoneTotals & totals = entry->value;
+    totals.calls += 1;
+    totals.totalTime += duration;
+    totals.selfTime += duration - nested;
+    totals.maxTime = duration > totals.maxTime ? duration : totals.maxTime;
+  }
+}
+
+const ZoneTotals * ZoneStatistics::find(StringId id) const noexcept {
+  const auto entry = _zones.find(id);
+
+  return entry != _zones.end() ? &entry->value : nullptr;
+}
+
+auto ZoneStatistics::zones() const noexcept -> const Map & {
+  return _zones;
+}
+
+void ZoneStatistics::clear() noexcept {
+  _zones.clear();
+  _childTime = {};
+}
+
+} // namespace toy::profiler
@@ -0,0 +1,373 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   stack_trace.cpp
+  \brief  Stack capture, cached symbolization, and the crash-signal trace writer.
+
+  Capture and symbolization are split on purpose. captureStack() only records return addresses through the unwinder
+  of the compiler runtime, which neither allocates nor takes locks once warmed up. walkStack() resolves them later with
+  \c dladdr() and caches each line by address. The crash handler never resolves names: it prints module offsets from a
+  table filled when it was installed.
+
+  Linux Desktop only; other targets compile the empty definitions at the end of the file.
+*/
+
+#include "core.hpp"
+
+#if defined(__linux__)
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <link.h>
+#include <signal.h>
+#include <unistd.h>
+#include <unwind.h>
+
+#include <cstdlib>
+#include <mutex>
+#endif // __linux__
+
+namespace toy::assertion {
+
+#if defined(__linux__)
+
+namespace {
+
+/// Lines kept by the symbol cache
+constexpr size_t c_symbolCacheSize = 128;
+
+/// Longest cached line, without the frame index
+constexpr size_t c_symbolSize = 248;
+
+/// Most modules the crash handler can name
+constexpr size_t c_maxModules = 64;
+
+/// Size of the alternate signal stack
+constexpr size_t c_signalStackSize = 64 * 1024;
+
+/// Signals the crash handler reports
+constexpr array<int, 5> c_crashSignals{SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT};
+
+/// Resolved text of one return address.
+struct SymbolEntry {
+  /// Return address; 0 when the entry is free
+  uintptr_t address;
+
+  /// Terminated text: address, function, and module
+  char text[c_symbolSize];
+};
+
+/// Address range of one loaded module, for the crash handler.
+struct Module {
+  /// First mapped address
+  uintptr_t start;
+
+  /// Address past the last mapped byte
+  uintptr_t end;
+
+  /// Load bias that offsets are taken from
+  uintptr_t base;
+
+  /// File path; empty for the main executable
+  const char * name;
+};
+
+/// State of captureStack() shared with the unwinder callback.
+struct CaptureState {
+  uintptr_t * frames;
+  size_t      capacity;
+  size_t      skip;
+  size_t      size;
+};
+
+/// Direct-mapped cache of resolved lines, indexed by a hash of the address
+array<SymbolEntry, c_symbolCacheSize> s_symbols{};
+
+/// Guards s_symbols
+std::mutex s_symbolsMutex;
+
+/// Modules listed by installCrashHandlers()
+array<Module, c_maxModules> s_modules{};
+
+/// Entries of s_modules in use
+size_t s_moduleCount = 0;
+
+/// Descriptor the crash handler writes to
+int s_crashDescriptor = -1;
+
+/// Handlers replaced by installCrashHandlers(), in c_crashSignals order
+array<struct sigaction, c_crashSignals.size()> s_previousActions{};
+
+/// Set once the handlers are installed
+bool s_crashHandlersInstalled = false;
+
+/// Set by the first crash, so a second fatal signal does not interleave its trace
+std::atomic_flag s_crashing;
+
+/// Alternate stack the crash handler runs on
+alignas(16) char s_signalStack[c_signalStackSize];
+
+_Unwind_Reason_Code collectFrame(_Unwind_Context * context, void * argument) noexcept {
+  auto &          state   = *static_cast<CaptureState *>(argument);
+  const uintptr_t address = _Unwind_GetIP(context);
+
+  if (address == 0)
+    return _URC_END_OF_STACK;
+
+  if (state.skip > 0) {
+    --state.skip;
+    return _URC_NO_REASON;
+  }
+
+  state.frames[state.size++] = address;
+
+  return state.size < state.capacity ? _URC_NO_REASON : _URC_END_OF_STACK;
+}
+
+/// Writes the text of \a address into \a buffer, terminated; returns the length.
+size_t symbolize(uintptr_t address, char * buffer, size_t capacity) noexcept {
+  // A return address points after the call; the instruction before it belongs to the calling line
+  const uintptr_t lookup = address - 1;
+  Dl_info         info{};
+  size_t          size   = 0;
+  const size_t    limit  = capacity - 1;
+  const bool      loaded = dladdr(reinterpret_cast<void *>(lookup), &info) != 0;
+
+  size = formatTo(buffer, limit, "0x{:016x}", address);
+
+  if (loaded && info.dli_sname != nullptr && size < limit) {
+    int    status    = 0;
+    char * demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+
+    size += formatTo(buffer + size, limit - size, " {}+0x{:x}", status == 0 ? demangled : info.dli_sname,
+                     address - reinterpret_cast<uintptr_t>(info.dli_saddr));
+    std::free(demangled);
+  }
+
+  if (loaded && info.dli_fname != nullptr && size < limit) {
+    size += formatTo(buffer + size, limit - size, " ({}+0x{:x})", info.dli_fname,
+                     address - reinterpret_cast<uintptr_t>(info.dli_fbase));
+  }
+
+  size = size < limit ? size : limit;
+  buffer[size] = '\0';
+
+  return size;
+}
+
+int listModule(dl_phdr_info * info, [[maybe_unused]] size_t size, [[maybe_unused]] void * data) noexcept {
+  if (s_moduleCount == c_maxModules)
+    return 1;
+
+  Module module{UINTPTR_MAX, 0, info->dlpi_addr, info->dlpi_name};
+
+  for (ElfW(Half) index = 0; index < info->dlpi_phnum; ++index) {
+    const ElfW(Phdr) & header = info->dlpi_phdr[index];
+
+    if (header.p_type != PT_LOAD)
+      continue;
+
+    const uintptr_t start = info->dlpi_addr + header.p_vaddr;
+    module.start          = start < module.start ? start : module.start;
+    module.end            = start + header.p_memsz > module.end ? start + header.p_memsz : module.end;
+  }
+
+  if (module.start < module.end)
+    s_modules[s_moduleCount++] = module;
+
+  return 0;
+}
+
+/// Writes \a size characters to the crash descriptor, retrying short writes.
+void writeAll(const char * text, size_t size) noexcept {
+  while (size > 0) {
+    const ssize_t written = ::write(s_crashDescriptor, text, size);
+
+    if (written <= 0)
+      return;
+
+    text += written;
+    size -= static_cast<size_t>(written);
+  }
+}
+
+const char * signalName(int signal) noexcept {
+  switch (signal) {
+    case SIGSEGV:
+      return "SIGSEGV";
+    case SIGBUS:
+      return "SIGBUS";
+    case SIGFPE:
+      return "SIGFPE";
+    case SIGILL:
+      return "SIGILL";
+    case SIGABRT:
+      return "SIGABRT";
+    default:
+      return "signal";
+  }
+}
+
+// Uses only write(), sigaction(), raise(), the unwinder, and the allocation-free formatter
+void handleCrash(int signal, [[maybe_unused]] siginfo_t * info, [[maybe_unused]] void * context) noexcept {
+  if (!s_crashing.test_and_set()) {
+    char   line[512];
+    size_t size = formatTo(line, sizeof(line), "Fatal signal {} ({})\n", signal, signalName(signal));
+    writeAll(line, size < sizeof(line) ? size : sizeof(line));
+
+    uintptr_t    frames[c_maxStackFrames];
+    const size_t count = captureStack(frames, c_maxStackFrames, 1);
+
+    for (size_t index = 0; index < count; ++index) {
+      const Module * module = nullptr;
+
+      for (size_t entry = 0; entry < s_moduleCount; ++entry) {
+        if (frames[index] >= s_modules[entry].start && frames[index] < s_modules[entry].end) {
+          module = &s_modules[entry];
+          break;
+        }
+      }
+
+      if (module != nullptr) {
+        size = formatTo(line, sizeof(line), "#{} 0x{:016x} ({}+0x{:x})\n", index, frames[index],
+                        *module->name != '\0' ? module->name : "<executable>", frames[index] - module->base);
+      } else {
+        size = formatTo(line, sizeof(line), "#{} 0x{:016x}\n", index, frames[index]);
+      }
+
+      writeAll(line, size < sizeof(line) ? size : sizeof(line));
+    }
+  }
+
+  // Let the previous handler, usually the default action, terminate the process
+  for (size_t index = 0; index < c_crashSignals.size(); ++index) {
+    if (c_crashSignals[index] == signal)
+      ::sigaction(signal, &s_previousActions[index], nullptr);
+  }
+
+  ::raise(signal);
+}
+
+} // namespace
+
+size_t captureStack(uintptr_t * frames, size_t capacity, size_t skip) noexcept {
+  if (capacity == 0)
+    return 0;
+
+  // The first frame reported by the unwinder is this function
+  CaptureState state{frames, capacity, skip + 1, 0};
+  _Unwind_Backtrace(collectFrame, &state);
+
+  return state.size;
+}
+
+void walkStack(const uintptr_t * frames, size_t count, StackWalkCallback callback) noexcept {
+  if (callback == nullptr)
+    return;
+
+  char line[c_symbolSize + 16];
+
+  for (size_t index = 0; index < count; ++index) {
+    const uintptr_t address = frames[index];
+    const size_t    prefix  = formatTo(line, sizeof(line), "#{} ", index);
+
+    {
+      const std::lock_guard lock(s_symbolsMutex);
+      SymbolEntry &         entry = s_symbols[(address * 0x9E3779B97F4A7C15U >> 57) % c_symbolCacheSize];
+
+      if (entry.address != address) {
+        symbolize(address, entry.text, sizeof(entry.text));
+        entry.address = address;
+      }
+
+      const size_t size = std::strlen(entry.text);
+      std::memcpy(line + prefix, entry.text, size + 1);
+    }
+
+    callback(line);
+  }
+}
+
+bool installCrashHandlers(int fileDescriptor) noexcept {
+  if (s_crashHandlersInstalled)
+    removeCrashHandlers();
+
+  s_crashDescriptor = fileDescriptor;
+  s_moduleCount     = 0;
+  dl_iterate_phdr(listModule, nullptr);
+
+  // The first unwind loads the unwinder tables; do it here rather than inside a signal handler
+  uintptr_t warmUp[1];
+  static_cast<void>(captureStack(warmUp, 1));
+
+  stack_t stack{};
+  stack.ss_sp   = s_signalStack;
+  stack.ss_size = sizeof(s_signalStack);
+
+  if (::sigaltstack(&stack, nullptr) != 0)
+    return false;
+
+  struct sigaction action{};
+  action.sa_sigaction = handleCrash;
+  action.sa_flags     = SA_SIGINFO | SA_ONSTACK;
+  sigemptyset(&action.sa_mask);
+
+  for (size_t index = 0; index < c_crashSignals.size(); ++index) {
+    if (::sigaction(c_crashSignals[index], &action, &s_previousActions[index]) != 0) {
+      for (size_t installed = 0; installed < index; ++installed)
+        ::sigaction(c_crashSignals[installed], &s_previousActions[installed], nullptr);
+
+      return false;
+    }
+  }
+
+  s_crashHandlersInstalled = true;
+
+  return true;
+}
+
+void removeCrashHandlers() noexcept {
+  if (!s_crashHandlersInstalled)
+    return;
+
+  for (size_t index = 0; index < c_crashSignals.size(); ++index)
+    ::sigaction(c_crashSignals[index], &s_previousActions[index], nullptr);
+
+  s_crashHandlersInstalled = false;
+}
+
+#else // __linux__
+
+size_t captureStack([[maybe_unused]] uintptr_t * frames, [[maybe_unused]] size_t capacity,
+                    [[maybe_unused]] size_t skip) noexcept {
+  return 0;
+}
+
+void walkStack([[maybe_unused]] const uintptr_t * frames, [[maybe_unused]] size_t count,
+               [[maybe_unused]] StackWalkCallback callback) noexcept {}
+
+bool installCrashHandlers([[maybe_unused]] int fileDescriptor) noexcept {
+  return false;
+}
+
+void removeCrashHandlers() noexcept {}
+
+#endif // __linux__
+
+} // namespace toy::assertion
@@ -21,12 +21,21 @@
   \file   utils.cpp
   \brief  Implementation details for the core string and UTF-8 utilities.
 
-  Defines the internal UTF-8 character-size lookup table used for O(1) sequence-length decoding; further utility
-  definitions are added here as the API grows.
+  Defines the internal UTF-8 character-size lookup table used for O(1) sequence-length decoding, the table-driven
+  \ref toy::scalar routines built on it, and the vectorized ASCII fast paths the public UTF-8 routines use on desktop
+  targets. The fast paths are compiled once per \ref toy::platform::SimdLevel from utils_kernels.inl, and each public
+  routine calls the one platform::selectKernel() picks.
 */
 
+#include <bit>
+#include <cstring>
+
 #include "core.hpp"
 
+#ifdef TOYGINE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
 namespace toy {
 
 namespace {
@@ -68,6 +77,885 @@ constexpr array<uint8_t, 256> c_utf8CharSizeTable{
    }
 };
 
+/*!
+  \brief Returns the length of the valid UTF-8 sequence at the start of a buffer, or 0 when it is not valid.
+
+  The lead byte is classified through \ref c_utf8CharSizeTable; the second byte is then range-checked for the four lead
+  bytes whose valid continuations are narrower than 0x80-0xBF (overlong 3- and 4-byte forms, surrogates, and code points
+  above U+10FFFF).
+
+  \param data      First byte of the sequence.
+  \param remaining Bytes available from \a data to the end of the buffer; at least 1.
+*/
+inline size_t validSequenceLength(const uint8_t * data, size_t remaining) noexcept {
+  const uint8_t lead   = data[0];
+  const size_t  length = c_utf8CharSizeTable[lead];
+
+  if (length <= 1)
+    return length;
+
+  if (remaining < length)
+    return 0;
+
+  uint8_t lowest  = 0x80;
+  uint8_t highest = 0xBF;
+
+  switch (lead) {
+    case 0xE0:
+      lowest = 0xA0;
+      break;
+
+    case 0xED:
+      highest = 0x9F;
+      break;
+
+    case 0xF0:
+      lowest = 0x90;
+      break;
+
+    case 0xF4:
+      highest = 0x8F;
+      break;
+
+    default:
+      break;
+  }
+
+  if (data[1] < lowest || data[1] > highest)
+    return 0;
+
+  for (size_t index = 2; index < length; ++index) {
+    if ((data[index] & 0xC0) != 0x80)
+      return 0;
+  }
+
+  return length;
+}
+
+/*!
+  \brief Decodes a sequence already accepted by validSequenceLength().
+
+  \param data   First byte of the sequence.
+  \param length Sequence length returned by validSequenceLength().
+*/
+inline char32_t decodeSequence(const uint8_t * data, size_t length) noexcept {
+  switch (length) {
+    case 1:
+      return data[0];
+
+    case 2:
+      return (char32_t{data[0] & 0x1FU} << 6) | (data[1] & 0x3FU);
+
+    case 3:
+      return (char32_t{data[0] & 0x0FU} << 12) | (char32_t{data[1] & 0x3FU} << 6) | (data[2] & 0x3FU);
+
+    default:
+      return (char32_t{data[0] & 0x07U} << 18) | (char32_t{data[1] & 0x3FU} << 12) | (char32_t{data[2] & 0x3FU} << 6)
+           | (data[3] & 0x3FU);
+  }
+}
+
+/// Appends a code point to UTF-32 output.
+inline void appendCodePoint(char32_t codePoint, char32_t * destination, size_t & written) noexcept {
+  destination[written++] = codePoint;
+}
+
+/// Appends a code point to UTF-16 output, as a surrogate pair above U+FFFF.
+inline void appendCodePoint(char32_t codePoint, char16_t * destination, size_t & written) noexcept {
+  if (codePoint < 0x10000) {
+    destination[written++] = static_cast<char16_t>(codePoint);
+    return;
+  }
+
+  codePoint -= 0x10000;
+  destination[written++] = static_cast<char16_t>(0xD800 + (codePoint >> 10));
+  destination[written++] = static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF));
+}
+
+/// Appends a Unicode scalar value to UTF-8 output.
+inline void appendUtf8(char32_t codePoint, uint8_t * destination, size_t & written) noexcept {
+  if (codePoint < 0x80) {
+    destination[written++] = static_cast<uint8_t>(codePoint);
+  } else if (codePoint < 0x800) {
+    destination[written++] = static_cast<uint8_t>(0xC0 | (codePoint >> 6));
+    destination[written++] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+  } else if (codePoint < 0x10000) {
+    destination[written++] = static_cast<uint8_t>(0xE0 | (codePoint >> 12));
+    destination[written++] = static_cast<uint8_t>(0x80 | ((codePoint >> 6) & 0x3F));
+    destination[written++] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+  } else {
+    destination[written++] = static_cast<uint8_t>(0xF0 | (codePoint >> 18));
+    destination[written++] = static_cast<uint8_t>(0x80 | ((codePoint >> 12) & 0x3F));
+    destination[written++] = static_cast<uint8_t>(0x80 | ((codePoint >> 6) & 0x3F));
+    destination[written++] = static_cast<uint8_t>(0x80 | (codePoint & 0x3F));
+  }
+}
+
+/*!
+  \brief Returns the length of the valid UTF-16 sequence at the start of a buffer, or 0 for an unpaired surrogate.
+
+  \param data      First code unit of the sequence.
+  \param remaining Code units available from \a data to the end of the buffer; at least 1.
+*/
+inline size_t utf16SequenceLength(const char16_t * data, size_t remaining) noexcept {
+  if ((data[0] & 0xF800) != 0xD800)
+    return 1;
+
+  if (data[0] >= 0xDC00 || remaining < 2 || (data[1] & 0xFC00) != 0xDC00)
+    return 0;
+
+  return 2;
+}
+
+/// Decodes a surrogate pair already accepted by utf16SequenceLength().
+inline char32_t decodeSurrogatePair(const char16_t * data) noexcept {
+  return 0x10000 + ((char32_t{data[0]} - 0xD800) << 10) + (char32_t{data[1]} - 0xDC00);
+}
+
+/// UTF-8 bytes a valid UTF-16 code unit contributes; each half of a surrogate pair contributes 2.
+inline size_t utf8UnitLength(char16_t unit) noexcept {
+  return 1 + (unit >= 0x80 ? 1 : 0) + (unit >= 0x800 ? 1 : 0) - ((unit & 0xF800) == 0xD800 ? 1 : 0);
+}
+
+/// UTF-8 bytes a Unicode scalar value encodes to.
+inline size_t utf8UnitLength(char32_t codePoint) noexcept {
+  return 1 + (codePoint >= 0x80 ? 1 : 0) + (codePoint >= 0x800 ? 1 : 0) + (codePoint >= 0x10000 ? 1 : 0);
+}
+
+/// Table-driven validation of \a data from \a position to \a size.
+size_t validLengthFrom(const uint8_t * data, size_t size, size_t position) noexcept {
+  while (position < size) {
+    const size_t length = validSequenceLength(data + position, size - position);
+    if (length == 0)
+      return position;
+
+    position += length;
+  }
+
+  return size;
+}
+
+/// Table-driven decoding of \a data from \a position to \a size, appending to \a destination after \a written units.
+template <typename Unit>
+TranscodeResult decodeFrom(const uint8_t * data, size_t size, size_t position, Unit * destination,
+                           size_t written) noexcept {
+  while (position < size) {
+    const size_t length = validSequenceLength(data + position, size - position);
+    if (length == 0)
+      break;
+
+    appendCodePoint(decodeSequence(data + position, length), destination, written);
+    position += length;
+  }
+
+  return {position, written};
+}
+
+/// Per-unit UTF-16 to UTF-8 transcoding of \a data from \a position to \a size.
+TranscodeResult utf16ToUtf8From(const char16_t * data, size_t size, size_t position, uint8_t * destination,
+                                size_t written) noexcept {
+  while (position < size) {
+    const size_t length = utf16SequenceLength(data + position, size - position);
+    if (length == 0)
+      break;
+
+    appendUtf8(length == 1 ? char32_t{data[position]} : decodeSurrogatePair(data + position), destination, written);
+    position += length;
+  }
+
+  return {position, written};
+}
+
+/// Per-unit UTF-32 to UTF-8 transcoding of \a data from \a position to \a size.
+TranscodeResult utf32ToUtf8From(const char32_t * data, size_t size, size_t position, uint8_t * destination,
+                                size_t written) noexcept {
+  for (; position < size; ++position) {
+    const char32_t codePoint = data[position];
+    if (codePoint > 0x10FFFF || (codePoint & 0xFFFFF800) == 0xD800)
+      break;
+
+    appendUtf8(codePoint, destination, written);
+  }
+
+  return {position, written};
+}
+
+/// Sum of utf8UnitLength() over \a size UTF-16 or UTF-32 code units.
+template <typename Unit>
+size_t utf8LengthOf(const Unit * data, size_t size) noexcept {
+  size_t length = 0;
+
+  for (size_t index = 0; index < size; ++index)
+    length += utf8UnitLength(data[index]);
+
+  return length;
+}
+
+/// Machine word the byte-string kernels step by outside the vector paths: 4 bytes on 32-bit targets, 8 on 64-bit ones.
+using Word = size_t;
+
+/// Word with 0x01 in every byte
+constexpr Word c_lowBits = ~Word{0} / 0xFF;
+
+/// Word with 0x7F in every byte
+constexpr Word c_lowSevenBits = c_lowBits * 0x7F;
+
+/// Unaligned load of one machine word.
+inline Word loadWord(const char * data) noexcept {
+  Word word;
+  std::memcpy(&word, data, sizeof(Word));
+
+  return word;
+}
+
+/*!
+  \brief Sets the high bit of exactly the zero bytes of a word.
+
+  Unlike the shorter borrow-based test, no carry crosses a byte boundary, so no byte is flagged falsely and the result
+  holds for either byte order.
+*/
+inline Word zeroBytes(Word word) noexcept {
+  return ~(((word & c_lowSevenBits) + c_lowSevenBits) | word | c_lowSevenBits);
+}
+
+/// Memory-order index of the first byte with any bit set in a nonzero word.
+inline size_t firstSetByte(Word word) noexcept {
+  if constexpr (std::endian::native == std::endian::little)
+    return static_cast<size_t>(std::countr_zero(word)) / 8;
+  else
+    return static_cast<size_t>(std::countl_zero(word)) / 8;
+}
+
+/// Byte-wise comparison of \a left and \a right from \a position to \a size.
+int compareFrom(const char * left, const char * right, size_t position, size_t size) noexcept {
+  for (; position < size; ++position) {
+    const int difference = int{static_cast<uint8_t>(left[position])} - int{static_cast<uint8_t>(right[position])};
+    if (difference != 0)
+      return difference;
+  }
+
+  return 0;
+}
+
+/// Byte-wise search of \a string from \a position to \a size.
+const char * findCharFrom(const char * string, size_t size, size_t position, char character) noexcept {
+  for (; position < size; ++position) {
+    if (string[position] == character)
+      return string + position;
+  }
+
+  return nullptr;
+}
+
+#ifdef TOYGINE_SIMD_VECTOR128
+
+/// Byte-wise count of the bytes that start a sequence, i.e. every byte outside the continuation range 0x80-0xBF.
+size_t countLeadBytes(const uint8_t * data, size_t size) noexcept {
+  size_t count = 0;
+
+  for (size_t index = 0; index < size; ++index)
+    count += static_cast<int8_t>(data[index]) >= -0x40 ? 1 : 0;
+
+  return count;
+}
+
+/// Byte-wise count of the UTF-16 code units valid UTF-8 decodes to: one per lead byte, plus one per 4-byte lead.
+size_t countUtf16Units(const uint8_t * data, size_t size) noexcept {
+  size_t count = 0;
+
+  for (size_t index = 0; index < size; ++index)
+    count += (static_cast<int8_t>(data[index]) >= -0x40 ? 1 : 0) + (data[index] >= 0xF0 ? 1 : 0);
+
+  return count;
+}
+
+/// 128-bit fast paths, with SSE2 or NEON.
+namespace vector128 {
+
+/*!
+  \brief One vector block of text, as seen by the ASCII fast paths.
+
+  \c c_size is the block width: bytes of UTF-8, or code units of UTF-16 and UTF-32, which then span two or four
+  registers. asciiPrefix() returns how many leading bytes of a UTF-8 block are ASCII (\c c_size when all are),
+  leadCount() counts the bytes that start a sequence, and fourByteLeadCount() the leads of 4-byte sequences.
+  widenAscii() zero-extends an all-ASCII UTF-8 block to UTF-16 or UTF-32; isAscii() and narrowAscii() test and pack a
+  UTF-16 or UTF-32 block the other way. utf8Length() returns the UTF-8 size of a valid UTF-16 or UTF-32 block.
+  byteMask() and equalMask() return one bit per byte that matches a given byte or the other block, \c c_allEqual when
+  all do, for the byte-string kernels. All loads are unaligned.
+
+  Each SIMD level defines a block of this shape in its own namespace, and utils_kernels.inl builds the fast paths
+  on it.
+*/
+struct VectorBlock {
+#if defined(__aarch64__) || defined(_M_ARM64)
+
+  static constexpr size_t c_size = 16;
+
+  static size_t asciiPrefix(const uint8_t * data) noexcept {
+    const uint8x16_t bytes = vld1q_u8(data);
+    if (vmaxvq_u8(bytes) < 0x80)
+      return c_size;
+
+    // Narrow the per-byte 0x00/0xFF mask to one nibble per byte so a 64-bit scan finds the first non-ASCII byte
+    const uint8x16_t nonAscii = vcgeq_u8(bytes, vdupq_n_u8(0x80));
+    const uint64_t   nibbles  = vget_lane_u64(vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(nonAscii), 4)), 0);
+
+    return static_cast<size_t>(std::countr_zero(nibbles)) / 4;
+  }
+
+  static size_t leadCount(const uint8_t * data) noexcept {
+    const uint8x16_t leads = vcgtq_s8(vreinterpretq_s8_u8(vld1q_u8(data)), vdupq_n_s8(-0x41));
+
+    return vaddvq_u8(vandq_u8(leads, vdupq_n_u8(1)));
+  }
+
+  static size_t fourByteLeadCount(const uint8_t * data) noexcept {
+    const uint8x16_t leads = vcgeq_u8(vld1q_u8(data), vdupq_n_u8(0xF0));
+
+    return vaddvq_u8(vandq_u8(leads, vdupq_n_u8(1)));
+  }
+
+  static void widenAscii(const uint8_t * data, char16_t * destination) noexcept {
+    const uint8x16_t bytes = vld1q_u8(data);
+    auto *           out   = reinterpret_cast<uint16_t *>(destination);
+
+    vst1q_u16(out, vmovl_u8(vget_low_u8(bytes)));
+    vst1q_u16(out + 8, vmovl_u8(vget_high_u8(bytes)));
+  }
+
+  static void widenAscii(const uint8_t * data, char32_t * destination) noexcept {
+    const uint8x16_t bytes = vld1q_u8(data);
+    const uint16x8_t low   = vmovl_u8(vget_low_u8(bytes));
+    const uint16x8_t high  = vmovl_u8(vget_high_u8(bytes));
+    auto *           out   = reinterpret_cast<uint32_t *>(destination);
+
+    vst1q_u32(out, vmovl_u16(vget_low_u16(low)));
+    vst1q_u32(out + 4, vmovl_u16(vget_high_u16(low)));
+    vst1q_u32(out + 8, vmovl_u16(vget_low_u16(high)));
+    vst1q_u32(out + 12, vmovl_u16(vget_high_u16(high)));
+  }
+
+  static bool isAscii(const char16_t * data) noexcept {
+    const auto * units = reinterpret_cast<const uint16_t *>(data);
+
+    return vmaxvq_u16(vmaxq_u16(vld1q_u16(units), vld1q_u16(units + 8))) < 0x80;
+  }
+
+  static bool isAscii(const char32_t * data) noexcept {
+    const auto *     units   = reinterpret_cast<const uint32_t *>(data);
+    const uint32x4_t highest = vmaxq_u32(vmaxq_u32(vld1q_u32(units), vld1q_u32(units + 4)),
+                                         vmaxq_u32(vld1q_u32(units + 8), vld1q_u32(units + 12)));
+
+    return vmaxvq_u32(highest) < 0x80;
+  }
+
+  static void narrowAscii(const char16_t * data, uint8_t * destination) noexcept {
+    const auto * units = reinterpret_cast<const uint16_t *>(data);
+
+    vst1q_u8(destination, vcombine_u8(vmovn_u16(vld1q_u16(units)), vmovn_u16(vld1q_u16(units + 8))));
+  }
+
+  static void narrowAscii(const char32_t * data, uint8_t * destination) noexcept {
+    const auto *     units = reinterpret_cast<const uint32_t *>(data);
+    const uint16x8_t low   = vcombine_u16(vmovn_u32(vld1q_u32(units)), vmovn_u32(vld1q_u32(units + 4)));
+    const uint16x8_t high  = vcombine_u16(vmovn_u32(vld1q_u32(units + 8)), vmovn_u32(vld1q_u32(units + 12)));
+
+    vst1q_u8(destination, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+  }
+
+  static size_t utf8Length(const char16_t * data) noexcept {
+    const auto * units  = reinterpret_cast<const uint16_t *>(data);
+    size_t       length = c_size;
+
+    // A surrogate is always at least U+0800, so the per-lane sum below never underflows
+    for (size_t offset = 0; offset < c_size; offset += 8) {
+      const uint16x8_t unit      = vld1q_u16(units + offset);
+      const uint16x8_t above7F   = vshrq_n_u16(vcgeq_u16(unit, vdupq_n_u16(0x80)), 15);
+      const uint16x8_t above7FF  = vshrq_n_u16(vcgeq_u16(unit, vdupq_n_u16(0x800)), 15);
+      const uint16x8_t plane     = vandq_u16(unit, vdupq_n_u16(0xF800));
+      const uint16x8_t surrogate = vshrq_n_u16(vceqq_u16(plane, vdupq_n_u16(0xD800)), 15);
+
+      length += vaddvq_u16(vsubq_u16(vaddq_u16(above7F, above7FF), surrogate));
+    }
+
+    return length;
+  }
+
+  static size_t utf8Length(const char32_t * data) noexcept {
+    const auto * units  = reinterpret_cast<const uint32_t *>(data);
+    size_t       length = c_size;
+
+    for (size_t offset = 0; offset < c_size; offset += 4) {
+      const uint32x4_t unit  = vld1q_u32(units + offset);
+      const uint32x4_t extra = vaddq_u32(vaddq_u32(vshrq_n_u32(vcgtq_u32(unit, vdupq_n_u32(0x7F)), 31),
+                                                   vshrq_n_u32(vcgtq_u32(unit, vdupq_n_u32(0x7FF)), 31)),
+                                         vshrq_n_u32(vcgtq_u32(unit, vdupq_n_u32(0xFFFF)), 31));
+
+      length += vaddvq_u32(extra);
+    }
+
+    return length;
+  }
+
+  static constexpr uint32_t c_allEqual = 0xFFFF;
+
+  static uint32_t byteMask(const uint8_t * data, uint8_t byte) noexcept {
+    return bitMask(vceqq_u8(vld1q_u8(data), vdupq_n_u8(byte)));
+  }
+
+  static uint32_t equalMask(const uint8_t * left, const uint8_t * right) noexcept {
+    return bitMask(vceqq_u8(vld1q_u8(left), vld1q_u8(right)));
+  }
+
+private:
+  // Weights each 0x00/0xFF lane by its bit position within its half; adding up each half then gives 8 mask bits
+  static uint32_t bitMask(uint8x16_t lanes) noexcept {
+    static constexpr uint8_t c_weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+
+    const uint8x16_t bits = vandq_u8(lanes, vld1q_u8(c_weights));
+
+    return uint32_t{vaddv_u8(vget_low_u8(bits))} | (uint32_t{vaddv_u8(vget_high_u8(bits))} << 8);
+  }
+
+#else
+
+  static constexpr size_t c_size = 16;
+
+  static size_t asciiPrefix(const uint8_t * data) noexcept {
+    const auto mask = static_cast<uint32_t>(_mm_movemask_epi8(load(data)));
+
+    return mask == 0 ? c_size : static_cast<size_t>(std::countr_zero(mask));
+  }
+
+  static size_t leadCount(const uint8_t * data) noexcept {
+    const __m128i leads = _mm_cmpgt_epi8(load(data), _mm_set1_epi8(-0x41));
+
+    return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(leads))));
+  }
+
+  static size_t fourByteLeadCount(const uint8_t * data) noexcept {
+    const __m128i bytes = load(data);
+    const __m128i leads = _mm_cmpeq_epi8(_mm_max_epu8(bytes, _mm_set1_epi8(-0x10)), bytes);
+
+    return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(leads))));
+  }
+
+  static void widenAscii(const uint8_t * data, char16_t * destination) noexcept {
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i bytes = load(data);
+    auto *        out   = reinterpret_cast<__m128i *>(destination);
+
+    _mm_storeu_si128(out, _mm_unpacklo_epi8(bytes, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(bytes, zero));
+  }
+
+  static void widenAscii(const uint8_t * data, char32_t * destination) noexcept {
+    const __m128i zero  = _mm_setzero_si128();
+    const __m128i bytes = load(data);
+    const __m128i low   = _mm_unpacklo_epi8(bytes, zero);
+    const __m128i high  = _mm_unpackhi_epi8(bytes, zero);
+    auto *        out   = reinterpret_cast<__m128i *>(destination);
+
+    _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+    _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+    _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+    _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+  }
+
+  static bool isAscii(const char16_t * data) noexcept {
+    const __m128i high = _mm_and_si128(_mm_or_si128(load(data), load(data + 8)), _mm_set1_epi16(-0x80));
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) == 0xFFFF;
+  }
+
+  static bool isAscii(const char32_t * data) noexcept {
+    const __m128i units = _mm_or_si128(_mm_or_si128(load(data), load(data + 4)),
+                                       _mm_or_si128(load(data + 8), load(data + 12)));
+    const __m128i high  = _mm_and_si128(units, _mm_set1_epi32(-0x80));
+
+    return _mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) == 0xFFFF;
+  }
+
+  static void narrowAscii(const char16_t * data, uint8_t * destination) noexcept {
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm_packus_epi16(load(data), load(data + 8)));
+  }
+
+  static void narrowAscii(const char32_t * data, uint8_t * destination) noexcept {
+    const __m128i low  = _mm_packs_epi32(load(data), load(data + 4));
+    const __m128i high = _mm_packs_epi32(load(data + 8), load(data + 12));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(destination), _mm_packus_epi16(low, high));
+  }
+
+  static size_t utf8Length(const char16_t * data) noexcept {
+    const __m128i zero   = _mm_setzero_si128();
+    size_t        length = 3 * c_size;
+
+    // Every unit counts three bytes, less one for each of: below U+0080, below U+0800, and surrogate (pairs give 2+2)
+    for (size_t offset = 0; offset < c_size; offset += 8) {
+      const __m128i units     = load(data + offset);
+      const __m128i plane     = _mm_and_si128(units, _mm_set1_epi16(-0x800));
+      const __m128i below80   = _mm_cmpeq_epi16(_mm_and_si128(units, _mm_set1_epi16(-0x80)), zero);
+      const __m128i below800  = _mm_cmpeq_epi16(plane, zero);
+      const __m128i surrogate = _mm_cmpeq_epi16(plane, _mm_set1_epi16(-0x2800));
+
+      // The byte mask carries two bits per 16-bit lane
+      length -= static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(below80)))
+                                    + std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(below800)))
+                                    + std::popcount(static_cast<uint32_t>(_mm_movemask_epi8(surrogate))))
+              / 2;
+    }
+
+    return length;
+  }
+
+  static size_t utf8Length(const char32_t * data) noexcept {
+    size_t length = c_size;
+
+    for (size_t offset = 0; offset < c_size; offset += 4) {
+      const __m128i units = load(data + offset);
+
+      length += static_cast<size_t>(moreThan(units, 0x7F) + moreThan(units, 0x7FF) + moreThan(units, 0xFFFF));
+    }
+
+    return length;
+  }
+
+  static constexpr uint32_t c_allEqual = 0xFFFF;
+
+  static uint32_t byteMask(const uint8_t * data, uint8_t byte) noexcept {
+    const __m128i matches = _mm_cmpeq_epi8(load(data), _mm_set1_epi8(static_cast<char>(byte)));
+
+    return static_cast<uint32_t>(_mm_movemask_epi8(matches));
+  }
+
+  static uint32_t equalMask(const uint8_t * left, const uint8_t * right) noexcept {
+    return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(load(left), load(right))));
+  }
+
+private:
+  static __m128i load(const void * data) noexcept {
+    return _mm_loadu_si128(static_cast<const __m128i *>(data));
+  }
+
+  static int moreThan(__m128i units, int bound) noexcept {
+    const __m128i mask = _mm_cmpgt_epi32(units, _mm_set1_epi32(bound));
+
+    return std::popcount(static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(mask))));
+  }
+
+#endif
+};
+
+#include "utils_kernels.inl"
+
+} // namespace vector128
+
+#endif // TOYGINE_SIMD_VECTOR128
+
+#ifdef TOYGINE_SIMD_AVX2
+
+TOYGINE_SIMD_AVX2_BEGIN
+
+/// 256-bit fast paths, with AVX2.
+namespace avx2 {
+
+/// VectorBlock of AVX2 registers; see vector128::VectorBlock.
+struct VectorBlock {
+  static constexpr size_t c_size = 32;
+
+  static size_t asciiPrefix(const uint8_t * data) noexcept {
+    const auto mask = static_cast<uint32_t>(_mm256_movemask_epi8(load(data)));
+
+    return mask == 0 ? c_size : static_cast<size_t>(std::countr_zero(mask));
+  }
+
+  static size_t leadCount(const uint8_t * data) noexcept {
+    const __m256i leads = _mm256_cmpgt_epi8(load(data), _mm256_set1_epi8(-0x41));
+
+    return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(leads))));
+  }
+
+  static size_t fourByteLeadCount(const uint8_t * data) noexcept {
+    const __m256i bytes = load(data);
+    const __m256i leads = _mm256_cmpeq_epi8(_mm256_max_epu8(bytes, _mm256_set1_epi8(-0x10)), bytes);
+
+    return static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(leads))));
+  }
+
+  static void widenAscii(const uint8_t * data, char16_t * destination) noexcept {
+    for (size_t offset = 0; offset < c_size; offset += 16) {
+      const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + offset));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + offset), _mm256_cvtepu8_epi16(bytes));
+    }
+  }
+
+  static void widenAscii(const uint8_t * data, char32_t * destination) noexcept {
+    for (size_t offset = 0; offset < c_size; offset += 8) {
+      const __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(data + offset));
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + offset), _mm256_cvtepu8_epi32(bytes));
+    }
+  }
+
+  static bool isAscii(const char16_t * data) noexcept {
+    return _mm256_testz_si256(_mm256_or_si256(load(data), load(data + 16)), _mm256_set1_epi16(-0x80)) != 0;
+  }
+
+  static bool isAscii(const char32_t * data) noexcept {
+    const __m256i units = _mm256_or_si256(_mm256_or_si256(load(data), load(data + 8)),
+                                          _mm256_or_si256(load(data + 16), load(data + 24)));
+
+    return _mm256_testz_si256(units, _mm256_set1_epi32(-0x80)) != 0;
+  }
+
+  static void narrowAscii(const char16_t * data, uint8_t * destination) noexcept {
+    // packus interleaves the two sources per 128-bit lane; restore source order by swapping the middle 64-bit quarters
+    const __m256i bytes = _mm256_permute4x64_epi64(_mm256_packus_epi16(load(data), load(data + 16)), 0xD8);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), bytes);
+  }
+
+  static void narrowAscii(const char32_t * data, uint8_t * destination) noexcept {
+    const __m256i words = _mm256_packs_epi32(load(data), load(data + 8));
+    const __m256i more  = _mm256_packs_epi32(load(data + 16), load(data + 24));
+    const __m256i bytes = _mm256_packus_epi16(words, more);
+
+    // Each 32-bit group now holds four code points; gather the groups back into source order across both lanes
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination), _mm256_permutevar8x32_epi32(bytes, order));
+  }
+
+  static size_t utf8Length(const char16_t * data) noexcept {
+    const __m256i zero   = _mm256_setzero_si256();
+    size_t        length = 3 * c_size;
+
+    // Every unit counts three bytes, less one for each of: below U+0080, below U+0800, and surrogate (pairs give 2+2)
+    for (size_t offset = 0; offset < c_size; offset += 16) {
+      const __m256i units     = load(data + offset);
+      const __m256i plane     = _mm256_and_si256(units, _mm256_set1_epi16(-0x800));
+      const __m256i below80   = _mm256_cmpeq_epi16(_mm256_and_si256(units, _mm256_set1_epi16(-0x80)), zero);
+      const __m256i below800  = _mm256_cmpeq_epi16(plane, zero);
+      const __m256i surrogate = _mm256_cmpeq_epi16(plane, _mm256_set1_epi16(-0x2800));
+
+      // The byte mask carries two bits per 16-bit lane
+      length -= static_cast<size_t>(std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(below80)))
+                                    + std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(below800)))
+                                    + std::popcount(static_cast<uint32_t>(_mm256_movemask_epi8(surrogate))))
+              / 2;
+    }
+
+    return length;
+  }
+
+  static size_t utf8Length(const char32_t * data) noexcept {
+    size_t length = c_size;
+
+    for (size_t offset = 0; offset < c_size; offset += 8) {
+      const __m256i units = load(data + offset);
+
+      length += static_cast<size_t>(moreThan(units, 0x7F) + moreThan(units, 0x7FF) + moreThan(units, 0xFFFF));
+    }
+
+    return length;
+  }
+
+  static constexpr uint32_t c_allEqual = 0xFFFFFFFF;
+
+  static uint32_t byteMask(const uint8_t * data, uint8_t byte) noexcept {
+    const __m256i matches = _mm256_cmpeq_epi8(load(data), _mm256_set1_epi8(static_cast<char>(byte)));
+
+    return static_cast<uint32_t>(_mm256_movemask_epi8(matches));
+  }
+
+  static uint32_t equalMask(const uint8_t * left, const uint8_t * right) noexcept {
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(load(left), load(right))));
+  }
+
+private:
+  static __m256i load(const void * data) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i *>(data));
+  }
+
+  static int moreThan(__m256i units, int bound) noexcept {
+    const __m256i mask = _mm256_cmpgt_epi32(units, _mm256_set1_epi32(bound));
+
+    return std::popcount(static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(mask))));
+  }
+};
+
+#include "utils_kernels.inl"
+
+} // namespace avx2
+
+TOYGINE_SIMD_AVX2_END
+
+#endif // TOYGINE_SIMD_AVX2
+
 } // namespace
 
+//----------------------------------------------------------------------------------------------------------------------
+
+namespace scalar {
+
+size_t utf8ValidLength(const char * string, size_t size) noexcept {
+  return validLengthFrom(reinterpret_cast<const uint8_t *>(string), size, 0);
+}
+
+size_t utf8CodePointCount(const char * string, size_t size) noexcept {
+  const auto * data     = reinterpret_cast<const uint8_t *>(string);
+  size_t       count    = 0;
+  size_t       position = 0;
+
+  // Valid input never holds a byte the table maps to 0, so stepping by at least one keeps the walk bounded
+  while (position < size) {
+    const size_t length = c_utf8CharSizeTable[data[position]];
+
+    position += length != 0 ? length : 1;
+    ++count;
+  }
+
+  return count;
+}
+
+TranscodeResult utf8ToUtf32(const char * source, size_t size, char32_t * destination) noexcept {
+  return decodeFrom(reinterpret_cast<const uint8_t *>(source), size, 0, destination, 0);
+}
+
+size_t utf16LengthFromUtf8(const char * string, size_t size) noexcept {
+  const auto * data     = reinterpret_cast<const uint8_t *>(string);
+  size_t       count    = 0;
+  size_t       position = 0;
+
+  // Same bounded walk as utf8CodePointCount(); a 4-byte sequence becomes a surrogate pair
+  while (position < size) {
+    const size_t length = c_utf8CharSizeTable[data[position]];
+
+    position += length != 0 ? length : 1;
+    count += length == 4 ? 2 : 1;
+  }
+
+  return count;
+}
+
+size_t utf8LengthFromUtf16(const char16_t * string, size_t size) noexcept {
+  return utf8LengthOf(string, size);
+}
+
+size_t utf8LengthFromUtf32(const char32_t * string, size_t size) noexcept {
+  return utf8LengthOf(string, size);
+}
+
+TranscodeResult utf8ToUtf16(const char * source, size_t size, char16_t * destination) noexcept {
+  return decodeFrom(reinterpret_cast<const uint8_t *>(source), size, 0, destination, 0);
+}
+
+TranscodeResult utf16ToUtf8(const char16_t * source, size_t size, char * destination) noexcept {
+  return utf16ToUtf8From(source, size, 0, reinterpret_cast<uint8_t *>(destination), 0);
+}
+
+TranscodeResult utf32ToUtf8(const char32_t * source, size_t size, char * destination) noexcept {
+  return utf32ToUtf8From(source, size, 0, reinterpret_cast<uint8_t *>(destination), 0);
+}
+
+int compareChars(const char * left, const char * right, size_t size) noexcept {
+  size_t position = 0;
+
+  for (; size - position >= sizeof(Word); position += sizeof(Word)) {
+    const Word difference = loadWord(left + position) ^ loadWord(right + position);
+    if (difference != 0)
+      return compareFrom(left, right, position + firstSetByte(difference), size);
+  }
+
+  return compareFrom(left, right, position, size);
+}
+
+const char * findChar(const char * string, size_t size, char character) noexcept {
+  const Word pattern  = c_lowBits * static_cast<uint8_t>(character);
+  size_t     position = 0;
+
+  for (; size - position >= sizeof(Word); position += sizeof(Word)) {
+    const Word matches = zeroBytes(loadWord(string + position) ^ pattern);
+    if (matches != 0)
+      return string + position + firstSetByte(matches);
+  }
+
+  return findCharFrom(string, size, position, character);
+}
+
+const char * findSubstring(const char * string, size_t size, const char * pattern, size_t patternSize) noexcept {
+  if (patternSize == 0)
+    return string;
+
+  size_t position = 0;
+
+  // Jump to each occurrence of the first pattern byte that leaves room for the rest, then compare the remainder
+  while (size - position >= patternSize) {
+    const char * candidate = findChar(string + position, size - position - patternSize + 1, pattern[0]);
+    if (candidate == nullptr)
+      return nullptr;
+
+    if (compareChars(candidate + 1, pattern + 1, patternSize - 1) == 0)
+      return candidate;
+
+    position = static_cast<size_t>(candidate - string) + 1;
+  }
+
+  return nullptr;
+}
+
+} // namespace scalar
+
+//----------------------------------------------------------------------------------------------------------------------
+
+size_t utf8ValidLength(const char * string, size_t size) noexcept {
+  return platform::selectKernel<decltype(utf8ValidLength), TOYGINE_SIMD_KERNELS(utf8ValidLength)>()(string, size);
+}
+
+size_t utf8CodePointCount(const char * string, size_t size) noexcept {
+  return platform::selectKernel<decltype(utf8CodePointCount), TOYGINE_SIMD_KERNELS(utf8CodePointCount)>()(string, size);
+}
+
+TranscodeResult utf8ToUtf32(const char * source, size_t size, char32_t * destination) noexcept {
+  return platform::selectKernel<decltype(utf8ToUtf32), TOYGINE_SIMD_KERNELS(utf8ToUtf32)>()(source, size, destination);
+}
+
+size_t utf16LengthFromUtf8(const char * string, size_t size) noexcept {
+  return platform::selectKernel<decltype(utf16LengthFromUtf8),
+                                TOYGINE_SIMD_KERNELS(utf16LengthFromUtf8)>()(string, size);
+}
+
+size_t utf8LengthFromUtf16(const char16_t * string, size_t size) noexcept {
+  return platform::selectKernel<decltype(utf8LengthFromUtf16),
+                                TOYGINE_SIMD_KERNELS(utf8LengthFromUtf16)>()(string, size);
+}
+
+size_t utf8LengthFromUtf32(const char32_t * string, size_t size) noexcept {
+  return platform::selectKernel<decltype(utf8LengthFromUtf32),
+                                TOYGINE_SIMD_KERNELS(utf8LengthFromUtf32)>()(string, size);
+}
+
+TranscodeResult utf8ToUtf16(const char * source, size_t size, char16_t * destination) noexcept {
+  return platform::selectKernel<decltype(utf8ToUtf16), TOYGINE_SIMD_KERNELS(utf8ToUtf16)>()(source, size, destination);
+}
+
+TranscodeResult utf16ToUtf8(const char16_t * source, size_t size, char * destination) noexcept {
+  return platform::selectKernel<decltype(utf16ToUtf8), TOYGINE_SIMD_KERNELS(utf16ToUtf8)>()(source, size, destination);
+}
+
+TranscodeResult utf32ToUtf8(const char32_t * source, size_t size, char * destination) noexcept {
+  return platform::selectKernel<decltype(utf32ToUtf8), TOYGINE_SIMD_KERNELS(utf32ToUtf8)>()(source, size, destination);
+}
+
+int compareChars(const char * left, const char * right, size_t size) noexcept {
+  return platform::selectKernel<decltype(compareChars), TOYGINE_SIMD_KERNELS(compareChars)>()(left, right, size);
+}
+
+const char * findChar(const char * string, size_t size, char character) noexcept {
+  return platform::selectKernel<decltype(findChar), TOYGINE_SIMD_KERNELS(findChar)>()(string, size, character);
+}
+
+const char * findSubstring(const char * string, size_t size, const char * pattern, size_t patternSize) noexcept {
+  return platform::selectKernel<decltype(findSubstring),
+                                TOYGINE_SIMD_KERNELS(findSubstring)>()(string, size, pattern, patternSize);
+}
+
 } // namespace toy
@@ -0,0 +1,267 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   utils_kernels.inl
+  \brief  Vector fast paths of the string and UTF-8 utilities, written against one \c VectorBlock.
+
+  utils.cpp includes this file once per SIMD level, inside the namespace of the level and after its \c VectorBlock;
+  hence the missing include guard. Each function has the contract of the public routine of the same name.
+*/
+
+/*!
+  \brief Decodes UTF-8 to UTF-16 or UTF-32, widening all-ASCII blocks in one step.
+
+  A block that holds any multi-byte sequence is decoded one sequence at a time up to its end; the last sequence may run
+  past it, and the next block starts wherever that sequence ends.
+*/
+template <typename Unit>
+TranscodeResult decodeBlocks(const uint8_t * data, size_t size, Unit * destination) noexcept {
+  size_t position = 0;
+  size_t written  = 0;
+
+  while (size - position >= VectorBlock::c_size) {
+    const size_t blockEnd = position + VectorBlock::c_size;
+
+    if (VectorBlock::asciiPrefix(data + position) == VectorBlock::c_size) {
+      VectorBlock::widenAscii(data + position, destination + written);
+      position = blockEnd;
+      written += VectorBlock::c_size;
+      continue;
+    }
+
+    while (position < blockEnd) {
+      const size_t length = validSequenceLength(data + position, size - position);
+      if (length == 0)
+        return {position, written};
+
+      appendCodePoint(decodeSequence(data + position, length), destination, written);
+      position += length;
+    }
+  }
+
+  return decodeFrom(data, size, position, destination, written);
+}
+
+size_t utf8ValidLength(const char * string, size_t size) noexcept {
+  const auto * data     = reinterpret_cast<const uint8_t *>(string);
+  size_t       position = 0;
+
+  while (size - position >= VectorBlock::c_size) {
+    const size_t blockEnd = position + VectorBlock::c_size;
+
+    position += VectorBlock::asciiPrefix(data + position);
+
+    // The block holds a multi-byte sequence: validate up to its end one sequence at a time, then resume block steps
+    while (position < blockEnd) {
+      const size_t length = validSequenceLength(data + position, size - position);
+      if (length == 0)
+        return position;
+
+      position += length;
+    }
+  }
+
+  return validLengthFrom(data, size, position);
+}
+
+size_t utf8CodePointCount(const char * string, size_t size) noexcept {
+  const auto * data     = reinterpret_cast<const uint8_t *>(string);
+  size_t       count    = 0;
+  size_t       position = 0;
+
+  for (; size - position >= VectorBlock::c_size; position += VectorBlock::c_size)
+    count += VectorBlock::leadCount(data + position);
+
+  return count + countLeadBytes(data + position, size - position);
+}
+
+TranscodeResult utf8ToUtf32(const char * source, size_t size, char32_t * destination) noexcept {
+  return decodeBlocks(reinterpret_cast<const uint8_t *>(source), size, destination);
+}
+
+size_t utf16LengthFromUtf8(const char * string, size_t size) noexcept {
+  const auto * data     = reinterpret_cast<const uint8_t *>(string);
+  size_t       count    = 0;
+  size_t       position = 0;
+
+  for (; size - position >= VectorBlock::c_size; position += VectorBlock::c_size)
+    count += VectorBlock::leadCount(data + position) + VectorBlock::fourByteLeadCount(data + position);
+
+  return count + countUtf16Units(data + position, size - position);
+}
+
+size_t utf8LengthFromUtf16(const char16_t * string, size_t size) noexcept {
+  size_t length   = 0;
+  size_t position = 0;
+
+  for (; size - position >= VectorBlock::c_size; position += VectorBlock::c_size)
+    length += VectorBlock::utf8Length(string + position);
+
+  return length + utf8LengthOf(string + position, size - position);
+}
+
+size_t utf8LengthFromUtf32(const char32_t * string, size_t size) noexcept {
+  size_t length   = 0;
+  size_t position = 0;
+
+  for (; size - position >= VectorBlock::c_size; position += VectorBlock::c_size)
+    length += VectorBlock::utf8Length(string + position);
+
+  return length + utf8LengthOf(string + position, size - position);
+}
+
+TranscodeResult utf8ToUtf16(const char * source, size_t size, char16_t * destination) noexcept {
+  return decodeBlocks(reinterpret_cast<const uint8_t *>(source), size, destination);
+}
+
+TranscodeResult utf16ToUtf8(const char16_t * source, size_t size, char * destination) noexcept {
+  auto * data     = reinterpret_cast<uint8_t *>(destination);
+  size_t position = 0;
+  size_t written  = 0;
+
+  while (size - position >= VectorBlock::c_size) {
+    const size_t blockEnd = position + VectorBlock::c_size;
+
+    if (VectorBlock::isAscii(source + position)) {
+      VectorBlock::narrowAscii(source + position, data + written);
+      position = blockEnd;
+      written += VectorBlock::c_size;
+      continue;
+    }
+
+    // A surrogate pair may straddle the block end; the next block then starts one unit later
+    while (position < blockEnd) {
+      const size_t length = utf16SequenceLength(source + position, size - position);
+      if (length == 0)
+        return {position, written};
+
+      appendUtf8(length == 1 ? char32_t{source[position]} : decodeSurrogatePair(source + position), data, written);
+      position += length;
+    }
+  }
+
+  return utf16ToUtf8From(source, size, position, data, written);
+}
+
+TranscodeResult utf32ToUtf8(const char32_t * source, size_t size, char * destination) noexcept {
+  auto * data     = reinterpret_cast<uint8_t *>(destination);
+  size_t position = 0;
+  size_t written  = 0;
+
+  while (size - position >= VectorBlock::c_size) {
+    const size_t blockEnd = position + VectorBlock::c_size;
+
+    if (VectorBlock::isAscii(source + position)) {
+      VectorBlock::narrowAscii(source + position, data + written);
+      position = blockEnd;
+      written += VectorBlock::c_size;
+      continue;
+    }
+
+    const TranscodeResult result = utf32ToUtf8From(source, blockEnd, position, data, written);
+    if (result.read != blockEnd)
+      return result;
+
+    position = blockEnd;
+    written  = result.written;
+  }
+
+  return utf32ToUtf8From(source, size, position, data, written);
+}
+
+int compareChars(const char * left, const char * right, size_t size) noexcept {
+  if (size < VectorBlock::c_size)
+    return scalar::compareChars(left, right, size);
+
+  const auto * leftData  = reinterpret_cast<const uint8_t *>(left);
+  const auto * rightData = reinterpret_cast<const uint8_t *>(right);
+  const size_t lastBlock = size - VectorBlock::c_size;
+
+  // The last block is pulled back to end at the buffer end; the bytes it rechecks are already known to be equal
+  for (size_t position = 0;; position += VectorBlock::c_size) {
+    if (position > lastBlock)
+      position = lastBlock;
+
+    const uint32_t equal = VectorBlock::equalMask(leftData + position, rightData + position);
+    if (equal != VectorBlock::c_allEqual) {
+      const size_t index = position + static_cast<size_t>(std::countr_one(equal));
+
+      return int{leftData[index]} - int{rightData[index]};
+    }
+
+    if (position == lastBlock)
+      return 0;
+  }
+}
+
+const char * findChar(const char * string, size_t size, char character) noexcept {
+  if (size < VectorBlock::c_size)
+    return scalar::findChar(string, size, character);
+
+  const auto * data      = reinterpret_cast<const uint8_t *>(string);
+  const size_t lastBlock = size - VectorBlock::c_size;
+
+  // The last block is pulled back to end at the buffer end; the bytes it rechecks are already known not to match
+  for (size_t position = 0;; position += VectorBlock::c_size) {
+    if (position > lastBlock)
+      position = lastBlock;
+
+    const uint32_t matches = VectorBlock::byteMask(data + position, static_cast<uint8_t>(character));
+    if (matches != 0)
+      return string + position + std::countr_zero(matches);
+
+    if (position == lastBlock)
+      return nullptr;
+  }
+}
+
+const char * findSubstring(const char * string, size_t size, const char * pattern, size_t patternSize) noexcept {
+  if (patternSize < 2)
+    return patternSize == 0 ? string : findChar(string, size, pattern[0]);
+
+  const size_t lastOffset = patternSize - 1;
+  if (size < lastOffset + VectorBlock::c_size)
+    return scalar::findSubstring(string, size, pattern, patternSize);
+
+  const auto *  data      = reinterpret_cast<const uint8_t *>(string);
+  const uint8_t first     = static_cast<uint8_t>(pattern[0]);
+  const uint8_t last      = static_cast<uint8_t>(pattern[lastOffset]);
+  const size_t  lastBlock = size - lastOffset - VectorBlock::c_size;
+
+  // Test a block of start positions per step: a match needs both its first and its last byte in place. As in
+  // findChar(), the last block is pulled back, and the starts it retests have already failed.
+  for (size_t position = 0;; position += VectorBlock::c_size) {
+    if (position > lastBlock)
+      position = lastBlock;
+
+    uint32_t candidates = VectorBlock::byteMask(data + position, first)
+                        & VectorBlock::byteMask(data + position + lastOffset, last);
+
+    for (; candidates != 0; candidates &= candidates - 1) {
+      const size_t start = position + static_cast<size_t>(std::countr_zero(candidates));
+
+      if (compareChars(string + start + 1, pattern + 1, patternSize - 2) == 0)
+        return string + start;
+    }
+
+    if (position == lastBlock)
+      return nullptr;
+  }
+}
@@ -0,0 +1,733 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   async_io.cpp
+  \brief  Asynchronous reads: io_uring rings on Linux, worker threads elsewhere, and reads on submit without threads.
+
+  The io_uring backend talks to the kernel through its three system calls and the shared rings directly, without
+  liburing. Reads into the registered buffer use \c IORING_OP_READ_FIXED; the others use \c IORING_OP_READ. The ring
+  has \ref toy::filesystem::async::c_maxReads submission entries and twice as many completion entries, so with at most
+  that many reads in flight the completion ring never overflows.
+
+  Both backends hand finished reads back to poll() on the owning thread, which sets their status and runs their
+  callbacks, so callbacks may submit further reads.
+*/
+
+#include "filesystem.hpp"
+
+#include <algorithm>
+#include <cerrno>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <cstdio>
+#endif
+
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define TOYGINE_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#endif
+
+#ifdef TOYGINE_JOB_THREADS
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif // TOYGINE_JOB_THREADS
+
+namespace toy::filesystem::async {
+
+namespace {
+
+/// Read that a backend has finished, waiting for poll()
+struct Finished {
+  /// The request
+  Request * request;
+
+  /// Bytes read, or a negative value when the read failed
+  int64_t result;
+};
+
+/// Backend in use
+constinit Backend s_backend = Backend::Workers;
+
+/// Reads submitted and not finished by poll(); owning thread only
+constinit size_t s_pending = 0;
+
+/*!
+  \brief Reads \a buffer from \a offset of \a file, blocking.
+
+  \return Bytes read, short only at the end of the file; negative when the file is closed or the read fails.
+*/
+int64_t readAt(const File & file, uint64_t offset, span<std::byte> buffer) noexcept {
+  if (!file.isOpen())
+    return -1;
+
+  size_t total = 0;
+
+  while (total < buffer.size()) {
+#if defined(_WIN32)
+    // An offset in the OVERLAPPED makes a synchronous handle read at it, without moving a shared position
+    OVERLAPPED  position{};
+    const DWORD chunk = static_cast<DWORD>(std::min<size_t>(buffer.size() - total, 0x40000000));
+    DWORD       count = 0;
+
+    position.Offset     = static_cast<DWORD>(offset + total);
+    position.OffsetHigh = static_cast<DWORD>((offset + total) >> 32);
+
+    if (!ReadFile(reinterpret_cast<HANDLE>(file.nativeHandle()), buffer.data() + total, chunk, &count, &position))
+      return GetLastError() == ERROR_HANDLE_EOF ? static_cast<int64_t>(total) : -1;
+#elif defined(__linux__) || defined(__APPLE__)
+    const ssize_t count = ::pread(static_cast<int>(file.nativeHandle()), buffer.data() + total, buffer.size() - total,
+                                  static_cast<off_t>(offset + total));
+
+    if (count < 0) {
+      if (errno == EINTR)
+        continue;
+
+      return -1;
+    }
+#else
+    // Targets without threads: only one read runs at a time, so the stream position can be moved freely
+    auto * stream = reinterpret_cast<std::FILE *>(file.nativeHandle());
+
+    if (std::fseek(stream, static_cast<long>(offset + total), SEEK_SET) != 0)
+      return -1;
+
+    const size_t count = std::fread(buffer.data() + total, 1, buffer.size() - total, stream);
+
+    if (count == 0 && std::ferror(stream))
+      return -1;
+#endif
+
+    if (count == 0)
+      break;
+
+    total += static_cast<size_t>(count);
+  }
+
+  return static_cast<int64_t>(total);
+}
+
+/// Sets the status of \a read and runs its callback.
+void finish(const Finished & read) noexcept {
+  Request & request = *read.request;
+
+  request.status    = read.result >= 0 ? Status::Done : Status::Failed;
+  request.bytesRead = read.result >= 0 ? static_cast<size_t>(read.result) : 0;
+  --s_pending;
+
+  if (request.callback != nullptr)
+    request.callback(request, request.context);
+}
+
+/*!
+  \brief Fixed ring of finished or queued reads.
+
+  Never holds more than \ref c_maxReads entries, since that many reads at most are in flight.
+*/
+class ReadRing {
+public:
+  /// Appends \a read.
+  void push(const Finished & read) noexcept {
+    _reads[(_head + _count++) & (c_maxReads - 1)] = read;
+  }
+
+  /// Removes and returns the oldest read.
+  Finished pop() noexcept {
+    const Finished read = _reads[_head];
+
+    _head = (_head + 1) & (c_maxReads - 1);
+    --_count;
+
+    return read;
+  }
+
+  /// Returns whether the ring holds no read.
+  [[nodiscard]] bool empty() const noexcept {
+    return _count == 0;
+  }
+
+private:
+  /// Reads, from \ref _head on
+  array<Finished, c_maxReads> _reads{};
+
+  /// Oldest read
+  size_t _head{0};
+
+  /// Number of reads
+  size_t _count{0};
+};
+
+/// Reads finished by the worker threads, or on submit without them
+constinit ReadRing s_finished;
+
+#ifdef TOYGINE_JOB_THREADS
+
+/// Reads waiting for a worker; their results are unused
+constinit ReadRing s_queued;
+
+/// Guards \ref s_queued, \ref s_finished, and \ref s_stopping
+std::mutex s_mutex;
+
+/// Signals the workers that reads are queued or that they must stop
+std::condition_variable s_readsQueued;
+
+/// Signals the owning thread that reads are finished
+std::condition_variable s_readsFinished;
+
+/// Worker threads; not joinable when the workers are not running
+array<std::thread, c_workerCount> s_workers;
+
+/// Set to make the workers exit
+constinit bool s_stopping = false;
+
+/// Takes queued reads and carries them out until \ref s_stopping is set.
+void workerLoop() noexcept {
+  std::unique_lock lock(s_mutex);
+
+  for (;;) {
+    s_readsQueued.wait(lock, [] { return s_stopping || !s_queued.empty(); });
+
+    if (s_queued.empty())
+      return;
+
+    Finished read = s_queued.pop();
+
+    lock.unlock();
+    read.result = readAt(*read.request->file, read.request->offset, read.request->buffer);
+    lock.lock();
+
+    s_finished.push(read);
+    s_readsFinished.notify_one();
+  }
+}
+
+/// Returns whether the worker threads are running.
+bool workersRunning() noexcept {
+  return s_workers[0].joinable();
+}
+
+#endif // TOYGINE_JOB_THREADS
+
+#ifdef TOYGINE_IO_URING
+
+/// One io_uring instance and its mapped rings.
+struct Ring {
+  /// Descriptor of the instance; -1 when there is none
+  int descriptor{-1};
+
+  /// Mapping of the submission ring, and of the completion ring when the kernel maps both at once
+  void * submissionMapping{nullptr};
+
+  /// Bytes of \ref submissionMapping
+  size_t submissionMappingSize{0};
+
+  /// Mapping of the completion ring; equals \ref submissionMapping when the kernel maps both at once
+  void * completionMapping{nullptr};
+
+  /// Bytes of \ref completionMapping
+  size_t completionMappingSize{0};
+
+  /// Submission entries
+  io_uring_sqe * entries{nullptr};
+
+  /// Bytes of \ref entries
+  size_t entriesSize{0};
+
+  /// Submission ring head, advanced by the kernel
+  uint32_t * submissionHead{nullptr};
+
+  /// Submission ring tail, advanced here
+  uint32_t * submissionTail{nullptr};
+
+  /// Submission ring index mask
+  uint32_t submissionMask{0};
+
+  /// Submission ring, indices into \ref entries
+  uint32_t * submissionArray{nullptr};
+
+  /// Completion ring head, advanced here
+  uint32_t * completionHead{nullptr};
+
+  /// Completion ring tail, advanced by the kernel
+  uint32_t * completionTail{nullptr};
+
+  /// Completion ring index mask
+  uint32_t completionMask{0};
+
+  /// Completions
+  io_uring_cqe * completions{nullptr};
+
+  /// Registered buffer; empty when none is
+  span<std::byte> registered;
+};
+
+/// The ring of the io_uring backend
+constinit Ring s_ring;
+
+/// Returns the \c uint32_t at \a offset bytes into \a mapping.
+uint32_t * ringField(void * mapping, uint32_t offset) noexcept {
+  return reinterpret_cast<uint32_t *>(static_cast<std::byte *>(mapping) + offset);
+}
+
+/// Unmaps the rings and closes the instance.
+void closeRing() noexcept {
+  if (s_ring.entries != nullptr)
+    ::munmap(s_ring.entries, s_ring.entriesSize);
+
+  if (s_ring.completionMapping != nullptr && s_ring.completionMapping != s_ring.submissionMapping)
+    ::munmap(s_ring.completionMapping, s_ring.completionMappingSize);
+
+  if (s_ring.submissionMapping != nullptr)
+    ::munmap(s_ring.submissionMapping, s_ring.submissionMappingSize);
+
+  if (s_ring.descriptor >= 0)
+    ::close(s_ring.descriptor);
+
+  s_ring = Ring();
+}
+
+/// Creates the instance and maps its rings; \c false when the kernel has no io_uring or refuses it.
+bool openRing() noexcept {
+  io_uring_params parameters{};
+
+  const long descriptor = ::syscall(__NR_io_uring_setup, static_cast<unsigned>(c_maxReads), &parameters);
+
+  if (descriptor < 0)
+    return false;
+
+  s_ring.descriptor = static_cast<int>(descriptor);
+
+  // IORING_OP_READ came with this feature, in Linux 5.6; older kernels keep the workers
+  if ((parameters.features & IORING_FEAT_RW_CUR_POS) == 0) {
+    closeRing();
+
+    return false;
+  }
+
+  s_ring.submissionMappingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(uint32_t);
+  s_ring.completionMappingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+  s_ring.entriesSize           = parameters.sq_entries * sizeof(io_uring_sqe);
+
+  const bool singleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+
+  if (singleMapping) {
+    s_ring.submissionMappingSize = std::max(s_ring.submissionMappingSize, s_ring.completionMappingSize);
+    s_ring.completionMappingSize = s_ring.submissionMappingSize;
+  }
+
+  const auto map = [](size_t size, off_t offset) noexcept {
+    void * mapping =
+      ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, s_ring.descriptor, offset);
+
+    return mapping != MAP_FAILED ? mapping : nullptr;
+  };
+
+  s_ring.submissionMapping = map(s_ring.submissionMappingSize, IORING_OFF_SQ_RING);
+  s_ring.completionMapping =
+    singleMapping ? s_ring.submissionMapping : map(s_ring.completionMappingSize, IORING_OFF_CQ_RING);
+  s_ring.entries = static_cast<io_uring_sqe *>(map(s_ring.entriesSize, IORING_OFF_SQES));
+
+  if (s_ring.submissionMapping == nullptr || s_ring.completionMapping == nullptr || s_ring.entries == nullptr) {
+    closeRing();
+
+    return false;
+  }
+
+  s_ring.submissionHead  = ringField(s_ring.submissionMapping, parameters.sq_off.head);
+  s_ring.submissionTail  = ringField(s_ring.submissionMapping, parameters.sq_off.tail);
+  s_ring.submissionMask  = *ringField(s_ring.submissionMapping, parameters.sq_off.ring_mask);
+  s_ring.submissionArray = ringField(s_ring.submissionMapping, parameters.sq_off.array);
+  s_ring.completionHead  = ringField(s_ring.completionMapping, parameters.cq_off.head);
+  s_ring.completionTail  = ringField(s_ring.completionMapping, parameters.cq_off.tail);
+  s_ring.completionMask  = *ringField(s_ring.completionMapping, parameters.cq_off.ring_mask);
+  s_ring.completions     = reinterpret_cast<io_uring_cqe *>(static_cast<std::byte *>(s_ring.completionMapping) +
+                                                        parameters.cq_off.cqes);
+
+  return true;
+}
+
+/*!
+  \brief Hands the kernel the entries it has not taken yet and, with \a waitFor above zero, waits for that many
+  completions.
+*/
+void enterRing(uint32_t waitFor) noexcept {
+  for (;;) {
+    const uint32_t unsubmitted =
+      *s_ring.submissionTail - std::atomic_ref(*s_ring.submissionHead).load(std::memory_order_acquire);
+
+    if (unsubmitted == 0 && waitFor == 0)
+      return;
+
+    const long result = ::syscall(__NR_io_uring_enter, s_ring.descriptor, unsubmitted, waitFor,
+                                  waitFor > 0 ? IORING_ENTER_GETEVENTS : 0u, nullptr, 0);
+
+    // Interrupted by a signal, or short of kernel memory for a moment
+    if (result < 0 && (errno == EINTR || errno == EAGAIN || errno == EBUSY))
+      continue;
+
+    return;
+  }
+}
+
+/// Marks, in the low bit of the user data, a request whose file is closed; requests are at least 8-byte aligned
+constexpr uint64_t c_closedFile = 1;
+
+/// Fills one submission entry for \a request.
+void prepareRead(Request & request) noexcept {
+  // Reads return at most this much at once on Linux; bytesRead tells the caller about the rest
+  constexpr size_t c_maxReadSize = 0x7FFFF000;
+
+  const uint32_t tail  = *s_ring.submissionTail;
+  const uint32_t index = tail & s_ring.submissionMask;
+
+  io_uring_sqe & entry = s_ring.entries[index];
+
+  const std::byte * first  = request.buffer.data();
+  const std::byte * last   = first + request.buffer.size();
+  const bool        fixed  = !s_ring.registered.empty() && first >= s_ring.registered.data() &&
+                     last <= s_ring.registered.data() + s_ring.registered.size();
+  const bool        closed = request.file == nullptr || !request.file->isOpen();
+
+  entry = io_uring_sqe{};
+
+  // A closed file still goes through the ring, as a no-op, so its request finishes in order with the others
+  if (closed) {
+    entry.opcode    = IORING_OP_NOP;
+    entry.user_data = reinterpret_cast<uintptr_t>(&request) | c_closedFile;
+  } else {
+    entry.opcode    = fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    entry.fd        = static_cast<int>(request.file->nativeHandle());
+    entry.off       = request.offset;
+    entry.addr      = reinterpret_cast<uintptr_t>(first);
+    entry.len       = static_cast<uint32_t>(std::min(request.buffer.size(), c_maxReadSize));
+    entry.user_data = reinterpret_cast<uintptr_t>(&request);
+  }
+
+  s_ring.submissionArray[index] = index;
+  std::atomic_ref(*s_ring.submissionTail).store(tail + 1, std::memory_order_release);
+}
+
+/// Moves the completions the kernel has posted to \ref s_finished.
+void reapRing() noexcept {
+  uint32_t       head = *s_ring.completionHead;
+  const uint32_t tail = std::atomic_ref(*s_ring.completionTail).load(std::memory_order_acquire);
+
+  for (; head != tail; ++head) {
+    const io_uring_cqe & completion = s_ring.completions[head & s_ring.completionMask];
+    const uint64_t       userData   = completion.user_data;
+    auto *               request    = reinterpret_cast<Request *>(static_cast<uintptr_t>(userData & ~c_closedFile));
+
+    s_finished.push({request, (userData & c_closedFile) != 0 ? -1 : static_cast<int64_t>(completion.res)});
+  }
+
+  std::atomic_ref(*s_ring.completionHead).store(head, std::memory_order_release);
+}
+
+#endif // TOYGINE_IO_URING
+
+/// Runs the callbacks of the reads in \ref s_finished; returns how many there were.
+size_t finishReads() noexcept {
+  // Take the batch first: callbacks may submit reads, which on some backends finish into the same ring
+  array<Finished, c_maxReads> batch;
+  size_t                      count = 0;
+
+  {
+#ifdef TOYGINE_JOB_THREADS
+    const std::scoped_lock lock(s_mutex);
+#endif // TOYGINE_JOB_THREADS
+
+    while (!s_finished.empty())
+      batch[count++] = s_finished.pop();
+  }
+
+  for (size_t index = 0; index < count; ++index)
+    finish(batch[index]);
+
+  return count;
+}
+
+/// Blocks until the backend finishes at least one more read.
+void waitForReads() noexcept {
+#ifdef TOYGINE_IO_URING
+  if (s_backend == Backend::IoUring) {
+    enterRing(1);
+    reapRing();
+
+    return;
+  }
+#endif // TOYGINE_IO_URING
+
+#ifdef TOYGINE_JOB_THREADS
+  std::unique_lock lock(s_mutex);
+
+  s_readsFinished.wait(lock, [] { return !s_finished.empty(); });
+#endif // TOYGINE_JOB_THREADS
+}
+
+} // namespace
+
+File::File(const char * path) noexcept {
+#if defined(_WIN32)
+  HANDLE handle =
+    CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  LARGE_INTEGER size{};
+
+  if (handle == INVALID_HANDLE_VALUE)
+    return;
+
+  if (!GetFileSizeEx(handle, &size)) {
+    CloseHandle(handle);
+
+    return;
+  }
+
+  _handle = reinterpret_cast<intptr_t>(handle);
+  _size   = static_cast<uint64_t>(size.QuadPart);
+#elif defined(__linux__) || defined(__APPLE__)
+  const int   descriptor = ::open(path, O_RDONLY | O_CLOEXEC);
+  struct stat status{};
+
+  if (descriptor < 0)
+    return;
+
+  if (::fstat(descriptor, &status) != 0) {
+    ::close(descriptor);
+
+    return;
+  }
+
+  _handle = descriptor;
+  _size   = static_cast<uint64_t>(status.st_size);
+#else
+  std::FILE * stream = std::fopen(path, "rb");
+
+  if (stream == nullptr)
+    return;
+
+  std::fseek(stream, 0, SEEK_END);
+
+  const long size = std::ftell(stream);
+
+  _handle = reinterpret_cast<intptr_t>(stream);
+  _size   = size > 0 ? static_cast<uint64_t>(size) : 0;
+#endif
+}
+
+File::~File() noexcept {
+  close();
+}
+
+File::File(File && other) noexcept
+  : _handle(std::exchange(other._handle, c_closed))
+  , _size(std::exchange(other._size, 0)) {}
+
+File & File::operator=(File && other) noexcept {
+  if (this != &other) {
+    close();
+
+    _handle = std::exchange(other._handle, c_closed);
+    _size   = std::exchange(other._size, 0);
+  }
+
+  return *this;
+}
+
+void File::close() noexcept {
+  if (!isOpen())
+    return;
+
+#if defined(_WIN32)
+  CloseHandle(reinterpret_cast<HANDLE>(_handle));
+#elif defined(__linux__) || defined(__APPLE__)
+  ::close(static_cast<int>(_handle));
+#else
+  std::fclose(reinterpret_cast<std::FILE *>(_handle));
+#endif
+
+  _handle = c_closed;
+  _size   = 0;
+}
+
+void initialize([[maybe_unused]] Backend preferred) noexcept {
+  deInitialize();
+
+#ifdef TOYGINE_IO_URING
+  if (preferred == Backend::IoUring && openRing()) {
+    s_backend = Backend::IoUring;
+
+    return;
+  }
+#endif // TOYGINE_IO_URING
+
+  s_backend = Backend::Workers;
+
+#ifdef TOYGINE_JOB_THREADS
+  s_stopping = false;
+
+  for (std::thread & worker : s_workers)
+    worker = std::thread(workerLoop);
+#endif // TOYGINE_JOB_THREADS
+}
+
+void deInitialize() noexcept {
+  waitAll();
+
+#ifdef TOYGINE_IO_URING
+  if (s_backend == Backend::IoUring)
+    closeRing();
+#endif // TOYGINE_IO_URING
+
+#ifdef TOYGINE_JOB_THREADS
+  if (workersRunning()) {
+    {
+      const std::scoped_lock lock(s_mutex);
+
+      s_stopping = true;
+    }
+
+    s_readsQueued.notify_all();
+
+    for (std::thread & worker : s_workers)
+      worker.join();
+  }
+#endif // TOYGINE_JOB_THREADS
+
+  s_backend = Backend::Workers;
+}
+
+Backend backend() noexcept {
+  return s_backend;
+}
+
+bool registerBuffer([[maybe_unused]] span<std::byte> buffer) noexcept {
+#ifdef TOYGINE_IO_URING
+  if (s_backend != Backend::IoUring || s_pending > 0)
+    return false;
+
+  if (!s_ring.registered.empty()) {
+    ::syscall(__NR_io_uring_register, s_ring.descriptor, IORING_UNREGISTER_BUFFERS, nullptr, 0);
+    s_ring.registered = {};
+  }
+
+  if (buffer.empty())
+    return false;
+
+  const iovec vector{buffer.data(), buffer.size()};
+
+  if (::syscall(__NR_io_uring_register, s_ring.descriptor, IORING_REGISTER_BUFFERS, &vector, 1) != 0)
+    return false;
+
+  s_ring.registered = buffer;
+
+  return true;
+#else
+  return false;
+#endif // TOYGINE_IO_URING
+}
+
+size_t submit(span<Request> requests) noexcept {
+  const size_t count = std::min(requests.size(), c_maxReads - s_pending);
+
+  s_pending += count;
+
+  for (size_t index = 0; index < count; ++index)
+    requests[index].status = Status::Pending;
+
+#ifdef TOYGINE_IO_URING
+  if (s_backend == Backend::IoUring) {
+    for (size_t index = 0; index < count; ++index)
+      prepareRead(requests[index]);
+
+    enterRing(0);
+
+    return count;
+  }
+#endif // TOYGINE_IO_URING
+
+#ifdef TOYGINE_JOB_THREADS
+  if (workersRunning()) {
+    {
+      const std::scoped_lock lock(s_mutex);
+
+      for (size_t index = 0; index < count; ++index)
+        s_queued.push({&requests[index], 0});
+    }
+
+    s_readsQueued.notify_all();
+
+    return count;
+  }
+
+  // Before initialize(), the reads are carried out here; poll() runs the callbacks
+  const std::scoped_lock lock(s_mutex);
+#endif // TOYGINE_JOB_THREADS
+
+  for (size_t index = 0; index < count; ++index) {
+    Request &     request = requests[index];
+    const int64_t result  = request.file != nullptr ? readAt(*request.file, request.offset, request.buffer) : -1;
+
+    s_finished.push({&request, result});
+  }
+
+  return count;
+}
+
+size_t poll() noexcept {
+#ifdef TOYGINE_IO_URING
+  if (s_backend == Backend::IoUring) {
+    enterRing(0);
+    reapRing();
+  }
+#endif // TOYGINE_IO_URING
+
+  return finishReads();
+}
+
+void wait(const Request & request) noexcept {
+  while (request.status == Status::Pending) {
+    if (poll() == 0)
+      waitForReads();
+  }
+}
+
+void waitAll() noexcept {
+  while (s_pending > 0) {
+    if (poll() == 0)
+      waitForReads();
+  }
+}
+
+size_t pending() noexcept {
+  return s_pending;
+}
+
+} // namespace toy::filesystem::async
@@ -0,0 +1,486 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   compression.cpp
+  \brief  LZ stream compressor, and the block decoder with its wide and byte-copy variants.
+
+  The decoder checks every length and offset against its buffers, so a damaged stream fails instead of writing out
+  of bounds. Wide copies move 16 bytes at a time and may write up to 15 bytes past a copy, into bytes the decoder
+  rewrites later; they are used only where the buffer, or in place the unread input, leaves that room. Elsewhere, and
+  always in the byte variant, copies stop at their last byte.
+*/
+
+#include "filesystem.hpp"
+
+#include <algorithm>
+
+namespace toy::filesystem::lz {
+
+namespace {
+
+/// Bytes of one wide copy
+constexpr size_t c_wideCopySize = 16;
+
+/// Targets with 128-bit registers copy in chunks; the handhelds copy bytes
+#ifdef TOYGINE_SIMD_VECTOR128
+constexpr bool c_wideCopies = true;
+#else
+constexpr bool c_wideCopies = false;
+#endif // TOYGINE_SIMD_VECTOR128
+
+/// Top bit of a block header: the block is stored raw
+constexpr uint32_t c_storedBlock = 0x80000000U;
+
+/// Shortest match
+constexpr size_t c_minMatch = 4;
+
+/// Bits of the compressor hash table
+constexpr uint32_t c_hashBits = 13;
+
+/// Reads the little-endian \a T at \a data.
+template <std::unsigned_integral T>
+T loadLittle(const std::byte * data) noexcept {
+  T value;
+
+  std::memcpy(&value, data, sizeof(T));
+
+  if constexpr (std::endian::native == std::endian::big)
+    value = std::byteswap(value);
+
+  return value;
+}
+
+/// Writes \a value as a little-endian \a T at \a data.
+template <std::unsigned_integral T>
+void storeLittle(std::byte * data, T value) noexcept {
+  if constexpr (std::endian::native == std::endian::big)
+    value = std::byteswap(value);
+
+  std::memcpy(data, &value, sizeof(T));
+}
+
+/// Copies \a count bytes forward from \a source to \a destination, one at a time; works for overlapping matches.
+void copyBytes(std::byte * destination, const std::byte * source, size_t count) noexcept {
+  for (size_t index = 0; index < count; ++index)
+    destination[index] = source[index];
+}
+
+/// Copies \a count bytes in chunks of \ref c_wideCopySize, writing up to 15 bytes past them.
+void copyWide(std::byte * destination, const std::byte * source, size_t count) noexcept {
+  // Each chunk is loaded before it is stored, so a destination up to 16 bytes before the source is fine
+  for (size_t index = 0; index < count; index += c_wideCopySize) {
+    std::byte chunk[c_wideCopySize];
+
+    std::memcpy(chunk, source + index, c_wideCopySize);
+    std::memcpy(destination + index, chunk, c_wideCopySize);
+  }
+}
+
+/// Returns \a count rounded up to whole wide copies.
+constexpr size_t wideSize(size_t count) noexcept {
+  return (count + c_wideCopySize - 1) & ~(c_wideCopySize - 1);
+}
+
+/// Buffers one block decodes between.
+struct BlockBuffers {
+  /// Lowest byte a match may reach back to
+  const std::byte * history;
+
+  /// End of the readable input, for wide literal copies
+  const std::byte * readEnd;
+
+  /// End of the writable output, for wide copies
+  const std::byte * writeEnd;
+
+  /// The input lies in the output: no write may pass the unread input
+  bool inPlace;
+};
+
+/// Reads the extension bytes of a literal count or match length into \a value; \c false past \a end.
+bool readLength(const std::byte *& in, const std::byte * end, size_t & value) noexcept {
+  uint8_t byte = 0;
+
+  do {
+    if (in == end)
+      return false;
+
+    byte = static_cast<uint8_t>(*in++);
+    value += byte;
+  } while (byte == 255);
+
+  return true;
+}
+
+/*!
+  \brief Decodes the sequences from \a in to \a inEnd into exactly the bytes from \a out to \a outEnd.
+
+  \tparam Wide Copies 16 bytes at a time where \a buffers leave room.
+
+  \return Whether the block decoded.
+*/
+template <bool Wide>
+bool decodeBlock(const std::byte * in, const std::byte * inEnd, std::byte * out, std::byte * outEnd,
+                 const BlockBuffers & buffers) noexcept {
+  if (buffers.inPlace && out > in)
+    return false;
+
+  while (in < inEnd) {
+    const auto token    = static_cast<uint8_t>(*in++);
+    size_t     literals = token >> 4;
+
+    if (literals == 15 && !readLength(in, inEnd, literals))
+      return false;
+
+    if (literals > static_cast<size_t>(inEnd - in) || literals > static_cast<size_t>(outEnd - out))
+      return false;
+
+    // In place, the literals may overwrite only themselves, as they are read
+    const std::byte * literalsLimit = buffers.inPlace ? in + literals : buffers.writeEnd;
+
+    if (Wide && wideSize(literals) <= static_cast<size_t>(buffers.readEnd - in)
+        && wideSize(literals) <= static_cast<size_t>(literalsLimit - out))
+      copyWide(out, in, literals);
+    else if (buffers.inPlace)
+      std::memmove(out, in, literals);
+    else
+      copyBytes(out, in, literals);
+
+    in += literals;
+    out += literals;
+
+    // The last sequence ends after its literals
+    if (in == inEnd)
+      break;
+
+    if (inEnd - in < 2)
+      return false;
+
+    const size_t offset = loadLittle<uint16_t>(in);
+    size_t       length = (token & 15) + c_minMatch;
+
+    in += 2;
+
+    if ((token & 15) == 15 && !readLength(in, inEnd, length))
+      return false;
+
+    if (offset == 0 || offset > static_cast<size_t>(out - buffers.history))
+      return false;
+
+    if (length > static_cast<size_t>(outEnd - out))
+      return false;
+
+    const std::byte * matchLimit = buffers.inPlace ? in : buffers.writeEnd;
+
+    if (length > static_cast<size_t>(matchLimit - out))
+      return false;
+
+    if (Wide && offset >= c_wideCopySize && wideSize(length) <= static_cast<size_t>(matchLimit - out))
+      copyWide(out, out - offset, length);
+    else
+      copyBytes(out, out - offset, length);
+
+    out += length;
+  }
+
+  return out == outEnd;
+}
+
+/// Decodes the block whose header is at \a in, of \a rawSize bytes, to \a out; returns the next header, or \c nullptr.
+template <bool Wide>
+const std::byte * decodeNext(const std::byte * in, const std::byte * streamEnd, std::byte * out, size_t rawSize,
+                             const BlockBuffers & buffers) noexcept {
+  if (streamEnd - in < static_cast<ptrdiff_t>(sizeof(uint32_t)))
+    return nullptr;
+
+  const uint32_t header = loadLittle<uint32_t>(in);
+  const size_t   size   = header & ~c_storedBlock;
+
+  in += sizeof(uint32_t);
+
+  if (size > static_cast<size_t>(streamEnd - in))
+    return nullptr;
+
+  if ((header & c_storedBlock) != 0) {
+    if (size != rawSize || (buffers.inPlace && out > in))
+      return nullptr;
+
+    std::memmove(out, in, size);
+  } else if (!decodeBlock<Wide>(in, in + size, out, out + rawSize, buffers)) {
+    return nullptr;
+  }
+
+  return in + size;
+}
+
+/// decompress() with or without wide copies.
+template <bool Wide>
+bool decompressStream(span<const std::byte> stream, span<std::byte> destination) noexcept {
+  const StreamInfo info = streamInfo(stream);
+
+  if (!info || info.rawSize > destination.size())
+    return false;
+
+  const auto        address     = reinterpret_cast<uintptr_t>(stream.data());
+  const auto        first       = reinterpret_cast<uintptr_t>(destination.data());
+  const std::byte * in          = stream.data() + sizeof(StreamHeader);
+  const std::byte * streamEnd   = stream.data() + stream.size();
+  std::byte *       out         = destination.data();
+  const auto        rawSize     = static_cast<size_t>(info.rawSize);
+  size_t            decodedSize = 0;
+
+  const BlockBuffers buffers{destination.data(), streamEnd, destination.data() + destination.size(),
+                             address >= first && address < first + destination.size()};
+
+  while (decodedSize < rawSize) {
+    const size_t blockSize = std::min(info.windowSize, rawSize - decodedSize);
+
+    in = decodeNext<Wide>(in, streamEnd, out + decodedSize, blockSize, buffers);
+
+    if (in == nullptr)
+      return false;
+
+    decodedSize += blockSize;
+  }
+
+  return in == streamEnd;
+}
+
+/// Returns the hash table slot of the 4 bytes at \a data.
+uint32_t hashSlot(const std::byte * data) noexcept {
+  return (loadLittle<uint32_t>(data) * 2654435761U) >> (32 - c_hashBits);
+}
+
+/// Writes \a value as a token nibble extension: bytes of 255, then the rest.
+std::byte * writeLength(std::byte * out, size_t value) noexcept {
+  for (; value >= 255; value -= 255)
+    *out++ = std::byte{255};
+
+  *out++ = static_cast<std::byte>(value);
+
+  return out;
+}
+
+/// Appends one sequence to \a out; a \a length of 0 writes the literals of the last sequence only.
+std::byte * writeSequence(std::byte * out, const std::byte * literals, size_t literalCount, size_t offset,
+                          size_t length) noexcept {
+  const size_t matchCode = length > 0 ? length - c_minMatch : 0;
+  std::byte *  token     = out++;
+
+  *token = static_cast<std::byte>((std::min<size_t>(literalCount, 15) << 4) | std::min<size_t>(matchCode, 15));
+
+  if (literalCount >= 15)
+    out = writeLength(out, literalCount - 15);
+
+  std::memcpy(out, literals, literalCount);
+  out += literalCount;
+
+  if (length == 0)
+    return out;
+
+  storeLittle(out, static_cast<uint16_t>(offset));
+  out += 2;
+
+  return matchCode >= 15 ? writeLength(out, matchCode - 15) : out;
+}
+
+/// Returns the most bytes writeSequence() writes for \a literalCount literals and a match.
+constexpr size_t sequenceBound(size_t literalCount) noexcept {
+  return 1 + literalCount / 255 + 1 + literalCount + 2 + 1;
+}
+
+/*!
+  \brief Compresses the block from \a first to \a last of \a source into \a out, at most \a capacity bytes.
+
+  \return Bytes written; 0 when the block does not fit, and should be stored.
+*/
+size_t compressBlock(const std::byte * source, size_t first, size_t last, size_t windowSize, uint32_t * table,
+                     std::byte * out, size_t capacity) noexcept {
+  const size_t maxOffset = std::min<size_t>(windowSize, UINT16_MAX);
+  std::byte *  start     = out;
+  std::byte *  end       = out + capacity;
+  size_t       anchor    = first;
+  size_t       position  = first;
+  size_t       misses    = 0;
+
+  while (position + c_minMatch <= last) {
+    const uint32_t slot      = hashSlot(source + position);
+    const uint32_t candidate = table[slot];
+
+    table[slot] = static_cast<uint32_t>(position) + 1;
+
+    // Table entries hold positions plus one, so zero is empty
+    const bool found = candidate != 0 && position - (candidate - 1) <= maxOffset
+                       && std::memcmp(source + candidate - 1, source + position, c_minMatch) == 0;
+
+    if (!found) {
+      // Skip faster through data that does not compress, as LZ4 does
+      position += 1 + (misses++ >> 6);
+      continue;
+    }
+
+    const size_t match  = candidate - 1;
+    size_t       length = c_minMatch;
+
+    while (position + length < last && source[match + length] == source[position + length])
+      ++length;
+
+    const size_t literalCount = position - anchor;
+
+    if (sequenceBound(literalCount) + length / 255 > static_cast<size_t>(end - out))
+      return 0;
+
+    out = writeSequence(out, source + anchor, literalCount, position - match, length);
+
+    // Index the end of the match too, so repeats right after it are found
+    if (position + length + c_minMatch <= last && length > 2)
+      table[hashSlot(source + position + length - 2)] = static_cast<uint32_t>(position + length - 2) + 1;
+
+    position += length;
+    anchor = position;
+    misses = 0;
+  }
+
+  if (anchor < last) {
+    if (sequenceBound(last - anchor) > static_cast<size_t>(end - out))
+      return 0;
+
+    out = writeSequence(out, source + anchor, last - anchor, 0, 0);
+  }
+
+  const auto size = static_cast<size_t>(out - start);
+
+  return size < last - first ? size : 0;
+}
+
+} // namespace
+
+StreamInfo streamInfo(span<const std::byte> stream) noexcept {
+  if (stream.size() < sizeof(StreamHeader) || std::memcmp(stream.data(), c_magic.data(), c_magic.size()) != 0)
+    return {0, 0};
+
+  const auto version    = static_cast<uint8_t>(stream[offsetof(StreamHeader, version)]);
+  const auto windowBits = static_cast<uint8_t>(stream[offsetof(StreamHeader, windowBits)]);
+  const auto rawSize    = loadLittle<uint64_t>(stream.data() + offsetof(StreamHeader, rawSize));
+
+  if (version != c_version || windowBits < c_minWindowBits || windowBits > c_maxWindowBits || rawSize > SIZE_MAX)
+    return {0, 0};
+
+  return {rawSize, size_t{1} << windowBits};
+}
+
+size_t compress(span<const std::byte> source, span<std::byte> destination, uint8_t windowBits) noexcept {
+  if (windowBits < c_minWindowBits || windowBits > c_maxWindowBits || source.size() >= UINT32_MAX
+      || destination.size() < compressBound(source.size(), windowBits))
+    return 0;
+
+  std::byte * out = destination.data();
+
+  std::memcpy(out, c_magic.data(), c_magic.size());
+  out[offsetof(StreamHeader, version)]    = std::byte{c_version};
+  out[offsetof(StreamHeader, windowBits)] = std::byte{windowBits};
+  storeLittle(out + offsetof(StreamHeader, reserved), uint16_t{0});
+  storeLittle(out + offsetof(StreamHeader, rawSize), static_cast<uint64_t>(source.size()));
+  out += sizeof(StreamHeader);
+
+  const size_t windowSize = size_t{1} << windowBits;
+
+  // Positions stay in the table across blocks, so matches reach into the block before
+  array<uint32_t, size_t{1} << c_hashBits> table{};
+
+  for (size_t first = 0; first < source.size(); first += windowSize) {
+    const size_t last   = std::min(first + windowSize, source.size());
+    std::byte *  header = out;
+    size_t       size   = compressBlock(source.data(), first, last, windowSize, table.data(), header + 4, last - first);
+
+    if (size != 0) {
+      storeLittle(header, static_cast<uint32_t>(size));
+    } else {
+      size = last - first;
+      storeLittle(header, static_cast<uint32_t>(size) | c_storedBlock);
+      std::memcpy(header + 4, source.data() + first, size);
+    }
+
+    out = header + 4 + size;
+  }
+
+  return static_cast<size_t>(out - destination.data());
+}
+
+bool decompress(span<const std::byte> stream, span<std::byte> destination) noexcept {
+  return decompressStream<c_wideCopies>(stream, destination);
+}
+
+namespace scalar {
+
+bool decompress(span<const std::byte> stream, span<std::byte> destination) noexcept {
+  return decompressStream<false>(stream, destination);
+}
+
+} // namespace scalar
+
+Decompressor::Decompressor(span<const std::byte> stream, span<std::byte> ring) noexcept {
+  const StreamInfo info = streamInfo(stream);
+
+  if (!info || ring.size() < ringSize(info.windowSize))
+    return;
+
+  _stream     = stream;
+  _ring       = ring;
+  _cursor     = sizeof(StreamHeader);
+  _windowSize = info.windowSize;
+  _rawSize    = info.rawSize;
+}
+
+span<const std::byte> Decompressor::next() noexcept {
+  if (_windowSize == 0 || _damaged || _position == _rawSize)
+    return {};
+
+  const auto blockSize = static_cast<size_t>(std::min<uint64_t>(_windowSize, _rawSize - _position));
+
+  // Slide the last window of history back to the start when the block would not fit after it
+  if (_fill + blockSize > _ring.size()) {
+    const size_t history = std::min(_fill, _windowSize);
+
+    std::memmove(_ring.data(), _ring.data() + _fill - history, history);
+    _fill = history;
+  }
+
+  const std::byte *  streamEnd = _stream.data() + _stream.size();
+  const BlockBuffers buffers{_ring.data(), streamEnd, _ring.data() + _ring.size(), false};
+
+  const std::byte * in =
+    decodeNext<c_wideCopies>(_stream.data() + _cursor, streamEnd, _ring.data() + _fill, blockSize, buffers);
+
+  if (in == nullptr) {
+    _damaged = true;
+
+    return {};
+  }
+
+  const span<const std::byte> block(_ring.data() + _fill, blockSize);
+
+  _cursor = static_cast<size_t>(in - _stream.data());
+  _fill += blockSize;
+  _position += blockSize;
+
+  return block;
+}
+
+} // namespace toy::filesystem::lz
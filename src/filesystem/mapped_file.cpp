@@ -0,0 +1,176 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   mapped_file.cpp
+  \brief  File mapping with mmap on Linux and macOS and MapViewOfFile on Windows; a heap copy elsewhere.
+*/
+
+#include "filesystem.hpp"
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <cstdio>
+#endif
+
+namespace toy::filesystem {
+
+namespace {
+
+#if !defined(_WIN32) && !defined(__linux__) && !defined(__APPLE__)
+
+/// Heap behind the copies of targets without file mapping
+constinit HeapAllocator s_heap;
+
+#endif
+
+/// Maps the file at \a path; returns the contents, or an empty span when the file is missing or empty.
+span<const std::byte> mapFile(const char * path) noexcept {
+#if defined(_WIN32)
+  HANDLE file =
+    CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+  if (file == INVALID_HANDLE_VALUE)
+    return {};
+
+  LARGE_INTEGER size{};
+  void *        view = nullptr;
+
+  if (GetFileSizeEx(file, &size) && size.QuadPart > 0) {
+    // The view keeps the mapping alive, so both handles can be closed at once
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+    if (mapping != nullptr) {
+      view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+      CloseHandle(mapping);
+    }
+  }
+
+  CloseHandle(file);
+
+  if (view == nullptr)
+    return {};
+
+  return {static_cast<const std::byte *>(view), static_cast<size_t>(size.QuadPart)};
+#elif defined(__linux__) || defined(__APPLE__)
+  const int file = ::open(path, O_RDONLY | O_CLOEXEC);
+
+  if (file < 0)
+    return {};
+
+  struct stat status{};
+  void *      view = MAP_FAILED;
+
+  // The mapping holds its own reference to the file, so the descriptor can be closed at once
+  if (::fstat(file, &status) == 0 && status.st_size > 0)
+    view = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+
+  ::close(file);
+
+  if (view == MAP_FAILED)
+    return {};
+
+  return {static_cast<const std::byte *>(view), static_cast<size_t>(status.st_size)};
+#else
+  std::FILE * file = std::fopen(path, "rb");
+
+  if (file == nullptr)
+    return {};
+
+  std::fseek(file, 0, SEEK_END);
+
+  const long   length = std::ftell(file);
+  const size_t size   = length > 0 ? static_cast<size_t>(length) : 0;
+  TrackedAllocator<HeapAllocator> memory(s_heap, MemoryTag::Assets);
+  void *                          copy = size > 0 ? memory.allocate(size, c_packAlignment) : nullptr;
+
+  std::fseek(file, 0, SEEK_SET);
+
+  if (copy != nullptr && std::fread(copy, 1, size, file) != size) {
+    memory.deallocate(copy, size, c_packAlignment);
+    copy = nullptr;
+  }
+
+  std::fclose(file);
+
+  if (copy == nullptr)
+    return {};
+
+  return {static_cast<const std::byte *>(copy), size};
+#endif
+}
+
+/// Releases contents returned by mapFile().
+void unmapFile(span<const std::byte> contents) noexcept {
+#if defined(_WIN32)
+  UnmapViewOfFile(contents.data());
+#elif defined(__linux__) || defined(__APPLE__)
+  ::munmap(const_cast<std::byte *>(contents.data()), contents.size());
+#else
+  TrackedAllocator<HeapAllocator>(s_heap, MemoryTag::Assets)
+    .deallocate(const_cast<std::byte *>(contents.data()), contents.size(), c_packAlignment);
+#endif
+}
+
+} // namespace
+
+MappedFile::MappedFile(const char * path) noexcept {
+  const span<const std::byte> contents = mapFile(path);
+
+  _data = contents.data();
+  _size = contents.size();
+}
+
+MappedFile::~MappedFile() noexcept {
+  close();
+}
+
+MappedFile::MappedFile(MappedFile && other) noexcept
+  : _data(std::exchange(other._data, nullptr))
+  , _size(std::exchange(other._size, 0)) {}
+
+MappedFile & MappedFile::operator=(MappedFile && other) noexcept {
+  if (this != &other) {
+    close();
+    _data = std::exchange(other._data, nullptr);
+    _size = std::exchange(other._size, 0);
+  }
+
+  return *this;
+}
+
+void MappedFile::close() noexcept {
+  if (_data == nullptr)
+    return;
+
+  unmapFile({_data, _size});
+  _data = nullptr;
+  _size = 0;
+}
+
+} // namespace toy::filesystem
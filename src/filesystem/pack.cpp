@@ -0,0 +1,260 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   pack.cpp
+  \brief  Reading and writing of pack images.
+
+  Every field is read and written through memcpy and a byte swap on big-endian targets, so images need no alignment
+  beyond what the layout gives them and read the same on every target.
+*/
+
+#include "filesystem.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace toy::filesystem {
+
+namespace {
+
+/// Reads the little-endian \a T at \a data.
+template <std::unsigned_integral T>
+T loadLittle(const std::byte * data) noexcept {
+  T value;
+
+  std::memcpy(&value, data, sizeof(T));
+
+  if constexpr (std::endian::native == std::endian::big)
+    value = std::byteswap(value);
+
+  return value;
+}
+
+/// Writes \a value as a little-endian \a T at \a data.
+template <std::unsigned_integral T>
+void storeLittle(std::byte * data, T value) noexcept {
+  if constexpr (std::endian::native == std::endian::big)
+    value = std::byteswap(value);
+
+  std::memcpy(data, &value, sizeof(T));
+}
+
+/// Returns \a value rounded up to a multiple of \ref c_packAlignment.
+constexpr uint64_t alignUp(uint64_t value) noexcept {
+  return (value + c_packAlignment - 1) & ~static_cast<uint64_t>(c_packAlignment - 1);
+}
+
+/// Returns the bucket bits for \a count files: about one file per bucket.
+constexpr uint16_t bucketBitsFor(size_t count) noexcept {
+  const auto bits = static_cast<uint16_t>(count > 1 ? std::bit_width(count - 1) : 1);
+
+  return bits < c_maxBucketBits ? bits : c_maxBucketBits;
+}
+
+/// Returns the bytes of the bucket index of \a bits bits.
+constexpr uint64_t bucketsSize(uint16_t bits) noexcept {
+  return ((uint64_t{1} << bits) + 1) * sizeof(uint32_t);
+}
+
+/// Returns whether \a size bytes at \a offset lie within \a imageSize bytes, without overflowing.
+constexpr bool isWithin(uint64_t offset, uint64_t size, uint64_t imageSize) noexcept {
+  return offset <= imageSize && size <= imageSize - offset;
+}
+
+} // namespace
+
+Pack::Pack(const void * data, size_t size) noexcept {
+  const auto * image = static_cast<const std::byte *>(data);
+
+  if (image == nullptr || size < sizeof(PackHeader) || std::memcmp(image, c_packMagic.data(), c_packMagic.size()) != 0)
+    return;
+
+  const auto version       = loadLittle<uint16_t>(image + offsetof(PackHeader, version));
+  const auto bucketBits    = loadLittle<uint16_t>(image + offsetof(PackHeader, bucketBits));
+  const auto entryCount    = loadLittle<uint32_t>(image + offsetof(PackHeader, entryCount));
+  const auto entriesOffset = loadLittle<uint64_t>(image + offsetof(PackHeader, entriesOffset));
+  const auto bucketsOffset = loadLittle<uint64_t>(image + offsetof(PackHeader, bucketsOffset));
+  const auto namesOffset   = loadLittle<uint64_t>(image + offsetof(PackHeader, namesOffset));
+  const auto namesSize     = loadLittle<uint64_t>(image + offsetof(PackHeader, namesSize));
+  const auto imageSize     = loadLittle<uint64_t>(image + offsetof(PackHeader, imageSize));
+
+  // A larger buffer is fine, such as a ROM region padded past the image
+  if (version == 0 || version > c_packVersion || bucketBits == 0 || bucketBits > c_maxBucketBits || imageSize > size
+      || !isWithin(entriesOffset, uint64_t{entryCount} * sizeof(PackEntry), imageSize)
+      || !isWithin(bucketsOffset, bucketsSize(bucketBits), imageSize) || !isWithin(namesOffset, namesSize, imageSize))
+    return;
+
+  const std::byte * buckets = image + bucketsOffset;
+
+  if (loadLittle<uint32_t>(buckets + (size_t{1} << bucketBits) * sizeof(uint32_t)) != entryCount)
+    return;
+
+  _image       = image;
+  _imageSize   = static_cast<size_t>(imageSize);
+  _entries     = image + entriesOffset;
+  _buckets     = buckets;
+  _names       = reinterpret_cast<const char *>(image + namesOffset);
+  _namesSize   = static_cast<size_t>(namesSize);
+  _entryCount  = entryCount;
+  _bucketShift = 64U - bucketBits;
+}
+
+PackFile Pack::find(StringId id) const noexcept {
+  if (_image == nullptr)
+    return {};
+
+  const uint64_t hash   = id.value();
+  const size_t   bucket = static_cast<size_t>(hash >> _bucketShift);
+  const uint32_t first  = loadLittle<uint32_t>(_buckets + bucket * sizeof(uint32_t));
+  uint32_t       last   = loadLittle<uint32_t>(_buckets + (bucket + 1) * sizeof(uint32_t));
+
+  last = last < _entryCount ? last : _entryCount;
+
+  for (uint32_t index = first; index < last; ++index) {
+    if (loadLittle<uint64_t>(_entries + index * sizeof(PackEntry) + offsetof(PackEntry, pathHash)) == hash)
+      return decode(index);
+  }
+
+  return {};
+}
+
+PackFile Pack::file(size_t index) const noexcept {
+  return index < _entryCount ? decode(index) : PackFile{};
+}
+
+PackFile Pack::decode(size_t index) const noexcept {
+  const std::byte * entry      = _entries + index * sizeof(PackEntry);
+  const auto        hash       = loadLittle<uint64_t>(entry + offsetof(PackEntry, pathHash));
+  const auto        offset     = loadLittle<uint64_t>(entry + offsetof(PackEntry, offset));
+  const auto        size       = loadLittle<uint64_t>(entry + offsetof(PackEntry, size));
+  const auto        nameOffset = loadLittle<uint32_t>(entry + offsetof(PackEntry, nameOffset));
+  const auto        nameSize   = loadLittle<uint16_t>(entry + offsetof(PackEntry, nameSize));
+  const auto        flags      = loadLittle<uint16_t>(entry + offsetof(PackEntry, flags));
+
+  if (!isWithin(offset, size, _imageSize) || !isWithin(nameOffset, nameSize, _namesSize))
+    return {};
+
+  return {StringId(hash), string_view(_names + nameOffset, nameSize),
+          span<const std::byte>(_image + offset, static_cast<size_t>(size)), (flags & c_packCompressed) != 0};
+}
+
+size_t packImageSize(span<const PackSource> sources) noexcept {
+  if (sources.size() > UINT32_MAX)
+    return 0;
+
+  uint64_t namesSize = 0;
+
+  for (const PackSource & source : sources) {
+    if (source.path.size() > UINT16_MAX)
+      return 0;
+
+    namesSize += source.path.size();
+  }
+
+  uint64_t size = sizeof(PackHeader) + sources.size() * sizeof(PackEntry) + bucketsSize(bucketBitsFor(sources.size()));
+
+  // Every file is padded to the alignment, so the size does not depend on the order writePack() lays the files in
+  size = alignUp(size + namesSize);
+
+  for (const PackSource & source : sources)
+    size += alignUp(source.data.size());
+
+  return static_cast<size_t>(size);
+}
+
+size_t writePack(span<PackSource> sources, span<std::byte> buffer) noexcept {
+  const size_t imageSize = packImageSize(sources);
+
+  if (imageSize == 0 || buffer.size() < imageSize)
+    return 0;
+
+  std::sort(sources.begin(), sources.end(), [](const PackSource & left, const PackSource & right) {
+    return hash64(left.path) < hash64(right.path);
+  });
+
+  for (size_t index = 1; index < sources.size(); ++index) {
+    if (hash64(sources[index - 1].path) == hash64(sources[index].path))
+      return 0;
+  }
+
+  const auto     count         = static_cast<uint32_t>(sources.size());
+  const uint16_t bucketBits    = bucketBitsFor(count);
+  const uint64_t entriesOffset = sizeof(PackHeader);
+  const uint64_t bucketsOffset = entriesOffset + uint64_t{count} * sizeof(PackEntry);
+  const uint64_t namesOffset   = bucketsOffset + bucketsSize(bucketBits);
+  std::byte *    image         = buffer.data();
+
+  // Padding and reserved fields are zero, so equal sources always give equal images
+  std::memset(image, 0, imageSize);
+  std::memcpy(image, c_packMagic.data(), c_packMagic.size());
+  storeLittle(image + offsetof(PackHeader, version), c_packVersion);
+  storeLittle(image + offsetof(PackHeader, bucketBits), bucketBits);
+  storeLittle(image + offsetof(PackHeader, entryCount), count);
+  storeLittle(image + offsetof(PackHeader, entriesOffset), entriesOffset);
+  storeLittle(image + offsetof(PackHeader, bucketsOffset), bucketsOffset);
+  storeLittle(image + offsetof(PackHeader, namesOffset), namesOffset);
+  storeLittle(image + offsetof(PackHeader, imageSize), static_cast<uint64_t>(imageSize));
+
+  const uint32_t shift      = 64U - bucketBits;
+  uint64_t       nameOffset = 0;
+  size_t         bucket     = 0;
+
+  for (uint32_t index = 0; index < count; ++index) {
+    const PackSource & source = sources[index];
+    const uint64_t     hash   = hash64(source.path);
+    std::byte *        entry  = image + entriesOffset + index * sizeof(PackEntry);
+
+    // Every bucket up to this file's starts at this file
+    for (; bucket <= static_cast<size_t>(hash >> shift); ++bucket)
+      storeLittle(image + bucketsOffset + bucket * sizeof(uint32_t), index);
+
+    storeLittle(entry + offsetof(PackEntry, pathHash), hash);
+    storeLittle(entry + offsetof(PackEntry, size), static_cast<uint64_t>(source.data.size()));
+    storeLittle(entry + offsetof(PackEntry, nameOffset), static_cast<uint32_t>(nameOffset));
+    storeLittle(entry + offsetof(PackEntry, nameSize), static_cast<uint16_t>(source.path.size()));
+    storeLittle(entry + offsetof(PackEntry, flags), source.compressed ? c_packCompressed : uint16_t{0});
+
+    std::memcpy(image + namesOffset + nameOffset, source.path.data(), source.path.size());
+    nameOffset += source.path.size();
+  }
+
+  for (; bucket <= (size_t{1} << bucketBits); ++bucket)
+    storeLittle(image + bucketsOffset + bucket * sizeof(uint32_t), count);
+
+  storeLittle(image + offsetof(PackHeader, namesSize), nameOffset);
+
+  uint64_t offset = namesOffset + nameOffset;
+
+  for (uint32_t index = 0; index < count; ++index) {
+    const PackSource & source = sources[index];
+
+    offset = alignUp(offset);
+    storeLittle(image + entriesOffset + index * sizeof(PackEntry) + offsetof(PackEntry, offset), offset);
+
+    if (!source.data.empty())
+      std::memcpy(image + offset, source.data.data(), source.data.size());
+
+    offset += source.data.size();
+  }
+
+  return imageSize;
+}
+
+} // namespace toy::filesystem
@@ -0,0 +1,244 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   virtual_file_system.cpp
+  \brief  Mounts of the virtual file system, the loose files read from mounted directories, and decompressed files.
+*/
+
+#include "filesystem.hpp"
+
+#include <cstdio>
+
+namespace toy::filesystem {
+
+namespace {
+
+/// Heap behind the contents of loose files
+constinit HeapAllocator s_heap;
+
+/// Returns the allocator of file contents, which charges them to MemoryTag::Assets.
+TrackedAllocator<HeapAllocator> fileMemory() noexcept {
+  return {s_heap, MemoryTag::Assets};
+}
+
+/// Allocates contents of \a size bytes; empty files still get a byte, so they are found rather than missing.
+std::byte * allocateContents(size_t size) noexcept {
+  return static_cast<std::byte *>(fileMemory().allocate(size > 0 ? size : 1, c_packAlignment));
+}
+
+/// Frees contents of \a size bytes from allocateContents().
+void freeContents(const std::byte * contents, size_t size) noexcept {
+  fileMemory().deallocate(const_cast<std::byte *>(contents), size > 0 ? size : 1, c_packAlignment);
+}
+
+/// Opens \a path under \a root for reading; \c nullptr when it is missing or the joined path is too long.
+std::FILE * openLoose(const FixedString<c_maxPathSize> & root, string_view path) noexcept {
+  FixedString<c_maxPathSize * 2> fullPath;
+
+  if (root.size() + 1 + path.size() > fullPath.capacity())
+    return nullptr;
+
+  fullPath.append(root).append(1, '/').append(path);
+
+  return std::fopen(fullPath.c_str(), "rb");
+}
+
+/// Reads all of \a file into memory from fileMemory(); an empty span when it cannot.
+span<const std::byte> readLoose(std::FILE * file) noexcept {
+  std::fseek(file, 0, SEEK_END);
+
+  const long   length   = std::ftell(file);
+  const size_t size     = length > 0 ? static_cast<size_t>(length) : 0;
+  std::byte *  contents = allocateContents(size);
+
+  std::fseek(file, 0, SEEK_SET);
+
+  if (contents != nullptr && std::fread(contents, 1, size, file) != size) {
+    freeContents(contents, size);
+    contents = nullptr;
+  }
+
+  return contents != nullptr ? span<const std::byte>(contents, size) : span<const std::byte>();
+}
+
+/// Decompresses the pack file data \a stream into memory of its own; an empty span when it is damaged.
+span<const std::byte> decompressPacked(span<const std::byte> stream) noexcept {
+  const lz::StreamInfo info = lz::streamInfo(stream);
+
+  if (!info)
+    return {};
+
+  const auto  size     = static_cast<size_t>(info.rawSize);
+  std::byte * contents = allocateContents(size);
+
+  if (contents != nullptr && !lz::decompress(stream, {contents, size})) {
+    freeContents(contents, size);
+    contents = nullptr;
+  }
+
+  return contents != nullptr ? span<const std::byte>(contents, size) : span<const std::byte>();
+}
+
+} // namespace
+
+File::~File() noexcept {
+  if (_loaded)
+    freeContents(_data, _size);
+}
+
+File::File(File && other) noexcept
+  : _data(std::exchange(other._data, nullptr))
+  , _size(std::exchange(other._size, 0))
+  , _loaded(std::exchange(other._loaded, false)) {}
+
+File & File::operator=(File && other) noexcept {
+  if (this != &other) {
+    File old(std::move(*this));
+
+    _data   = std::exchange(other._data, nullptr);
+    _size   = std::exchange(other._size, 0);
+    _loaded = std::exchange(other._loaded, false);
+  }
+
+  return *this;
+}
+
+bool VirtualFileSystem::mountPack(const Pack & pack) noexcept {
+  if (!pack.isValid() || _mountCount == c_maxMounts)
+    return false;
+
+  Mount & mount = _mounts[_mountCount++];
+
+  mount.pack = pack;
+
+  return true;
+}
+
+bool VirtualFileSystem::mountPack(const char * path) noexcept {
+  if (_mountCount == c_maxMounts)
+    return false;
+
+  MappedFile mapping(path);
+  const Pack pack(mapping.data().data(), mapping.data().size());
+
+  if (!pack.isValid())
+    return false;
+
+  Mount & mount = _mounts[_mountCount++];
+
+  mount.pack    = pack;
+  mount.mapping = std::move(mapping);
+
+  return true;
+}
+
+bool VirtualFileSystem::mountDirectory(const char * root) noexcept {
+  const string_view rootPath(root);
+
+  if (rootPath.empty() || rootPath.size() > c_maxPathSize || _mountCount == c_maxMounts)
+    return false;
+
+  Mount & mount = _mounts[_mountCount++];
+
+  mount.root.assign(rootPath.data(), rootPath.size());
+
+  return true;
+}
+
+void VirtualFileSystem::unmountAll() noexcept {
+  for (size_t index = 0; index < _mountCount; ++index) {
+    _mounts[index].pack = Pack();
+    _mounts[index].mapping.close();
+    _mounts[index].root.clear();
+  }
+
+  _mountCount = 0;
+}
+
+File VirtualFileSystem::open(string_view path) const noexcept {
+  return find(StringId(hash64(path)), path);
+}
+
+File VirtualFileSystem::open(StringId id) const noexcept {
+  return find(id, {});
+}
+
+bool VirtualFileSystem::exists(string_view path) const noexcept {
+  const StringId id(hash64(path));
+
+  for (size_t index = _mountCount; index > 0; --index) {
+    const Mount & mount = _mounts[index - 1];
+
+    if (mount.pack.isValid()) {
+      if (mount.pack.find(id))
+        return true;
+
+      continue;
+    }
+
+    if (std::FILE * file = openLoose(mount.root, path); file != nullptr) {
+      std::fclose(file);
+
+      return true;
+    }
+  }
+
+  return false;
+}
+
+File VirtualFileSystem::find(StringId id, string_view path) const noexcept {
+  for (size_t index = _mountCount; index > 0; --index) {
+    const Mount & mount = _mounts[index - 1];
+
+    if (mount.pack.isValid()) {
+      const PackFile file = mount.pack.find(id);
+
+      if (file && !file.compressed)
+        return File(file.data, false);
+
+      // A damaged compressed file is skipped, as damaged entries are
+      if (file) {
+        if (const span<const std::byte> contents = decompressPacked(file.data); contents.data() != nullptr)
+          return File(contents, true);
+      }
+
+      continue;
+    }
+
+    if (path.empty())
+      continue;
+
+    std::FILE * file = openLoose(mount.root, path);
+
+    if (file == nullptr)
+      continue;
+
+    const span<const std::byte> contents = readLoose(file);
+
+    std::fclose(file);
+
+    if (contents.data() != nullptr)
+      return File(contents, true);
+  }
+
+  return {};
+}
+
+} // namespace toy::filesystem
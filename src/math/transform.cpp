@@ -0,0 +1,191 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   transform.cpp
+  \brief  Batch point transforms: the vector loops and their point-at-a-time references.
+
+  The vector loops in transform_kernels.inl are written once against \c Lanes and compiled once per
+  \ref toy::platform::SimdLevel: eight floats of AVX2, or a \ref toy::math::Float4 of SSE or NEON. Each public routine
+  calls the loop platform::selectKernel() picks; targets without vector registers run the \ref toy::math::scalar
+  routines.
+*/
+
+#include "math.hpp"
+
+#include <algorithm>
+
+#ifdef TOYGINE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace toy::math {
+
+namespace {
+
+/// Signature of the 2D transformPoints()
+using TransformPoints2d = void(const Matrix3<float> &, const float *, const float *, float *, float *, size_t) noexcept;
+
+/// Signature of the 3D transformPoints()
+using TransformPoints3d = void(const Matrix4<float> &, const float *, const float *, const float *, float *, float *,
+                               float *, size_t) noexcept;
+
+#ifdef TOYGINE_SIMD_VECTOR128
+
+/// 128-bit transforms, with SSE or NEON.
+namespace vector128 {
+
+/*!
+  \brief One vector register of coordinates, as the batch loops see it.
+
+  Each SIMD level defines lanes of this shape in its own namespace, and transform_kernels.inl builds the loops on them.
+*/
+struct Lanes {
+  static constexpr size_t c_size = 4;
+
+  using Register = Float4;
+
+  static Register broadcast(float value) noexcept {
+    return Float4(value);
+  }
+
+  static Register load(const float * values) noexcept {
+    return Float4::load(values);
+  }
+
+  static void store(float * values, Register lanes) noexcept {
+    lanes.store(values);
+  }
+
+  static Register multiplyAdd(Register left, Register right, Register addend) noexcept {
+    return math::multiplyAdd(left, right, addend);
+  }
+};
+
+#include "transform_kernels.inl"
+
+} // namespace vector128
+
+#endif // TOYGINE_SIMD_VECTOR128
+
+#ifdef TOYGINE_SIMD_AVX2
+
+TOYGINE_SIMD_AVX2_BEGIN
+
+/// 256-bit transforms, with AVX2 and FMA.
+namespace avx2 {
+
+/// Lanes of an AVX2 register; see vector128::Lanes.
+struct Lanes {
+  static constexpr size_t c_size = 8;
+
+  using Register = __m256;
+
+  static Register broadcast(float value) noexcept {
+    return _mm256_set1_ps(value);
+  }
+
+  static Register load(const float * values) noexcept {
+    return _mm256_loadu_ps(values);
+  }
+
+  static void store(float * values, Register lanes) noexcept {
+    _mm256_storeu_ps(values, lanes);
+  }
+
+  static Register multiplyAdd(Register left, Register right, Register addend) noexcept {
+    return _mm256_fmadd_ps(left, right, addend);
+  }
+};
+
+#include "transform_kernels.inl"
+
+} // namespace avx2
+
+TOYGINE_SIMD_AVX2_END
+
+#endif // TOYGINE_SIMD_AVX2
+
+} // namespace
+
+void transformPoints(const Matrix3<float> & transform, const float * x, const float * y, float * resultX,
+                     float * resultY, size_t count) noexcept {
+  platform::selectKernel<TransformPoints2d, TOYGINE_SIMD_KERNELS(transformPoints)>()(transform, x, y, resultX, resultY,
+                                                                                     count);
+}
+
+void transformPoints(const Matrix4<float> & transform, const float * x, const float * y, const float * z,
+                     float * resultX, float * resultY, float * resultZ, size_t count) noexcept {
+  platform::selectKernel<TransformPoints3d, TOYGINE_SIMD_KERNELS(transformPoints)>()(transform, x, y, z, resultX,
+                                                                                     resultY, resultZ, count);
+}
+
+namespace scalar {
+
+// Matrix elements are read into locals first: the result arrays could alias the matrix as far as the compiler can
+// tell, which would otherwise reload every element for every point
+
+void transformPoints(const Matrix3<float> & transform, const float * x, const float * y, float * resultX,
+                     float * resultY, size_t count) noexcept {
+  const float xFromX = transform.columns[0].x;
+  const float xFromY = transform.columns[1].x;
+  const float xShift = transform.columns[2].x;
+  const float yFromX = transform.columns[0].y;
+  const float yFromY = transform.columns[1].y;
+  const float yShift = transform.columns[2].y;
+
+  for (size_t index = 0; index < count; ++index) {
+    const float pointX = x[index];
+    const float pointY = y[index];
+
+    resultX[index] = xFromX * pointX + xFromY * pointY + xShift;
+    resultY[index] = yFromX * pointX + yFromY * pointY + yShift;
+  }
+}
+
+void transformPoints(const Matrix4<float> & transform, const float * x, const float * y, const float * z,
+                     float * resultX, float * resultY, float * resultZ, size_t count) noexcept {
+  const float xFromX = transform.columns[0].x;
+  const float xFromY = transform.columns[1].x;
+  const float xFromZ = transform.columns[2].x;
+  const float xShift = transform.columns[3].x;
+  const float yFromX = transform.columns[0].y;
+  const float yFromY = transform.columns[1].y;
+  const float yFromZ = transform.columns[2].y;
+  const float yShift = transform.columns[3].y;
+  const float zFromX = transform.columns[0].z;
+  const float zFromY = transform.columns[1].z;
+  const float zFromZ = transform.columns[2].z;
+  const float zShift = transform.columns[3].z;
+
+  // Affine: the bottom row is (0, 0, 0, 1), so the fourth coordinate is never computed
+  for (size_t index = 0; index < count; ++index) {
+    const float pointX = x[index];
+    const float pointY = y[index];
+    const float pointZ = z[index];
+
+    resultX[index] = xFromX * pointX + xFromY * pointY + xFromZ * pointZ + xShift;
+    resultY[index] = yFromX * pointX + yFromY * pointY + yFromZ * pointZ + yShift;
+    resultZ[index] = zFromX * pointX + zFromY * pointY + zFromZ * pointZ + zShift;
+  }
+}
+
+} // namespace scalar
+
+} // namespace toy::math
@@ -0,0 +1,128 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   transform_kernels.inl
+  \brief  Vector loops of the batch point transforms, written against one \c Lanes.
+
+  transform.cpp includes this file once per SIMD level, inside the namespace of the level and after its \c Lanes;
+  hence the missing include guard. Each function has the contract of the public routine of the same name. The points
+  past the last whole register go through the same lanes on zero-padded copies, so every point of a batch is rounded
+  the same way wherever it falls.
+*/
+
+void transformPoints(const Matrix3<float> & transform, const float * x, const float * y, float * resultX,
+                     float * resultY, size_t count) noexcept {
+  size_t index = 0;
+
+  // Each matrix element in every lane; a result coordinate is then two fused multiply-adds per register of points
+  const auto xFromX = Lanes::broadcast(transform.columns[0].x);
+  const auto xFromY = Lanes::broadcast(transform.columns[1].x);
+  const auto xShift = Lanes::broadcast(transform.columns[2].x);
+  const auto yFromX = Lanes::broadcast(transform.columns[0].y);
+  const auto yFromY = Lanes::broadcast(transform.columns[1].y);
+  const auto yShift = Lanes::broadcast(transform.columns[2].y);
+
+  for (; index + Lanes::c_size <= count; index += Lanes::c_size) {
+    const auto pointX = Lanes::load(x + index);
+    const auto pointY = Lanes::load(y + index);
+
+    Lanes::store(resultX + index, Lanes::multiplyAdd(xFromX, pointX, Lanes::multiplyAdd(xFromY, pointY, xShift)));
+    Lanes::store(resultY + index, Lanes::multiplyAdd(yFromX, pointX, Lanes::multiplyAdd(yFromY, pointY, yShift)));
+  }
+
+  if (const size_t rest = count - index; rest != 0) {
+    array<float, Lanes::c_size> tailX{};
+    array<float, Lanes::c_size> tailY{};
+
+    std::copy_n(x + index, rest, tailX.data());
+    std::copy_n(y + index, rest, tailY.data());
+
+    const auto pointX = Lanes::load(tailX.data());
+    const auto pointY = Lanes::load(tailY.data());
+
+    Lanes::store(tailX.data(), Lanes::multiplyAdd(xFromX, pointX, Lanes::multiplyAdd(xFromY, pointY, xShift)));
+    Lanes::store(tailY.data(), Lanes::multiplyAdd(yFromX, pointX, Lanes::multiplyAdd(yFromY, pointY, yShift)));
+
+    std::copy_n(tailX.data(), rest, resultX + index);
+    std::copy_n(tailY.data(), rest, resultY + index);
+  }
+}
+
+void transformPoints(const Matrix4<float> & transform, const float * x, const float * y, const float * z,
+                     float * resultX, float * resultY, float * resultZ, size_t count) noexcept {
+  size_t index = 0;
+
+  const auto xFromX = Lanes::broadcast(transform.columns[0].x);
+  const auto xFromY = Lanes::broadcast(transform.columns[1].x);
+  const auto xFromZ = Lanes::broadcast(transform.columns[2].x);
+  const auto xShift = Lanes::broadcast(transform.columns[3].x);
+  const auto yFromX = Lanes::broadcast(transform.columns[0].y);
+  const auto yFromY = Lanes::broadcast(transform.columns[1].y);
+  const auto yFromZ = Lanes::broadcast(transform.columns[2].y);
+  const auto yShift = Lanes::broadcast(transform.columns[3].y);
+  const auto zFromX = Lanes::broadcast(transform.columns[0].z);
+  const auto zFromY = Lanes::broadcast(transform.columns[1].z);
+  const auto zFromZ = Lanes::broadcast(transform.columns[2].z);
+  const auto zShift = Lanes::broadcast(transform.columns[3].z);
+
+  for (; index + Lanes::c_size <= count; index += Lanes::c_size) {
+    const auto pointX = Lanes::load(x + index);
+    const auto pointY = Lanes::load(y + index);
+    const auto pointZ = Lanes::load(z + index);
+
+    Lanes::store(resultX + index,
+                 Lanes::multiplyAdd(xFromX, pointX,
+                                    Lanes::multiplyAdd(xFromY, pointY, Lanes::multiplyAdd(xFromZ, pointZ, xShift))));
+    Lanes::store(resultY + index,
+                 Lanes::multiplyAdd(yFromX, pointX,
+                                    Lanes::multiplyAdd(yFromY, pointY, Lanes::multiplyAdd(yFromZ, pointZ, yShift))));
+    Lanes::store(resultZ + index,
+                 Lanes::multiplyAdd(zFromX, pointX,
+                                    Lanes::multiplyAdd(zFromY, pointY, Lanes::multiplyAdd(zFromZ, pointZ, zShift))));
+  }
+
+  if (const size_t rest = count - index; rest != 0) {
+    array<float, Lanes::c_size> tailX{};
+    array<float, Lanes::c_size> tailY{};
+    array<float, Lanes::c_size> tailZ{};
+
+    std::copy_n(x + index, rest, tailX.data());
+    std::copy_n(y + index, rest, tailY.data());
+    std::copy_n(z + index, rest, tailZ.data());
+
+    const auto pointX = Lanes::load(tailX.data());
+    const auto pointY = Lanes::load(tailY.data());
+    const auto pointZ = Lanes::load(tailZ.data());
+
+    Lanes::store(tailX.data(),
+                 Lanes::multiplyAdd(xFromX, pointX,
+                                    Lanes::multiplyAdd(xFromY, pointY, Lanes::multiplyAdd(xFromZ, pointZ, xShift))));
+    Lanes::store(tailY.data(),
+                 Lanes::multiplyAdd(yFromX, pointX,
+                                    Lanes::multiplyAdd(yFromY, pointY, Lanes::multiplyAdd(yFromZ, pointZ, yShift))));
+    Lanes::store(tailZ.data(),
+                 Lanes::multiplyAdd(zFromX, pointX,
+                                    Lanes::multiplyAdd(zFromY, pointY, Lanes::multiplyAdd(zFromZ, pointZ, zShift))));
+
+    std::copy_n(tailX.data(), rest, resultX + index);
+    std::copy_n(tailY.data(), rest, resultY + index);
+    std::copy_n(tailZ.data(), rest, resultZ + index);
+  }
+}
@@ -0,0 +1,232 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   blitter.cpp
+  \brief  Sprite, affine sprite, and tile layer drawing, one framebuffer line at a time.
+
+  Each draw clips to the framebuffer, stages the palette indices of a line in a buffer on the stack, and composes them
+  with the row kernels. Sprite rows are unpacked and reversed by the kernels too; tile rows are narrower than a
+  register, so they are staged by the \ref toy::render::scalar routines and the whole line is composed at once.
+*/
+
+#include "render.hpp"
+
+#include <algorithm>
+
+namespace toy::render {
+
+namespace {
+
+/// Palette indices of one line, with room for the partly hidden tiles at both of its ends
+using Line = array<uint8_t, c_maxWidth + 2 * c_tileSize>;
+
+/// Pixels from \ref first up to \ref last along one axis of the framebuffer.
+struct Range {
+  int64_t first;
+  int64_t last;
+};
+
+/// Returns the part of \a size pixels from \a position that lies within \a limit pixels; empty when none does.
+Range clip(int32_t position, uint32_t size, uint32_t limit) noexcept {
+  const int64_t first = std::max<int64_t>(position, 0);
+  const int64_t last  = std::min<int64_t>(int64_t{position} + size, limit);
+
+  return {first, std::max(first, last)};
+}
+
+/// Returns \a value wrapped into [0, \a size).
+int64_t wrap(int64_t value, int64_t size) noexcept {
+  const int64_t remainder = value % size;
+
+  return remainder < 0 ? remainder + size : remainder;
+}
+
+/// Composes the \a count staged indices at \a source into row \a y of \a target, from column \a x.
+void composeLine(const Framebuffer & target, int64_t y, int64_t x, const uint8_t * source, size_t count,
+                 const Palette & palette) noexcept {
+  std::byte * row = target.row(static_cast<uint32_t>(y));
+
+  if (target.format() == PixelFormat::Indexed8)
+    composeIndexed8(source, count, reinterpret_cast<uint8_t *>(row) + x);
+  else
+    composeRgb565(source, count, palette.colors.data(), reinterpret_cast<uint16_t *>(row) + x);
+}
+
+/// Returns the palette index of the texel at \a x and \a y of \a image; 0 when it is transparent.
+uint8_t texel(const Bitmap & image, uint32_t x, uint32_t y, uint8_t bank) noexcept {
+  const auto * row = reinterpret_cast<const uint8_t *>(image.row(y));
+
+  if (image.format() == PixelFormat::Indexed8)
+    return row[x];
+
+  const auto pixel = static_cast<uint8_t>((x & 1) != 0 ? row[x / 2] >> 4 : row[x / 2] & 0x0F);
+
+  return pixel != 0 ? static_cast<uint8_t>((bank << 4) | pixel) : uint8_t{0};
+}
+
+/// Stages row \a tileY of the tile named by map \a entry, mirrored and banked as the entry says, at \a destination.
+void stageTile(const TileLayer & layer, uint16_t entry, uint32_t tileY, size_t tileCount,
+               uint8_t * destination) noexcept {
+  const size_t number = entry & c_tileNumberMask;
+
+  if (number >= tileCount) {
+    std::memset(destination, 0, c_tileSize);
+    return;
+  }
+
+  const size_t   rowBytes = rowSize(layer.format, c_tileSize);
+  const uint32_t row      = (entry & c_tileFlipY) != 0 ? c_tileSize - 1 - tileY : tileY;
+  const size_t   offset   = (number * c_tileSize + row) * rowBytes;
+  const auto *   pixels   = reinterpret_cast<const uint8_t *>(layer.tiles.data() + offset);
+  uint8_t        unpacked[c_tileSize];
+
+  if (layer.format == PixelFormat::Indexed4) {
+    scalar::unpackIndexed4(pixels, c_tileSize, static_cast<uint8_t>(entry >> c_tileBankShift), unpacked);
+    pixels = unpacked;
+  }
+
+  if ((entry & c_tileFlipX) != 0)
+    scalar::reverseIndexed8(pixels, c_tileSize, destination);
+  else
+    std::memcpy(destination, pixels, c_tileSize);
+}
+
+} // namespace
+
+void drawSprite(const Framebuffer & target, const Sprite & sprite, const Palette & palette) noexcept {
+  const Bitmap & image = sprite.image;
+
+  if (!target.isValid() || !image.isValid() || image.format() == PixelFormat::Rgb565)
+    return;
+
+  const Range columns = clip(sprite.x, image.width(), target.width());
+  const Range rows    = clip(sprite.y, image.height(), target.height());
+  const auto  count   = static_cast<size_t>(columns.last - columns.first);
+
+  if (count == 0 || rows.first == rows.last)
+    return;
+
+  // First image column of the visible part; a mirrored image shows its columns from the other end
+  const auto left        = static_cast<uint32_t>(columns.first - sprite.x);
+  const auto firstColumn = static_cast<uint32_t>(sprite.flipX ? image.width() - left - count : left);
+  Line       unpacked;
+  Line       reversed;
+
+  for (int64_t y = rows.first; y < rows.last; ++y) {
+    const auto      imageRow = static_cast<uint32_t>(y - sprite.y);
+    const uint32_t  sourceY  = sprite.flipY ? image.height() - 1 - imageRow : imageRow;
+    const uint8_t * pixels   = reinterpret_cast<const uint8_t *>(image.row(sourceY));
+
+    if (image.format() == PixelFormat::Indexed4) {
+      // Unpacking starts at a whole byte, so an odd first column unpacks the pixel before it too
+      const uint32_t skip = firstColumn & 1;
+
+      unpackIndexed4(pixels + firstColumn / 2, count + skip, sprite.paletteBank, unpacked.data());
+      pixels = unpacked.data() + skip;
+    } else {
+      pixels += firstColumn;
+    }
+
+    if (sprite.flipX) {
+      reverseIndexed8(pixels, count, reversed.data());
+      pixels = reversed.data();
+    }
+
+    composeLine(target, y, columns.first, pixels, count, palette);
+  }
+}
+
+void drawAffineSprite(const Framebuffer & target, const Sprite & sprite, const AffineTransform & transform,
+                      const Palette & palette) noexcept {
+  const Bitmap & image = sprite.image;
+
+  if (!target.isValid() || !image.isValid() || image.format() == PixelFormat::Rgb565)
+    return;
+
+  const uint32_t boxShift  = transform.doubleSize ? 1 : 0;
+  const uint32_t boxWidth  = image.width() << boxShift;
+  const uint32_t boxHeight = image.height() << boxShift;
+  const Range    columns   = clip(sprite.x, boxWidth, target.width());
+  const Range    rows      = clip(sprite.y, boxHeight, target.height());
+  const auto     count     = static_cast<size_t>(columns.last - columns.first);
+
+  if (count == 0 || rows.first == rows.last)
+    return;
+
+  // Texel coordinates in 16.16, computed in 64 bits: large steps times pixels from the center overflow 32
+  const int64_t a       = transform.a.raw();
+  const int64_t b       = transform.b.raw();
+  const int64_t c       = transform.c.raw();
+  const int64_t d       = transform.d.raw();
+  const int64_t centerU = int64_t{image.width() / 2} << AffineScalar::c_fractionBits;
+  const int64_t centerV = int64_t{image.height() / 2} << AffineScalar::c_fractionBits;
+  const int64_t dx      = columns.first - sprite.x - boxWidth / 2;
+  Line          line;
+
+  for (int64_t y = rows.first; y < rows.last; ++y) {
+    const int64_t dy = y - sprite.y - boxHeight / 2;
+    int64_t       u  = centerU + a * dx + b * dy;
+    int64_t       v  = centerV + c * dx + d * dy;
+
+    for (size_t index = 0; index < count; ++index, u += a, v += c) {
+      const int64_t x       = u >> AffineScalar::c_fractionBits;
+      const int64_t texelY  = v >> AffineScalar::c_fractionBits;
+      const bool    covered = x >= 0 && x < image.width() && texelY >= 0 && texelY < image.height();
+
+      line[index] = covered ? texel(image, static_cast<uint32_t>(x), static_cast<uint32_t>(texelY), sprite.paletteBank)
+                            : uint8_t{0};
+    }
+
+    composeLine(target, y, columns.first, line.data(), count, palette);
+  }
+}
+
+void drawTileLayer(const Framebuffer & target, const TileLayer & layer, const Palette & palette) noexcept {
+  if (!target.isValid() || layer.format == PixelFormat::Rgb565 || layer.columns == 0 || layer.rows == 0
+      || layer.map.size() < uint64_t{layer.columns} * layer.rows)
+    return;
+
+  const size_t  tileCount   = layer.tiles.size() / (rowSize(layer.format, c_tileSize) * c_tileSize);
+  const int64_t layerWidth  = int64_t{layer.columns} * c_tileSize;
+  const int64_t layerHeight = int64_t{layer.rows} * c_tileSize;
+
+  // Tiles covering the line, from the partly hidden one at the left to the one cut off at the right
+  const uint32_t lineTiles = (target.width() + 2 * c_tileSize - 2) / c_tileSize;
+  Line           line;
+
+  for (uint32_t y = 0; y < target.height(); ++y) {
+    const int64_t    shift  = y < layer.lineScroll.size() ? layer.lineScroll[y] : 0;
+    const auto       layerX = static_cast<uint32_t>(wrap(int64_t{layer.scrollX} + shift, layerWidth));
+    const auto       layerY = static_cast<uint32_t>(wrap(int64_t{layer.scrollY} + y, layerHeight));
+    const uint16_t * mapRow = layer.map.data() + size_t{layerY / c_tileSize} * layer.columns;
+    uint32_t         column = layerX / c_tileSize;
+
+    for (uint32_t tile = 0; tile < lineTiles; ++tile) {
+      stageTile(layer, mapRow[column], layerY % c_tileSize, tileCount, line.data() + tile * c_tileSize);
+
+      if (++column == layer.columns)
+        column = 0;
+    }
+
+    composeLine(target, y, 0, line.data() + layerX % c_tileSize, target.width(), palette);
+  }
+}
+
+} // namespace toy::render
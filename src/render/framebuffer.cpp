@@ -0,0 +1,101 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   framebuffer.cpp
+  \brief  Framebuffer clearing and hashing, and the presentation of frames to 32-bit pixels.
+
+  present() colors one framebuffer line at a time with the row kernels, scales it across, then copies the scaled line
+  down for the rest of its rows; nothing is allocated.
+*/
+
+#include "render.hpp"
+
+#include <algorithm>
+
+namespace toy::render {
+
+void Framebuffer::clear(uint16_t value) const noexcept {
+  if (!isValid())
+    return;
+
+  for (uint32_t y = 0; y < _height; ++y) {
+    if (_format == PixelFormat::Indexed8)
+      std::memset(row(y), static_cast<uint8_t>(value), _width);
+    else
+      std::fill_n(reinterpret_cast<uint16_t *>(row(y)), _width, value);
+  }
+}
+
+uint64_t Framebuffer::hash() const noexcept {
+  if (!isValid())
+    return 0;
+
+  const size_t size   = rowSize(_format, _width);
+  uint64_t     result = 0;
+
+  // Each row seeds the hash of the next, so the padding between rows never takes part
+  for (uint32_t y = 0; y < _height; ++y)
+    result = hashBuffer64(row(y), size, result);
+
+  return result;
+}
+
+bool present(const Framebuffer & source, const Palette & palette, span<uint32_t> output, size_t stride,
+             uint32_t scale) noexcept {
+  if (!source.isValid() || scale == 0)
+    return false;
+
+  const size_t width  = size_t{source.width()} * scale;
+  const size_t height = size_t{source.height()} * scale;
+
+  if (stride < width || output.size() < (height - 1) * stride + width)
+    return false;
+
+  const bool               indexed = source.format() == PixelFormat::Indexed8;
+  array<uint32_t, c_paletteSize> colors;
+  array<uint32_t, c_maxWidth>    line;
+
+  if (indexed) {
+    for (size_t index = 0; index < c_paletteSize; ++index)
+      colors[index] = argb8888(palette.colors[index]);
+  }
+
+  for (uint32_t y = 0; y < source.height(); ++y) {
+    uint32_t * first    = output.data() + size_t{y} * scale * stride;
+    uint32_t * expanded = scale == 1 ? first : line.data();
+
+    if (indexed)
+      expandIndexed8(reinterpret_cast<const uint8_t *>(source.row(y)), source.width(), colors.data(), expanded);
+    else
+      expandRgb565(reinterpret_cast<const uint16_t *>(source.row(y)), source.width(), expanded);
+
+    if (scale == 1)
+      continue;
+
+    scaleRow(line.data(), source.width(), scale, first);
+
+    for (uint32_t copy = 1; copy < scale; ++copy)
+      std::memcpy(first + copy * stride, first, width * sizeof(uint32_t));
+  }
+
+  return true;
+}
+
+} // namespace toy::render
@@ -0,0 +1,472 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   scanline.cpp
+  \brief  Row kernels of the software renderer: the vector loops and their pixel-at-a-time references.
+
+  The vector loops in scanline_kernels.inl are written once against \c Pixels and compiled once per
+  \ref toy::platform::SimdLevel: 32 pixels of AVX2, or 16 of SSE2 or NEON. Each public routine calls the loop
+  platform::selectKernel() picks; targets without vector registers run the \ref toy::render::scalar routines. All of
+  them compute with integers, so every level writes the same pixels.
+*/
+
+#include "render.hpp"
+
+#ifdef TOYGINE_SIMD_AVX2
+#include <immintrin.h>
+#endif
+
+namespace toy::render {
+
+namespace {
+
+#ifdef TOYGINE_SIMD_VECTOR128
+
+/// How many pixels of a register of palette indices are drawn.
+enum class Coverage : uint8_t {
+  Transparent, ///< None: every index is 0
+  Partial,     ///< Some
+  Opaque,      ///< All: no index is 0
+};
+
+/// 128-bit loops, with SSE2 or NEON.
+namespace vector128 {
+
+/*!
+  \brief One vector register of pixels, as the row loops see it.
+
+  \c c_size is the palette indices in a register, \c c_wordCount the 32-bit pixels. composeIndexed8() and
+  composeColors() draw the nonzero indices of one register of indices; coverage() tells the loops when all or none
+  are. unpackIndexed4() unpacks one register of indices from half a register of nibbles, and reverse() reverses one
+  register. expandIndexed8(), expandRgb565(), widen(), and fill() each write whole registers of 32-bit pixels. All
+  loads and stores are unaligned.
+
+  Each SIMD level defines pixels of this shape in its own namespace, and scanline_kernels.inl builds the loops on them.
+*/
+struct Pixels {
+  static constexpr size_t c_size      = 16;
+  static constexpr size_t c_wordCount = 4;
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+
+  static Coverage coverage(const uint8_t * source) noexcept {
+    const uint8x16_t indices = vld1q_u8(source);
+
+    if (vmaxvq_u8(indices) == 0)
+      return Coverage::Transparent;
+
+    return vminvq_u8(indices) != 0 ? Coverage::Opaque : Coverage::Partial;
+  }
+
+  static void composeIndexed8(const uint8_t * source, uint8_t * destination) noexcept {
+    const uint8x16_t indices = vld1q_u8(source);
+
+    vst1q_u8(destination, vbslq_u8(vceqzq_u8(indices), vld1q_u8(destination), indices));
+  }
+
+  static void composeColors(const uint8_t * source, const uint16_t * colors, uint16_t * destination) noexcept {
+    const uint8x16_t transparent = vceqzq_u8(vld1q_u8(source));
+    const uint16x8_t low         = vreinterpretq_u16_u8(vzip1q_u8(transparent, transparent));
+    const uint16x8_t high        = vreinterpretq_u16_u8(vzip2q_u8(transparent, transparent));
+
+    vst1q_u16(destination, vbslq_u16(low, vld1q_u16(destination), vld1q_u16(colors)));
+    vst1q_u16(destination + 8, vbslq_u16(high, vld1q_u16(destination + 8), vld1q_u16(colors + 8)));
+  }
+
+  static void unpackIndexed4(const uint8_t * source, uint8_t bank, uint8_t * destination) noexcept {
+    const uint8x8_t  packed = vld1_u8(source);
+    const uint8x8_t  low    = vand_u8(packed, vdup_n_u8(0x0F));
+    const uint8x8_t  high   = vshr_n_u8(packed, 4);
+    const uint8x16_t pixels = vcombine_u8(vzip1_u8(low, high), vzip2_u8(low, high));
+    const uint8x16_t banks  = vbicq_u8(vdupq_n_u8(static_cast<uint8_t>(bank << 4)), vceqzq_u8(pixels));
+
+    vst1q_u8(destination, vorrq_u8(pixels, banks));
+  }
+
+  static void reverse(const uint8_t * source, uint8_t * destination) noexcept {
+    const uint8x16_t halves = vrev64q_u8(vld1q_u8(source));
+
+    vst1q_u8(destination, vextq_u8(halves, halves, 8));
+  }
+
+  static void expandRgb565(const uint16_t * source, uint32_t * destination) noexcept {
+    const uint32x4_t colors = vmovl_u16(vld1_u16(source));
+    const uint32x4_t red    = vshrq_n_u32(colors, 11);
+    const uint32x4_t green  = vandq_u32(vshrq_n_u32(colors, 5), vdupq_n_u32(0x3F));
+    const uint32x4_t blue   = vandq_u32(colors, vdupq_n_u32(0x1F));
+    const uint32x4_t red8   = vorrq_u32(vshlq_n_u32(red, 3), vshrq_n_u32(red, 2));
+    const uint32x4_t green8 = vorrq_u32(vshlq_n_u32(green, 2), vshrq_n_u32(green, 4));
+    const uint32x4_t blue8  = vorrq_u32(vshlq_n_u32(blue, 3), vshrq_n_u32(blue, 2));
+
+    vst1q_u32(destination, vorrq_u32(vorrq_u32(vdupq_n_u32(0xFF000000U), vshlq_n_u32(red8, 16)),
+                                     vorrq_u32(vshlq_n_u32(green8, 8), blue8)));
+  }
+
+  template <uint32_t Scale>
+  static void widen(const uint32_t * source, uint32_t * destination) noexcept {
+    const uint32x4_t pixels = vld1q_u32(source);
+
+    if constexpr (Scale == 2) {
+      vst1q_u32(destination, vzip1q_u32(pixels, pixels));
+      vst1q_u32(destination + 4, vzip2q_u32(pixels, pixels));
+    } else if constexpr (Scale == 3) {
+      vst1q_u32(destination, vcopyq_laneq_u32(vdupq_laneq_u32(pixels, 0), 3, pixels, 1));
+      vst1q_u32(destination + 4, vcombine_u32(vdup_laneq_u32(pixels, 1), vdup_laneq_u32(pixels, 2)));
+      vst1q_u32(destination + 8, vcopyq_laneq_u32(vdupq_laneq_u32(pixels, 3), 0, pixels, 2));
+    } else {
+      static_assert(Scale == 4, "whole registers widen by 2, 3, or 4");
+
+      vst1q_u32(destination, vdupq_laneq_u32(pixels, 0));
+      vst1q_u32(destination + 4, vdupq_laneq_u32(pixels, 1));
+      vst1q_u32(destination + 8, vdupq_laneq_u32(pixels, 2));
+      vst1q_u32(destination + 12, vdupq_laneq_u32(pixels, 3));
+    }
+  }
+
+  static void fill(uint32_t pixel, uint32_t * destination) noexcept {
+    vst1q_u32(destination, vdupq_n_u32(pixel));
+  }
+
+#else
+
+  static __m128i load(const void * data) noexcept {
+    return _mm_loadu_si128(static_cast<const __m128i *>(data));
+  }
+
+  static void store(void * data, __m128i value) noexcept {
+    _mm_storeu_si128(static_cast<__m128i *>(data), value);
+  }
+
+  /// Returns \a ifSet where \a mask is all ones, \a ifClear where it is zero.
+  static __m128i select(__m128i mask, __m128i ifSet, __m128i ifClear) noexcept {
+    return _mm_or_si128(_mm_and_si128(mask, ifSet), _mm_andnot_si128(mask, ifClear));
+  }
+
+  static Coverage coverage(const uint8_t * source) noexcept {
+    const auto transparent =
+      static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(load(source), _mm_setzero_si128())));
+
+    if (transparent == 0xFFFF)
+      return Coverage::Transparent;
+
+    return transparent == 0 ? Coverage::Opaque : Coverage::Partial;
+  }
+
+  static void composeIndexed8(const uint8_t * source, uint8_t * destination) noexcept {
+    const __m128i indices = load(source);
+
+    store(destination, select(_mm_cmpeq_epi8(indices, _mm_setzero_si128()), load(destination), indices));
+  }
+
+  static void composeColors(const uint8_t * source, const uint16_t * colors, uint16_t * destination) noexcept {
+    const __m128i transparent = _mm_cmpeq_epi8(load(source), _mm_setzero_si128());
+
+    store(destination, select(_mm_unpacklo_epi8(transparent, transparent), load(destination), load(colors)));
+    store(destination + 8,
+          select(_mm_unpackhi_epi8(transparent, transparent), load(destination + 8), load(colors + 8)));
+  }
+
+  static void unpackIndexed4(const uint8_t * source, uint8_t bank, uint8_t * destination) noexcept {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i packed = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(source));
+    const __m128i pixels = _mm_unpacklo_epi8(_mm_and_si128(packed, nibble),
+                                             _mm_and_si128(_mm_srli_epi16(packed, 4), nibble));
+    const __m128i transparent = _mm_cmpeq_epi8(pixels, _mm_setzero_si128());
+
+    store(destination,
+          _mm_or_si128(pixels, _mm_andnot_si128(transparent, _mm_set1_epi8(static_cast<char>(bank << 4)))));
+  }
+
+  static void reverse(const uint8_t * source, uint8_t * destination) noexcept {
+    // SSE2 has no byte shuffle: reverse the dwords, then the words within them, then the bytes within those
+    __m128i bytes = _mm_shuffle_epi32(load(source), _MM_SHUFFLE(0, 1, 2, 3));
+
+    bytes = _mm_shufflehi_epi16(_mm_shufflelo_epi16(bytes, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1));
+    store(destination, _mm_or_si128(_mm_slli_epi16(bytes, 8), _mm_srli_epi16(bytes, 8)));
+  }
+
+  static void expandRgb565(const uint16_t * source, uint32_t * destination) noexcept {
+    const __m128i colors =
+      _mm_unpacklo_epi16(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(source)), _mm_setzero_si128());
+    const __m128i red    = _mm_srli_epi32(colors, 11);
+    const __m128i green  = _mm_and_si128(_mm_srli_epi32(colors, 5), _mm_set1_epi32(0x3F));
+    const __m128i blue   = _mm_and_si128(colors, _mm_set1_epi32(0x1F));
+    const __m128i red8   = _mm_or_si128(_mm_slli_epi32(red, 3), _mm_srli_epi32(red, 2));
+    const __m128i green8 = _mm_or_si128(_mm_slli_epi32(green, 2), _mm_srli_epi32(green, 4));
+    const __m128i blue8  = _mm_or_si128(_mm_slli_epi32(blue, 3), _mm_srli_epi32(blue, 2));
+
+    const __m128i alpha  = _mm_set1_epi32(static_cast<int>(0xFF000000U));
+
+    store(destination, _mm_or_si128(_mm_or_si128(alpha, _mm_slli_epi32(red8, 16)),
+                                    _mm_or_si128(_mm_slli_epi32(green8, 8), blue8)));
+  }
+
+  template <uint32_t Scale>
+  static void widen(const uint32_t * source, uint32_t * destination) noexcept {
+    const __m128i pixels = load(source);
+
+    if constexpr (Scale == 2) {
+      store(destination, _mm_unpacklo_epi32(pixels, pixels));
+      store(destination + 4, _mm_unpackhi_epi32(pixels, pixels));
+    } else if constexpr (Scale == 3) {
+      store(destination, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 0, 0, 0)));
+      store(destination + 4, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 1, 1)));
+      store(destination + 8, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 2)));
+    } else {
+      static_assert(Scale == 4, "whole registers widen by 2, 3, or 4");
+
+      store(destination, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(0, 0, 0, 0)));
+      store(destination + 4, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(1, 1, 1, 1)));
+      store(destination + 8, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(2, 2, 2, 2)));
+      store(destination + 12, _mm_shuffle_epi32(pixels, _MM_SHUFFLE(3, 3, 3, 3)));
+    }
+  }
+
+  static void fill(uint32_t pixel, uint32_t * destination) noexcept {
+    store(destination, _mm_set1_epi32(static_cast<int>(pixel)));
+  }
+
+#endif
+
+  // Without a gather, colors are looked up one at a time at every level but AVX2
+  static void expandIndexed8(const uint8_t * source, const uint32_t * colors, uint32_t * destination) noexcept {
+    for (size_t pixel = 0; pixel < c_wordCount; ++pixel)
+      destination[pixel] = colors[source[pixel]];
+  }
+};
+
+#include "scanline_kernels.inl"
+
+} // namespace vector128
+
+#endif // TOYGINE_SIMD_VECTOR128
+
+#ifdef TOYGINE_SIMD_AVX2
+
+TOYGINE_SIMD_AVX2_BEGIN
+
+/// 256-bit loops, with AVX2.
+namespace avx2 {
+
+/// Pixels of an AVX2 register; see vector128::Pixels.
+struct Pixels {
+  static constexpr size_t c_size      = 32;
+  static constexpr size_t c_wordCount = 8;
+
+  static __m256i load(const void * data) noexcept {
+    return _mm256_loadu_si256(static_cast<const __m256i *>(data));
+  }
+
+  static void store(void * data, __m256i value) noexcept {
+    _mm256_storeu_si256(static_cast<__m256i *>(data), value);
+  }
+
+  /// Returns the argb8888() pixels of the RGB565 colors in the low halves of 32-bit \a colors.
+  static __m256i expandChannels(__m256i colors) noexcept {
+    const __m256i red    = _mm256_srli_epi32(colors, 11);
+    const __m256i green  = _mm256_and_si256(_mm256_srli_epi32(colors, 5), _mm256_set1_epi32(0x3F));
+    const __m256i blue   = _mm256_and_si256(colors, _mm256_set1_epi32(0x1F));
+    const __m256i red8   = _mm256_or_si256(_mm256_slli_epi32(red, 3), _mm256_srli_epi32(red, 2));
+    const __m256i green8 = _mm256_or_si256(_mm256_slli_epi32(green, 2), _mm256_srli_epi32(green, 4));
+    const __m256i blue8  = _mm256_or_si256(_mm256_slli_epi32(blue, 3), _mm256_srli_epi32(blue, 2));
+
+    const __m256i alpha  = _mm256_set1_epi32(static_cast<int>(0xFF000000U));
+
+    return _mm256_or_si256(_mm256_or_si256(alpha, _mm256_slli_epi32(red8, 16)),
+                           _mm256_or_si256(_mm256_slli_epi32(green8, 8), blue8));
+  }
+
+  static Coverage coverage(const uint8_t * source) noexcept {
+    const auto transparent =
+      static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(load(source), _mm256_setzero_si256())));
+
+    if (transparent == 0xFFFFFFFFU)
+      return Coverage::Transparent;
+
+    return transparent == 0 ? Coverage::Opaque : Coverage::Partial;
+  }
+
+  static void composeIndexed8(const uint8_t * source, uint8_t * destination) noexcept {
+    const __m256i indices = load(source);
+
+    store(destination,
+          _mm256_blendv_epi8(indices, load(destination), _mm256_cmpeq_epi8(indices, _mm256_setzero_si256())));
+  }
+
+  static void composeColors(const uint8_t * source, const uint16_t * colors, uint16_t * destination) noexcept {
+    const __m256i transparent = _mm256_cmpeq_epi8(load(source), _mm256_setzero_si256());
+    const __m256i low         = _mm256_cvtepi8_epi16(_mm256_castsi256_si128(transparent));
+    const __m256i high        = _mm256_cvtepi8_epi16(_mm256_extracti128_si256(transparent, 1));
+
+    store(destination, _mm256_blendv_epi8(load(colors), load(destination), low));
+    store(destination + 16, _mm256_blendv_epi8(load(colors + 16), load(destination + 16), high));
+  }
+
+  static void unpackIndexed4(const uint8_t * source, uint8_t bank, uint8_t * destination) noexcept {
+    // Each byte widens to a word, and its high nibble moves to the high byte: the left pixel stays first in memory
+    const __m256i words  = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(source)));
+    const __m256i pixels = _mm256_or_si256(_mm256_and_si256(words, _mm256_set1_epi16(0x000F)),
+                                           _mm256_and_si256(_mm256_slli_epi16(words, 4), _mm256_set1_epi16(0x0F00)));
+    const __m256i transparent = _mm256_cmpeq_epi8(pixels, _mm256_setzero_si256());
+
+    store(destination, _mm256_or_si256(pixels, _mm256_andnot_si256(
+                                                 transparent, _mm256_set1_epi8(static_cast<char>(bank << 4)))));
+  }
+
+  static void reverse(const uint8_t * source, uint8_t * destination) noexcept {
+    const __m256i reversed = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11,
+                                              10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+
+    // The byte shuffle reverses each 128-bit half; swapping the halves finishes the reversal
+    const __m256i halves = _mm256_shuffle_epi8(load(source), reversed);
+
+    store(destination, _mm256_permute4x64_epi64(halves, _MM_SHUFFLE(1, 0, 3, 2)));
+  }
+
+  static void expandIndexed8(const uint8_t * source, const uint32_t * colors, uint32_t * destination) noexcept {
+    // Indices are below 256, so the gather never reads past the 256 colors
+    const __m256i indices = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(source)));
+
+    store(destination, _mm256_i32gather_epi32(reinterpret_cast<const int *>(colors), indices, 4));
+  }
+
+  static void expandRgb565(const uint16_t * source, uint32_t * destination) noexcept {
+    const __m128i colors = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source));
+
+    store(destination, expandChannels(_mm256_cvtepu16_epi32(colors)));
+  }
+
+  template <uint32_t Scale>
+  static void widen(const uint32_t * source, uint32_t * destination) noexcept {
+    static_assert(Scale >= 2 && Scale <= 4, "whole registers widen by 2, 3, or 4");
+
+    const __m256i pixels = load(source);
+
+    // Lane k of output register r repeats source pixel (8r + k) / Scale
+    for (uint32_t part = 0; part < Scale; ++part) {
+      const auto    first = static_cast<int>(part * c_wordCount);
+      const __m256i lanes = _mm256_setr_epi32(first / Scale, (first + 1) / Scale, (first + 2) / Scale,
+                                              (first + 3) / Scale, (first + 4) / Scale, (first + 5) / Scale,
+                                              (first + 6) / Scale, (first + 7) / Scale);
+
+      store(destination + part * c_wordCount, _mm256_permutevar8x32_epi32(pixels, lanes));
+    }
+  }
+
+  static void fill(uint32_t pixel, uint32_t * destination) noexcept {
+    store(destination, _mm256_set1_epi32(static_cast<int>(pixel)));
+  }
+};
+
+#include "scanline_kernels.inl"
+
+} // namespace avx2
+
+TOYGINE_SIMD_AVX2_END
+
+#endif // TOYGINE_SIMD_AVX2
+
+} // namespace
+
+void composeIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept {
+  platform::selectKernel<decltype(composeIndexed8), TOYGINE_SIMD_KERNELS(composeIndexed8)>()(source, count,
+                                                                                            destination);
+}
+
+void composeRgb565(const uint8_t * source, size_t count, const uint16_t * colors, uint16_t * destination) noexcept {
+  platform::selectKernel<decltype(composeRgb565), TOYGINE_SIMD_KERNELS(composeRgb565)>()(source, count, colors,
+                                                                                        destination);
+}
+
+void unpackIndexed4(const uint8_t * source, size_t count, uint8_t bank, uint8_t * destination) noexcept {
+  platform::selectKernel<decltype(unpackIndexed4), TOYGINE_SIMD_KERNELS(unpackIndexed4)>()(source, count, bank,
+                                                                                          destination);
+}
+
+void reverseIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept {
+  platform::selectKernel<decltype(reverseIndexed8), TOYGINE_SIMD_KERNELS(reverseIndexed8)>()(source, count,
+                                                                                            destination);
+}
+
+void expandIndexed8(const uint8_t * source, size_t count, const uint32_t * colors, uint32_t * destination) noexcept {
+  platform::selectKernel<decltype(expandIndexed8), TOYGINE_SIMD_KERNELS(expandIndexed8)>()(source, count, colors,
+                                                                                          destination);
+}
+
+void expandRgb565(const uint16_t * source, size_t count, uint32_t * destination) noexcept {
+  platform::selectKernel<decltype(expandRgb565), TOYGINE_SIMD_KERNELS(expandRgb565)>()(source, count, destination);
+}
+
+void scaleRow(const uint32_t * source, size_t count, uint32_t scale, uint32_t * destination) noexcept {
+  platform::selectKernel<decltype(scaleRow), TOYGINE_SIMD_KERNELS(scaleRow)>()(source, count, scale, destination);
+}
+
+namespace scalar {
+
+void composeIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept {
+  for (size_t index = 0; index < count; ++index) {
+    if (source[index] != 0)
+      destination[index] = source[index];
+  }
+}
+
+void composeRgb565(const uint8_t * source, size_t count, const uint16_t * colors, uint16_t * destination) noexcept {
+  for (size_t index = 0; index < count; ++index) {
+    if (source[index] != 0)
+      destination[index] = colors[source[index]];
+  }
+}
+
+void unpackIndexed4(const uint8_t * source, size_t count, uint8_t bank, uint8_t * destination) noexcept {
+  const auto bankBase = static_cast<uint8_t>(bank << 4);
+
+  for (size_t index = 0; index < count; ++index) {
+    const uint8_t packed = source[index / 2];
+    const auto    pixel  = static_cast<uint8_t>((index & 1) != 0 ? packed >> 4 : packed & 0x0F);
+
+    destination[index] = pixel != 0 ? static_cast<uint8_t>(bankBase | pixel) : uint8_t{0};
+  }
+}
+
+void reverseIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept {
+  for (size_t index = 0; index < count; ++index)
+    destination[index] = source[count - 1 - index];
+}
+
+void expandIndexed8(const uint8_t * source, size_t count, const uint32_t * colors, uint32_t * destination) noexcept {
+  for (size_t index = 0; index < count; ++index)
+    destination[index] = colors[source[index]];
+}
+
+void expandRgb565(const uint16_t * source, size_t count, uint32_t * destination) noexcept {
+  for (size_t index = 0; index < count; ++index)
+    destination[index] = argb8888(source[index]);
+}
+
+void scaleRow(const uint32_t * source, size_t count, uint32_t scale, uint32_t * destination) noexcept {
+  for (size_t index = 0; index < count; ++index) {
+    for (uint32_t copy = 0; copy < scale; ++copy)
+      *destination++ = source[index];
+  }
+}
+
+} // namespace scalar
+
+} // namespace toy::render
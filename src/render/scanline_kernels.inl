@@ -0,0 +1,146 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   scanline_kernels.inl
+  \brief  Vector loops of the row kernels, written against one \c Pixels.
+
+  scanline.cpp includes this file once per SIMD level, inside the namespace of the level and after its \c Pixels;
+  hence the missing include guard. Each function has the contract of the public routine of the same name, and the
+  pixels past the last whole register go through the \ref toy::render::scalar routine.
+*/
+
+void composeIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept {
+  size_t index = 0;
+
+  for (; index + Pixels::c_size <= count; index += Pixels::c_size)
+    Pixels::composeIndexed8(source + index, destination + index);
+
+  scalar::composeIndexed8(source + index, count - index, destination + index);
+}
+
+void composeRgb565(const uint8_t * source, size_t count, const uint16_t * colors, uint16_t * destination) noexcept {
+  size_t index = 0;
+
+  for (; index + Pixels::c_size <= count; index += Pixels::c_size) {
+    const Coverage coverage = Pixels::coverage(source + index);
+
+    // Sprites are mostly wholly transparent or wholly opaque along a line; only their edges need the blend
+    if (coverage == Coverage::Transparent)
+      continue;
+
+    uint16_t blockColors[Pixels::c_size];
+
+    for (size_t pixel = 0; pixel < Pixels::c_size; ++pixel)
+      blockColors[pixel] = colors[source[index + pixel]];
+
+    if (coverage == Coverage::Opaque)
+      std::memcpy(destination + index, blockColors, sizeof(blockColors));
+    else
+      Pixels::composeColors(source + index, blockColors, destination + index);
+  }
+
+  scalar::composeRgb565(source + index, count - index, colors, destination + index);
+}
+
+void unpackIndexed4(const uint8_t * source, size_t count, uint8_t bank, uint8_t * destination) noexcept {
+  size_t index = 0;
+
+  for (; index + Pixels::c_size <= count; index += Pixels::c_size)
+    Pixels::unpackIndexed4(source + index / 2, bank, destination + index);
+
+  scalar::unpackIndexed4(source + index / 2, count - index, bank, destination + index);
+}
+
+void reverseIndexed8(const uint8_t * source, size_t count, uint8_t * destination) noexcept {
+  size_t index = 0;
+
+  // Each register of the destination is the reversed register that ends as far from the end of the source
+  for (; index + Pixels::c_size <= count; index += Pixels::c_size)
+    Pixels::reverse(source + count - index - Pixels::c_size, destination + index);
+
+  scalar::reverseIndexed8(source, count - index, destination + index);
+}
+
+void expandIndexed8(const uint8_t * source, size_t count, const uint32_t * colors, uint32_t * destination) noexcept {
+  size_t index = 0;
+
+  for (; index + Pixels::c_wordCount <= count; index += Pixels::c_wordCount)
+    Pixels::expandIndexed8(source + index, colors, destination + index);
+
+  scalar::expandIndexed8(source + index, count - index, colors, destination + index);
+}
+
+void expandRgb565(const uint16_t * source, size_t count, uint32_t * destination) noexcept {
+  size_t index = 0;
+
+  for (; index + Pixels::c_wordCount <= count; index += Pixels::c_wordCount)
+    Pixels::expandRgb565(source + index, destination + index);
+
+  scalar::expandRgb565(source + index, count - index, destination + index);
+}
+
+/// scaleRow() for one \a Scale known while compiling: each register of pixels becomes \a Scale registers.
+template <uint32_t Scale>
+void scaleRowBy(const uint32_t * source, size_t count, uint32_t * destination) noexcept {
+  size_t index = 0;
+
+  for (; index + Pixels::c_wordCount <= count; index += Pixels::c_wordCount)
+    Pixels::template widen<Scale>(source + index, destination + index * Scale);
+
+  scalar::scaleRow(source + index, count - index, Scale, destination + index * Scale);
+}
+
+void scaleRow(const uint32_t * source, size_t count, uint32_t scale, uint32_t * destination) noexcept {
+  switch (scale) {
+    case 1:
+      std::memcpy(destination, source, count * sizeof(uint32_t));
+      return;
+
+    case 2:
+      scaleRowBy<2>(source, count, destination);
+      return;
+
+    case 3:
+      scaleRowBy<3>(source, count, destination);
+      return;
+
+    case 4:
+      scaleRowBy<4>(source, count, destination);
+      return;
+
+    default:
+      break;
+  }
+
+  if (scale < Pixels::c_wordCount) {
+    scalar::scaleRow(source, count, scale, destination);
+    return;
+  }
+
+  // Larger scales fill each run with whole registers, the last one overlapping the one before it
+  for (size_t index = 0; index < count; ++index) {
+    uint32_t * run = destination + index * scale;
+
+    for (uint32_t offset = 0; offset + Pixels::c_wordCount < scale; offset += Pixels::c_wordCount)
+      Pixels::fill(source[index], run + offset);
+
+    Pixels::fill(source[index], run + scale - Pixels::c_wordCount);
+  }
+}
@@ -0,0 +1,218 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   allocator.cpp
+  \brief  Unit tests for the heap, linear, and frame allocators.
+*/
+
+#include <doctest/doctest.h>
+
+#include "core.hpp"
+
+namespace {
+
+static_assert(toy::Allocator<toy::HeapAllocator>);
+static_assert(toy::Allocator<toy::LinearAllocator>);
+static_assert(toy::Allocator<toy::FrameAllocator>);
+static_assert(!toy::Allocator<int>);
+
+struct Point {
+  int x;
+  int y;
+};
+
+bool isAligned(const void * pointer, size_t alignment) {
+  return reinterpret_cast<toy::uintptr_t>(pointer) % alignment == 0;
+}
+
+} // namespace
+
+TEST_CASE("core/allocator/heap") {
+  toy::HeapAllocator heap;
+
+  SUBCASE("allocations honour the alignment") {
+    void * small = heap.allocate(24, 8);
+    void * wide  = heap.allocate(100, 256);
+
+    REQUIRE(small != nullptr);
+    REQUIRE(wide != nullptr);
+    CHECK(isAligned(small, 8));
+    CHECK(isAligned(wide, 256));
+
+    std::memset(wide, 0xAB, 100);
+
+    heap.deallocate(small, 24, 8);
+    heap.deallocate(wide, 100, 256);
+  }
+
+  SUBCASE("null is ignored") {
+    heap.deallocate(nullptr, 16);
+  }
+}
+
+TEST_CASE("core/allocator/linear") {
+  alignas(64) std::byte memory[256];
+  toy::LinearAllocator  arena(memory, sizeof(memory));
+
+  SUBCASE("allocations are aligned and packed") {
+    auto * first  = static_cast<std::byte *>(arena.allocate(3, 1));
+    auto * second = static_cast<std::byte *>(arena.allocate(8, 8));
+    auto * third  = static_cast<std::byte *>(arena.allocate(1, 32));
+
+    CHECK_EQ(first, memory);
+    CHECK_EQ(second, memory + 8);
+    CHECK_EQ(third, memory + 32);
+    CHECK(isAligned(third, 32));
+    CHECK_EQ(arena.used(), 33U);
+    CHECK_EQ(arena.remaining(), 223U);
+    CHECK(arena.owns(second));
+    CHECK_FALSE(arena.owns(memory + sizeof(memory)));
+  }
+
+  SUBCASE("the buffer need not be aligned") {
+    toy::LinearAllocator shifted(memory + 1, sizeof(memory) - 1);
+
+    CHECK(isAligned(shifted.allocate(4, 16), 16));
+    CHECK_EQ(shifted.used(), 19U);
+  }
+
+  SUBCASE("exhaustion returns null and keeps the state") {
+    CHECK_NE(arena.allocate(200, 1), nullptr);
+    CHECK_EQ(arena.allocate(100, 1), nullptr);
+    CHECK_EQ(arena.allocateArray<uint64_t>(~size_t{0} / 4), nullptr);
+    CHECK_EQ(arena.used(), 200U);
+    CHECK_NE(arena.allocate(56, 1), nullptr);
+    CHECK_EQ(arena.remaining(), 0U);
+  }
+
+  SUBCASE("markers rewind everything after them") {
+    static_cast<void>(arena.allocate(16));
+
+    const auto marker = arena.marker();
+
+    static_cast<void>(arena.allocate(64));
+    static_cast<void>(arena.allocate(64));
+    arena.rewind(marker);
+
+    CHECK_EQ(arena.used(), 16U);
+    CHECK_EQ(arena.peak(), 144U);
+
+    {
+      const toy::ScopedMarker scope(arena);
+      static_cast<void>(arena.allocate(32));
+      CHECK_EQ(arena.used(), 48U);
+    }
+
+    CHECK_EQ(arena.used(), 16U);
+
+    arena.reset();
+
+    CHECK_EQ(arena.used(), 0U);
+    CHECK_EQ(arena.peak(), 144U);
+  }
+
+  SUBCASE("deallocating the newest allocation pops it") {
+    void * first  = arena.allocate(16);
+    void * second = arena.allocate(24);
+
+    arena.deallocate(first, 16);
+    CHECK_EQ(arena.used(), 40U);
+
+    arena.deallocate(second, 24);
+    arena.deallocate(first, 16);
+    CHECK_EQ(arena.used(), 0U);
+  }
+
+  SUBCASE("typed helpers") {
+    const Point * point  = arena.create<Point>(3, 4);
+    int *         values = arena.allocateArray<int>(10);
+
+    REQUIRE(point != nullptr);
+    CHECK_EQ(point->x, 3);
+    CHECK_EQ(point->y, 4);
+    CHECK(isAligned(values, alignof(int)));
+    CHECK_EQ(arena.used(), sizeof(Point) + 10 * sizeof(int));
+  }
+
+  SUBCASE("fixed containers can live in the arena") {
+    auto * list = arena.create<toy::FixedVector<int, 16>>();
+
+    REQUIRE(list != nullptr);
+    list->push_back(5);
+    CHECK_EQ(list->size(), 1U);
+    CHECK(arena.owns(list->data()));
+  }
+
+#ifdef _DEBUG
+  SUBCASE("released memory is poisoned") {
+    auto * bytes = static_cast<uint8_t *>(arena.allocate(8, 1));
+
+    bytes[0] = 1;
+    arena.reset();
+
+    CHECK_EQ(bytes[0], 0xCD);
+    CHECK_EQ(bytes[7], 0xCD);
+  }
+#endif // _DEBUG
+
+  SUBCASE("an empty allocator fails every allocation") {
+    toy::LinearAllocator empty;
+
+    CHECK_EQ(empty.allocate(1), nullptr);
+    CHECK_EQ(empty.capacity(), 0U);
+  }
+}
+
+TEST_CASE("core/allocator/frame") {
+  alignas(16) std::byte memory[256];
+  toy::FrameAllocator   frames(memory, sizeof(memory));
+
+  SUBCASE("allocations live for two frames") {
+    auto * first = static_cast<int *>(frames.allocate(sizeof(int), alignof(int)));
+    *first       = 42;
+
+    frames.beginFrame();
+
+    CHECK(frames.previous().owns(first));
+    CHECK_FALSE(frames.current().owns(first));
+    CHECK_EQ(*first, 42);
+    CHECK_EQ(frames.previous().used(), sizeof(int));
+
+    void * second = frames.allocate(16);
+
+    CHECK(frames.current().owns(second));
+
+    frames.beginFrame();
+
+    CHECK(frames.current().owns(first));
+    CHECK_EQ(frames.current().used(), 0U);
+    CHECK_EQ(frames.previous().used(), 16U);
+  }
+
+  SUBCASE("each frame gets half of the buffer") {
+    CHECK_EQ(frames.current().capacity(), 128U);
+    CHECK_NE(frames.allocate(128, 1), nullptr);
+    CHECK_EQ(frames.allocate(1, 1), nullptr);
+
+    frames.beginFrame();
+
+    CHECK_NE(frames.allocate(128, 1), nullptr);
+  }
+}
@@ -0,0 +1,266 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   assertion.cpp
+  \brief  Unit tests for assertion reporting and the per-call-site repeat filter.
+*/
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <cstdlib>
+#endif // __linux__
+
+#include "core.hpp"
+
+#if defined(__linux__)
+
+// Outside the anonymous namespace, so the exported symbol table names them in traces
+[[gnu::noinline]] size_t stackTraceProbe(toy::uintptr_t * frames, size_t capacity) {
+  // Kept in a volatile so the call is not turned into a jump that drops this frame
+  const volatile size_t count = toy::assertion::captureStack(frames, capacity);
+
+  return count;
+}
+
+[[gnu::noinline]] void failingStackCheck() {
+  [[maybe_unused]] const int value = 0;
+  assert_message(value == 1, "deliberate failure");
+}
+
+#endif // __linux__
+
+namespace {
+
+std::vector<std::string> g_reports;
+std::vector<std::string> g_frames;
+
+bool recordAssertion(const char * assertionString) noexcept {
+  g_reports.emplace_back(assertionString);
+
+  return true;
+}
+
+void recordFrame(const char * stackFrameString) noexcept {
+  g_frames.emplace_back(stackFrameString);
+}
+
+bool containsFrame(const char * name) {
+  for (const std::string & frame : g_frames) {
+    if (frame.find(name) != std::string::npos)
+      return true;
+  }
+
+  return false;
+}
+
+// Fails the same check every call, as a per-frame check would
+[[maybe_unused]] void failEveryFrame(bool once) {
+  const int frame = 0;
+
+  if (once)
+    assert_message_once(frame > 0, "frame counter not advanced");
+  else
+    assert_message(frame > 0, "frame counter not advanced");
+}
+
+} // namespace
+
+TEST_CASE("core/assertion/CallSite") {
+  SUBCASE("once") {
+    toy::assertion::CallSite site(toy::assertion::Repeat::Once);
+
+    CHECK_EQ(site.fail(), 1U);
+
+    for (int failure = 0; failure < 100; ++failure)
+      CHECK_EQ(site.fail(), 0U);
+
+    CHECK_EQ(site.failures(), 101U);
+  }
+
+  SUBCASE("backoff") {
+    toy::assertion::CallSite site(toy::assertion::Repeat::Backoff);
+    std::vector<uint32_t>    reported;
+
+    for (int failure = 0; failure < 3600; ++failure) {
+      if (const uint32_t count = site.fail(); count != 0)
+        reported.push_back(count);
+    }
+
+    const std::vector<uint32_t> expected{1, 2, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 2048};
+    CHECK_EQ(reported, expected);
+    CHECK_EQ(site.failures(), 3600U);
+  }
+}
+
+TEST_CASE("core/assertion/callbacks") {
+  toy::assertion::initialize();
+  toy::assertion::setCallbacks(recordAssertion, nullptr);
+  g_reports.clear();
+
+  int evaluations = 0;
+  assert_message(++evaluations > 0, "never fails");
+
+#ifdef _DEBUG
+  CHECK_EQ(evaluations, 1);
+  CHECK(g_reports.empty());
+
+  SUBCASE("description") {
+    CHECK(toy::assertion::assertion("pointer != nullptr", "texture missing", "sprite.cpp", "draw", 42));
+    CHECK(toy::assertion::assertion("size < 4", nullptr, "list.cpp", "push", 7, 16));
+
+    REQUIRE_EQ(g_reports.size(), 2U);
+    CHECK_EQ(g_reports[0], "sprite.cpp(42): assertion 'pointer != nullptr' failed in draw: texture missing");
+    CHECK_EQ(g_reports[1], "list.cpp(7): assertion 'size < 4' failed in push (failed 16 times)");
+  }
+
+  SUBCASE("truncation") {
+    const std::string message(4000, 'x');
+
+    CHECK(toy::assertion::assertion("false", message.c_str(), "file.cpp", "function", 1));
+
+    REQUIRE_EQ(g_reports.size(), 1U);
+    CHECK_EQ(g_reports[0].size(), 1023U);
+  }
+
+  SUBCASE("repeat") {
+    for (int frame = 0; frame < 60; ++frame) {
+      failEveryFrame(true);
+      failEveryFrame(false);
+    }
+
+    // Once: the 1st failure; backoff: the 1st, 2nd, 4th, 8th, 16th, and 32nd
+    REQUIRE_EQ(g_reports.size(), 7U);
+    CHECK_NE(g_reports[0].find("frame > 0"), std::string::npos);
+    CHECK_NE(g_reports[6].find("(failed 32 times)"), std::string::npos);
+  }
+
+  SUBCASE("no handler") {
+    toy::assertion::setCallbacks(nullptr, nullptr);
+
+    CHECK(toy::assertion::assertion("false", "unreported", "file.cpp", "function", 1));
+    CHECK(g_reports.empty());
+  }
+#else  // _DEBUG
+  CHECK_EQ(evaluations, 0);
+  CHECK(toy::assertion::assertion("false", "discarded", "file.cpp", "function", 1));
+  CHECK(g_reports.empty());
+#endif // _DEBUG
+
+  toy::assertion::deInitialize();
+}
+
+#if defined(__linux__)
+
+TEST_CASE("core/assertion/stack") {
+  SUBCASE("capture and walk") {
+    toy::uintptr_t frames[toy::assertion::c_maxStackFrames];
+    const size_t   count = stackTraceProbe(frames, toy::assertion::c_maxStackFrames);
+
+    REQUIRE_GT(count, 1U);
+
+    g_frames.clear();
+    toy::assertion::walkStack(frames, count, recordFrame);
+
+    REQUIRE_EQ(g_frames.size(), count);
+    CHECK_EQ(g_frames[0].rfind("#0 0x", 0), 0U);
+    CHECK(containsFrame("stackTraceProbe"));
+
+    // A second walk is served from the cache and gives the same lines
+    const std::vector<std::string> first = g_frames;
+    g_frames.clear();
+    toy::assertion::walkStack(frames, count, recordFrame);
+    CHECK_EQ(g_frames, first);
+  }
+
+  SUBCASE("capacity and skip") {
+    toy::uintptr_t frames[toy::assertion::c_maxStackFrames];
+    toy::uintptr_t outer[2];
+
+    const size_t count = toy::assertion::captureStack(frames, toy::assertion::c_maxStackFrames);
+
+    CHECK_EQ(toy::assertion::captureStack(outer, 2, 0), 2U);
+    CHECK_EQ(toy::assertion::captureStack(outer, 2, 1), 2U);
+    CHECK_EQ(outer[1], frames[2]);
+    CHECK_EQ(toy::assertion::captureStack(frames, 0), 0U);
+    CHECK_GT(count, 2U);
+  }
+
+#ifdef _DEBUG
+  SUBCASE("failed check") {
+    toy::assertion::initialize();
+    toy::assertion::setCallbacks(recordAssertion, recordFrame);
+    g_reports.clear();
+    g_frames.clear();
+
+    failingStackCheck();
+
+    CHECK_EQ(g_reports.size(), 1U);
+    REQUIRE_FALSE(g_frames.empty());
+    CHECK_NE(g_frames[0].find("failingStackCheck"), std::string::npos);
+
+    toy::assertion::deInitialize();
+  }
+#endif // _DEBUG
+
+  SUBCASE("crash handler") {
+    int channel[2];
+    REQUIRE_EQ(::pipe(channel), 0);
+
+    const pid_t child = ::fork();
+    REQUIRE_GE(child, 0);
+
+    if (child == 0) {
+      ::close(channel[0]);
+
+      if (toy::assertion::installCrashHandlers(channel[1]))
+        std::abort();
+
+      ::_exit(1);
+    }
+
+    ::close(channel[1]);
+
+    std::string output;
+    char        chunk[256];
+
+    for (ssize_t size; (size = ::read(channel[0], chunk, sizeof(chunk))) > 0;)
+      output.append(chunk, static_cast<size_t>(size));
+
+    ::close(channel[0]);
+
+    int status = 0;
+    ::waitpid(child, &status, 0);
+
+    // The default action still runs after the trace is written
+    CHECK(WIFSIGNALED(status));
+    CHECK_EQ(WTERMSIG(status), SIGABRT);
+    CHECK_EQ(output.rfind("Fatal signal 6 (SIGABRT)\n#0 0x", 0), 0U);
+    CHECK_NE(output.find("+0x"), std::string::npos);
+  }
+}
+
+#endif // __linux__
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   chrono.cpp
+  \brief  Unit tests for the engine clock, the fixed-timestep accumulator, and the frame pacer.
+*/
+
+#include <doctest/doctest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "core.hpp"
+
+namespace {
+
+using toy::chrono::c_nanosecondsPerMillisecond;
+
+uint64_t steadyNow() {
+  const auto elapsed = std::chrono::steady_clock::now().time_since_epoch();
+
+  return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+} // namespace
+
+TEST_CASE("core/chrono/clock") {
+  const auto source = toy::chrono::calibrate();
+
+  SUBCASE("calibration picks a timer once") {
+    CHECK_NE(source, toy::chrono::ClockSource::Uncalibrated);
+    CHECK_EQ(toy::chrono::calibrate(), source);
+    CHECK_EQ(toy::chrono::clockSource(), source);
+    CHECK_EQ(toy::chrono::tickFrequency() != 0, source == toy::chrono::ClockSource::Tsc);
+  }
+
+  SUBCASE("readings never decrease") {
+    uint64_t previous = toy::chrono::now();
+
+    for (int index = 0; index < 100'000; ++index) {
+      const uint64_t current = toy::chrono::now();
+
+      REQUIRE_GE(current, previous);
+      previous = current;
+    }
+  }
+
+  SUBCASE("follows the monotonic clock") {
+#if defined(__linux__)
+    // Same epoch as steady_clock, which reads CLOCK_MONOTONIC on Linux
+    const uint64_t steady = steadyNow();
+    const uint64_t engine = toy::chrono::now();
+
+    CHECK_LT(engine > steady ? engine - steady : steady - engine, 5 * c_nanosecondsPerMillisecond);
+#endif // __linux__
+
+    const uint64_t steadyStart = steadyNow();
+    const uint64_t start       = toy::chrono::now();
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    const uint64_t elapsed       = toy::chrono::now() - start;
+    const uint64_t steadyElapsed = steadyNow() - steadyStart;
+
+    CHECK_GE(elapsed, 50 * c_nanosecondsPerMillisecond);
+    CHECK_LT(elapsed > steadyElapsed ? elapsed - steadyElapsed : steadyElapsed - elapsed, c_nanosecondsPerMillisecond);
+  }
+
+  SUBCASE("toSeconds") {
+    static_assert(toy::chrono::toSeconds(1'500'000'000) == 1.5);
+
+    CHECK_EQ(toy::chrono::toSeconds(0), 0.0);
+  }
+}
+
+TEST_CASE("core/chrono/fixed_timestep") {
+  toy::chrono::FixedTimestep timestep(10, 4);
+
+  SUBCASE("whole steps run and the remainder carries over") {
+    CHECK_EQ(timestep.advance(25), 2);
+    CHECK_EQ(timestep.accumulated(), 5);
+    CHECK_EQ(timestep.alpha(), doctest::Approx(0.5));
+    CHECK_EQ(timestep.advance(4), 0);
+    CHECK_EQ(timestep.advance(1), 1);
+    CHECK_EQ(timestep.accumulated(), 0);
+    CHECK_EQ(timestep.steps(), 3);
+    CHECK_EQ(timestep.step(), 10);
+  }
+
+  SUBCASE("a stall is clamped to the step limit") {
+    CHECK_EQ(timestep.advance(107), 4);
+    CHECK_EQ(timestep.skippedTime(), 60);
+    CHECK_EQ(timestep.accumulated(), 7);
+    CHECK_EQ(timestep.advance(3), 1);
+  }
+
+  SUBCASE("reset") {
+    static_cast<void>(timestep.advance(107));
+    timestep.reset();
+
+    CHECK_EQ(timestep.accumulated(), 0);
+    CHECK_EQ(timestep.steps(), 0);
+    CHECK_EQ(timestep.skippedTime(), 0);
+  }
+
+  SUBCASE("usable in constant expressions") {
+    constexpr auto steps = [] {
+      toy::chrono::FixedTimestep sixtyHertz(toy::chrono::c_nanosecondsPerSecond / 60);
+
+      return sixtyHertz.advance(toy::chrono::c_nanosecondsPerSecond);
+    }();
+
+    static_assert(steps == 8);
+    CHECK_EQ(steps, 8);
+  }
+}
+
+TEST_CASE("core/chrono/frame_pacer") {
+  SUBCASE("percentiles of recorded frames") {
+    toy::chrono::FramePacer pacer;
+
+    CHECK_EQ(pacer.percentile(50), 0);
+    CHECK_EQ(pacer.statistics().frames, 0);
+
+    for (uint64_t frame = 1; frame <= 100; ++frame)
+      pacer.record(frame);
+
+    const auto statistics = pacer.statistics();
+
+    CHECK_EQ(statistics.frames, 100);
+    CHECK_EQ(statistics.minimum, 1);
+    CHECK_EQ(statistics.median, 50);
+    CHECK_EQ(statistics.percentile90, 90);
+    CHECK_EQ(statistics.percentile99, 99);
+    CHECK_EQ(statistics.maximum, 100);
+    CHECK_EQ(statistics.average, 50);
+    CHECK_EQ(pacer.percentile(0), 1);
+    CHECK_EQ(pacer.percentile(100), 100);
+  }
+
+  SUBCASE("the history keeps the latest frames") {
+    toy::chrono::FramePacer pacer;
+
+    for (uint64_t frame = 0; frame < toy::chrono::c_frameHistorySize + 10; ++frame)
+      pacer.record(frame < 10 ? 1'000 : 1);
+
+    CHECK_EQ(pacer.statistics().frames, toy::chrono::c_frameHistorySize);
+    CHECK_EQ(pacer.statistics().maximum, 1);
+
+    pacer.reset();
+
+    CHECK_EQ(pacer.statistics().frames, 0);
+  }
+
+  SUBCASE("frames last at least the target") {
+    toy::chrono::FramePacer pacer(5 * c_nanosecondsPerMillisecond);
+
+    CHECK_EQ(pacer.targetFrameTime(), 5 * c_nanosecondsPerMillisecond);
+
+    const uint64_t start = toy::chrono::now();
+
+    CHECK_GE(pacer.endFrame(), 5 * c_nanosecondsPerMillisecond - c_nanosecondsPerMillisecond / 10);
+
+    // Later frames may come early by the overshoot of the one before, keeping the cadence
+    for (int frame = 1; frame < 4; ++frame)
+      static_cast<void>(pacer.endFrame());
+
+    CHECK_GE(toy::chrono::now() - start, 20 * c_nanosecondsPerMillisecond - c_nanosecondsPerMillisecond);
+    CHECK_EQ(pacer.statistics().frames, 4);
+  }
+
+  SUBCASE("without a target frames are not delayed") {
+    toy::chrono::FramePacer pacer;
+
+    CHECK_LT(pacer.endFrame(), 5 * c_nanosecondsPerMillisecond);
+  }
+}
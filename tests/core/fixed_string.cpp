@@ -0,0 +1,238 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_string.cpp
+  \brief  Unit tests for toy::FixedString.
+*/
+
+#include <doctest/doctest.h>
+
+#include <string>
+
+#include "core.hpp"
+
+namespace {
+
+// Builds a path the way engine code does, so the same steps can run at compile time and at runtime
+constexpr toy::FixedString<32> makePath() {
+  toy::FixedString<32> path("data");
+
+  path += '/';
+  path += toy::FixedString("level");
+  path.append(2, '0');
+  path += ".map";
+
+  return path;
+}
+
+} // namespace
+
+TEST_CASE("core/fixed_string/constexpr") {
+  constexpr toy::FixedString name("player");
+  static_assert(name.size() == 6);
+  static_assert(name.capacity() == 6);
+  static_assert(name == "player");
+
+  constexpr toy::FixedString<32> path = makePath();
+  static_assert(path == "data/level00.map");
+  static_assert(path.find("level") == 5);
+  static_assert(path.find('/') == 4);
+  static_assert(path.rfind('0') == 11);
+  static_assert(path.starts_with("data/") && path.ends_with(".map"));
+  static_assert(!path.contains("save"));
+  static_assert(path.compare("data/level00.maq") < 0);
+  static_assert(path > toy::FixedString("data"));
+
+  // Runtime calls take the vectorized kernels and must agree with the constant-evaluated results
+  const toy::FixedString<32> runtimePath = makePath();
+  CHECK_EQ(runtimePath.view(), path.view());
+  CHECK_EQ(runtimePath.find("level"), path.find("level"));
+  CHECK_EQ(runtimePath.find('/'), path.find('/'));
+  CHECK_EQ(runtimePath.compare("data/level00.maq"), path.compare("data/level00.maq"));
+}
+
+TEST_CASE("core/fixed_string/construction") {
+  SUBCASE("empty") {
+    const toy::FixedString<8> string;
+
+    CHECK(string.empty());
+    CHECK_EQ(string.size(), 0U);
+    CHECK_EQ(string.c_str()[0], '\0');
+  }
+
+  SUBCASE("from characters") {
+    const toy::FixedString<8> fromPointer("abc");
+    const toy::FixedString<8> fromRange("abcdef", 4);
+    const toy::FixedString<8> fromView(toy::string_view("xyz"));
+    const toy::FixedString<8> repeated(3, '-');
+
+    CHECK_EQ(fromPointer, "abc");
+    CHECK_EQ(fromRange, "abcd");
+    CHECK_EQ(fromView, "xyz");
+    CHECK_EQ(repeated, "---");
+    CHECK_EQ(fromRange.c_str()[4], '\0');
+  }
+
+  SUBCASE("between capacities") {
+    const toy::FixedString<4>  small("abcd");
+    const toy::FixedString<16> large(small);
+    toy::FixedString<2>        truncated(large);
+
+    CHECK_EQ(large, small);
+    CHECK_EQ(truncated, "ab");
+
+    truncated = "z";
+    CHECK_EQ(truncated, "z");
+  }
+
+  SUBCASE("excess characters are dropped") {
+    toy::FixedString<4> string("abcdefgh");
+
+    CHECK_EQ(string, "abcd");
+    CHECK_EQ(string.size(), 4U);
+
+    string.push_back('x');
+    string += "yz";
+    CHECK_EQ(string, "abcd");
+    CHECK_EQ(string.c_str()[4], '\0');
+  }
+}
+
+TEST_CASE("core/fixed_string/modifiers") {
+  toy::FixedString<16> string("hello");
+
+  SUBCASE("append and pop") {
+    string += ' ';
+    string += toy::string_view("world");
+    string.pop_back();
+
+    CHECK_EQ(string, "hello worl");
+    CHECK_EQ(string.back(), 'l');
+    CHECK_EQ(string.front(), 'h');
+  }
+
+  SUBCASE("append a part of itself") {
+    string.append(string.view().substr(1, 3));
+
+    CHECK_EQ(string, "helloell");
+  }
+
+  SUBCASE("insert") {
+    string.insert(0, ">> ");
+    string.insert(string.size(), "!");
+    string.insert(5, "--");
+
+    CHECK_EQ(string, ">> he--llo!");
+
+    string.insert(2, "0123456789");
+    CHECK_EQ(string, ">>0123456789 he-");
+    CHECK_EQ(string.size(), 16U);
+  }
+
+  SUBCASE("erase") {
+    string.erase(1, 2);
+    CHECK_EQ(string, "hlo");
+
+    string.erase(1);
+    CHECK_EQ(string, "h");
+
+    string.clear();
+    CHECK(string.empty());
+  }
+
+  SUBCASE("resize") {
+    string.resize(8, '.');
+    CHECK_EQ(string, "hello...");
+
+    string.resize(2);
+    CHECK_EQ(string, "he");
+
+    string.resize(100, '#');
+    CHECK_EQ(string.size(), 16U);
+  }
+
+  SUBCASE("iteration and element access") {
+    for (char & character : string)
+      character = static_cast<char>(character - 'a' + 'A');
+
+    CHECK_EQ(string, "HELLO");
+    CHECK_EQ(string[1], 'E');
+    CHECK_EQ(std::string(string.begin(), string.end()), "HELLO");
+  }
+}
+
+TEST_CASE("core/fixed_string/search") {
+  toy::FixedString<128> string;
+
+  // Long enough that matches fall in vector blocks, block tails and across block boundaries
+  for (int index = 0; index < 12; ++index)
+    string += "abcdefghi";
+
+  string += "needle";
+
+  const std::string reference(string.view());
+
+  for (const char * pattern : {"needle", "ghiabc", "a", "i", "abcdefghiabcdefghiabcdefghiabcdefghi", "", "zzz"}) {
+    CAPTURE(pattern);
+
+    for (size_t position : {0U, 1U, 9U, 40U, 108U, 114U, 200U}) {
+      CHECK_EQ(string.find(pattern, position), reference.find(pattern, position));
+      CHECK_EQ(string.rfind(pattern, position), reference.rfind(pattern, position));
+    }
+
+    CHECK_EQ(string.contains(pattern), reference.find(pattern) != std::string::npos);
+  }
+
+  for (const char character : {'a', 'i', 'n', 'e', 'z'}) {
+    for (size_t position : {0U, 1U, 50U, 113U, 114U, 115U}) {
+      CHECK_EQ(string.find(character, position), reference.find(character, position));
+      CHECK_EQ(string.rfind(character, position), reference.rfind(character, position));
+    }
+  }
+
+  CHECK(string.starts_with("abcdefghiabc"));
+  CHECK(string.starts_with('a'));
+  CHECK(string.ends_with("hineedle"));
+  CHECK(string.ends_with('e'));
+  CHECK_FALSE(string.starts_with("abd"));
+  CHECK_FALSE(string.ends_with(reference + "!"));
+}
+
+TEST_CASE("core/fixed_string/comparison") {
+  const toy::FixedString<8>  apple("apple");
+  const toy::FixedString<16> apples("apples");
+
+  CHECK(apple == toy::FixedString<32>("apple"));
+  CHECK(apple != apples);
+  CHECK(apple < apples);
+  CHECK(apples > apple);
+  CHECK(apple < "banana");
+  CHECK(apple == toy::string_view("apple"));
+  CHECK("apple" == apple);
+
+  CHECK_LT(apple.compare("apples"), 0);
+  CHECK_GT(apples.compare("apple"), 0);
+  CHECK_EQ(apple.compare("apple"), 0);
+
+  // Characters order as unsigned bytes, so bytes above 0x7F sort after ASCII
+  const toy::FixedString<4> high("\xC3\xA9");
+  CHECK(high > "z");
+  CHECK_GT(high.compare("z"), 0);
+}
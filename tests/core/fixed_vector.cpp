@@ -0,0 +1,349 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed_vector.cpp
+  \brief  Unit tests for toy::FixedVector.
+*/
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Counts live instances, so tests can check that every constructed element is destroyed exactly once
+struct Tracked {
+  static inline int live = 0;
+
+  int value;
+
+  Tracked(int initial = 0) noexcept
+    : value(initial) {
+    ++live;
+  }
+
+  Tracked(const Tracked & other) noexcept
+    : value(other.value) {
+    ++live;
+  }
+
+  Tracked(Tracked && other) noexcept
+    : value(other.value) {
+    other.value = -1;
+    ++live;
+  }
+
+  ~Tracked() noexcept {
+    --live;
+  }
+
+  Tracked & operator=(const Tracked &) noexcept = default;
+
+  bool operator==(const Tracked & other) const noexcept {
+    return value == other.value;
+  }
+};
+
+// Owns a heap string through a pointer; not trivially copyable, but safe to move with memmove
+struct Handle {
+  std::string * name;
+
+  explicit Handle(const char * text) noexcept
+    : name(new std::string(text)) {}
+
+  Handle(const Handle & other) noexcept
+    : name(new std::string(*other.name)) {}
+
+  Handle(Handle && other) noexcept
+    : name(other.name) {
+    other.name = nullptr;
+  }
+
+  ~Handle() noexcept {
+    delete name;
+  }
+
+  Handle & operator=(const Handle &) = delete;
+};
+
+// Fills, edits, and drains a vector the way engine code does, so the same steps run at compile time and at runtime
+constexpr toy::FixedVector<int, 8> makeList() {
+  toy::FixedVector<int, 8> list{3, 5, 7};
+
+  list.insert(list.begin(), 1);
+  list.insert(list.begin() + 2, 2, 4);
+  list.erase(list.begin() + 3);
+  list.emplace_back(9);
+  list.push_back(11);
+  list.resize(8, 13);
+
+  return list;
+}
+
+constexpr int sumAfterPop() {
+  toy::FixedVector<int, 4> list(3, 2);
+
+  list.pop_back();
+
+  int sum = 0;
+
+  for (const int value : list)
+    sum += value;
+
+  return sum + static_cast<int>(list.size());
+}
+
+#ifdef _DEBUG
+std::vector<std::string> g_reports;
+
+bool recordAssertion(const char * assertionString) noexcept {
+  g_reports.emplace_back(assertionString);
+
+  return true;
+}
+#endif // _DEBUG
+
+} // namespace
+
+template <>
+struct toy::IsTriviallyRelocatable<Handle> : std::true_type {};
+
+TEST_CASE("core/fixed_vector/constexpr") {
+  constexpr toy::FixedVector<int, 8> list = makeList();
+  static_assert(list.size() == 8 && list.full());
+  static_assert(list == toy::FixedVector<int, 8>{1, 3, 4, 5, 7, 9, 11, 13});
+  static_assert(list.front() == 1 && list.back() == 13);
+  static_assert(sumAfterPop() == 6);
+
+  static_assert(std::is_trivially_destructible_v<toy::FixedVector<int, 4>>);
+  static_assert(!std::is_trivially_destructible_v<toy::FixedVector<Tracked, 4>>);
+  static_assert(toy::isTriviallyRelocatable<toy::FixedString<8>>);
+  static_assert(!toy::isTriviallyRelocatable<Tracked>);
+
+  // Runtime calls take the memmove and memcpy paths and must agree with the constant-evaluated result
+  const toy::FixedVector<int, 8> runtimeList = makeList();
+  CHECK(runtimeList == list);
+}
+
+TEST_CASE("core/fixed_vector/construction") {
+  SUBCASE("empty") {
+    const toy::FixedVector<Tracked, 4> list;
+
+    CHECK(list.empty());
+    CHECK_EQ(list.size(), 0U);
+    CHECK_EQ(list.capacity(), 4U);
+    CHECK_EQ(Tracked::live, 0);
+  }
+
+  SUBCASE("from values") {
+    const toy::FixedVector<int, 4> counted(3);
+    const toy::FixedVector<int, 4> filled(2, 7);
+    const std::vector<int>         source{4, 5, 6};
+    const toy::FixedVector<int, 4> ranged(source.begin(), source.end());
+
+    CHECK(counted == toy::FixedVector<int, 4>{0, 0, 0});
+    CHECK(filled == toy::FixedVector<int, 4>{7, 7});
+    CHECK(ranged == toy::FixedVector<int, 8>{4, 5, 6});
+  }
+
+  SUBCASE("copy and move") {
+    {
+      toy::FixedVector<Tracked, 4> list{1, 2, 3};
+      toy::FixedVector<Tracked, 4> copy(list);
+      toy::FixedVector<Tracked, 4> moved(std::move(list));
+
+      CHECK(copy == moved);
+      CHECK_EQ(Tracked::live, 9);
+
+      copy = toy::FixedVector<Tracked, 4>{8};
+      CHECK_EQ(copy.size(), 1U);
+      CHECK_EQ(copy[0].value, 8);
+
+      moved = copy;
+      CHECK(moved == copy);
+    }
+
+    CHECK_EQ(Tracked::live, 0);
+  }
+}
+
+TEST_CASE("core/fixed_vector/modifiers") {
+  // Mirrors every edit on std::vector; Tracked takes the per-element paths, int the memmove paths
+  toy::FixedVector<Tracked, 16> tracked;
+  toy::FixedVector<int, 16>     trivial;
+  std::vector<int>              reference;
+
+  const auto check = [&] {
+    REQUIRE_EQ(tracked.size(), reference.size());
+    REQUIRE_EQ(trivial.size(), reference.size());
+    CHECK_EQ(Tracked::live, static_cast<int>(reference.size()));
+
+    for (size_t index = 0; index < reference.size(); ++index) {
+      CAPTURE(index);
+      CHECK_EQ(tracked[index].value, reference[index]);
+      CHECK_EQ(trivial[index], reference[index]);
+    }
+  };
+
+  for (int value = 0; value < 6; ++value) {
+    tracked.push_back(value);
+    trivial.push_back(value);
+    reference.push_back(value);
+  }
+
+  check();
+
+  SUBCASE("insert") {
+    tracked.insert(tracked.begin() + 2, 20);
+    trivial.insert(trivial.begin() + 2, 20);
+    reference.insert(reference.begin() + 2, 20);
+    check();
+
+    tracked.insert(tracked.end(), 3, Tracked(30));
+    trivial.insert(trivial.end(), 3, 30);
+    reference.insert(reference.end(), 3, 30);
+    check();
+
+    tracked.insert(tracked.begin(), {40, 41});
+    trivial.insert(trivial.begin(), {40, 41});
+    reference.insert(reference.begin(), {40, 41});
+    check();
+
+    // The inserted value is an element that the shift moves
+    tracked.insert(tracked.begin(), tracked[3]);
+    trivial.insert(trivial.begin(), trivial[3]);
+    reference.insert(reference.begin(), reference[3]);
+    check();
+  }
+
+  SUBCASE("erase") {
+    CHECK_EQ(tracked.erase(tracked.begin() + 1)->value, 2);
+    CHECK_EQ(*trivial.erase(trivial.begin() + 1), 2);
+    reference.erase(reference.begin() + 1);
+    check();
+
+    tracked.erase(tracked.begin() + 1, tracked.begin() + 3);
+    trivial.erase(trivial.begin() + 1, trivial.begin() + 3);
+    reference.erase(reference.begin() + 1, reference.begin() + 3);
+    check();
+
+    CHECK_EQ(tracked.erase(tracked.end() - 1), tracked.end());
+    CHECK_EQ(trivial.erase(trivial.end() - 1), trivial.end());
+    reference.pop_back();
+    check();
+
+    tracked.erase(tracked.begin(), tracked.begin());
+    trivial.erase(trivial.begin(), trivial.begin());
+    check();
+  }
+
+  SUBCASE("resize and clear") {
+    tracked.resize(10, Tracked(7));
+    trivial.resize(10, 7);
+    reference.resize(10, 7);
+    check();
+
+    tracked.resize(3);
+    trivial.resize(3);
+    reference.resize(3);
+    check();
+
+    tracked.pop_back();
+    trivial.pop_back();
+    reference.pop_back();
+    check();
+
+    tracked.clear();
+    trivial.clear();
+    reference.clear();
+    check();
+  }
+
+  SUBCASE("try_push_back stops at capacity") {
+    toy::FixedVector<int, 2> small;
+
+    CHECK_NE(small.try_push_back(1), nullptr);
+    CHECK_EQ(*small.try_emplace_back(2), 2);
+    CHECK_EQ(small.try_push_back(3), nullptr);
+    CHECK(small.full());
+    CHECK(small == toy::FixedVector<int, 2>{1, 2});
+  }
+
+  tracked.clear();
+  CHECK_EQ(Tracked::live, 0);
+}
+
+TEST_CASE("core/fixed_vector/relocatable") {
+  // Handle is declared trivially relocatable, so the shifts below move its pointers with memmove
+  toy::FixedVector<Handle, 8> handles;
+
+  handles.emplace_back("b");
+  handles.emplace_back("d");
+  handles.emplace(handles.begin(), "a");
+  handles.emplace(handles.begin() + 2, "c");
+  handles.erase(handles.begin() + 1);
+
+  REQUIRE_EQ(handles.size(), 3U);
+  CHECK_EQ(*handles[0].name, "a");
+  CHECK_EQ(*handles[1].name, "c");
+  CHECK_EQ(*handles[2].name, "d");
+}
+
+TEST_CASE("core/fixed_vector/overflow") {
+#ifdef _DEBUG
+  toy::assertion::initialize();
+  toy::assertion::setCallbacks(recordAssertion, nullptr);
+  g_reports.clear();
+#endif // _DEBUG
+
+  // Growing a full vector asserts and leaves it as it was
+  toy::FixedVector<int, 3>       values{1, 2, 3};
+  const toy::FixedVector<int, 3> expected{1, 2, 3};
+  const int                      more[] = {8, 9};
+
+  values.push_back(4);
+  CHECK_EQ(&values.emplace_back(5), &values.back());
+  CHECK_EQ(values.insert(values.begin(), 6), values.end());
+  CHECK_EQ(values.insert(values.begin(), 2, 7), values.end());
+  CHECK_EQ(values.insert(values.begin(), std::begin(more), std::end(more)), values.end());
+  values.resize(4);
+  values.resize(5, 0);
+
+  CHECK_EQ(values.size(), 3U);
+  CHECK(values == expected);
+
+  // A vector with room for some but not all of the new elements takes none of them
+  toy::FixedVector<int, 3> partial{1};
+
+  CHECK_EQ(partial.insert(partial.end(), 3, 7), partial.end());
+  partial.resize(4);
+  CHECK(partial == toy::FixedVector<int, 3>{1});
+
+#ifdef _DEBUG
+  REQUIRE_FALSE(g_reports.empty());
+  CHECK(g_reports[0].find("fixed vector has no room for the new elements") != std::string::npos);
+
+  toy::assertion::setCallbacks(nullptr, nullptr);
+  toy::assertion::deInitialize();
+#endif // _DEBUG
+}
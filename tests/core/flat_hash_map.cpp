@@ -0,0 +1,287 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   flat_hash_map.cpp
+  \brief  Unit tests for toy::FlatHashMap, with both probing strategies.
+*/
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Counts live instances, so erasure, clearing and destruction can be checked for leaks and double destruction
+struct Tracked {
+  static inline int live = 0;
+
+  explicit Tracked(int value) noexcept
+    : value(value) {
+    ++live;
+  }
+
+  Tracked(const Tracked & other) noexcept
+    : value(other.value) {
+    ++live;
+  }
+
+  Tracked(Tracked && other) noexcept
+    : value(other.value) {
+    ++live;
+  }
+
+  Tracked & operator=(const Tracked &) noexcept = default;
+
+  Tracked & operator=(Tracked &&) noexcept = default;
+
+  ~Tracked() noexcept {
+    --live;
+  }
+
+  int value;
+};
+
+enum class Layer : uint8_t { Background, World, Interface };
+
+// Sends every key to one of four home slots, so probe sequences collide and overlap
+struct ClusteringHash {
+  uint64_t operator()(uint32_t key) const noexcept {
+    return static_cast<uint64_t>(key & 0x7F) | (static_cast<uint64_t>(key % 4) << 7);
+  }
+};
+
+template <toy::HashProbing Probing>
+void checkBasics() {
+  toy::FlatHashMap<uint32_t, int, 64, toy::Hasher<uint32_t>, std::equal_to<uint32_t>, Probing> map;
+
+  CHECK(map.empty());
+  CHECK_EQ(map.capacity(), 64U);
+  CHECK_EQ(map.max_size(), 60U);
+  CHECK(map.begin() == map.end());
+
+  const auto [inserted, added] = map.try_emplace(7U, 70);
+  REQUIRE(added);
+  CHECK_EQ(inserted->key, 7U);
+  CHECK_EQ(inserted->value, 70);
+
+  const auto [existing, addedAgain] = map.try_emplace(7U, 71);
+  CHECK_FALSE(addedAgain);
+  CHECK(existing == inserted);
+  CHECK_EQ(existing->value, 70);
+
+  CHECK(map.insert({8U, 80}).second);
+  CHECK_FALSE(map.insert_or_assign(8U, 81).second);
+  CHECK_EQ(map.find(8U)->value, 81);
+  CHECK(map.insert_or_assign(9U, 90).second);
+
+  CHECK_EQ(map.size(), 3U);
+  CHECK(map.contains(9U));
+  CHECK_FALSE(map.contains(10U));
+  CHECK(map.find(10U) == map.end());
+
+  const auto & constMap = map;
+  int          sum      = 0;
+
+  for (const auto & entry : constMap)
+    sum += entry.value;
+
+  CHECK_EQ(sum, 70 + 81 + 90);
+
+  CHECK_EQ(map.erase(8U), 1U);
+  CHECK_EQ(map.erase(8U), 0U);
+  map.erase(map.find(7U));
+  CHECK_EQ(map.size(), 1U);
+  CHECK_FALSE(map.contains(7U));
+
+  map.clear();
+  CHECK(map.empty());
+  CHECK(map.begin() == map.end());
+}
+
+// Random inserts and erases against std::unordered_map; the key range is small, so erased slots are reused often
+template <typename Map>
+void checkAgainstReference(Map & map, uint32_t keyRange, size_t operations) {
+  std::unordered_map<uint32_t, int> reference;
+  uint64_t                          state = 1;
+
+  for (size_t step = 0; step < operations; ++step) {
+    state                = state * 6364136223846793005U + 1442695040888963407U;
+    const auto key       = static_cast<uint32_t>(state >> 33) % keyRange;
+    const bool inserting = ((state >> 20) & 3) != 0;
+
+    if (inserting) {
+      const auto [position, added] = map.try_emplace(key, Tracked(static_cast<int>(step)));
+
+      if (reference.contains(key)) {
+        CHECK_FALSE(added);
+      } else if (reference.size() < map.max_size()) {
+        // Robin Hood may also refuse an entry whose probe distance would not fit in a control byte
+        REQUIRE(added);
+        CHECK_EQ(position->key, key);
+        reference.emplace(key, static_cast<int>(step));
+      } else {
+        CHECK_FALSE(added);
+        CHECK(position == map.end());
+      }
+    } else {
+      CHECK_EQ(map.erase(key), reference.erase(key));
+    }
+
+    if (step % 64 == 0) {
+      REQUIRE_EQ(map.size(), reference.size());
+
+      for (const auto & [referenceKey, referenceValue] : reference) {
+        const auto position = map.find(referenceKey);
+
+        REQUIRE(position != map.end());
+        CHECK_EQ(position->value.value, referenceValue);
+      }
+
+      size_t iterated = 0;
+
+      for (const auto & entry : map) {
+        CHECK(reference.contains(entry.key));
+        ++iterated;
+      }
+
+      CHECK_EQ(iterated, reference.size());
+    }
+  }
+}
+
+template <toy::HashProbing Probing>
+void checkRandomized() {
+  SUBCASE("uniform hash") {
+    toy::FlatHashMap<uint32_t, Tracked, 256, toy::Hasher<uint32_t>, std::equal_to<uint32_t>, Probing> map;
+
+    checkAgainstReference(map, 400, 40000);
+    map.clear();
+    CHECK_EQ(Tracked::live, 0);
+  }
+
+  SUBCASE("clustered hash") {
+    toy::FlatHashMap<uint32_t, Tracked, 128, ClusteringHash, std::equal_to<uint32_t>, Probing> map;
+
+    checkAgainstReference(map, 160, 20000);
+  }
+
+  SUBCASE("caller storage") {
+    using Map = toy::FlatHashMap<uint32_t, Tracked, 0, toy::Hasher<uint32_t>, std::equal_to<uint32_t>, Probing>;
+
+    alignas(Map::c_storageAlignment) std::byte storage[Map::storageSize(512)];
+    Map                                        map(storage, 512);
+
+    CHECK_EQ(map.capacity(), 512U);
+    checkAgainstReference(map, 700, 40000);
+  }
+
+  SUBCASE("allocator storage") {
+    using Map = toy::FlatHashMap<uint32_t, Tracked, 0, toy::Hasher<uint32_t>, std::equal_to<uint32_t>, Probing>;
+
+    alignas(toy::c_defaultAlignment) std::byte memory[Map::storageSize(512) + 64];
+    toy::LinearAllocator                       arena(memory, sizeof(memory));
+
+    {
+      Map map(arena, 512);
+
+      CHECK_EQ(arena.used(), Map::storageSize(512));
+      CHECK_EQ(map.capacity(), 512U);
+      checkAgainstReference(map, 700, 40000);
+    }
+
+    arena.reset();
+  }
+
+  CHECK_EQ(Tracked::live, 0);
+}
+
+template <toy::HashProbing Probing>
+void checkFull() {
+  toy::FlatHashMap<uint32_t, int, 32, toy::Hasher<uint32_t>, std::equal_to<uint32_t>, Probing> map;
+
+  // Filling, emptying and refilling leaves a table of erased slots, which insertion must reclaim
+  for (int round = 0; round < 4; ++round) {
+    for (uint32_t key = 0; key < map.max_size(); ++key)
+      REQUIRE(map.try_emplace(key + static_cast<uint32_t>(round) * 1000U, round).second);
+
+    CHECK_EQ(map.size(), map.max_size());
+    CHECK(map.try_emplace(999U, 0).first == map.end());
+
+    for (uint32_t key = 0; key < map.max_size(); ++key)
+      CHECK_EQ(map.erase(key + static_cast<uint32_t>(round) * 1000U), 1U);
+  }
+
+  CHECK(map.empty());
+}
+
+} // namespace
+
+TEST_CASE("core/flat_hash_map/groups") {
+  checkBasics<toy::HashProbing::Groups>();
+  checkRandomized<toy::HashProbing::Groups>();
+  checkFull<toy::HashProbing::Groups>();
+}
+
+TEST_CASE("core/flat_hash_map/robin_hood") {
+  checkBasics<toy::HashProbing::RobinHood>();
+  checkRandomized<toy::HashProbing::RobinHood>();
+  checkFull<toy::HashProbing::RobinHood>();
+}
+
+TEST_CASE("core/flat_hash_map/keys") {
+  using namespace toy::literals;
+
+  SUBCASE("strings") {
+    toy::FlatHashMap<toy::FixedString<32>, std::string, 64> map;
+
+    for (int index = 0; index < 40; ++index) {
+      const std::string name = "sprite_" + std::to_string(index);
+
+      CHECK(map.try_emplace(toy::FixedString<32>(name.c_str()), name).second);
+    }
+
+    CHECK_EQ(map.find(toy::FixedString<32>("sprite_17"))->value, "sprite_17");
+    CHECK_FALSE(map.contains(toy::FixedString<32>("sprite_40")));
+  }
+
+  SUBCASE("string ids and enums") {
+    toy::FlatHashMap<toy::StringId, Layer, 16> layers;
+    layers.try_emplace("sky"_sid, Layer::Background);
+    layers.try_emplace("hud"_sid, Layer::Interface);
+
+    CHECK_EQ(layers.find("hud"_sid)->value, Layer::Interface);
+    CHECK_FALSE(layers.contains("player"_sid));
+
+    toy::FlatHashMap<Layer, int, 16> counts;
+    counts.try_emplace(Layer::World, 3);
+    CHECK_EQ(counts.find(Layer::World)->value, 3);
+  }
+
+  SUBCASE("hasher") {
+    CHECK_EQ(toy::Hasher<toy::string_view>{}("player"), toy::hash64("player"));
+    CHECK_EQ(toy::Hasher<toy::FixedString<16>>{}(toy::FixedString<16>("player")), toy::hash64("player"));
+    CHECK_EQ(toy::Hasher<toy::StringId>{}("player"_sid), toy::hash64("player"));
+    CHECK_NE(toy::Hasher<uint32_t>{}(1U), toy::Hasher<uint32_t>{}(2U));
+  }
+}
@@ -0,0 +1,194 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   format.cpp
+  \brief  Unit tests for toy::formatTo(), toy::format(), and the compile-time format string check.
+
+  Expected strings are what \c std::format produces for the same format string and arguments.
+*/
+
+#include <doctest/doctest.h>
+
+#include <cstdint>
+#include <limits>
+#include <string>
+
+#include "core.hpp"
+
+namespace {
+
+using toy::formatting::ArgumentKind;
+
+// Checks a format string the way toy::FormatString does, for arguments of the given categories
+template <typename... Kinds>
+constexpr bool accepts(toy::string_view format, Kinds... kinds) {
+  const ArgumentKind list[] = {ArgumentKind::None, kinds...};
+
+  return toy::formatting::isValidFormat(format, list + 1, sizeof...(kinds));
+}
+
+} // namespace
+
+TEST_CASE("core/format/check") {
+  using enum ArgumentKind;
+
+  static_assert(toy::formatting::kindOf<bool>() == Bool);
+  static_assert(toy::formatting::kindOf<char>() == Char);
+  static_assert(toy::formatting::kindOf<uint8_t>() == Unsigned);
+  static_assert(toy::formatting::kindOf<const long &>() == Signed);
+  static_assert(toy::formatting::kindOf<char[6]>() == String);
+  static_assert(toy::formatting::kindOf<toy::FixedString<8>>() == String);
+  static_assert(toy::formatting::kindOf<std::string>() == String);
+  static_assert(toy::formatting::kindOf<const void *>() == Pointer);
+  static_assert(toy::formatting::kindOf<std::nullptr_t>() == Pointer);
+  static_assert(toy::formatting::kindOf<int *>() == None);
+  static_assert(toy::formatting::kindOf<char32_t>() == None);
+  static_assert(!toy::Formattable<long double>);
+
+  static_assert(accepts("plain text {{ and }}"));
+  static_assert(accepts("{} {}", Signed, String));
+  static_assert(accepts("{1} {0} {1}", Signed, String));
+  static_assert(accepts("{:*^+#012x}", Unsigned));
+  static_assert(accepts("{:>10.3f} {:e} {:.0}", Double, Float, Double));
+  static_assert(accepts("{:.5s} {:8}", String, Bool));
+  static_assert(accepts("{:c} {:d} {:#x}", Signed, Char, Bool));
+  static_assert(accepts("{:p} {:018}", Pointer, Pointer));
+
+  static_assert(!accepts("{", Signed));
+  static_assert(!accepts("}"));
+  static_assert(!accepts("{} {}", Signed));
+  static_assert(!accepts("{2}", Signed, Signed));
+  static_assert(!accepts("{01}", Signed, Signed));
+  static_assert(!accepts("{0} {}", Signed, Signed));
+  static_assert(!accepts("{:d}", String));
+  static_assert(!accepts("{:f}", Signed));
+  static_assert(!accepts("{:.2}", Signed));
+  static_assert(!accepts("{:+}", String));
+  static_assert(!accepts("{:+c}", Signed));
+  static_assert(!accepts("{:#f}", Double));
+  static_assert(!accepts("{:.65f}", Double));
+  static_assert(!accepts("{:{}}", Signed, Signed));
+  static_assert(!accepts("{:L}", Signed));
+  static_assert(!accepts("{:70000}", Signed));
+  static_assert(!accepts("{:x}", Pointer));
+}
+
+TEST_CASE("core/format/integers") {
+  CHECK_EQ(toy::format<32>("{}", 0), "0");
+  CHECK_EQ(toy::format<32>("{} {}", -42, 42U), "-42 42");
+  CHECK_EQ(toy::format<32>("{}", std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+  CHECK_EQ(toy::format<32>("{}", std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+  CHECK_EQ(toy::format<32>("{:+} {: } {:-}", 5, 5, 5), "+5  5 5");
+  CHECK_EQ(toy::format<32>("{:x} {:X} {:o} {:b}", 255, 255, 8, 5), "ff FF 10 101");
+  CHECK_EQ(toy::format<32>("{:#x} {:#X} {:#o} {:#o} {:#b}", 255, 255, 8, 0, 5), "0xff 0XFF 010 0 0b101");
+  CHECK_EQ(toy::format<32>("{:06} {:+06} {:#06x}", 42, 42, 255), "000042 +00042 0x00ff");
+  CHECK_EQ(toy::format<64>("[{:6}] [{:<6}] [{:^6}] [{:*>6}]", 42, 42, 42, 42),
+           "[    42] [42    ] [  42  ] [****42]");
+  CHECK_EQ(toy::format<32>("[{:<06}]", 42), "[42    ]");
+  CHECK_EQ(toy::format<32>("{:c}{:c}", 79, 'K'), "OK");
+  CHECK_EQ(toy::format<32>("{} {:d} {:x}", 'a', 'a', static_cast<uint8_t>(200)), "a 97 c8");
+}
+
+TEST_CASE("core/format/floats") {
+  CHECK_EQ(toy::format<64>("{} {} {}", 1.5, 0.1, 1e21), "1.5 0.1 1e+21");
+  CHECK_EQ(toy::format<64>("{} {}", 0.1F, -0.0), "0.1 -0");
+  CHECK_EQ(toy::format<64>("{:.2f} {:f} {:.0f}", 3.14159, 2.5, 2.5), "3.14 2.500000 2");
+  CHECK_EQ(toy::format<64>("{:e} {:.3E}", 1234.5, 0.000123), "1.234500e+03 1.230E-04");
+  CHECK_EQ(toy::format<64>("{:g} {:G} {:.3}", 1e-5, 1e20, 3.14159), "1e-05 1E+20 3.14");
+  CHECK_EQ(toy::format<64>("{:a} {:A}", 1.0, 10.0), "1p+0 1.4P+3");
+  CHECK_EQ(toy::format<64>("[{:8.2f}] [{:<8.2f}] [{:08.2f}] [{:+.1f}]", -1.5, 1.5, -1.5, 1.5),
+           "[   -1.50] [1.50    ] [-0001.50] [+1.5]");
+
+  constexpr double infinity = std::numeric_limits<double>::infinity();
+  CHECK_EQ(toy::format<64>("{} {:+} {:F} [{:06}]", infinity, infinity, -infinity, infinity), "inf +inf -INF [   inf]");
+  CHECK_EQ(toy::format<64>("{}", std::numeric_limits<double>::quiet_NaN()), "nan");
+
+  // The widest field the precision limit allows
+  const toy::FixedString<512> widest = toy::format<512>("{:.64f}", -std::numeric_limits<double>::max());
+  CHECK_EQ(widest.size(), 1U + 309U + 1U + 64U);
+}
+
+TEST_CASE("core/format/text") {
+  const std::string          name = "player";
+  const toy::FixedString<16> tag("hud");
+
+  CHECK_EQ(toy::format<64>("{} {} {} {}", "literal", name, tag, toy::string_view("view")), "literal player hud view");
+  CHECK_EQ(toy::format<64>("[{:8}] [{:>8}] [{:^9}] [{:.3}]", name, name, name, name),
+           "[player  ] [  player] [ player  ] [pla]");
+  CHECK_EQ(toy::format<64>("{} {:s} {:d} {:>6}", true, false, true, false), "true false 1  false");
+  CHECK_EQ(toy::format<64>("[{:c}] [{:3}] [{:>3}]", 'x', 'y', 'z'), "[x] [y  ] [  z]");
+
+  // Width and precision count code points, not bytes
+  CHECK_EQ(toy::format<64>("[{:5}] [{:.2}]", "\xC3\xA9t\xC3\xA9", "\xC3\xA9t\xC3\xA9"),
+           "[\xC3\xA9t\xC3\xA9  ] [\xC3\xA9t]");
+
+  const auto * pointer = reinterpret_cast<const void *>(uintptr_t{0x1234ABCD});
+  CHECK_EQ(toy::format<64>("{} {:p} {:012}", pointer, nullptr, pointer), "0x1234abcd 0x0 0x001234abcd");
+  CHECK_EQ(toy::format<64>("{1}-{0}-{1} {{}}", "a", "b"), "b-a-b {}");
+}
+
+TEST_CASE("core/format/output") {
+  SUBCASE("buffer") {
+    char buffer[8];
+
+    CHECK_EQ(toy::formatTo(buffer, sizeof(buffer), "{}:{}", 12, 34), 5U);
+    CHECK_EQ(toy::string_view(buffer, 5), "12:34");
+
+    // Truncated: the full size is reported, and nothing past the buffer is written
+    char guarded[12] = "##########";
+    CHECK_EQ(toy::formatTo(guarded, 4, "value={}", 123456), 12U);
+    CHECK_EQ(toy::string_view(guarded, 10), "valu######");
+
+    CHECK_EQ(toy::formatTo(nullptr, 0, "{:>20}", 1), 20U);
+    CHECK_EQ(toy::formattedSize("{} {:.3f}", "abc", 2.0), 9U);
+  }
+
+  SUBCASE("fixed string") {
+    toy::FixedString<16> line("fps ");
+
+    toy::formatTo(line, "{:.1f}", 59.94);
+    CHECK_EQ(line, "fps 59.9");
+
+    toy::formatTo(line, " frame {:08}", 1234);
+    CHECK_EQ(line, "fps 59.9 frame 0");
+    CHECK_EQ(line.size(), line.capacity());
+
+    const toy::FixedString<4> clipped = toy::format<4>("{}", 123456);
+    CHECK_EQ(clipped, "1234");
+  }
+
+  SUBCASE("allocator") {
+    alignas(toy::c_defaultAlignment) std::byte memory[1024];
+    toy::LinearAllocator                       arena(memory, sizeof(memory));
+
+    const toy::string_view label = toy::format(arena, "{} x{}", "coin", 12);
+    CHECK_EQ(label, "coin x12");
+    CHECK_EQ(label.data()[label.size()], '\0');
+    CHECK_EQ(arena.used(), label.size() + 1);
+
+    // Longer than the stack buffer: formatted in place
+    const toy::string_view padded = toy::format(arena, "{:>300}", 7);
+    CHECK_EQ(padded.size(), 300U);
+    CHECK_EQ(padded.back(), '7');
+    CHECK_EQ(padded.front(), ' ');
+
+    CHECK(toy::format(arena, "{:>1000}", 7).empty());
+  }
+}
@@ -0,0 +1,172 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   hash.cpp
+  \brief  Unit tests for the core hashes and toy::StringId.
+*/
+
+#include <doctest/doctest.h>
+
+#include <bit>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Deterministic bytes covering every value, so the tests do not depend on a random device
+std::string makeBytes(size_t size, uint64_t seed) {
+  std::string bytes(size, '\0');
+
+  for (char & byte : bytes) {
+    seed = seed * 6364136223846793005U + 1442695040888963407U;
+    byte = static_cast<char>(seed >> 56);
+  }
+
+  return bytes;
+}
+
+// Fraction of output bits that flip, per flipped input bit, averaged over all input bits of several keys
+double avalanche(size_t size) {
+  size_t flipped = 0;
+  size_t total   = 0;
+
+  for (uint64_t key = 0; key < 16; ++key) {
+    std::string    bytes    = makeBytes(size, key);
+    const uint64_t original = toy::hashBuffer64(bytes.data(), bytes.size());
+
+    for (size_t bit = 0; bit < size * 8; ++bit) {
+      bytes[bit / 8] = static_cast<char>(bytes[bit / 8] ^ (1 << (bit % 8)));
+      flipped += static_cast<size_t>(std::popcount(original ^ toy::hashBuffer64(bytes.data(), bytes.size())));
+      bytes[bit / 8] = static_cast<char>(bytes[bit / 8] ^ (1 << (bit % 8)));
+      total += 64;
+    }
+  }
+
+  return static_cast<double>(flipped) / static_cast<double>(total);
+}
+
+} // namespace
+
+TEST_CASE("core/hash/fnv1a") {
+  static_assert(toy::fnv1a32("") == 0x811C9DC5U);
+  static_assert(toy::fnv1a32("a") == 0xE40C292CU);
+  static_assert(toy::fnv1a32("foobar") == 0xBF9CF968U);
+  static_assert(toy::fnv1a64("") == 0xCBF29CE484222325U);
+  static_assert(toy::fnv1a64("a") == 0xAF63DC4C8601EC8CU);
+  static_assert(toy::fnv1a64("foobar") == 0x85944171F73967E8U);
+
+  const std::string text = "foobar";
+  CHECK_EQ(toy::fnv1a64(text), 0x85944171F73967E8U);
+}
+
+TEST_CASE("core/hash/hash64") {
+  // Pinned values: identifiers are stored in data files, so the function must never change
+  static_assert(toy::hash64("") == 0x1E625274CEA0239AU);
+  static_assert(toy::hash64("player") == 0x19E55B23D6B089A7U);
+  static_assert(toy::hash64("player") != toy::hash64("player", 1));
+  static_assert(toy::hash64("player") != toy::hash64("playes"));
+
+  SUBCASE("constexpr, scalar and vector forms agree") {
+    // Lengths cover every short-input branch, the first stripes, the scramble after 16 stripes and the overlapping
+    // final stripe
+    const std::string bytes = makeBytes(2200, 7);
+
+    for (size_t size = 0; size <= bytes.size(); size += size < 300 ? 1 : 37) {
+      CAPTURE(size);
+
+      for (const uint64_t seed : {uint64_t{0}, uint64_t{1}, uint64_t{0xFFFFFFFFFFFFFFFFU}}) {
+        const uint64_t reference = toy::hashing::hashBytes(bytes.data(), size, seed);
+
+        CHECK_EQ(toy::hashBuffer64(bytes.data(), size, seed), reference);
+        CHECK_EQ(toy::scalar::hashBuffer64(bytes.data(), size, seed), reference);
+        CHECK_EQ(toy::hash64(toy::string_view(bytes.data(), size), seed), reference);
+      }
+    }
+
+    constexpr uint64_t longHash = toy::hash64(
+      "assets/levels/world_03/sectors/sector_aa.sector assets/levels/world_03/sectors/sector_ab.sector "
+      "assets/levels/world_03/sectors/sector_ac.sector assets/levels/world_03/sectors/sector_ad.sector "
+      "assets/levels/world_03/sectors/sector_ae.sector assets/levels/world_03/sectors/sector_af.sector");
+    const std::string longText(
+      "assets/levels/world_03/sectors/sector_aa.sector assets/levels/world_03/sectors/sector_ab.sector "
+      "assets/levels/world_03/sectors/sector_ac.sector assets/levels/world_03/sectors/sector_ad.sector "
+      "assets/levels/world_03/sectors/sector_ae.sector assets/levels/world_03/sectors/sector_af.sector");
+
+    CHECK_GT(longText.size(), toy::hashing::c_longThreshold);
+    CHECK_EQ(toy::hashBuffer64(longText.data(), longText.size()), longHash);
+  }
+
+  SUBCASE("avalanche") {
+    // Each input bit must flip close to half of the output bits, for both the short chain and the stripe loop
+    for (const size_t size : {1U, 3U, 8U, 16U, 40U, 100U, 300U, 1500U}) {
+      CAPTURE(size);
+
+      const double ratio = avalanche(size);
+
+      CHECK_GT(ratio, 0.49);
+      CHECK_LT(ratio, 0.51);
+    }
+  }
+
+  SUBCASE("no collisions between similar names") {
+    std::unordered_set<uint64_t> hashes;
+    std::unordered_set<uint32_t> lowBits;
+
+    for (size_t index = 0; index < 100000; ++index) {
+      const std::string name = "entity_" + std::to_string(index);
+
+      hashes.insert(toy::hash64(name));
+      lowBits.insert(static_cast<uint32_t>(toy::hash64(name)));
+    }
+
+    CHECK_EQ(hashes.size(), 100000U);
+
+    // About 1.16 expected collisions in the low 32 bits
+    CHECK_GE(lowBits.size(), 99990U);
+  }
+}
+
+TEST_CASE("core/hash/string_id") {
+  using namespace toy::literals;
+
+  constexpr toy::StringId player = "player"_sid;
+  constexpr toy::StringId enemy("enemy");
+  static_assert(player.value() == toy::hash64("player"));
+  static_assert(player != enemy);
+  static_assert(player == toy::StringId("player"));
+  static_assert(!toy::StringId() && player);
+
+  std::string name = "play";
+  name += "er";
+
+  const toy::StringId runtimeId = toy::internString(name);
+  CHECK_EQ(runtimeId, player);
+  CHECK_EQ(std::hash<toy::StringId>{}(runtimeId), static_cast<size_t>(player.value()));
+
+#ifdef _DEBUG
+  CHECK_EQ(toy::internedName(player), "player");
+  CHECK(toy::internedName("unknown"_sid).empty());
+#else
+  CHECK(toy::internedName(player).empty());
+#endif
+}
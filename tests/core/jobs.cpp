@@ -0,0 +1,220 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   jobs.cpp
+  \brief  Unit tests for the job system: counters, fork-join, parallelFor(), and queue overflow.
+*/
+
+#include <doctest/doctest.h>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+std::atomic<size_t> g_items{0};
+
+void countItems(void * data, size_t first, size_t last) noexcept {
+  static_cast<std::atomic<size_t> *>(data)->fetch_add(last - first, std::memory_order_relaxed);
+}
+
+// Forks a nested parallelFor() from inside a job, as a culling job that animates what it keeps would
+void forkNested(void * data, size_t first, size_t last) noexcept {
+  for (size_t index = first; index < last; ++index) {
+    toy::jobs::parallelFor(100, 10, [data](size_t nestedFirst, size_t nestedLast) {
+      static_cast<std::atomic<size_t> *>(data)->fetch_add(nestedLast - nestedFirst, std::memory_order_relaxed);
+    });
+  }
+}
+
+#ifdef TOYGINE_JOB_THREADS
+std::atomic<bool>  g_spawnerStarted{false};
+std::atomic<bool>  g_markerRan{false};
+std::atomic<bool>  g_markerExited{false};
+toy::jobs::Counter g_spawnedCounter;
+
+// Signals when the thread that created it exits; a worker exits only once shutdown has set the stop flag
+struct ExitSignal {
+  ~ExitSignal() noexcept {
+    g_markerExited.store(true, std::memory_order_release);
+    g_markerExited.notify_all();
+  }
+};
+
+thread_local ExitSignal t_exitSignal;
+
+void signal(std::atomic<bool> & flag) noexcept {
+  flag.store(true, std::memory_order_release);
+  flag.notify_all();
+}
+
+// Runs on the worker the spawner leaves free, so that worker signals when it exits
+void markWorker(void *, size_t, size_t) noexcept {
+  static_cast<void>(&t_exitSignal);
+  signal(g_markerRan);
+}
+
+// Waits until shutdown has stopped the other worker, then queues jobs on its own worker, which stops after this job
+void spawnJobs(void * data, size_t first, size_t last) noexcept {
+  static std::vector<toy::jobs::Job> jobs(100, toy::jobs::Job{countItems, data, first, last, nullptr});
+
+  signal(g_spawnerStarted);
+  g_markerExited.wait(false, std::memory_order_acquire);
+  toy::jobs::run(jobs.data(), jobs.size(), g_spawnedCounter);
+}
+#endif // TOYGINE_JOB_THREADS
+
+} // namespace
+
+TEST_CASE("core/jobs/scheduler") {
+  toy::jobs::initialize(3);
+
+#ifdef TOYGINE_JOB_THREADS
+  CHECK_EQ(toy::jobs::workerCount(), 3U);
+#else
+  CHECK_EQ(toy::jobs::workerCount(), 0U);
+#endif
+
+  SUBCASE("a counter tracks its jobs") {
+    std::vector<toy::jobs::Job> jobs(500, toy::jobs::Job{countItems, &g_items, 0, 2, nullptr});
+    toy::jobs::Counter          counter;
+
+    g_items = 0;
+    toy::jobs::run(jobs.data(), jobs.size(), counter);
+    toy::jobs::wait(counter);
+
+    CHECK(counter.done());
+    CHECK_EQ(g_items.load(), 1000U);
+  }
+
+  SUBCASE("more jobs than a queue holds") {
+    std::vector<toy::jobs::Job> jobs(3 * toy::jobs::c_queueSize, toy::jobs::Job{countItems, &g_items, 0, 1, nullptr});
+    toy::jobs::Counter          counter;
+
+    g_items = 0;
+    toy::jobs::run(jobs.data(), jobs.size(), counter);
+    toy::jobs::wait(counter);
+
+    CHECK_EQ(g_items.load(), jobs.size());
+  }
+
+  SUBCASE("jobs fork and join") {
+    std::atomic<size_t> items{0};
+    toy::jobs::Job      jobs[8];
+    toy::jobs::Counter  counter;
+
+    for (auto & job : jobs)
+      job = {forkNested, &items, 0, 4, nullptr};
+
+    toy::jobs::run(jobs, 8, counter);
+    toy::jobs::wait(counter);
+
+    CHECK_EQ(items.load(), 8U * 4U * 100U);
+  }
+
+  SUBCASE("parallelFor covers the range once") {
+    std::vector<int> visits(10'007, 0);
+
+    toy::jobs::parallelFor(visits.size(), 16, [&visits](size_t first, size_t last) {
+      for (size_t index = first; index < last; ++index)
+        ++visits[index];
+    });
+
+    size_t once = 0;
+
+    for (const int count : visits)
+      once += count == 1 ? 1 : 0;
+
+    CHECK_EQ(once, visits.size());
+
+    int calls = 0;
+    toy::jobs::parallelFor(0, 16, [&calls](size_t, size_t) { ++calls; });
+    toy::jobs::parallelFor(10, 16, [&calls](size_t first, size_t last) { calls += static_cast<int>(last - first); });
+
+    CHECK_EQ(calls, 10);
+  }
+
+#ifdef TOYGINE_JOB_THREADS
+  SUBCASE("workers share the load") {
+    std::mutex                mutex;
+    std::set<std::thread::id> threads;
+
+    // Each slice runs long enough for sleeping workers to wake up and steal
+    toy::jobs::parallelFor(64, 1, [&](size_t, size_t) {
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+      const std::lock_guard lock(mutex);
+      threads.insert(std::this_thread::get_id());
+    });
+
+    CHECK_GT(threads.size(), 1U);
+  }
+
+  SUBCASE("threads that do not run jobs run theirs inline") {
+    size_t items = 0;
+
+    std::thread([&items] {
+      toy::jobs::Job     job{countItems, &g_items, 0, 5, nullptr};
+      toy::jobs::Counter counter;
+
+      g_items = 0;
+      toy::jobs::run(&job, 1, counter);
+      CHECK(counter.done());
+      items = g_items.load();
+    }).join();
+
+    CHECK_EQ(items, 5U);
+  }
+#endif // TOYGINE_JOB_THREADS
+
+  toy::jobs::deInitialize();
+
+  CHECK_EQ(toy::jobs::workerCount(), 0U);
+}
+
+#ifdef TOYGINE_JOB_THREADS
+TEST_CASE("core/jobs/shutdown") {
+  toy::jobs::initialize(2);
+
+  toy::jobs::Job     spawner{spawnJobs, &g_items, 0, 1, nullptr};
+  toy::jobs::Job     marker{markWorker, nullptr, 0, 1, nullptr};
+  toy::jobs::Counter counter;
+
+  g_items = 0;
+
+  // This thread never runs jobs: one worker takes the spawner and blocks in it, so the other one takes the marker
+  toy::jobs::run(&spawner, 1, counter);
+  g_spawnerStarted.wait(false, std::memory_order_acquire);
+  toy::jobs::run(&marker, 1, counter);
+  g_markerRan.wait(false, std::memory_order_acquire);
+
+  // The spawned jobs are queued after the marked worker has stopped, and the spawner's worker stops after its job
+  toy::jobs::deInitialize();
+
+  CHECK(counter.done());
+  CHECK(g_spawnedCounter.done());
+  CHECK_EQ(g_items.load(), 100U);
+}
+#endif // TOYGINE_JOB_THREADS
@@ -0,0 +1,391 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   log.cpp
+  \brief  Unit tests for the deferred logger: queuing, levels, threads, text lines, and the file sinks.
+*/
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+using toy::log::Level;
+using toy::log::Message;
+
+struct CapturedMessage {
+  std::string text;
+  Level       level;
+  uint32_t    thread;
+};
+
+// Keeps a copy of every message it receives
+struct CaptureSink {
+  std::vector<CapturedMessage> messages;
+
+  toy::log::Sink sink() noexcept {
+    const toy::log::WriteCallback write = [](const Message & message, void * context) noexcept {
+      static_cast<CaptureSink *>(context)->messages.push_back(
+        {std::string(message.text), message.site->level, message.thread});
+    };
+
+    return {write, nullptr, this};
+  }
+};
+
+// Registers a sink for one test, after discarding what earlier tests left queued
+class ScopedSink {
+public:
+  explicit ScopedSink(const toy::log::Sink & sink)
+    : _context(sink.context) {
+    toy::log::flush();
+    toy::log::addSink(sink);
+  }
+
+  ~ScopedSink() {
+    toy::log::removeSink(_context);
+  }
+
+  ScopedSink(const ScopedSink &)             = delete;
+  ScopedSink & operator=(const ScopedSink &) = delete;
+
+private:
+  const void * _context;
+};
+
+std::filesystem::path temporaryPath(const char * name) {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+std::vector<std::byte> readFile(const std::filesystem::path & path) {
+  std::ifstream     file(path, std::ios::binary);
+  std::vector<char> characters((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+  std::vector<std::byte> bytes(characters.size());
+
+  std::memcpy(bytes.data(), characters.data(), characters.size());
+
+  return bytes;
+}
+
+void logCounter(int value) {
+  TOY_LOG_INFO("counter {}", value);
+}
+
+} // namespace
+
+TEST_CASE("core/log/site") {
+  SUBCASE("identifiers depend on the file, the line, and the format") {
+    constexpr toy::log::Site first(Level::Info, "value {}", "game.cpp", 10);
+    constexpr toy::log::Site otherLine(Level::Info, "value {}", "game.cpp", 11);
+    constexpr toy::log::Site otherFile(Level::Info, "value {}", "render.cpp", 10);
+    constexpr toy::log::Site otherFormat(Level::Info, "value {:x}", "game.cpp", 10);
+    constexpr toy::log::Site otherLevel(Level::Error, "value {}", "game.cpp", 10);
+
+    CHECK(first.id != otherLine.id);
+    CHECK(first.id != otherFile.id);
+    CHECK(first.id != otherFormat.id);
+    CHECK_EQ(first.id, otherLevel.id);
+    CHECK_EQ(first.line, 10);
+    CHECK_EQ(first.file, "game.cpp");
+  }
+
+  SUBCASE("level names") {
+    static_assert(toy::log::levelName(Level::Trace) == "trace");
+    static_assert(toy::log::levelName(Level::Fatal) == "fatal");
+
+    CHECK_EQ(toy::log::levelName(Level::Warning), "warning");
+  }
+}
+
+TEST_CASE("core/log/queue") {
+  CaptureSink      capture;
+  const ScopedSink scoped(capture.sink());
+
+  SUBCASE("messages reach the sinks formatted and in order on flush") {
+    const std::string temporary = "rock";
+
+    TOY_LOG_INFO("loaded {} sprites in {:.1f} ms", 42, 1.5);
+    TOY_LOG_WARNING("missing {} for {}", std::string("texture"), temporary);
+    TOY_LOG_ERROR("flags {} {} {:#x}", true, 'c', 255U);
+
+    CHECK(capture.messages.empty());
+
+    toy::log::flush();
+
+    REQUIRE_EQ(capture.messages.size(), 3);
+    CHECK_EQ(capture.messages[0].text, "loaded 42 sprites in 1.5 ms");
+    CHECK_EQ(capture.messages[0].level, Level::Info);
+    CHECK_EQ(capture.messages[1].text, "missing texture for rock");
+    CHECK_EQ(capture.messages[1].level, Level::Warning);
+    CHECK_EQ(capture.messages[2].text, "flags true c 0xff");
+    CHECK_EQ(capture.messages[0].thread, capture.messages[2].thread);
+  }
+
+  SUBCASE("setLevel filters messages at run time") {
+    toy::log::setLevel(Level::Error);
+    TOY_LOG_WARNING("hidden");
+    TOY_LOG_ERROR("shown");
+    toy::log::setLevel(toy::log::c_compiledLevel);
+    toy::log::flush();
+
+    REQUIRE_EQ(capture.messages.size(), 1);
+    CHECK_EQ(capture.messages[0].text, "shown");
+  }
+
+  SUBCASE("levels below the compiled level produce nothing") {
+    TOY_LOG_DEBUG("debug {}", 1);
+    TOY_LOG_TRACE("trace");
+    toy::log::flush();
+
+#ifdef _DEBUG
+    CHECK_EQ(capture.messages.size(), 2);
+#else
+    CHECK(capture.messages.empty());
+#endif // _DEBUG
+  }
+
+  SUBCASE("fatal messages are written before the call returns") {
+    TOY_LOG_INFO("before");
+    TOY_LOG_FATAL("stopping: {}", "out of memory");
+
+    REQUIRE_EQ(capture.messages.size(), 2);
+    CHECK_EQ(capture.messages[1].text, "stopping: out of memory");
+  }
+
+  SUBCASE("messages span several slots and long strings are cut") {
+    const std::string medium(300, 'm');
+    const std::string large(1000, 'l');
+
+    TOY_LOG_INFO("{}", medium);
+    TOY_LOG_INFO("{}|{}", 7, large);
+    toy::log::flush();
+
+    REQUIRE_EQ(capture.messages.size(), 2);
+    CHECK_EQ(capture.messages[0].text, medium);
+    CHECK_LT(capture.messages[1].text.size(), large.size());
+    CHECK_GT(capture.messages[1].text.size(), 300);
+    CHECK_EQ(capture.messages[1].text.substr(0, 3), "7|l");
+  }
+
+  SUBCASE("a full queue drops and counts new messages") {
+    const uint64_t dropped = toy::log::droppedMessages();
+
+    for (size_t index = 0; index < toy::log::c_queueSlots + 10; ++index)
+      logCounter(static_cast<int>(index));
+
+    CHECK_EQ(toy::log::droppedMessages() - dropped, 10);
+
+    toy::log::flush();
+
+    REQUIRE_EQ(capture.messages.size(), toy::log::c_queueSlots);
+    CHECK_EQ(capture.messages.back().text, "counter " + std::to_string(toy::log::c_queueSlots - 1));
+
+    logCounter(-1);
+    toy::log::flush();
+
+    CHECK_EQ(capture.messages.back().text, "counter -1");
+  }
+}
+
+TEST_CASE("core/log/threads") {
+  // Half a queue in total, so no message can be dropped however the threads are scheduled
+  constexpr size_t c_producers = 4;
+  constexpr int    c_messages  = static_cast<int>(toy::log::c_queueSlots / c_producers / 2);
+
+  CaptureSink      capture;
+  const ScopedSink scoped(capture.sink());
+  const uint64_t   dropped = toy::log::droppedMessages();
+
+  toy::log::initialize();
+
+  std::vector<std::thread> producers;
+
+  for (size_t producer = 0; producer < c_producers; ++producer) {
+    producers.emplace_back([] {
+      for (int index = 0; index < c_messages; ++index)
+        TOY_LOG_INFO("{}", index);
+    });
+  }
+
+  for (auto & producer : producers)
+    producer.join();
+
+  toy::log::deInitialize();
+
+  CHECK_EQ(toy::log::droppedMessages(), dropped);
+  CHECK_EQ(capture.messages.size(), c_producers * c_messages);
+
+  // Each thread's messages arrive in the order it queued them
+  std::vector<std::pair<uint32_t, int>> lastSeen;
+  bool                                  ordered = true;
+
+  for (const auto & message : capture.messages) {
+    const int value = std::stoi(message.text);
+    auto      entry = std::find_if(lastSeen.begin(), lastSeen.end(),
+                                   [&](const auto & seen) { return seen.first == message.thread; });
+
+    if (entry == lastSeen.end()) {
+      lastSeen.emplace_back(message.thread, value);
+    } else {
+      ordered = ordered && entry->second < value;
+      entry->second = value;
+    }
+  }
+
+  CHECK(ordered);
+  CHECK_EQ(lastSeen.size(), c_producers);
+}
+
+TEST_CASE("core/log/format_line") {
+  static constexpr toy::log::Site site(Level::Warning, "ignored", "/source/game/player.cpp", 42);
+
+  const Message message{&site, 1'500'000'000, 3, "low health", nullptr, 0};
+  char          line[128];
+
+  SUBCASE("time, level, thread, file name, line, and text") {
+    const size_t size = toy::log::formatLine(line, sizeof(line), message);
+
+    CHECK_EQ(toy::string_view(line, size), "      1.500000 W [3] player.cpp:42 low health\n");
+  }
+
+  SUBCASE("short buffers report the complete size") {
+    const size_t size = toy::log::formatLine(line, 8, message);
+
+    CHECK_EQ(size, 46);
+  }
+}
+
+TEST_CASE("core/log/rotating_file") {
+  const auto path = temporaryPath("toygine_log_rotating.txt");
+
+  for (const char * suffix : {"", ".1", ".2", ".3"})
+    std::filesystem::remove(path.string() + suffix);
+
+  {
+    toy::log::RotatingFileSink file(path.string().c_str(), 256, 2);
+
+    REQUIRE(file.isOpen());
+
+    const ScopedSink scoped(file.sink());
+
+    for (int index = 0; index < 40; ++index)
+      logCounter(index);
+
+    toy::log::flush();
+  }
+
+  CHECK(std::filesystem::exists(path));
+  CHECK(std::filesystem::exists(path.string() + ".1"));
+  CHECK(std::filesystem::exists(path.string() + ".2"));
+  CHECK_FALSE(std::filesystem::exists(path.string() + ".3"));
+  CHECK_LE(std::filesystem::file_size(path), 256);
+
+  const auto current = readFile(path);
+  const auto text    = std::string(reinterpret_cast<const char *>(current.data()), current.size());
+
+  CHECK(text.find("counter 39\n") != std::string::npos);
+
+  for (const char * suffix : {"", ".1", ".2"})
+    std::filesystem::remove(path.string() + suffix);
+}
+
+TEST_CASE("core/log/binary_file") {
+  const auto  path = temporaryPath("toygine_log_binary.tglog");
+  CaptureSink capture;
+
+  {
+    toy::log::BinaryFileSink binary(path.string().c_str());
+
+    REQUIRE(binary.isOpen());
+
+    const ScopedSink scopedBinary(binary.sink());
+    const ScopedSink scopedCapture(capture.sink());
+
+    for (int index = 0; index < 3; ++index)
+      TOY_LOG_INFO("frame {} took {:.3f} ms in {}", index, 16.5f + static_cast<float>(index), "update");
+
+    TOY_LOG_ERROR("pointer {} flag {} letter {}", static_cast<const void *>(nullptr), false, 'x');
+    toy::log::flush();
+  }
+
+  const auto data = readFile(path);
+
+  std::filesystem::remove(path);
+
+  REQUIRE_EQ(capture.messages.size(), 4);
+
+  SUBCASE("messages decode to the text the sinks saw") {
+    toy::log::BinaryLogReader reader(data.data(), data.size());
+    Message                   message{};
+    size_t                    index = 0;
+
+    REQUIRE(reader.isValid());
+
+    while (reader.next(message)) {
+      REQUIRE_LT(index, capture.messages.size());
+      CHECK_EQ(std::string(message.text), capture.messages[index].text);
+      CHECK_EQ(message.site->level, capture.messages[index].level);
+      CHECK_EQ(message.thread, capture.messages[index].thread);
+      ++index;
+    }
+
+    CHECK_EQ(index, 4);
+    CHECK_FALSE(reader.isDamaged());
+  }
+
+  SUBCASE("call sites are written once") {
+    const toy::string_view contents(reinterpret_cast<const char *>(data.data()), data.size());
+    const size_t           first = contents.find("frame {} took");
+
+    REQUIRE(first != toy::string_view::npos);
+    CHECK_EQ(contents.find("frame {} took", first + 1), toy::string_view::npos);
+  }
+
+  SUBCASE("truncated data stops with an error") {
+    toy::log::BinaryLogReader reader(data.data(), data.size() - 3);
+    Message                   message{};
+    size_t                    count = 0;
+
+    while (reader.next(message))
+      ++count;
+
+    CHECK_EQ(count, 3);
+    CHECK(reader.isDamaged());
+  }
+
+  SUBCASE("other data is not a binary log") {
+    const char                text[] = "plain text log line\n";
+    toy::log::BinaryLogReader reader(text, sizeof(text));
+    Message                   message{};
+
+    CHECK_FALSE(reader.isValid());
+    CHECK_FALSE(reader.next(message));
+  }
+}
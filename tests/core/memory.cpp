@@ -0,0 +1,276 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   memory.cpp
+  \brief  Unit tests for the tracked allocator, tag statistics, frame counts, and budgets.
+*/
+
+#include <doctest/doctest.h>
+
+#include <thread>
+
+#include "core.hpp"
+
+namespace {
+
+using TrackedHeap   = toy::TrackedAllocator<toy::HeapAllocator>;
+using TrackedArena  = toy::TrackedAllocator<toy::LinearAllocator>;
+using TagStatistics = toy::memory::TagStatistics;
+
+static_assert(toy::Allocator<TrackedHeap>);
+static_assert(toy::Allocator<TrackedArena>);
+
+#ifdef TOYGINE_MEMORY_TRACKING
+
+#ifdef _DEBUG
+size_t g_budgetReports = 0;
+
+bool countBudgetReport(const char * /*assertionString*/) noexcept {
+  ++g_budgetReports;
+
+  return true;
+}
+#endif // _DEBUG
+
+#endif // TOYGINE_MEMORY_TRACKING
+
+} // namespace
+
+TEST_CASE("core/memory/tag_names") {
+  CHECK_EQ(toy::memory::tagName(toy::MemoryTag::General), "general");
+  CHECK_EQ(toy::memory::tagName(toy::MemoryTag::Render), "render");
+  CHECK_EQ(toy::memory::tagName(toy::MemoryTag::Audio), "audio");
+  CHECK_EQ(toy::memory::tagName(toy::MemoryTag::Assets), "assets");
+  CHECK_EQ(toy::memory::tagName(toy::MemoryTag::Game), "game");
+}
+
+TEST_CASE("core/memory/tracked_allocator") {
+  toy::HeapAllocator heap;
+  TrackedHeap        tracked(heap, toy::MemoryTag::Game);
+
+  toy::memory::resetStatistics();
+
+  CHECK_EQ(&tracked.allocator(), &heap);
+  CHECK_EQ(tracked.tag(), toy::MemoryTag::Game);
+
+  void * first  = tracked.allocate(100);
+  void * second = tracked.allocate(50, 16);
+
+  REQUIRE(first != nullptr);
+  REQUIRE(second != nullptr);
+
+#ifdef TOYGINE_MEMORY_TRACKING
+  SUBCASE("live and peak bytes") {
+    TagStatistics game = toy::memory::statistics(toy::MemoryTag::Game);
+
+    CHECK_EQ(game.liveBytes, 150U);
+    CHECK_EQ(game.peakBytes, 150U);
+    CHECK_EQ(game.liveAllocations, 2U);
+
+    tracked.deallocate(first, 100);
+    first = nullptr;
+
+    game = toy::memory::statistics(toy::MemoryTag::Game);
+
+    CHECK_EQ(game.liveBytes, 50U);
+    CHECK_EQ(game.peakBytes, 150U);
+    CHECK_EQ(game.liveAllocations, 1U);
+  }
+
+  SUBCASE("other tags are not charged") {
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).liveBytes, 0U);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::General).liveAllocations, 0U);
+  }
+
+  SUBCASE("failed allocations are not charged") {
+    alignas(16) std::byte memory[64];
+    toy::LinearAllocator  arena(memory, sizeof(memory));
+    TrackedArena          trackedArena(arena, toy::MemoryTag::Assets);
+
+    CHECK_NE(trackedArena.allocate(48, 16), nullptr);
+    CHECK_EQ(trackedArena.allocate(32, 16), nullptr);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Assets).liveBytes, 48U);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Assets).liveAllocations, 1U);
+  }
+
+  SUBCASE("bulk arenas are charged by hand") {
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 4096);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).liveBytes, 4096U);
+
+    toy::memory::recordDeallocation(toy::MemoryTag::Render, 4096);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).liveBytes, 0U);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).peakBytes, 4096U);
+  }
+#else // TOYGINE_MEMORY_TRACKING
+  SUBCASE("nothing is counted") {
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Game).liveBytes, 0U);
+  }
+#endif // TOYGINE_MEMORY_TRACKING
+
+  tracked.deallocate(first, 100);
+  tracked.deallocate(second, 50, 16);
+  tracked.deallocate(nullptr, 8);
+
+  toy::memory::resetStatistics();
+}
+
+#ifdef TOYGINE_MEMORY_TRACKING
+
+TEST_CASE("core/memory/frames") {
+  toy::memory::resetStatistics();
+
+  SUBCASE("allocations are counted per frame") {
+    toy::memory::beginFrame();
+
+    for (size_t index = 0; index < 3; ++index)
+      toy::memory::recordAllocation(toy::MemoryTag::Audio, 8);
+
+    toy::memory::beginFrame();
+    toy::memory::recordAllocation(toy::MemoryTag::Audio, 8);
+    toy::memory::beginFrame();
+
+    const TagStatistics audio = toy::memory::statistics(toy::MemoryTag::Audio);
+
+    CHECK_EQ(toy::memory::frame(), 3U);
+    CHECK_EQ(audio.frameAllocations, 1U);
+    CHECK_EQ(audio.peakFrameAllocations, 3U);
+    CHECK_EQ(audio.liveAllocations, 4U);
+  }
+
+  SUBCASE("peaks are stamped with their frame") {
+    toy::memory::recordAllocation(toy::MemoryTag::Assets, 1000);
+    toy::memory::beginFrame();
+    toy::memory::beginFrame();
+    toy::memory::recordAllocation(toy::MemoryTag::Assets, 500);
+    toy::memory::beginFrame();
+    toy::memory::recordDeallocation(toy::MemoryTag::Assets, 1500);
+    toy::memory::recordAllocation(toy::MemoryTag::Assets, 100);
+
+    const TagStatistics assets = toy::memory::statistics(toy::MemoryTag::Assets);
+
+    CHECK_EQ(assets.peakBytes, 1500U);
+    CHECK_EQ(assets.peakFrame, 2U);
+    CHECK_EQ(assets.liveBytes, 100U);
+  }
+
+  SUBCASE("threads publish when they exit") {
+    std::thread worker([] { toy::memory::recordAllocation(toy::MemoryTag::Game, 24); });
+    worker.join();
+
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Game).liveBytes, 24U);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Game).liveAllocations, 1U);
+  }
+
+  SUBCASE("a reset clears the counters") {
+    toy::memory::recordAllocation(toy::MemoryTag::Game, 64);
+    toy::memory::beginFrame();
+    toy::memory::resetStatistics();
+
+    const TagStatistics game = toy::memory::statistics(toy::MemoryTag::Game);
+
+    CHECK_EQ(toy::memory::frame(), 0U);
+    CHECK_EQ(game.liveBytes, 0U);
+    CHECK_EQ(game.peakBytes, 0U);
+    CHECK_EQ(game.frameAllocations, 0U);
+  }
+
+  toy::memory::resetStatistics();
+}
+
+TEST_CASE("core/memory/budgets") {
+  toy::memory::resetStatistics();
+  toy::memory::setBudget(toy::MemoryTag::Render, 100);
+
+#ifdef _DEBUG
+  toy::assertion::initialize();
+  toy::assertion::setCallbacks(countBudgetReport, nullptr);
+  g_budgetReports = 0;
+#endif // _DEBUG
+
+  CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).budget, 100U);
+
+  SUBCASE("only the allocation that crosses the budget is an overrun") {
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 60);
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 40);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).budgetOverruns, 0U);
+
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 1);
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 10);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).budgetOverruns, 1U);
+
+    toy::memory::recordDeallocation(toy::MemoryTag::Render, 30);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).liveBytes, 81U);
+
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 30);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).budgetOverruns, 2U);
+
+#ifdef _DEBUG
+    CHECK_GE(g_budgetReports, 1U);
+#endif // _DEBUG
+  }
+
+#ifdef _DEBUG
+  SUBCASE("each tag backs off its own reports") {
+    toy::memory::setBudget(toy::MemoryTag::Audio, 100);
+    toy::memory::setBudget(toy::MemoryTag::Assets, 100);
+
+    // Overruns 1, 2, and 4 of a tag are reported; 3 is not
+    for (uint64_t overrun = 1; overrun <= 4; ++overrun) {
+      toy::memory::recordAllocation(toy::MemoryTag::Audio, 101);
+      CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Audio).budgetOverruns, overrun);
+
+      toy::memory::recordDeallocation(toy::MemoryTag::Audio, 101);
+      CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Audio).liveBytes, 0U);
+    }
+
+    CHECK_EQ(g_budgetReports, 3U);
+
+    // The first overrun of another tag is reported, whatever the count of the first
+    toy::memory::recordAllocation(toy::MemoryTag::Assets, 101);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Assets).budgetOverruns, 1U);
+    CHECK_EQ(g_budgetReports, 4U);
+
+    toy::memory::setBudget(toy::MemoryTag::Audio, 0);
+    toy::memory::setBudget(toy::MemoryTag::Assets, 0);
+  }
+#endif // _DEBUG
+
+  SUBCASE("other tags keep their own budget") {
+    toy::memory::recordAllocation(toy::MemoryTag::Game, 1000);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Game).budgetOverruns, 0U);
+  }
+
+  SUBCASE("a budget of zero removes it") {
+    toy::memory::setBudget(toy::MemoryTag::Render, 0);
+    toy::memory::recordAllocation(toy::MemoryTag::Render, 1000);
+
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).budget, 0U);
+    CHECK_EQ(toy::memory::statistics(toy::MemoryTag::Render).budgetOverruns, 0U);
+  }
+
+#ifdef _DEBUG
+  toy::assertion::deInitialize();
+#endif // _DEBUG
+
+  toy::memory::setBudget(toy::MemoryTag::Render, 0);
+  toy::memory::resetStatistics();
+}
+
+#endif // TOYGINE_MEMORY_TRACKING
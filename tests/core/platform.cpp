@@ -0,0 +1,148 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   platform.cpp
+  \brief  Unit tests for the CPU queries and kernel dispatch of toy::platform.
+*/
+
+#include <doctest/doctest.h>
+
+#include <cstdlib>
+
+#include "core.hpp"
+
+namespace {
+
+using toy::platform::CpuFeature;
+using toy::platform::SimdLevel;
+
+// Kernels that report the level they stand for
+int scalarKernel() noexcept {
+  return 0;
+}
+
+int vector128Kernel() noexcept {
+  return 1;
+}
+
+int avx2Kernel() noexcept {
+  return 2;
+}
+
+int levelIndex(SimdLevel level) noexcept {
+  return static_cast<int>(level);
+}
+
+} // namespace
+
+TEST_CASE("core/platform/cpu_info") {
+  const toy::platform::CpuInfo & info = toy::platform::cpuInfo();
+
+  SUBCASE("queried once") {
+    CHECK_EQ(&toy::platform::cpuInfo(), &info);
+  }
+
+  SUBCASE("topology") {
+    CHECK_GE(info.threadCount, 1U);
+    CHECK_GE(info.coreCount, 1U);
+    CHECK_LE(info.coreCount, info.threadCount);
+  }
+
+  SUBCASE("cache line size") {
+    CHECK(std::has_single_bit(info.cacheLineSize));
+    CHECK_GE(info.cacheLineSize, 16U);
+    CHECK_LE(info.cacheLineSize, 256U);
+  }
+
+  SUBCASE("features") {
+#if defined(__x86_64__) || defined(_M_X64)
+    CHECK(info.has(CpuFeature::Sse2));
+    CHECK_FALSE(info.has(CpuFeature::Neon));
+#elif defined(__aarch64__) || defined(_M_ARM64)
+    CHECK(info.has(CpuFeature::Neon));
+    CHECK_FALSE(info.has(CpuFeature::Sse2));
+#endif
+
+    // AVX-512 needs the operating system to save the same registers AVX2 does
+    if (info.has(CpuFeature::Avx512))
+      CHECK(info.has(CpuFeature::Avx2));
+  }
+}
+
+TEST_CASE("core/platform/simd_level") {
+  const SimdLevel level = toy::platform::simdLevel();
+
+  CHECK_EQ(level, toy::platform::cpuInfo().simdLevel);
+  CHECK_LE(level, toy::platform::c_highestSimdLevel);
+
+  SUBCASE("the CPU runs the level") {
+    const toy::platform::CpuInfo & info = toy::platform::cpuInfo();
+
+    if (level == SimdLevel::Avx2) {
+      CHECK(info.has(CpuFeature::Avx2));
+      CHECK(info.has(CpuFeature::Fma));
+      CHECK(info.has(CpuFeature::Bmi2));
+    }
+
+    if (level == SimdLevel::Vector128)
+      CHECK((info.has(CpuFeature::Sse2) || info.has(CpuFeature::Neon)));
+  }
+
+  SUBCASE("build flags or the environment fix it") {
+#ifdef TOYGINE_SIMD_DISPATCH
+    if (const char * cap = std::getenv("TOYGINE_SIMD_LEVEL"); cap != nullptr) {
+      for (const SimdLevel candidate : {SimdLevel::Scalar, SimdLevel::Vector128, SimdLevel::Avx2}) {
+        if (toy::platform::simdLevelName(candidate) == cap)
+          CHECK_LE(level, candidate);
+      }
+    }
+#else
+    CHECK_EQ(level, toy::platform::c_baselineSimdLevel);
+#endif
+  }
+
+  SUBCASE("names") {
+    CHECK_EQ(toy::platform::simdLevelName(SimdLevel::Scalar), "scalar");
+    CHECK_EQ(toy::platform::simdLevelName(SimdLevel::Vector128), "vector128");
+    CHECK_EQ(toy::platform::simdLevelName(SimdLevel::Avx2), "avx2");
+  }
+}
+
+TEST_CASE("core/platform/select_kernel") {
+  using Kernel = int() noexcept;
+
+  const int level = levelIndex(toy::platform::simdLevel());
+
+  SUBCASE("one kernel per level") {
+    Kernel * const kernel = toy::platform::selectKernel<Kernel, scalarKernel, vector128Kernel, avx2Kernel>();
+    Kernel * const again  = toy::platform::selectKernel<Kernel, scalarKernel, vector128Kernel, avx2Kernel>();
+
+    CHECK_EQ(kernel(), level);
+    CHECK_EQ(again, kernel);
+  }
+
+  SUBCASE("higher levels fall back to the last kernel") {
+    Kernel * const twoLevels = toy::platform::selectKernel<Kernel, scalarKernel, vector128Kernel>();
+    Kernel * const oneLevel  = toy::platform::selectKernel<Kernel, scalarKernel>();
+
+    CHECK_EQ(twoLevels(), level < 1 ? level : 1);
+    CHECK_EQ(oneLevel(), 0);
+  }
+}
@@ -0,0 +1,243 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   profiler.cpp
+  \brief  Unit tests for profiler zones, draining, Chrome trace export, and zone statistics.
+*/
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core.hpp"
+
+#ifdef TOYGINE_PROFILER
+
+namespace {
+
+using toy::profiler::ZoneRecord;
+
+// Empties every thread buffer, so a test only sees its own zones
+void discardZones() {
+  static ZoneRecord scratch[256];
+
+  while (toy::profiler::drainZones(scratch, 256) != 0) {
+  }
+}
+
+std::vector<ZoneRecord> drainAll() {
+  std::vector<ZoneRecord> records(toy::profiler::c_threadBufferSize * 2);
+
+  records.resize(toy::profiler::drainZones(records.data(), records.size()));
+
+  return records;
+}
+
+void appendText(const char * text, size_t size, void * context) noexcept {
+  static_cast<std::string *>(context)->append(text, size);
+}
+
+void innerWork() {
+  TOY_PROFILE_SCOPE("test/inner");
+}
+
+void outerWork() {
+  TOY_PROFILE_SCOPE("test/outer");
+  innerWork();
+  innerWork();
+}
+
+} // namespace
+
+TEST_CASE("core/profiler/zones") {
+  discardZones();
+
+  SUBCASE("nested zones are recorded in end order with their depths") {
+    outerWork();
+
+    const auto records = drainAll();
+
+    REQUIRE_EQ(records.size(), 3);
+    CHECK_EQ(toy::string_view(records[0].site->name), "test/inner");
+    CHECK_EQ(toy::string_view(records[1].site->name), "test/inner");
+    CHECK_EQ(toy::string_view(records[2].site->name), "test/outer");
+    CHECK_EQ(records[0].depth, 1);
+    CHECK_EQ(records[2].depth, 0);
+    CHECK_EQ(records[2].site->id, toy::StringId("test/outer"));
+    CHECK_LE(records[2].start, records[0].start);
+    CHECK_LE(records[0].end, records[1].start);
+    CHECK_LE(records[1].end, records[2].end);
+  }
+
+  SUBCASE("drain leaves what does not fit for the next call") {
+    outerWork();
+
+    ZoneRecord records[2];
+
+    CHECK_EQ(toy::profiler::drainZones(records, 2), 2);
+    CHECK_EQ(toy::profiler::drainZones(records, 2), 1);
+    CHECK_EQ(toy::string_view(records[0].site->name), "test/outer");
+    CHECK_EQ(toy::profiler::drainZones(records, 2), 0);
+  }
+
+  SUBCASE("a full buffer drops and counts new zones") {
+    const auto dropped = toy::profiler::droppedZones();
+
+    for (size_t index = 0; index < toy::profiler::c_threadBufferSize + 5; ++index)
+      innerWork();
+
+    CHECK_EQ(toy::profiler::droppedZones() - dropped, 5);
+    CHECK_EQ(drainAll().size(), toy::profiler::c_threadBufferSize);
+
+    innerWork();
+
+    CHECK_EQ(drainAll().size(), 1);
+  }
+
+  SUBCASE("zones of other threads carry their own thread index") {
+    std::thread worker([] {
+      toy::profiler::setThreadName("worker");
+      outerWork();
+    });
+    worker.join();
+    innerWork();
+
+    const auto records = drainAll();
+
+    REQUIRE_EQ(records.size(), 4);
+
+    size_t workerRecords = 0;
+
+    for (const auto & record : records)
+      workerRecords += record.thread != toy::profiler::t_threadBuffer->thread ? 1 : 0;
+
+    CHECK_EQ(workerRecords, 3);
+  }
+
+  SUBCASE("exited threads give their buffers to new ones") {
+    constexpr size_t c_threads = toy::profiler::c_maxThreads * 2;
+
+    size_t drained = 0;
+
+    for (size_t index = 0; index < c_threads; ++index) {
+      std::thread(innerWork).join();
+      drained += drainAll().size();
+    }
+
+    CHECK_EQ(drained, c_threads);
+  }
+
+  SUBCASE("records left by exited threads are not credited to the threads that take over their buffers") {
+    constexpr size_t c_threads = toy::profiler::c_maxThreads * 2;
+
+    const auto dropped = toy::profiler::droppedZones();
+
+    for (size_t index = 0; index < c_threads; ++index)
+      std::thread(innerWork).join();
+
+    const auto records = drainAll();
+
+    CHECK_EQ(records.size() + (toy::profiler::droppedZones() - dropped), c_threads);
+
+    for (size_t index = 1; index < records.size(); ++index) {
+      for (size_t other = 0; other < index; ++other)
+        CHECK_NE(records[index].thread, records[other].thread);
+    }
+  }
+}
+
+TEST_CASE("core/profiler/chrome_trace") {
+  static constexpr toy::profiler::ZoneSite quoted("say \"hi\"");
+
+  SUBCASE("events carry names, microsecond times, and thread indices") {
+    const ZoneRecord records[] = {
+      {&quoted, 1'234'567, 1'236'567, 3, 0},
+      {&quoted, 2'000'000, 2'000'042, 3, 1},
+    };
+    std::string              text;
+    toy::profiler::ChromeTraceWriter writer(appendText, &text);
+
+    writer.write(records, 2);
+    writer.finish();
+    writer.finish();
+
+    CHECK(text.starts_with("{\"displayTimeUnit\":\"ms\",\"traceEvents\":["));
+    CHECK_NE(text.find("{\"name\":\"say \\\"hi\\\"\",\"ph\":\"X\",\"pid\":1,\"tid\":3,\"ts\":1234.567,\"dur\":2.000}"),
+             std::string::npos);
+    CHECK_NE(text.find("\"ts\":2000.000,\"dur\":0.042}"), std::string::npos);
+    CHECK(text.ends_with("\n]}\n"));
+    CHECK_EQ(text.find("]}"), text.size() - 3);
+  }
+
+  SUBCASE("finish names the threads") {
+    toy::profiler::setThreadName("main");
+
+    std::string                      text;
+    toy::profiler::ChromeTraceWriter writer(appendText, &text);
+
+    writer.finish();
+
+    CHECK_NE(text.find("\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":"), std::string::npos);
+    CHECK_NE(text.find("\"args\":{\"name\":\"main\"}}"), std::string::npos);
+  }
+}
+
+TEST_CASE("core/profiler/statistics") {
+  static constexpr toy::profiler::ZoneSite outer("stats/outer");
+  static constexpr toy::profiler::ZoneSite inner("stats/inner");
+
+  // Two frames of outer { inner, inner } on thread 0, in end order
+  const ZoneRecord records[] = {
+    {&inner, 10, 30, 0, 1}, {&inner, 40, 45, 0, 1}, {&outer, 0, 100, 0, 0},
+    {&inner, 110, 170, 0, 1}, {&inner, 170, 180, 0, 1}, {&outer, 100, 200, 0, 0},
+  };
+  toy::profiler::ZoneStatistics statistics;
+
+  statistics.add(records, 6);
+
+  SUBCASE("calls, total, self, and maximum time") {
+    const auto * outerTotals = statistics.find(toy::StringId("stats/outer"));
+    const auto * innerTotals = statistics.find(toy::StringId("stats/inner"));
+
+    REQUIRE(outerTotals != nullptr);
+    REQUIRE(innerTotals != nullptr);
+    CHECK_EQ(toy::string_view(outerTotals->name), "stats/outer");
+    CHECK_EQ(outerTotals->calls, 2);
+    CHECK_EQ(outerTotals->totalTime, 200);
+    CHECK_EQ(outerTotals->selfTime, 105);
+    CHECK_EQ(outerTotals->maxTime, 100);
+    CHECK_EQ(innerTotals->calls, 4);
+    CHECK_EQ(innerTotals->totalTime, 95);
+    CHECK_EQ(innerTotals->selfTime, 95);
+    CHECK_EQ(innerTotals->maxTime, 60);
+    CHECK_EQ(statistics.zones().size(), 2);
+  }
+
+  SUBCASE("clear forgets every zone") {
+    statistics.clear();
+
+    CHECK(statistics.find(toy::StringId("stats/outer")) == nullptr);
+    CHECK(statistics.zones().empty());
+  }
+}
+
+#endif // TOYGINE_PROFILER
@@ -0,0 +1,226 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   slot_map.cpp
+  \brief  Unit tests for toy::SlotMap and toy::SlotHandle.
+*/
+
+#include <doctest/doctest.h>
+
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Counts live objects, so tests can see that erasure and destruction run exactly once
+struct Tracked {
+  static inline int live = 0;
+
+  explicit Tracked(int id) noexcept
+    : id(id) {
+    ++live;
+  }
+
+  Tracked(const Tracked & other) noexcept
+    : id(other.id) {
+    ++live;
+  }
+
+  Tracked(Tracked && other) noexcept
+    : id(other.id) {
+    ++live;
+  }
+
+  Tracked & operator=(const Tracked &) = default;
+
+  ~Tracked() noexcept {
+    --live;
+  }
+
+  int id;
+};
+
+static_assert(!toy::isTriviallyRelocatable<Tracked>);
+static_assert(sizeof(toy::SlotHandle<int>) == sizeof(uint32_t));
+
+#ifdef _DEBUG
+std::vector<std::string> g_reports;
+
+bool recordAssertion(const char * assertionString) noexcept {
+  g_reports.emplace_back(assertionString);
+
+  return true;
+}
+#endif // _DEBUG
+
+} // namespace
+
+TEST_CASE("core/slot_map/handle") {
+  constexpr toy::SlotHandle<int> handle(5, 3);
+
+  static_assert(handle.index() == 5);
+  static_assert(handle.generation() == 3);
+  static_assert(handle.value() == (3U << toy::c_slotIndexBits | 5U));
+  static_assert(!toy::SlotHandle<int>());
+
+  CHECK(handle);
+  CHECK_EQ(handle, toy::SlotHandle<int>(5, 3));
+  CHECK_NE(handle, toy::SlotHandle<int>(5, 4));
+}
+
+TEST_CASE("core/slot_map/pool") {
+  SUBCASE("insert, find, and erase") {
+    toy::SlotMap<std::string, 8> names;
+
+    const auto first  = names.insert("first");
+    const auto second = names.emplace(3, 'x');
+
+    CHECK_EQ(names.size(), 2U);
+    CHECK_EQ(names[first], "first");
+    CHECK_EQ(*names.find(second), "xxx");
+    CHECK(names.contains(second));
+
+    CHECK(names.erase(first));
+    CHECK_FALSE(names.erase(first));
+    CHECK_FALSE(names.contains(first));
+    CHECK_EQ(names.find(first), nullptr);
+    CHECK_EQ(names[second], "xxx");
+    CHECK_EQ(names.find(toy::SlotHandle<std::string>()), nullptr);
+  }
+
+  SUBCASE("reused slots reject stale handles") {
+    toy::SlotMap<int, 4> values;
+
+    const auto stale = values.insert(1);
+    values.erase(stale);
+
+    const auto fresh = values.insert(2);
+
+    CHECK_EQ(fresh.index(), stale.index());
+    CHECK_NE(fresh.generation(), stale.generation());
+    CHECK_EQ(values.find(stale), nullptr);
+    CHECK_EQ(values[fresh], 2);
+  }
+
+  SUBCASE("objects stay packed") {
+    toy::SlotMap<Tracked, 16>             pool;
+    std::vector<toy::SlotHandle<Tracked>> handles;
+
+    for (int id = 0; id < 10; ++id)
+      handles.push_back(pool.emplace(id));
+
+    pool.erase(handles[2]);
+    pool.erase(handles[7]);
+    pool.erase(handles[0]);
+
+    CHECK_EQ(pool.size(), 7U);
+    CHECK_EQ(Tracked::live, 7);
+    CHECK_EQ(pool.end() - pool.begin(), 7);
+
+    int sum = 0;
+
+    for (const Tracked & tracked : pool)
+      sum += tracked.id;
+
+    CHECK_EQ(sum, 45 - 2 - 7 - 0);
+
+    // Handles of moved objects still find them, and handleOf() maps positions back to handles
+    for (int id : {1, 3, 4, 5, 6, 8, 9})
+      CHECK_EQ(pool[handles[static_cast<size_t>(id)]].id, id);
+
+    for (auto position = pool.begin(); position != pool.end(); ++position)
+      CHECK_EQ(pool.handleOf(position), handles[static_cast<size_t>(position->id)]);
+  }
+
+  SUBCASE("full pool") {
+    toy::SlotMap<int, 3> values;
+
+    for (int value = 0; value < 3; ++value)
+      CHECK(values.insert(value));
+
+    CHECK(values.full());
+    CHECK_FALSE(values.insert(3));
+
+    values.erase(values.handleOf(values.begin()));
+
+    CHECK(values.insert(4));
+  }
+
+  SUBCASE("clear makes every handle stale") {
+    toy::SlotMap<Tracked, 8> pool;
+
+    const auto first  = pool.emplace(1);
+    const auto second = pool.emplace(2);
+
+    pool.clear();
+
+    CHECK(pool.empty());
+    CHECK_EQ(Tracked::live, 0);
+    CHECK_FALSE(pool.contains(first));
+    CHECK_FALSE(pool.contains(second));
+
+    const auto third = pool.emplace(3);
+
+    CHECK_FALSE(pool.contains(first));
+    CHECK_EQ(pool[third].id, 3);
+  }
+
+  SUBCASE("generations wrap without reaching 0") {
+    toy::SlotMap<int, 1> values;
+    auto                 handle = values.insert(0);
+
+    for (int round = 0; round < 5000; ++round) {
+      values.erase(handle);
+      handle = values.insert(round);
+
+      REQUIRE_NE(handle.generation(), 0U);
+    }
+
+    CHECK_EQ(values[handle], 4999);
+  }
+
+  CHECK_EQ(Tracked::live, 0);
+}
+
+#ifdef _DEBUG
+TEST_CASE("core/slot_map/stale_access") {
+  toy::assertion::initialize();
+  toy::assertion::setCallbacks(recordAssertion, nullptr);
+  g_reports.clear();
+
+  toy::SlotMap<int, 4> values;
+  const auto           handle = values.insert(7);
+
+  static_cast<void>(values[handle]);
+  CHECK(g_reports.empty());
+
+  values.erase(handle);
+  static_cast<void>(values.insert(8));
+  static_cast<void>(values[handle]);
+
+  REQUIRE_EQ(g_reports.size(), 1U);
+  CHECK_NE(g_reports[0].find("stale or null slot map handle"), std::string::npos);
+
+  toy::assertion::setCallbacks(nullptr, nullptr);
+  toy::assertion::deInitialize();
+}
+#endif // _DEBUG
@@ -0,0 +1,789 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   utils.cpp
+  \brief  Unit tests for the core string and UTF-8 utilities.
+*/
+
+#include <doctest/doctest.h>
+
+#include <charconv>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+// Builds a byte buffer from raw values so invalid sequences can be spelled out exactly
+std::string bytes(std::initializer_list<unsigned> values) {
+  std::string result;
+
+  for (const unsigned value : values)
+    result.push_back(static_cast<char>(value));
+
+  return result;
+}
+
+// Deterministic mix of ASCII runs and 2-, 3- and 4-byte sequences, long enough to cross many vector blocks
+std::string mixedText(size_t repeats) {
+  static constexpr std::string_view c_pieces[] = {
+    "plain ascii text that fills a whole block ",
+    "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82 ",
+    "\xE4\xBD\xA0\xE5\xA5\xBD",
+    "\xF0\x9F\x8E\xAE",
+    "x",
+    "0123456789abcdef0123456789abcdef",
+  };
+
+  std::string result;
+  uint32_t    state = 12345;
+
+  for (size_t index = 0; index < repeats; ++index) {
+    state = state * 1103515245U + 12345U;
+    result += c_pieces[(state >> 16) % std::size(c_pieces)];
+  }
+
+  return result;
+}
+
+// Runs both the public routine and its toy::scalar reference and checks they agree before returning the result
+size_t validLength(const std::string & text) {
+  const size_t length = toy::utf8ValidLength(text.data(), text.size());
+
+  CHECK_EQ(length, toy::scalar::utf8ValidLength(text.data(), text.size()));
+
+  return length;
+}
+
+std::u32string decode(const std::string & text, toy::TranscodeResult & result) {
+  std::u32string decoded(text.size(), U'\0');
+  std::u32string reference(text.size(), U'\0');
+
+  result = toy::utf8ToUtf32(text.data(), text.size(), decoded.data());
+
+  const toy::TranscodeResult scalarResult = toy::scalar::utf8ToUtf32(text.data(), text.size(), reference.data());
+
+  CHECK_EQ(result.read, scalarResult.read);
+  CHECK_EQ(result.written, scalarResult.written);
+
+  decoded.resize(result.written);
+  reference.resize(scalarResult.written);
+  CHECK(decoded == reference);
+
+  return decoded;
+}
+
+std::u16string toUtf16(const std::string & text, toy::TranscodeResult & result) {
+  std::u16string encoded(2 * text.size(), u'\0');
+  std::u16string reference(2 * text.size(), u'\0');
+
+  result = toy::utf8ToUtf16(text.data(), text.size(), encoded.data());
+
+  const toy::TranscodeResult scalarResult = toy::scalar::utf8ToUtf16(text.data(), text.size(), reference.data());
+
+  CHECK_EQ(result.read, scalarResult.read);
+  CHECK_EQ(result.written, scalarResult.written);
+
+  encoded.resize(result.written);
+  reference.resize(scalarResult.written);
+  CHECK(encoded == reference);
+
+  return encoded;
+}
+
+std::string fromUtf16(const std::u16string & text, toy::TranscodeResult & result) {
+  std::string encoded(3 * text.size(), '\0');
+  std::string reference(3 * text.size(), '\0');
+
+  result = toy::utf16ToUtf8(text.data(), text.size(), encoded.data());
+
+  const toy::TranscodeResult scalarResult = toy::scalar::utf16ToUtf8(text.data(), text.size(), reference.data());
+
+  CHECK_EQ(result.read, scalarResult.read);
+  CHECK_EQ(result.written, scalarResult.written);
+
+  encoded.resize(result.written);
+  reference.resize(scalarResult.written);
+  CHECK(encoded == reference);
+
+  return encoded;
+}
+
+std::string fromUtf32(const std::u32string & text, toy::TranscodeResult & result) {
+  std::string encoded(4 * text.size(), '\0');
+  std::string reference(4 * text.size(), '\0');
+
+  result = toy::utf32ToUtf8(text.data(), text.size(), encoded.data());
+
+  const toy::TranscodeResult scalarResult = toy::scalar::utf32ToUtf8(text.data(), text.size(), reference.data());
+
+  CHECK_EQ(result.read, scalarResult.read);
+  CHECK_EQ(result.written, scalarResult.written);
+
+  encoded.resize(result.written);
+  reference.resize(scalarResult.written);
+  CHECK(encoded == reference);
+
+  return encoded;
+}
+
+template <typename T>
+std::string toText(T value) {
+  char buffer[toy::c_maxIntegerChars];
+
+  return std::string(buffer, toy::toChars(buffer, value));
+}
+
+// Expected text of the shortest form, from std::to_chars
+template <typename T>
+std::string shortestOf(T value) {
+  char       buffer[64];
+  const auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+
+  return std::string(buffer, result.ptr);
+}
+
+template <typename T>
+std::string toText(T value, toy::FloatFormat format, int32_t precision) {
+  std::string text(toy::maxFloatChars(format, precision), '\0');
+
+  text.resize(static_cast<size_t>(toy::toChars(text.data(), value, format, precision) - text.data()));
+
+  return text;
+}
+
+// Expected text with a precision, from std::to_chars; a negative precision selects the std::to_chars default
+template <typename T>
+std::string precisionOf(T value, toy::FloatFormat format, int32_t precision) {
+  constexpr std::chars_format c_formats[] = {std::chars_format::scientific, std::chars_format::fixed,
+                                             std::chars_format::general, std::chars_format::hex};
+
+  const std::chars_format chars = c_formats[static_cast<size_t>(format)];
+  std::string             text(400, '\0');
+  const auto              result = precision < 0 ? std::to_chars(text.data(), text.data() + text.size(), value, chars)
+                                                 : std::to_chars(text.data(), text.data() + text.size(), value, chars,
+                                                                 precision);
+
+  text.resize(static_cast<size_t>(result.ptr - text.data()));
+
+  return text;
+}
+
+// Parses with toy::fromChars() and std::from_chars and checks that both agree on the value, the end, and the error
+template <typename T>
+void checkParse(const std::string & text) {
+  T expected{};
+  T value{};
+
+  const auto             reference = std::from_chars(text.data(), text.data() + text.size(), expected);
+  const toy::ParseResult result    = toy::fromChars(text.data(), text.data() + text.size(), value);
+
+  toy::ParseError error = toy::ParseError::None;
+
+  if (reference.ec == std::errc::invalid_argument)
+    error = toy::ParseError::InvalidArgument;
+  else if (reference.ec == std::errc::result_out_of_range)
+    error = toy::ParseError::OutOfRange;
+
+  CAPTURE(text);
+  CHECK_EQ(result.error, error);
+
+  if (error != toy::ParseError::InvalidArgument)
+    CHECK_EQ(result.end, reference.ptr);
+
+  CHECK_EQ(std::memcmp(&value, &expected, sizeof(T)), 0);
+}
+
+// Bit patterns spread over every binade, including subnormals; xorshift keeps the sequence reproducible
+uint64_t nextBits(uint64_t & state) {
+  state ^= state << 13;
+  state ^= state >> 7;
+  state ^= state << 17;
+
+  return state;
+}
+
+} // namespace
+
+TEST_CASE("core/utils/utf8ValidLength") {
+  SUBCASE("empty and ASCII input") {
+    CHECK_EQ(toy::utf8ValidLength(nullptr, 0), 0U);
+    CHECK(toy::isValidUtf8(nullptr, 0));
+    CHECK_EQ(validLength("hello"), 5U);
+    CHECK_EQ(validLength(std::string(1000, 'a')), 1000U);
+  }
+
+  SUBCASE("code point boundaries") {
+    CHECK_EQ(validLength(bytes({0x7F})), 1U);
+    CHECK_EQ(validLength(bytes({0xC2, 0x80})), 2U);
+    CHECK_EQ(validLength(bytes({0xDF, 0xBF})), 2U);
+    CHECK_EQ(validLength(bytes({0xE0, 0xA0, 0x80})), 3U);
+    CHECK_EQ(validLength(bytes({0xED, 0x9F, 0xBF})), 3U);
+    CHECK_EQ(validLength(bytes({0xEE, 0x80, 0x80})), 3U);
+    CHECK_EQ(validLength(bytes({0xEF, 0xBF, 0xBF})), 3U);
+    CHECK_EQ(validLength(bytes({0xF0, 0x90, 0x80, 0x80})), 4U);
+    CHECK_EQ(validLength(bytes({0xF4, 0x8F, 0xBF, 0xBF})), 4U);
+  }
+
+  SUBCASE("overlong forms") {
+    CHECK_EQ(validLength(bytes({0xC0, 0x80})), 0U);
+    CHECK_EQ(validLength(bytes({0xC1, 0xBF})), 0U);
+    CHECK_EQ(validLength(bytes({0xE0, 0x80, 0x80})), 0U);
+    CHECK_EQ(validLength(bytes({0xE0, 0x9F, 0xBF})), 0U);
+    CHECK_EQ(validLength(bytes({0xF0, 0x80, 0x80, 0x80})), 0U);
+    CHECK_EQ(validLength(bytes({0xF0, 0x8F, 0xBF, 0xBF})), 0U);
+  }
+
+  SUBCASE("surrogates and out-of-range code points") {
+    CHECK_EQ(validLength(bytes({0xED, 0xA0, 0x80})), 0U);
+    CHECK_EQ(validLength(bytes({0xED, 0xBF, 0xBF})), 0U);
+    CHECK_EQ(validLength(bytes({0xED, 0xA0, 0xBD, 0xED, 0xB2, 0xA9})), 0U);
+    CHECK_EQ(validLength(bytes({0xF4, 0x90, 0x80, 0x80})), 0U);
+    CHECK_EQ(validLength(bytes({0xF5, 0x80, 0x80, 0x80})), 0U);
+    CHECK_EQ(validLength(bytes({0xFF})), 0U);
+  }
+
+  SUBCASE("stray and missing continuation bytes") {
+    CHECK_EQ(validLength(bytes({'a', 0x80, 'b'})), 1U);
+    CHECK_EQ(validLength(bytes({'a', 0xBF})), 1U);
+    CHECK_EQ(validLength(bytes({0xC3, 'a'})), 0U);
+    CHECK_EQ(validLength(bytes({0xE2, 0x82, 'a'})), 0U);
+    CHECK_EQ(validLength(bytes({0xF0, 0x9F, 0x8E, 'a'})), 0U);
+  }
+
+  SUBCASE("sequences truncated by the end of the buffer") {
+    CHECK_EQ(validLength(bytes({'a', 'b', 0xC3})), 2U);
+    CHECK_EQ(validLength(bytes({'a', 0xE2, 0x82})), 1U);
+    CHECK_EQ(validLength(bytes({0xF0, 0x9F, 0x8E})), 0U);
+  }
+
+  SUBCASE("errors at every offset of long input") {
+    const std::string valid = mixedText(64);
+    REQUIRE_EQ(validLength(valid), valid.size());
+
+    // Inject a stray continuation byte after every sequence boundary and expect it to be reported exactly there
+    for (size_t offset = 0; offset < valid.size(); ++offset) {
+      if ((static_cast<unsigned char>(valid[offset]) & 0xC0U) == 0x80U)
+        continue;
+
+      std::string broken = valid;
+      broken.insert(offset, 1, '\x80');
+      CHECK_EQ(validLength(broken), offset);
+    }
+  }
+
+  SUBCASE("truncation of long input") {
+    const std::string valid = std::string(70, 'a') + "\xF0\x9F\x8E\xAE";
+
+    CHECK_EQ(validLength(valid.substr(0, valid.size() - 1)), 70U);
+    CHECK_EQ(validLength(valid.substr(0, valid.size() - 3)), 70U);
+    CHECK_EQ(validLength(valid), valid.size());
+  }
+}
+
+TEST_CASE("core/utils/utf8CodePointCount") {
+  CHECK_EQ(toy::utf8CodePointCount(nullptr, 0), 0U);
+  CHECK_EQ(toy::utf8CodePointCount("abc", 3), 3U);
+
+  const std::string cyrillic = "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82";
+  CHECK_EQ(toy::utf8CodePointCount(cyrillic.data(), cyrillic.size()), 6U);
+  CHECK_EQ(toy::scalar::utf8CodePointCount(cyrillic.data(), cyrillic.size()), 6U);
+
+  for (const size_t repeats : {1U, 7U, 64U, 500U}) {
+    const std::string text = mixedText(repeats);
+
+    toy::TranscodeResult result{};
+    const std::u32string decoded = decode(text, result);
+
+    CHECK_EQ(toy::utf8CodePointCount(text.data(), text.size()), decoded.size());
+    CHECK_EQ(toy::scalar::utf8CodePointCount(text.data(), text.size()), decoded.size());
+  }
+}
+
+TEST_CASE("core/utils/utf8ToUtf32") {
+  toy::TranscodeResult result{};
+
+  SUBCASE("valid input") {
+    const std::u32string decoded = decode("a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x8E\xAE", result);
+
+    CHECK_EQ(result.read, 10U);
+    CHECK(decoded == U"a\u00E9\u20AC\U0001F3AE");
+  }
+
+  SUBCASE("long ASCII runs around multi-byte sequences") {
+    const std::string    text  = std::string(40, 'x') + "\xE2\x82\xAC" + std::string(33, 'y');
+    const std::u32string check = std::u32string(40, U'x') + U"\u20AC" + std::u32string(33, U'y');
+
+    CHECK(decode(text, result) == check);
+    CHECK_EQ(result.read, text.size());
+  }
+
+  SUBCASE("stops at the first invalid sequence") {
+    const std::string text = std::string(35, 'z') + bytes({0xED, 0xA0, 0x80}) + "tail";
+
+    CHECK(decode(text, result) == std::u32string(35, U'z'));
+    CHECK_EQ(result.read, 35U);
+    CHECK_EQ(result.written, 35U);
+  }
+
+  SUBCASE("truncated final sequence") {
+    const std::string text = "ok" + bytes({0xF0, 0x9F});
+
+    CHECK(decode(text, result) == U"ok");
+    CHECK_EQ(result.read, 2U);
+  }
+}
+
+TEST_CASE("core/utils/utf8ToUtf16") {
+  toy::TranscodeResult result{};
+
+  SUBCASE("valid input with a surrogate pair") {
+    const std::string text = "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x8E\xAE";
+
+    CHECK(toUtf16(text, result) == u"a\u00E9\u20AC\U0001F3AE");
+    CHECK_EQ(result.read, text.size());
+    CHECK_EQ(result.written, 5U);
+    CHECK_EQ(toy::utf16LengthFromUtf8(text.data(), text.size()), 5U);
+    CHECK_EQ(toy::scalar::utf16LengthFromUtf8(text.data(), text.size()), 5U);
+  }
+
+  SUBCASE("predicted length matches long mixed input") {
+    for (const size_t repeats : {1U, 7U, 64U, 500U}) {
+      const std::string    text    = mixedText(repeats);
+      const std::u16string encoded = toUtf16(text, result);
+
+      CHECK_EQ(result.read, text.size());
+      CHECK_EQ(toy::utf16LengthFromUtf8(text.data(), text.size()), encoded.size());
+      CHECK_EQ(toy::scalar::utf16LengthFromUtf8(text.data(), text.size()), encoded.size());
+    }
+  }
+
+  SUBCASE("stops at the first invalid sequence") {
+    const std::string text = std::string(40, 'q') + "\xF0\x9F\x8E\xAE" + bytes({0xC0, 0xAF}) + "tail";
+
+    CHECK(toUtf16(text, result) == std::u16string(40, u'q') + u"\U0001F3AE");
+    CHECK_EQ(result.read, 44U);
+    CHECK_EQ(result.written, 42U);
+  }
+}
+
+TEST_CASE("core/utils/utf16ToUtf8") {
+  toy::TranscodeResult result{};
+
+  SUBCASE("valid input") {
+    const std::u16string text = u"a\u00E9\u20AC\U0001F3AE";
+
+    CHECK_EQ(fromUtf16(text, result), "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x8E\xAE");
+    CHECK_EQ(result.read, text.size());
+    CHECK_EQ(toy::utf8LengthFromUtf16(text.data(), text.size()), 10U);
+    CHECK_EQ(toy::scalar::utf8LengthFromUtf16(text.data(), text.size()), 10U);
+  }
+
+  SUBCASE("round trip of long mixed input") {
+    for (const size_t repeats : {1U, 7U, 64U, 500U}) {
+      const std::string    text    = mixedText(repeats);
+      const std::u16string encoded = toUtf16(text, result);
+
+      CHECK_EQ(toy::utf8LengthFromUtf16(encoded.data(), encoded.size()), text.size());
+      CHECK_EQ(toy::scalar::utf8LengthFromUtf16(encoded.data(), encoded.size()), text.size());
+      CHECK_EQ(fromUtf16(encoded, result), text);
+      CHECK_EQ(result.read, encoded.size());
+    }
+  }
+
+  SUBCASE("surrogate pair at every offset of a vector block") {
+    for (size_t offset = 0; offset < 70; ++offset) {
+      const std::u16string text = std::u16string(offset, u'x') + u"\U0001F3AE" + std::u16string(40, u'y');
+
+      CHECK_EQ(fromUtf16(text, result), std::string(offset, 'x') + "\xF0\x9F\x8E\xAE" + std::string(40, 'y'));
+      CHECK_EQ(toy::utf8LengthFromUtf16(text.data(), text.size()), offset + 44);
+    }
+  }
+
+  SUBCASE("stops at an unpaired surrogate") {
+    const std::u16string low      = std::u16string(35, u'z') + u'\xDC00' + u"tail";
+    const std::u16string high     = std::u16string(35, u'z') + u'\xD83C' + u"tail";
+    const std::u16string reversed = std::u16string(35, u'z') + u'\xDF2E' + u'\xD83C';
+    const std::u16string last     = std::u16string(35, u'z') + u'\xD83C';
+
+    for (const std::u16string & text : {low, high, reversed, last}) {
+      CHECK_EQ(fromUtf16(text, result), std::string(35, 'z'));
+      CHECK_EQ(result.read, 35U);
+      CHECK_EQ(result.written, 35U);
+    }
+  }
+}
+
+TEST_CASE("core/utils/utf32ToUtf8") {
+  toy::TranscodeResult result{};
+
+  SUBCASE("code point boundaries") {
+    const std::u32string text  = U"\u007F\u0080\u07FF\u0800\uFFFF\U00010000\U0010FFFF";
+    const std::string    check = bytes({0x7F, 0xC2, 0x80, 0xDF, 0xBF, 0xE0, 0xA0, 0x80, 0xEF, 0xBF, 0xBF, 0xF0, 0x90,
+                                        0x80, 0x80, 0xF4, 0x8F, 0xBF, 0xBF});
+
+    CHECK_EQ(fromUtf32(text, result), check);
+    CHECK_EQ(result.read, text.size());
+    CHECK_EQ(toy::utf8LengthFromUtf32(text.data(), text.size()), check.size());
+    CHECK_EQ(toy::scalar::utf8LengthFromUtf32(text.data(), text.size()), check.size());
+  }
+
+  SUBCASE("round trip of long mixed input") {
+    for (const size_t repeats : {1U, 7U, 64U, 500U}) {
+      const std::string    text    = mixedText(repeats);
+      const std::u32string decoded = decode(text, result);
+
+      CHECK_EQ(toy::utf8LengthFromUtf32(decoded.data(), decoded.size()), text.size());
+      CHECK_EQ(toy::scalar::utf8LengthFromUtf32(decoded.data(), decoded.size()), text.size());
+      CHECK_EQ(fromUtf32(decoded, result), text);
+      CHECK_EQ(result.read, decoded.size());
+    }
+  }
+
+  SUBCASE("stops at surrogates and out-of-range values") {
+    for (const char32_t invalid : {char32_t{0xD800}, char32_t{0xDFFF}, char32_t{0x110000}, char32_t{0xFFFFFFFF}}) {
+      const std::u32string text = std::u32string(37, U'w') + invalid + U"tail";
+
+      CHECK_EQ(fromUtf32(text, result), std::string(37, 'w'));
+      CHECK_EQ(result.read, 37U);
+      CHECK_EQ(result.written, 37U);
+    }
+  }
+}
+
+TEST_CASE("core/utils/compareChars") {
+  CHECK_EQ(toy::compareChars(nullptr, nullptr, 0), 0);
+  CHECK_EQ(toy::scalar::compareChars(nullptr, nullptr, 0), 0);
+
+  const std::string base = mixedText(8);
+
+  // A single differing byte at every offset, in either direction, seen by block, word and byte-wise comparisons alike
+  for (size_t offset = 0; offset < base.size(); ++offset) {
+    std::string higher = base;
+    higher[offset]     = static_cast<char>(static_cast<unsigned char>(base[offset]) + 1);
+
+    const int expected = static_cast<unsigned char>(base[offset]) == 0xFF ? 1 : -1;
+
+    CHECK_EQ(toy::compareChars(base.data(), base.data(), base.size()), 0);
+    CHECK_EQ(toy::compareChars(base.data(), higher.data(), base.size()) < 0, expected < 0);
+    CHECK_EQ(toy::compareChars(higher.data(), base.data(), base.size()) > 0, expected < 0);
+    CHECK_EQ(toy::scalar::compareChars(base.data(), higher.data(), base.size()) < 0, expected < 0);
+    CHECK_EQ(toy::compareChars(base.data(), higher.data(), offset), 0);
+  }
+
+  CHECK_GT(toy::compareChars("\x80", "\x7F", 1), 0);
+  CHECK_GT(toy::scalar::compareChars("\x80", "\x7F", 1), 0);
+}
+
+TEST_CASE("core/utils/findChar") {
+  CHECK_EQ(toy::findChar(nullptr, 0, 'a'), nullptr);
+  CHECK_EQ(toy::scalar::findChar(nullptr, 0, 'a'), nullptr);
+
+  for (size_t size = 1; size < 80; ++size) {
+    for (size_t offset = 0; offset < size; ++offset) {
+      std::string text(size, '.');
+      text[offset] = '\xE9';
+
+      if (offset + 1 < size)
+        text[size - 1] = '\xE9';
+
+      CHECK_EQ(toy::findChar(text.data(), text.size(), '\xE9'), text.data() + offset);
+      CHECK_EQ(toy::scalar::findChar(text.data(), text.size(), '\xE9'), text.data() + offset);
+    }
+
+    const std::string text(size, '.');
+    CHECK_EQ(toy::findChar(text.data(), text.size(), '\0'), nullptr);
+    CHECK_EQ(toy::scalar::findChar(text.data(), text.size(), '\0'), nullptr);
+  }
+}
+
+TEST_CASE("core/utils/findSubstring") {
+  const std::string text = mixedText(40);
+
+  for (const size_t patternSize : {1U, 2U, 3U, 7U, 16U, 33U}) {
+    for (size_t start = 0; start + patternSize <= text.size(); start += 13) {
+      const std::string pattern = text.substr(start, patternSize);
+      const size_t      first   = text.find(pattern);
+
+      CAPTURE(start);
+      CHECK_EQ(toy::findSubstring(text.data(), text.size(), pattern.data(), pattern.size()), text.data() + first);
+      CHECK_EQ(toy::scalar::findSubstring(text.data(), text.size(), pattern.data(), pattern.size()),
+               text.data() + first);
+    }
+  }
+
+  SUBCASE("near misses and edge cases") {
+    const std::string haystack = std::string(100, 'a') + "ab";
+
+    CHECK_EQ(toy::findSubstring(haystack.data(), haystack.size(), "aab", 3), haystack.data() + 99);
+    CHECK_EQ(toy::findSubstring(haystack.data(), haystack.size(), "aac", 3), nullptr);
+    CHECK_EQ(toy::scalar::findSubstring(haystack.data(), haystack.size(), "aac", 3), nullptr);
+    CHECK_EQ(toy::findSubstring(haystack.data(), haystack.size(), "", 0), haystack.data());
+    CHECK_EQ(toy::findSubstring("ab", 2, "abc", 3), nullptr);
+    CHECK_EQ(toy::scalar::findSubstring("ab", 2, "abc", 3), nullptr);
+  }
+}
+
+TEST_CASE("core/utils/toChars integers") {
+  CHECK_EQ(toText(0), "0");
+  CHECK_EQ(toText(-1), "-1");
+  CHECK_EQ(toText(std::numeric_limits<int64_t>::min()), "-9223372036854775808");
+  CHECK_EQ(toText(std::numeric_limits<uint64_t>::max()), "18446744073709551615");
+  CHECK_EQ(toText(std::numeric_limits<int8_t>::min()), "-128");
+  CHECK_EQ(toText(static_cast<uint16_t>(65535)), "65535");
+
+  uint64_t state = 0x9E3779B97F4A7C15U;
+
+  // Every digit count, and every base against std::to_chars
+  for (int32_t shift = 0; shift < 64; ++shift) {
+    const uint64_t value   = nextBits(state) >> shift;
+    const auto     negated = static_cast<int64_t>(value) * (shift % 2 == 0 ? 1 : -1);
+
+    for (int32_t base = 2; base <= 36; ++base) {
+      char buffer[toy::c_maxIntegerChars];
+      char expected[toy::c_maxIntegerChars];
+
+      CAPTURE(value);
+      CAPTURE(base);
+
+      char * end       = toy::toChars(buffer, value, base);
+      auto   reference = std::to_chars(expected, expected + sizeof(expected), value, base);
+      CHECK_EQ(std::string(buffer, end), std::string(expected, reference.ptr));
+
+      end       = toy::toChars(buffer, negated, base);
+      reference = std::to_chars(expected, expected + sizeof(expected), negated, base);
+      CHECK_EQ(std::string(buffer, end), std::string(expected, reference.ptr));
+    }
+  }
+
+  // Digit count boundaries
+  for (uint64_t power = 1; power < 10000000000000000000U; power *= 10) {
+    CHECK_EQ(toText(power), std::to_string(power));
+    CHECK_EQ(toText(power - 1), std::to_string(power - 1));
+  }
+}
+
+TEST_CASE("core/utils/toChars shortest") {
+  CHECK_EQ(toText(0.0), "0");
+  CHECK_EQ(toText(-0.0), "-0");
+  CHECK_EQ(toText(0.1), "0.1");
+  CHECK_EQ(toText(0.3F), "0.3");
+  CHECK_EQ(toText(1e21), "1e+21");
+  CHECK_EQ(toText(123456.0), "123456");
+  CHECK_EQ(toText(5e-324), "5e-324");
+  CHECK_EQ(toText(-std::numeric_limits<double>::min()), "-2.2250738585072014e-308");
+  CHECK_EQ(toText(std::numeric_limits<double>::max()), "1.7976931348623157e+308");
+  CHECK_EQ(toText(std::numeric_limits<float>::denorm_min()), "1e-45");
+  CHECK_EQ(toText(std::numeric_limits<double>::infinity()), "inf");
+  CHECK_EQ(toText(-std::numeric_limits<float>::infinity()), "-inf");
+  CHECK_EQ(toText(std::numeric_limits<double>::quiet_NaN()), "nan");
+
+  // Fixed notation of integers past the shortest digits spells out the exact value
+  CHECK_EQ(toText(190944592.0F), "190944592");
+
+  uint64_t state = 0x2545F4914F6CDD1DU;
+
+  for (int32_t index = 0; index < 100000; ++index) {
+    const uint64_t bits = nextBits(state);
+
+    double value = 0.0;
+    float  small = 0.0F;
+
+    std::memcpy(&value, &bits, sizeof(value));
+    std::memcpy(&small, &bits, sizeof(small));
+
+    if (value == value)
+      CHECK_EQ(toText(value), shortestOf(value));
+
+    if (small == small)
+      CHECK_EQ(toText(small), shortestOf(small));
+  }
+
+  // A stride through every float bit pattern: the shortest text reads back as the same value
+  for (uint64_t bits = 0; bits < 0x100000000U; bits += 4099) {
+    float value = 0.0F;
+    float back  = 0.0F;
+
+    const auto pattern = static_cast<uint32_t>(bits);
+    std::memcpy(&value, &pattern, sizeof(value));
+
+    if (value != value)
+      continue;
+
+    char         buffer[toy::c_maxShortestFloatChars];
+    const char * end = toy::toChars(buffer, value);
+
+    CHECK_EQ(std::string(buffer, static_cast<size_t>(end - buffer)), shortestOf(value));
+    CHECK_EQ(toy::fromChars(buffer, end, back).end, end);
+    CHECK_EQ(std::memcmp(&back, &value, sizeof(value)), 0);
+  }
+}
+
+TEST_CASE("core/utils/toChars precision") {
+  using toy::FloatFormat;
+
+  CHECK_EQ(toText(2.5, FloatFormat::Fixed, 0), "2");
+  CHECK_EQ(toText(3.5, FloatFormat::Fixed, 0), "4");
+  CHECK_EQ(toText(9.96, FloatFormat::Fixed, 1), "10.0");
+  CHECK_EQ(toText(0.0, FloatFormat::Scientific, 3), "0.000e+00");
+  CHECK_EQ(toText(1e-300, FloatFormat::Scientific, -1), "1.000000e-300");
+  CHECK_EQ(toText(0.0001234, FloatFormat::General, 3), "0.000123");
+  CHECK_EQ(toText(123456789.0, FloatFormat::General, 4), "1.235e+08");
+  CHECK_EQ(toText(1.0, FloatFormat::Hex, -1), "1p+0");
+  CHECK_EQ(toText(-0.1F, FloatFormat::Hex, -1), "-1.99999ap-4");
+  CHECK_EQ(toText(std::numeric_limits<double>::max(), FloatFormat::Fixed, 2).size(), 309U + 3U);
+
+  constexpr FloatFormat c_formats[]    = {FloatFormat::Scientific, FloatFormat::Fixed, FloatFormat::General,
+                                          FloatFormat::Hex};
+  constexpr int32_t     c_precisions[] = {-1, 0, 1, 2, 3, 6, 9, 13, 17, 25, 64};
+
+  const double c_values[] = {0.5, 1.5, 2.5, 0.125, 1e23, 9.999999999999999e22, 5e-324, 2.2250738585072014e-308,
+                             1.7976931348623157e308, 0.1, 1.0 / 3.0, 123.456, 9.5, 0.00095, 1e-5, 999999.5};
+
+  uint64_t            state = 0xD1B54A32D192ED03U;
+  std::vector<double> values(std::begin(c_values), std::end(c_values));
+
+  for (int32_t index = 0; index < 2000; ++index) {
+    const uint64_t bits = nextBits(state);
+
+    double value = 0.0;
+    std::memcpy(&value, &bits, sizeof(value));
+
+    if (value == value)
+      values.push_back(value);
+  }
+
+  for (const double value : values) {
+    for (const FloatFormat format : c_formats) {
+      for (const int32_t precision : c_precisions) {
+        if (precision < 0 && format != FloatFormat::Hex)
+          continue;
+
+        CAPTURE(value);
+        CAPTURE(precision);
+        CHECK_EQ(toText(value, format, precision), precisionOf(value, format, precision));
+        CHECK_EQ(toText(static_cast<float>(value), format, precision),
+                 precisionOf(static_cast<float>(value), format, precision));
+      }
+    }
+  }
+}
+
+TEST_CASE("core/utils/toChars constexpr") {
+  constexpr auto shortest = [](auto value) {
+    toy::FixedString<32> text;
+
+    text.resize_and_overwrite(text.capacity(), [value](char * data, size_t) {
+      return static_cast<size_t>(toy::toChars(data, value) - data);
+    });
+
+    return text;
+  };
+
+  static_assert(shortest(-1234567890123LL) == "-1234567890123");
+  static_assert(shortest(0.1) == "0.1");
+  static_assert(shortest(1.5e-300) == "1.5e-300");
+  static_assert(shortest(3.4028235e38F) == "3.4028235e+38");
+
+  constexpr auto parsed = [](toy::string_view text) {
+    double value = 0.0;
+    toy::fromChars(text.data(), text.data() + text.size(), value);
+
+    return value;
+  };
+
+  static_assert(parsed("0.1") == 0.1);
+  static_assert(parsed("-2.5e-3") == -2.5e-3);
+  static_assert(parsed("1.7976931348623157e308") == 1.7976931348623157e308);
+}
+
+TEST_CASE("core/utils/fromChars integers") {
+  for (const char * text :
+       {"0", "-0", "007", "-128", "127", "128", "-129", "255", "256", "18446744073709551615", "18446744073709551616",
+        "99999999999999999999", "000000000000000000000018446744073709551615", "-9223372036854775808",
+        "-9223372036854775809", "9223372036854775807", "12345678x9", "", "-", "+1", " 1", "abc"}) {
+    checkParse<int8_t>(text);
+    checkParse<uint8_t>(text);
+    checkParse<int32_t>(text);
+    checkParse<uint32_t>(text);
+    checkParse<int64_t>(text);
+    checkParse<uint64_t>(text);
+  }
+
+  uint64_t state = 0x94D049BB133111EBU;
+
+  for (int32_t index = 0; index < 10000; ++index) {
+    const uint64_t value = nextBits(state) >> (index % 64);
+
+    checkParse<uint64_t>(std::to_string(value));
+    checkParse<int64_t>(std::to_string(-static_cast<int64_t>(value >> 1)));
+  }
+}
+
+TEST_CASE("core/utils/fromChars floats") {
+  for (const char * text :
+       {"0", "-0", "1", ".5", "5.", ".", "1e", "1e+", "1.5e-3x", "1E5", "0x10", "+1", "-", "", "inf", "-Infinity",
+        "infinit", "nan", "-NaN", "nan(abc_12)", "nan(", "1e400", "-1e400", "1e-400", "2.4703282292062327e-324",
+        "2.4703282292062328e-324", "1.7976931348623158e308", "1.7976931348623159e308", "3.4028235677973366e38",
+        "7.1e-46", "9007199254740993", "9007199254740993.0000000000000000000001", "123456789012345678901234567890",
+        "0.000000000000000000000000000000000000000000001e45", "1234567890123456789.01234", "1e999999999999"}) {
+    checkParse<double>(text);
+    checkParse<float>(text);
+  }
+
+  // The smallest double halfway point, spelled out exactly, then nudged by one unit of the last of 770 digits
+  const std::string halfway =
+    "2.4703282292062327208828439643411068618252990130716238221279284125033775363510437593264991818081799618989828234772"
+    "285886546332835517796989819938739800539093906315035659515570226392290858392449105184435931802849936536152500319370"
+    "457678249219365623669863658480757001585769269903706311928279558551332927834338409351978015531246597263579574622766"
+    "465272827220056374006485499977096599470454020828166226237857393450736339007967761930577506740176324673600968951340"
+    "535537458516661134223766678604162159680461914467291840300530057530849048765391711386591646239524912623653881879636"
+    "239373280423891018672348497668235089863388587925628302755995657524455507255189313690836254779186948667994968324049"
+    "705821028513185451396213837722826145437693412532098591327667236328125";
+
+  checkParse<double>(halfway + "e-324");
+  checkParse<double>(halfway + "0000000000001e-324");
+
+  // Midpoints between neighbouring floats, and the doubles next to them, are exact doubles with long expansions
+  uint64_t state = 0xBF58476D1CE4E5B9U;
+
+  for (int32_t index = 0; index < 2000; ++index) {
+    const auto pattern = static_cast<uint32_t>(nextBits(state) & 0x7F7FFFFFU);
+
+    float value = 0.0F;
+    std::memcpy(&value, &pattern, sizeof(value));
+
+    const float  next     = std::nextafter(value, std::numeric_limits<float>::infinity());
+    const double midpoint = (static_cast<double>(value) + static_cast<double>(next)) / 2.0;
+
+    for (const double exact : {midpoint, std::nextafter(midpoint, 0.0), std::nextafter(midpoint, 1e300)}) {
+      const std::string text = precisionOf(exact, toy::FloatFormat::Scientific, 780);
+
+      checkParse<float>(text);
+      checkParse<double>(text);
+    }
+
+    checkParse<float>(shortestOf(value));
+  }
+}
@@ -0,0 +1,307 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   async_io.cpp
+  \brief  Unit tests for asynchronous reads on both backends: batches, callbacks, registered buffers, and failures.
+*/
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+namespace async = toy::filesystem::async;
+
+constexpr size_t c_fileSize  = 1 << 20;
+constexpr size_t c_chunkSize = 4096;
+
+// Byte at \a offset of the test file
+std::byte patternAt(size_t offset) noexcept {
+  return static_cast<std::byte>((offset * 7 + offset / 251) & 0xFF);
+}
+
+// Temporary file of c_fileSize pattern bytes, removed with the object
+class PatternFile {
+public:
+  PatternFile()
+    : _path(std::filesystem::temp_directory_path() / "toygine_async_io.bin") {
+    std::vector<std::byte> contents(c_fileSize);
+
+    for (size_t offset = 0; offset < contents.size(); ++offset)
+      contents[offset] = patternAt(offset);
+
+    std::ofstream stream(_path, std::ios::binary);
+
+    stream.write(reinterpret_cast<const char *>(contents.data()), static_cast<std::streamsize>(contents.size()));
+  }
+
+  ~PatternFile() {
+    std::filesystem::remove(_path);
+  }
+
+  PatternFile(const PatternFile &)             = delete;
+  PatternFile & operator=(const PatternFile &) = delete;
+
+  std::string path() const {
+    return _path.string();
+  }
+
+private:
+  std::filesystem::path _path;
+};
+
+bool matches(std::span<const std::byte> data, size_t offset) noexcept {
+  for (size_t index = 0; index < data.size(); ++index) {
+    if (data[index] != patternAt(offset + index))
+      return false;
+  }
+
+  return true;
+}
+
+// Starts a backend for one test and stops it after
+class ScopedBackend {
+public:
+  explicit ScopedBackend(async::Backend preferred) noexcept {
+    async::initialize(preferred);
+  }
+
+  ~ScopedBackend() {
+    async::deInitialize();
+  }
+
+  ScopedBackend(const ScopedBackend &)             = delete;
+  ScopedBackend & operator=(const ScopedBackend &) = delete;
+};
+
+// Runs the shared checks on the backend in use
+void checkBackend(const std::string & path) {
+  const async::File file(path.c_str());
+
+  REQUIRE(file.isOpen());
+  REQUIRE(file.size() == c_fileSize);
+
+  SUBCASE("batch with callbacks") {
+    constexpr size_t c_readCount = 64;
+
+    std::vector<std::byte>      buffer(c_readCount * c_chunkSize);
+    std::vector<async::Request> requests(c_readCount);
+    size_t                      calls = 0;
+
+    const async::Callback count = [](async::Request &, void * context) noexcept { ++*static_cast<size_t *>(context); };
+
+    // Read the chunks in reverse, each into its own part of the buffer
+    for (size_t index = 0; index < c_readCount; ++index) {
+      const size_t offset = (c_readCount - 1 - index) * c_chunkSize * 3;
+
+      requests[index] = {&file, offset, std::span(buffer).subspan(index * c_chunkSize, c_chunkSize), count, &calls};
+    }
+
+    REQUIRE(async::submit(requests) == c_readCount);
+    CHECK(async::pending() == c_readCount);
+
+    async::waitAll();
+
+    CHECK(async::pending() == 0);
+    CHECK(calls == c_readCount);
+
+    for (const async::Request & request : requests) {
+      CHECK(request.status == async::Status::Done);
+      CHECK(request.bytesRead == c_chunkSize);
+      CHECK(matches(request.buffer, request.offset));
+    }
+  }
+
+  SUBCASE("polling a request") {
+    std::vector<std::byte> buffer(c_chunkSize);
+    async::Request         request{&file, 12345, buffer};
+
+    REQUIRE(async::submit({&request, 1}) == 1);
+
+    while (!request.isFinished())
+      async::poll();
+
+    CHECK(request.status == async::Status::Done);
+    CHECK(matches(buffer, 12345));
+  }
+
+  SUBCASE("end of file") {
+    std::vector<std::byte> buffer(c_chunkSize);
+    async::Request         tail{&file, c_fileSize - 100, buffer};
+    async::Request         past{&file, c_fileSize + 100, buffer};
+
+    REQUIRE(async::submit({&tail, 1}) == 1);
+    async::wait(tail);
+    CHECK(tail.status == async::Status::Done);
+    CHECK(tail.bytesRead == 100);
+    CHECK(matches(std::span(buffer).first(100), c_fileSize - 100));
+
+    REQUIRE(async::submit({&past, 1}) == 1);
+    async::wait(past);
+    CHECK(past.status == async::Status::Done);
+    CHECK(past.bytesRead == 0);
+  }
+
+  SUBCASE("closed file") {
+    const async::File      closed;
+    std::vector<std::byte> buffer(16);
+    async::Request         request{&closed, 0, buffer};
+
+    REQUIRE(async::submit({&request, 1}) == 1);
+    async::wait(request);
+
+    CHECK(request.status == async::Status::Failed);
+    CHECK(request.bytesRead == 0);
+  }
+
+  SUBCASE("full queue") {
+    std::vector<std::byte>      buffer(16);
+    std::vector<async::Request> requests(async::c_maxReads + 8, async::Request{&file, 0, buffer});
+
+    CHECK(async::submit(requests) == async::c_maxReads);
+    CHECK(requests.back().status == async::Status::Idle);
+
+    async::waitAll();
+
+    CHECK(async::submit(std::span(requests).last(8)) == 8);
+
+    async::waitAll();
+
+    for (const async::Request & request : requests)
+      CHECK(request.status == async::Status::Done);
+  }
+
+  SUBCASE("callback submits the next read") {
+    struct Stream {
+      std::vector<std::byte> buffer = std::vector<std::byte>(c_chunkSize);
+      async::Request         request;
+      size_t                 chunks = 0;
+      bool                   intact = true;
+    };
+
+    Stream stream;
+
+    const async::Callback next = [](async::Request & request, void * context) noexcept {
+      auto & state = *static_cast<Stream *>(context);
+
+      state.intact = state.intact && request.status == async::Status::Done && matches(request.buffer, request.offset);
+
+      if (++state.chunks < 16) {
+        request.offset += c_chunkSize;
+        async::submit({&request, 1});
+      }
+    };
+
+    stream.request = {&file, 0, stream.buffer, next, &stream};
+
+    REQUIRE(async::submit({&stream.request, 1}) == 1);
+
+    async::waitAll();
+
+    CHECK(stream.chunks == 16);
+    CHECK(stream.intact);
+  }
+}
+
+} // namespace
+
+TEST_CASE("filesystem/async_io/file") {
+  const PatternFile pattern;
+
+  SUBCASE("open and move") {
+    async::File file(pattern.path().c_str());
+    async::File moved(std::move(file));
+
+    CHECK_FALSE(file.isOpen());
+    CHECK(moved.isOpen());
+    CHECK(moved.size() == c_fileSize);
+
+    moved.close();
+
+    CHECK_FALSE(moved.isOpen());
+  }
+
+  SUBCASE("missing file") {
+    const async::File file("toygine_missing_async_file.bin");
+
+    CHECK_FALSE(file.isOpen());
+    CHECK(file.size() == 0);
+  }
+}
+
+TEST_CASE("filesystem/async_io/synchronous") {
+  // Before initialize(), reads happen on submit and poll() runs the callbacks
+  const PatternFile pattern;
+
+  checkBackend(pattern.path());
+}
+
+TEST_CASE("filesystem/async_io/workers") {
+  const PatternFile   pattern;
+  const ScopedBackend workers(async::Backend::Workers);
+
+  CHECK(async::backend() == async::Backend::Workers);
+  CHECK_FALSE(async::registerBuffer({}));
+
+  checkBackend(pattern.path());
+}
+
+TEST_CASE("filesystem/async_io/io_uring") {
+  const PatternFile   pattern;
+  const ScopedBackend ring(async::Backend::IoUring);
+
+  if (async::backend() != async::Backend::IoUring)
+    MESSAGE("io_uring is not available; the workers run instead");
+
+  checkBackend(pattern.path());
+
+  SUBCASE("registered buffer") {
+    const async::File      file(pattern.path().c_str());
+    std::vector<std::byte> arena(16 * c_chunkSize);
+    std::vector<std::byte> outside(c_chunkSize);
+
+    const bool registered = async::registerBuffer(arena);
+
+    CHECK(registered == (async::backend() == async::Backend::IoUring));
+
+    std::vector<async::Request> requests;
+
+    for (size_t index = 0; index < 16; ++index)
+      requests.push_back({&file, index * 65536, std::span(arena).subspan(index * c_chunkSize, c_chunkSize)});
+
+    requests.push_back({&file, 777, outside});
+
+    REQUIRE(async::submit(requests) == requests.size());
+
+    async::waitAll();
+
+    for (const async::Request & request : requests) {
+      CHECK(request.status == async::Status::Done);
+      CHECK(matches(request.buffer, request.offset));
+    }
+
+    CHECK_FALSE(async::registerBuffer({}));
+  }
+}
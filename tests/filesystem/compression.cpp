@@ -0,0 +1,252 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   compression.cpp
+  \brief  Unit tests for LZ streams: round trips, windows, decoding in place and through a ring, and damaged data.
+*/
+
+#include <doctest/doctest.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+namespace lz = toy::filesystem::lz;
+
+// Pseudo-random bytes, reproducible across runs
+std::vector<std::byte> noise(size_t size, uint32_t seed) {
+  std::vector<std::byte> data(size);
+
+  for (std::byte & value : data) {
+    seed  = seed * 1664525U + 1013904223U;
+    value = static_cast<std::byte>(seed >> 24);
+  }
+
+  return data;
+}
+
+// Text-like data built from a few words, which compresses well
+std::vector<std::byte> words(size_t size) {
+  constexpr toy::string_view c_words[] = {"tile ", "sprite ", "palette ", "level ", "enemy ", "jump\n"};
+
+  std::vector<std::byte> data;
+  uint32_t               seed = 1;
+
+  while (data.size() < size) {
+    seed = seed * 1664525U + 1013904223U;
+
+    for (const char character : c_words[(seed >> 16) % std::size(c_words)])
+      data.push_back(static_cast<std::byte>(character));
+  }
+
+  data.resize(size);
+
+  return data;
+}
+
+std::vector<std::byte> compressed(const std::vector<std::byte> & data, uint8_t windowBits) {
+  std::vector<std::byte> stream(lz::compressBound(data.size(), windowBits));
+
+  stream.resize(lz::compress(data, stream, windowBits));
+
+  return stream;
+}
+
+// Decodes \a stream through a ring of \a ringSize bytes and returns every block joined
+std::vector<std::byte> streamed(const std::vector<std::byte> & stream, size_t ringSize, bool & intact) {
+  std::vector<std::byte> ring(ringSize);
+  std::vector<std::byte> data;
+  lz::Decompressor       decoder(stream, ring);
+
+  for (auto block = decoder.next(); !block.empty(); block = decoder.next())
+    data.insert(data.end(), block.begin(), block.end());
+
+  intact = decoder.isValid() && !decoder.isDamaged() && decoder.position() == decoder.rawSize();
+
+  return data;
+}
+
+// Data of every kind the tests round-trip
+std::vector<std::vector<std::byte>> samples() {
+  std::vector<std::byte> mixed = words(40000);
+  std::vector<std::byte> tail  = noise(40000, 3);
+
+  mixed.insert(mixed.end(), tail.begin(), tail.end());
+
+  return {{}, noise(3, 1), words(200000), noise(70000, 2), std::vector<std::byte>(100000), mixed};
+}
+
+} // namespace
+
+TEST_CASE("filesystem/compression/round_trip") {
+  for (const uint8_t windowBits : {lz::c_minWindowBits, uint8_t{12}, lz::c_maxWindowBits}) {
+    for (const std::vector<std::byte> & data : samples()) {
+      const auto stream = compressed(data, windowBits);
+
+      REQUIRE(!stream.empty());
+      CHECK(stream.size() <= lz::compressBound(data.size(), windowBits));
+
+      const lz::StreamInfo info = lz::streamInfo(stream);
+
+      REQUIRE(info);
+      CHECK(info.rawSize == data.size());
+      CHECK(info.windowSize == size_t{1} << windowBits);
+
+      std::vector<std::byte> wide(data.size());
+      std::vector<std::byte> bytes(data.size());
+
+      CHECK(lz::decompress(stream, wide));
+      CHECK(wide == data);
+      CHECK(lz::scalar::decompress(stream, bytes));
+      CHECK(bytes == data);
+    }
+  }
+}
+
+TEST_CASE("filesystem/compression/ratio") {
+  const auto text   = words(100000);
+  const auto zeros  = std::vector<std::byte>(100000);
+  const auto random = noise(100000, 4);
+
+  CHECK(compressed(text, lz::c_defaultWindowBits).size() < text.size() / 2);
+  CHECK(compressed(zeros, lz::c_defaultWindowBits).size() < 1000);
+
+  // Noise is stored: a header per block on top of the data
+  CHECK(compressed(random, lz::c_defaultWindowBits).size() == lz::compressBound(random.size()));
+}
+
+TEST_CASE("filesystem/compression/in_place") {
+  for (const uint8_t windowBits : {lz::c_minWindowBits, lz::c_maxWindowBits}) {
+    for (const std::vector<std::byte> & data : samples()) {
+      const auto             stream = compressed(data, windowBits);
+      std::vector<std::byte> buffer(data.size() + lz::inPlaceMargin(data.size()));
+
+      std::copy(stream.begin(), stream.end(), buffer.end() - static_cast<ptrdiff_t>(stream.size()));
+      CHECK(lz::decompress(std::span(buffer).last(stream.size()), buffer));
+      CHECK(std::equal(data.begin(), data.end(), buffer.begin()));
+
+      std::copy(stream.begin(), stream.end(), buffer.end() - static_cast<ptrdiff_t>(stream.size()));
+      CHECK(lz::scalar::decompress(std::span(buffer).last(stream.size()), buffer));
+      CHECK(std::equal(data.begin(), data.end(), buffer.begin()));
+    }
+  }
+}
+
+TEST_CASE("filesystem/compression/ring") {
+  const auto data = words(100000);
+
+  SUBCASE("smallest ring") {
+    bool intact = false;
+
+    CHECK(streamed(compressed(data, 12), lz::ringSize(4096), intact) == data);
+    CHECK(intact);
+  }
+
+  SUBCASE("larger ring") {
+    bool intact = false;
+
+    CHECK(streamed(compressed(data, 10), lz::ringSize(1024) * 3 + 100, intact) == data);
+    CHECK(intact);
+  }
+
+  SUBCASE("blocks are one window") {
+    const auto             stream = compressed(data, 12);
+    std::vector<std::byte> ring(lz::ringSize(4096));
+    lz::Decompressor       decoder(stream, ring);
+
+    REQUIRE(decoder.isValid());
+    CHECK(decoder.rawSize() == data.size());
+    CHECK(decoder.next().size() == 4096);
+    CHECK(decoder.position() == 4096);
+  }
+
+  SUBCASE("ring too small") {
+    const auto             stream = compressed(data, 12);
+    std::vector<std::byte> ring(lz::ringSize(4096) - 1);
+    lz::Decompressor       decoder(stream, ring);
+
+    CHECK_FALSE(decoder.isValid());
+    CHECK(decoder.next().empty());
+  }
+}
+
+TEST_CASE("filesystem/compression/damaged") {
+  const auto data   = words(20000);
+  const auto stream = compressed(data, 10);
+
+  SUBCASE("bad header") {
+    auto damaged = stream;
+
+    damaged[0] = std::byte{'X'};
+
+    std::vector<std::byte> output(data.size());
+
+    CHECK_FALSE(lz::streamInfo(damaged));
+    CHECK_FALSE(lz::decompress(damaged, output));
+  }
+
+  SUBCASE("window out of range") {
+    std::vector<std::byte> output(lz::compressBound(data.size(), 9));
+
+    CHECK(lz::compress(data, output, 9) == 0);
+    CHECK(lz::compress(data, output, 17) == 0);
+  }
+
+  SUBCASE("destination too small") {
+    std::vector<std::byte> output(data.size() - 1);
+
+    CHECK_FALSE(lz::decompress(stream, output));
+    CHECK(lz::compress(data, output, 10) == 0);
+  }
+
+  SUBCASE("truncated") {
+    std::vector<std::byte> output(data.size());
+    bool                   intact = true;
+
+    CHECK_FALSE(lz::decompress(std::span(stream).first(stream.size() - 1), output));
+    CHECK_FALSE(lz::scalar::decompress(std::span(stream).first(stream.size() / 2), output));
+
+    streamed(std::vector<std::byte>(stream.begin(), stream.end() - 1), lz::ringSize(1024), intact);
+    CHECK_FALSE(intact);
+  }
+
+  SUBCASE("corrupted bytes never overrun") {
+    // Flipped bytes must fail or decode to something, always inside the buffers
+    std::vector<std::byte> output(data.size());
+    uint32_t               seed = 5;
+
+    for (size_t round = 0; round < 500; ++round) {
+      auto damaged = stream;
+
+      seed = seed * 1664525U + 1013904223U;
+      damaged[sizeof(lz::StreamHeader) + (seed >> 8) % (damaged.size() - sizeof(lz::StreamHeader))] ^=
+        static_cast<std::byte>(1 + (seed & 0x7F));
+
+      static_cast<void>(lz::decompress(damaged, output));
+      static_cast<void>(lz::scalar::decompress(damaged, output));
+    }
+
+    CHECK(lz::decompress(stream, output));
+    CHECK(output == data);
+  }
+}
@@ -0,0 +1,339 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   pack.cpp
+  \brief  Unit tests for pack archives: writing, lookup by path hash, damaged images, and mapped pack files.
+*/
+
+#include <doctest/doctest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+using toy::filesystem::Pack;
+using toy::filesystem::PackSource;
+
+std::span<const std::byte> bytesOf(std::string_view text) noexcept {
+  return std::as_bytes(std::span(text.data(), text.size()));
+}
+
+std::string_view textOf(std::span<const std::byte> data) noexcept {
+  return {reinterpret_cast<const char *>(data.data()), data.size()};
+}
+
+// Builds a pack image holding the given files
+std::vector<std::byte> buildPack(std::vector<PackSource> sources) {
+  std::vector<std::byte> image(toy::filesystem::packImageSize(sources));
+
+  CHECK(toy::filesystem::writePack(sources, image) == image.size());
+
+  return image;
+}
+
+// Pack image in memory aligned like a mapping or a ROM image
+struct AlignedImage {
+  explicit AlignedImage(const std::vector<std::byte> & image)
+    : storage(image.size() + toy::filesystem::c_packAlignment) {
+    const auto address = reinterpret_cast<uintptr_t>(storage.data());
+    const auto offset  = (toy::filesystem::c_packAlignment - address % toy::filesystem::c_packAlignment) %
+                        toy::filesystem::c_packAlignment;
+
+    data = storage.data() + offset;
+    size = image.size();
+    std::memcpy(data, image.data(), image.size());
+  }
+
+  std::vector<std::byte> storage;
+  std::byte *            data;
+  size_t                 size;
+};
+
+} // namespace
+
+TEST_CASE("filesystem/pack/round_trip") {
+  using namespace toy::literals;
+
+  const auto image = buildPack({
+    {"sprites/hero.spr", bytesOf("hero")},
+    {"levels/forest.lvl", bytesOf("forest level")},
+    {"empty.txt", {}},
+  });
+
+  const AlignedImage aligned(image);
+  const Pack         pack(aligned.data, aligned.size);
+
+  REQUIRE(pack.isValid());
+  CHECK(pack.size() == 3);
+  CHECK(pack.image().size() == image.size());
+
+  SUBCASE("find by compile-time hash") {
+    const auto file = pack.find("sprites/hero.spr"_sid);
+
+    REQUIRE(file);
+    CHECK(textOf(file.data) == "hero");
+    CHECK(file.path == "sprites/hero.spr");
+    CHECK(file.id == "sprites/hero.spr"_sid);
+  }
+
+  SUBCASE("find by runtime hash") {
+    const auto file = pack.find(toy::StringId(toy::hash64(std::string("levels/forest.lvl"))));
+
+    REQUIRE(file);
+    CHECK(textOf(file.data) == "forest level");
+  }
+
+  SUBCASE("data is aligned and points into the image") {
+    for (size_t index = 0; index < pack.size(); ++index) {
+      const auto file = pack.file(index);
+
+      REQUIRE(file);
+      CHECK(reinterpret_cast<uintptr_t>(file.data.data()) % toy::filesystem::c_packAlignment == 0);
+      CHECK(file.data.data() >= pack.image().data());
+      CHECK(file.data.data() + file.data.size() <= pack.image().data() + pack.image().size());
+    }
+  }
+
+  SUBCASE("empty file is found") {
+    const auto file = pack.find("empty.txt"_sid);
+
+    CHECK(file);
+    CHECK(file.data.empty());
+  }
+
+  SUBCASE("missing file") {
+    CHECK_FALSE(pack.find("sprites/villain.spr"_sid));
+    CHECK_FALSE(pack.file(3));
+  }
+
+  SUBCASE("listing is in hash order") {
+    for (size_t index = 1; index < pack.size(); ++index)
+      CHECK(pack.file(index - 1).id.value() < pack.file(index).id.value());
+  }
+}
+
+TEST_CASE("filesystem/pack/compressed_entries") {
+  const std::string      text(5000, 'z');
+  std::vector<std::byte> stream(toy::filesystem::lz::compressBound(text.size()));
+
+  stream.resize(toy::filesystem::lz::compress(bytesOf(text), stream));
+
+  const auto image = buildPack({
+    {"plain.txt", bytesOf("plain")},
+    {"packed.txt", stream, true},
+  });
+
+  const Pack pack(image.data(), image.size());
+
+  REQUIRE(pack.isValid());
+
+  const auto plain  = pack.find(toy::StringId(toy::hash64("plain.txt")));
+  const auto packed = pack.find(toy::StringId(toy::hash64("packed.txt")));
+
+  REQUIRE(plain);
+  REQUIRE(packed);
+  CHECK_FALSE(plain.compressed);
+  CHECK(packed.compressed);
+  CHECK(packed.data.size() == stream.size());
+  CHECK(toy::filesystem::lz::streamInfo(packed.data).rawSize == text.size());
+}
+
+TEST_CASE("filesystem/pack/many_files") {
+  std::vector<std::string> paths;
+  std::vector<std::string> contents;
+
+  for (size_t index = 0; index < 3000; ++index) {
+    paths.push_back("textures/tile_" + std::to_string(index) + ".tex");
+    contents.push_back(std::string(index % 97, static_cast<char>('a' + index % 26)));
+  }
+
+  std::vector<PackSource> sources;
+
+  for (size_t index = 0; index < paths.size(); ++index)
+    sources.push_back({paths[index], bytesOf(contents[index])});
+
+  // Files are laid out in hash order, so the size must not depend on the order they are given in
+  const std::vector<PackSource> reversed(sources.rbegin(), sources.rend());
+
+  CHECK(toy::filesystem::packImageSize(reversed) == toy::filesystem::packImageSize(sources));
+
+  const auto         image = buildPack(sources);
+  const AlignedImage aligned(image);
+  const Pack         pack(aligned.data, aligned.size);
+
+  REQUIRE(pack.isValid());
+  REQUIRE(pack.size() == paths.size());
+
+  for (size_t index = 0; index < paths.size(); ++index) {
+    const auto file = pack.find(toy::StringId(toy::hash64(paths[index])));
+
+    REQUIRE(file);
+    CHECK(file.path == paths[index]);
+    CHECK(textOf(file.data) == contents[index]);
+  }
+
+  CHECK_FALSE(pack.find(toy::StringId(toy::hash64("textures/tile_3000.tex"))));
+}
+
+TEST_CASE("filesystem/pack/writer_errors") {
+  std::vector<PackSource> sources{
+    {"a.txt", bytesOf("a")},
+    {"b.txt", bytesOf("b")},
+  };
+
+  SUBCASE("buffer too small") {
+    std::vector<std::byte> image(toy::filesystem::packImageSize(sources) - 1);
+
+    CHECK(toy::filesystem::writePack(sources, image) == 0);
+  }
+
+  SUBCASE("duplicate path") {
+    sources.push_back({"a.txt", bytesOf("again")});
+
+    std::vector<std::byte> image(toy::filesystem::packImageSize(sources));
+
+    CHECK(toy::filesystem::writePack(sources, image) == 0);
+  }
+
+  SUBCASE("empty pack") {
+    std::vector<PackSource> none;
+    std::vector<std::byte>  image(toy::filesystem::packImageSize(none));
+
+    REQUIRE(toy::filesystem::writePack(none, image) == image.size());
+
+    const Pack pack(image.data(), image.size());
+
+    CHECK(pack.isValid());
+    CHECK(pack.size() == 0);
+    CHECK_FALSE(pack.find(toy::StringId(toy::hash64("a.txt"))));
+  }
+}
+
+TEST_CASE("filesystem/pack/damaged_images") {
+  auto image = buildPack({
+    {"a.txt", bytesOf("alpha")},
+    {"b.txt", bytesOf("beta")},
+  });
+
+  SUBCASE("default pack") {
+    const Pack pack;
+
+    CHECK_FALSE(pack.isValid());
+    CHECK(pack.size() == 0);
+    CHECK_FALSE(pack.find(toy::StringId(toy::hash64("a.txt"))));
+  }
+
+  SUBCASE("null and short images") {
+    CHECK_FALSE(Pack(nullptr, 0).isValid());
+    CHECK_FALSE(Pack(image.data(), sizeof(toy::filesystem::PackHeader) - 1).isValid());
+    CHECK_FALSE(Pack(image.data(), image.size() - 1).isValid());
+  }
+
+  SUBCASE("bad magic") {
+    image[0] = std::byte{'X'};
+
+    CHECK_FALSE(Pack(image.data(), image.size()).isValid());
+  }
+
+  SUBCASE("version 1") {
+    // Version 1 entries end in a 32-bit path size, whose high half reads as no flags
+    image[4] = std::byte{1};
+
+    const Pack pack(image.data(), image.size());
+
+    REQUIRE(pack.isValid());
+    CHECK(textOf(pack.find(toy::StringId(toy::hash64("a.txt"))).data) == "alpha");
+    CHECK_FALSE(pack.find(toy::StringId(toy::hash64("a.txt"))).compressed);
+  }
+
+  SUBCASE("newer version") {
+    image[4] = std::byte{toy::filesystem::c_packVersion + 1};
+
+    CHECK_FALSE(Pack(image.data(), image.size()).isValid());
+  }
+
+  SUBCASE("entry outside the image") {
+    // The first entry follows the header; move its data offset past the end
+    const size_t offset = sizeof(toy::filesystem::PackHeader) + offsetof(toy::filesystem::PackEntry, offset);
+
+    std::memset(image.data() + offset, 0x7F, sizeof(uint64_t));
+
+    const Pack pack(image.data(), image.size());
+
+    REQUIRE(pack.isValid());
+    CHECK_FALSE(pack.file(0));
+    CHECK(pack.file(1));
+  }
+}
+
+TEST_CASE("filesystem/pack/mapped_file") {
+  const auto path  = std::filesystem::temp_directory_path() / "toygine_pack_mapped.tgpk";
+  const auto image = buildPack({
+    {"a.txt", bytesOf("alpha")},
+    {"b.txt", bytesOf("beta")},
+  });
+
+  {
+    std::ofstream stream(path, std::ios::binary);
+
+    stream.write(reinterpret_cast<const char *>(image.data()), static_cast<std::streamsize>(image.size()));
+  }
+
+  SUBCASE("map and read") {
+    toy::filesystem::MappedFile mapping(path.string().c_str());
+
+    REQUIRE(mapping.isOpen());
+    REQUIRE(mapping.data().size() == image.size());
+    CHECK(reinterpret_cast<uintptr_t>(mapping.data().data()) % toy::filesystem::c_packAlignment == 0);
+
+    const Pack pack(mapping.data().data(), mapping.data().size());
+
+    REQUIRE(pack.isValid());
+    CHECK(textOf(pack.find(toy::StringId(toy::hash64("b.txt"))).data) == "beta");
+  }
+
+  SUBCASE("move and close") {
+    toy::filesystem::MappedFile mapping(path.string().c_str());
+    toy::filesystem::MappedFile moved(std::move(mapping));
+
+    CHECK_FALSE(mapping.isOpen());
+    CHECK(moved.isOpen());
+
+    moved.close();
+
+    CHECK_FALSE(moved.isOpen());
+    CHECK(moved.data().empty());
+  }
+
+  SUBCASE("missing file") {
+    const toy::filesystem::MappedFile mapping("toygine_missing_file.tgpk");
+
+    CHECK_FALSE(mapping.isOpen());
+    CHECK(mapping.data().empty());
+  }
+
+  std::filesystem::remove(path);
+}
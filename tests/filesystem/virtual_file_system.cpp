@@ -0,0 +1,227 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   virtual_file_system.cpp
+  \brief  Unit tests for the virtual file system: mount order, loose directories over packs, and file ownership.
+*/
+
+#include <doctest/doctest.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+using toy::filesystem::File;
+using toy::filesystem::Pack;
+using toy::filesystem::PackSource;
+using toy::filesystem::VirtualFileSystem;
+
+std::span<const std::byte> bytesOf(std::string_view text) noexcept {
+  return std::as_bytes(std::span(text.data(), text.size()));
+}
+
+std::string_view textOf(const File & file) noexcept {
+  return {reinterpret_cast<const char *>(file.data().data()), file.data().size()};
+}
+
+std::vector<std::byte> buildPack(std::vector<PackSource> sources) {
+  std::vector<std::byte> image(toy::filesystem::packImageSize(sources));
+
+  CHECK(toy::filesystem::writePack(sources, image) == image.size());
+
+  return image;
+}
+
+void writeFile(const std::filesystem::path & path, std::string_view text) {
+  std::filesystem::create_directories(path.parent_path());
+
+  std::ofstream stream(path, std::ios::binary);
+
+  stream.write(text.data(), static_cast<std::streamsize>(text.size()));
+}
+
+} // namespace
+
+TEST_CASE("filesystem/virtual_file_system/packs") {
+  using namespace toy::literals;
+
+  const auto base  = buildPack({
+    {"config.ini", bytesOf("base config")},
+    {"sprites/hero.spr", bytesOf("base hero")},
+  });
+  const auto patch = buildPack({
+    {"sprites/hero.spr", bytesOf("patched hero")},
+  });
+
+  VirtualFileSystem files;
+
+  REQUIRE(files.mountPack(Pack(base.data(), base.size())));
+  REQUIRE(files.mountPack(Pack(patch.data(), patch.size())));
+  CHECK(files.mountCount() == 2);
+
+  SUBCASE("newest mount wins") {
+    const File hero = files.open("sprites/hero.spr");
+
+    REQUIRE(hero);
+    CHECK(textOf(hero) == "patched hero");
+    CHECK_FALSE(hero.isLoaded());
+  }
+
+  SUBCASE("older mount is searched") {
+    CHECK(textOf(files.open("config.ini")) == "base config");
+    CHECK(textOf(files.open("config.ini"_sid)) == "base config");
+  }
+
+  SUBCASE("files are views into the image") {
+    const File config = files.open("config.ini");
+
+    CHECK(config.data().data() >= base.data());
+    CHECK(config.data().data() < base.data() + base.size());
+  }
+
+  SUBCASE("missing file") {
+    CHECK_FALSE(files.open("sprites/villain.spr"));
+    CHECK_FALSE(files.exists("sprites/villain.spr"));
+    CHECK(files.exists("config.ini"));
+  }
+
+  SUBCASE("compressed file is decompressed") {
+    const std::string      text(10000, 'q');
+    std::vector<std::byte> stream(toy::filesystem::lz::compressBound(text.size()));
+
+    stream.resize(toy::filesystem::lz::compress(bytesOf(text), stream));
+
+    const auto packed = buildPack({
+      {"music/theme.xm", stream, true},
+    });
+
+    REQUIRE(files.mountPack(Pack(packed.data(), packed.size())));
+
+    const File theme = files.open("music/theme.xm");
+
+    REQUIRE(theme);
+    CHECK(theme.isLoaded());
+    CHECK(textOf(theme) == text);
+    CHECK(reinterpret_cast<uintptr_t>(theme.data().data()) % toy::filesystem::c_packAlignment == 0);
+  }
+
+  SUBCASE("invalid pack is refused") {
+    CHECK_FALSE(files.mountPack(Pack()));
+    CHECK(files.mountCount() == 2);
+  }
+
+  SUBCASE("unmount") {
+    files.unmountAll();
+
+    CHECK(files.mountCount() == 0);
+    CHECK_FALSE(files.open("config.ini"));
+  }
+
+  SUBCASE("mount limit") {
+    for (size_t index = files.mountCount(); index < toy::filesystem::c_maxMounts; ++index)
+      CHECK(files.mountPack(Pack(base.data(), base.size())));
+
+    CHECK_FALSE(files.mountPack(Pack(base.data(), base.size())));
+    CHECK_FALSE(files.mountDirectory("assets"));
+  }
+}
+
+TEST_CASE("filesystem/virtual_file_system/directories") {
+  using namespace toy::literals;
+
+  const auto root     = std::filesystem::temp_directory_path() / "toygine_vfs_loose";
+  const auto packPath = std::filesystem::temp_directory_path() / "toygine_vfs_base.tgpk";
+  const auto image    = buildPack({
+    {"config.ini", bytesOf("packed config")},
+    {"levels/forest.lvl", bytesOf("packed forest")},
+  });
+
+  std::filesystem::remove_all(root);
+  writeFile(root / "levels" / "forest.lvl", "loose forest");
+  writeFile(root / "notes.txt", "");
+
+  {
+    std::ofstream stream(packPath, std::ios::binary);
+
+    stream.write(reinterpret_cast<const char *>(image.data()), static_cast<std::streamsize>(image.size()));
+  }
+
+  {
+    VirtualFileSystem files;
+
+    REQUIRE(files.mountPack(packPath.string().c_str()));
+    REQUIRE(files.mountDirectory(root.string().c_str()));
+
+    SUBCASE("loose files override the pack") {
+      const File forest = files.open("levels/forest.lvl");
+
+      REQUIRE(forest);
+      CHECK(forest.isLoaded());
+      CHECK(textOf(forest) == "loose forest");
+      CHECK(reinterpret_cast<uintptr_t>(forest.data().data()) % toy::filesystem::c_packAlignment == 0);
+    }
+
+    SUBCASE("pack files show through") {
+      const File config = files.open("config.ini");
+
+      REQUIRE(config);
+      CHECK_FALSE(config.isLoaded());
+      CHECK(textOf(config) == "packed config");
+    }
+
+    SUBCASE("identifiers search the packs only") {
+      CHECK(textOf(files.open("levels/forest.lvl"_sid)) == "packed forest");
+      CHECK_FALSE(files.open("notes.txt"_sid));
+    }
+
+    SUBCASE("empty loose file is found") {
+      const File notes = files.open("notes.txt");
+
+      CHECK(notes);
+      CHECK(notes.data().empty());
+      CHECK(files.exists("notes.txt"));
+    }
+
+    SUBCASE("moved file keeps its contents") {
+      File forest = files.open("levels/forest.lvl");
+      File moved(std::move(forest));
+
+      CHECK_FALSE(forest);
+      CHECK(textOf(moved) == "loose forest");
+
+      forest = std::move(moved);
+
+      CHECK(textOf(forest) == "loose forest");
+    }
+
+    SUBCASE("missing pack path") {
+      CHECK_FALSE(files.mountPack("toygine_missing_pack.tgpk"));
+      CHECK(files.mountCount() == 2);
+    }
+  }
+
+  std::filesystem::remove_all(root);
+  std::filesystem::remove(packPath);
+}
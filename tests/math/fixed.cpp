@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   fixed.cpp
+  \brief  Unit tests for toy::math::Fixed: conversions, wrapping and saturating arithmetic, and the CORDIC functions.
+*/
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "math.hpp"
+
+namespace {
+
+using Fixed16 = toy::math::Fixed<16, 16>;
+using Fixed8  = toy::math::Fixed<8, 8>;
+using Byte    = toy::math::Fixed<4, 4>;
+using Unit    = toy::math::Fixed<1, 15>;
+
+// One unit in the last place of Q16, the accuracy the CORDIC functions promise
+constexpr double c_ulp = 1.0 / 65536.0;
+
+// Builds a value at run time, which the consteval constructor cannot
+Fixed16 fromDouble(double value) {
+  return Fixed16::fromRaw(static_cast<int32_t>(std::lround(value * 65536.0)));
+}
+
+// Square root of \a value rounded to nearest, from the double root corrected in integers
+uint64_t referenceRoot(uint64_t value) {
+  auto root = static_cast<uint64_t>(std::sqrt(static_cast<double>(value)));
+
+  while (root * root > value)
+    --root;
+
+  while ((root + 1) * (root + 1) <= value)
+    ++root;
+
+  return value - root * root > root ? root + 1 : root;
+}
+
+} // namespace
+
+TEST_CASE("math/fixed/conversions") {
+  SUBCASE("constants convert while compiling") {
+    constexpr Fixed16 half(0.5);
+    constexpr Fixed16 negative(-2.25);
+    constexpr Fixed8  tiny(0.001953125);
+
+    static_assert(half.raw() == 0x8000);
+    static_assert(negative.raw() == -0x24000);
+    static_assert(tiny.raw() == 1); // 1/512 rounds up to 1/256
+
+    CHECK_EQ(static_cast<double>(half), 0.5);
+    CHECK_EQ(static_cast<double>(negative), -2.25);
+  }
+
+  SUBCASE("integers convert implicitly and wrap") {
+    constexpr Fixed16 three = 3;
+    constexpr Byte    wrapped = 9; // 4 integer bits hold [-8, 8)
+
+    static_assert(three.raw() == 3 << 16);
+    static_assert(wrapped == Byte(-7));
+
+    CHECK_EQ(static_cast<int>(Fixed16(1.75)), 1);
+    CHECK_EQ(static_cast<int>(Fixed16(-1.25)), -2);
+  }
+
+  SUBCASE("formats convert into each other") {
+    constexpr Fixed8 coarse(Fixed16(1.5));
+    constexpr Fixed16 fine(Fixed8(-3.75));
+
+    static_assert(coarse.raw() == 0x180);
+    static_assert(fine == Fixed16(-3.75));
+  }
+
+  SUBCASE("limits") {
+    static_assert(Fixed16::highest().raw() == std::numeric_limits<int32_t>::max());
+    static_assert(Fixed16::lowest() == Fixed16(-32768));
+    static_assert(Fixed16::epsilon().raw() == 1);
+    static_assert(sizeof(Fixed8) == 2 && sizeof(Byte) == 1);
+  }
+}
+
+TEST_CASE("math/fixed/arithmetic") {
+  SUBCASE("operators") {
+    constexpr Fixed16 a(2.5);
+    constexpr Fixed16 b(-1.25);
+
+    static_assert(a + b == Fixed16(1.25));
+    static_assert(a - b == Fixed16(3.75));
+    static_assert(a * b == Fixed16(-3.125));
+    static_assert(a / b == Fixed16(-2));
+    static_assert(-a == Fixed16(-2.5));
+    static_assert(a * 2 == 5 && 0.5 * a == Fixed16(1.25));
+    static_assert(b < a && a > 2 && b <= -1.25);
+  }
+
+  SUBCASE("products round to nearest") {
+    // 3/256 * 1/2 = 1.5/256 rounds up, -1.5/256 rounds toward positive infinity
+    CHECK_EQ((Fixed8::fromRaw(3) * Fixed8(0.5)).raw(), 2);
+    CHECK_EQ((Fixed8::fromRaw(-3) * Fixed8(0.5)).raw(), -1);
+    CHECK_EQ((Fixed16(1) / 3).raw(), 21845);
+  }
+
+  SUBCASE("operators wrap") {
+    CHECK_EQ(Byte(7) + Byte(2), Byte(-7));
+    CHECK_EQ(Byte(-8) - Byte(1), Byte(7));
+    CHECK_EQ(Byte(4) * Byte(3), Byte(-4));
+    CHECK_EQ(-Byte::lowest(), Byte::lowest());
+    CHECK_EQ(Fixed16(30000) + Fixed16(30000), Fixed16(-5536));
+  }
+
+  SUBCASE("saturating functions clamp") {
+    using toy::math::addSaturated;
+    using toy::math::divideSaturated;
+    using toy::math::multiplySaturated;
+    using toy::math::subtractSaturated;
+
+    CHECK_EQ(addSaturated(Byte(7), Byte(2)), Byte::highest());
+    CHECK_EQ(subtractSaturated(Byte(-8), Byte(1)), Byte::lowest());
+    CHECK_EQ(multiplySaturated(Byte(4), Byte(-3)), Byte::lowest());
+    CHECK_EQ(divideSaturated(Fixed16(30000), Fixed16(0.5)), Fixed16::highest());
+    CHECK_EQ(addSaturated(Fixed16(1.5), Fixed16(2)), Fixed16(3.5));
+    CHECK_EQ(multiplySaturated(Fixed16(1.5), Fixed16(-2)), Fixed16(-3));
+  }
+
+  SUBCASE("division by zero returns the end of the range") {
+    CHECK_EQ(Fixed16(5) / 0, Fixed16::highest());
+    CHECK_EQ(Fixed16(-5) / 0, Fixed16::lowest());
+    CHECK_EQ(Fixed16(0) / 0, Fixed16(0));
+    CHECK_EQ(toy::math::divideSaturated(Fixed16(-1), Fixed16(0)), Fixed16::lowest());
+  }
+
+  SUBCASE("abs and floor") {
+    static_assert(toy::math::abs(Fixed16(-2.5)) == Fixed16(2.5));
+    static_assert(toy::math::floor(Fixed16(2.75)) == 2);
+    static_assert(toy::math::floor(Fixed16(-2.25)) == -3);
+  }
+}
+
+TEST_CASE("math/fixed/functions") {
+  SUBCASE("sine and cosine stay within one unit of Q16") {
+    double worst = 0;
+
+    for (double angle = -40.0; angle <= 40.0; angle += 0.0137) {
+      const auto result = toy::math::sinCos(fromDouble(angle));
+      const double exact = static_cast<double>(fromDouble(angle));
+
+      worst = std::max(worst, std::abs(static_cast<double>(result.sine) - std::sin(exact)));
+      worst = std::max(worst, std::abs(static_cast<double>(result.cosine) - std::cos(exact)));
+    }
+
+    CHECK_LE(worst, c_ulp);
+  }
+
+  SUBCASE("large angles reduce without losing precision") {
+    const Fixed16 angle(20000.0);
+
+    CHECK_LE(std::abs(static_cast<double>(toy::math::sin(angle)) - std::sin(20000.0)), c_ulp);
+    CHECK_LE(std::abs(static_cast<double>(toy::math::cos(angle)) - std::cos(20000.0)), c_ulp);
+  }
+
+  SUBCASE("trigonometry runs while compiling") {
+    constexpr Fixed16 sine = toy::math::sin(toy::math::c_pi<Fixed16> / 6);
+
+    static_assert(sine.raw() >= 32767 && sine.raw() <= 32769);
+    static_assert(toy::math::cos(Fixed16(0)) == 1);
+  }
+
+  SUBCASE("atan2 covers every quadrant") {
+    double worst = 0;
+
+    for (double y = -3.0; y <= 3.0; y += 0.37) {
+      for (double x = -3.0; x <= 3.0; x += 0.41) {
+        const Fixed16 fixedY = fromDouble(y);
+        const Fixed16 fixedX = fromDouble(x);
+        const double  exact  = std::atan2(static_cast<double>(fixedY), static_cast<double>(fixedX));
+
+        worst = std::max(worst, std::abs(static_cast<double>(toy::math::atan2(fixedY, fixedX)) - exact));
+      }
+    }
+
+    CHECK_LE(worst, c_ulp);
+    CHECK_EQ(toy::math::atan2(Fixed16(0), Fixed16(0)), Fixed16(0));
+    CHECK_LE(std::abs(static_cast<double>(toy::math::atan2(Fixed16(0), Fixed16(-1))) - 3.14159265358979), c_ulp);
+  }
+
+  SUBCASE("hypot does not overflow in the squares") {
+    CHECK_LE(std::abs(static_cast<double>(toy::math::hypot(Fixed16(300), Fixed16(400))) - 500.0), c_ulp);
+    CHECK_LE(std::abs(static_cast<double>(toy::math::hypot(Fixed16(0), Fixed16(-2))) - 2.0), c_ulp);
+    CHECK_EQ(toy::math::hypot(Fixed16(30000), Fixed16(30000)), Fixed16::highest());
+  }
+
+  SUBCASE("hypot rounds to nearest for large operands") {
+    CHECK_LE(std::abs(static_cast<double>(toy::math::hypot(Fixed16(2272.74), Fixed16(-28281.85)))
+                      - std::hypot(static_cast<double>(Fixed16(2272.74)), static_cast<double>(Fixed16(-28281.85)))),
+             c_ulp / 2);
+
+    // Raws of every magnitude, down to a few bits, against the root of the exact sum of squares
+    uint32_t state = 12345;
+
+    for (size_t index = 0; index < 100000; ++index) {
+      state        = state * 1664525U + 1013904223U;
+      const auto x = static_cast<int32_t>(state) >> (index % 24);
+      state        = state * 1664525U + 1013904223U;
+      const auto y = static_cast<int32_t>(state) >> (index % 31);
+
+      const auto     wideX    = static_cast<int64_t>(x);
+      const auto     wideY    = static_cast<int64_t>(y);
+      const uint64_t squares  = static_cast<uint64_t>(wideX * wideX) + static_cast<uint64_t>(wideY * wideY);
+      const uint64_t root     = referenceRoot(squares);
+      const int32_t  expected = root > INT32_MAX ? INT32_MAX : static_cast<int32_t>(root);
+
+      CHECK_EQ(toy::math::hypot(Fixed16::fromRaw(x), Fixed16::fromRaw(y)).raw(), expected);
+    }
+  }
+
+  SUBCASE("square root rounds to nearest") {
+    static_assert(toy::math::sqrt(Fixed16(2.25)) == Fixed16(1.5));
+    static_assert(toy::math::sqrt(Fixed16(-1)) == 0);
+
+    for (double value = 0.001; value < 30000.0; value *= 1.37) {
+      const Fixed16 fixed = fromDouble(value);
+
+      CHECK_LE(std::abs(static_cast<double>(toy::math::sqrt(fixed)) - std::sqrt(static_cast<double>(fixed))),
+               c_ulp / 2);
+    }
+  }
+
+  SUBCASE("narrow formats") {
+    CHECK_EQ(toy::math::sqrt(Fixed8(16)), Fixed8(4));
+    CHECK_LE(std::abs(static_cast<double>(toy::math::sin(Fixed8(1))) - std::sin(1.0)), 1.0 / 256);
+    CHECK_EQ(toy::math::cos(Unit(0)), Unit::highest());
+  }
+}
@@ -0,0 +1,197 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   transform.cpp
+  \brief  Unit tests for the batch point transforms of toy::math.
+*/
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "math.hpp"
+
+namespace {
+
+// Vector loops may fuse multiply-adds, so results can differ from the references in the last bits
+constexpr float c_tolerance = 0.0001f;
+
+// Counts around the vector widths, so the loops run with and without a tail
+constexpr size_t c_counts[] = {0, 1, 3, 4, 7, 8, 9, 16, 31, 100};
+
+std::vector<float> coordinates(size_t count, float start, float step) {
+  std::vector<float> values(count);
+
+  for (size_t index = 0; index < count; ++index)
+    values[index] = start + step * static_cast<float>(index);
+
+  return values;
+}
+
+} // namespace
+
+TEST_CASE("math/transform/points_2d") {
+  using toy::math::Matrix3;
+
+  const Matrix3<float> transform = Matrix3<float>::translation({5.0f, -3.0f}) * Matrix3<float>::rotation(0.7f)
+                                 * Matrix3<float>::scale({2.0f, 0.5f});
+
+  SUBCASE("matches the point-at-a-time transforms") {
+    for (const size_t count : c_counts) {
+      const auto x = coordinates(count, -10.0f, 0.75f);
+      const auto y = coordinates(count, 4.0f, -0.5f);
+
+      std::vector<float> batchX(count), batchY(count), scalarX(count), scalarY(count);
+
+      toy::math::transformPoints(transform, x.data(), y.data(), batchX.data(), batchY.data(), count);
+      toy::math::scalar::transformPoints(transform, x.data(), y.data(), scalarX.data(), scalarY.data(), count);
+
+      for (size_t index = 0; index < count; ++index) {
+        const toy::math::Vector2<float> expected = transform.transformPoint({x[index], y[index]});
+
+        CHECK_LE(std::abs(batchX[index] - expected.x), c_tolerance);
+        CHECK_LE(std::abs(batchY[index] - expected.y), c_tolerance);
+        CHECK_EQ(scalarX[index], expected.x);
+        CHECK_EQ(scalarY[index], expected.y);
+      }
+    }
+  }
+
+  SUBCASE("in place") {
+    auto x = coordinates(13, 1.0f, 1.0f);
+    auto y = coordinates(13, -1.0f, 2.0f);
+
+    const auto sourceX = x;
+    const auto sourceY = y;
+
+    toy::math::transformPoints(transform, x.data(), y.data(), x.data(), y.data(), x.size());
+
+    for (size_t index = 0; index < x.size(); ++index) {
+      const toy::math::Vector2<float> expected = transform.transformPoint({sourceX[index], sourceY[index]});
+
+      CHECK_LE(std::abs(x[index] - expected.x), c_tolerance);
+      CHECK_LE(std::abs(y[index] - expected.y), c_tolerance);
+    }
+  }
+
+  SUBCASE("a point rounds the same wherever it falls in the batch") {
+    const auto x = coordinates(100, -10.3f, 0.377f);
+    const auto y = coordinates(100, 4.1f, -0.219f);
+
+    std::vector<float> wholeX(x.size()), wholeY(y.size());
+
+    toy::math::transformPoints(transform, x.data(), y.data(), wholeX.data(), wholeY.data(), x.size());
+
+    // Each suffix moves the points between the vector loop and the tail
+    for (size_t start = 1; start < x.size(); ++start) {
+      std::vector<float> partX(x.size() - start), partY(y.size() - start);
+
+      toy::math::transformPoints(transform, x.data() + start, y.data() + start, partX.data(), partY.data(),
+                                 partX.size());
+
+      for (size_t index = 0; index < partX.size(); ++index) {
+        CHECK_EQ(partX[index], wholeX[start + index]);
+        CHECK_EQ(partY[index], wholeY[start + index]);
+      }
+    }
+  }
+}
+
+TEST_CASE("math/transform/points_3d") {
+  using toy::math::Matrix4;
+  using toy::math::Quaternion;
+  using toy::math::Vector3;
+
+  const Matrix4<float> transform = Matrix4<float>::translation(Vector3<float>(1.0f, 2.0f, 3.0f))
+                                 * Matrix4<float>::rotation(Quaternion<float>::fromAxisAngle({0.6f, 0.0f, 0.8f}, 1.2f))
+                                 * Matrix4<float>::scale(Vector3<float>(3.0f, 2.0f, 1.0f));
+
+  SUBCASE("matches the point-at-a-time transforms") {
+    for (const size_t count : c_counts) {
+      const auto x = coordinates(count, -6.0f, 0.25f);
+      const auto y = coordinates(count, 2.0f, 0.5f);
+      const auto z = coordinates(count, 9.0f, -1.0f);
+
+      std::vector<float> batchX(count), batchY(count), batchZ(count);
+      std::vector<float> scalarX(count), scalarY(count), scalarZ(count);
+
+      toy::math::transformPoints(transform, x.data(), y.data(), z.data(), batchX.data(), batchY.data(),
+                                 batchZ.data(), count);
+      toy::math::scalar::transformPoints(transform, x.data(), y.data(), z.data(), scalarX.data(), scalarY.data(),
+                                         scalarZ.data(), count);
+
+      for (size_t index = 0; index < count; ++index) {
+        const Vector3<float> expected = transform.transformPoint({x[index], y[index], z[index]});
+
+        CHECK_LE(std::abs(batchX[index] - expected.x), c_tolerance);
+        CHECK_LE(std::abs(batchY[index] - expected.y), c_tolerance);
+        CHECK_LE(std::abs(batchZ[index] - expected.z), c_tolerance);
+        CHECK_LE(std::abs(scalarX[index] - expected.x), c_tolerance);
+        CHECK_LE(std::abs(scalarY[index] - expected.y), c_tolerance);
+        CHECK_LE(std::abs(scalarZ[index] - expected.z), c_tolerance);
+      }
+    }
+  }
+
+  SUBCASE("in place") {
+    auto x = coordinates(21, 0.5f, 0.5f);
+    auto y = coordinates(21, -3.0f, 0.25f);
+    auto z = coordinates(21, 7.0f, -0.75f);
+
+    const auto sourceX = x;
+    const auto sourceY = y;
+    const auto sourceZ = z;
+
+    toy::math::transformPoints(transform, x.data(), y.data(), z.data(), x.data(), y.data(), z.data(), x.size());
+
+    for (size_t index = 0; index < x.size(); ++index) {
+      const Vector3<float> expected = transform.transformPoint({sourceX[index], sourceY[index], sourceZ[index]});
+
+      CHECK_LE(std::abs(x[index] - expected.x), c_tolerance);
+      CHECK_LE(std::abs(y[index] - expected.y), c_tolerance);
+      CHECK_LE(std::abs(z[index] - expected.z), c_tolerance);
+    }
+  }
+
+  SUBCASE("a point rounds the same wherever it falls in the batch") {
+    const auto x = coordinates(100, -6.3f, 0.377f);
+    const auto y = coordinates(100, 2.1f, 0.519f);
+    const auto z = coordinates(100, 9.7f, -1.093f);
+
+    std::vector<float> wholeX(x.size()), wholeY(y.size()), wholeZ(z.size());
+
+    toy::math::transformPoints(transform, x.data(), y.data(), z.data(), wholeX.data(), wholeY.data(), wholeZ.data(),
+                               x.size());
+
+    for (size_t start = 1; start < x.size(); ++start) {
+      std::vector<float> partX(x.size() - start), partY(y.size() - start), partZ(z.size() - start);
+
+      toy::math::transformPoints(transform, x.data() + start, y.data() + start, z.data() + start, partX.data(),
+                                 partY.data(), partZ.data(), partX.size());
+
+      for (size_t index = 0; index < partX.size(); ++index) {
+        CHECK_EQ(partX[index], wholeX[start + index]);
+        CHECK_EQ(partY[index], wholeY[start + index]);
+        CHECK_EQ(partZ[index], wholeZ[start + index]);
+      }
+    }
+  }
+}
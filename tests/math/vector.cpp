@@ -0,0 +1,234 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   vector.cpp
+  \brief  Unit tests for the toy::math vectors, matrices, and quaternions over float and fixed point.
+*/
+
+#include <doctest/doctest.h>
+
+#include <cmath>
+
+#include "math.hpp"
+
+namespace {
+
+using Fixed16 = toy::math::Fixed<16, 16>;
+
+// Tolerance of results that go through sqrt, trigonometry, or rounded products
+constexpr double c_tolerance = 0.0001;
+
+template <typename T>
+double toDouble(T value) {
+  return static_cast<double>(value);
+}
+
+// Gameplay code as it is written once for every target: steers toward a target at a constant speed
+template <typename T>
+toy::math::Vector2<T> steer(const toy::math::Vector2<T> & position, const toy::math::Vector2<T> & target, T speed) {
+  using namespace toy::math;
+
+  const T    heading   = atan2(target.y - position.y, target.x - position.x);
+  const auto direction = sinCos(heading);
+  Vector2<T> next      = position;
+
+  next += Vector2<T>{direction.cosine, direction.sine} * (speed * T(0.5));
+
+  return next;
+}
+
+template <typename T>
+void checkArithmetic() {
+  using Vector2 = toy::math::Vector2<T>;
+  using Vector3 = toy::math::Vector3<T>;
+
+  const Vector2 a{T(1), T(2)};
+  const Vector2 b{T(3), T(-4)};
+
+  CHECK_EQ(a + b, Vector2(T(4), T(-2)));
+  CHECK_EQ(a - b, Vector2(T(-2), T(6)));
+  CHECK_EQ(-a, Vector2(T(-1), T(-2)));
+  CHECK_EQ(a * T(2), Vector2(T(2), T(4)));
+  CHECK_EQ(T(2) * a, Vector2(T(2), T(4)));
+  CHECK_EQ(b / T(2), Vector2(T(1.5), T(-2)));
+
+  const Vector3 x{T(1), T(0), T(0)};
+  const Vector3 y{T(0), T(1), T(0)};
+
+  CHECK_EQ(toy::math::dot(a, b), T(-5));
+  CHECK_EQ(toy::math::cross(Vector2(T(1), T(0)), Vector2(T(0), T(1))), T(1));
+  CHECK_EQ(toy::math::dot(x, y), T(0));
+  CHECK_EQ(toy::math::cross(x, y), Vector3(T(0), T(0), T(1)));
+}
+
+template <typename T>
+void checkLengths() {
+  using Vector2 = toy::math::Vector2<T>;
+  using Vector3 = toy::math::Vector3<T>;
+
+  CHECK_LE(std::abs(toDouble(toy::math::length(Vector2{T(3), T(4)})) - 5.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(toy::math::length(Vector3{T(2), T(3), T(6)})) - 7.0), c_tolerance);
+
+  // The square of this length is past the range of 16.16
+  CHECK_LE(std::abs(toDouble(toy::math::length(Vector2{T(300), T(-400)})) - 500.0), c_tolerance);
+
+  const Vector2 unit = toy::math::normalize(Vector2{T(0), T(-7)});
+
+  CHECK_LE(std::abs(toDouble(unit.y) + 1.0), c_tolerance);
+  CHECK_EQ(toy::math::normalize(Vector2()), Vector2());
+
+  const Vector2 next = steer(Vector2{T(0), T(0)}, Vector2{T(10), T(10)}, T(2));
+
+  CHECK_LE(std::abs(toDouble(next.x) - std::sqrt(0.5)), c_tolerance);
+  CHECK_LE(std::abs(toDouble(next.y) - std::sqrt(0.5)), c_tolerance);
+}
+
+template <typename T>
+void checkMatrices() {
+  using Vector2 = toy::math::Vector2<T>;
+  using Matrix3 = toy::math::Matrix3<T>;
+
+  // Scale first, then rotate a quarter turn, then translate
+  const Matrix3 transform = Matrix3::translation({T(10), T(20)}) * Matrix3::rotation(toy::math::c_pi<T> / T(2))
+                          * Matrix3::scale({T(2), T(3)});
+
+  const Vector2 point     = transform.transformPoint({T(1), T(1)});
+  const Vector2 direction = transform.transformVector({T(1), T(0)});
+
+  CHECK_LE(std::abs(toDouble(point.x) - 7.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(point.y) - 22.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(direction.x)), c_tolerance);
+  CHECK_LE(std::abs(toDouble(direction.y) - 2.0), c_tolerance);
+
+  const Matrix3 scale = Matrix3::scale({T(2), T(3)});
+
+  CHECK_EQ(Matrix3::identity() * scale, scale);
+  CHECK_EQ(scale.determinant(), T(6));
+  CHECK_EQ(Matrix3::identity().determinant(), T(1));
+  CHECK_EQ(Matrix3::translation(Vector2(T(4), T(5))).at(1, 2), T(5));
+  CHECK_EQ(Matrix3::translation(Vector2(T(4), T(5))).transposed().at(2, 0), T(4));
+}
+
+template <typename T>
+void checkSpatial() {
+  using Vector3    = toy::math::Vector3<T>;
+  using Vector4    = toy::math::Vector4<T>;
+  using Matrix4    = toy::math::Matrix4<T>;
+  using Quaternion = toy::math::Quaternion<T>;
+
+  const Vector4 a(T(1), T(2), T(3), T(4));
+  const Vector4 b(T(-2), T(1), T(0), T(1));
+
+  CHECK_EQ(a + b, Vector4(T(-1), T(3), T(3), T(5)));
+  CHECK_EQ(a - b, Vector4(T(3), T(1), T(3), T(3)));
+  CHECK_EQ(a * T(2), Vector4(T(2), T(4), T(6), T(8)));
+  CHECK_EQ(toy::math::dot(a, b), T(4));
+  CHECK_EQ(Matrix4::identity() * a, a);
+
+  // A quarter turn about z takes x to y; twice is a half turn
+  const Quaternion quarter = Quaternion::fromAxisAngle(Vector3(T(0), T(0), T(1)), toy::math::c_pi<T> / T(2));
+  const Vector3    turned  = quarter.rotate(Vector3(T(1), T(0), T(0)));
+  const Vector3    twice   = (quarter * quarter).rotate(Vector3(T(1), T(0), T(0)));
+  const Quaternion back    = quarter * quarter.conjugate();
+
+  CHECK_LE(std::abs(toDouble(turned.x)), c_tolerance);
+  CHECK_LE(std::abs(toDouble(turned.y) - 1.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(twice.x) + 1.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(twice.y)), c_tolerance);
+  CHECK_LE(std::abs(toDouble(back.w) - 1.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(back.z)), c_tolerance);
+  CHECK_LE(std::abs(toDouble(toy::math::normalize(Quaternion{T(0), T(0), T(3), T(4)}).z) - 0.6), c_tolerance);
+
+  // Scale first, then rotate, then translate; the matrix of a rotation agrees with the rotation itself
+  const Matrix4 transform = Matrix4::translation(Vector3(T(10), T(20), T(30))) * Matrix4::rotation(quarter)
+                          * Matrix4::scale(Vector3(T(2), T(3), T(4)));
+
+  const Vector3 point     = transform.transformPoint(Vector3(T(1), T(1), T(1)));
+  const Vector3 direction = Matrix4::rotation(quarter).transformVector(Vector3(T(1), T(0), T(0)));
+
+  CHECK_LE(std::abs(toDouble(point.x) - 7.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(point.y) - 22.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(point.z) - 34.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(direction.x - turned.x)), c_tolerance);
+  CHECK_LE(std::abs(toDouble(direction.y - turned.y)), c_tolerance);
+  CHECK_EQ(Matrix4::translation(Vector3(T(4), T(5), T(6))).at(2, 3), T(6));
+  CHECK_EQ(Matrix4::translation(Vector3(T(4), T(5), T(6))).transposed().at(3, 0), T(4));
+}
+
+// The float products take the vector path at run time and the portable one in constant evaluation
+static_assert(toy::math::Matrix4<float>::identity() * toy::math::Vector4<float>(1, 2, 3, 4)
+              == toy::math::Vector4<float>(1, 2, 3, 4));
+static_assert(toy::math::Quaternion<float>{} * toy::math::Quaternion<float>{} == toy::math::Quaternion<float>{});
+
+} // namespace
+
+TEST_CASE("math/vector/arithmetic") {
+  SUBCASE("float") {
+    checkArithmetic<float>();
+  }
+
+  SUBCASE("fixed point") {
+    checkArithmetic<Fixed16>();
+  }
+}
+
+TEST_CASE("math/vector/lengths") {
+  SUBCASE("float") {
+    checkLengths<float>();
+  }
+
+  SUBCASE("fixed point") {
+    checkLengths<Fixed16>();
+  }
+}
+
+TEST_CASE("math/vector/matrices") {
+  SUBCASE("float") {
+    checkMatrices<float>();
+  }
+
+  SUBCASE("fixed point") {
+    checkMatrices<Fixed16>();
+  }
+}
+
+TEST_CASE("math/vector/spatial") {
+  SUBCASE("float") {
+    checkSpatial<float>();
+  }
+
+  SUBCASE("fixed point") {
+    checkSpatial<Fixed16>();
+  }
+}
+
+TEST_CASE("math/vector/real") {
+#ifdef TOYGINE_FIXED_POINT_MATH
+  static_assert(std::is_same_v<toy::math::real, Fixed16>);
+#else
+  static_assert(std::is_same_v<toy::math::real, float>);
+#endif
+
+  const toy::math::Mat3 rotation = toy::math::Mat3::rotation(toy::math::c_pi<toy::math::real>);
+  const toy::math::Vec2 turned   = rotation.transformVector({1, 0});
+
+  CHECK_LE(std::abs(toDouble(turned.x) + 1.0), c_tolerance);
+  CHECK_LE(std::abs(toDouble(turned.y)), c_tolerance);
+}
@@ -0,0 +1,408 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   blitter.cpp
+  \brief  Unit tests for toy::render sprites, affine sprites, and tile layers against pixel-at-a-time references.
+
+  Random scenes are drawn twice, by the line-based draws and by the plain loops below, and the frames compared by hash:
+  the same check headless builds run on every target.
+*/
+
+#include <doctest/doctest.h>
+
+#include <deque>
+#include <vector>
+
+#include "render.hpp"
+
+using toy::render::AffineScalar;
+using toy::render::AffineTransform;
+using toy::render::Bitmap;
+using toy::render::Framebuffer;
+using toy::render::Palette;
+using toy::render::PixelFormat;
+using toy::render::Sprite;
+using toy::render::TileLayer;
+
+namespace {
+
+constexpr uint32_t c_frameWidth  = 100;
+constexpr uint32_t c_frameHeight = 60;
+
+// Pseudo-random numbers, reproducible across runs
+struct Random {
+  uint32_t next() {
+    state = state * 1664525U + 1013904223U;
+
+    return state >> 8;
+  }
+
+  int32_t between(int32_t low, int32_t high) {
+    return low + static_cast<int32_t>(next() % static_cast<uint32_t>(high - low + 1));
+  }
+
+  uint32_t state;
+};
+
+Palette testPalette() {
+  Palette palette;
+
+  for (size_t index = 0; index < palette.colors.size(); ++index)
+    palette.colors[index] = static_cast<uint16_t>(index * 0x0101 + 0x0841);
+
+  return palette;
+}
+
+// Frame with its own pixels, cleared to a pattern so transparent pixels show
+struct Frame {
+  Frame(PixelFormat format)
+    : pixels(toy::render::rowSize(format, c_frameWidth) * c_frameHeight)
+    , view(pixels.data(), c_frameWidth, c_frameHeight, format) {
+    for (size_t index = 0; index < pixels.size(); ++index)
+      pixels[index] = static_cast<uint8_t>(index * 7);
+  }
+
+  std::vector<uint8_t> pixels;
+  Framebuffer          view;
+};
+
+// Image of random pixels, a third of them transparent
+Bitmap randomImage(std::deque<std::vector<uint8_t>> & storage, Random & random, uint32_t width, uint32_t height,
+                   PixelFormat format) {
+  const size_t stride = toy::render::rowSize(format, width) + random.next() % 3;
+
+  storage.emplace_back(stride * height);
+
+  for (uint8_t & value : storage.back()) {
+    value = static_cast<uint8_t>(random.next());
+
+    if (random.next() % 3 == 0)
+      value = format == PixelFormat::Indexed8 ? 0 : static_cast<uint8_t>(value & 0xF0);
+  }
+
+  return Bitmap(storage.back().data(), width, height, format, stride);
+}
+
+uint8_t texelOf(const Bitmap & image, uint32_t x, uint32_t y, uint8_t bank) {
+  const auto * row = reinterpret_cast<const uint8_t *>(image.row(y));
+
+  if (image.format() == PixelFormat::Indexed8)
+    return row[x];
+
+  const int pixel = (x % 2 == 0 ? row[x / 2] : row[x / 2] >> 4) & 0x0F;
+
+  return pixel != 0 ? static_cast<uint8_t>(bank * 16 + pixel) : uint8_t{0};
+}
+
+void plot(const Framebuffer & frame, int64_t x, int64_t y, uint8_t index, const Palette & palette) {
+  if (index == 0 || x < 0 || y < 0 || x >= frame.width() || y >= frame.height())
+    return;
+
+  std::byte * row = frame.row(static_cast<uint32_t>(y));
+
+  if (frame.format() == PixelFormat::Indexed8)
+    reinterpret_cast<uint8_t *>(row)[x] = index;
+  else
+    reinterpret_cast<uint16_t *>(row)[x] = palette.colors[index];
+}
+
+void referenceSprite(const Framebuffer & frame, const Sprite & sprite, const Palette & palette) {
+  const Bitmap & image = sprite.image;
+
+  for (uint32_t y = 0; y < image.height(); ++y) {
+    for (uint32_t x = 0; x < image.width(); ++x) {
+      const int64_t frameX = sprite.x + int64_t{sprite.flipX ? image.width() - 1 - x : x};
+      const int64_t frameY = sprite.y + int64_t{sprite.flipY ? image.height() - 1 - y : y};
+
+      plot(frame, frameX, frameY, texelOf(image, x, y, sprite.paletteBank), palette);
+    }
+  }
+}
+
+void referenceAffineSprite(const Framebuffer & frame, const Sprite & sprite, const AffineTransform & transform,
+                           const Palette & palette) {
+  const Bitmap & image     = sprite.image;
+  const int64_t  boxWidth  = int64_t{image.width()} * (transform.doubleSize ? 2 : 1);
+  const int64_t  boxHeight = int64_t{image.height()} * (transform.doubleSize ? 2 : 1);
+
+  for (int64_t y = 0; y < boxHeight; ++y) {
+    for (int64_t x = 0; x < boxWidth; ++x) {
+      const int64_t dx = x - boxWidth / 2;
+      const int64_t dy = y - boxHeight / 2;
+      const int64_t u  = (int64_t{image.width() / 2} << 16) + transform.a.raw() * dx + transform.b.raw() * dy;
+      const int64_t v  = (int64_t{image.height() / 2} << 16) + transform.c.raw() * dx + transform.d.raw() * dy;
+
+      if (u < 0 || v < 0 || (u >> 16) >= image.width() || (v >> 16) >= image.height())
+        continue;
+
+      const uint8_t index
+        = texelOf(image, static_cast<uint32_t>(u >> 16), static_cast<uint32_t>(v >> 16), sprite.paletteBank);
+
+      plot(frame, sprite.x + x, sprite.y + y, index, palette);
+    }
+  }
+}
+
+int64_t wrapped(int64_t value, int64_t size) {
+  return ((value % size) + size) % size;
+}
+
+void referenceTileLayer(const Framebuffer & frame, const TileLayer & layer, const Palette & palette) {
+  const size_t rowBytes  = layer.format == PixelFormat::Indexed4 ? 4 : 8;
+  const size_t tileCount = layer.tiles.size() / (rowBytes * 8);
+
+  for (uint32_t y = 0; y < frame.height(); ++y) {
+    const int64_t shift = y < layer.lineScroll.size() ? layer.lineScroll[y] : 0;
+
+    for (uint32_t x = 0; x < frame.width(); ++x) {
+      const int64_t  layerX = wrapped(layer.scrollX + shift + x, int64_t{layer.columns} * 8);
+      const int64_t  layerY = wrapped(layer.scrollY + int64_t{y}, int64_t{layer.rows} * 8);
+      const uint16_t entry  = layer.map[static_cast<size_t>(layerY / 8 * layer.columns + layerX / 8)];
+      const size_t   number = entry & toy::render::c_tileNumberMask;
+
+      if (number >= tileCount)
+        continue;
+
+      const auto tileX = static_cast<uint32_t>((entry & toy::render::c_tileFlipX) != 0 ? 7 - layerX % 8 : layerX % 8);
+      const auto tileY = static_cast<uint32_t>((entry & toy::render::c_tileFlipY) != 0 ? 7 - layerY % 8 : layerY % 8);
+      const Bitmap tile(layer.tiles.data() + number * rowBytes * 8, 8, 8, layer.format);
+
+      plot(frame, x, y, texelOf(tile, tileX, tileY, static_cast<uint8_t>(entry >> 12)), palette);
+    }
+  }
+}
+
+} // namespace
+
+TEST_CASE("render/blitter/sprites") {
+  const Palette palette = testPalette();
+
+  SUBCASE("random sprites match the reference") {
+    for (const PixelFormat format : {PixelFormat::Indexed8, PixelFormat::Rgb565}) {
+      Random                           random{42};
+      std::deque<std::vector<uint8_t>> images;
+      Frame                            drawn(format);
+      Frame                            expected(format);
+
+      for (size_t index = 0; index < 200; ++index) {
+        const auto width  = static_cast<uint32_t>(random.between(1, 70));
+        const auto height = static_cast<uint32_t>(random.between(1, 30));
+        const auto image  = random.next() % 2 == 0 ? PixelFormat::Indexed4 : PixelFormat::Indexed8;
+
+        Sprite sprite;
+
+        sprite.image       = randomImage(images, random, width, height, image);
+        sprite.x           = random.between(-80, 110);
+        sprite.y           = random.between(-40, 70);
+        sprite.paletteBank = static_cast<uint8_t>(random.next() % 16);
+        sprite.flipX       = random.next() % 2 == 0;
+        sprite.flipY       = random.next() % 2 == 0;
+
+        toy::render::drawSprite(drawn.view, sprite, palette);
+        referenceSprite(expected.view, sprite, palette);
+      }
+
+      CHECK_EQ(drawn.view.hash(), expected.view.hash());
+      CHECK(drawn.pixels == expected.pixels);
+    }
+  }
+
+  SUBCASE("transparency, flips, and banks") {
+    // 4 by 1 image of 4-bit pixels 1, 0, 2, 3
+    const uint8_t pixels[] = {0x01, 0x32};
+    Frame         frame(PixelFormat::Indexed8);
+
+    frame.view.clear(9);
+
+    Sprite sprite{Bitmap(pixels, 4, 1, PixelFormat::Indexed4), 10, 5, 2, false, false};
+
+    toy::render::drawSprite(frame.view, sprite, palette);
+
+    const uint8_t * row = frame.pixels.data() + 5 * c_frameWidth;
+
+    CHECK_EQ(row[10], 0x21);
+    CHECK_EQ(row[11], 9);
+    CHECK_EQ(row[12], 0x22);
+    CHECK_EQ(row[13], 0x23);
+
+    sprite.flipX = true;
+    sprite.y     = 6;
+    toy::render::drawSprite(frame.view, sprite, palette);
+
+    CHECK_EQ(row[c_frameWidth + 10], 0x23);
+    CHECK_EQ(row[c_frameWidth + 11], 0x22);
+    CHECK_EQ(row[c_frameWidth + 12], 9);
+    CHECK_EQ(row[c_frameWidth + 13], 0x21);
+  }
+
+  SUBCASE("off screen and invalid sprites draw nothing") {
+    const uint8_t pixels[16] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
+    Frame         frame(PixelFormat::Indexed8);
+    const auto    before = frame.view.hash();
+
+    toy::render::drawSprite(frame.view, {Bitmap(pixels, 4, 4, PixelFormat::Indexed8), -4, 0}, palette);
+    toy::render::drawSprite(frame.view, {Bitmap(pixels, 4, 4, PixelFormat::Indexed8), 0, c_frameHeight}, palette);
+    toy::render::drawSprite(frame.view, {Bitmap(pixels, 4, 4, PixelFormat::Rgb565), 0, 0}, palette);
+    toy::render::drawSprite(frame.view, {Bitmap(), 0, 0}, palette);
+
+    CHECK_EQ(frame.view.hash(), before);
+  }
+}
+
+TEST_CASE("render/blitter/affine_sprites") {
+  const Palette palette = testPalette();
+
+  SUBCASE("random transforms match the reference") {
+    for (const PixelFormat format : {PixelFormat::Indexed8, PixelFormat::Rgb565}) {
+      Random                           random{7};
+      std::deque<std::vector<uint8_t>> images;
+      Frame                            drawn(format);
+      Frame                            expected(format);
+
+      for (size_t index = 0; index < 100; ++index) {
+        const auto width  = static_cast<uint32_t>(random.between(1, 40));
+        const auto height = static_cast<uint32_t>(random.between(1, 40));
+        const auto image  = random.next() % 2 == 0 ? PixelFormat::Indexed4 : PixelFormat::Indexed8;
+
+        Sprite          sprite{randomImage(images, random, width, height, image), random.between(-60, 110),
+                      random.between(-60, 70), static_cast<uint8_t>(random.next() % 16)};
+        AffineTransform transform;
+
+        transform.a          = AffineScalar::fromRaw(random.between(-0x20000, 0x20000));
+        transform.b          = AffineScalar::fromRaw(random.between(-0x20000, 0x20000));
+        transform.c          = AffineScalar::fromRaw(random.between(-0x20000, 0x20000));
+        transform.d          = AffineScalar::fromRaw(random.between(-0x20000, 0x20000));
+        transform.doubleSize = random.next() % 2 == 0;
+
+        toy::render::drawAffineSprite(drawn.view, sprite, transform, palette);
+        referenceAffineSprite(expected.view, sprite, transform, palette);
+      }
+
+      CHECK_EQ(drawn.view.hash(), expected.view.hash());
+    }
+  }
+
+  SUBCASE("the identity draws the plain sprite") {
+    Random                           random{3};
+    std::deque<std::vector<uint8_t>> images;
+    Frame                            affine(PixelFormat::Indexed8);
+    Frame                            plain(PixelFormat::Indexed8);
+    const Sprite                     sprite{randomImage(images, random, 13, 9, PixelFormat::Indexed4), -3, 55, 4};
+
+    toy::render::drawAffineSprite(affine.view, sprite, AffineTransform{}, palette);
+    toy::render::drawSprite(plain.view, sprite, palette);
+
+    CHECK(affine.pixels == plain.pixels);
+  }
+
+  SUBCASE("halves draw each texel twice as large") {
+    const uint8_t pixels[] = {1, 2, 3, 4};
+    Frame         frame(PixelFormat::Indexed8);
+
+    frame.view.clear(0);
+
+    const AffineTransform transform = AffineTransform::rotationScale(0, 2, 2);
+
+    CHECK_EQ(transform.a, AffineScalar(0.5));
+    CHECK_EQ(transform.b, AffineScalar(0));
+
+    toy::render::drawAffineSprite(frame.view, {Bitmap(pixels, 2, 2, PixelFormat::Indexed8), 0, 0},
+                                  {transform.a, transform.b, transform.c, transform.d, true}, palette);
+
+    const uint8_t expected[4][4] = {{1, 1, 2, 2}, {1, 1, 2, 2}, {3, 3, 4, 4}, {3, 3, 4, 4}};
+
+    for (size_t y = 0; y < 4; ++y) {
+      for (size_t x = 0; x < 4; ++x)
+        CHECK_EQ(frame.pixels[y * c_frameWidth + x], expected[y][x]);
+    }
+  }
+}
+
+TEST_CASE("render/blitter/tile_layers") {
+  const Palette palette = testPalette();
+
+  SUBCASE("scrolled layers with line offsets match the reference") {
+    for (const PixelFormat format : {PixelFormat::Indexed8, PixelFormat::Rgb565}) {
+      for (const PixelFormat tiles : {PixelFormat::Indexed4, PixelFormat::Indexed8}) {
+        Random                           random{static_cast<uint32_t>(format) * 4 + static_cast<uint32_t>(tiles)};
+        std::deque<std::vector<uint8_t>> storage;
+        const Bitmap                     sheet = randomImage(storage, random, 8, 8 * 20, tiles);
+        std::vector<uint16_t>            map(11 * 7);
+        std::vector<int16_t>             offsets(c_frameHeight - 10);
+        Frame                            drawn(format);
+        Frame                            expected(format);
+
+        // A few entries name tiles past the sheet, which draw nothing
+        for (uint16_t & entry : map)
+          entry = static_cast<uint16_t>(random.next() % 23 | (random.next() & 0xFC00));
+
+        for (int16_t & offset : offsets)
+          offset = static_cast<int16_t>(random.between(-300, 300));
+
+        TileLayer layer;
+
+        layer.tiles      = toy::span<const std::byte>(sheet.row(0), 20 * 8 * toy::render::rowSize(tiles, 8));
+        layer.format     = tiles;
+        layer.map        = map;
+        layer.columns    = 11;
+        layer.rows       = 7;
+        layer.scrollX    = random.between(-1000, 1000);
+        layer.scrollY    = random.between(-1000, 1000);
+        layer.lineScroll = offsets;
+
+        toy::render::drawTileLayer(drawn.view, layer, palette);
+        referenceTileLayer(expected.view, layer, palette);
+
+        CHECK_EQ(drawn.view.hash(), expected.view.hash());
+      }
+    }
+  }
+
+  SUBCASE("entries flip and bank their tiles") {
+    // One 4-bit tile whose top row is 1, 2, 0, 0, 0, 0, 0, 3
+    std::vector<uint8_t> tile(32, 0);
+
+    tile[0] = 0x21;
+    tile[3] = 0x30;
+
+    const uint16_t map[] = {toy::render::tileEntry(0, true, false, 6)};
+    Frame          frame(PixelFormat::Indexed8);
+
+    frame.view.clear(0);
+
+    TileLayer layer;
+
+    layer.tiles   = toy::span<const std::byte>(reinterpret_cast<const std::byte *>(tile.data()), tile.size());
+    layer.format  = PixelFormat::Indexed4;
+    layer.map     = map;
+    layer.columns = 1;
+    layer.rows    = 1;
+
+    toy::render::drawTileLayer(frame.view, layer, palette);
+
+    // The single tile repeats across the frame, mirrored
+    const uint8_t expected[] = {0x63, 0, 0, 0, 0, 0, 0x62, 0x61, 0x63};
+
+    for (size_t x = 0; x < std::size(expected); ++x)
+      CHECK_EQ(frame.pixels[x], expected[x]);
+
+    CHECK_EQ(frame.pixels[c_frameWidth], 0);
+  }
+}
@@ -0,0 +1,144 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   framebuffer.cpp
+  \brief  Unit tests for toy::render pixel formats, framebuffers, and presentation.
+*/
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "render.hpp"
+
+using toy::render::Framebuffer;
+using toy::render::PixelFormat;
+
+TEST_CASE("render/framebuffer/formats") {
+  SUBCASE("row sizes") {
+    CHECK_EQ(toy::render::rowSize(PixelFormat::Indexed4, 7), 4);
+    CHECK_EQ(toy::render::rowSize(PixelFormat::Indexed8, 7), 7);
+    CHECK_EQ(toy::render::rowSize(PixelFormat::Rgb565, 7), 14);
+  }
+
+  SUBCASE("colors widen to full range") {
+    CHECK_EQ(toy::render::rgb565(255, 255, 255), 0xFFFF);
+    CHECK_EQ(toy::render::rgb565(255, 0, 0), 0xF800);
+    CHECK_EQ(toy::render::rgb565(0, 255, 0), 0x07E0);
+    CHECK_EQ(toy::render::argb8888(0xFFFF), 0xFFFFFFFFU);
+    CHECK_EQ(toy::render::argb8888(0x0000), 0xFF000000U);
+    CHECK_EQ(toy::render::argb8888(toy::render::rgb565(0x84, 0x82, 0x84)), 0xFF848284U);
+  }
+
+  SUBCASE("validity") {
+    std::vector<uint8_t> pixels(64 * 64);
+
+    CHECK_FALSE(Framebuffer().isValid());
+    CHECK(Framebuffer(pixels.data(), 64, 64, PixelFormat::Indexed8).isValid());
+    CHECK(Framebuffer(pixels.data(), 32, 64, PixelFormat::Rgb565).isValid());
+    CHECK_FALSE(Framebuffer(pixels.data(), 64, 64, PixelFormat::Indexed4).isValid());
+    CHECK_FALSE(Framebuffer(pixels.data(), 64, 64, PixelFormat::Indexed8, 32).isValid());
+    CHECK_FALSE(Framebuffer(pixels.data(), toy::render::c_maxWidth + 1, 1, PixelFormat::Indexed8).isValid());
+    CHECK(toy::render::Bitmap(pixels.data(), 3, 3, PixelFormat::Indexed4).isValid());
+    CHECK_EQ(toy::render::Bitmap(pixels.data(), 3, 3, PixelFormat::Indexed4).stride(), 2);
+  }
+}
+
+TEST_CASE("render/framebuffer/clear_and_hash") {
+  std::vector<uint16_t> tight(16 * 8);
+  std::vector<uint16_t> padded(20 * 8);
+  const Framebuffer     first(tight.data(), 16, 8, PixelFormat::Rgb565);
+  const Framebuffer     second(padded.data(), 16, 8, PixelFormat::Rgb565, 40);
+
+  padded.assign(padded.size(), 0xDEAD);
+
+  SUBCASE("clear fills the visible pixels only") {
+    second.clear(0x1234);
+
+    CHECK_EQ(padded[15], 0x1234);
+    CHECK_EQ(padded[16], 0xDEAD);
+    CHECK_EQ(padded[20], 0x1234);
+  }
+
+  SUBCASE("equal pixels hash equally whatever the stride") {
+    first.clear(0x0F0F);
+    second.clear(0x0F0F);
+
+    CHECK_EQ(first.hash(), second.hash());
+
+    tight[37] = 0;
+
+    CHECK(first.hash() != second.hash());
+  }
+
+  SUBCASE("indexed clear") {
+    std::vector<uint8_t> indices(9 * 3, 1);
+    const Framebuffer    frame(indices.data(), 9, 3, PixelFormat::Indexed8);
+
+    frame.clear(0x0107);
+
+    CHECK(indices == std::vector<uint8_t>(9 * 3, 7));
+  }
+}
+
+TEST_CASE("render/framebuffer/present") {
+  toy::render::Palette palette;
+
+  palette.colors[1] = toy::render::rgb565(255, 0, 0);
+  palette.colors[2] = toy::render::rgb565(0, 0, 255);
+
+  // 3 by 2 frame: red, blue, backdrop on top; backdrop, red, blue below
+  std::vector<uint8_t>  indices{1, 2, 0, 0, 1, 2};
+  std::vector<uint16_t> colors{palette.colors[1], palette.colors[2], 0, 0, palette.colors[1], palette.colors[2]};
+  const Framebuffer     indexed(indices.data(), 3, 2, PixelFormat::Indexed8);
+  const Framebuffer     direct(colors.data(), 3, 2, PixelFormat::Rgb565);
+
+  SUBCASE("every scale shows the same picture") {
+    for (uint32_t scale = 1; scale <= 9; ++scale) {
+      const size_t          stride = 3 * scale + 5;
+      std::vector<uint32_t> fromIndices(stride * 2 * scale, 0);
+      std::vector<uint32_t> fromColors(stride * 2 * scale, 0);
+
+      REQUIRE(toy::render::present(indexed, palette, fromIndices, stride, scale));
+      REQUIRE(toy::render::present(direct, palette, fromColors, stride, scale));
+
+      for (size_t y = 0; y < 2 * scale; ++y) {
+        for (size_t x = 0; x < 3 * scale; ++x) {
+          const uint8_t index = indices[(y / scale) * 3 + x / scale];
+
+          CHECK_EQ(fromIndices[y * stride + x], toy::render::argb8888(palette.colors[index]));
+          CHECK_EQ(fromColors[y * stride + x], toy::render::argb8888(palette.colors[index]));
+        }
+
+        CHECK_EQ(fromIndices[y * stride + 3 * scale], 0);
+      }
+    }
+  }
+
+  SUBCASE("bad arguments") {
+    std::vector<uint32_t> output(6 * 4);
+
+    CHECK_FALSE(toy::render::present(Framebuffer(), palette, output, 6, 2));
+    CHECK_FALSE(toy::render::present(indexed, palette, output, 6, 0));
+    CHECK_FALSE(toy::render::present(indexed, palette, output, 5, 2));
+    CHECK_FALSE(toy::render::present(indexed, palette, toy::span<uint32_t>(output).first(23), 6, 2));
+    CHECK(toy::render::present(indexed, palette, output, 6, 2));
+  }
+}
@@ -0,0 +1,217 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   scanline.cpp
+  \brief  Unit tests for the row kernels of toy::render against their pixel-at-a-time references.
+*/
+
+#include <doctest/doctest.h>
+
+#include <vector>
+
+#include "render.hpp"
+
+namespace {
+
+// Counts around the vector widths, so the loops run with and without a tail
+constexpr size_t c_counts[] = {0, 1, 3, 4, 7, 8, 15, 16, 17, 31, 32, 33, 64, 100, 257};
+
+// Pseudo-random numbers, reproducible across runs
+struct Random {
+  uint32_t next() {
+    state = state * 1664525U + 1013904223U;
+
+    return state >> 8;
+  }
+
+  uint32_t state;
+};
+
+// Palette indices in runs of transparent and opaque pixels, as sprite rows have them
+std::vector<uint8_t> indices(size_t count, uint32_t seed) {
+  Random               random{seed};
+  std::vector<uint8_t> values;
+
+  while (values.size() < count) {
+    const size_t run         = 1 + random.next() % 40;
+    const bool   transparent = random.next() % 3 == 0;
+
+    for (size_t index = 0; index < run && values.size() < count; ++index)
+      values.push_back(transparent ? uint8_t{0} : static_cast<uint8_t>(1 + random.next() % 255));
+  }
+
+  return values;
+}
+
+template <typename T>
+std::vector<T> numbers(size_t count, uint32_t seed) {
+  Random         random{seed};
+  std::vector<T> values(count);
+
+  for (T & value : values)
+    value = static_cast<T>(random.next());
+
+  return values;
+}
+
+} // namespace
+
+TEST_CASE("render/scanline/compose") {
+  const auto colors = numbers<uint16_t>(toy::render::c_paletteSize, 7);
+
+  SUBCASE("indexed") {
+    for (const size_t count : c_counts) {
+      const auto source   = indices(count, static_cast<uint32_t>(count));
+      auto       vector   = numbers<uint8_t>(count, 3);
+      auto       expected = vector;
+
+      for (size_t index = 0; index < count; ++index)
+        expected[index] = source[index] != 0 ? source[index] : expected[index];
+
+      auto reference = vector;
+
+      toy::render::composeIndexed8(source.data(), count, vector.data());
+      toy::render::scalar::composeIndexed8(source.data(), count, reference.data());
+
+      CHECK(vector == expected);
+      CHECK(reference == expected);
+    }
+  }
+
+  SUBCASE("colors") {
+    for (const size_t count : c_counts) {
+      const auto source   = indices(count, static_cast<uint32_t>(count) + 11);
+      auto       vector   = numbers<uint16_t>(count, 5);
+      auto       expected = vector;
+
+      for (size_t index = 0; index < count; ++index)
+        expected[index] = source[index] != 0 ? colors[source[index]] : expected[index];
+
+      auto reference = vector;
+
+      toy::render::composeRgb565(source.data(), count, colors.data(), vector.data());
+      toy::render::scalar::composeRgb565(source.data(), count, colors.data(), reference.data());
+
+      CHECK(vector == expected);
+      CHECK(reference == expected);
+    }
+  }
+
+  SUBCASE("wholly transparent and wholly opaque lines") {
+    const std::vector<uint8_t> transparent(100, 0);
+    const std::vector<uint8_t> opaque(100, 9);
+    std::vector<uint16_t>      line(100, 0x1234);
+
+    toy::render::composeRgb565(transparent.data(), line.size(), colors.data(), line.data());
+    CHECK(line == std::vector<uint16_t>(100, 0x1234));
+
+    toy::render::composeRgb565(opaque.data(), line.size(), colors.data(), line.data());
+    CHECK(line == std::vector<uint16_t>(100, colors[9]));
+  }
+}
+
+TEST_CASE("render/scanline/unpack_and_reverse") {
+  SUBCASE("unpack 4-bit pixels into a bank") {
+    for (const size_t count : c_counts) {
+      const auto packed = numbers<uint8_t>((count + 1) / 2, static_cast<uint32_t>(count) + 1);
+
+      std::vector<uint8_t> vector(count), reference(count);
+
+      toy::render::unpackIndexed4(packed.data(), count, 5, vector.data());
+      toy::render::scalar::unpackIndexed4(packed.data(), count, 5, reference.data());
+
+      for (size_t index = 0; index < count; ++index) {
+        const int pixel = (index % 2 == 0 ? packed[index / 2] : packed[index / 2] >> 4) & 0x0F;
+
+        CHECK_EQ(int{reference[index]}, pixel != 0 ? 0x50 + pixel : 0);
+      }
+
+      CHECK(vector == reference);
+    }
+  }
+
+  SUBCASE("reverse") {
+    for (const size_t count : c_counts) {
+      const auto source = numbers<uint8_t>(count, static_cast<uint32_t>(count) + 2);
+
+      std::vector<uint8_t> vector(count), reference(count);
+
+      toy::render::reverseIndexed8(source.data(), count, vector.data());
+      toy::render::scalar::reverseIndexed8(source.data(), count, reference.data());
+
+      CHECK(reference == std::vector<uint8_t>(source.rbegin(), source.rend()));
+      CHECK(vector == reference);
+    }
+  }
+}
+
+TEST_CASE("render/scanline/expand_and_scale") {
+  SUBCASE("indexed through a palette") {
+    const auto colors = numbers<uint32_t>(toy::render::c_paletteSize, 13);
+
+    for (const size_t count : c_counts) {
+      const auto source = numbers<uint8_t>(count, static_cast<uint32_t>(count) + 3);
+
+      std::vector<uint32_t> vector(count), reference(count);
+
+      toy::render::expandIndexed8(source.data(), count, colors.data(), vector.data());
+      toy::render::scalar::expandIndexed8(source.data(), count, colors.data(), reference.data());
+
+      for (size_t index = 0; index < count; ++index)
+        CHECK_EQ(reference[index], colors[source[index]]);
+
+      CHECK(vector == reference);
+    }
+  }
+
+  SUBCASE("RGB565 colors") {
+    for (const size_t count : c_counts) {
+      const auto source = numbers<uint16_t>(count, static_cast<uint32_t>(count) + 4);
+
+      std::vector<uint32_t> vector(count), reference(count);
+
+      toy::render::expandRgb565(source.data(), count, vector.data());
+      toy::render::scalar::expandRgb565(source.data(), count, reference.data());
+
+      for (size_t index = 0; index < count; ++index)
+        CHECK_EQ(reference[index], toy::render::argb8888(source[index]));
+
+      CHECK(vector == reference);
+    }
+  }
+
+  SUBCASE("every scale") {
+    for (uint32_t scale = 1; scale <= 10; ++scale) {
+      for (const size_t count : c_counts) {
+        const auto source = numbers<uint32_t>(count, scale);
+
+        std::vector<uint32_t> vector(count * scale), reference(count * scale);
+
+        toy::render::scaleRow(source.data(), count, scale, vector.data());
+        toy::render::scalar::scaleRow(source.data(), count, scale, reference.data());
+
+        for (size_t index = 0; index < count * scale; ++index)
+          CHECK_EQ(reference[index], source[index / scale]);
+
+        CHECK(vector == reference);
+      }
+    }
+  }
+}
@@ -0,0 +1,122 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   main.cpp
+  \brief  Log decoder: prints a binary log written by toy::log::BinaryFileSink as the text lines the engine writes.
+
+  Usage: <tt>toygine-log-decoder [-level=<name>] <file></tt>. The optional level, one of the names levelName()
+  returns, skips messages below it. The decoder exits with 1 when the file cannot be read or is not a binary log, and
+  with 2 when it stops at damaged data, after printing every message before it.
+*/
+
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+#include "core.hpp"
+
+namespace {
+
+constexpr toy::string_view c_levelOption = "-level=";
+
+// Reads the whole file; an empty result means it could not be read
+std::vector<std::byte> readFile(const char * path) {
+  std::vector<std::byte> data;
+  std::FILE *            file = std::fopen(path, "rb");
+
+  if (file == nullptr)
+    return data;
+
+  std::byte buffer[64 * 1024];
+  size_t    size = 0;
+
+  while ((size = std::fread(buffer, 1, sizeof(buffer), file)) != 0)
+    data.insert(data.end(), buffer, buffer + size);
+
+  std::fclose(file);
+
+  return data;
+}
+
+// Parses a level name; false when the name is unknown
+bool parseLevel(toy::string_view name, toy::log::Level & level) {
+  for (uint8_t value = 0; value <= static_cast<uint8_t>(toy::log::Level::Fatal); ++value) {
+    if (toy::log::levelName(static_cast<toy::log::Level>(value)) == name) {
+      level = static_cast<toy::log::Level>(value);
+      return true;
+    }
+  }
+
+  return false;
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+  toy::log::Level minimum = toy::log::Level::Trace;
+  const char *    path    = nullptr;
+
+  for (int index = 1; index < argc; ++index) {
+    const toy::string_view argument(argv[index]);
+
+    if (argument.starts_with(c_levelOption)) {
+      if (!parseLevel(argument.substr(c_levelOption.size()), minimum)) {
+        std::fprintf(stderr, "Unknown level '%s'\n", argv[index] + c_levelOption.size());
+        return 1;
+      }
+    } else {
+      path = argv[index];
+    }
+  }
+
+  if (path == nullptr) {
+    std::fprintf(stderr, "Usage: %s [-level=<trace|debug|info|warning|error|fatal>] <file>\n", argv[0]);
+    return 1;
+  }
+
+  const std::vector<std::byte> data = readFile(path);
+
+  // The reader keeps every call site inline, which is too large for the stack of some platforms
+  const auto reader = std::make_unique<toy::log::BinaryLogReader>(data.data(), data.size());
+
+  if (!reader->isValid()) {
+    std::fprintf(stderr, "'%s' is not a binary log of this version and byte order\n", path);
+    return 1;
+  }
+
+  toy::log::Message message{};
+  char              line[4096];
+
+  while (reader->next(message)) {
+    if (message.site->level < minimum)
+      continue;
+
+    const size_t size = toy::log::formatLine(line, sizeof(line), message);
+
+    std::fwrite(line, 1, size < sizeof(line) ? size : sizeof(line), stdout);
+  }
+
+  if (reader->isDamaged()) {
+    std::fprintf(stderr, "'%s' is damaged; decoding stopped early\n", path);
+    return 2;
+  }
+
+  return 0;
+}
@@ -0,0 +1,196 @@
+//
+// Copyright (c) 2026 Toyman Interactive
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this
+// software and associated documentation files (the "Software"), to deal in the Software
+// without restriction, including without limitation the rights to use, copy, modify, merge,
+// publish, distribute, sublicense, and / or sell copies of the Software, and to permit
+// persons to whom the Software is furnished to do so, subject to the following conditions :
+//
+// The above copyright notice and this permission notice shall be included in all copies or
+// substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+// INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR
+// PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE
+// FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+// OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+// DEALINGS IN THE SOFTWARE.
+//
+/*!
+  \file   main.cpp
+  \brief  Pack compressor: builds a pack from a directory tree, compressing each file that shrinks.
+
+  Usage: <tt>toygine-pack-compressor [-window=<bits>] [-store] <directory> <pack></tt>. Every regular file under the
+  directory is stored under its relative path with forward slashes, the spelling the virtual file system looks up.
+  Each file is compressed into a toy::filesystem::lz stream with a window of 2^bits bytes, from 10 to 16 and 16 by
+  default; pick 12 or less for packs the handhelds stream through small rings. Files that do not shrink, and every
+  file with \c -store, are stored raw. The compressor exits with 1 when an argument is wrong or a file cannot be read
+  or written.
+*/
+
+#include <algorithm>
+#include <charconv>
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+#include "filesystem.hpp"
+
+namespace {
+
+constexpr toy::string_view c_windowOption = "-window=";
+constexpr toy::string_view c_storeOption  = "-store";
+
+// One file of the pack, with the bytes stored for it
+struct Entry {
+  std::string            path;
+  std::vector<std::byte> data;
+  size_t                 rawSize;
+  bool                   compressed;
+};
+
+// Reads the whole file; false when it cannot be read
+bool readFile(const std::filesystem::path & path, std::vector<std::byte> & data) {
+  std::FILE * file = std::fopen(path.string().c_str(), "rb");
+
+  if (file == nullptr)
+    return false;
+
+  std::byte buffer[64 * 1024];
+  size_t    size = 0;
+
+  while ((size = std::fread(buffer, 1, sizeof(buffer), file)) != 0)
+    data.insert(data.end(), buffer, buffer + size);
+
+  const bool failed = std::ferror(file) != 0;
+
+  std::fclose(file);
+
+  return !failed;
+}
+
+// Writes \a data to a new file at \a path; false when it cannot be written
+bool writeFile(const char * path, const std::vector<std::byte> & data) {
+  std::FILE * file = std::fopen(path, "wb");
+
+  if (file == nullptr)
+    return false;
+
+  const bool written = std::fwrite(data.data(), 1, data.size(), file) == data.size();
+
+  return std::fclose(file) == 0 && written;
+}
+
+// Replaces the contents of \a entry with their stream when it is smaller
+void compressEntry(Entry & entry, uint8_t windowBits) {
+  std::vector<std::byte> stream(toy::filesystem::lz::compressBound(entry.data.size(), windowBits));
+
+  stream.resize(toy::filesystem::lz::compress(entry.data, stream, windowBits));
+
+  if (!stream.empty() && stream.size() < entry.data.size()) {
+    entry.data       = std::move(stream);
+    entry.compressed = true;
+  }
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+  uint8_t      windowBits = toy::filesystem::lz::c_defaultWindowBits;
+  bool         store      = false;
+  const char * paths[2]   = {nullptr, nullptr};
+  size_t       pathCount  = 0;
+
+  for (int index = 1; index < argc; ++index) {
+    const toy::string_view argument(argv[index]);
+
+    if (argument.starts_with(c_windowOption)) {
+      const toy::string_view value = argument.substr(c_windowOption.size());
+      const auto             result = std::from_chars(value.data(), value.data() + value.size(), windowBits);
+
+      if (result.ec != std::errc() || result.ptr != value.data() + value.size()
+          || windowBits < toy::filesystem::lz::c_minWindowBits || windowBits > toy::filesystem::lz::c_maxWindowBits) {
+        std::fprintf(stderr, "Window bits must be from %d to %d\n", toy::filesystem::lz::c_minWindowBits,
+                     toy::filesystem::lz::c_maxWindowBits);
+        return 1;
+      }
+    } else if (argument == c_storeOption) {
+      store = true;
+    } else if (pathCount < 2) {
+      paths[pathCount++] = argv[index];
+    } else {
+      pathCount = 3;
+    }
+  }
+
+  if (pathCount != 2) {
+    std::fprintf(stderr, "Usage: %s [-window=<10..16>] [-store] <directory> <pack>\n", argv[0]);
+    return 1;
+  }
+
+  const std::filesystem::path root(paths[0]);
+  std::vector<Entry>          entries;
+  std::error_code             error;
+
+  for (auto iterator = std::filesystem::recursive_directory_iterator(root, error);
+       !error && iterator != std::filesystem::recursive_directory_iterator(); iterator.increment(error)) {
+    if (!iterator->is_regular_file())
+      continue;
+
+    Entry entry{iterator->path().lexically_relative(root).generic_string(), {}, 0, false};
+
+    if (!readFile(iterator->path(), entry.data)) {
+      std::fprintf(stderr, "Cannot read '%s'\n", iterator->path().string().c_str());
+      return 1;
+    }
+
+    entry.rawSize = entry.data.size();
+    entries.push_back(std::move(entry));
+  }
+
+  if (error) {
+    std::fprintf(stderr, "Cannot list '%s': %s\n", paths[0], error.message().c_str());
+    return 1;
+  }
+
+  // Directory order differs between systems; sorted paths give the same pack everywhere
+  std::sort(entries.begin(), entries.end(), [](const Entry & left, const Entry & right) {
+    return left.path < right.path;
+  });
+
+  std::vector<toy::filesystem::PackSource> sources;
+  size_t                                   rawSize        = 0;
+  size_t                                   compressedSize = 0;
+  size_t                                   compressed     = 0;
+
+  for (Entry & entry : entries) {
+    if (!store)
+      compressEntry(entry, windowBits);
+
+    rawSize += entry.rawSize;
+    compressedSize += entry.data.size();
+    compressed += entry.compressed ? 1 : 0;
+    sources.push_back({entry.path, entry.data, entry.compressed});
+  }
+
+  std::vector<std::byte> image(toy::filesystem::packImageSize(sources));
+
+  if (image.empty() || toy::filesystem::writePack(sources, image) != image.size()) {
+    std::fprintf(stderr, "Cannot build the pack: a path is too long, or two paths have the same hash\n");
+    return 1;
+  }
+
+  if (!writeFile(paths[1], image)) {
+    std::fprintf(stderr, "Cannot write '%s'\n", paths[1]);
+    return 1;
+  }
+
+  std::printf("%zu files, %zu compressed: %zu bytes of data stored in %zu (%.1f%%), pack of %zu bytes\n",
+              entries.size(), compressed, rawSize, compressedSize,
+              rawSize > 0 ? 100.0 * static_cast<double>(compressedSize) / static_cast<double>(rawSize) : 100.0,
+              image.size());
+
+  return 0;
+}